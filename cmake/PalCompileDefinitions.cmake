@@ -76,6 +76,14 @@ function(pal_compile_definitions)
         target_compile_definitions(pal PRIVATE PAL_ENABLE_DEVDRIVER_USAGE=1)
     endif()
 
+    if(PAL_BUILD_SLAB_ALLOCATOR)
+        target_compile_definitions(pal PRIVATE PAL_BUILD_SLAB_ALLOCATOR=1)
+    endif()
+
+    if(PAL_BUILD_CPU_ZONES)
+        target_compile_definitions(pal PRIVATE PAL_ENABLE_CPU_ZONES=1)
+    endif()
+
     if(PAL_ENABLE_PRINTS_ASSERTS)
         target_compile_definitions(pal PUBLIC
             $<$<NOT:$<CONFIG:Debug>>:PAL_ENABLE_PRINTS_ASSERTS=1>
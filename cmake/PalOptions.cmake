@@ -38,6 +38,8 @@ pal_include_guard(PalOptions)
 macro(pal_options)
 
     option(PAL_BUILD_NULL_DEVICE "Build null device backend for offline compilation?" ON)
+    cmake_dependent_option(PAL_BUILD_BENCH "Build the palBench null device CPU benchmark?" OFF "PAL_BUILD_NULL_DEVICE" OFF)
+    option(PAL_BUILD_UTIL_BENCH "Build the utilBench utility collection microbenchmark?" OFF)
 
     option(PAL_BUILD_GPUOPEN "Build GPUOpen developer driver support?" OFF)
 
@@ -52,6 +54,10 @@ macro(pal_options)
 
     option(PAL_MEMTRACK "Enable PAL memory tracker?" OFF)
 
+    option(PAL_BUILD_SLAB_ALLOCATOR "Use PAL's slab allocator when the client provides no allocation callbacks?" OFF)
+
+    option(PAL_BUILD_CPU_ZONES "Compile PAL's CPU profiling zones into the hot paths?" OFF)
+
     option(PAL_BUILD_CORE "Build PAL Core?" ON)
     option(PAL_BUILD_GPUUTIL "Build PAL GPU Util?" ON)
     cmake_dependent_option(PAL_BUILD_LAYERS "Build PAL Layers?" ON "PAL_BUILD_GPUUTIL" OFF)
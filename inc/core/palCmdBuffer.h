@@ -495,12 +495,19 @@ union CmdBufferBuildFlags
         /// non-TMZ memory, the results are undefined. Only valid for graphics and compute.
         uint32  enableTmz                    :  1;
 
+        /// Allows PAL to defer the work of CmdBarrier() and CmdReleaseThenAcquire() until the next command that needs
+        /// it to have executed (e.g., a draw, dispatch, copy or End()).  Back-to-back barriers with no work between
+        /// them are merged into a single barrier: cache operations and waits are combined, and chained or duplicate
+        /// image layout transitions are folded together.  Barriers which wait on or signal GPU events, range-checked
+        /// targets or custom sample patterns are never deferred.
+        uint32 deferBarriers                 :  1;
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 621
         /// Reserved for future use.
-        uint32 reserved                      :  21;
+        uint32 reserved                      :  20;
 #else
         /// Reserved for future use.
-        uint32 reserved                      :  22;
+        uint32 reserved                      :  21;
 #endif
 
     };
@@ -1200,6 +1207,77 @@ struct DispatchIndirectArgs
     uint32 z;  ///< Threadgroups to dispatch in the Z dimension.
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+/// Specifies one direct, non-indexed draw issued by @ref ICmdBuffer::CmdDrawMulti, along with the graphics user data
+/// entries which must be updated before it is issued.
+struct MultiDrawInfo
+{
+    uint32        firstVertex;    ///< Starting index value for the draw.
+    uint32        vertexCount;    ///< Number of vertices to draw.  If zero, this draw will be discarded.
+    uint32        firstInstance;  ///< Starting instance for the draw.
+    uint32        instanceCount;  ///< Number of instances to draw.  If zero, this draw will be discarded.
+    uint32        firstEntry;     ///< First graphics user data entry to update before this draw.
+    uint32        entryCount;     ///< Number of graphics user data entries to update before this draw.  May be zero,
+                                  ///  in which case the user data from the previous draw is inherited.
+    const uint32* pEntryValues;   ///< Values to write into the user data entries.  Ignored if entryCount is zero.
+};
+
+/// Specifies one direct, indexed draw issued by @ref ICmdBuffer::CmdDrawIndexedMulti, along with the graphics user
+/// data entries which must be updated before it is issued.
+struct MultiDrawIndexedInfo
+{
+    uint32        firstIndex;     ///< Starting index buffer slot for the draw.
+    uint32        indexCount;     ///< Number of vertices to draw.  If zero, this draw will be discarded.
+    int32         vertexOffset;   ///< Offset added to the index fetched from the index buffer.
+    uint32        firstInstance;  ///< Starting instance for the draw.
+    uint32        instanceCount;  ///< Number of instances to draw.  If zero, this draw will be discarded.
+    uint32        firstEntry;     ///< First graphics user data entry to update before this draw.
+    uint32        entryCount;     ///< Number of graphics user data entries to update before this draw.  May be zero,
+                                  ///  in which case the user data from the previous draw is inherited.
+    const uint32* pEntryValues;   ///< Values to write into the user data entries.  Ignored if entryCount is zero.
+};
+#endif
+
+/// Selects which argument of a draw or dispatch a command buffer template patch slot refers to.
+///
+/// @see ICmdBuffer::CmdDeclarePatchSlot
+enum class CmdPatchSlotType : uint32
+{
+    VertexCount = 0,     ///< The vertexCount or indexCount of the next @ref ICmdBuffer::CmdDraw or
+                         ///  @ref ICmdBuffer::CmdDrawIndexed.
+    InstanceCount,       ///< The instanceCount of the next @ref ICmdBuffer::CmdDraw or @ref ICmdBuffer::CmdDrawIndexed.
+    IndexBufferAddress,  ///< The index buffer GPU virtual address used by the next @ref ICmdBuffer::CmdDrawIndexed.
+    DispatchSize,        ///< The x, y and z threadgroup counts of the next @ref ICmdBuffer::CmdDispatch.
+    UserData,            ///< One user data entry as seen by the next draw or dispatch.
+    Count
+};
+
+/// Declares one patch slot in a command buffer template.  @see ICmdBuffer::CmdDeclarePatchSlot.
+struct CmdPatchSlotInfo
+{
+    uint32            slotId;         ///< Client-chosen identifier matched against @ref CmdPatchValue::slotId.  Any
+                                      ///  number of slots may share an identifier; they all receive the same value.
+    CmdPatchSlotType  type;           ///< Which draw or dispatch argument is patchable.
+    PipelineBindPoint bindPoint;      ///< Bind point of the user data entry.  Only used by CmdPatchSlotType::UserData.
+    uint32            userDataEntry;  ///< User data entry to patch.  Only used by CmdPatchSlotType::UserData.  The
+                                      ///  entry must be mapped to a user-SGPR by the bound pipeline; spilled entries
+                                      ///  cannot be patched.
+};
+
+/// Specifies the value written into every patch slot with a matching identifier when a command buffer template is
+/// instantiated.  @see ICmdBuffer::CmdExecuteTemplate.
+struct CmdPatchValue
+{
+    uint32 slotId;                    ///< Identifier of the patch slot(s) to update.
+    union
+    {
+        uint32  u32;                  ///< New value for VertexCount, InstanceCount and UserData slots.
+        gpusize gpuVirtAddr;          ///< New index buffer address for IndexBufferAddress slots.  The firstIndex
+                                      ///  offset of the recorded draw is reapplied to this address.
+        uint32  dispatchSize[3];      ///< New x, y and z threadgroup counts for DispatchSize slots.
+    };
+};
+
 /// @internal
 /// Function pointer type definition for setting pipeline-accessible user data entries to the specified values. Each
 /// command buffer object has one such callback per pipeline bind point, so the bind point is implicit.
@@ -1243,6 +1321,24 @@ typedef void (PAL_STDCALL *CmdDrawIndexedFunc)(
     uint32      firstInstance,
     uint32      instanceCount);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+/// @internal Function pointer type definition for issuing a batch of direct, non-indexed draws.
+///
+/// @see ICmdBuffer::CmdDrawMulti().
+typedef void (PAL_STDCALL *CmdDrawMultiFunc)(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws);
+
+/// @internal Function pointer type definition for issuing a batch of direct, indexed draws.
+///
+/// @see ICmdBuffer::CmdDrawIndexedMulti().
+typedef void (PAL_STDCALL *CmdDrawIndexedMultiFunc)(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws);
+#endif
+
 /// @internal Function pointer type definition for issuing indirect draws.
 ///
 /// @see ICmdBuffer::CmdDrawIndirectMulti().
@@ -2217,6 +2313,47 @@ public:
         m_funcTable.pfnCmdDrawIndexed(this, firstIndex, indexCount, vertexOffset, firstInstance, instanceCount);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    /// Issues a batch of instanced, non-indexed draws using the command buffer's currently bound graphics state.  Each
+    /// draw may update a range of graphics user data entries before it is issued; no other state may change between
+    /// the draws in the batch.
+    ///
+    /// This is functionally equivalent to calling CmdSetUserData() and CmdDraw() once per element of pDraws, but it
+    /// allows the implementation to validate the shared graphics state only once for the whole batch.  Clients should
+    /// prefer it for long runs of draws which differ only by their arguments and a few user data entries.
+    ///
+    /// @see CmdDraw
+    /// @see MultiDrawInfo
+    ///
+    /// @param [in] drawCount Number of draws in pDraws.  If zero, the call does nothing.
+    /// @param [in] pDraws    Array of drawCount draw descriptors.  Must not be null if drawCount is nonzero.
+    PAL_INLINE void CmdDrawMulti(
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws)
+    {
+        m_funcTable.pfnCmdDrawMulti(this, drawCount, pDraws);
+    }
+
+    /// Issues a batch of instanced, indexed draws using the command buffer's currently bound graphics state.  Each draw
+    /// may update a range of graphics user data entries before it is issued; no other state may change between the
+    /// draws in the batch.
+    ///
+    /// This is functionally equivalent to calling CmdSetUserData() and CmdDrawIndexed() once per element of pDraws,
+    /// but it allows the implementation to validate the shared graphics state only once for the whole batch.
+    ///
+    /// @see CmdDrawIndexed
+    /// @see MultiDrawIndexedInfo
+    ///
+    /// @param [in] drawCount Number of draws in pDraws.  If zero, the call does nothing.
+    /// @param [in] pDraws    Array of drawCount draw descriptors.  Must not be null if drawCount is nonzero.
+    PAL_INLINE void CmdDrawIndexedMulti(
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws)
+    {
+        m_funcTable.pfnCmdDrawIndexedMulti(this, drawCount, pDraws);
+    }
+#endif
+
     /// Issues instanced, non-indexed draw calls using the command buffer's currently bound graphics state.  The draw
     /// arguments come from GPU memory. This command will issue count draw calls, using the provided stride to find
     /// the next indirect args structure in gpuMemory.  Each draw call will be discarded if its vertexCount or
@@ -3433,6 +3570,48 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) = 0;
 
+    /// Declares a patch slot for the next draw or dispatch recorded into this command buffer, turning it into a
+    /// command buffer template.  A template is recorded once and can then be instantiated any number of times by
+    /// @ref CmdExecuteTemplate, which copies its commands into the caller and overwrites every declared slot with a
+    /// new value.  Instantiation skips all of the draw-time validation, barrier and packet-building work done while
+    /// recording the template.
+    ///
+    /// Multiple slots may be declared for the same draw or dispatch.  Declared slots stay pending until the next
+    /// CmdDraw, CmdDrawIndexed or CmdDispatch, which consumes all of them, so they should be declared immediately
+    /// before the call they refer to.  Other draw and dispatch variants reject pending slots: they are discarded and
+    /// never patched.  DispatchSize slots are likewise discarded when the bound compute shader reads its threadgroup
+    /// counts, since those counts are not part of the patchable commands.  Patching does not revalidate any state, so
+    /// a patched value must not change the draw's pipeline state requirements.  In particular, an index buffer patched
+    /// into an IndexBufferAddress slot must hold at least as many indices as the one bound when the template was
+    /// recorded, and a patched UserData value is only guaranteed to be seen by the draw or dispatch the slot was
+    /// declared for.
+    ///
+    /// Declaring a patch slot disables PM4 optimization for the remainder of the command buffer.
+    ///
+    /// This function is only supported on nested universal and compute command buffers and only if
+    /// DeviceProperties::gfxipProperties::flags::supportCmdBufferTemplates is set.
+    ///
+    /// @param [in] slotInfo  Describes the patchable argument and the identifier patch values refer to it by.
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) = 0;
+
+    /// Instantiates a command buffer template: the template's commands are copied into this command buffer and every
+    /// patch slot declared while recording it is overwritten with the matching value from pPatches.  Slots without a
+    /// matching patch value keep the value they were recorded with.  Otherwise this behaves exactly like calling
+    /// @ref CmdExecuteNestedCmdBuffers on the template, including its state inheritance and leakage rules.
+    ///
+    /// The template is never modified, so it may be instantiated by several command buffers, but it must not be
+    /// reset or destroyed while any command buffer which instantiated it is still pending execution.
+    ///
+    /// @param [in] pTemplateCmdBuffer  Nested command buffer recorded with @ref CmdDeclarePatchSlot calls.  It must
+    ///                                 have the same queue type as this command buffer.
+    /// @param [in] patchCount          Number of entries in pPatches.
+    /// @param [in] pPatches            Patch values to apply.  May be null if patchCount is zero.
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) = 0;
+
     /// Saves a copy of some set of the current command buffer state that is used by compute workloads. This feature is
     /// intended to give PAL clients a convenient way to issue their own internal compute workloads without modifying
     /// the application-facing state.
@@ -3642,6 +3821,10 @@ protected:
         CmdDrawFunc                      pfnCmdDraw;                      ///< CmdDraw function pointer.
         CmdDrawOpaqueFunc                pfnCmdDrawOpaque;                ///< CmdDrawOpaque function pointer.
         CmdDrawIndexedFunc               pfnCmdDrawIndexed;               ///< CmdDrawIndexed function pointer.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+        CmdDrawMultiFunc                 pfnCmdDrawMulti;                 ///< CmdDrawMulti function pointer.
+        CmdDrawIndexedMultiFunc          pfnCmdDrawIndexedMulti;          ///< CmdDrawIndexedMulti function pointer.
+#endif
         CmdDrawIndirectMultiFunc         pfnCmdDrawIndirectMulti;         ///< CmdDrawIndirectMulti function pointer.
         CmdDrawIndexedIndirectMultiFunc  pfnCmdDrawIndexedIndirectMulti;  ///< CmdDrawIndexedIndirectMulti func pointer.
         CmdDispatchFunc                  pfnCmdDispatch;                  ///< CmdDispatch function pointer.
@@ -241,12 +241,16 @@ enum class BarrierType : uint32
 /// Information for barrier executions.
 struct BarrierData
 {
-    ICmdBuffer*       pCmdBuffer;    ///< The command buffer that is executing the barrier.
-    BarrierTransition transition;    ///< The particular transition that is currently executing.
-    bool              hasTransition; ///< Whether or not the transition structure is populated.
-    BarrierOperations operations;    ///< Detailed cache and pipeline operations performed during this barrier execution
-    uint32            reason;        ///< Reason that the barrier was invoked. Only filled at BarrierStart.
-    BarrierType       type;          ///< What style of barrier this is. Only filled at BarrierStart.
+    ICmdBuffer*       pCmdBuffer;     ///< The command buffer that is executing the barrier.
+    BarrierTransition transition;     ///< The particular transition that is currently executing.
+    bool              hasTransition;  ///< Whether or not the transition structure is populated.
+    BarrierOperations operations;     ///< Detailed cache and pipeline operations performed during this barrier
+                                      ///  execution
+    uint32            reason;         ///< Reason that the barrier was invoked. Only filled at BarrierStart.
+    BarrierType       type;           ///< What style of barrier this is. Only filled at BarrierStart.
+    uint32            numMergedCalls; ///< Number of client CmdBarrier() or CmdReleaseThenAcquire() calls merged into
+                                      ///  this barrier execution (see CmdBufferBuildFlags::deferBarriers).  This counts
+                                      ///  API calls, not packets.  Only filled at BarrierStart.
 };
 
 /// Enumeration describing the different types of tile mode dimensions
@@ -1142,7 +1142,10 @@ struct DeviceProperties
                 uint64 placeholder9                        :  1; ///< Placeholder, do not use
 #endif
                 uint64 supportSortAgnosticBarycentrics     :  1; ///< HW supports sort-agnostic Barycentrics for PS
-                uint64 reserved                            : 27; ///< Reserved for future use.
+                uint64 supportCmdBufferTemplates           :  1; ///< Nested universal and compute command buffers
+                                                                 ///  support patch slots and instantiation through
+                                                                 ///  ICmdBuffer::CmdExecuteTemplate().
+                uint64 reserved                            : 26; ///< Reserved for future use.
             };
             uint64 u64All;           ///< Flags packed as 32-bit uint.
         } flags;                     ///< Device IP property flags.
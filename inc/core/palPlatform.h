@@ -100,6 +100,22 @@ struct PlatformProperties
     };
 };
 
+/// Value of @ref StartupPhaseInfo::deviceIndex for phases which are not tied to a particular device.
+constexpr uint32 StartupPhaseNoDevice = UINT32_MAX;
+
+/// Describes one timed phase of platform or device initialization, such as reading settings, initializing AddrLib,
+/// creating RPM pipelines or creating queues.  Phases may nest; an inner phase's time is also counted in its parent.
+///
+/// @see IPlatform::GetStartupPhases
+struct StartupPhaseInfo
+{
+    const char* pName;        ///< Name of the phase.  The string is owned by PAL and lives as long as the platform.
+    uint32      deviceIndex;  ///< Index of the device being initialized, or @ref StartupPhaseNoDevice for
+                              ///  platform-wide phases.
+    int64       beginTime;    ///< CPU timestamp when the phase began, as returned by Util::GetPerfCpuTime().
+    int64       endTime;      ///< CPU timestamp when the phase ended.  Zero if the phase has not finished yet.
+};
+
 /// Enumerates the GPU affinity modes which can be selected by an application profile. This determines the preference
 /// of which Device(s) an application profile would like us to use for a specific application.
 ///
@@ -397,6 +413,34 @@ public:
     virtual Result GetProperties(
         PlatformProperties* pProperties) = 0;
 
+    /// Reports the phases of platform and device initialization recorded by PAL's built-in startup profiler, in the
+    /// order in which they began.
+    ///
+    /// PAL always records the major phases of IPlatform and IDevice initialization and the creation of each queue, up
+    /// to a fixed number of phases.  The timestamps can be converted to seconds with Util::GetPerfFrequency().
+    ///
+    /// @param [in,out] pPhaseCount Input: number of entries available in pPhases.  Output: number of phases recorded
+    ///                             (if pPhases is null) or written to pPhases.
+    /// @param [out]    pPhases     Optional array which will be filled with the recorded phases.
+    ///
+    /// @returns Success if the phases were returned.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidPointer if pPhaseCount is null.
+    ///          + ErrorIncompleteResults if pPhases was too small to hold every recorded phase.
+    virtual Result GetStartupPhases(
+        uint32*           pPhaseCount,
+        StartupPhaseInfo* pPhases) const = 0;
+
+    /// Writes every phase reported by @ref GetStartupPhases to a JSON file.  Each phase records its name, device
+    /// index, start time relative to the first phase and duration, both in microseconds.
+    ///
+    /// @param [in] pFilePath Path of the JSON file to create.  An existing file will be overwritten.
+    ///
+    /// @returns Success if the file was written.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidPointer if pFilePath is null.
+    ///          + An error code from Util::File if the file could not be written.
+    virtual Result DumpStartupPhases(
+        const char* pFilePath) const = 0;
+
     /// Installs the callback into the specified platform.
     ///
     /// @param [in] pPlatform        The platform to install the callback into.
@@ -162,7 +162,18 @@ struct QueueCreateInfo
 #else
         uint32 placeholder3                    :  1; ///< Reserved field. Set to 0.
 #endif
-        uint32 reserved                        : 26; ///< Reserved for future use.
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626)
+        uint32 asyncSubmission                 :  1; ///< Submissions, queue semaphore operations and the other
+                                                     ///  queue commands are validated and prepared on the calling
+                                                     ///  thread, then handed to the OS in order by a worker thread
+                                                     ///  owned by this queue.  If a command executed by the worker
+                                                     ///  fails, its error is returned by all later Submit() and
+                                                     ///  WaitIdle() calls.  Ignored on timer queues.
+                                                     ///  @see IQueue::QuerySubmitStats.
+#else
+        uint32 placeholder4                    :  1; ///< Reserved field. Set to 0.
+#endif
+        uint32 reserved                        : 25; ///< Reserved for future use.
     };
 
     uint32 numReservedCu;           ///< The number of reserved compute units for RT CU queue
@@ -438,6 +449,25 @@ struct VirtualMemoryCopyPageMappingsRange
     gpusize     size;           ///< Size of the mapping range, in bytes.
 };
 
+/// Reports how long submissions spend on the calling thread and, if they were deferred, waiting to be handed to the OS.
+/// Output structure of IQueue::QuerySubmitStats().  All times are CPU timestamp deltas as returned by
+/// Util::GetPerfCpuTime() and can be converted to seconds with Util::GetPerfFrequency().
+struct QueueSubmitStats
+{
+    uint64 submitCount;         ///< Number of successful Submit() calls made on the queue.
+    uint64 callerTimeTotal;     ///< Total time the calling threads spent inside Submit().
+    uint64 callerTimeMax;       ///< Longest time a calling thread spent inside a single Submit().
+    uint64 deferredSubmitCount; ///< Number of submissions which were batched and later handed to the OS, either by the
+                                ///  asynchronous submission worker or once the queue was released from a semaphore
+                                ///  stall.
+    uint64 queuedTimeTotal;     ///< Total time deferred submissions waited before they were handed to the OS.
+    uint64 queuedTimeMax;       ///< Longest time a single deferred submission waited before it was handed to the OS.
+    uint64 osSubmitTimeTotal;   ///< Total time spent handing deferred submissions to the OS.
+    uint64 osSubmitTimeMax;     ///< Longest time spent handing a single deferred submission to the OS.
+    uint32 pendingCmds;         ///< Number of batched queue commands still waiting to be executed.
+    uint32 maxPendingCmds;      ///< Largest number of batched queue commands that were waiting at the same time.
+};
+
 /// Specifies kernel level information about a context.
 struct KernelContextInfo
 {
@@ -744,6 +774,19 @@ public:
     ///          + ErrorUnavailable if kernel context information is not available on the current platform.
     virtual Result QueryKernelContextInfo(KernelContextInfo* pKernelContextInfo) const = 0;
 
+    /// Reports the submission latency statistics gathered by this queue since it was created.
+    ///
+    /// Every queue tracks the time spent inside Submit() on the calling thread.  The deferred statistics are only
+    /// nonzero for queues created with @ref QueueCreateInfo::asyncSubmission set, or queues whose submissions were
+    /// batched up behind a queue semaphore wait.
+    ///
+    /// @param [out] pStats Statistics for this queue.
+    ///
+    /// @returns Success if the statistics were written, or ErrorInvalidPointer if pStats is null.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626
+    virtual Result QuerySubmitStats(QueueSubmitStats* pStats) = 0;
+#endif
+
     /// Returns the value of the associated arbitrary client data pointer.
     /// Can be used to associate arbitrary data with a particular PAL object.
     ///
@@ -0,0 +1,260 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palDescriptorHeap.h
+ * @brief PAL GPU utility DescriptorHeap class.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palDevice.h"
+#include "palMutex.h"
+#include "palPlatform.h"
+
+// Forward declarations.
+namespace Pal
+{
+    class IGpuMemory;
+}
+
+namespace GpuUtil
+{
+
+/// Identifies one slot of a @ref DescriptorHeap.
+typedef Pal::uint32 DescriptorSlot;
+
+/// Returned by @ref DescriptorHeap::Allocate on failure.
+constexpr DescriptorSlot InvalidDescriptorSlot = UINT32_MAX;
+
+/// Specifies the properties of a @ref DescriptorHeap.
+struct DescriptorHeapCreateInfo
+{
+    union
+    {
+        struct
+        {
+            Pal::uint32 addMemoryReferences :  1; ///< Make every block of the heap permanently resident by adding an
+                                                  ///  always-resident device-wide memory reference for it.
+            Pal::uint32 reserved            : 31; ///< Reserved for future use.
+        };
+        Pal::uint32 u32All;                       ///< Flags packed as a 32-bit uint.
+    } flags;                                      ///< Descriptor heap creation flags.
+
+    Pal::uint32  slotSize;       ///< Size of each slot in bytes.  Must be a non-zero multiple of the smallest SRD size
+                                 ///  reported by the device.
+    Pal::uint32  slotsPerBlock;  ///< Number of slots in each GPU memory block the heap allocates.
+    Pal::uint32  maxBlocks;      ///< Maximum number of blocks; must not exceed @ref DescriptorHeap::MaxBlocks.
+    Pal::GpuHeap heap;           ///< Heap the blocks are allocated from.  Must be CPU visible.
+};
+
+/// Reports the current state of a @ref DescriptorHeap.
+struct DescriptorHeapStats
+{
+    Pal::uint32 numBlocks;          ///< Number of GPU memory blocks allocated so far.
+    Pal::uint32 numSlotsAllocated;  ///< Number of slots currently allocated by the client.
+    Pal::uint32 numSlotsDeferred;   ///< Number of slots freed with a retire value which has not yet been reached.
+    Pal::uint32 numSlotsCarved;     ///< Number of slots which have ever been handed out, the high water mark.
+};
+
+/**
+***********************************************************************************************************************
+* @class DescriptorHeap
+* @brief Helper class which suballocates fixed-size slots for shader resource descriptors out of large, persistently
+*        mapped GPU memory blocks.
+*
+* Clients write SRDs directly into the mapped slots through the Write*Srds() functions, which go straight to the
+* device's SRD creation function table, and bind a slot to a shader by its GPU virtual address.
+*
+* Allocate() and Free() are safe to call from any number of threads at once and never block, except when the heap has
+* to allocate a new block.  Free slots are kept on a single lock-free list shared by the whole heap.
+*
+* A slot which may still be read by the GPU must be released with FreeDeferred() instead, which tags the slot with a
+* client-defined, monotonically increasing retire value (for example a queue timeline semaphore value or a frame
+* counter).  RetireDeferredFrees() returns every deferred slot whose retire value has been reached to the free list.
+*
+* Blocks are never freed before the heap is destroyed.  The client must ensure that the GPU is no longer accessing any
+* slot when the heap is destroyed.
+***********************************************************************************************************************
+*/
+class DescriptorHeap
+{
+public:
+    /// Maximum value of @ref DescriptorHeapCreateInfo::maxBlocks.
+    static constexpr Pal::uint32 MaxBlocks = 256;
+
+    /// Constructor.
+    ///
+    /// @param [in] pPlatform  Platform used for all system memory allocations.
+    /// @param [in] pDevice    Device the heap's GPU memory is allocated on.
+    DescriptorHeap(
+        Pal::IPlatform* pPlatform,
+        Pal::IDevice*   pDevice);
+
+    /// Destructor.  Destroys all GPU memory owned by the heap.
+    ~DescriptorHeap();
+
+    /// Initializes the heap.  No GPU memory is allocated until the first call to Allocate().
+    ///
+    /// @param [in] createInfo  Properties of the new heap.
+    ///
+    /// @returns Success if successful, or ErrorInvalidValue if createInfo is invalid.
+    Pal::Result Init(const DescriptorHeapCreateInfo& createInfo);
+
+    /// Allocates one slot.
+    ///
+    /// @param [out] pSlot  The allocated slot, or @ref InvalidDescriptorSlot on failure.
+    ///
+    /// @returns Success if successful, or ErrorOutOfMemory if the heap is full or a new block could not be created.
+    Pal::Result Allocate(DescriptorSlot* pSlot);
+
+    /// Immediately returns a slot to the heap.  The GPU must no longer access the slot.
+    void Free(DescriptorSlot slot);
+
+    /// Returns a slot to the heap once RetireDeferredFrees() is called with a completed value of at least retireValue.
+    void FreeDeferred(DescriptorSlot slot, Pal::uint64 retireValue);
+
+    /// Returns every slot released with FreeDeferred() whose retire value is at most completedValue to the heap.
+    ///
+    /// @returns The number of slots which were returned.
+    Pal::uint32 RetireDeferredFrees(Pal::uint64 completedValue);
+
+    /// Returns the CPU address of the start of the slot.
+    void* CpuAddress(DescriptorSlot slot) const;
+
+    /// Returns the GPU virtual address of the start of the slot.
+    Pal::gpusize GpuAddress(DescriptorSlot slot) const;
+
+    /// Returns the size of each slot in bytes.
+    Pal::uint32 SlotSize() const { return m_createInfo.slotSize; }
+
+    /// Writes typed buffer view SRDs into a slot.
+    ///
+    /// @param [in] slot         Destination slot.
+    /// @param [in] offset       Byte offset into the slot of the first SRD.  Must be aligned to the buffer view SRD
+    ///                          size, and count SRDs must fit in the slot.
+    /// @param [in] count        Number of SRDs to write.
+    /// @param [in] pBufferViews Array of count buffer views.
+    void WriteTypedBufferViewSrds(
+        DescriptorSlot             slot,
+        Pal::uint32                offset,
+        Pal::uint32                count,
+        const Pal::BufferViewInfo* pBufferViews) const
+    {
+        m_pDevice->CreateTypedBufferViewSrds(count, pBufferViews, SrdAddress(slot, offset, count, m_bufferViewSize));
+    }
+
+    /// Writes untyped buffer view SRDs into a slot.  @see WriteTypedBufferViewSrds.
+    void WriteUntypedBufferViewSrds(
+        DescriptorSlot             slot,
+        Pal::uint32                offset,
+        Pal::uint32                count,
+        const Pal::BufferViewInfo* pBufferViews) const
+    {
+        m_pDevice->CreateUntypedBufferViewSrds(count, pBufferViews, SrdAddress(slot, offset, count, m_bufferViewSize));
+    }
+
+    /// Writes image view SRDs into a slot.  The offset must be aligned to the image view SRD size.
+    /// @see WriteTypedBufferViewSrds.
+    void WriteImageViewSrds(
+        DescriptorSlot            slot,
+        Pal::uint32               offset,
+        Pal::uint32               count,
+        const Pal::ImageViewInfo* pImageViews) const
+        { m_pDevice->CreateImageViewSrds(count, pImageViews, SrdAddress(slot, offset, count, m_imageViewSize)); }
+
+    /// Writes fmask view SRDs into a slot.  The offset must be aligned to the fmask view SRD size.
+    /// @see WriteTypedBufferViewSrds.
+    void WriteFmaskViewSrds(
+        DescriptorSlot            slot,
+        Pal::uint32               offset,
+        Pal::uint32               count,
+        const Pal::FmaskViewInfo* pFmaskViews) const
+        { m_pDevice->CreateFmaskViewSrds(count, pFmaskViews, SrdAddress(slot, offset, count, m_fmaskViewSize)); }
+
+    /// Writes sampler SRDs into a slot.  The offset must be aligned to the sampler SRD size.
+    /// @see WriteTypedBufferViewSrds.
+    void WriteSamplerSrds(
+        DescriptorSlot          slot,
+        Pal::uint32             offset,
+        Pal::uint32             count,
+        const Pal::SamplerInfo* pSamplers) const
+        { m_pDevice->CreateSamplerSrds(count, pSamplers, SrdAddress(slot, offset, count, m_samplerSize)); }
+
+    /// Reports the current state of the heap.  The values are read without synchronization, so they are approximate
+    /// while other threads are using the heap.
+    void QueryStats(DescriptorHeapStats* pStats) const;
+
+private:
+    // Each block of GPU memory plus the CPU-side list links and retire values of its slots.
+    struct Block
+    {
+        Pal::IGpuMemory*      pGpuMemory;
+        void*                 pCpuAddr;
+        Pal::gpusize          gpuVirtAddr;
+        volatile Pal::uint32* pNext;          // Links slots in the free list or the deferred list.
+        Pal::uint64*          pRetireValues;  // Retire value of each slot in the deferred list.
+        bool                  isReferenced;   // True if a device-wide memory reference was added for pGpuMemory.
+    };
+
+    void* SrdAddress(DescriptorSlot slot, Pal::uint32 offset, Pal::uint32 count, Pal::uint32 srdSize) const;
+
+    volatile Pal::uint32& NextLink(DescriptorSlot slot) const;
+
+    DescriptorSlot PopFreeSlot();
+    void           PushFreeSlots(DescriptorSlot first, DescriptorSlot last);
+    void           PushDeferredSlots(DescriptorSlot first, DescriptorSlot last);
+    Pal::Result    CarveSlot(DescriptorSlot* pSlot);
+    Pal::Result    CreateBlock(Pal::uint32 blockIdx);
+    void           DestroyBlock(Block* pBlock);
+
+    Pal::IPlatform*const     m_pPlatform;
+    Pal::IDevice*const       m_pDevice;
+    DescriptorHeapCreateInfo m_createInfo;
+    Pal::uint32              m_bufferViewSize;
+    Pal::uint32              m_imageViewSize;
+    Pal::uint32              m_fmaskViewSize;
+    Pal::uint32              m_samplerSize;
+
+    Block                    m_blocks[MaxBlocks];
+    volatile Pal::uint32     m_numBlocks;       // Blocks below this index are fully initialized.
+    Util::Mutex              m_blockLock;       // Serializes block creation.
+
+    // Head of the shared free list.  The low half is the first slot and the high half is a tag which is incremented by
+    // every pop, so that a slot which is popped and pushed back between another thread's load and compare-and-swap
+    // can't corrupt the list.
+    volatile Pal::uint64     m_freeHead;
+    volatile Pal::uint32     m_deferredHead;    // Head of the list of deferred slots.  Only ever swapped out whole.
+    volatile Pal::uint32     m_numCarved;       // Slots below this index have been handed out at least once.
+
+    volatile Pal::uint32     m_numAllocated;
+    volatile Pal::uint32     m_numDeferred;
+
+    PAL_DISALLOW_DEFAULT_CTOR(DescriptorHeap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(DescriptorHeap);
+};
+
+} // GpuUtil
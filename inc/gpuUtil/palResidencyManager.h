@@ -0,0 +1,190 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palResidencyManager.h
+ * @brief PAL GPU utility ResidencyManager class.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palDevice.h"
+#include "palHashMap.h"
+#include "palIntrusiveList.h"
+#include "palMutex.h"
+#include "palPlatform.h"
+#include "palVector.h"
+
+// Forward declarations.
+namespace Pal
+{
+    class IGpuMemory;
+    class IQueue;
+}
+
+namespace GpuUtil
+{
+
+/// Specifies the properties of a @ref ResidencyManager.
+struct ResidencyManagerCreateInfo
+{
+    Pal::gpusize budget[Pal::GpuHeapCount]; ///< Residency budget of each heap in bytes.  Zero derives the budget from
+                                            ///  budgetPercent and the heap size reported by the device.
+    Pal::uint32  budgetPercent;             ///< Percentage of each heap's size used as the budget of heaps which have
+                                            ///  no explicit budget.  Zero is treated as 100.  Must not exceed 100.
+    Pal::uint32  memRefFlags;               ///< @ref Pal::GpuMemoryRefFlags passed to AddGpuMemoryReferences().
+    Pal::IQueue* pQueue;                    ///< If non-null, memory references are added to this queue only instead
+                                            ///  of device-wide.
+};
+
+/// Reports the current state of a @ref ResidencyManager.
+struct ResidencyStats
+{
+    Pal::gpusize budgetBytes[Pal::GpuHeapCount];     ///< Residency budget of each heap.
+    Pal::gpusize residentBytes[Pal::GpuHeapCount];   ///< Bytes currently made resident by the manager in each heap.
+    Pal::gpusize workingSetBytes[Pal::GpuHeapCount]; ///< Bytes referenced by the most recent submit in each heap.
+    Pal::uint32  numTracked;                         ///< Number of allocations the manager knows about.
+    Pal::uint32  numResident;                        ///< Number of allocations currently resident.
+    Pal::uint64  numSubmits;                         ///< Number of calls to PrepareSubmit().
+    Pal::uint64  numMadeResident;                    ///< Total number of allocations made resident.
+    Pal::gpusize madeResidentBytes;                  ///< Total bytes made resident.
+    Pal::uint64  numEvicted;                         ///< Total number of allocations evicted to stay within budget.
+    Pal::gpusize evictedBytes;                       ///< Total bytes evicted.
+    Pal::uint64  numOverBudget;                      ///< Number of times a heap stayed over budget after eviction
+                                                     ///  because the submit's own working set didn't fit.
+};
+
+/**
+***********************************************************************************************************************
+* @class ResidencyManager
+* @brief Helper class which keeps the GPU memory referenced by a client's submits resident within a per-heap budget.
+*
+* The client passes the same GpuMemoryRef list it gives to IQueue::Submit() to PrepareSubmit() right before each
+* submit.  Allocations which aren't yet resident are made resident with one call to IDevice::AddGpuMemoryReferences(),
+* and if that would take a heap over its budget the least recently submitted allocations of that heap are evicted
+* first with one call to IDevice::RemoveGpuMemoryReferences().  An allocation referenced by the current submit is
+* never evicted to make room, so a submit whose working set alone exceeds the budget is still made fully resident and
+* is counted in @ref ResidencyStats::numOverBudget.
+*
+* Recency is the number of the submit which last referenced each allocation.  PAL keeps a removed reference alive until
+* every submit which used it has retired, so evicting an allocation which is still in flight is safe.
+*
+* Every function is thread-safe.  Allocations which the manager has seen must be passed to ReleaseMemory() before they
+* are destroyed.
+***********************************************************************************************************************
+*/
+class ResidencyManager
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pPlatform  Platform used for all system memory allocations.
+    /// @param [in] pDevice    Device whose memory references the manager controls.
+    ResidencyManager(
+        Pal::IPlatform* pPlatform,
+        Pal::IDevice*   pDevice);
+
+    /// Destructor.  Removes every memory reference which the manager still holds.
+    ~ResidencyManager();
+
+    /// Initializes the manager and computes the budget of each heap.
+    ///
+    /// @param [in] createInfo  Properties of the new manager.
+    ///
+    /// @returns Success if successful, ErrorInvalidValue if createInfo is invalid, or an error from
+    ///          IDevice::GetGpuMemoryHeapProperties().
+    Pal::Result Init(const ResidencyManagerCreateInfo& createInfo);
+
+    /// Makes every allocation in a submit's memory reference list resident, evicting the least recently used
+    /// allocations of any heap which would otherwise go over budget.  Virtual allocations are ignored.
+    ///
+    /// @param [in] gpuMemRefCount  Number of entries in pGpuMemoryRefs.
+    /// @param [in] pGpuMemoryRefs  The submit's memory reference list.  Duplicates are allowed.
+    ///
+    /// @returns Success if successful, ErrorOutOfMemory if internal tracking memory couldn't be allocated, or an error
+    ///          from IDevice::AddGpuMemoryReferences() or IDevice::RemoveGpuMemoryReferences().
+    Pal::Result PrepareSubmit(
+        Pal::uint32              gpuMemRefCount,
+        const Pal::GpuMemoryRef* pGpuMemoryRefs);
+
+    /// Stops tracking an allocation and removes its memory reference if it is resident.  Must be called before the
+    /// allocation is destroyed.
+    void ReleaseMemory(Pal::IGpuMemory* pGpuMemory);
+
+    /// Reports the current state of the manager.
+    void QueryStats(ResidencyStats* pStats);
+
+private:
+    // Tracking state of one allocation.  Only resident entries are linked into their heap's LRU list.
+    struct Entry
+    {
+        Entry(Pal::IGpuMemory* pMemory, Pal::gpusize memSize, Pal::GpuHeap memHeap)
+            :
+            pGpuMemory(pMemory),
+            size(memSize),
+            heap(memHeap),
+            lastSubmit(0),
+            resident(false),
+            lruNode(this)
+        { }
+
+        Pal::IGpuMemory*const           pGpuMemory;
+        const Pal::gpusize              size;
+        const Pal::GpuHeap              heap;
+        Pal::uint64                     lastSubmit;  // Number of the last submit which referenced this allocation.
+        bool                            resident;
+        Util::IntrusiveListNode<Entry>  lruNode;
+    };
+
+    typedef Util::HashMap<Pal::IGpuMemory*, Entry*, Pal::IPlatform> EntryMap;
+    typedef Util::IntrusiveList<Entry>                              LruList;
+
+    static constexpr Pal::uint32 NumBuckets = 256;
+
+    Pal::Result FindOrCreateEntry(Pal::IGpuMemory* pGpuMemory, Entry** ppEntry);
+    Pal::Result Evict(Entry* pEntry);
+
+    Pal::IPlatform*const       m_pPlatform;
+    Pal::IDevice*const         m_pDevice;
+    ResidencyManagerCreateInfo m_createInfo;
+    Util::Mutex                m_lock;
+
+    EntryMap                   m_entries;
+    LruList                    m_lru[Pal::GpuHeapCount];     // Resident entries, least recently submitted first.
+    Pal::uint64                m_submitCount;
+
+    // Scratch lists reused by every PrepareSubmit() so that steady-state submits don't allocate.
+    Util::Vector<Entry*, 64, Pal::IPlatform>            m_newResident;
+    Util::Vector<Pal::GpuMemoryRef, 64, Pal::IPlatform> m_addRefs;
+    Util::Vector<Pal::IGpuMemory*, 64, Pal::IPlatform>  m_removeRefs;
+
+    ResidencyStats             m_stats;
+
+    PAL_DISALLOW_DEFAULT_CTOR(ResidencyManager);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ResidencyManager);
+};
+
+} // GpuUtil
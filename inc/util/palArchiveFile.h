@@ -67,6 +67,12 @@ struct ArchiveFileOpenInfo
     bool                allowAsyncFileIo;            ///< Allow use of OS specific asynchronous file routines
     bool                useBufferedReadMemory;       ///< Allow preloading/read-ahead of file into memory
     size_t              maxReadBufferMem;            ///< Maximum size allowed for read buffer
+    bool                useWriteBehind;              ///< Queue writes in memory and commit them to disk in batches from
+                                                     ///  a background thread. Only used with allowWriteAccess.
+    uint32              writeBehindWindowMs;         ///< Durability window for write-behind: the longest a queued entry
+                                                     ///  waits before its batch is committed. 0 selects a default.
+    size_t              writeBehindBatchSize;        ///< Number of queued bytes which commits a batch before the
+                                                     ///  durability window expires. 0 selects a default.
 };
 
 /// Get the memory size needed for an archive file object
@@ -202,6 +208,10 @@ public:
     ///
     /// If async file writes are allowed, this function will return before the write is fully complete.
     ///
+    /// If write-behind is enabled, the entry is queued and this function returns without touching the disk. The entry
+    /// is immediately visible to GetEntryByIndex() and Read() on this object and is committed to disk together with
+    /// other queued entries within the durability window.
+    ///
     /// @param [in/out] pHeader Header for new data entry. Header data will be modified to refect output file
     /// @param [in]     pData   Data to be stored for the entry. pHeader->dataSize number of bytes will be read from
     ///                         this memory location
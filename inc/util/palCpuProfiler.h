@@ -0,0 +1,149 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palCpuProfiler.h
+ * @brief PAL utility collection CpuProfiler namespace declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palSysUtil.h"
+
+#include <atomic>
+
+namespace Util
+{
+
+/// Namespace containing a lightweight CPU zone profiler.
+///
+/// Code marks the regions it wants to measure with @ref PAL_CPU_ZONE, which records the start and end time of the
+/// enclosing scope. Each thread appends its zones to its own fixed-size event buffer without taking any locks; the
+/// collector walks every thread's buffer when the timeline is exported. While the profiler is disabled a zone costs a
+/// single relaxed load, and builds made without PAL_ENABLE_CPU_ZONES compile the markers out entirely.
+///
+/// The profiler is shared by the whole process but reference counted: each PAL platform with the
+/// CpuZoneProfilingEnabled setting holds a reference while it exists and writes a Chrome trace-event file (viewable in
+/// chrome://tracing or Perfetto) when it is destroyed.
+namespace CpuProfiler
+{
+
+/// A single completed zone.
+struct ZoneEvent
+{
+    const char* pName;      ///< Name of the zone. Must point to a string with static storage duration.
+    int64       beginTicks; ///< CPU timestamp at which the zone was entered, from @ref GetPerfCpuTime.
+    int64       endTicks;   ///< CPU timestamp at which the zone was left.
+};
+
+namespace Internal
+{
+extern std::atomic<bool> g_enabled;
+}
+
+/// Adds a reference to the profiler, starting to record zones on every thread if it was not recording already. Every
+/// successful call must be balanced by a call to @ref Disable.
+///
+/// @param [in] maxEventsPerThread Capacity of each thread's event buffer. Zones recorded by a thread whose buffer is
+///                                full are dropped and counted. If several clients enable the profiler the largest
+///                                capacity applies to buffers registered afterwards.
+///
+/// @returns Success.
+extern Result Enable(uint32 maxEventsPerThread);
+
+/// Releases a reference added by @ref Enable. Zones stop being recorded once the last reference is released; zones
+/// recorded so far are kept until @ref Reset or @ref Shutdown is called.
+extern void Disable();
+
+/// Returns true if zones are currently being recorded.
+inline bool IsEnabled() { return Internal::g_enabled.load(std::memory_order_relaxed); }
+
+/// Appends a completed zone to the calling thread's event buffer.
+///
+/// @param [in] pName      Name of the zone; must point to a string with static storage duration.
+/// @param [in] beginTicks CPU timestamp at which the zone was entered.
+/// @param [in] endTicks   CPU timestamp at which the zone was left.
+extern void RecordZone(const char* pName, int64 beginTicks, int64 endTicks);
+
+/// Writes every zone recorded so far to a Chrome trace-event JSON file. Threads may keep recording zones while the
+/// file is written; zones which complete during the export may or may not be included.
+///
+/// @param [in] pFilePath Path of the file to write.
+///
+/// @returns Success if the file was written, otherwise an appropriate error.
+extern Result WriteChromeTrace(const char* pFilePath);
+
+/// Returns the number of zones which were dropped because a thread's event buffer was full.
+extern uint64 GetNumDroppedZones();
+
+/// Discards all recorded zones. No thread may be inside a zone while this is called.
+extern void Reset();
+
+/// Frees all event buffers if no client holds a reference on the profiler any more, otherwise does nothing. No thread
+/// may be inside a zone while the buffers are freed.
+extern void Shutdown();
+
+/// Records the lifetime of the enclosing scope as a zone if the profiler was enabled when the scope was entered.
+class Zone
+{
+public:
+    /// Enters the zone.
+    ///
+    /// @param [in] pName Name of the zone; must point to a string with static storage duration.
+    explicit Zone(const char* pName)
+        :
+        m_pName(pName),
+        m_beginTicks(IsEnabled() ? GetPerfCpuTime() : 0)
+    { }
+
+    /// Leaves the zone.
+    ~Zone()
+    {
+        if (m_beginTicks != 0)
+        {
+            RecordZone(m_pName, m_beginTicks, GetPerfCpuTime());
+        }
+    }
+
+private:
+    const char*const m_pName;
+    const int64      m_beginTicks;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(Zone);
+};
+
+} // CpuProfiler
+} // Util
+
+#define PAL_CPU_ZONE_CONCAT_INNER(_a, _b) _a##_b
+#define PAL_CPU_ZONE_CONCAT(_a, _b) PAL_CPU_ZONE_CONCAT_INNER(_a, _b)
+
+#if PAL_ENABLE_CPU_ZONES
+/// Records the enclosing scope as a CPU profiling zone with the given static name.
+#define PAL_CPU_ZONE(_name) Util::CpuProfiler::Zone PAL_CPU_ZONE_CONCAT(_palCpuZone, __LINE__)(_name)
+#else
+#define PAL_CPU_ZONE(_name) static_cast<void>(0)
+#endif
@@ -0,0 +1,258 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palElfBuilder.h
+ * @brief PAL arena-backed ELF builder class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palElf.h"
+#include "palSysMemory.h"
+
+namespace Util
+{
+namespace Elf
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Builds an ELF and serializes it directly into a caller-provided buffer.
+ *
+ * Unlike ElfProcessor, the builder doesn't copy section contents when they are added. Section data is recorded as a
+ * list of chunks which reference caller-owned memory, and is copied exactly once, into the destination buffer, by
+ * SaveToBuffer(). All bookkeeping (section records, chunk lists, section names and note headers) is carved out of an
+ * internal arena which Reset() recycles, so a builder which is reused for many ELFs stops allocating once it has seen
+ * the largest one.
+ *
+ * The serialized layout is identical to the one ElfProcessor produces: the file header, then program headers, then
+ * the contents of every section in index order, then the section headers.
+ *
+ * Memory passed to AppendSectionData() or AddNote() must remain valid and unchanged until SaveToBuffer() returns.
+ ***********************************************************************************************************************
+ */
+template <typename Allocator>
+class ElfBuilder
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator the arena will allocate its blocks from.
+    explicit ElfBuilder(Allocator* const pAllocator);
+    ~ElfBuilder();
+
+    /// Forgets every section and segment and restores the default file header. Arena memory is kept for the next ELF.
+    void Reset();
+
+    /// Set the OS ABI.
+    ///
+    /// @param [in] osAbi ELF OS ABI.
+    void SetOsAbi(uint8 osAbi) { m_fileHeader.ei_osabi = osAbi; }
+
+    /// Set the ABI Version.
+    ///
+    /// @param [in] abiVersion ELF ABI Version.
+    void SetAbiVersion(uint8 abiVersion) { m_fileHeader.ei_abiversion = abiVersion; }
+
+    /// Set the ELF type.
+    ///
+    /// @param [in] type ELF ObjectFileType.
+    void SetObjectFileType(ObjectFileType type) { m_fileHeader.e_type = static_cast<uint16>(type); }
+
+    /// Set the ELF machine.
+    ///
+    /// @param [in] machine ELF MachineType.
+    void SetTargetMachine(MachineType machine) { m_fileHeader.e_machine = static_cast<uint16>(machine); }
+
+    /// Set the ELF entry.
+    ///
+    /// @param [in] entry ELF entry point.
+    void SetEntryPoint(uint64 entry) { m_fileHeader.e_entry = entry; }
+
+    /// Set the ELF flags.
+    ///
+    /// @param [in] flags ELF flags.
+    void SetFlags(uint32 flags) { m_fileHeader.e_flags = flags; }
+
+    /// Adds an empty standard section.  The null section and .shstrtab are created along with the first section.
+    ///
+    /// @param [in] type The type of the section to create from the available standard sections in SectionType.
+    ///
+    /// @returns The index of the new section, or UINT_MAX if memory allocation fails.
+    uint32 AddSection(SectionType type);
+
+    /// Adds an empty section.  Standard section names get the standard type and flags, as in Sections::Add().
+    ///
+    /// @param [in] pName The name of the section to create.  It is copied into the arena.
+    ///
+    /// @returns The index of the new section, or UINT_MAX if memory allocation fails.
+    uint32 AddSection(const char* pName);
+
+    /// Appends caller-owned data to a section without copying it.
+    ///
+    /// @param [in] sectionIndex The section to append to.
+    /// @param [in] pData        Pointer to the data, which must outlive the next call to SaveToBuffer().
+    /// @param [in] dataSize     Size in bytes of the data.
+    ///
+    /// @returns Success if successful, or ErrorOutOfMemory if memory allocation fails.
+    Result AppendSectionData(uint32 sectionIndex, const void* pData, size_t dataSize);
+
+    /// Appends arena memory to a section for the caller to fill in, such as string or symbol table entries.
+    ///
+    /// @param [in] sectionIndex The section to append to.
+    /// @param [in] dataSize     Size in bytes of the memory to append.
+    ///
+    /// @returns A pointer to the appended memory, or nullptr if memory allocation fails.
+    void* AppendUninitializedData(uint32 sectionIndex, size_t dataSize);
+
+    /// Appends a note to a note section.  The header and name are built in the arena and the description is
+    /// referenced, so large metadata blobs are never copied before SaveToBuffer().
+    ///
+    /// @param [in] sectionIndex The note section to append to.
+    /// @param [in] type         The type of note.
+    /// @param [in] pName        The name of the note.
+    /// @param [in] pDesc        The description (contents) of the note, which must outlive SaveToBuffer().
+    /// @param [in] descSize     The size of the description in bytes.
+    ///
+    /// @returns Success if successful, or ErrorOutOfMemory if memory allocation fails.
+    Result AddNote(uint32 sectionIndex, uint32 type, const char* pName, const void* pDesc, size_t descSize);
+
+    /// Set the section link section (sh_link).
+    void SetLink(uint32 sectionIndex, uint32 linkIndex) { Header(sectionIndex)->sh_link = linkIndex; }
+
+    /// Set the section info section (sh_info).
+    void SetInfo(uint32 sectionIndex, uint32 infoIndex) { Header(sectionIndex)->sh_info = infoIndex; }
+
+    /// Set the section header flags.
+    void SetSectionFlags(uint32 sectionIndex, uint64 flags) { Header(sectionIndex)->sh_flags = flags; }
+
+    /// Set the section header address.
+    void SetAddr(uint32 sectionIndex, uint64 addr) { Header(sectionIndex)->sh_addr = addr; }
+
+    /// Set the section alignment.
+    void SetAlignment(uint32 sectionIndex, uint64 alignment) { Header(sectionIndex)->sh_addralign = alignment; }
+
+    /// Set the section table entry size if the section is a table with fixed entry sizes.
+    void SetEntrySize(uint32 sectionIndex, uint64 entrySize) { Header(sectionIndex)->sh_entsize = entrySize; }
+
+    /// Gets the data size of a section.
+    size_t GetDataSize(uint32 sectionIndex) const
+        { return static_cast<size_t>(m_pSections[sectionIndex].header.sh_size); }
+
+    /// Gets the number of sections, including the null section and .shstrtab once any section has been added.
+    uint32 NumSections() const { return m_numSections; }
+
+    /// Adds a segment covering a contiguous range of sections.
+    ///
+    /// @param [in] type         The SegmentType.
+    /// @param [in] flags        The segment flags.
+    /// @param [in] firstSection Index of the first section in the segment.
+    /// @param [in] numSections  Number of sections in the segment.
+    ///
+    /// @returns The index of the new segment, or UINT_MAX if memory allocation fails.
+    uint32 AddSegment(SegmentType type, uint32 flags, uint32 firstSection, uint32 numSections);
+
+    /// Set the segment virtual address.
+    void SetSegmentVirtualAddr(uint32 segmentIndex, uint64 vaddr) { m_pSegments[segmentIndex].header.p_vaddr = vaddr; }
+
+    /// Set the segment alignment.
+    void SetSegmentAlignment(uint32 segmentIndex, uint64 align) { m_pSegments[segmentIndex].header.p_align = align; }
+
+    /// Gets the number of bytes required to hold a binary blob of the ELF.  This is tracked as data is added so it
+    /// costs nothing to query.
+    ///
+    /// @returns Returns the size of the ELF in bytes.
+    size_t GetRequiredBufferSizeBytes() const;
+
+    /// Lays out the ELF and writes it to a buffer in a single pass over the section data.
+    ///
+    /// @param [out] pBuffer    Pointer to the buffer to save to.
+    /// @param [in]  bufferSize Size of the buffer in bytes.
+    ///
+    /// @returns Success if successful, or ErrorInvalidMemorySize if the buffer is smaller than
+    ///          GetRequiredBufferSizeBytes().
+    Result SaveToBuffer(void* pBuffer, size_t bufferSize);
+
+private:
+    // A piece of section data.  The pieces of a section are written back-to-back.
+    struct Chunk
+    {
+        const void* pData;
+        size_t      size;
+        Chunk*      pNext;
+    };
+
+    struct SectionRecord
+    {
+        SectionHeader header;
+        Chunk*        pFirstChunk;
+        Chunk*        pLastChunk;
+    };
+
+    struct SegmentRecord
+    {
+        ProgramHeader header;
+        uint32        firstSection;
+        uint32        numSections;
+    };
+
+    // Header of a block of arena memory; the memory handed out follows it.
+    struct ArenaBlock
+    {
+        ArenaBlock* pNext;
+        size_t      size;
+        size_t      used;
+    };
+
+    void InitFileHeader();
+
+    SectionHeader* Header(uint32 sectionIndex)
+        { PAL_ASSERT(sectionIndex < m_numSections); return &m_pSections[sectionIndex].header; }
+
+    void*  ArenaAlloc(size_t size, size_t alignment);
+    uint32 AddSectionRecord(const char* pName, uint32 nameLength);
+    Result AppendChunk(uint32 sectionIndex, const void* pData, size_t dataSize);
+
+    Allocator* const m_pAllocator;
+    ArenaBlock*      m_pArena;           // The block new allocations come from, followed by all older blocks.
+    size_t           m_arenaTotalSize;   // Total size of all arena blocks.
+
+    FileHeader       m_fileHeader;
+    SectionRecord*   m_pSections;
+    uint32           m_numSections;
+    uint32           m_sectionCapacity;
+    SegmentRecord*   m_pSegments;
+    uint32           m_numSegments;
+    uint32           m_segmentCapacity;
+    size_t           m_totalDataSize;    // Sum of the sizes of all sections.
+
+    PAL_DISALLOW_DEFAULT_CTOR(ElfBuilder);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ElfBuilder);
+};
+
+} // Elf
+} // Util
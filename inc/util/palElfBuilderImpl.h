@@ -0,0 +1,621 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palElfBuilderImpl.h
+ * @brief PAL arena-backed ELF builder class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palElfBuilder.h"
+#include "palElfProcessorImpl.h"
+
+#include <limits.h>
+#include <string.h>
+
+namespace Util
+{
+namespace Elf
+{
+
+// The smallest block the arena allocates.  A typical pipeline ELF needs well under this much bookkeeping.
+constexpr size_t MinArenaBlockSize = 4096;
+
+// Source of zero bytes for note padding, which is never larger than NoteAlignment.
+static constexpr uint8 ZeroPadding[NoteAlignment] = { };
+
+// =====================================================================================================================
+template <typename Allocator>
+ElfBuilder<Allocator>::ElfBuilder(
+    Allocator* const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_pArena(nullptr),
+    m_arenaTotalSize(0),
+    m_pSections(nullptr),
+    m_numSections(0),
+    m_sectionCapacity(0),
+    m_pSegments(nullptr),
+    m_numSegments(0),
+    m_segmentCapacity(0),
+    m_totalDataSize(0)
+{
+    InitFileHeader();
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+ElfBuilder<Allocator>::~ElfBuilder()
+{
+    while (m_pArena != nullptr)
+    {
+        ArenaBlock*const pNext = m_pArena->pNext;
+        PAL_FREE(m_pArena, m_pAllocator);
+        m_pArena = pNext;
+    }
+}
+
+// =====================================================================================================================
+// Sets up the file header the same way the ElfProcessor constructor does.
+template <typename Allocator>
+void ElfBuilder<Allocator>::InitFileHeader()
+{
+    memset(&m_fileHeader, 0, sizeof(m_fileHeader));
+
+    m_fileHeader.ei_magic   = ElfMagic;
+    m_fileHeader.ei_class   = ElfClass64;
+    m_fileHeader.ei_data    = ElfLittleEndian;
+    m_fileHeader.ei_version = ElfVersion;
+
+    m_fileHeader.e_version  = ElfVersion;
+    m_fileHeader.e_ehsize   = FileHeaderSize;
+    m_fileHeader.e_shstrndx = static_cast<uint16>(SectionHeaderIndex::Undef);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ElfBuilder<Allocator>::Reset()
+{
+    if ((m_pArena != nullptr) && (m_pArena->pNext != nullptr))
+    {
+        // The last ELF needed more than one block.  Replace them with a single block big enough for all of them so the
+        // next ELF of a similar size is built without allocating.
+        const size_t totalSize = m_arenaTotalSize;
+
+        while (m_pArena != nullptr)
+        {
+            ArenaBlock*const pNext = m_pArena->pNext;
+            PAL_FREE(m_pArena, m_pAllocator);
+            m_pArena = pNext;
+        }
+
+        m_arenaTotalSize = 0;
+        m_pArena = static_cast<ArenaBlock*>(PAL_MALLOC(sizeof(ArenaBlock) + totalSize, m_pAllocator, AllocInternal));
+
+        if (m_pArena != nullptr)
+        {
+            m_pArena->pNext  = nullptr;
+            m_pArena->size   = totalSize;
+            m_arenaTotalSize = totalSize;
+        }
+    }
+
+    if (m_pArena != nullptr)
+    {
+        m_pArena->used = 0;
+    }
+
+    m_pSections       = nullptr;
+    m_numSections     = 0;
+    m_sectionCapacity = 0;
+    m_pSegments       = nullptr;
+    m_numSegments     = 0;
+    m_segmentCapacity = 0;
+    m_totalDataSize   = 0;
+
+    InitFileHeader();
+}
+
+// =====================================================================================================================
+// Bump-allocates from the current arena block, starting a new block if it is full.  Arena memory is only released by
+// Reset() and the destructor.
+template <typename Allocator>
+void* ElfBuilder<Allocator>::ArenaAlloc(
+    size_t size,
+    size_t alignment)
+{
+    void* pMemory = nullptr;
+
+    if (m_pArena != nullptr)
+    {
+        void*const pBase = VoidPtrInc(m_pArena, sizeof(ArenaBlock));
+        void*const pNext = VoidPtrAlign(VoidPtrInc(pBase, m_pArena->used), alignment);
+
+        if ((VoidPtrDiff(pNext, pBase) + size) <= m_pArena->size)
+        {
+            pMemory        = pNext;
+            m_pArena->used = VoidPtrDiff(pNext, pBase) + size;
+        }
+    }
+
+    if (pMemory == nullptr)
+    {
+        // Grow geometrically so the number of blocks stays logarithmic in the size of the ELF.
+        const size_t blockSize = Max(Max(MinArenaBlockSize, m_arenaTotalSize), size + alignment);
+        auto*const   pBlock    =
+            static_cast<ArenaBlock*>(PAL_MALLOC(sizeof(ArenaBlock) + blockSize, m_pAllocator, AllocInternal));
+
+        if (pBlock != nullptr)
+        {
+            pBlock->pNext     = m_pArena;
+            pBlock->size      = blockSize;
+            m_pArena          = pBlock;
+            m_arenaTotalSize += blockSize;
+
+            void*const pBase = VoidPtrInc(pBlock, sizeof(ArenaBlock));
+            pMemory          = VoidPtrAlign(pBase, alignment);
+            pBlock->used     = VoidPtrDiff(pMemory, pBase) + size;
+        }
+    }
+
+    return pMemory;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result ElfBuilder<Allocator>::AppendChunk(
+    uint32      sectionIndex,
+    const void* pData,
+    size_t      dataSize)
+{
+    PAL_ASSERT(sectionIndex < m_numSections);
+    PAL_ASSERT((pData != nullptr) || (dataSize == 0));
+
+    Result         result  = Result::Success;
+    SectionRecord& section = m_pSections[sectionIndex];
+    Chunk*const    pLast   = section.pLastChunk;
+
+    if (dataSize == 0)
+    {
+        // Nothing to do.
+    }
+    else if ((pLast != nullptr) && (VoidPtrInc(pLast->pData, pLast->size) == pData))
+    {
+        // The new data directly follows the last chunk, which is common for consecutive arena allocations.
+        pLast->size += dataSize;
+    }
+    else
+    {
+        Chunk*const pChunk = static_cast<Chunk*>(ArenaAlloc(sizeof(Chunk), alignof(Chunk)));
+
+        if (pChunk == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            pChunk->pData = pData;
+            pChunk->size  = dataSize;
+            pChunk->pNext = nullptr;
+
+            if (pLast == nullptr)
+            {
+                section.pFirstChunk = pChunk;
+            }
+            else
+            {
+                pLast->pNext = pChunk;
+            }
+
+            section.pLastChunk = pChunk;
+        }
+    }
+
+    if ((result == Result::Success) && (dataSize > 0))
+    {
+        section.header.sh_size += dataSize;
+        m_totalDataSize        += dataSize;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds a blank section record and its name.  The null section and .shstrtab are added first if this is the first
+// section, matching the indices Sections::Add() assigns.
+template <typename Allocator>
+uint32 ElfBuilder<Allocator>::AddSectionRecord(
+    const char* pName,
+    uint32      nameLength)
+{
+    uint32       index       = UINT_MAX;
+    const uint32 newSections = (m_numSections == 0) ? 3 : 1;
+
+    if ((m_numSections + newSections) > m_sectionCapacity)
+    {
+        const uint32 capacity  = Max(m_sectionCapacity * 2, 8u);
+        auto*const   pSections =
+            static_cast<SectionRecord*>(ArenaAlloc(capacity * sizeof(SectionRecord), alignof(SectionRecord)));
+
+        if (pSections != nullptr)
+        {
+            if (m_numSections > 0)
+            {
+                memcpy(pSections, m_pSections, m_numSections * sizeof(SectionRecord));
+            }
+
+            m_pSections       = pSections;
+            m_sectionCapacity = capacity;
+        }
+    }
+
+    if ((m_numSections + newSections) <= m_sectionCapacity)
+    {
+        Result result = Result::Success;
+
+        if (m_numSections == 0)
+        {
+            constexpr uint32 ShStrTabIndex = static_cast<uint32>(SectionType::ShStrTab);
+
+            memset(m_pSections, 0, 2 * sizeof(SectionRecord));
+            m_numSections = 2;
+
+            m_pSections[1].header.sh_type  = static_cast<uint32>(SectionHeaderInfoTable[ShStrTabIndex].type);
+            m_pSections[1].header.sh_flags = SectionHeaderInfoTable[ShStrTabIndex].flags;
+            m_pSections[1].header.sh_name  = 1;
+
+            // .shstrtab starts with the null section's empty name followed by its own name.
+            const char*const pShStrTabName = SectionNameStringTable[ShStrTabIndex];
+
+            result = AppendChunk(1, SectionNameStringTable[0], 1);
+
+            if (result == Result::Success)
+            {
+                result = AppendChunk(1, pShStrTabName, strlen(pShStrTabName) + 1);
+            }
+
+            if (result != Result::Success)
+            {
+                m_numSections   = 0;
+                m_totalDataSize = 0;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            const uint32 nameOffset = static_cast<uint32>(m_pSections[1].header.sh_size);
+
+            if (AppendChunk(1, pName, nameLength + 1) == Result::Success)
+            {
+                index = m_numSections++;
+
+                memset(&m_pSections[index], 0, sizeof(SectionRecord));
+                m_pSections[index].header.sh_name = nameOffset;
+            }
+        }
+    }
+
+    return index;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+uint32 ElfBuilder<Allocator>::AddSection(
+    SectionType type)
+{
+    PAL_ASSERT((type >  SectionType::Null)  &&
+               (type <  SectionType::Count) &&
+               (type != SectionType::ShStrTab));
+
+    const uint32     typeIndex = static_cast<uint32>(type);
+    const char*const pName     = SectionNameStringTable[typeIndex];
+    const uint32     index     = AddSectionRecord(pName, static_cast<uint32>(strlen(pName)));
+
+    if (index != UINT_MAX)
+    {
+        SectionHeader*const pHeader = Header(index);
+
+        pHeader->sh_type  = static_cast<uint32>(SectionHeaderInfoTable[typeIndex].type);
+        pHeader->sh_flags = SectionHeaderInfoTable[typeIndex].flags;
+
+        switch (SectionHeaderInfoTable[typeIndex].type)
+        {
+        case SectionHeaderType::SymTab:
+            pHeader->sh_entsize = SymbolTableEntrySize;
+            break;
+        case SectionHeaderType::Rel:
+            pHeader->sh_entsize = RelTableEntrySize;
+            break;
+        case SectionHeaderType::Rela:
+            pHeader->sh_entsize = RelaTableEntrySize;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return index;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+uint32 ElfBuilder<Allocator>::AddSection(
+    const char* pName)
+{
+    uint32 index = UINT_MAX;
+    bool   found = false;
+
+    for (uint32 i = 1; i < static_cast<uint32>(SectionType::Count); i++)
+    {
+        if (strcmp(SectionNameStringTable[i], pName) == 0)
+        {
+            // Match found from standard sections.
+            index = AddSection(static_cast<SectionType>(i));
+            found = true;
+            break;
+        }
+    }
+
+    if (found == false)
+    {
+        // Custom names may be temporary so they're copied into the arena.
+        const uint32 nameLength = static_cast<uint32>(strlen(pName));
+        char*const   pNameCopy  = static_cast<char*>(ArenaAlloc(nameLength + 1, 1));
+
+        if (pNameCopy != nullptr)
+        {
+            memcpy(pNameCopy, pName, nameLength + 1);
+            index = AddSectionRecord(pNameCopy, nameLength);
+        }
+    }
+
+    return index;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result ElfBuilder<Allocator>::AppendSectionData(
+    uint32      sectionIndex,
+    const void* pData,
+    size_t      dataSize)
+{
+    return AppendChunk(sectionIndex, pData, dataSize);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void* ElfBuilder<Allocator>::AppendUninitializedData(
+    uint32 sectionIndex,
+    size_t dataSize)
+{
+    void* pData = ArenaAlloc(dataSize, alignof(uint64));
+
+    if ((pData != nullptr) && (AppendChunk(sectionIndex, pData, dataSize) != Result::Success))
+    {
+        pData = nullptr;
+    }
+
+    return pData;
+}
+
+// =====================================================================================================================
+// Appends a note laid out exactly as NoteProcessor::Add() lays it out.
+template <typename Allocator>
+Result ElfBuilder<Allocator>::AddNote(
+    uint32      sectionIndex,
+    uint32      type,
+    const char* pName,
+    const void* pDesc,
+    size_t      descSize)
+{
+    PAL_ASSERT((pName != nullptr) && ((pDesc != nullptr) || (descSize == 0)));
+
+    Result result = Result::ErrorOutOfMemory;
+
+    // The note header and name are one arena chunk, followed by the referenced description and its padding.
+    const size_t nameSize      = strlen(pName);
+    const size_t prefixSize    = NoteTableEntryHeaderSize + nameSize + 1;
+    const size_t prefixPadding = RoundUpToMultiple(prefixSize, NoteAlignment) - prefixSize;
+    const size_t noteSize      = prefixSize + prefixPadding + descSize;
+    const size_t descPadding   = RoundUpToMultiple(noteSize, NoteAlignment) - noteSize;
+
+    void*const pPrefix = AppendUninitializedData(sectionIndex, prefixSize + prefixPadding);
+
+    if (pPrefix != nullptr)
+    {
+        NoteTableEntryHeader header = { };
+        header.n_namesz = static_cast<uint32>(nameSize + (NoteNameNullTerminatorByte ? 0 : 1));
+        header.n_descsz = static_cast<uint32>(descSize);
+        header.n_type   = type;
+
+        memcpy(pPrefix, &header, sizeof(header));
+        memcpy(VoidPtrInc(pPrefix, sizeof(header)), pName, nameSize + 1);
+        memset(VoidPtrInc(pPrefix, prefixSize), 0, prefixPadding);
+
+        result = AppendChunk(sectionIndex, pDesc, descSize);
+    }
+
+    if (result == Result::Success)
+    {
+        result = AppendChunk(sectionIndex, &ZeroPadding[0], descPadding);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+uint32 ElfBuilder<Allocator>::AddSegment(
+    SegmentType type,
+    uint32      flags,
+    uint32      firstSection,
+    uint32      numSections)
+{
+    PAL_ASSERT((firstSection + numSections) <= m_numSections);
+
+    uint32 index = UINT_MAX;
+
+    if (m_numSegments == m_segmentCapacity)
+    {
+        const uint32 capacity  = Max(m_segmentCapacity * 2, 4u);
+        auto*const   pSegments =
+            static_cast<SegmentRecord*>(ArenaAlloc(capacity * sizeof(SegmentRecord), alignof(SegmentRecord)));
+
+        if (pSegments != nullptr)
+        {
+            if (m_numSegments > 0)
+            {
+                memcpy(pSegments, m_pSegments, m_numSegments * sizeof(SegmentRecord));
+            }
+
+            m_pSegments       = pSegments;
+            m_segmentCapacity = capacity;
+        }
+    }
+
+    if (m_numSegments < m_segmentCapacity)
+    {
+        index = m_numSegments++;
+
+        SegmentRecord& segment = m_pSegments[index];
+        memset(&segment, 0, sizeof(segment));
+
+        segment.header.p_type  = static_cast<uint32>(type);
+        segment.header.p_flags = flags;
+        segment.firstSection   = firstSection;
+        segment.numSections    = numSections;
+    }
+
+    return index;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+size_t ElfBuilder<Allocator>::GetRequiredBufferSizeBytes() const
+{
+    const size_t headersAndData = FileHeaderSize + (m_numSegments * ProgramHeaderSize) + m_totalDataSize;
+
+    return RoundUpToMultiple(headersAndData, SectionHeaderAlignment) + (m_numSections * SectionHeaderSize);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result ElfBuilder<Allocator>::SaveToBuffer(
+    void*  pBuffer,
+    size_t bufferSize)
+{
+    Result result = Result::Success;
+
+    if (bufferSize < GetRequiredBufferSizeBytes())
+    {
+        result = Result::ErrorInvalidMemorySize;
+    }
+    else
+    {
+        FileHeader fileHeader = m_fileHeader;
+        size_t     offset     = FileHeaderSize + (m_numSegments * ProgramHeaderSize);
+
+        // Only the section headers carry offsets, so the layout pass doesn't touch any section data.
+        for (uint32 i = 1; i < m_numSections; ++i)
+        {
+            m_pSections[i].header.sh_offset = offset;
+            offset += static_cast<size_t>(m_pSections[i].header.sh_size);
+        }
+
+        if (m_numSegments > 0)
+        {
+            fileHeader.e_phoff     = FileHeaderSize;
+            fileHeader.e_phentsize = ProgramHeaderSize;
+            fileHeader.e_phnum     = static_cast<uint16>(m_numSegments);
+        }
+
+        if (m_numSections > 0)
+        {
+            fileHeader.e_shstrndx  = 1;
+            fileHeader.e_shoff     = RoundUpToMultiple(offset, SectionHeaderAlignment);
+            fileHeader.e_shentsize = SectionHeaderSize;
+            fileHeader.e_shnum     = static_cast<uint16>(m_numSections);
+        }
+
+        uint8* pWriter = static_cast<uint8*>(pBuffer);
+
+        memcpy(pWriter, &fileHeader, FileHeaderSize);
+        pWriter += FileHeaderSize;
+
+        for (uint32 i = 0; i < m_numSegments; ++i)
+        {
+            SegmentRecord& segment = m_pSegments[i];
+
+            if (segment.numSections > 0)
+            {
+                segment.header.p_offset = m_pSections[segment.firstSection].header.sh_offset;
+
+                uint64 segmentSize = 0;
+                for (uint32 s = 0; s < segment.numSections; ++s)
+                {
+                    segmentSize += m_pSections[segment.firstSection + s].header.sh_size;
+                }
+
+                segment.header.p_filesz = segmentSize;
+                segment.header.p_memsz  = segmentSize;
+            }
+
+            memcpy(pWriter, &segment.header, ProgramHeaderSize);
+            pWriter += ProgramHeaderSize;
+        }
+
+        if (m_numSections > 0)
+        {
+            for (uint32 i = 0; i < m_numSections; ++i)
+            {
+                for (const Chunk* pChunk = m_pSections[i].pFirstChunk; pChunk != nullptr; pChunk = pChunk->pNext)
+                {
+                    memcpy(pWriter, pChunk->pData, pChunk->size);
+                    pWriter += pChunk->size;
+                }
+            }
+
+            // Pad the section headers out to the offset recorded in the file header.
+            const size_t padding = static_cast<size_t>(fileHeader.e_shoff) - offset;
+            memset(pWriter, 0, padding);
+            pWriter += padding;
+
+            for (uint32 i = 0; i < m_numSections; ++i)
+            {
+                memcpy(pWriter, &m_pSections[i].header, SectionHeaderSize);
+                pWriter += SectionHeaderSize;
+            }
+        }
+
+        PAL_ASSERT(VoidPtrDiff(pWriter, pBuffer) == GetRequiredBufferSizeBytes());
+    }
+
+    return result;
+}
+
+} // Elf
+} // Util
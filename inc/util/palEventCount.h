@@ -0,0 +1,109 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palEventCount.h
+ * @brief PAL utility collection EventCount class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+#include <atomic>
+
+namespace Util
+{
+
+/**
+************************************************************************************************************************
+* @brief Wait and notify primitive used to put blocking waits on top of lock-free data structures.
+*
+* A waiting thread calls PrepareWait(), checks its condition again, and then either calls CancelWait() if the condition
+* is now true or Wait() with the key PrepareWait() returned.  Wait() returns at once if Notify() was called after
+* PrepareWait(), so a notification can't be lost between the check and the sleep.
+*
+* Notify() is one fence and one load while nobody is waiting, so a producer can call it after every push.  On Linux the
+* sleep is a process-private futex wait on the notification epoch.
+************************************************************************************************************************
+*/
+class EventCount
+{
+public:
+    EventCount() : m_epoch(0), m_waiters(0) { }
+    ~EventCount() { }
+
+    /// Registers the calling thread as a waiter.  Must be followed by exactly one call to Wait() or CancelWait().
+    ///
+    /// @returns The key to pass to Wait().
+    uint32 PrepareWait()
+    {
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        return m_epoch.load(std::memory_order_seq_cst);
+    }
+
+    /// Unregisters a waiter whose condition became true after PrepareWait().
+    void CancelWait() { m_waiters.fetch_sub(1, std::memory_order_seq_cst); }
+
+    /// Sleeps until Notify() or NotifyAll() is called, unless one was already called after PrepareWait() returned key.
+    /// Unregisters the waiter before returning.
+    ///
+    /// @param [in] key          Value returned by the matching PrepareWait().
+    /// @param [in] milliseconds Time in milliseconds before the call times out.  Can be set to 0xFFFFFFFF to never
+    ///                          time out.
+    ///
+    /// @returns @ref Success if woken by a notification, or @ref Timeout if the wait timed out.  A Success return may
+    ///          be spurious, so the caller must always check its condition again.
+    Result Wait(uint32 key, uint32 milliseconds);
+
+    /// Wakes one waiting thread.  Must be called after the change the waiters are checking for has been made.
+    void Notify() { Signal(false); }
+
+    /// Wakes all waiting threads.  @see Notify.
+    void NotifyAll() { Signal(true); }
+
+private:
+    void Signal(bool wakeAll)
+    {
+        // Pairs with the seq_cst increment in PrepareWait(): either the waiter's condition check sees our change or we
+        // see its registration here.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_relaxed) != 0)
+        {
+            m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            Wake(wakeAll);
+        }
+    }
+
+    void Wake(bool wakeAll);
+
+    std::atomic<uint32> m_epoch;    // Incremented by every notification which finds a waiter.
+    std::atomic<uint32> m_waiters;  // Number of threads between PrepareWait() and the end of Wait() or CancelWait().
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(EventCount);
+};
+
+} // Util
@@ -165,6 +165,8 @@ public:
     void KeyAndNullValue(const char* pKey) { Key(pKey); NullValue(); }
 
 private:
+    void IntegerValue(uint64 magnitude, bool negative);
+    void WriteQuotedString(const char* pString, bool isKey);
     void MaybeNextListEntry();
     void TransitionToToken(uint32 nextToken, bool leavingScope);
 
@@ -184,8 +186,8 @@ private:
     /// (ScopeStackSize - 1) layered collections are supported.
     uint8            m_scopeStack[ScopeStackSize];
 
-    /// This buffer holds enough space characters to indent out to a full scope stack.
-    char             m_indentBuffer[ScopeStackSize * IndentSize];
+    /// This buffer holds a newline followed by enough space characters to indent out to a full scope stack.
+    char             m_indentBuffer[(ScopeStackSize * IndentSize) + 1];
 
     PAL_DISALLOW_DEFAULT_CTOR(JsonWriter);
     PAL_DISALLOW_COPY_AND_ASSIGN(JsonWriter);
@@ -0,0 +1,308 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palLockFreeQueue.h
+ * @brief PAL utility collection SpscQueue, MpscQueue and IntrusiveMpscQueue class declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palEventCount.h"
+#include "palSysMemory.h"
+
+namespace Util
+{
+
+// Forward declarations.
+template<typename T> class IntrusiveMpscQueue;
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Bounded single-producer, single-consumer lock-free queue.
+ *
+ * Elements are copied into a power-of-two ring of slots.  The producer and consumer indices live on separate cache
+ * lines and each side keeps a private copy of the other's index, so a push or pop only touches the other side's cache
+ * line when the queue looks full or empty.  T should be cheap to copy, for example a pointer or a small POD struct.
+ *
+ * Exactly one thread may push and exactly one thread may pop at any given time.
+ ***********************************************************************************************************************
+ */
+template<typename T, typename Allocator>
+class SpscQueue
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] capacity   Minimum number of elements the queue can hold.  Rounded up to a power of two.
+    /// @param [in] pAllocator The allocator that will allocate the ring of slots.
+    SpscQueue(uint32 capacity, Allocator*const pAllocator);
+    ~SpscQueue();
+
+    /// Allocates the ring of slots.
+    ///
+    /// @returns @ref Success if successful, @ref ErrorInvalidValue if the capacity is zero or too large, or
+    ///          @ref ErrorOutOfMemory if the allocation failed.
+    Result Init();
+
+    /// Returns the number of elements the queue can hold.
+    uint32 Capacity() const { return m_mask + 1; }
+
+    /// Pushes as many of the given elements as currently fit, in order, and wakes a blocked consumer.
+    ///
+    /// @returns The number of elements pushed.
+    uint32 PushBatch(const T* pData, uint32 count);
+
+    /// Pushes one element if the queue isn't full.
+    ///
+    /// @returns True if the element was pushed.
+    bool TryPush(const T& data) { return (PushBatch(&data, 1) == 1); }
+
+    /// Pushes one element, sleeping while the queue is full.
+    ///
+    /// @param [in] data         Element to push.
+    /// @param [in] milliseconds Time to wait for a free slot.  Can be set to 0xFFFFFFFF to never time out.
+    ///
+    /// @returns @ref Success if the element was pushed, or @ref Timeout if the queue stayed full.
+    Result Push(const T& data, uint32 milliseconds);
+
+    /// Pops up to maxCount elements, in order, and wakes a blocked producer.
+    ///
+    /// @returns The number of elements popped.
+    uint32 PopBatch(T* pData, uint32 maxCount);
+
+    /// Pops one element if the queue isn't empty.
+    ///
+    /// @returns True if an element was popped.
+    bool TryPop(T* pData) { return (PopBatch(pData, 1) == 1); }
+
+    /// Pops one element, sleeping while the queue is empty.
+    ///
+    /// @param [out] pData        The popped element.
+    /// @param [in]  milliseconds Time to wait for an element.  Can be set to 0xFFFFFFFF to never time out.
+    ///
+    /// @returns @ref Success if an element was popped, or @ref Timeout if the queue stayed empty.
+    Result Pop(T* pData, uint32 milliseconds);
+
+private:
+    struct alignas(PAL_CACHE_LINE_BYTES) ProducerState
+    {
+        std::atomic<uint32> tail;        // Index of the next slot to write; only the producer stores it.
+        uint32              cachedHead;  // Last head the producer read.
+    };
+
+    struct alignas(PAL_CACHE_LINE_BYTES) ConsumerState
+    {
+        std::atomic<uint32> head;        // Index of the next slot to read; only the consumer stores it.
+        uint32              cachedTail;  // Last tail the consumer read.
+    };
+
+    ProducerState    m_producer;
+    ConsumerState    m_consumer;
+    T*               m_pSlots;
+    const uint32     m_mask;        // Capacity minus one.
+    EventCount       m_notEmpty;    // Notified when elements are pushed.
+    EventCount       m_notFull;     // Notified when elements are popped.
+    Allocator*const  m_pAllocator;
+
+    PAL_DISALLOW_DEFAULT_CTOR(SpscQueue);
+    PAL_DISALLOW_COPY_AND_ASSIGN(SpscQueue);
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Bounded multi-producer, single-consumer lock-free queue.
+ *
+ * Each slot carries a sequence number which tells producers and the consumer whether it is free or holds a published
+ * element.  A producer claims a run of free slots with a single compare-and-swap on the shared tail, so a batch push
+ * costs one contended atomic no matter how many elements it holds.  Because the lone consumer frees slots in order,
+ * elements are always popped in the order their slots were claimed.
+ *
+ * Any number of threads may push at once, but only one thread may pop at any given time.
+ ***********************************************************************************************************************
+ */
+template<typename T, typename Allocator>
+class MpscQueue
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] capacity   Minimum number of elements the queue can hold.  Rounded up to a power of two of at
+    ///                        least two.
+    /// @param [in] pAllocator The allocator that will allocate the ring of slots.
+    MpscQueue(uint32 capacity, Allocator*const pAllocator);
+    ~MpscQueue();
+
+    /// Allocates the ring of slots.  @see SpscQueue::Init.
+    Result Init();
+
+    /// Returns the number of elements the queue can hold.
+    uint32 Capacity() const { return m_mask + 1; }
+
+    /// Pushes as many of the given elements as currently fit, in order and without interleaving with other producers,
+    /// and wakes a blocked consumer.
+    ///
+    /// @returns The number of elements pushed.
+    uint32 PushBatch(const T* pData, uint32 count);
+
+    /// Pushes one element if the queue isn't full.  @see SpscQueue::TryPush.
+    bool TryPush(const T& data) { return (PushBatch(&data, 1) == 1); }
+
+    /// Pushes one element, sleeping while the queue is full.  @see SpscQueue::Push.
+    Result Push(const T& data, uint32 milliseconds);
+
+    /// Pops up to maxCount published elements, in order, and wakes blocked producers.
+    ///
+    /// @returns The number of elements popped.
+    uint32 PopBatch(T* pData, uint32 maxCount);
+
+    /// Pops one element if one is published.  @see SpscQueue::TryPop.
+    bool TryPop(T* pData) { return (PopBatch(pData, 1) == 1); }
+
+    /// Pops one element, sleeping while none is published.  @see SpscQueue::Pop.
+    Result Pop(T* pData, uint32 milliseconds);
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32> sequence;  // Equals the slot's index when free and its index plus one once published.
+        T                   data;
+    };
+
+    struct alignas(PAL_CACHE_LINE_BYTES) ProducerState
+    {
+        std::atomic<uint32> tail;  // Index of the next slot producers will claim.
+    };
+
+    struct alignas(PAL_CACHE_LINE_BYTES) ConsumerState
+    {
+        uint32 head;               // Index of the next slot to read; private to the consumer.
+    };
+
+    ProducerState    m_producer;
+    ConsumerState    m_consumer;
+    Slot*            m_pSlots;
+    const uint32     m_mask;        // Capacity minus one.
+    EventCount       m_notEmpty;    // Notified when elements are published.
+    EventCount       m_notFull;     // Notified when slots are freed.
+    Allocator*const  m_pAllocator;
+
+    PAL_DISALLOW_DEFAULT_CTOR(MpscQueue);
+    PAL_DISALLOW_COPY_AND_ASSIGN(MpscQueue);
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Link embedded in every element which can be placed in an IntrusiveMpscQueue.
+ *
+ * An element can only be in one queue at a time, and it can be pushed again as soon as it has been popped.
+ ***********************************************************************************************************************
+ */
+template<typename T>
+class MpscQueueNode
+{
+public:
+    /// @param [in] pData  Address of the element which contains this node.
+    explicit MpscQueueNode(T* pData) : m_pData(pData), m_pNext(nullptr) { }
+
+    /// Returns the element which contains this node.
+    T* Data() const { return m_pData; }
+
+private:
+    // This special constructor is provided for IntrusiveMpscQueue's stub node which must have a null data pointer.
+    MpscQueueNode() : m_pData(nullptr), m_pNext(nullptr) { }
+
+    T*const                     m_pData;
+    std::atomic<MpscQueueNode*> m_pNext;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(MpscQueueNode);
+
+    friend class IntrusiveMpscQueue<T>;
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Unbounded multi-producer, single-consumer lock-free queue of externally owned nodes.
+ *
+ * Pushing is a single atomic exchange no matter how many nodes are pushed, and never allocates or fails.  This also
+ * makes it the unbounded single-producer queue: with one producer the exchange is never contended.
+ *
+ * A producer which has been preempted halfway through a push hides the nodes pushed after it from the consumer until
+ * it resumes, so TryPop() may briefly report an empty queue which isn't.  Pop() is not affected since the producer
+ * wakes the consumer once its push is complete.
+ *
+ * Any number of threads may push at once, but only one thread may pop at any given time.
+ ***********************************************************************************************************************
+ */
+template<typename T>
+class IntrusiveMpscQueue
+{
+public:
+    /// A convenient shorthand for MpscQueueNode.
+    typedef MpscQueueNode<T> Node;
+
+    IntrusiveMpscQueue();
+    ~IntrusiveMpscQueue() { }
+
+    /// Pushes a node and wakes a blocked consumer.
+    void Push(Node* pNode) { PushBatch(&pNode, 1); }
+
+    /// Pushes count nodes, in order and without interleaving with other producers, and wakes a blocked consumer.
+    void PushBatch(Node*const* ppNodes, uint32 count);
+
+    /// Pops the oldest element.
+    ///
+    /// @returns The element, or null if the queue is empty or the next element's push is still in progress.
+    T* TryPop();
+
+    /// Pops up to maxCount elements, in order.
+    ///
+    /// @returns The number of elements popped.
+    uint32 PopBatch(T** ppData, uint32 maxCount);
+
+    /// Pops the oldest element, sleeping while the queue is empty.  @see SpscQueue::Pop.
+    Result Pop(T** ppData, uint32 milliseconds);
+
+private:
+    struct alignas(PAL_CACHE_LINE_BYTES) ProducerState
+    {
+        std::atomic<Node*> pHead;  // Most recently pushed node.
+    };
+
+    struct alignas(PAL_CACHE_LINE_BYTES) ConsumerState
+    {
+        Node* pTail;               // Oldest node; private to the consumer.
+    };
+
+    ProducerState m_producer;
+    ConsumerState m_consumer;
+    Node          m_stub;      // Keeps the list non-empty so producers never have to touch the consumer's state.
+    EventCount    m_notEmpty;  // Notified when nodes are pushed.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(IntrusiveMpscQueue);
+};
+
+} // Util
@@ -0,0 +1,556 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palLockFreeQueueImpl.h
+ * @brief PAL utility collection SpscQueue, MpscQueue and IntrusiveMpscQueue class implementations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palInlineFuncs.h"
+#include "palLockFreeQueue.h"
+#include "palMutex.h"
+
+namespace Util
+{
+
+// Largest capacity which keeps the distance between two free-running 32-bit indices unambiguous.
+constexpr uint32 LockFreeQueueMaxCapacity = (1u << 31);
+
+// Rounds a requested capacity up to a power of two of at least two and returns it minus one, or zero if the request
+// can't be satisfied.
+PAL_INLINE uint32 LockFreeQueueMask(
+    uint32 capacity)
+{
+    return ((capacity > 0) && (capacity <= LockFreeQueueMaxCapacity)) ? (Pow2Pad(Max(capacity, 2u)) - 1) : 0;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+SpscQueue<T, Allocator>::SpscQueue(
+    uint32          capacity,
+    Allocator*const pAllocator)
+    :
+    m_pSlots(nullptr),
+    m_mask(LockFreeQueueMask(capacity)),
+    m_pAllocator(pAllocator)
+{
+    m_producer.tail.store(0, std::memory_order_relaxed);
+    m_producer.cachedHead = 0;
+    m_consumer.head.store(0, std::memory_order_relaxed);
+    m_consumer.cachedTail = 0;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+SpscQueue<T, Allocator>::~SpscQueue()
+{
+    PAL_SAFE_DELETE_ARRAY(m_pSlots, m_pAllocator);
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result SpscQueue<T, Allocator>::Init()
+{
+    Result result = (m_mask != 0) ? Result::Success : Result::ErrorInvalidValue;
+
+    if (result == Result::Success)
+    {
+        m_pSlots = PAL_NEW_ARRAY(T, Capacity(), m_pAllocator, AllocInternal);
+        result   = (m_pSlots != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+uint32 SpscQueue<T, Allocator>::PushBatch(
+    const T* pData,
+    uint32   count)
+{
+    const uint32 tail = m_producer.tail.load(std::memory_order_relaxed);
+    uint32       free = Capacity() - (tail - m_producer.cachedHead);
+
+    // Only look at the consumer's cache line when our copy of its index says there isn't enough room.
+    if (free < count)
+    {
+        m_producer.cachedHead = m_consumer.head.load(std::memory_order_acquire);
+        free                  = Capacity() - (tail - m_producer.cachedHead);
+    }
+
+    const uint32 numPushed = Min(free, count);
+
+    for (uint32 idx = 0; idx < numPushed; ++idx)
+    {
+        m_pSlots[(tail + idx) & m_mask] = pData[idx];
+    }
+
+    if (numPushed > 0)
+    {
+        m_producer.tail.store(tail + numPushed, std::memory_order_release);
+        m_notEmpty.Notify();
+    }
+
+    return numPushed;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result SpscQueue<T, Allocator>::Push(
+    const T& data,
+    uint32   milliseconds)
+{
+    Result result = Result::Success;
+    bool   pushed = TryPush(data);
+
+    // Give the other side one chance to make progress before paying for a sleep and a wake-up.
+    if (pushed == false)
+    {
+        YieldThread();
+        pushed = TryPush(data);
+    }
+
+    while ((pushed == false) && (result == Result::Success))
+    {
+        const uint32 key = m_notFull.PrepareWait();
+
+        pushed = TryPush(data);
+
+        if (pushed)
+        {
+            m_notFull.CancelWait();
+        }
+        else
+        {
+            result = m_notFull.Wait(key, milliseconds);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+uint32 SpscQueue<T, Allocator>::PopBatch(
+    T*     pData,
+    uint32 maxCount)
+{
+    const uint32 head  = m_consumer.head.load(std::memory_order_relaxed);
+    uint32       count = m_consumer.cachedTail - head;
+
+    // Only look at the producer's cache line when our copy of its index says there isn't enough data.
+    if (count < maxCount)
+    {
+        m_consumer.cachedTail = m_producer.tail.load(std::memory_order_acquire);
+        count                 = m_consumer.cachedTail - head;
+    }
+
+    const uint32 numPopped = Min(count, maxCount);
+
+    for (uint32 idx = 0; idx < numPopped; ++idx)
+    {
+        pData[idx] = m_pSlots[(head + idx) & m_mask];
+    }
+
+    if (numPopped > 0)
+    {
+        m_consumer.head.store(head + numPopped, std::memory_order_release);
+        m_notFull.Notify();
+    }
+
+    return numPopped;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result SpscQueue<T, Allocator>::Pop(
+    T*     pData,
+    uint32 milliseconds)
+{
+    Result result = Result::Success;
+    bool   popped = TryPop(pData);
+
+    // Give the other side one chance to make progress before paying for a sleep and a wake-up.
+    if (popped == false)
+    {
+        YieldThread();
+        popped = TryPop(pData);
+    }
+
+    while ((popped == false) && (result == Result::Success))
+    {
+        const uint32 key = m_notEmpty.PrepareWait();
+
+        popped = TryPop(pData);
+
+        if (popped)
+        {
+            m_notEmpty.CancelWait();
+        }
+        else
+        {
+            result = m_notEmpty.Wait(key, milliseconds);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+MpscQueue<T, Allocator>::MpscQueue(
+    uint32          capacity,
+    Allocator*const pAllocator)
+    :
+    m_pSlots(nullptr),
+    m_mask(LockFreeQueueMask(capacity)),
+    m_pAllocator(pAllocator)
+{
+    m_producer.tail.store(0, std::memory_order_relaxed);
+    m_consumer.head = 0;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+MpscQueue<T, Allocator>::~MpscQueue()
+{
+    PAL_SAFE_DELETE_ARRAY(m_pSlots, m_pAllocator);
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result MpscQueue<T, Allocator>::Init()
+{
+    Result result = (m_mask != 0) ? Result::Success : Result::ErrorInvalidValue;
+
+    if (result == Result::Success)
+    {
+        m_pSlots = PAL_NEW_ARRAY(Slot, Capacity(), m_pAllocator, AllocInternal);
+        result   = (m_pSlots != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        for (uint32 idx = 0; idx < Capacity(); ++idx)
+        {
+            m_pSlots[idx].sequence.store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+uint32 MpscQueue<T, Allocator>::PushBatch(
+    const T* pData,
+    uint32   count)
+{
+    uint32 tail      = m_producer.tail.load(std::memory_order_relaxed);
+    uint32 numPushed = 0;
+    bool   claimed   = (count == 0);
+
+    while (claimed == false)
+    {
+        const int32 distance = int32(m_pSlots[tail & m_mask].sequence.load(std::memory_order_acquire) - tail);
+
+        if (distance < 0)
+        {
+            // The consumer hasn't freed this slot yet, so the queue is full.
+            claimed = true;
+        }
+        else if (distance > 0)
+        {
+            // Another producer claimed this slot since we read the tail.
+            tail = m_producer.tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // The consumer frees slots in order, so the run of free slots starting at the tail is contiguous.
+            uint32 numFree = 1;
+
+            while ((numFree < count) &&
+                   (m_pSlots[(tail + numFree) & m_mask].sequence.load(std::memory_order_acquire) == (tail + numFree)))
+            {
+                ++numFree;
+            }
+
+            if (m_producer.tail.compare_exchange_weak(tail, tail + numFree, std::memory_order_relaxed))
+            {
+                numPushed = numFree;
+                claimed   = true;
+            }
+        }
+    }
+
+    for (uint32 idx = 0; idx < numPushed; ++idx)
+    {
+        Slot*const pSlot = &m_pSlots[(tail + idx) & m_mask];
+
+        pSlot->data = pData[idx];
+        pSlot->sequence.store(tail + idx + 1, std::memory_order_release);
+    }
+
+    if (numPushed > 0)
+    {
+        m_notEmpty.Notify();
+    }
+
+    return numPushed;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result MpscQueue<T, Allocator>::Push(
+    const T& data,
+    uint32   milliseconds)
+{
+    Result result = Result::Success;
+    bool   pushed = TryPush(data);
+
+    // Give the other side one chance to make progress before paying for a sleep and a wake-up.
+    if (pushed == false)
+    {
+        YieldThread();
+        pushed = TryPush(data);
+    }
+
+    while ((pushed == false) && (result == Result::Success))
+    {
+        const uint32 key = m_notFull.PrepareWait();
+
+        pushed = TryPush(data);
+
+        if (pushed)
+        {
+            m_notFull.CancelWait();
+        }
+        else
+        {
+            result = m_notFull.Wait(key, milliseconds);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+uint32 MpscQueue<T, Allocator>::PopBatch(
+    T*     pData,
+    uint32 maxCount)
+{
+    const uint32 head      = m_consumer.head;
+    uint32       numPopped = 0;
+
+    // Stop at the first slot which isn't published yet, even if later slots are, to keep elements in order.
+    while ((numPopped < maxCount) &&
+           (m_pSlots[(head + numPopped) & m_mask].sequence.load(std::memory_order_acquire) == (head + numPopped + 1)))
+    {
+        Slot*const pSlot = &m_pSlots[(head + numPopped) & m_mask];
+
+        pData[numPopped] = pSlot->data;
+        pSlot->sequence.store(head + numPopped + Capacity(), std::memory_order_release);
+        ++numPopped;
+    }
+
+    if (numPopped > 0)
+    {
+        m_consumer.head = head + numPopped;
+        m_notFull.NotifyAll();
+    }
+
+    return numPopped;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result MpscQueue<T, Allocator>::Pop(
+    T*     pData,
+    uint32 milliseconds)
+{
+    Result result = Result::Success;
+    bool   popped = TryPop(pData);
+
+    // Give the other side one chance to make progress before paying for a sleep and a wake-up.
+    if (popped == false)
+    {
+        YieldThread();
+        popped = TryPop(pData);
+    }
+
+    while ((popped == false) && (result == Result::Success))
+    {
+        const uint32 key = m_notEmpty.PrepareWait();
+
+        popped = TryPop(pData);
+
+        if (popped)
+        {
+            m_notEmpty.CancelWait();
+        }
+        else
+        {
+            result = m_notEmpty.Wait(key, milliseconds);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T>
+IntrusiveMpscQueue<T>::IntrusiveMpscQueue()
+    :
+    m_stub()
+{
+    m_producer.pHead.store(&m_stub, std::memory_order_relaxed);
+    m_consumer.pTail = &m_stub;
+}
+
+// =====================================================================================================================
+template<typename T>
+void IntrusiveMpscQueue<T>::PushBatch(
+    Node*const* ppNodes,
+    uint32      count)
+{
+    if (count > 0)
+    {
+        // Link the batch up privately so that it can be published with one exchange.
+        for (uint32 idx = 0; idx < (count - 1); ++idx)
+        {
+            ppNodes[idx]->m_pNext.store(ppNodes[idx + 1], std::memory_order_relaxed);
+        }
+
+        ppNodes[count - 1]->m_pNext.store(nullptr, std::memory_order_relaxed);
+
+        Node*const pPrev = m_producer.pHead.exchange(ppNodes[count - 1], std::memory_order_acq_rel);
+
+        // Until this store the consumer can't see the batch or anything pushed after it.
+        pPrev->m_pNext.store(ppNodes[0], std::memory_order_release);
+
+        m_notEmpty.Notify();
+    }
+}
+
+// =====================================================================================================================
+template<typename T>
+T* IntrusiveMpscQueue<T>::TryPop()
+{
+    Node* pTail = m_consumer.pTail;
+    Node* pNext = pTail->m_pNext.load(std::memory_order_acquire);
+
+    // Skip over the stub if it's at the front.
+    if ((pTail == &m_stub) && (pNext != nullptr))
+    {
+        m_consumer.pTail = pNext;
+        pTail            = pNext;
+        pNext            = pNext->m_pNext.load(std::memory_order_acquire);
+    }
+
+    T* pData = nullptr;
+
+    if (pTail != &m_stub)
+    {
+        if (pNext == nullptr)
+        {
+            // The tail is the last node we can see.  If it's also the head, push the stub behind it so it can be
+            // unlinked; otherwise a producer is in the middle of linking the next node and we must wait for it.
+            if (pTail == m_producer.pHead.load(std::memory_order_acquire))
+            {
+                Push(&m_stub);
+            }
+
+            pNext = pTail->m_pNext.load(std::memory_order_acquire);
+        }
+
+        if (pNext != nullptr)
+        {
+            m_consumer.pTail = pNext;
+            pData            = pTail->m_pData;
+        }
+    }
+
+    return pData;
+}
+
+// =====================================================================================================================
+template<typename T>
+uint32 IntrusiveMpscQueue<T>::PopBatch(
+    T**    ppData,
+    uint32 maxCount)
+{
+    uint32 numPopped = 0;
+    T*     pData     = (maxCount > 0) ? TryPop() : nullptr;
+
+    while (pData != nullptr)
+    {
+        ppData[numPopped++] = pData;
+        pData               = (numPopped < maxCount) ? TryPop() : nullptr;
+    }
+
+    return numPopped;
+}
+
+// =====================================================================================================================
+template<typename T>
+Result IntrusiveMpscQueue<T>::Pop(
+    T**    ppData,
+    uint32 milliseconds)
+{
+    Result result = Result::Success;
+
+    *ppData = TryPop();
+
+    // Give producers one chance to make progress before paying for a sleep and a wake-up.
+    if (*ppData == nullptr)
+    {
+        YieldThread();
+        *ppData = TryPop();
+    }
+
+    while ((*ppData == nullptr) && (result == Result::Success))
+    {
+        const uint32 key = m_notEmpty.PrepareWait();
+
+        *ppData = TryPop();
+
+        if (*ppData != nullptr)
+        {
+            m_notEmpty.CancelWait();
+        }
+        else
+        {
+            result = m_notEmpty.Wait(key, milliseconds);
+        }
+    }
+
+    return result;
+}
+
+} // Util
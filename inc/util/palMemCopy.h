@@ -0,0 +1,77 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palMemCopy.h
+ * @brief PAL utility collection streaming memory copy and fill declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+
+namespace Util
+{
+
+/// Specifies the instruction set used by the streaming copy and fill kernels.
+enum class StreamingMemIsa : uint32
+{
+    Scalar = 0, ///< Plain memcpy/memset, used when no x86 SIMD support is available.
+    Sse2,       ///< 128-bit non-temporal stores.
+    Avx2,       ///< 256-bit non-temporal stores.
+    Avx512,     ///< 512-bit non-temporal stores.
+};
+
+/// Returns the instruction set which the streaming copy and fill functions selected for the current CPU.
+///
+/// The selection is made once, the first time any streaming function is called, based on the CPU's feature bits and on
+/// whether the OS saves the wider register state.
+///
+/// @returns The instruction set used by StreamingMemCopy() and StreamingMemFill32().
+extern StreamingMemIsa GetStreamingMemIsa();
+
+/// Copies memory using non-temporal stores which bypass the CPU caches.
+///
+/// This is intended for large copies into write-combined memory (e.g., mapped GPU memory) or into buffers which won't
+/// be read by the CPU again soon. Small copies are forwarded to memcpy. The function ends with a store fence so that
+/// the copied data is globally visible once it returns.
+///
+/// @param [out] pDst     Destination buffer. It must not overlap pSrc.
+/// @param [in]  pSrc     Source buffer.
+/// @param [in]  numBytes Number of bytes to copy.
+extern void StreamingMemCopy(void* pDst, const void* pSrc, size_t numBytes);
+
+/// Fills memory with a repeated 32-bit value using non-temporal stores which bypass the CPU caches.
+///
+/// Small fills are written with normal stores. The function ends with a store fence so that the written data is
+/// globally visible once it returns.
+///
+/// @param [out] pDst      Destination buffer; must be DWORD aligned.
+/// @param [in]  value     Value to write to each DWORD.
+/// @param [in]  numDwords Number of DWORDs to write.
+extern void StreamingMemFill32(uint32* pDst, uint32 value, size_t numDwords);
+
+} // Util
@@ -34,6 +34,15 @@
 #if PAL_MEMTRACK
 
 #include "palMutex.h"
+#include <atomic>
+
+/// Underrun/overrun markers are written and checked for one out of this many allocations. Builds which need every
+/// allocation checked can set it to 1.
+#if !defined(PAL_MEMTRACK_SENTINEL_SAMPLE_RATE)
+#define PAL_MEMTRACK_SENTINEL_SAMPLE_RATE 8
+#endif
+
+static_assert(PAL_MEMTRACK_SENTINEL_SAMPLE_RATE >= 1, "PAL_MEMTRACK_SENTINEL_SAMPLE_RATE must be at least 1.");
 
 namespace Util
 {
@@ -56,26 +65,46 @@ enum class MemBlkType : uint32
 
 /// @internal
 ///
-/// Internal structure used by MemTracker to store information on each allocation.  These elements form a singly linked
-/// list.
+/// Internal structure used by MemTracker to store information on each allocation.  It's stored inside the allocation,
+/// directly in front of the underrun marker, and forms a doubly linked list with the other allocations in its shard.
+/// The element is only read on free once the pointer has been found in the shard's set of live allocations.
 struct MemTrackerElem
 {
-    MemTrackerElem* pNext;       ///< Pointer to next element in the linked list.
-    MemTrackerElem* pNextNext;   ///< Pointer to next element's next element; detects if the next tracker is corrupted.
-    size_t          size;        ///< Size of allocation request.
-    MemBlkType      blockType;   ///< Memory block type (malloc, new, new array).
-    const char*     pFilename;   ///< File that requested allocation.
-    uint32          lineNumber;  ///< Line number that requested allocation.
-    void*           pClientMem;  ///< Starting "client usable" data address.
-    void*           pOrigMem;    ///< Original address of the allocation returned from our underlying allocator.
-    size_t          allocNum;    ///< The number of the memory allocation. 1 based.
+    MemTrackerElem* pNext;        ///< Pointer to next element in the shard's list.
+    MemTrackerElem* pPrev;        ///< Pointer to previous element in the shard's list.
+    size_t          size;         ///< Size of allocation request.
+    const char*     pFilename;    ///< File that requested allocation.
+    void*           pOrigMem;     ///< Original address of the allocation returned from our underlying allocator.
+    size_t          allocNum;     ///< The number of the memory allocation. 1 based.
+    uint32          lineNumber;   ///< Line number that requested allocation.
+    MemBlkType      blockType;    ///< Memory block type (malloc, new, new array).
+    SystemAllocType allocType;    ///< Allocation category requested by the caller.
+    uint32          hasSentinels; ///< Non-zero if the underrun/overrun markers were written for this allocation.
+    uint32          cookie;       ///< Identifies live elements; used to detect a corrupted element.
+};
+
+/// @internal
+///
+/// Live allocations which share a call site and allocation type, as reported by MemTracker::TakeSnapshot().
+struct MemTrackerSnapshotEntry
+{
+    const char*     pFilename;    ///< File that requested the allocations.
+    uint32          lineNumber;   ///< Line number that requested the allocations.
+    SystemAllocType allocType;    ///< Allocation category of the allocations.
+    size_t          numAllocs;    ///< Number of live allocations.
+    size_t          totalBytes;   ///< Total size of the live allocations in bytes.
 };
 
 /**
  ***********************************************************************************************************************
  * @brief Class responsible for tracking allocations and frees to notify the developer of memory leaks.
  *
- * Tracking is enabled/disabled via the PAL_MEMTRACK define.
+ * Tracking is enabled/disabled via the PAL_MEMTRACK define. Live allocations are split across several independently
+ * locked shards, chosen by a hash of the allocation's address so that threads rarely contend. The tracking data is
+ * stored in the allocation itself. Each shard also keeps a hash set of its live allocations, so a free is validated
+ * without walking a list and without reading memory in front of a pointer the tracker never handed out.
+ *
+ * Underrun/overrun markers are written for one out of every PAL_MEMTRACK_SENTINEL_SAMPLE_RATE allocations.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -107,37 +136,68 @@ public:
     void Free(
         const FreeInfo& freeInfo);
 
+    /// Reports the live allocations grouped by file, line and allocation type. Each shard is locked in turn, so the
+    /// snapshot is not atomic with respect to allocations made on other threads while it's being taken.
+    ///
+    /// @param [out]    pEntries    Array of at least *pNumEntries entries to fill.
+    /// @param [in,out] pNumEntries Input is the size of pEntries, output is the number of entries written.
+    ///
+    /// @returns Result::Success if every call site fit in pEntries, Result::ErrorIncompleteResults if some were
+    ///          dropped, or Result::ErrorInvalidPointer if an argument is null.
+    Result TakeSnapshot(
+        MemTrackerSnapshotEntry* pEntries,
+        uint32*                  pNumEntries);
+
+    /// Writes the list of live allocations to the debug output.
+    void MemoryReport();
+
 private:
+    // Number of independently locked lists of live allocations.
+    static constexpr uint32 NumShards = 16;
+
+    struct Shard
+    {
+        MemTrackerElem head;            // Dummy head for the list of allocations.
+        Mutex          mutex;           // Serializes access to the list and the live set.
+        void**         pLiveSet;        // Open-addressed hash set of the client pointers tracked by this shard.
+        uint32         liveSetCapacity; // Number of slots in pLiveSet; zero or a power of two.
+        uint32         liveSetCount;    // Number of occupied slots in pLiveSet.
+    };
+
     void* AddMemElement(
-        void*       pMem,
-        size_t      bytes,
-        size_t      align,
-        MemBlkType  blockType,
-        const char* pFilename,
-        uint32      lineNumber);
+        void*            pMem,
+        const AllocInfo& allocInfo,
+        size_t           align);
 
     void* RemoveMemElement(void* pMem, MemBlkType blockType);
 
-    void MemoryReport();
     void FreeLeakedMemory();
 
+    bool   InsertLive(Shard* pShard, void* pClientMem);
+    uint32 FindLive(const Shard& shard, const void* pClientMem) const;
+    void   RemoveLive(Shard* pShard, uint32 slot);
+
+    static uint64 HashPointer(const void* pClientMem);
+
+    MemTrackerElem* GetElement(void* pClientMem) const
+        { return static_cast<MemTrackerElem*>(VoidPtrDec(pClientMem, m_markerSizeBytes + sizeof(MemTrackerElem))); }
+
     // Sentinel patterns used to detect memory underrun.
     static constexpr uint32 UnderrunSentinel = 0xDEADBEEF;
     // Sentinel patterns used to detect memory overrun.
     static constexpr uint32 OverrunSentinel  = 0xCAFEBABE;
 
+    // Cookies stored in each element to tell live and freed allocations apart.
+    static constexpr uint32 LiveCookie  = 0x4D454D54;
+    static constexpr uint32 FreedCookie = 0x46524545;
+
     // Size of markers for underruns/overruns.  Setting this to 0 disables this feature.
     static constexpr size_t MarkerSizeUints = PAL_CACHE_LINE_BYTES / sizeof(uint32);
 
     // Size of underrun/overrun markers in bytes.
     static constexpr size_t MarkerSizeBytes = MarkerSizeUints * sizeof(uint32);
 
-    // Create a statically allocated dummy head element in the list. Then the list insertion and deletion functions
-    // don't have to check if the head is being changed.
-    MemTrackerElem     m_memListHead;      // Dummy head for link list of allocations.
-    MemTrackerElem*    m_pMemListHead;     // Linked-list of allocations.
-
-    Mutex              m_mutex;            // Serializes access to list of active allocations.
+    Shard              m_shards[NumShards];
 
     const size_t       m_markerSizeUints;  // Member variable copy of MarkerSizeUints.  Only used to prevent compiler
                                            //  warnings when MarkerSizeUints is 0.
@@ -146,8 +206,8 @@ private:
 
     Allocator*const    m_pAllocator;       // Allocator for performing the actual allocations.
 
-    size_t             m_nextAllocNum;     // The allocation number that the next allocated block will receive.
-    const size_t       m_breakOnAllocNum;  // The allocation number to trigger a debug break on.
+    std::atomic<size_t> m_nextAllocNum;    // The allocation number that the next allocated block will receive.
+    const size_t        m_breakOnAllocNum; // The allocation number to trigger a debug break on.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(MemTracker);
 };
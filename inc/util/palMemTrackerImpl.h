@@ -54,24 +54,38 @@ template <typename Allocator>
 MemTracker<Allocator>::MemTracker(
     Allocator*const pAllocator)
     :
-    m_pMemListHead(&m_memListHead),
     m_markerSizeUints(MarkerSizeUints),
     m_markerSizeBytes(MarkerSizeBytes),
     m_pAllocator(pAllocator),
     m_nextAllocNum(1),
     m_breakOnAllocNum(0)
 {
-    memset(&m_memListHead, 0, sizeof(MemTrackerElem));
+    for (uint32 i = 0; i < NumShards; ++i)
+    {
+        memset(&m_shards[i].head, 0, sizeof(MemTrackerElem));
+        m_shards[i].head.pNext      = &m_shards[i].head;
+        m_shards[i].head.pPrev      = &m_shards[i].head;
+        m_shards[i].pLiveSet        = nullptr;
+        m_shards[i].liveSetCapacity = 0;
+        m_shards[i].liveSetCount    = 0;
+    }
 }
 
 // =====================================================================================================================
 template <typename Allocator>
 MemTracker<Allocator>::~MemTracker()
 {
+    bool hasLeaks = false;
+
+    for (uint32 i = 0; i < NumShards; ++i)
+    {
+        hasLeaks |= (m_shards[i].head.pNext != &m_shards[i].head);
+    }
+
     // Clean-up leaked memory if needed
-    if (m_pMemListHead->pNext != nullptr)
+    if (hasLeaks)
     {
-        // If the dummy head has a valid next pointer, we have a leak.  The leak could either be caused by an
+        // If any dummy head doesn't point back at itself, we have a leak.  The leak could either be caused by an
         // internal PAL leak, a client leak, or even the application not destroying API objects.
         PAL_ALERT_ALWAYS();
 
@@ -79,6 +93,14 @@ MemTracker<Allocator>::~MemTracker()
         MemoryReport();
 
     }
+
+    for (uint32 i = 0; i < NumShards; ++i)
+    {
+        if (m_shards[i].pLiveSet != nullptr)
+        {
+            m_pAllocator->Free(FreeInfo(m_shards[i].pLiveSet, MemBlkType::Malloc));
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -86,68 +108,227 @@ MemTracker<Allocator>::~MemTracker()
 template <typename Allocator>
 Result MemTracker<Allocator>::Init()
 {
-    return m_mutex.Init();
+    Result result = Result::Success;
+
+    for (uint32 i = 0; (i < NumShards) && (result == Result::Success); ++i)
+    {
+        result = m_shards[i].mutex.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hashes a client pointer.  The top bits select the shard and the high half selects the starting slot in the shard's
+// live set.
+template <typename Allocator>
+uint64 MemTracker<Allocator>::HashPointer(
+    const void* pClientMem)
+{
+    // Client pointers are at least 4-byte aligned, so the lowest bits carry no information.
+    return (static_cast<uint64>(reinterpret_cast<uintptr_t>(pClientMem)) >> 2) * 0x9E3779B97F4A7C15ull;
+}
+
+// =====================================================================================================================
+// Returns the slot of the live set which holds pClientMem, or the set's capacity if the pointer isn't in the set.  The
+// caller must hold the shard's mutex.
+template <typename Allocator>
+uint32 MemTracker<Allocator>::FindLive(
+    const Shard& shard,
+    const void*  pClientMem
+    ) const
+{
+    uint32 found = shard.liveSetCapacity;
+
+    if (shard.liveSetCapacity > 0)
+    {
+        const uint32 mask = shard.liveSetCapacity - 1;
+
+        for (uint32 slot = static_cast<uint32>(HashPointer(pClientMem) >> 32) & mask;
+             shard.pLiveSet[slot] != nullptr;
+             slot = (slot + 1) & mask)
+        {
+            if (shard.pLiveSet[slot] == pClientMem)
+            {
+                found = slot;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Adds pClientMem to the shard's live set, growing the set if it's more than half full.  Returns false if the set
+// couldn't be grown.  The caller must hold the shard's mutex.
+template <typename Allocator>
+bool MemTracker<Allocator>::InsertLive(
+    Shard* pShard,
+    void*  pClientMem)
+{
+    bool result = true;
+
+    if (((pShard->liveSetCount + 1) * 2) > pShard->liveSetCapacity)
+    {
+        const uint32 newCapacity = Max(pShard->liveSetCapacity * 2, 256u);
+        void**const  pNewSet     = static_cast<void**>(m_pAllocator->Alloc(AllocInfo(sizeof(void*) * newCapacity,
+                                                                                       alignof(void*),
+                                                                                       true,
+                                                                                       AllocInternal,
+                                                                                       MemBlkType::Malloc,
+                                                                                       __FILE__,
+                                                                                       __LINE__)));
+
+        if (pNewSet != nullptr)
+        {
+            void**const  pOldSet     = pShard->pLiveSet;
+            const uint32 oldCapacity = pShard->liveSetCapacity;
+
+            pShard->pLiveSet        = pNewSet;
+            pShard->liveSetCapacity = newCapacity;
+
+            for (uint32 i = 0; i < oldCapacity; ++i)
+            {
+                if (pOldSet[i] != nullptr)
+                {
+                    uint32 slot = static_cast<uint32>(HashPointer(pOldSet[i]) >> 32) & (newCapacity - 1);
+                    while (pNewSet[slot] != nullptr)
+                    {
+                        slot = (slot + 1) & (newCapacity - 1);
+                    }
+
+                    pNewSet[slot] = pOldSet[i];
+                }
+            }
+
+            if (pOldSet != nullptr)
+            {
+                m_pAllocator->Free(FreeInfo(pOldSet, MemBlkType::Malloc));
+            }
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    if (result)
+    {
+        const uint32 mask = pShard->liveSetCapacity - 1;
+
+        uint32 slot = static_cast<uint32>(HashPointer(pClientMem) >> 32) & mask;
+        while (pShard->pLiveSet[slot] != nullptr)
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        pShard->pLiveSet[slot] = pClientMem;
+        pShard->liveSetCount++;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes the pointer in the given slot from the shard's live set.  Later entries of the same probe sequence are moved
+// back so that lookups never need tombstones.  The caller must hold the shard's mutex.
+template <typename Allocator>
+void MemTracker<Allocator>::RemoveLive(
+    Shard* pShard,
+    uint32 slot)
+{
+    const uint32 mask = pShard->liveSetCapacity - 1;
+
+    uint32 hole = slot;
+    uint32 next = (slot + 1) & mask;
+
+    while (pShard->pLiveSet[next] != nullptr)
+    {
+        const uint32 home = static_cast<uint32>(HashPointer(pShard->pLiveSet[next]) >> 32) & mask;
+
+        // The entry can fill the hole unless its home slot lies cyclically in (hole, next].
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            pShard->pLiveSet[hole] = pShard->pLiveSet[next];
+            hole                   = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    pShard->pLiveSet[hole] = nullptr;
+    pShard->liveSetCount--;
 }
 
 // =====================================================================================================================
 // Adds the newly allocated memory block to the list of blocks for tracking.
 //
-// The tracking information includes things like filename, line numbers, and type of block.  Also, given a pointer,
-// adds the Underrun/Overrun markers to the memory allocated, and return a pointer to the actual client usable memory.
+// The tracking element is placed directly in front of the underrun marker, which itself directly precedes the client
+// usable memory.  If this allocation is sampled, also writes the Underrun/Overrun markers.  Returns a pointer to the
+// actual client usable memory.
 //
 // See MemTracker::Alloc() which is used to allocate memory that is being tracked.
 template <typename Allocator>
 void* MemTracker<Allocator>::AddMemElement(
-    void*       pMem,        // [in,out] Original pointer allocated by MemTracker::Alloc.
-    size_t      bytes,       // Client requested allocation size in bytes.
-    size_t      align,       // Client-requested alignment in bytes.
-    MemBlkType  blockType,   // Block type based on calling allocation routine.
-    const char* pFilename,   // Client filename that is requesting the memory.
-    uint32      lineNumber)  // Line number in client file that is requesting the memory.
+    void*            pMem,      // [in,out] Original pointer allocated by MemTracker::Alloc.
+    const AllocInfo& allocInfo, // Client allocation request.
+    size_t           align)     // Alignment of the client usable memory.
 {
     // Increment memory pointer for alloced memory.
-    void* pClientMem = VoidPtrAlign(VoidPtrInc(pMem, m_markerSizeBytes), align);
+    void* pClientMem = VoidPtrAlign(VoidPtrInc(pMem, m_markerSizeBytes + sizeof(MemTrackerElem)), align);
+
+    MemTrackerElem*const pNewElement = GetElement(pClientMem);
 
-    uint32* pUnderrun = static_cast<uint32*>(Util::VoidPtrDec(pClientMem, m_markerSizeBytes));
-    uint32* pOverrun  = static_cast<uint32*>(Util::VoidPtrInc(pClientMem, Pow2Align(bytes, sizeof(uint32))));
+    const size_t allocNum = m_nextAllocNum.fetch_add(1, std::memory_order_relaxed);
 
-    // Mark the memory with the underrun/overrun marker.
-    for (uint32 markerUints = 0; markerUints < m_markerSizeUints; ++markerUints)
+    // Trigger an assert if we're about to allocate the break-on-allocation number.
+    if (allocNum == m_breakOnAllocNum)
     {
-        *pUnderrun++ = UnderrunSentinel;
-        *pOverrun++  = OverrunSentinel;
+        PAL_ASSERT_ALWAYS();
     }
 
-    MemTrackerElem*const pNewElement = static_cast<MemTrackerElem*>(malloc(sizeof(MemTrackerElem)));
+    const bool hasSentinels = ((allocNum % PAL_MEMTRACK_SENTINEL_SAMPLE_RATE) == 0);
 
-    if (pNewElement != nullptr)
+    if (hasSentinels)
     {
-        pNewElement->size       = bytes;
-        pNewElement->pFilename  = pFilename;
-        pNewElement->lineNumber = lineNumber;
-        pNewElement->blockType  = blockType;
-        pNewElement->pClientMem = pClientMem;
-        pNewElement->pOrigMem   = pMem;
+        uint32* pUnderrun = static_cast<uint32*>(VoidPtrDec(pClientMem, m_markerSizeBytes));
+        uint32* pOverrun  = static_cast<uint32*>(VoidPtrInc(pClientMem, Pow2Align(allocInfo.bytes, sizeof(uint32))));
 
-        MutexAuto lock(&m_mutex);
-
-        // Trigger an assert if we're about to allocate the break-on-allocation number.
-        if (m_nextAllocNum == m_breakOnAllocNum)
+        // Mark the memory with the underrun/overrun marker.
+        for (uint32 markerUints = 0; markerUints < m_markerSizeUints; ++markerUints)
         {
-            PAL_ASSERT_ALWAYS();
+            *pUnderrun++ = UnderrunSentinel;
+            *pOverrun++  = OverrunSentinel;
         }
+    }
 
-        pNewElement->allocNum = m_nextAllocNum;
-        ++m_nextAllocNum;
+    pNewElement->size         = allocInfo.bytes;
+    pNewElement->pFilename    = allocInfo.pFilename;
+    pNewElement->pOrigMem     = pMem;
+    pNewElement->allocNum     = allocNum;
+    pNewElement->lineNumber   = allocInfo.lineNumber;
+    pNewElement->blockType    = allocInfo.blockType;
+    pNewElement->allocType    = allocInfo.allocType;
+    pNewElement->hasSentinels = hasSentinels;
+    pNewElement->cookie       = LiveCookie;
 
-        pNewElement->pNext     = m_pMemListHead->pNext;
-        pNewElement->pNextNext = m_pMemListHead->pNextNext;
+    Shard*const          pShard = &m_shards[HashPointer(pClientMem) >> 60];
+    MemTrackerElem*const pHead  = &pShard->head;
 
-        m_pMemListHead->pNextNext = m_pMemListHead->pNext;
-        m_pMemListHead->pNext     = pNewElement;
+    MutexAuto lock(&pShard->mutex);
 
-        // Sanity check to make sure we've updated both pointers properly.
-        PAL_ASSERT(m_pMemListHead->pNextNext != m_pMemListHead->pNext);
+    if (InsertLive(pShard, pClientMem))
+    {
+        pNewElement->pNext   = pHead->pNext;
+        pNewElement->pPrev   = pHead;
+        pHead->pNext->pPrev  = pNewElement;
+        pHead->pNext         = pNewElement;
+    }
+    else
+    {
+        // The allocation can't be tracked, so fail it rather than reporting a bogus invalid free later.
+        pClientMem = nullptr;
     }
 
     return pClientMem;
@@ -166,83 +347,65 @@ void* MemTracker<Allocator>::RemoveMemElement(
     void*       pClientMem,  // Pointer to client usable memory.
     MemBlkType  blockType)   // Block type based on calling deallocation routine.
 {
-    bool  badFree  = false;
-    void* pOrigPtr = nullptr;
-
-    m_mutex.Lock();
+    void*           pOrigPtr = nullptr;
+    MemTrackerElem* pCurrent = nullptr;
+    Shard*const     pShard   = &m_shards[HashPointer(pClientMem) >> 60];
 
-    MemTrackerElem* pCurrent  = m_pMemListHead->pNext;
-    MemTrackerElem* pCurNext  = m_pMemListHead->pNextNext;
-    MemTrackerElem* pPrevious = m_pMemListHead;
-    MemTrackerElem* pPrevPrev = nullptr;
-
-    while ((pCurrent != nullptr) && (pCurrent->pClientMem != pClientMem))
     {
-        // We will hit this assert if someone has corrupted the current tracker's pNext.
-        // That probably means that someone is writing into random heap memory they don't own.
-        PAL_ASSERT(pCurNext == pCurrent->pNext);
-
-        pPrevPrev = pPrevious;
-        pPrevious = pCurrent;
-        pCurNext  = pCurrent->pNextNext;
-        pCurrent  = pCurrent->pNext;
-    }
+        MutexAuto lock(&pShard->mutex);
 
-    // We should not be trying to free something twice or trying to free something which has not been allocated.  The
-    // assert will catch the invalid free. Current equals previous only for empty lists.
+        // We should not be trying to free something twice or trying to free something which has not been allocated.
+        // Only pointers found in the live set are known to have a tracking element in front of them.
+        const uint32 slot = FindLive(*pShard, pClientMem);
 
-    if (pCurrent == nullptr)
-    {
-        // A free was attempted on an unrecognized pointer.
-        PAL_DPERROR("Invalid Free Attempted with ptr = : (%#x)", pClientMem);
-        badFree = true;
-    }
-    else if (pCurrent->blockType != blockType)
-    {
-        // We have a mismatch in the alloc/free pair, e.g. PAL_NEW with PAL_FREE etc.  return early here without freeing
-        // the memory so it shows up as a leak.
-        PAL_DPERROR("Trying to Free %s as %s.",
-                  MemBlkTypeStr[static_cast<uint32>(pCurrent->blockType)],
-                  MemBlkTypeStr[static_cast<uint32>(blockType)]);
-        badFree = true;
-    }
-    else
-    {
-        // Update the linked list to no longer contain the element we are removing.
-        if (pPrevPrev != nullptr)
+        if (slot == pShard->liveSetCapacity)
         {
-            pPrevPrev->pNextNext = pCurrent->pNext;
-
-            // Sanity check to make sure we've updated both pointers properly.
-            PAL_ASSERT((pPrevPrev->pNextNext == nullptr) || (pPrevPrev->pNextNext != pPrevPrev->pNext));
+            // A free was attempted on an unrecognized pointer.
+            PAL_DPERROR("Invalid Free Attempted with ptr = : (%#x)", pClientMem);
+        }
+        else if (GetElement(pClientMem)->blockType != blockType)
+        {
+            // We have a mismatch in the alloc/free pair, e.g. PAL_NEW with PAL_FREE etc.  return early here without
+            // freeing the memory so it shows up as a leak.
+            PAL_DPERROR("Trying to Free %s as %s.",
+                      MemBlkTypeStr[static_cast<uint32>(GetElement(pClientMem)->blockType)],
+                      MemBlkTypeStr[static_cast<uint32>(blockType)]);
         }
+        else
+        {
+            pCurrent = GetElement(pClientMem);
 
-        pPrevious->pNextNext = pCurrent->pNextNext;
-        pPrevious->pNext     = pCurrent->pNext;
-        pOrigPtr             = pCurrent->pOrigMem;
+            // We will hit these asserts if someone has corrupted this element or the neighboring trackers.  That
+            // probably means that someone is writing into random heap memory they don't own.
+            PAL_ASSERT(pCurrent->cookie == LiveCookie);
+            PAL_ASSERT((pCurrent->pPrev->pNext == pCurrent) && (pCurrent->pNext->pPrev == pCurrent));
 
-        // Sanity check to make sure we've updated both pointers properly.
-        PAL_ASSERT((pPrevious->pNextNext == nullptr) || (pPrevious->pNextNext != pPrevious->pNext));
-    }
+            // Update the linked list to no longer contain the element we are removing.
+            pCurrent->pPrev->pNext = pCurrent->pNext;
+            pCurrent->pNext->pPrev = pCurrent->pPrev;
+            pCurrent->cookie       = FreedCookie;
 
-    m_mutex.Unlock();
+            RemoveLive(pShard, slot);
+        }
+    }
 
-    if (badFree == false)
+    if (pCurrent != nullptr)
     {
-        // We can check for memory corruption at top and bottom since the element was found in our free list.
-
-        uint32* pUnderrun = static_cast<uint32*>(Util::VoidPtrDec(pClientMem, m_markerSizeBytes));
-        uint32* pOverrun  = static_cast<uint32*>
-                            (Util::VoidPtrInc(pClientMem, Pow2Align(pCurrent->size, sizeof(uint32))));
-
-        for (uint32 markerUints = 0; markerUints < m_markerSizeUints; ++markerUints)
+        if (pCurrent->hasSentinels != 0)
         {
-            PAL_ASSERT(*pUnderrun++ == UnderrunSentinel);
-            PAL_ASSERT(*pOverrun++  == OverrunSentinel);
+            // We can check for memory corruption at top and bottom since the markers were written for this element.
+            const uint32* pUnderrun = static_cast<uint32*>(VoidPtrDec(pClientMem, m_markerSizeBytes));
+            const uint32* pOverrun  = static_cast<uint32*>
+                                      (VoidPtrInc(pClientMem, Pow2Align(pCurrent->size, sizeof(uint32))));
+
+            for (uint32 markerUints = 0; markerUints < m_markerSizeUints; ++markerUints)
+            {
+                PAL_ASSERT(*pUnderrun++ == UnderrunSentinel);
+                PAL_ASSERT(*pOverrun++  == OverrunSentinel);
+            }
         }
 
-        // Free the current memory element
-        free(pCurrent);
+        pOrigPtr = pCurrent->pOrigMem;
     }
 
     // Return a pointer to the actual allocated block.
@@ -260,35 +423,38 @@ void* MemTracker<Allocator>::Alloc(
 
     void* pMem = nullptr;
 
-    size_t paddedSizeBytes = allocInfo.bytes;
+    // The tracking element lives directly in front of the underrun marker, so the client memory must be at least as
+    // aligned as the element.
+    const size_t align = Max(allocInfo.alignment, alignof(MemTrackerElem));
 
-    // Allocate two "m_markerSizeBytes" elements to detect over/under runs of the memory range.  The overrun marker will
+    // Allocate space for the tracking element and two "m_markerSizeBytes" elements to detect over/under runs of the
+    // memory range.  The marker space is reserved even if this allocation isn't sampled.  The overrun marker will
     // actually start at the next aligned point after the allocation.  We need to allocate additional space to re-align
     // returned start pointer so that the address immediately following the underrun marker is properly aligned.
-    if (m_markerSizeBytes != 0)
-    {
-        paddedSizeBytes  = Pow2Align(paddedSizeBytes, sizeof(uint32));
-        paddedSizeBytes += m_markerSizeBytes * 2;
-        paddedSizeBytes += allocInfo.alignment;
-    }
+    size_t paddedSizeBytes = Pow2Align(allocInfo.bytes, sizeof(uint32));
+    paddedSizeBytes += sizeof(MemTrackerElem);
+    paddedSizeBytes += m_markerSizeBytes * 2;
+    paddedSizeBytes += align;
 
     AllocInfo memTrackerInfo(allocInfo);
     memTrackerInfo.bytes = paddedSizeBytes;
 
     pMem = m_pAllocator->Alloc(memTrackerInfo);
 
+    void* pClientMem = nullptr;
+
     if (pMem != nullptr)
     {
         // Don't bother adding a failed allocation to the Memtrack list.
-        pMem = AddMemElement(pMem,
-                             allocInfo.bytes,
-                             allocInfo.alignment,
-                             allocInfo.blockType,
-                             allocInfo.pFilename,
-                             allocInfo.lineNumber);
+        pClientMem = AddMemElement(pMem, allocInfo, align);
+
+        if (pClientMem == nullptr)
+        {
+            m_pAllocator->Free(FreeInfo(pMem, allocInfo.blockType));
+        }
     }
 
-    return pMem;
+    return pClientMem;
 }
 
 // =====================================================================================================================
@@ -318,35 +484,128 @@ void MemTracker<Allocator>::Free(
 template <typename Allocator>
 void MemTracker<Allocator>::FreeLeakedMemory()
 {
-    const MemTrackerElem* pCurrent = m_pMemListHead->pNext;
+    for (uint32 i = 0; i < NumShards; ++i)
+    {
+        const MemTrackerElem*const pHead = &m_shards[i].head;
+
+        while (pHead->pNext != pHead)
+        {
+            const MemTrackerElem*const pCurrent = pHead->pNext;
+
+            // Free will release the memory for tracking and the actual element.
+            Free(FreeInfo(VoidPtrInc(const_cast<MemTrackerElem*>(pCurrent), sizeof(MemTrackerElem) + m_markerSizeBytes),
+                          pCurrent->blockType));
+        }
+    }
+}
+
+// =====================================================================================================================
+// Groups the live allocations by file, line and allocation type.  The caller's array is used as an open-addressed hash
+// table while the shards are walked and is compacted before returning.
+template <typename Allocator>
+Result MemTracker<Allocator>::TakeSnapshot(
+    MemTrackerSnapshotEntry* pEntries,
+    uint32*                  pNumEntries)
+{
+    Result result = Result::Success;
 
-    while (pCurrent != nullptr)
+    if ((pEntries == nullptr) || (pNumEntries == nullptr))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
     {
-        // Free will release the memory for tracking and the actual element.
-        Free(FreeInfo(pCurrent->pClientMem, pCurrent->blockType));
-        pCurrent = m_pMemListHead->pNext;
+        const uint32 capacity = *pNumEntries;
+
+        memset(pEntries, 0, sizeof(MemTrackerSnapshotEntry) * capacity);
+
+        for (uint32 i = 0; i < NumShards; ++i)
+        {
+            MutexAuto lock(&m_shards[i].mutex);
+
+            const MemTrackerElem*const pHead = &m_shards[i].head;
+
+            for (const MemTrackerElem* pCurrent = pHead->pNext; pCurrent != pHead; pCurrent = pCurrent->pNext)
+            {
+                // Call sites are identified by the address of their filename string rather than its contents.
+                const uint64 hash = ((reinterpret_cast<uintptr_t>(pCurrent->pFilename) * 0x9E3779B97F4A7C15ull) ^
+                                     (uint64(pCurrent->lineNumber) << 8)                                        ^
+                                     uint64(pCurrent->allocType));
+
+                bool found = false;
+
+                for (uint32 probe = 0; (probe < capacity) && (found == false); ++probe)
+                {
+                    MemTrackerSnapshotEntry*const pEntry = &pEntries[(hash + probe) % capacity];
+
+                    if (pEntry->numAllocs == 0)
+                    {
+                        pEntry->pFilename  = pCurrent->pFilename;
+                        pEntry->lineNumber = pCurrent->lineNumber;
+                        pEntry->allocType  = pCurrent->allocType;
+                        found              = true;
+                    }
+                    else
+                    {
+                        found = ((pEntry->pFilename  == pCurrent->pFilename)  &&
+                                 (pEntry->lineNumber == pCurrent->lineNumber) &&
+                                 (pEntry->allocType  == pCurrent->allocType));
+                    }
+
+                    if (found)
+                    {
+                        pEntry->numAllocs++;
+                        pEntry->totalBytes += pCurrent->size;
+                    }
+                }
+
+                if (found == false)
+                {
+                    result = Result::ErrorIncompleteResults;
+                }
+            }
+        }
+
+        // Compact the used entries to the front of the array.
+        uint32 numEntries = 0;
+
+        for (uint32 i = 0; i < capacity; ++i)
+        {
+            if (pEntries[i].numAllocs != 0)
+            {
+                pEntries[numEntries++] = pEntries[i];
+            }
+        }
+
+        *pNumEntries = numEntries;
     }
+
+    return result;
 }
 
 // =====================================================================================================================
-// Outputs information about leaked memory by traversing the memory tracker list.
+// Outputs information about leaked memory by traversing the memory tracker lists.
 template <typename Allocator>
 void MemTracker<Allocator>::MemoryReport()
 {
-    const MemTrackerElem* pCurrent = m_pMemListHead;
-
     PAL_DPWARN("================ List of Leaked Blocks ================");
 
-    while (pCurrent->pNext != nullptr)
+    for (uint32 i = 0; i < NumShards; ++i)
     {
-        pCurrent = pCurrent->pNext;
-        PAL_DPWARN("ClientMem = 0x%p, AllocSize = %8d, MemBlkType = %s, File = %-15s, LineNumber = %8d, AllocNum = %8d",
-                   pCurrent->pClientMem,
-                   pCurrent->size,
-                   MemBlkTypeStr[static_cast<uint32>(pCurrent->blockType)],
-                   pCurrent->pFilename,
-                   pCurrent->lineNumber,
-                   pCurrent->allocNum);
+        MutexAuto lock(&m_shards[i].mutex);
+
+        const MemTrackerElem*const pHead = &m_shards[i].head;
+
+        for (const MemTrackerElem* pCurrent = pHead->pNext; pCurrent != pHead; pCurrent = pCurrent->pNext)
+        {
+            PAL_DPWARN("ClientMem = 0x%p, AllocSize = %8d, MemBlkType = %s, File = %-15s, LineNumber = %8d, AllocNum = %8d",
+                       VoidPtrInc(pCurrent, sizeof(MemTrackerElem) + m_markerSizeBytes),
+                       pCurrent->size,
+                       MemBlkTypeStr[static_cast<uint32>(pCurrent->blockType)],
+                       pCurrent->pFilename,
+                       pCurrent->lineNumber,
+                       pCurrent->allocNum);
+        }
     }
 
     PAL_DPWARN("================ End of List ===========================");
@@ -299,6 +299,15 @@ extern uint32 AtomicDecrement(volatile uint32* pValue);
 /// @returns Previous value at *pTarget.
 extern uint32 AtomicCompareAndSwap(volatile uint32* pTarget, uint32 oldValue, uint32 newValue);
 
+/// Performs an atomic compare and swap operation on two 64-bit unsigned integers.  @see AtomicCompareAndSwap.
+///
+/// @param [in,out] pTarget  Pointer to the destination value of the operation.
+/// @param [in]     oldValue Value to compare *pTarget to.
+/// @param [in]     newValue Value to replace *pTarget with if *pTarget matches oldValue.
+///
+/// @returns Previous value at *pTarget.
+extern uint64 AtomicCompareAndSwap64(volatile uint64* pTarget, uint64 oldValue, uint64 newValue);
+
 /// Atomically exchanges a pair of 32-bit unsigned integers.
 ///
 /// @param [in,out] pTarget Pointer to the destination value of the operation.
@@ -32,8 +32,9 @@
 #pragma once
 
 #include "palFile.h"
+#include "palHashMap.h"
 #include "palInlineFuncs.h"
-#include "palList.h"
+#include "palVector.h"
 
 namespace Util
 {
@@ -50,7 +51,9 @@ namespace Util
  *        ; The following settings are pre-hashed.
  *        #0x9370a0c8, AnotherStringValue
  *
- *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.
+ *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.  The
+ *        file is parsed once into a hash table keyed by the setting name hash, so each lookup costs O(1) regardless of
+ *        how many settings the file contains.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -64,14 +67,18 @@ public:
     SettingsFileMgr(const char* pSettingsFileName, Allocator*const pAllocator)
         :
         m_pSettingsFileName(pSettingsFileName),
-        m_settingsList(pAllocator)
+        m_valueStrings(pAllocator),
+        m_settingsMap(NumBuckets, pAllocator),
+        m_isLoaded(false)
     {
     }
 
     /// Destroys the object and closes the associated file if it is still open.
     ~SettingsFileMgr();
 
-    /// Initializes the settings file manager.  Must be called before calling any other functions on this object.
+    /// Initializes the settings file manager.  Must be called before calling any other functions on this object.  If
+    /// no settings file is found at pSettingsPath, this may be called again with another path; once a file has been
+    /// loaded further calls do nothing.
     ///
     /// @param [in] pSettingsPath The path to to the settings file.
     ///
@@ -108,18 +115,21 @@ public:
     bool GetValueByHash(uint32 hashedName, ValueType type, void* pValue, size_t bufferSz = 0) const;
 
 private:
-    // Describes a single { setting, value } pair as loaded from a settings file.
-    struct SettingValuePair
-    {
-        uint32 hashName;      // 32-bit hash of the setting name string.
-        char   strValue[512];  // Value for this setting encoded as a C-stlye string.
-    };
+    Result LoadFile(const char* pSettingsPath);
+
+    // Number of hash buckets: enough for a few hundred settings before any bucket needs a second group.
+    static constexpr uint32 NumBuckets = 32;
 
     const char*const m_pSettingsFileName;
     File             m_settingsFile;
 
-    // List of setting, value pairs parsed from the config file.
-    List<SettingValuePair, Allocator> m_settingsList;
+    // Values of all settings parsed from the config file, stored back-to-back as C-style strings.
+    Vector<char, 256, Allocator> m_valueStrings;
+
+    // Maps each setting name hash to the offset of its value in m_valueStrings.
+    HashMap<uint32, uint32, Allocator, JenkinsHashFunc> m_settingsMap;
+
+    bool m_isLoaded; // True once a settings file has been parsed.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(SettingsFileMgr);
 };
@@ -27,7 +27,8 @@
 
 #include "palSettingsFileMgr.h"
 #include "palDbgPrint.h"
-#include "palListImpl.h"
+#include "palHashMapImpl.h"
+#include "palVectorImpl.h"
 #include <string.h>
 #include <ctype.h>
 
@@ -38,13 +39,6 @@ namespace Util
 template <typename Allocator>
 SettingsFileMgr<Allocator>::~SettingsFileMgr()
 {
-    // Clean up the settings list
-    auto i = m_settingsList.Begin();
-    while (i.Get() != nullptr)
-    {
-        m_settingsList.Erase(&i);
-    }
-    PAL_ASSERT(m_settingsList.NumElements() == 0);
 }
 
 // =====================================================================================================================
@@ -52,6 +46,16 @@ SettingsFileMgr<Allocator>::~SettingsFileMgr()
 template <typename Allocator>
 Result SettingsFileMgr<Allocator>::Init(
     const char* pSettingsPath)
+{
+    // The settings file only needs to be parsed once.
+    return m_isLoaded ? Result::Success : LoadFile(pSettingsPath);
+}
+
+// =====================================================================================================================
+// Opens the settings file in the given directory and parses all of its settings into the hash table.
+template <typename Allocator>
+Result SettingsFileMgr<Allocator>::LoadFile(
+    const char* pSettingsPath)
 {
     Result ret = Result::Success;
 
@@ -91,6 +95,13 @@ Result SettingsFileMgr<Allocator>::Init(
 
     if (ret == Result::Success)
     {
+        ret = m_settingsMap.Init();
+    }
+
+    if (ret == Result::Success)
+    {
+        m_isLoaded = true;
+
         // Read the settings file one line at a time
         char currLine[256];
         size_t lineLength = 0;
@@ -149,12 +160,30 @@ Result SettingsFileMgr<Allocator>::Init(
                             pToken++;
                         }
 
-                        if (strlen(pToken) > 0)
+                        const uint32 valueLength = static_cast<uint32>(strlen(pToken));
+
+                        if (valueLength > 0)
                         {
-                            SettingValuePair pair = { hashedName, {0} };
-                            PAL_ASSERT(strlen(pToken) < sizeof(pair.strValue));
-                            strncpy(&pair.strValue[0], pToken, sizeof(pair.strValue));
-                            m_settingsList.PushBack(pair);
+                            bool    existed = false;
+                            uint32* pOffset = nullptr;
+                            Result  result  = m_settingsMap.FindAllocate(hashedName, &existed, &pOffset);
+
+                            // If a setting is listed more than once, the first value wins.
+                            if ((result == Result::Success) && (existed == false))
+                            {
+                                (*pOffset) = m_valueStrings.NumElements();
+
+                                for (uint32 i = 0; (result == Result::Success) && (i <= valueLength); ++i)
+                                {
+                                    result = m_valueStrings.PushBack(pToken[i]);
+                                }
+                            }
+
+                            if (result != Result::Success)
+                            {
+                                ret        = result;
+                                readResult = result;
+                            }
                         }
                     }
                 }
@@ -204,18 +233,9 @@ bool SettingsFileMgr<Allocator>::GetValueByHash(
 {
     bool foundValue = false;
 
-    // Get the value from the list
-    auto iterator = m_settingsList.Begin();
-    const char* pSettingValue = nullptr;
-    while(iterator.Get() != nullptr)
-    {
-        if (iterator.Get()->hashName == hashedName)
-        {
-            pSettingValue = &iterator.Get()->strValue[0];
-            break;
-        }
-        iterator.Next();
-    }
+    // The hash table is only allocated once a settings file has been found.
+    const uint32*const pOffset       = m_isLoaded ? m_settingsMap.FindKey(hashedName) : nullptr;
+    const char*const   pSettingValue = (pOffset != nullptr) ? (m_valueStrings.Data() + (*pOffset)) : nullptr;
 
     if(pSettingValue != nullptr)
     {
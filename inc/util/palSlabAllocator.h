@@ -0,0 +1,102 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palSlabAllocator.h
+ * @brief PAL utility collection SlabAllocator namespace declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palSysMemory.h"
+
+namespace Util
+{
+
+/// Namespace containing a process-wide, size-class based slab allocator which can be used as PAL's allocation
+/// callbacks.
+///
+/// Small allocations are rounded up to one of a fixed set of size classes and carved out of 64KB slabs. Each thread
+/// keeps a small cache ("magazine") of free objects per size class so that most allocations and frees don't take any
+/// locks. Slabs are owned by one of several arenas, one per @ref SystemAllocType category, so that short-lived
+/// temporary allocations don't fragment the slabs used by long-lived objects. Empty slabs are returned to the OS in
+/// bulk. Large or over-aligned allocations, and small ones which the slab heap can't satisfy, are forwarded to the C
+/// runtime.
+///
+/// PAL installs these callbacks by default when built with PAL_BUILD_SLAB_ALLOCATOR and the client doesn't specify
+/// its own allocation callbacks.
+namespace SlabAllocator
+{
+
+/// Allocation statistics for one @ref SystemAllocType category.
+///
+/// Each thread batches its counters and publishes them to the arena whenever it touches the arena, so the values may
+/// lag slightly behind the true state of the allocator.
+struct Stats
+{
+    uint64 liveBytes;       ///< Bytes currently allocated by the client, rounded up to their size class.
+    uint64 peakLiveBytes;   ///< Highest liveBytes value observed so far.
+    uint64 numAllocs;       ///< Total number of successful allocations.
+    uint64 numFrees;        ///< Total number of frees.
+    uint64 committedBytes;  ///< Slab memory currently backed by the OS, including free objects and headers.
+    double allocsPerSecond; ///< Average allocation rate since the previous QueryStats() call for this category, or
+                            ///  since the allocator was created for the first call.
+};
+
+/// Allocates system memory.
+///
+/// @param [in] size      Size of the allocation in bytes.
+/// @param [in] alignment Required alignment of the allocation in bytes; must be a power of two.
+/// @param [in] allocType Category of the allocation, used to choose the arena and to account for the allocation.
+///
+/// @returns Pointer to the allocation, or nullptr if out of memory.
+extern void* Alloc(size_t size, size_t alignment, SystemAllocType allocType);
+
+/// Frees memory previously returned by Alloc(). Does nothing if pMem is null.
+///
+/// @param [in] pMem Memory to free.
+extern void Free(void* pMem);
+
+/// Returns every object in the calling thread's cache to the arenas. Long-lived threads which are about to go idle may
+/// call this to make their cached objects available to other threads; it's done automatically when a thread exits.
+extern void FlushThreadCache();
+
+/// Returns the memory of all empty slabs to the OS. The slabs' address space is kept for later reuse.
+extern void Trim();
+
+/// Queries the statistics of one allocation category.
+///
+/// @param [in]  allocType Category to query. All client-defined categories are reported together.
+/// @param [out] pStats    Filled with the category's statistics.
+extern void QueryStats(SystemAllocType allocType, Stats* pStats);
+
+/// Fills out a set of allocation callbacks which forward to this allocator.
+///
+/// @param [out] pAllocCb Callbacks to initialize.
+extern void InitAllocCallbacks(AllocCallbacks* pAllocCb);
+
+} // SlabAllocator
+} // Util
@@ -542,6 +542,8 @@ constexpr Result CollapseResults(Result lhs, Result rhs)
  * - HashSet: Fast set implementation.  Note the similar restrictions to HashMap.
  * - IntervalTree: [Interval tree](http://en.wikipedia.org/wiki/Interval_tree) implementation.
  * - RingBuffer: A ringed buffer of variable length and size.
+ * - SpscQueue, MpscQueue and IntrusiveMpscQueue: Lock-free queues for handing work between threads, with batch
+ *   operations and blocking waits.
  *
  * ### Multithreading and Synchronization
  * Util includes a number of OS-abstracted multithreading and CPU synchronization constructs:
@@ -551,6 +553,7 @@ constexpr Result CollapseResults(Result lhs, Result rhs)
  * - Semaphore
  * - ConditionVariable
  * - Event
+ * - EventCount
  *
  * ### Files
  * The File class provides an OS-abstracted interface for opening files and reading/writing data in those files.
@@ -29,6 +29,7 @@
 #include "core/platform.h"
 #include "core/queue.h"
 #include "palAutoBuffer.h"
+#include "palCpuProfiler.h"
 #include "palLinearAllocator.h"
 #include "palSysUtil.h"
 #include "palVectorImpl.h"
@@ -74,6 +75,16 @@ static void PAL_STDCALL CmdDrawIndexedInvalid(
     int32       vertexOffset,
     uint32      firstInstance,
     uint32      instanceCount);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+static void PAL_STDCALL CmdDrawMultiInvalid(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws);
+static void PAL_STDCALL CmdDrawIndexedMultiInvalid(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws);
+#endif
 static void PAL_STDCALL CmdDrawIndirectMultiInvalid(
     ICmdBuffer*       pCmdBuffer,
     const IGpuMemory& gpuMemory,
@@ -133,11 +144,21 @@ CmdBuffer::CmdBuffer(
     m_buildFlags.u32All = 0;
     m_flags.u32All      = 0;
 
+    const PalPlatformSettings& platformSettings = device.GetPlatform()->PlatformSettings();
+    const bool sqttEnabled = (platformSettings.gpuProfilerMode > GpuProfilerCounterAndTimingOnly) &&
+                             (TestAnyFlagSet(platformSettings.gpuProfilerConfig.traceModeMask, GpuProfilerTraceSqtt));
+    m_flags.rgpZoneMarkers = platformSettings.cpuZoneProfilingEnabled &&
+                             (sqttEnabled || device.GetPlatform()->IsDevDriverProfilingEnabled());
+
     // Initialize all draw/dispatch funcs to invalid stubs.  HWIP command buffer classes that support these interfaces
     // will overwrite the function pointers.
     m_funcTable.pfnCmdDraw                      = CmdDrawInvalid;
     m_funcTable.pfnCmdDrawOpaque                = CmdDrawOpaqueInvalid;
     m_funcTable.pfnCmdDrawIndexed               = CmdDrawIndexedInvalid;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti                 = CmdDrawMultiInvalid;
+    m_funcTable.pfnCmdDrawIndexedMulti          = CmdDrawIndexedMultiInvalid;
+#endif
     m_funcTable.pfnCmdDrawIndirectMulti         = CmdDrawIndirectMultiInvalid;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti  = CmdDrawIndexedIndirectMultiInvalid;
     m_funcTable.pfnCmdDispatch                  = CmdDispatchInvalid;
@@ -191,6 +212,8 @@ Result CmdBuffer::Init(
 Result CmdBuffer::Begin(
     const CmdBufferBuildInfo& info)
 {
+    PAL_CPU_ZONE("CmdBuffer::Begin");
+
     Result result = Result::Success;
 
     // Must have a valid command allocator specified either at creation or at reset.
@@ -335,6 +358,8 @@ void CmdBuffer::BeginExecutionMarker(
 // Completes recording of a command buffer in the building state, making it executable.
 Result CmdBuffer::End()
 {
+    PAL_CPU_ZONE("CmdBuffer::End");
+
     Result result = m_status;
 
     if (result != Result::Success)
@@ -1079,6 +1104,29 @@ static void PAL_STDCALL CmdDrawIndexedInvalid(
     PAL_NEVER_CALLED();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+// Default implementation of CmdDrawMulti is unimplemented, derived CmdBuffer classes should override it if supported.
+static void PAL_STDCALL CmdDrawMultiInvalid(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    PAL_NEVER_CALLED();
+}
+
+// =====================================================================================================================
+// Default implementation of CmdDrawIndexedMulti is unimplemented, derived CmdBuffer classes should override it if
+// supported.
+static void PAL_STDCALL CmdDrawIndexedMultiInvalid(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    PAL_NEVER_CALLED();
+}
+#endif
+
 // =====================================================================================================================
 // Default implementation of CmdDrawIndirectMulti is unimplemented, derived CmdBuffer classes should override it if
 // supported.
@@ -1265,4 +1313,65 @@ void CmdBuffer::SetCmdRecordingError(
     }
 }
 
+// RGP user-event marker header, as consumed by CmdInsertRgpTraceMarker. Push markers are followed by the length of
+// their name in bytes and the name itself padded to whole dwords; pop markers are only the header.
+union RgpUserEventMarker
+{
+    struct
+    {
+        uint32 identifier : 4;  // Always RgpUserEventIdentifier.
+        uint32 extDwords  : 8;  // Unused by user events.
+        uint32 dataType   : 8;  // One of the RgpUserEvent* types below.
+        uint32 reserved   : 12;
+    };
+
+    uint32 u32All;
+};
+
+constexpr uint32 RgpUserEventIdentifier = 5;
+constexpr uint32 RgpUserEventPop        = 1;
+constexpr uint32 RgpUserEventPush       = 2;
+constexpr uint32 RgpMaxZoneNameDwords   = 16; // Longer zone names are truncated in the marker.
+constexpr uint32 RgpMaxZoneNameBytes    = RgpMaxZoneNameDwords * sizeof(uint32);
+
+// =====================================================================================================================
+CmdBufferZone::CmdBufferZone(
+    CmdBuffer*  pCmdBuffer,
+    const char* pName)
+    :
+    m_zone(pName),
+    m_pCmdBuffer((pCmdBuffer->RgpZoneMarkersEnabled() && Util::CpuProfiler::IsEnabled()) ? pCmdBuffer : nullptr)
+{
+    if (m_pCmdBuffer != nullptr)
+    {
+        const uint32 nameLength = Min(static_cast<uint32>(strlen(pName)), RgpMaxZoneNameBytes);
+        const uint32 nameDwords = NumBytesToNumDwords(nameLength);
+
+        uint32 marker[2 + RgpMaxZoneNameDwords] = {};
+
+        RgpUserEventMarker header = {};
+        header.identifier = RgpUserEventIdentifier;
+        header.dataType   = RgpUserEventPush;
+
+        marker[0] = header.u32All;
+        marker[1] = nameLength;
+        memcpy(&marker[2], pName, nameLength);
+
+        m_pCmdBuffer->CmdInsertRgpTraceMarker(2 + nameDwords, &marker[0]);
+    }
+}
+
+// =====================================================================================================================
+CmdBufferZone::~CmdBufferZone()
+{
+    if (m_pCmdBuffer != nullptr)
+    {
+        RgpUserEventMarker header = {};
+        header.identifier = RgpUserEventIdentifier;
+        header.dataType   = RgpUserEventPop;
+
+        m_pCmdBuffer->CmdInsertRgpTraceMarker(1, &header.u32All);
+    }
+}
+
 } // Pal
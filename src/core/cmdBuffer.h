@@ -31,6 +31,7 @@
 #include "core/gpuEvent.h"
 #include "palAssert.h"
 #include "palCmdBuffer.h"
+#include "palCpuProfiler.h"
 #include "palFile.h"
 #include "palVector.h"
 
@@ -644,6 +645,14 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override { PAL_NEVER_CALLED(); }
 
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) override { PAL_NEVER_CALLED(); }
+
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override { PAL_NEVER_CALLED(); }
+
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override { PAL_NEVER_CALLED(); }
 
@@ -797,6 +806,9 @@ public:
     bool HasHybridPipeline() const { return (m_flags.hasHybridPipeline == 1); }
     void ReportHybridPipelineBind() { m_flags.hasHybridPipeline = 1; }
 
+    // CPU profiling zones only bracket their commands with RGP user markers when the command buffer is being traced.
+    bool RgpZoneMarkersEnabled() const { return (m_flags.rgpZoneMarkers == 1); }
+
 protected:
     CmdBuffer(const Device&              device,
               const CmdBufferCreateInfo& createInfo);
@@ -928,7 +940,8 @@ protected:
         {
             uint32 internalMemAllocator  : 1;  // True if m_pMemAllocator is owned internally by PAL.
             uint32 hasHybridPipeline     : 1;  // True if this command buffer has a hybrid pipeline bound.
-            uint32 reserved              : 30;
+            uint32 rgpZoneMarkers        : 1;  // True if CPU profiling zones should also emit RGP user markers.
+            uint32 reserved              : 29;
         };
 
         uint32     u32All;
@@ -966,4 +979,29 @@ private:
     PAL_DISALLOW_DEFAULT_CTOR(CmdBuffer);
 };
 
+// =====================================================================================================================
+// Records a CPU profiling zone for a command buffer call. If the command buffer is being traced by RGP the commands the
+// call records are also bracketed by a user-event push/pop marker carrying the zone's name, so the CPU zone can be
+// matched with the GPU work it produced.
+class CmdBufferZone
+{
+public:
+    CmdBufferZone(CmdBuffer* pCmdBuffer, const char* pName);
+    ~CmdBufferZone();
+
+private:
+    Util::CpuProfiler::Zone m_zone;
+    CmdBuffer*const         m_pCmdBuffer; // Null if no RGP marker was pushed.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdBufferZone);
+    PAL_DISALLOW_DEFAULT_CTOR(CmdBufferZone);
+};
+
+#if PAL_ENABLE_CPU_ZONES
+// Records the enclosing command buffer member function as a CPU profiling zone with the given static name.
+#define PAL_CMD_BUFFER_ZONE(_name) CmdBufferZone PAL_CPU_ZONE_CONCAT(_palCmdBufferZone, __LINE__)(this, _name)
+#else
+#define PAL_CMD_BUFFER_ZONE(_name) static_cast<void>(0)
+#endif
+
 } // Pal
@@ -65,6 +65,7 @@ CmdStream::CmdStream(
     m_chunkDwordsAvailable(0),
     m_pReserveBuffer(nullptr),
     m_nestedChunks(32, pDevice->GetPlatform()),
+    m_patchLocations(pDevice->GetPlatform()),
     m_status(Result::Success),
     m_totalChunkDwords(0)
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -420,6 +421,7 @@ void CmdStream::Reset(
     }
 
     ResetNestedChunks();
+    m_patchLocations.Clear();
 
     if (returnGpuMemory)
     {
@@ -553,6 +555,79 @@ void CmdStream::Call(
     }
 }
 
+// =====================================================================================================================
+// Records that the argument at pCmdAddr, which must have just been written to the tail chunk, belongs to a command
+// buffer template patch slot. The location is stored relative to its chunk so that it can be applied to copies.
+void CmdStream::AddPatchLocation(
+    uint32        slotId,
+    const uint32* pCmdAddr,
+    uint32        numDwords,
+    gpusize       addend)
+{
+    const CmdStreamChunk*const pChunk = m_chunkList.Back();
+    PAL_ASSERT(pChunk->ContainsAddress(pCmdAddr));
+
+    CmdPatchLocation location = {};
+    location.slotId    = slotId;
+    location.chunkIdx  = (m_chunkList.NumElements() - 1);
+    location.offset    = static_cast<uint32>(pCmdAddr - pChunk->WriteAddr());
+    location.numDwords = numDwords;
+    location.addend    = addend;
+
+    const Result result = m_patchLocations.PushBack(location);
+
+    if (result != Result::Success)
+    {
+        // Report the failure from End(); a template with a missing patch location can't be instantiated correctly.
+        m_status = result;
+    }
+}
+
+// =====================================================================================================================
+// Overwrites every patch location in the given chunk with its matching patch value. pCmdCopy must point to a copy of
+// the first copyDwords DWORDs of that chunk. Locations without a matching patch value keep their recorded contents.
+void CmdStream::ApplyPatches(
+    uint32               chunkIdx,
+    uint32*              pCmdCopy,
+    uint32               copyDwords,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches
+    ) const
+{
+    for (uint32 locIdx = 0; locIdx < m_patchLocations.NumElements(); ++locIdx)
+    {
+        const CmdPatchLocation& location = m_patchLocations.At(locIdx);
+
+        if (location.chunkIdx == chunkIdx)
+        {
+            PAL_ASSERT((location.offset + location.numDwords) <= copyDwords);
+
+            for (uint32 patchIdx = 0; patchIdx < patchCount; ++patchIdx)
+            {
+                const CmdPatchValue& patch = pPatches[patchIdx];
+
+                if (patch.slotId == location.slotId)
+                {
+                    uint32*const pDst = pCmdCopy + location.offset;
+
+                    if (location.numDwords == 2)
+                    {
+                        const gpusize gpuVirtAddr = (patch.gpuVirtAddr + location.addend);
+
+                        pDst[0] = LowPart(gpuVirtAddr);
+                        pDst[1] = HighPart(gpuVirtAddr);
+                    }
+                    else
+                    {
+                        PAL_ASSERT((location.numDwords == 1) || (location.numDwords == 3));
+                        memcpy(pDst, &patch.dispatchSize[0], (sizeof(uint32) * location.numDwords));
+                    }
+                }
+            }
+        }
+    }
+}
+
 // =====================================================================================================================
 // Increments the submission count of the first command chunk contained in this stream along with the submit counts for
 // any nested chunks referenced by this command stream.
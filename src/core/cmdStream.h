@@ -46,6 +46,7 @@ class GpuMemoryPatchList;
 class ICmdAllocator;
 class IQueue;
 class Platform;
+struct CmdPatchValue;
 enum  QueueType : uint32;
 
 // Each submit to the hardware may include additional command streams that are executed before and after the command
@@ -110,6 +111,17 @@ struct NestedChunkData
 
 };
 
+// The location of one patchable command argument recorded into a command buffer template. The location is stored as
+// a chunk index and offset so that it can be applied to any copy of the chunk's commands.
+struct CmdPatchLocation
+{
+    uint32 slotId;     // Client-chosen patch slot identifier.
+    uint32 chunkIdx;   // Index of the command chunk containing the argument.
+    uint32 offset;     // DWORD offset of the argument from the start of the chunk.
+    uint32 numDwords;  // Number of DWORDs to patch: one for scalars, two for GPU addresses, three for dispatch sizes.
+    gpusize addend;    // Added to GPU address patch values (e.g., the byte offset of an indexed draw's firstIndex).
+};
+
 // A useful shorthand for a vector list of chunks.
 typedef ChunkVector<CmdStreamChunk*, 16, Platform> ChunkRefList;
 
@@ -242,6 +254,20 @@ public:
 
     uint32 GetUsedCmdMemorySize() const;
 
+    // Command buffer templates: records the location of a patchable argument which was just written to the tail chunk
+    // and applies patch values to a copy of one of this stream's chunks.
+    void AddPatchLocation(uint32 slotId, const uint32* pCmdAddr, uint32 numDwords, gpusize addend);
+    bool HasPatchLocations() const { return (m_patchLocations.NumElements() != 0); }
+    void ApplyPatches(
+        uint32               chunkIdx,
+        uint32*              pCmdCopy,
+        uint32               copyDwords,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) const;
+
+    // Patched commands must not be elided by the PM4 optimizer, so patch slots turn it off for the rest of the stream.
+    void DisablePm4Optimizer() { m_flags.optimizeCommands = 0; }
+
 protected:
     // Internal chunk memory interface:
     // The command stream uses the alloc functions to get chunk space to store commands and embedded data. These
@@ -307,6 +333,9 @@ private:
     // Hash map of all nested command buffer chunks which were executed by this command stream via calls to Call().
     NestedChunkMap   m_nestedChunks;
 
+    // Patchable argument locations recorded by AddPatchLocation(), in recording order.
+    Util::Vector<CmdPatchLocation, 8, Platform> m_patchLocations;
+
     Result   m_status;              // To identify whether any error occurs when command stream setup.
     gpusize  m_totalChunkDwords;    // The sum of all allocated chunk space.  Before End() is called on this chunk,
                                     // this does not include the current chunk.  After End() is called, it does.
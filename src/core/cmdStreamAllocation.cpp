@@ -30,6 +30,7 @@
 #include "core/cmdBuffer.h"
 #include "palFile.h"
 #include "palIntrusiveListImpl.h"
+#include "palMemCopy.h"
 #include "palSysMemory.h"
 
 using namespace Util;
@@ -351,14 +352,15 @@ void CmdStreamChunk::FinalizeCommands()
 
     if (m_pWriteAddr != m_pCpuAddr)
     {
-        // If the data wasn't directly written to the mapped CPU pointer we need to copy them now.
-        memcpy(m_pCpuAddr, m_pWriteAddr, m_usedDataSizeDwords * sizeof(uint32));
+        // If the data wasn't directly written to the mapped CPU pointer we need to copy them now. The mapped memory is
+        // usually write-combined and won't be read back by the CPU so we use streaming stores.
+        StreamingMemCopy(m_pCpuAddr, m_pWriteAddr, m_usedDataSizeDwords * sizeof(uint32));
 
         const uint32 reservedSize = Size() - m_reservedDataOffset * sizeof(uint32);
 
         if (reservedSize > 0)
         {
-            memcpy(m_pCpuAddr + m_reservedDataOffset, m_pWriteAddr + m_reservedDataOffset, reservedSize);
+            StreamingMemCopy(m_pCpuAddr + m_reservedDataOffset, m_pWriteAddr + m_reservedDataOffset, reservedSize);
         }
     }
 }
@@ -43,6 +43,7 @@
 #include "palFormatInfo.h"
 #include "palHashMapImpl.h"
 #include "palIntrusiveListImpl.h"
+#include "palMemCopy.h"
 #include "palPipeline.h"
 #if defined(__unix__)
 #include "palSettingsFileMgrImpl.h"
@@ -231,9 +232,6 @@ Device::Device(
     m_disableSwapChainAcquireBeforeSignaling(false),
     m_localInvDropCpuWrites(false),
     m_pSettingsLoader(nullptr),
-#if defined(__unix__)
-    m_settingsMgr(SettingsFileName, pPlatform),
-#endif
     m_dmaUploadRingLock(),
     m_pDmaUploadRing(nullptr),
     m_referencedGpuMem(ReferencedMemoryMapElements, pPlatform),
@@ -447,6 +445,8 @@ Result Device::Cleanup()
 Result Device::EarlyInit(
     const HwIpLevels& ipLevels)
 {
+    StartupPhase phase(m_pPlatform, "DeviceEarlyInit", m_deviceIndex);
+
     // NOTE: The memory manager MUST be initialized before any other child object which may attempt to allocate
     // video memory!
     Result result = m_memMgr.Init();
@@ -620,6 +620,8 @@ Result Device::HwlEarlyInit()
 
     if (result == Result::Success)
     {
+        StartupPhase phase(m_pPlatform, "AddrLibInit", m_deviceIndex);
+
         if ((ChipProperties().gfxLevel < GfxIpLevel::GfxIp9) &&
             (ChipProperties().ossLevel < OssIpLevel::OssIp4))
         {
@@ -789,6 +791,8 @@ Result Device::InitSettings()
     // Make sure we only initialize settings once
     if (m_pSettingsLoader == nullptr)
     {
+        StartupPhase phase(m_pPlatform, "ReadSettings", m_deviceIndex);
+
         m_pSettingsLoader = PAL_NEW(Pal::SettingsLoader, GetPlatform(), AllocInternal)(this);
 
         if (m_pSettingsLoader == nullptr)
@@ -1236,6 +1240,8 @@ Result Device::FixupUsableGpuVirtualAddressRange(
 // =====================================================================================================================
 Result Device::CommitSettingsAndInit()
 {
+    StartupPhase phase(m_pPlatform, "CommitSettingsAndInit", m_deviceIndex);
+
     PAL_ASSERT(m_pSettingsLoader != nullptr);
     m_pSettingsLoader->FinalizeSettings();
 
@@ -1389,7 +1395,7 @@ void Device::InitPageFaultDebugSrd()
             if (m_publicSettings.zeroUnboundDescDebugSrd == true)
             {
                 // Set null srds to avoid app bugs when reading from a null descriptor table.
-                memset(pData, 0, numDebugSrds * maxSrdSize);
+                StreamingMemFill32(static_cast<uint32*>(pData), 0, (numDebugSrds * maxSrdSize) / sizeof(uint32));
             }
             else
             {
@@ -1509,6 +1515,8 @@ Result Device::Finalize(
     PAL_ASSERT(m_settingsCommitted);
 #endif
 
+    StartupPhase phase(m_pPlatform, "DeviceFinalize", m_deviceIndex);
+
     Result result = Result::Success;
 
     if (result == Result::Success)
@@ -1592,6 +1600,7 @@ Result Device::Finalize(
 
     if (result == Result::Success)
     {
+        StartupPhase enginesPhase(m_pPlatform, "CreateEngines", m_deviceIndex);
         result = CreateEngines(finalizeInfo);
     }
 
@@ -2151,6 +2160,7 @@ Result Device::GetProperties(
             pInfo->gfxipProperties.flags.timestampResetOnIdle             = gfx9Props.timestampResetOnIdle;
             pInfo->gfxipProperties.flags.supportReleaseAcquireInterface   = gfx9Props.supportReleaseAcquireInterface;
             pInfo->gfxipProperties.flags.supportSplitReleaseAcquire       = gfx9Props.supportSplitReleaseAcquire;
+            pInfo->gfxipProperties.flags.supportCmdBufferTemplates        = 1;
 
             pInfo->gfxipProperties.shaderCore.numShaderEngines     = gfx9Props.numShaderEngines;
             pInfo->gfxipProperties.shaderCore.numShaderArrays      = gfx9Props.numShaderArrays;
@@ -2415,6 +2425,8 @@ Result Device::CreateQueue(
     void*                  pPlacementAddr,
     IQueue**               ppQueue)
 {
+    StartupPhase phase(m_pPlatform, "CreateQueue", m_deviceIndex);
+
     Queue* pQueue = ConstructQueueObject(createInfo, pPlacementAddr);
 
     PAL_ASSERT(pQueue != nullptr);
@@ -4162,7 +4174,7 @@ bool Device::ReadSetting(
     ) const
 {
 #if defined(__unix__)
-    return m_settingsMgr.GetValue(pSettingName, valueType, pValue, bufferSz);
+    return m_pPlatform->GetSettingsFileMgr().GetValue(pSettingName, valueType, pValue, bufferSz);
 #else
     return false;
 #endif
@@ -41,9 +41,6 @@
 #include "palIntrusiveList.h"
 #include "palMutex.h"
 #include "palPipeline.h"
-#if defined(__unix__)
-#include "palSettingsFileMgr.h"
-#endif
 #include "palSysMemory.h"
 #include "palTextWriter.h"
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 556
@@ -1763,6 +1760,9 @@ public:
     void DeveloperCb(Developer::CallbackType type, void* pCbData) const
         { m_pPlatform->DeveloperCb(m_deviceIndex, type, pCbData); }
 
+    uint32 GetDeviceIndex() const
+        { return m_deviceIndex; }
+
     virtual bool LegacyHwsTrapHandlerPresent() const { return false; }
 
     // Determines the start (inclusive) and end (exclusive) virtual addresses for the specified virtual address range.
@@ -1982,9 +1982,6 @@ protected:
 
     virtual Result EnumPrivateScreensInfo(uint32* pNumScreens) = 0;
 
-    uint32 GetDeviceIndex() const
-        { return m_deviceIndex; }
-
     Platform*      m_pPlatform;
     InternalMemMgr m_memMgr;
 
@@ -2066,10 +2063,6 @@ protected:
     PalPublicSettings      m_publicSettings;
     SettingsLoader*        m_pSettingsLoader;
 
-#if defined(__unix__)
-    Util::SettingsFileMgr<Platform>  m_settingsMgr;
-#endif
-
     // Get*FilePath need to return a persistent storage
     char m_cacheFilePath[MaxPathStrLen];
     char m_debugFilePath[MaxPathStrLen];
@@ -81,6 +81,20 @@ void PlatformSettingsLoader::SetupDefaults()
 #endif
     memset(m_settings.eventLogFilename, 0, 512);
     strncpy(m_settings.eventLogFilename, "PalEventLog.json", 512);
+    m_settings.cpuZoneProfilingEnabled = false;
+    m_settings.cpuZoneMaxEventsPerThread = 65536;
+#if   (__unix__)
+    memset(m_settings.cpuZoneTraceDirectory, 0, 512);
+    strncpy(m_settings.cpuZoneTraceDirectory, "amdpal/", 512);
+#else
+    memset(m_settings.cpuZoneTraceDirectory, 0, 512);
+    strncpy(m_settings.cpuZoneTraceDirectory, "amdpal/", 512);
+#endif
+    m_settings.drmTraceEnabled = false;
+    memset(m_settings.drmTraceDirectory, 0, 512);
+    strncpy(m_settings.drmTraceDirectory, "/tmp/amdpal/", 512);
+    memset(m_settings.drmReplayTraceFile, 0, 512);
+    strncpy(m_settings.drmReplayTraceFile, "", 512);
 
     m_settings.debugOverlayEnabled = false;
     m_settings.debugOverlayConfig.visualConfirmEnabled = true;
@@ -195,6 +209,8 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.interfaceLoggerConfig.multithreaded = false;
     m_settings.interfaceLoggerConfig.basePreset = 0x7;
     m_settings.interfaceLoggerConfig.elevatedPreset = 0x1f;
+    m_settings.interfaceLoggerConfig.flushPolicy = InterfaceLoggerFlushEveryCall;
+    m_settings.interfaceLoggerConfig.flushThreshold = 0x100000;
 
     m_settings.numSettings = g_palPlatformNumSettings;
 }
@@ -270,6 +286,39 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.enableEventLogFile,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pCpuZoneProfilingEnabledStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.cpuZoneProfilingEnabled,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pCpuZoneMaxEventsPerThreadStr,
+                           Util::ValueType::Uint,
+                           &m_settings.cpuZoneMaxEventsPerThread,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pCpuZoneTraceDirectoryStr,
+                           Util::ValueType::Str,
+                           &m_settings.cpuZoneTraceDirectory,
+                           InternalSettingScope::PrivatePalKey,
+                           512);
+
+    pDevice->ReadSetting(pDrmTraceEnabledStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.drmTraceEnabled,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pDrmTraceDirectoryStr,
+                           Util::ValueType::Str,
+                           &m_settings.drmTraceDirectory,
+                           InternalSettingScope::PrivatePalKey,
+                           512);
+
+    pDevice->ReadSetting(pDrmReplayTraceFileStr,
+                           Util::ValueType::Str,
+                           &m_settings.drmReplayTraceFile,
+                           InternalSettingScope::PrivatePalKey,
+                           512);
+
     pDevice->ReadSetting(pDebugOverlayEnabledStr,
                            Util::ValueType::Boolean,
                            &m_settings.debugOverlayEnabled,
@@ -666,6 +715,16 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.interfaceLoggerConfig.elevatedPreset,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pInterfaceLoggerConfig_FlushPolicyStr,
+                           Util::ValueType::Uint,
+                           &m_settings.interfaceLoggerConfig.flushPolicy,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pInterfaceLoggerConfig_FlushThresholdStr,
+                           Util::ValueType::Uint,
+                           &m_settings.interfaceLoggerConfig.flushThreshold,
+                           InternalSettingScope::PrivatePalKey);
+
 }
 
 // =====================================================================================================================
@@ -752,6 +811,36 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.eventLogFilename);
     m_settingsInfoMap.Insert(3387502554, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.cpuZoneProfilingEnabled;
+    info.valueSize = sizeof(m_settings.cpuZoneProfilingEnabled);
+    m_settingsInfoMap.Insert(1658790916, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.cpuZoneMaxEventsPerThread;
+    info.valueSize = sizeof(m_settings.cpuZoneMaxEventsPerThread);
+    m_settingsInfoMap.Insert(2663550329, info);
+
+    info.type      = SettingType::String;
+    info.pValuePtr = &m_settings.cpuZoneTraceDirectory;
+    info.valueSize = sizeof(m_settings.cpuZoneTraceDirectory);
+    m_settingsInfoMap.Insert(1912592811, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.drmTraceEnabled;
+    info.valueSize = sizeof(m_settings.drmTraceEnabled);
+    m_settingsInfoMap.Insert(2160087420, info);
+
+    info.type      = SettingType::String;
+    info.pValuePtr = &m_settings.drmTraceDirectory;
+    info.valueSize = sizeof(m_settings.drmTraceDirectory);
+    m_settingsInfoMap.Insert(3310500190, info);
+
+    info.type      = SettingType::String;
+    info.pValuePtr = &m_settings.drmReplayTraceFile;
+    info.valueSize = sizeof(m_settings.drmReplayTraceFile);
+    m_settingsInfoMap.Insert(1816461080, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.debugOverlayEnabled;
     info.valueSize = sizeof(m_settings.debugOverlayEnabled);
@@ -1137,6 +1226,16 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.interfaceLoggerConfig.elevatedPreset);
     m_settingsInfoMap.Insert(3991423149, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.flushPolicy;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.flushPolicy);
+    m_settingsInfoMap.Insert(3692622860, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.flushThreshold;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.flushThreshold);
+    m_settingsInfoMap.Insert(3403506437, info);
+
 }
 
 // =====================================================================================================================
@@ -1158,7 +1257,7 @@ void PlatformSettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palPlatformJsonData[0];
             component.settingsDataSize = sizeof(g_palPlatformJsonData);
-            component.settingsDataHash = 989129819;
+            component.settingsDataHash = 3890216465;
             component.settingsDataHeader.isEncoded = true;
             component.settingsDataHeader.magicBufferId = 402778310;
             component.settingsDataHeader.magicBufferOffset = 0;
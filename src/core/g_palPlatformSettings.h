@@ -90,6 +90,13 @@ enum Pm4InstrumentorDumpMode : uint32
     Pm4InstrumentorDumpQueueSubmit = 1
 };
 
+enum InterfaceLoggerFlushPolicy : uint32
+{
+    InterfaceLoggerFlushEveryCall = 0,
+    InterfaceLoggerFlushWhenFull = 1,
+    InterfaceLoggerFlushBackground = 2
+};
+
 /// Pal auto-generated settings struct
 struct PalPlatformSettings : public Pal::DriverSettings
 {
@@ -115,6 +122,12 @@ struct PalPlatformSettings : public Pal::DriverSettings
     bool                                        enableEventLogFile;
     char                                        eventLogDirectory[MaxPathStrLen];
     char                                        eventLogFilename[MaxPathStrLen];
+    bool                                        cpuZoneProfilingEnabled;
+    uint32                                      cpuZoneMaxEventsPerThread;
+    char                                        cpuZoneTraceDirectory[MaxPathStrLen];
+    bool                                        drmTraceEnabled;
+    char                                        drmTraceDirectory[MaxPathStrLen];
+    char                                        drmReplayTraceFile[MaxPathStrLen];
 
     bool                                        debugOverlayEnabled;
     struct {
@@ -214,6 +227,8 @@ struct PalPlatformSettings : public Pal::DriverSettings
         bool                                        multithreaded;
         uint32                                      basePreset;
         uint32                                      elevatedPreset;
+        InterfaceLoggerFlushPolicy                  flushPolicy;
+        uint32                                      flushThreshold;
     } interfaceLoggerConfig;
 
 };
@@ -250,6 +265,12 @@ static const char* pAlertsEnabledStr = "#3333004859";
 #endif
 
 static const char* pEnableEventLogFileStr = "#3288205286";
+static const char* pCpuZoneProfilingEnabledStr = "#1658790916";
+static const char* pCpuZoneMaxEventsPerThreadStr = "#2663550329";
+static const char* pCpuZoneTraceDirectoryStr = "#1912592811";
+static const char* pDrmTraceEnabledStr = "#2160087420";
+static const char* pDrmTraceDirectoryStr = "#3310500190";
+static const char* pDrmReplayTraceFileStr = "#1816461080";
 
 static const char* pDebugOverlayEnabledStr = "#3362163801";
 static const char* pDebugOverlayConfig_VisualConfirmEnabledStr = "#1802476957";
@@ -328,6 +349,8 @@ static const char* pInterfaceLoggerConfig_LogDirectoryStr = "#3997041373";
 static const char* pInterfaceLoggerConfig_MultithreadedStr = "#4177532476";
 static const char* pInterfaceLoggerConfig_BasePresetStr = "#3886684530";
 static const char* pInterfaceLoggerConfig_ElevatedPresetStr = "#3991423149";
+static const char* pInterfaceLoggerConfig_FlushPolicyStr = "#3692622860";
+static const char* pInterfaceLoggerConfig_FlushThresholdStr = "#3403506437";
 
 static const SettingNameHash g_palPlatformSettingHashList[] = {
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -365,6 +388,12 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 3288205286,
 3789517094,
 3387502554,
+1658790916,
+2663550329,
+1912592811,
+2160087420,
+3310500190,
+1816461080,
 
 3362163801,
 1802476957,
@@ -443,6 +472,8 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 4177532476,
 3886684530,
 3991423149,
+3692622860,
+3403506437,
 
 };
 static const uint32 g_palPlatformNumSettings = sizeof(g_palPlatformSettingHashList) / sizeof(SettingNameHash);
@@ -582,1533 +613,1684 @@ static const uint8 g_palPlatformJsonData[] = {
     49, 73, 46, 137, 151, 148, 74, 29, 179, 218, 160, 198, 29, 186, 39, 243, 94, 30, 220, 89, 224, 148, 100, 130, 141,
     111, 9, 208, 116, 39, 219, 24, 163, 23, 248, 128, 5, 237, 108, 112, 164, 159, 135, 46, 54, 45, 52, 246, 225, 107,
     209, 199, 220, 75, 123, 101, 219, 125, 121, 128, 171, 243, 224, 120, 168, 238, 115, 218, 57, 136, 5, 218, 234, 73,
-    59, 184, 56, 93, 70, 82, 112, 35, 6, 120, 46, 131, 149, 168, 162, 184, 25, 153, 139, 77, 156, 176, 120, 162, 44, 0,
-    243, 135, 233, 86, 221, 25, 247, 12, 213, 23, 211, 168, 244, 65, 247, 179, 42, 247, 134, 222, 121, 59, 72, 235, 195,
-    94, 29, 83, 33, 107, 28, 135, 160, 216, 81, 49, 109, 51, 62, 73, 225, 218, 43, 68, 194, 10, 15, 183, 99, 83, 25, 30,
-    239, 20, 162, 219, 206, 80, 94, 76, 224, 155, 26, 181, 19, 24, 31, 2, 7, 216, 104, 150, 242, 225, 27, 61, 73, 115,
-    81, 149, 110, 129, 212, 15, 120, 86, 10, 89, 172, 208, 237, 167, 22, 226, 230, 211, 220, 22, 92, 59, 246, 237, 184,
-    150, 34, 10, 233, 144, 130, 141, 136, 5, 62, 106, 91, 208, 225, 209, 46, 230, 25, 92, 68, 136, 131, 22, 92, 145, 30,
-    124, 242, 41, 243, 102, 86, 250, 238, 105, 230, 207, 134, 13, 159, 9, 218, 146, 239, 135, 248, 35, 235, 51, 14, 4,
-    212, 202, 133, 79, 150, 246, 191, 95, 179, 245, 141, 105, 40, 80, 22, 162, 39, 248, 138, 101, 249, 128, 187, 154,
-    117, 200, 240, 242, 119, 139, 103, 160, 138, 96, 207, 214, 209, 139, 31, 240, 238, 1, 231, 22, 97, 46, 194, 52, 55,
-    128, 61, 138, 182, 253, 157, 196, 163, 44, 83, 253, 50, 155, 9, 225, 126, 144, 7, 8, 95, 222, 9, 255, 73, 138, 141,
-    17, 152, 36, 171, 131, 220, 66, 126, 149, 24, 206, 140, 153, 151, 186, 113, 242, 38, 56, 115, 218, 239, 121, 7, 93,
-    48, 182, 225, 55, 122, 36, 60, 138, 35, 11, 219, 157, 139, 227, 133, 71, 140, 155, 215, 228, 72, 116, 170, 156, 160,
-    20, 171, 125, 130, 229, 195, 97, 16, 254, 241, 151, 17, 6, 77, 173, 175, 69, 54, 106, 111, 116, 207, 175, 2, 39,
-    143, 51, 124, 171, 11, 148, 203, 31, 41, 134, 146, 40, 218, 79, 122, 166, 165, 150, 214, 118, 62, 142, 99, 198, 159,
-    116, 175, 26, 247, 143, 116, 191, 253, 152, 120, 143, 205, 206, 164, 208, 147, 245, 251, 134, 54, 53, 191, 222, 157,
-    97, 42, 115, 154, 97, 40, 159, 96, 45, 165, 26, 136, 118, 129, 48, 199, 218, 88, 159, 92, 176, 189, 141, 27, 226,
-    155, 176, 29, 217, 218, 65, 9, 34, 249, 54, 159, 232, 30, 197, 127, 161, 107, 155, 162, 109, 65, 91, 11, 222, 150,
-    144, 226, 168, 147, 64, 155, 25, 227, 98, 149, 0, 191, 149, 180, 162, 250, 138, 214, 222, 84, 31, 238, 230, 3, 150,
-    113, 51, 180, 14, 65, 111, 56, 65, 8, 223, 36, 93, 251, 87, 226, 99, 129, 152, 150, 190, 210, 157, 154, 138, 227,
-    176, 241, 71, 46, 142, 245, 188, 181, 174, 80, 141, 135, 150, 82, 160, 1, 194, 114, 164, 188, 146, 49, 185, 124,
-    226, 170, 86, 65, 252, 118, 215, 164, 220, 49, 192, 32, 49, 19, 92, 3, 252, 53, 198, 43, 141, 139, 84, 70, 74, 65,
-    228, 49, 4, 184, 107, 206, 17, 101, 32, 184, 222, 118, 173, 18, 41, 248, 168, 150, 237, 149, 56, 148, 83, 235, 225,
-    166, 14, 199, 89, 21, 78, 145, 176, 176, 32, 205, 120, 115, 28, 135, 26, 229, 186, 174, 6, 193, 161, 88, 169, 157,
-    85, 20, 192, 216, 93, 127, 12, 20, 49, 112, 201, 146, 221, 244, 92, 215, 81, 235, 224, 155, 51, 155, 196, 72, 225,
-    123, 83, 199, 213, 167, 101, 254, 109, 41, 134, 225, 255, 152, 64, 165, 136, 202, 253, 12, 227, 171, 80, 50, 78, 4,
-    239, 103, 14, 180, 142, 45, 250, 140, 142, 8, 145, 199, 205, 24, 106, 30, 160, 91, 144, 47, 254, 44, 96, 86, 85,
-    118, 209, 228, 104, 21, 176, 93, 154, 2, 60, 111, 89, 150, 222, 230, 98, 182, 3, 201, 221, 124, 175, 223, 205, 9,
-    147, 194, 123, 192, 230, 2, 3, 116, 126, 237, 75, 249, 158, 40, 99, 10, 179, 174, 183, 162, 76, 128, 55, 138, 42,
-    105, 219, 104, 111, 64, 9, 27, 232, 124, 208, 150, 114, 33, 172, 196, 203, 200, 206, 222, 60, 87, 24, 37, 178, 202,
-    209, 182, 78, 255, 184, 27, 2, 62, 111, 40, 195, 171, 66, 200, 231, 135, 109, 176, 106, 27, 247, 13, 105, 171, 98,
-    66, 30, 50, 81, 83, 93, 85, 111, 137, 34, 11, 18, 77, 176, 21, 209, 193, 126, 32, 197, 199, 153, 81, 145, 39, 131,
-    105, 159, 9, 231, 171, 107, 85, 216, 146, 238, 56, 225, 192, 102, 0, 74, 97, 179, 43, 5, 87, 130, 159, 218, 225,
-    208, 38, 21, 19, 171, 204, 43, 162, 217, 81, 75, 31, 38, 253, 167, 220, 145, 238, 28, 231, 219, 53, 240, 48, 208,
-    250, 54, 113, 99, 100, 209, 42, 234, 195, 74, 19, 205, 133, 78, 197, 252, 6, 205, 93, 32, 88, 105, 75, 133, 131, 2,
-    110, 89, 207, 121, 95, 121, 234, 102, 212, 77, 183, 32, 51, 198, 208, 149, 64, 0, 239, 157, 189, 192, 31, 105, 192,
-    91, 180, 222, 80, 214, 99, 14, 192, 9, 222, 27, 120, 17, 92, 48, 72, 232, 106, 238, 220, 136, 191, 61, 208, 35, 166,
-    46, 126, 177, 42, 218, 159, 122, 249, 92, 255, 199, 190, 49, 151, 53, 22, 75, 233, 205, 16, 119, 223, 79, 199, 252,
-    158, 225, 153, 231, 107, 209, 130, 45, 240, 116, 79, 78, 164, 102, 159, 31, 206, 157, 125, 210, 161, 215, 162, 77,
-    117, 72, 214, 162, 88, 194, 25, 232, 123, 116, 28, 80, 87, 45, 70, 147, 238, 232, 211, 14, 31, 101, 120, 197, 208,
-    227, 190, 53, 11, 106, 83, 90, 33, 44, 203, 31, 242, 191, 119, 208, 181, 172, 176, 159, 54, 218, 159, 253, 106, 142,
-    227, 202, 208, 3, 48, 3, 114, 205, 165, 3, 65, 214, 108, 33, 61, 120, 94, 4, 196, 92, 220, 207, 54, 133, 159, 163,
-    169, 214, 22, 107, 253, 154, 179, 131, 154, 69, 148, 84, 136, 143, 225, 68, 105, 245, 86, 229, 189, 154, 4, 220,
-    150, 47, 110, 146, 113, 159, 122, 215, 1, 78, 237, 114, 139, 221, 57, 252, 199, 148, 250, 119, 248, 23, 88, 175,
-    173, 22, 70, 246, 149, 157, 250, 113, 18, 161, 173, 71, 160, 221, 235, 107, 110, 69, 171, 200, 205, 101, 174, 44,
-    137, 87, 201, 182, 19, 95, 157, 60, 180, 209, 242, 38, 166, 180, 98, 245, 204, 162, 192, 167, 138, 17, 202, 81, 136,
-    246, 193, 26, 143, 180, 240, 206, 185, 179, 39, 196, 39, 204, 7, 132, 117, 189, 71, 158, 125, 106, 64, 15, 67, 96,
-    238, 148, 242, 205, 221, 67, 4, 135, 104, 15, 238, 192, 193, 118, 175, 72, 50, 232, 64, 37, 89, 148, 182, 28, 182,
-    151, 72, 181, 245, 218, 46, 232, 160, 129, 162, 161, 169, 157, 34, 80, 49, 254, 167, 135, 117, 74, 118, 171, 132,
-    209, 87, 216, 94, 169, 68, 251, 211, 124, 249, 128, 129, 21, 194, 166, 217, 15, 216, 234, 173, 80, 253, 139, 194,
-    90, 101, 81, 79, 105, 76, 69, 119, 0, 27, 6, 185, 98, 83, 28, 189, 64, 242, 172, 216, 53, 245, 94, 170, 167, 158,
-    12, 206, 181, 192, 130, 103, 208, 30, 58, 230, 174, 88, 108, 87, 102, 82, 160, 84, 159, 120, 242, 248, 133, 168,
-    168, 18, 58, 150, 101, 117, 60, 245, 138, 98, 225, 88, 76, 136, 142, 62, 53, 77, 123, 130, 36, 252, 184, 56, 169,
-    29, 208, 206, 221, 22, 189, 90, 18, 201, 48, 154, 196, 90, 53, 243, 34, 48, 202, 58, 31, 175, 41, 97, 97, 184, 16,
-    58, 101, 146, 152, 56, 14, 94, 32, 20, 205, 109, 231, 36, 151, 112, 248, 125, 154, 192, 137, 102, 143, 23, 139, 172,
-    66, 126, 57, 6, 131, 57, 21, 227, 72, 209, 129, 85, 0, 176, 31, 120, 209, 154, 94, 65, 179, 158, 65, 66, 188, 127,
-    138, 179, 121, 202, 231, 98, 80, 209, 156, 95, 17, 166, 78, 98, 69, 204, 236, 81, 20, 153, 250, 114, 172, 90, 136,
-    230, 13, 124, 237, 48, 171, 39, 138, 141, 146, 240, 130, 33, 51, 130, 56, 65, 181, 214, 30, 26, 119, 12, 142, 246,
-    103, 156, 194, 184, 162, 199, 127, 176, 222, 240, 160, 223, 138, 27, 114, 85, 161, 102, 189, 37, 73, 126, 32, 175,
-    168, 46, 214, 235, 134, 50, 248, 252, 249, 253, 247, 169, 156, 10, 110, 240, 21, 7, 201, 235, 247, 115, 127, 140,
-    131, 232, 181, 43, 170, 192, 239, 153, 174, 210, 182, 172, 128, 18, 200, 138, 176, 40, 181, 170, 126, 190, 100, 11,
-    232, 93, 162, 252, 179, 214, 228, 234, 60, 125, 99, 52, 247, 142, 90, 224, 112, 41, 230, 26, 40, 121, 101, 192, 79,
-    193, 172, 198, 57, 134, 73, 124, 103, 231, 34, 82, 30, 148, 213, 143, 181, 115, 73, 17, 217, 10, 240, 130, 73, 247,
-    197, 88, 248, 117, 181, 70, 46, 69, 10, 56, 194, 214, 219, 217, 242, 81, 232, 238, 243, 20, 252, 1, 199, 222, 78,
-    237, 132, 174, 67, 63, 235, 106, 229, 195, 202, 144, 146, 25, 91, 252, 233, 15, 81, 12, 135, 134, 104, 3, 31, 201,
-    55, 110, 177, 14, 173, 204, 212, 37, 215, 211, 160, 164, 237, 111, 39, 86, 67, 155, 201, 194, 109, 130, 188, 103,
-    31, 19, 252, 231, 237, 200, 173, 167, 180, 176, 194, 89, 235, 78, 155, 59, 164, 70, 193, 149, 218, 167, 155, 160,
-    121, 152, 117, 95, 123, 120, 231, 114, 68, 13, 86, 121, 127, 241, 143, 32, 93, 210, 219, 134, 91, 15, 132, 224, 74,
-    28, 5, 219, 96, 75, 131, 219, 167, 32, 210, 64, 225, 29, 177, 141, 236, 178, 112, 60, 130, 15, 18, 246, 25, 244,
-    123, 186, 22, 9, 156, 78, 138, 184, 240, 92, 122, 86, 72, 206, 17, 9, 149, 19, 116, 33, 240, 46, 202, 1, 17, 200,
-    122, 116, 235, 163, 225, 1, 222, 53, 61, 73, 155, 209, 76, 135, 1, 130, 19, 184, 132, 222, 132, 96, 174, 75, 190,
-    243, 169, 82, 160, 38, 47, 202, 217, 32, 166, 243, 8, 143, 149, 196, 8, 145, 21, 122, 47, 182, 176, 160, 200, 184,
-    243, 28, 194, 1, 13, 150, 116, 143, 53, 243, 141, 224, 139, 90, 158, 89, 81, 76, 124, 248, 91, 170, 21, 135, 19,
-    200, 46, 56, 93, 156, 47, 116, 252, 155, 119, 32, 66, 246, 5, 167, 153, 232, 129, 98, 205, 74, 69, 63, 177, 206, 66,
-    25, 114, 171, 134, 141, 250, 86, 52, 61, 230, 228, 18, 131, 176, 35, 87, 92, 254, 58, 251, 31, 172, 224, 61, 184,
-    207, 16, 45, 12, 26, 88, 114, 232, 116, 21, 85, 242, 131, 96, 189, 121, 120, 8, 243, 101, 208, 234, 163, 215, 0, 2,
-    150, 77, 246, 5, 177, 47, 178, 78, 192, 226, 195, 171, 224, 182, 239, 53, 73, 50, 140, 162, 181, 205, 253, 158, 21,
-    92, 133, 48, 37, 225, 149, 69, 152, 13, 112, 152, 120, 112, 251, 10, 226, 46, 223, 63, 149, 227, 186, 223, 218, 10,
-    161, 208, 182, 15, 51, 138, 229, 139, 11, 246, 21, 103, 41, 81, 45, 43, 83, 28, 41, 221, 231, 129, 217, 21, 188, 96,
-    95, 137, 105, 84, 190, 121, 237, 178, 9, 151, 30, 118, 65, 12, 76, 36, 247, 82, 3, 228, 136, 166, 190, 126, 161,
-    201, 18, 12, 20, 92, 229, 214, 207, 147, 225, 198, 2, 228, 12, 107, 214, 205, 163, 12, 1, 242, 56, 16, 220, 227, 13,
-    207, 177, 49, 169, 141, 228, 34, 72, 61, 203, 134, 229, 155, 97, 61, 234, 5, 251, 125, 142, 107, 167, 199, 249, 155,
-    227, 135, 177, 49, 178, 80, 151, 248, 189, 226, 188, 46, 104, 216, 231, 233, 117, 207, 159, 230, 19, 196, 145, 181,
-    78, 8, 8, 122, 4, 224, 78, 163, 167, 90, 102, 136, 231, 153, 56, 116, 127, 151, 0, 206, 52, 0, 246, 185, 77, 68,
-    241, 53, 170, 8, 13, 48, 140, 81, 29, 235, 253, 235, 182, 59, 171, 56, 144, 24, 52, 106, 41, 183, 172, 175, 164,
-    223, 158, 161, 129, 49, 73, 234, 25, 176, 42, 176, 160, 221, 194, 89, 31, 175, 20, 228, 72, 227, 43, 19, 113, 51,
-    195, 232, 167, 179, 16, 218, 61, 29, 143, 181, 4, 167, 243, 192, 36, 126, 237, 33, 138, 162, 120, 63, 189, 37, 133,
-    231, 94, 158, 125, 82, 2, 25, 0, 219, 236, 10, 153, 177, 238, 140, 110, 88, 115, 251, 200, 57, 125, 11, 71, 239, 94,
-    46, 29, 246, 102, 114, 112, 242, 72, 112, 214, 200, 22, 102, 93, 202, 251, 202, 51, 43, 116, 192, 60, 108, 31, 58,
-    123, 204, 235, 227, 193, 147, 201, 192, 105, 116, 165, 250, 118, 250, 83, 79, 160, 51, 108, 216, 169, 51, 78, 121,
-    84, 1, 28, 23, 112, 152, 200, 103, 136, 187, 43, 111, 152, 181, 80, 1, 21, 237, 228, 85, 48, 29, 15, 3, 101, 28,
-    183, 72, 125, 248, 25, 216, 33, 27, 38, 205, 208, 46, 230, 203, 152, 129, 86, 116, 116, 115, 45, 252, 197, 140, 14,
-    204, 31, 39, 30, 82, 182, 86, 36, 67, 41, 141, 136, 19, 0, 230, 158, 172, 121, 148, 67, 9, 41, 155, 83, 46, 249, 71,
-    84, 41, 193, 105, 26, 18, 55, 132, 126, 157, 128, 210, 161, 122, 33, 81, 130, 121, 78, 142, 231, 222, 220, 241, 35,
-    32, 214, 133, 31, 118, 51, 204, 236, 239, 160, 228, 213, 23, 34, 195, 86, 227, 102, 131, 211, 220, 11, 212, 191,
-    167, 124, 248, 239, 228, 133, 193, 134, 223, 236, 124, 16, 178, 37, 120, 63, 61, 180, 231, 137, 169, 26, 196, 78,
-    211, 43, 149, 170, 36, 42, 215, 140, 31, 211, 182, 59, 167, 216, 177, 114, 45, 138, 94, 173, 46, 225, 55, 53, 30,
-    105, 239, 140, 176, 83, 50, 234, 4, 220, 166, 201, 129, 120, 48, 71, 213, 53, 33, 198, 239, 64, 3, 63, 1, 241, 217,
-    185, 192, 124, 67, 154, 153, 29, 91, 18, 116, 161, 30, 109, 32, 200, 2, 123, 15, 230, 232, 31, 131, 236, 84, 139,
-    98, 185, 6, 96, 192, 167, 183, 154, 80, 80, 233, 129, 184, 163, 108, 0, 147, 142, 4, 8, 144, 102, 184, 108, 120, 82,
-    151, 77, 166, 190, 66, 29, 109, 224, 99, 240, 252, 81, 128, 63, 146, 107, 25, 22, 231, 46, 162, 237, 80, 141, 207,
-    95, 177, 78, 148, 79, 151, 43, 215, 12, 26, 234, 153, 100, 122, 89, 200, 226, 10, 13, 229, 58, 96, 160, 97, 203, 16,
-    36, 246, 134, 243, 222, 88, 187, 177, 156, 205, 1, 158, 140, 229, 2, 141, 98, 7, 193, 63, 211, 31, 60, 75, 9, 72,
-    27, 18, 126, 224, 36, 83, 136, 88, 22, 220, 67, 213, 164, 23, 151, 241, 108, 121, 156, 157, 75, 128, 112, 73, 209,
-    67, 126, 160, 11, 211, 40, 139, 230, 151, 145, 153, 175, 88, 253, 243, 251, 9, 101, 64, 46, 225, 168, 29, 133, 231,
-    204, 33, 101, 165, 73, 181, 37, 242, 188, 180, 195, 115, 3, 17, 30, 20, 60, 33, 204, 17, 195, 39, 51, 143, 70, 196,
-    136, 146, 91, 75, 188, 89, 68, 179, 114, 175, 24, 184, 153, 134, 212, 160, 48, 208, 210, 108, 6, 4, 100, 202, 148,
-    84, 219, 95, 170, 148, 134, 100, 145, 43, 91, 115, 87, 131, 200, 2, 9, 34, 150, 89, 11, 82, 73, 84, 152, 48, 226,
-    179, 164, 33, 186, 128, 213, 141, 170, 131, 192, 172, 238, 220, 159, 172, 82, 222, 98, 250, 13, 254, 11, 143, 237,
-    222, 100, 196, 97, 231, 221, 175, 182, 26, 45, 129, 118, 28, 194, 21, 143, 107, 71, 128, 89, 71, 176, 153, 140, 244,
-    45, 105, 249, 177, 215, 238, 23, 229, 154, 67, 153, 89, 164, 0, 232, 40, 203, 45, 54, 236, 169, 177, 47, 141, 104,
-    15, 127, 83, 17, 2, 106, 122, 36, 172, 158, 254, 79, 110, 86, 194, 222, 43, 172, 160, 214, 129, 162, 74, 42, 47,
-    108, 7, 254, 191, 16, 205, 242, 80, 163, 145, 24, 132, 144, 104, 65, 35, 11, 243, 60, 203, 241, 164, 45, 134, 209,
-    52, 112, 71, 235, 183, 116, 229, 0, 96, 243, 203, 248, 132, 63, 137, 109, 115, 30, 143, 221, 139, 126, 144, 75, 167,
-    7, 47, 235, 239, 140, 23, 161, 192, 179, 58, 54, 95, 10, 218, 100, 180, 133, 33, 157, 28, 214, 25, 42, 45, 196, 242,
-    41, 95, 131, 161, 0, 177, 255, 180, 191, 42, 254, 165, 165, 58, 251, 223, 208, 40, 225, 225, 97, 242, 238, 156, 126,
-    0, 104, 201, 59, 241, 152, 137, 162, 198, 192, 109, 16, 32, 160, 229, 153, 61, 18, 185, 31, 38, 108, 82, 129, 251,
-    0, 130, 115, 124, 213, 197, 138, 30, 98, 251, 51, 196, 53, 79, 45, 67, 146, 200, 126, 139, 80, 7, 199, 25, 176, 167,
-    188, 241, 16, 113, 186, 0, 211, 92, 105, 152, 222, 85, 147, 149, 173, 10, 230, 247, 55, 49, 121, 50, 25, 232, 82,
-    48, 41, 160, 0, 13, 108, 130, 157, 93, 59, 65, 85, 245, 192, 97, 45, 43, 210, 165, 87, 207, 238, 237, 46, 159, 197,
-    86, 160, 162, 110, 210, 106, 65, 133, 200, 187, 209, 148, 16, 83, 15, 170, 216, 28, 175, 119, 248, 161, 192, 207,
-    194, 253, 253, 61, 205, 106, 109, 191, 170, 147, 142, 115, 143, 62, 200, 238, 137, 157, 43, 158, 205, 118, 163, 220,
-    10, 31, 198, 43, 129, 88, 26, 37, 56, 82, 220, 190, 166, 77, 142, 145, 27, 8, 113, 1, 144, 238, 35, 155, 79, 15, 34,
-    244, 4, 252, 2, 51, 112, 21, 102, 245, 197, 160, 42, 146, 213, 182, 222, 118, 94, 199, 122, 232, 161, 177, 115, 138,
-    241, 113, 37, 169, 204, 68, 229, 76, 20, 15, 79, 75, 172, 144, 206, 171, 200, 26, 116, 62, 177, 129, 143, 11, 162,
-    255, 75, 211, 232, 236, 31, 182, 60, 108, 92, 27, 145, 126, 10, 103, 142, 198, 143, 43, 194, 121, 179, 47, 33, 79,
-    51, 183, 231, 145, 137, 69, 152, 139, 138, 124, 227, 17, 25, 109, 63, 63, 124, 154, 199, 210, 26, 46, 51, 140, 182,
-    53, 44, 181, 211, 63, 38, 250, 145, 41, 99, 109, 90, 202, 116, 71, 33, 93, 216, 4, 83, 156, 35, 140, 76, 254, 21,
-    222, 27, 96, 159, 68, 145, 12, 118, 177, 138, 107, 246, 192, 120, 218, 18, 87, 143, 8, 133, 33, 171, 147, 71, 58,
-    205, 63, 35, 15, 93, 3, 171, 50, 223, 29, 0, 24, 246, 213, 243, 247, 186, 103, 133, 219, 69, 231, 210, 135, 151,
-    101, 84, 153, 44, 56, 202, 234, 11, 25, 253, 23, 137, 98, 229, 91, 135, 129, 41, 33, 120, 97, 142, 102, 36, 115, 3,
-    17, 6, 174, 13, 75, 116, 179, 194, 44, 203, 150, 238, 176, 13, 39, 209, 120, 23, 1, 160, 200, 208, 75, 212, 213,
-    144, 46, 245, 193, 150, 79, 34, 146, 175, 141, 229, 161, 81, 91, 21, 69, 100, 40, 71, 170, 173, 78, 137, 225, 206,
-    64, 56, 112, 39, 165, 97, 61, 9, 93, 228, 234, 59, 161, 244, 162, 47, 148, 192, 155, 128, 87, 227, 14, 22, 102, 145,
-    243, 23, 5, 90, 134, 123, 60, 119, 36, 175, 15, 237, 186, 227, 103, 51, 36, 52, 198, 52, 109, 154, 166, 251, 216,
-    232, 43, 228, 126, 184, 17, 20, 92, 113, 107, 172, 97, 81, 63, 246, 169, 200, 15, 58, 191, 130, 103, 224, 108, 147,
-    20, 242, 141, 32, 244, 254, 47, 38, 210, 194, 180, 141, 245, 64, 73, 89, 63, 176, 110, 156, 221, 116, 195, 154, 236,
-    220, 236, 250, 34, 183, 253, 15, 72, 26, 88, 6, 11, 121, 196, 203, 155, 203, 126, 67, 12, 140, 229, 78, 99, 253,
-    184, 175, 116, 90, 123, 151, 134, 114, 218, 120, 59, 224, 154, 89, 12, 78, 53, 80, 140, 213, 151, 91, 190, 155, 90,
-    101, 236, 78, 106, 29, 16, 103, 87, 87, 59, 223, 177, 104, 149, 136, 92, 73, 129, 159, 202, 129, 108, 253, 59, 28,
-    9, 61, 108, 89, 202, 91, 150, 152, 118, 169, 153, 217, 174, 184, 211, 227, 234, 42, 175, 31, 187, 50, 189, 115, 247,
-    207, 175, 211, 227, 87, 39, 114, 196, 81, 159, 96, 75, 164, 29, 164, 50, 237, 209, 178, 110, 149, 42, 20, 84, 208,
-    208, 43, 127, 47, 200, 56, 88, 3, 42, 119, 61, 215, 82, 115, 41, 55, 251, 105, 122, 152, 53, 21, 31, 144, 5, 194,
-    40, 83, 70, 251, 140, 64, 231, 247, 139, 25, 60, 220, 253, 116, 182, 39, 222, 204, 16, 183, 70, 75, 30, 231, 124,
-    131, 71, 158, 247, 84, 176, 46, 251, 48, 171, 232, 110, 119, 25, 124, 90, 143, 53, 144, 205, 18, 34, 126, 181, 155,
-    9, 132, 162, 213, 167, 231, 72, 11, 166, 134, 71, 215, 203, 112, 108, 99, 31, 250, 105, 152, 155, 125, 94, 86, 167,
-    18, 207, 32, 58, 159, 172, 90, 115, 172, 66, 207, 195, 6, 247, 115, 185, 238, 103, 121, 17, 90, 127, 157, 199, 185,
-    49, 172, 76, 255, 57, 24, 199, 207, 65, 251, 148, 103, 220, 2, 233, 236, 18, 195, 78, 22, 151, 7, 89, 49, 64, 70,
-    200, 86, 191, 72, 246, 0, 90, 206, 28, 169, 40, 53, 193, 115, 237, 194, 104, 172, 75, 213, 95, 66, 92, 90, 34, 117,
-    50, 173, 6, 24, 241, 124, 195, 73, 141, 116, 198, 183, 57, 205, 106, 83, 221, 109, 97, 162, 52, 77, 131, 43, 17, 51,
-    77, 189, 137, 93, 4, 143, 11, 104, 109, 205, 45, 227, 108, 168, 91, 157, 115, 133, 28, 158, 100, 226, 135, 31, 124,
-    68, 227, 232, 87, 180, 250, 121, 130, 10, 29, 166, 24, 66, 235, 236, 135, 53, 85, 177, 28, 167, 165, 159, 226, 177,
-    173, 191, 44, 218, 11, 4, 139, 250, 121, 210, 125, 48, 130, 144, 28, 68, 250, 11, 151, 68, 20, 132, 58, 74, 152, 89,
-    192, 17, 156, 201, 80, 32, 108, 3, 45, 155, 131, 156, 43, 12, 102, 191, 2, 54, 231, 48, 99, 131, 195, 54, 198, 117,
-    214, 157, 207, 200, 48, 204, 114, 27, 14, 158, 167, 93, 220, 27, 105, 89, 63, 228, 118, 241, 161, 207, 142, 190,
-    237, 155, 16, 26, 13, 216, 57, 15, 102, 206, 85, 213, 65, 146, 223, 89, 72, 84, 192, 26, 141, 235, 201, 116, 1, 174,
-    174, 246, 124, 192, 217, 209, 75, 66, 70, 224, 20, 254, 47, 67, 73, 24, 88, 188, 81, 2, 169, 40, 168, 87, 39, 106,
-    96, 125, 83, 189, 124, 7, 194, 76, 15, 180, 63, 222, 237, 214, 42, 213, 29, 152, 178, 224, 105, 193, 4, 103, 117,
-    148, 71, 67, 22, 80, 194, 33, 218, 50, 64, 208, 33, 168, 216, 10, 117, 11, 90, 174, 146, 66, 26, 69, 202, 34, 167,
-    94, 23, 218, 152, 71, 48, 237, 229, 138, 2, 39, 22, 136, 19, 33, 196, 174, 43, 164, 98, 39, 154, 77, 147, 83, 226,
-    132, 245, 6, 106, 62, 255, 99, 125, 191, 94, 69, 144, 133, 232, 44, 65, 48, 163, 56, 165, 175, 116, 173, 2, 160,
-    139, 56, 99, 19, 123, 35, 112, 71, 166, 59, 43, 236, 164, 242, 172, 145, 21, 15, 73, 105, 163, 84, 135, 158, 13, 11,
-    246, 21, 31, 59, 86, 247, 3, 8, 181, 11, 98, 160, 69, 34, 45, 221, 73, 114, 202, 0, 75, 40, 235, 67, 59, 93, 34,
-    210, 192, 34, 156, 115, 179, 223, 201, 5, 168, 29, 45, 81, 153, 35, 98, 27, 120, 14, 3, 106, 132, 44, 115, 41, 222,
-    71, 77, 157, 234, 66, 175, 137, 123, 86, 2, 188, 66, 208, 184, 111, 80, 88, 96, 95, 167, 14, 177, 15, 11, 123, 5,
-    249, 95, 94, 25, 22, 166, 159, 228, 254, 224, 194, 31, 65, 214, 239, 246, 59, 154, 141, 45, 255, 103, 159, 170, 194,
-    22, 159, 118, 148, 119, 66, 108, 43, 56, 186, 144, 30, 69, 123, 43, 21, 216, 235, 186, 38, 42, 105, 49, 171, 46, 95,
-    38, 194, 48, 55, 9, 184, 153, 117, 146, 16, 77, 44, 198, 180, 120, 190, 244, 34, 75, 218, 207, 9, 169, 187, 149,
-    139, 234, 210, 169, 217, 32, 104, 128, 79, 210, 159, 141, 218, 254, 165, 174, 198, 23, 198, 171, 40, 140, 34, 206,
-    133, 134, 80, 100, 92, 162, 42, 233, 210, 146, 205, 229, 211, 127, 5, 68, 196, 89, 85, 90, 212, 148, 215, 235, 105,
-    187, 98, 171, 39, 141, 123, 33, 245, 146, 43, 233, 245, 127, 88, 69, 187, 34, 53, 8, 56, 173, 231, 155, 28, 121,
-    110, 8, 146, 96, 100, 94, 149, 236, 58, 118, 194, 124, 12, 89, 170, 176, 62, 218, 98, 151, 200, 67, 190, 213, 241,
-    48, 38, 176, 25, 216, 253, 42, 211, 92, 124, 144, 90, 43, 170, 212, 184, 253, 151, 140, 11, 30, 151, 59, 150, 137,
-    167, 212, 248, 180, 74, 238, 13, 254, 10, 112, 20, 247, 129, 48, 58, 159, 159, 233, 13, 20, 150, 66, 99, 47, 148,
-    210, 193, 108, 139, 153, 138, 106, 135, 246, 99, 117, 30, 60, 113, 145, 219, 84, 187, 199, 68, 69, 142, 252, 178,
-    233, 181, 76, 215, 65, 91, 84, 209, 132, 100, 43, 95, 198, 10, 179, 130, 176, 5, 185, 186, 100, 211, 76, 248, 46,
-    91, 165, 87, 197, 14, 133, 150, 150, 202, 57, 117, 198, 136, 42, 146, 94, 198, 171, 173, 160, 48, 5, 116, 22, 188,
-    192, 224, 222, 253, 157, 47, 31, 159, 168, 58, 164, 209, 93, 207, 132, 100, 25, 22, 11, 130, 107, 104, 132, 54, 114,
-    105, 9, 121, 226, 147, 33, 237, 183, 211, 43, 30, 144, 70, 1, 18, 54, 247, 255, 41, 104, 118, 137, 222, 124, 213,
-    231, 201, 111, 102, 185, 50, 192, 186, 164, 173, 205, 100, 61, 40, 113, 175, 44, 127, 218, 150, 162, 173, 97, 17,
-    39, 108, 94, 44, 84, 49, 5, 111, 5, 162, 236, 221, 234, 42, 156, 158, 202, 229, 190, 59, 186, 134, 130, 216, 31, 45,
-    57, 144, 75, 109, 95, 210, 187, 135, 45, 48, 2, 181, 147, 181, 243, 202, 212, 221, 162, 230, 45, 130, 165, 163, 44,
-    163, 25, 67, 47, 243, 198, 201, 182, 60, 81, 155, 115, 208, 214, 39, 121, 194, 199, 24, 226, 189, 36, 89, 62, 86,
-    123, 163, 86, 155, 73, 69, 200, 145, 66, 135, 94, 153, 28, 83, 23, 70, 40, 231, 249, 142, 42, 179, 133, 67, 156,
-    241, 190, 82, 246, 251, 131, 232, 150, 151, 84, 177, 134, 14, 165, 39, 51, 231, 29, 216, 191, 147, 181, 151, 153,
-    163, 73, 57, 182, 32, 141, 11, 64, 239, 250, 52, 74, 80, 71, 1, 232, 171, 102, 36, 151, 88, 153, 25, 232, 164, 222,
-    124, 66, 67, 236, 248, 187, 157, 174, 93, 20, 203, 98, 10, 118, 218, 228, 62, 115, 138, 241, 210, 45, 52, 184, 247,
-    176, 20, 101, 131, 48, 11, 35, 117, 142, 38, 80, 52, 5, 253, 157, 17, 11, 96, 29, 164, 228, 100, 244, 16, 61, 20,
-    159, 21, 196, 11, 226, 55, 84, 47, 77, 189, 56, 58, 66, 46, 201, 47, 29, 193, 18, 33, 107, 23, 146, 102, 136, 193,
-    87, 99, 243, 117, 255, 130, 4, 186, 195, 240, 248, 171, 138, 125, 118, 228, 254, 230, 208, 179, 3, 16, 166, 196,
-    150, 28, 146, 160, 37, 49, 202, 197, 180, 219, 243, 113, 32, 17, 16, 73, 191, 62, 23, 89, 194, 114, 82, 225, 60, 96,
-    149, 5, 29, 93, 4, 84, 108, 158, 198, 20, 36, 54, 210, 31, 213, 29, 245, 218, 242, 197, 158, 219, 138, 129, 81, 184,
-    175, 106, 246, 158, 101, 91, 146, 252, 94, 17, 51, 224, 65, 185, 51, 54, 103, 209, 166, 46, 200, 36, 165, 21, 56,
-    47, 118, 90, 235, 18, 116, 127, 159, 28, 48, 180, 120, 252, 77, 229, 12, 44, 179, 131, 28, 190, 53, 195, 18, 23,
-    237, 206, 147, 132, 34, 108, 118, 111, 251, 79, 42, 94, 237, 46, 75, 107, 170, 132, 0, 210, 98, 163, 205, 220, 227,
-    175, 223, 121, 229, 185, 166, 219, 80, 43, 140, 242, 7, 151, 172, 40, 162, 234, 199, 94, 96, 165, 97, 234, 31, 170,
-    32, 190, 222, 154, 1, 70, 53, 88, 68, 25, 36, 213, 82, 189, 184, 11, 163, 191, 225, 178, 125, 78, 91, 39, 65, 129,
-    76, 56, 106, 220, 113, 162, 93, 109, 155, 12, 100, 37, 55, 116, 144, 77, 48, 50, 63, 14, 166, 151, 62, 167, 10, 68,
-    139, 218, 143, 107, 1, 128, 143, 19, 147, 193, 148, 174, 141, 61, 156, 153, 129, 210, 155, 19, 21, 55, 149, 226, 3,
-    243, 131, 107, 231, 98, 186, 46, 25, 110, 25, 30, 51, 100, 239, 210, 70, 148, 42, 88, 104, 114, 51, 190, 239, 94,
-    188, 235, 106, 191, 28, 219, 104, 219, 167, 50, 196, 21, 139, 87, 190, 59, 140, 85, 135, 84, 140, 119, 97, 171, 18,
-    86, 108, 203, 107, 60, 53, 85, 176, 122, 136, 157, 84, 11, 193, 190, 88, 4, 125, 92, 176, 159, 60, 123, 11, 221,
-    152, 66, 164, 66, 44, 130, 37, 65, 145, 242, 230, 67, 160, 110, 114, 83, 198, 220, 215, 191, 194, 2, 74, 243, 231,
-    28, 167, 118, 195, 36, 197, 233, 246, 155, 161, 6, 159, 154, 118, 151, 64, 61, 110, 40, 181, 67, 201, 184, 88, 45,
-    23, 183, 63, 126, 242, 219, 63, 210, 34, 111, 79, 239, 73, 23, 183, 78, 78, 20, 85, 20, 63, 188, 214, 19, 151, 154,
-    36, 10, 58, 205, 142, 119, 251, 110, 132, 55, 21, 116, 50, 238, 1, 163, 41, 66, 187, 252, 84, 16, 219, 73, 242, 98,
-    23, 107, 8, 37, 198, 100, 240, 59, 231, 61, 18, 8, 238, 8, 231, 133, 185, 237, 115, 142, 46, 165, 55, 14, 42, 55,
-    139, 60, 173, 196, 48, 17, 167, 120, 11, 126, 122, 119, 132, 142, 36, 42, 126, 252, 150, 22, 112, 82, 228, 83, 80,
-    226, 33, 254, 87, 123, 5, 236, 107, 237, 21, 39, 152, 70, 224, 69, 226, 205, 212, 50, 61, 181, 192, 62, 59, 16, 91,
-    0, 23, 96, 210, 73, 166, 71, 221, 209, 165, 59, 45, 245, 245, 146, 92, 34, 44, 13, 34, 86, 185, 232, 255, 3, 166,
-    73, 12, 162, 104, 83, 62, 210, 3, 76, 66, 225, 239, 82, 7, 122, 216, 249, 24, 16, 216, 12, 41, 169, 202, 188, 35,
-    29, 107, 208, 4, 21, 13, 155, 100, 172, 210, 241, 63, 93, 242, 189, 180, 63, 250, 213, 244, 100, 61, 206, 102, 91,
-    166, 72, 151, 51, 133, 180, 76, 137, 168, 59, 68, 95, 190, 214, 114, 152, 112, 99, 16, 55, 55, 190, 206, 216, 48,
-    137, 139, 56, 187, 31, 97, 158, 184, 7, 162, 179, 105, 156, 175, 253, 120, 47, 103, 202, 41, 222, 115, 211, 113, 68,
-    33, 92, 4, 224, 82, 148, 162, 103, 181, 226, 174, 172, 127, 243, 58, 253, 221, 22, 71, 212, 212, 231, 158, 190, 165,
-    180, 84, 133, 113, 238, 77, 14, 105, 3, 249, 139, 107, 71, 108, 155, 99, 133, 255, 2, 36, 103, 19, 162, 69, 112,
-    142, 36, 18, 67, 95, 59, 65, 110, 121, 53, 33, 180, 200, 15, 97, 239, 1, 28, 92, 181, 179, 132, 253, 97, 12, 155,
-    39, 9, 68, 222, 161, 86, 76, 158, 93, 126, 220, 101, 8, 24, 108, 186, 186, 28, 143, 87, 239, 79, 22, 194, 205, 252,
-    193, 154, 217, 170, 23, 226, 54, 85, 70, 57, 245, 135, 28, 243, 57, 192, 62, 213, 146, 238, 87, 18, 163, 194, 182,
-    100, 11, 86, 99, 31, 76, 19, 21, 49, 245, 75, 43, 14, 209, 181, 102, 74, 162, 125, 175, 206, 26, 29, 9, 28, 179, 22,
-    108, 136, 71, 83, 166, 140, 60, 171, 198, 19, 13, 239, 58, 200, 180, 248, 79, 112, 46, 188, 161, 223, 207, 71, 92,
-    134, 214, 40, 181, 214, 175, 170, 130, 202, 150, 18, 7, 249, 142, 254, 40, 25, 67, 135, 14, 166, 9, 165, 161, 113,
-    115, 97, 180, 57, 255, 25, 147, 181, 4, 162, 28, 168, 213, 124, 150, 62, 185, 155, 15, 17, 247, 134, 67, 219, 107,
-    64, 39, 185, 134, 65, 242, 54, 198, 78, 209, 165, 180, 211, 132, 133, 79, 255, 4, 40, 130, 18, 155, 86, 184, 72,
-    131, 98, 175, 122, 237, 148, 155, 88, 245, 245, 150, 148, 241, 148, 65, 110, 103, 129, 218, 236, 220, 202, 145, 7,
-    219, 200, 92, 23, 164, 160, 112, 95, 193, 140, 62, 46, 208, 106, 246, 250, 208, 211, 63, 165, 163, 206, 232, 116,
-    24, 77, 96, 36, 102, 79, 241, 182, 121, 140, 250, 73, 219, 152, 164, 162, 160, 23, 143, 100, 30, 185, 199, 162, 205,
-    80, 15, 34, 31, 91, 51, 163, 132, 4, 116, 107, 185, 71, 96, 53, 104, 23, 16, 21, 199, 203, 4, 188, 56, 30, 65, 204,
-    51, 192, 150, 18, 72, 203, 34, 102, 100, 19, 206, 238, 119, 74, 120, 1, 68, 1, 174, 78, 132, 171, 166, 139, 159,
-    248, 55, 148, 57, 45, 139, 103, 125, 157, 183, 162, 7, 126, 86, 227, 188, 109, 186, 20, 254, 254, 16, 79, 212, 183,
-    5, 228, 86, 243, 49, 229, 206, 100, 147, 166, 207, 246, 81, 49, 66, 126, 147, 141, 49, 73, 216, 64, 113, 53, 112,
-    233, 214, 96, 138, 82, 131, 141, 198, 86, 71, 74, 106, 239, 99, 216, 118, 107, 148, 224, 197, 78, 0, 74, 98, 44,
-    109, 250, 209, 81, 152, 188, 232, 104, 234, 108, 75, 87, 49, 91, 220, 232, 166, 174, 25, 25, 182, 115, 179, 134,
-    165, 251, 239, 35, 115, 209, 218, 23, 132, 137, 5, 213, 125, 34, 123, 109, 82, 201, 208, 249, 205, 35, 35, 77, 7, 8,
-    250, 202, 86, 99, 104, 0, 215, 139, 70, 128, 171, 227, 189, 182, 58, 43, 244, 173, 156, 87, 108, 223, 255, 3, 127,
-    142, 194, 133, 180, 230, 23, 106, 52, 31, 148, 183, 207, 1, 194, 150, 236, 216, 196, 75, 64, 78, 20, 181, 114, 94,
-    235, 180, 159, 54, 49, 174, 136, 228, 38, 78, 92, 110, 165, 57, 225, 214, 219, 70, 101, 100, 6, 49, 9, 105, 120,
-    201, 46, 159, 224, 81, 143, 24, 184, 255, 194, 131, 178, 252, 152, 135, 67, 12, 88, 213, 108, 74, 23, 191, 125, 222,
-    63, 238, 195, 32, 69, 60, 34, 233, 42, 82, 250, 7, 111, 157, 228, 23, 90, 134, 182, 178, 36, 168, 127, 175, 185,
-    194, 229, 147, 56, 160, 24, 143, 221, 7, 1, 31, 108, 249, 205, 146, 206, 32, 160, 252, 32, 246, 117, 60, 53, 118,
-    16, 35, 249, 130, 51, 164, 248, 177, 253, 168, 208, 145, 220, 132, 130, 142, 98, 47, 51, 122, 247, 35, 236, 202,
-    251, 157, 76, 31, 219, 42, 235, 4, 128, 217, 16, 213, 49, 11, 199, 88, 59, 221, 60, 230, 123, 115, 9, 244, 198, 93,
-    115, 157, 220, 149, 180, 132, 83, 168, 247, 104, 24, 80, 27, 149, 157, 245, 122, 40, 114, 154, 175, 192, 67, 10, 34,
-    47, 83, 95, 58, 172, 53, 12, 195, 254, 156, 38, 1, 107, 12, 213, 41, 25, 140, 212, 95, 152, 151, 118, 52, 113, 39,
-    237, 91, 2, 205, 154, 92, 206, 50, 212, 57, 97, 214, 64, 98, 232, 224, 239, 117, 244, 214, 25, 180, 40, 110, 227,
-    112, 140, 185, 150, 31, 227, 241, 104, 120, 69, 198, 91, 73, 30, 83, 130, 135, 56, 200, 99, 164, 100, 76, 196, 128,
-    48, 19, 63, 30, 252, 87, 225, 27, 222, 24, 17, 160, 100, 66, 73, 50, 244, 85, 53, 202, 180, 137, 75, 114, 147, 135,
-    122, 161, 224, 65, 187, 177, 105, 92, 246, 237, 103, 216, 209, 138, 123, 170, 91, 82, 247, 70, 103, 182, 205, 123,
-    236, 35, 17, 4, 173, 244, 94, 223, 17, 89, 127, 53, 40, 114, 94, 129, 22, 198, 14, 164, 250, 105, 219, 206, 202,
-    212, 28, 35, 80, 179, 91, 187, 4, 206, 222, 136, 48, 145, 202, 225, 89, 220, 98, 107, 29, 190, 30, 35, 108, 53, 231,
-    197, 251, 124, 199, 127, 146, 205, 2, 195, 80, 193, 25, 55, 49, 239, 161, 66, 232, 14, 121, 144, 158, 44, 56, 168,
-    68, 102, 221, 69, 76, 123, 14, 71, 9, 10, 0, 57, 218, 244, 104, 36, 4, 142, 39, 15, 102, 113, 161, 94, 94, 228, 235,
-    84, 248, 175, 66, 98, 206, 59, 44, 77, 192, 109, 73, 95, 129, 139, 22, 107, 240, 133, 152, 138, 69, 121, 222, 140,
-    70, 223, 209, 5, 130, 85, 7, 215, 1, 30, 129, 6, 5, 181, 138, 169, 160, 16, 63, 172, 26, 9, 43, 178, 173, 229, 201,
-    100, 65, 83, 172, 97, 26, 107, 116, 131, 133, 75, 224, 219, 156, 76, 121, 94, 110, 176, 163, 102, 2, 14, 137, 129,
-    10, 104, 8, 215, 216, 137, 89, 176, 75, 115, 85, 162, 4, 122, 125, 40, 61, 27, 191, 46, 248, 127, 73, 1, 245, 14,
-    246, 43, 237, 153, 220, 108, 112, 27, 43, 253, 240, 251, 247, 79, 58, 226, 189, 65, 244, 200, 141, 237, 169, 252,
-    150, 68, 222, 94, 75, 229, 113, 125, 233, 196, 194, 105, 52, 139, 7, 49, 111, 42, 187, 215, 124, 5, 13, 236, 141,
-    23, 166, 33, 150, 101, 134, 39, 92, 32, 14, 225, 1, 226, 119, 243, 201, 23, 214, 175, 70, 230, 37, 40, 114, 113,
-    115, 129, 43, 84, 184, 252, 39, 202, 175, 83, 109, 18, 116, 46, 69, 117, 249, 158, 10, 134, 75, 76, 137, 168, 176,
-    17, 209, 178, 133, 111, 226, 200, 42, 164, 100, 11, 5, 18, 118, 244, 5, 121, 68, 217, 76, 103, 54, 94, 183, 99, 255,
-    239, 48, 23, 181, 46, 103, 15, 254, 194, 136, 72, 22, 125, 171, 205, 45, 29, 76, 227, 128, 57, 143, 157, 188, 181,
-    205, 134, 134, 125, 75, 113, 19, 249, 61, 224, 40, 206, 36, 237, 146, 241, 60, 156, 78, 30, 115, 167, 113, 173, 127,
-    146, 90, 204, 203, 162, 72, 16, 8, 238, 62, 244, 98, 66, 37, 89, 87, 53, 239, 94, 215, 145, 185, 203, 49, 174, 138,
-    0, 213, 250, 214, 223, 63, 58, 60, 212, 220, 45, 66, 175, 17, 94, 19, 158, 219, 177, 182, 252, 222, 12, 38, 186,
-    247, 50, 138, 188, 96, 31, 241, 126, 64, 17, 235, 58, 159, 148, 49, 77, 145, 128, 148, 115, 240, 125, 4, 114, 182,
-    34, 127, 186, 186, 153, 249, 166, 42, 73, 227, 11, 95, 126, 167, 105, 93, 231, 114, 52, 102, 119, 8, 12, 206, 46,
-    244, 8, 188, 6, 111, 193, 122, 1, 72, 183, 12, 90, 170, 26, 130, 104, 220, 155, 40, 103, 157, 79, 34, 133, 235, 73,
-    22, 147, 98, 9, 76, 226, 33, 147, 178, 93, 224, 104, 156, 40, 49, 236, 62, 70, 234, 215, 202, 188, 64, 92, 202, 253,
-    164, 2, 242, 147, 134, 236, 62, 31, 9, 193, 235, 250, 215, 169, 174, 21, 202, 62, 11, 200, 74, 106, 152, 222, 160,
-    133, 115, 15, 37, 188, 97, 152, 201, 98, 10, 91, 138, 189, 255, 171, 193, 6, 212, 99, 63, 84, 182, 12, 108, 171, 42,
-    53, 154, 30, 140, 121, 136, 199, 112, 23, 184, 118, 232, 32, 231, 102, 48, 69, 190, 41, 59, 63, 68, 94, 63, 252,
-    137, 4, 35, 43, 33, 207, 244, 227, 191, 103, 249, 42, 0, 0, 186, 41, 199, 243, 227, 113, 141, 235, 243, 127, 171,
-    150, 213, 128, 100, 122, 223, 178, 163, 231, 77, 64, 64, 157, 72, 74, 211, 186, 162, 45, 241, 12, 188, 97, 36, 123,
-    195, 44, 106, 67, 131, 79, 105, 222, 206, 106, 103, 19, 66, 41, 139, 165, 189, 90, 160, 162, 160, 234, 125, 228,
-    147, 4, 153, 91, 60, 68, 152, 12, 4, 168, 196, 154, 37, 195, 145, 235, 190, 147, 183, 110, 34, 245, 98, 243, 235,
-    101, 33, 242, 96, 110, 52, 72, 218, 212, 43, 181, 2, 126, 64, 121, 161, 246, 84, 118, 163, 178, 221, 163, 63, 222,
-    77, 23, 220, 101, 218, 22, 244, 6, 2, 34, 108, 106, 71, 221, 9, 148, 90, 47, 23, 155, 41, 39, 89, 204, 123, 218, 23,
-    68, 56, 243, 227, 243, 217, 184, 35, 174, 158, 91, 249, 222, 88, 75, 89, 167, 58, 93, 209, 161, 10, 38, 133, 237,
-    188, 98, 29, 34, 1, 239, 124, 93, 8, 199, 152, 65, 146, 57, 19, 213, 161, 141, 4, 199, 248, 85, 1, 95, 23, 89, 226,
-    182, 133, 58, 48, 75, 149, 209, 96, 20, 175, 123, 163, 190, 133, 75, 99, 16, 44, 194, 87, 109, 60, 8, 82, 250, 36,
-    50, 42, 96, 156, 11, 109, 72, 42, 163, 190, 112, 200, 114, 89, 158, 219, 174, 209, 138, 64, 86, 177, 30, 195, 162,
-    200, 41, 177, 20, 205, 76, 91, 152, 12, 138, 216, 149, 216, 29, 173, 235, 200, 232, 146, 132, 133, 144, 12, 17, 76,
-    2, 251, 51, 203, 227, 147, 186, 29, 14, 94, 15, 34, 78, 93, 231, 149, 81, 35, 49, 180, 25, 128, 42, 9, 204, 42, 129,
-    116, 151, 222, 110, 161, 128, 10, 161, 70, 192, 17, 13, 181, 251, 69, 230, 75, 211, 171, 239, 205, 209, 216, 219,
-    97, 117, 215, 9, 140, 149, 69, 47, 197, 251, 56, 48, 212, 137, 161, 82, 14, 248, 25, 231, 14, 39, 20, 21, 177, 211,
-    181, 37, 164, 157, 71, 66, 246, 213, 114, 219, 255, 133, 135, 246, 215, 177, 129, 67, 57, 195, 200, 83, 39, 138,
-    103, 78, 95, 38, 110, 75, 21, 143, 9, 69, 182, 237, 210, 72, 212, 89, 88, 224, 101, 67, 129, 155, 37, 252, 197, 117,
-    149, 156, 198, 242, 234, 154, 95, 119, 78, 219, 221, 105, 142, 111, 238, 159, 29, 117, 128, 140, 214, 30, 60, 30,
-    213, 110, 8, 95, 249, 23, 167, 253, 247, 127, 131, 15, 236, 243, 222, 11, 244, 21, 101, 137, 149, 214, 102, 218,
-    127, 114, 81, 54, 192, 61, 2, 6, 213, 67, 96, 64, 168, 243, 238, 16, 93, 11, 237, 140, 125, 228, 94, 195, 230, 20,
-    148, 30, 231, 173, 171, 164, 86, 108, 62, 168, 173, 120, 44, 127, 160, 229, 76, 188, 2, 39, 125, 245, 158, 254, 211,
-    121, 126, 241, 253, 16, 110, 97, 48, 164, 125, 215, 124, 116, 55, 5, 95, 238, 113, 17, 65, 166, 52, 58, 229, 39, 57,
-    100, 249, 151, 212, 174, 22, 57, 96, 214, 10, 127, 47, 81, 177, 114, 173, 170, 206, 66, 217, 171, 92, 15, 114, 53,
-    221, 186, 145, 11, 78, 175, 233, 84, 240, 175, 117, 155, 154, 246, 226, 105, 14, 6, 178, 2, 52, 205, 21, 79, 119,
-    185, 154, 214, 215, 249, 181, 38, 46, 159, 220, 83, 66, 153, 113, 214, 5, 185, 67, 53, 223, 153, 164, 193, 32, 38,
-    218, 69, 173, 155, 187, 205, 22, 249, 209, 214, 139, 189, 178, 159, 92, 123, 62, 182, 223, 248, 10, 134, 244, 105,
-    106, 90, 108, 76, 179, 85, 224, 75, 49, 214, 158, 203, 248, 67, 8, 38, 233, 126, 100, 235, 137, 144, 67, 135, 105,
-    250, 213, 14, 188, 43, 125, 192, 18, 173, 225, 8, 252, 217, 16, 143, 148, 233, 58, 111, 125, 233, 247, 46, 133, 231,
-    252, 111, 219, 33, 128, 35, 9, 223, 224, 198, 27, 140, 186, 135, 227, 235, 245, 104, 127, 232, 125, 162, 41, 90,
-    133, 97, 170, 139, 122, 165, 29, 143, 247, 29, 173, 11, 176, 49, 197, 1, 194, 22, 174, 136, 226, 23, 238, 29, 1,
-    229, 137, 77, 167, 66, 117, 27, 42, 108, 31, 181, 85, 85, 121, 27, 82, 124, 14, 170, 123, 15, 252, 235, 67, 183, 89,
-    182, 41, 212, 86, 128, 103, 23, 152, 169, 195, 10, 253, 82, 176, 13, 231, 210, 35, 166, 124, 114, 244, 76, 249, 195,
-    182, 107, 205, 146, 30, 226, 86, 25, 93, 154, 63, 149, 197, 79, 225, 95, 96, 184, 96, 88, 181, 131, 81, 229, 38,
-    222, 180, 70, 106, 22, 10, 46, 255, 170, 77, 147, 159, 255, 220, 148, 5, 2, 250, 108, 118, 203, 234, 189, 49, 93,
-    142, 95, 121, 255, 110, 68, 94, 107, 157, 171, 129, 101, 75, 71, 188, 231, 176, 171, 12, 26, 140, 36, 173, 47, 73,
-    159, 143, 145, 119, 61, 219, 34, 71, 66, 251, 164, 133, 143, 58, 251, 94, 193, 15, 73, 13, 189, 135, 176, 225, 167,
-    112, 253, 182, 190, 74, 209, 42, 136, 121, 48, 232, 47, 30, 101, 44, 228, 216, 78, 68, 188, 39, 246, 221, 250, 173,
-    145, 181, 249, 3, 112, 170, 179, 136, 144, 106, 137, 21, 180, 77, 86, 43, 187, 234, 33, 190, 27, 238, 173, 142, 175,
-    77, 73, 225, 212, 155, 207, 68, 179, 246, 6, 116, 61, 93, 171, 121, 234, 162, 162, 239, 102, 219, 57, 135, 230, 84,
-    218, 93, 74, 135, 166, 202, 55, 166, 119, 5, 110, 83, 24, 242, 16, 244, 153, 49, 52, 200, 223, 103, 10, 195, 152,
-    141, 200, 156, 184, 202, 228, 175, 136, 29, 45, 187, 107, 84, 196, 217, 222, 242, 229, 47, 232, 209, 90, 128, 220,
-    202, 6, 71, 144, 55, 121, 32, 80, 17, 43, 5, 244, 14, 2, 40, 10, 113, 249, 138, 15, 195, 209, 125, 61, 179, 193, 70,
-    47, 41, 16, 96, 5, 184, 17, 84, 117, 54, 78, 34, 8, 190, 83, 247, 193, 188, 180, 185, 103, 184, 19, 91, 241, 196,
-    125, 106, 94, 43, 160, 213, 164, 121, 71, 215, 189, 222, 58, 254, 20, 145, 52, 66, 156, 10, 48, 15, 113, 199, 21,
-    101, 246, 76, 58, 67, 244, 70, 175, 7, 174, 13, 72, 185, 182, 53, 125, 106, 146, 17, 4, 225, 10, 197, 14, 30, 167,
-    84, 103, 136, 56, 67, 60, 130, 255, 23, 157, 43, 116, 27, 239, 145, 17, 243, 92, 193, 154, 9, 134, 206, 219, 111,
-    84, 113, 17, 175, 211, 77, 98, 191, 248, 15, 90, 99, 188, 105, 99, 188, 160, 60, 63, 199, 155, 187, 3, 23, 103, 121,
-    165, 221, 130, 123, 179, 200, 251, 251, 53, 241, 136, 236, 34, 197, 215, 16, 39, 229, 115, 212, 75, 113, 99, 243,
-    87, 14, 163, 226, 11, 231, 235, 176, 103, 120, 18, 142, 234, 2, 13, 237, 159, 71, 114, 188, 5, 9, 197, 108, 61, 230,
-    101, 66, 247, 178, 169, 67, 169, 109, 215, 4, 36, 243, 167, 234, 141, 168, 82, 109, 214, 200, 139, 60, 227, 110,
-    108, 13, 228, 161, 202, 174, 110, 10, 25, 182, 46, 205, 121, 80, 38, 157, 146, 119, 192, 184, 84, 48, 66, 215, 26,
-    181, 72, 124, 253, 231, 106, 226, 221, 224, 123, 136, 135, 136, 203, 229, 78, 68, 28, 3, 160, 174, 178, 30, 213, 97,
-    11, 248, 46, 87, 113, 211, 184, 178, 246, 237, 39, 218, 148, 39, 213, 74, 101, 90, 32, 44, 248, 92, 114, 71, 136,
-    253, 16, 130, 15, 69, 36, 168, 73, 155, 232, 43, 53, 80, 4, 149, 74, 16, 165, 251, 141, 95, 110, 85, 155, 141, 55,
-    4, 82, 237, 126, 245, 115, 133, 110, 37, 164, 129, 44, 32, 66, 34, 99, 142, 237, 105, 162, 243, 180, 191, 175, 169,
-    187, 127, 128, 43, 219, 222, 55, 18, 205, 184, 162, 47, 52, 162, 3, 196, 149, 23, 147, 248, 117, 95, 96, 58, 174,
-    245, 77, 79, 11, 225, 166, 247, 195, 111, 26, 247, 37, 12, 95, 68, 83, 176, 108, 141, 151, 94, 81, 247, 168, 45,
-    243, 83, 136, 75, 231, 188, 6, 175, 245, 79, 130, 69, 233, 82, 142, 120, 41, 248, 204, 180, 140, 229, 137, 216, 84,
-    106, 51, 52, 142, 79, 13, 234, 65, 112, 237, 205, 87, 201, 26, 195, 36, 85, 149, 118, 205, 255, 195, 243, 142, 229,
-    253, 172, 254, 195, 164, 199, 14, 166, 124, 169, 145, 102, 95, 190, 70, 33, 133, 173, 181, 110, 11, 50, 72, 253,
-    145, 138, 121, 211, 151, 247, 102, 79, 94, 169, 119, 179, 48, 19, 102, 118, 66, 165, 242, 243, 140, 33, 113, 151,
-    192, 73, 246, 45, 74, 203, 114, 236, 244, 199, 218, 193, 123, 154, 197, 148, 125, 232, 140, 191, 183, 47, 205, 26,
-    84, 22, 7, 83, 238, 155, 229, 218, 3, 30, 101, 234, 49, 55, 230, 28, 1, 3, 176, 42, 52, 33, 170, 59, 178, 220, 251,
-    180, 162, 54, 194, 137, 181, 66, 181, 126, 124, 144, 241, 197, 127, 113, 174, 92, 100, 119, 161, 190, 82, 22, 207,
-    3, 132, 140, 168, 86, 44, 127, 147, 103, 185, 141, 88, 160, 225, 193, 128, 215, 221, 155, 154, 38, 195, 48, 97, 115,
-    76, 75, 172, 181, 226, 143, 129, 80, 239, 225, 34, 220, 69, 105, 42, 84, 135, 18, 158, 132, 95, 222, 198, 175, 15,
-    74, 104, 173, 235, 1, 202, 147, 117, 17, 79, 58, 222, 76, 232, 49, 75, 171, 73, 25, 157, 116, 199, 146, 41, 121,
-    127, 142, 248, 47, 211, 12, 16, 48, 15, 52, 90, 172, 93, 150, 175, 26, 2, 232, 215, 101, 108, 123, 36, 45, 114, 84,
-    113, 210, 33, 23, 92, 47, 116, 5, 100, 219, 130, 100, 191, 65, 234, 221, 238, 29, 209, 37, 53, 33, 141, 172, 241,
-    59, 239, 208, 119, 160, 210, 20, 92, 106, 96, 116, 233, 236, 143, 211, 239, 115, 119, 89, 172, 35, 236, 23, 202,
-    163, 45, 222, 133, 206, 32, 163, 43, 42, 165, 43, 197, 92, 180, 235, 239, 77, 206, 137, 230, 31, 223, 162, 200, 239,
-    162, 225, 147, 92, 26, 181, 154, 24, 111, 220, 19, 152, 85, 25, 112, 196, 179, 41, 44, 108, 36, 218, 37, 199, 25,
-    217, 26, 132, 34, 32, 4, 169, 175, 92, 161, 222, 160, 155, 3, 30, 119, 154, 249, 169, 167, 33, 147, 175, 66, 197,
-    210, 170, 40, 121, 200, 153, 206, 99, 103, 108, 143, 237, 18, 3, 34, 221, 6, 89, 78, 112, 2, 248, 131, 244, 42, 87,
-    238, 5, 11, 173, 175, 207, 38, 138, 178, 102, 63, 21, 108, 123, 179, 245, 67, 221, 60, 0, 172, 35, 162, 115, 5, 156,
-    62, 133, 129, 112, 204, 49, 47, 218, 221, 249, 91, 101, 43, 85, 169, 39, 253, 157, 220, 195, 7, 223, 250, 221, 49,
-    8, 188, 226, 229, 149, 61, 3, 65, 81, 21, 54, 238, 88, 170, 65, 103, 69, 53, 56, 234, 142, 58, 180, 251, 102, 43,
-    135, 81, 1, 229, 52, 48, 171, 3, 174, 47, 181, 190, 112, 87, 242, 107, 139, 140, 180, 16, 136, 141, 222, 149, 229,
-    209, 220, 239, 33, 147, 254, 203, 86, 173, 5, 123, 219, 72, 57, 158, 23, 18, 25, 15, 27, 136, 102, 248, 58, 199,
-    113, 222, 163, 33, 119, 164, 192, 57, 53, 155, 255, 33, 23, 165, 203, 34, 235, 79, 59, 171, 158, 135, 74, 41, 225,
-    133, 20, 161, 24, 61, 196, 235, 181, 136, 78, 112, 28, 246, 81, 194, 124, 211, 106, 225, 192, 13, 184, 188, 92, 7,
-    98, 50, 230, 122, 10, 250, 248, 85, 21, 44, 72, 49, 178, 21, 225, 236, 185, 223, 246, 222, 142, 21, 220, 34, 164,
-    88, 238, 19, 131, 2, 124, 167, 16, 39, 6, 83, 172, 184, 195, 89, 57, 125, 123, 5, 39, 213, 241, 219, 227, 15, 84,
-    163, 118, 20, 20, 169, 68, 75, 123, 231, 61, 81, 191, 225, 156, 186, 232, 47, 3, 49, 49, 24, 38, 4, 204, 169, 6,
-    203, 84, 109, 141, 88, 112, 15, 87, 50, 39, 61, 118, 182, 21, 225, 59, 121, 53, 222, 181, 220, 247, 216, 244, 192,
-    169, 231, 117, 117, 153, 1, 228, 77, 39, 119, 166, 160, 105, 158, 196, 53, 251, 154, 157, 179, 197, 23, 175, 121,
-    115, 226, 220, 47, 175, 205, 32, 115, 185, 87, 39, 40, 88, 215, 238, 93, 202, 23, 33, 20, 140, 238, 82, 97, 40, 87,
-    197, 174, 151, 109, 241, 211, 198, 152, 30, 151, 199, 47, 54, 61, 71, 183, 171, 128, 242, 53, 11, 65, 106, 73, 52,
-    14, 138, 253, 30, 134, 125, 75, 211, 248, 182, 133, 31, 23, 246, 42, 219, 117, 133, 65, 66, 151, 72, 82, 44, 185,
-    66, 171, 171, 190, 210, 213, 200, 235, 41, 117, 32, 134, 233, 128, 98, 28, 33, 157, 106, 81, 11, 97, 133, 237, 63,
-    164, 3, 159, 164, 58, 106, 15, 92, 138, 85, 103, 184, 121, 150, 166, 229, 166, 123, 67, 164, 205, 53, 81, 187, 202,
-    69, 162, 155, 202, 84, 188, 38, 123, 138, 22, 94, 160, 180, 248, 152, 176, 76, 76, 241, 2, 73, 2, 139, 77, 189, 87,
-    147, 111, 243, 30, 126, 4, 186, 50, 37, 198, 180, 119, 52, 31, 193, 65, 22, 27, 139, 84, 3, 115, 213, 101, 170, 229,
-    188, 167, 111, 235, 246, 58, 66, 245, 85, 159, 107, 165, 187, 234, 67, 186, 112, 157, 53, 200, 41, 100, 17, 253,
-    142, 239, 25, 30, 19, 217, 59, 172, 237, 43, 80, 89, 2, 199, 71, 178, 125, 69, 6, 9, 187, 37, 138, 148, 190, 67,
-    160, 74, 212, 227, 103, 66, 17, 163, 11, 61, 30, 18, 67, 161, 120, 211, 201, 81, 150, 88, 35, 195, 86, 98, 79, 182,
-    140, 112, 98, 72, 181, 53, 186, 108, 233, 172, 149, 229, 106, 97, 75, 219, 233, 208, 245, 8, 111, 242, 114, 166, 95,
-    200, 214, 198, 92, 92, 214, 215, 211, 203, 239, 114, 18, 246, 58, 178, 78, 165, 181, 65, 219, 97, 249, 7, 166, 24,
-    132, 56, 163, 50, 110, 104, 224, 230, 170, 111, 154, 229, 66, 133, 110, 99, 186, 175, 27, 186, 155, 228, 250, 164,
-    188, 228, 180, 252, 160, 132, 254, 18, 173, 221, 65, 83, 25, 84, 43, 10, 221, 85, 54, 29, 7, 243, 16, 242, 135, 82,
-    171, 113, 105, 116, 228, 118, 161, 101, 160, 236, 218, 113, 220, 213, 212, 165, 192, 218, 161, 153, 130, 69, 33, 82,
-    173, 18, 116, 100, 106, 53, 255, 163, 42, 198, 155, 205, 102, 118, 182, 110, 240, 248, 201, 88, 2, 15, 84, 82, 51,
-    172, 222, 47, 125, 152, 184, 169, 154, 204, 216, 97, 89, 57, 222, 4, 127, 53, 140, 61, 32, 247, 16, 234, 54, 147,
-    120, 95, 246, 172, 87, 39, 252, 23, 129, 228, 151, 177, 69, 49, 208, 130, 56, 60, 46, 184, 185, 43, 153, 36, 84,
-    183, 58, 238, 200, 212, 116, 0, 98, 83, 240, 216, 73, 16, 240, 203, 159, 7, 159, 224, 57, 244, 148, 152, 246, 166,
-    113, 214, 146, 181, 239, 180, 167, 252, 202, 43, 29, 156, 156, 43, 227, 101, 164, 253, 29, 208, 90, 68, 125, 231,
-    140, 245, 101, 30, 160, 254, 84, 214, 234, 108, 21, 82, 240, 97, 13, 223, 188, 13, 55, 228, 219, 32, 116, 233, 70,
-    209, 236, 154, 32, 143, 90, 87, 54, 26, 18, 21, 150, 102, 63, 172, 186, 120, 69, 32, 198, 185, 4, 238, 130, 140, 91,
-    205, 6, 34, 55, 253, 238, 0, 24, 185, 35, 243, 176, 52, 143, 169, 50, 248, 33, 117, 237, 239, 69, 94, 39, 69, 201,
-    197, 132, 227, 63, 227, 84, 236, 3, 248, 6, 120, 228, 10, 189, 120, 57, 218, 246, 62, 71, 110, 137, 171, 196, 63,
-    181, 236, 236, 13, 115, 233, 137, 243, 112, 238, 87, 47, 162, 5, 101, 182, 124, 138, 93, 197, 72, 160, 118, 173,
-    202, 225, 140, 192, 118, 171, 254, 222, 90, 227, 147, 56, 168, 79, 67, 17, 209, 166, 46, 102, 140, 127, 86, 65, 25,
-    188, 219, 200, 92, 231, 202, 66, 178, 15, 108, 56, 11, 175, 220, 214, 87, 3, 96, 38, 94, 177, 46, 111, 241, 110, 47,
-    216, 166, 153, 79, 23, 102, 9, 197, 192, 254, 180, 223, 155, 146, 100, 59, 115, 107, 29, 223, 6, 131, 65, 55, 107,
-    181, 26, 177, 231, 37, 114, 250, 20, 230, 74, 14, 45, 96, 155, 69, 255, 107, 204, 244, 140, 181, 118, 61, 145, 39,
-    249, 157, 6, 102, 137, 45, 214, 202, 32, 80, 47, 166, 195, 114, 82, 88, 168, 102, 244, 248, 224, 18, 180, 252, 42,
-    88, 64, 93, 0, 100, 176, 30, 0, 4, 86, 127, 158, 184, 244, 4, 216, 4, 68, 149, 136, 232, 66, 181, 15, 69, 23, 255,
-    245, 209, 104, 207, 115, 21, 52, 74, 168, 67, 77, 79, 132, 225, 255, 254, 16, 109, 6, 224, 254, 4, 202, 38, 113, 21,
-    2, 112, 120, 12, 66, 89, 139, 186, 97, 150, 187, 54, 7, 129, 117, 38, 98, 105, 40, 4, 202, 51, 112, 17, 28, 4, 150,
-    9, 83, 214, 140, 196, 78, 52, 45, 132, 99, 139, 107, 7, 252, 113, 18, 237, 136, 14, 154, 138, 39, 231, 195, 18, 56,
-    117, 218, 213, 36, 201, 22, 242, 117, 231, 227, 90, 242, 184, 82, 243, 150, 243, 55, 194, 57, 208, 86, 179, 166,
-    147, 19, 64, 138, 124, 154, 117, 103, 208, 179, 232, 120, 44, 234, 226, 197, 119, 237, 163, 224, 137, 10, 156, 22,
-    41, 21, 47, 63, 247, 142, 210, 184, 189, 31, 222, 157, 165, 5, 33, 46, 47, 213, 123, 73, 49, 234, 211, 126, 54, 198,
-    246, 225, 22, 159, 108, 155, 105, 191, 80, 146, 53, 5, 40, 16, 147, 174, 85, 116, 188, 175, 220, 83, 205, 142, 207,
-    101, 211, 153, 233, 164, 82, 140, 214, 158, 86, 197, 79, 40, 106, 61, 80, 242, 115, 111, 99, 183, 233, 134, 209,
-    137, 216, 88, 199, 36, 160, 24, 164, 159, 146, 59, 155, 225, 170, 211, 184, 130, 71, 42, 239, 154, 204, 184, 216,
-    64, 223, 101, 235, 203, 104, 87, 87, 116, 18, 198, 28, 30, 146, 146, 127, 125, 148, 126, 10, 172, 208, 63, 87, 182,
-    124, 226, 20, 155, 230, 159, 26, 73, 67, 169, 231, 210, 163, 134, 164, 197, 112, 76, 243, 140, 21, 162, 246, 80,
-    224, 90, 130, 185, 0, 196, 71, 134, 72, 60, 230, 32, 197, 182, 201, 189, 91, 127, 234, 130, 141, 66, 107, 94, 244,
-    163, 235, 67, 186, 8, 31, 15, 212, 255, 78, 113, 153, 87, 165, 120, 196, 229, 185, 239, 130, 174, 172, 159, 15, 27,
-    96, 247, 109, 89, 18, 223, 0, 99, 47, 54, 90, 195, 124, 187, 1, 1, 181, 24, 57, 168, 190, 104, 248, 20, 213, 157,
-    207, 26, 108, 122, 89, 88, 80, 223, 31, 118, 147, 71, 196, 91, 215, 214, 38, 32, 71, 249, 213, 160, 35, 211, 253,
-    193, 11, 197, 37, 72, 141, 104, 217, 129, 207, 180, 11, 136, 8, 74, 116, 189, 212, 49, 16, 199, 53, 49, 205, 227,
-    13, 32, 91, 74, 153, 24, 130, 250, 138, 88, 224, 179, 12, 0, 235, 155, 41, 217, 17, 9, 135, 80, 6, 192, 222, 234,
-    125, 102, 245, 72, 29, 80, 209, 65, 33, 106, 54, 144, 1, 39, 223, 144, 10, 233, 112, 210, 22, 54, 162, 15, 112, 252,
-    100, 42, 99, 18, 19, 22, 15, 241, 140, 8, 0, 15, 222, 112, 59, 154, 217, 47, 119, 42, 241, 91, 220, 212, 122, 251,
-    84, 241, 30, 244, 182, 197, 45, 165, 209, 23, 83, 164, 92, 86, 124, 249, 145, 74, 56, 111, 192, 225, 66, 1, 143,
-    184, 178, 83, 35, 244, 151, 251, 89, 161, 159, 57, 212, 125, 15, 228, 224, 250, 196, 185, 140, 82, 72, 226, 2, 144,
-    63, 225, 251, 163, 127, 98, 193, 12, 124, 93, 113, 59, 88, 92, 225, 174, 14, 172, 145, 201, 234, 169, 146, 44, 202,
-    8, 215, 187, 90, 234, 144, 60, 129, 106, 246, 69, 138, 141, 161, 226, 40, 216, 232, 12, 186, 23, 42, 19, 77, 133,
-    144, 124, 83, 173, 102, 16, 130, 142, 201, 86, 36, 146, 228, 152, 4, 18, 212, 146, 247, 214, 206, 15, 48, 89, 66,
-    192, 241, 235, 31, 18, 14, 141, 57, 72, 114, 250, 92, 69, 92, 182, 121, 137, 102, 7, 92, 43, 197, 116, 75, 32, 207,
-    249, 142, 164, 44, 19, 183, 100, 63, 13, 154, 220, 18, 16, 76, 14, 101, 2, 129, 220, 188, 70, 14, 126, 162, 253, 98,
-    239, 43, 128, 2, 158, 106, 104, 62, 219, 155, 180, 150, 105, 243, 221, 14, 255, 50, 61, 30, 235, 205, 114, 255, 226,
-    108, 124, 251, 205, 52, 156, 137, 150, 152, 191, 57, 232, 133, 228, 200, 10, 68, 217, 210, 199, 218, 60, 188, 24,
-    223, 89, 95, 16, 69, 213, 237, 199, 225, 74, 4, 24, 45, 46, 42, 38, 92, 182, 60, 228, 179, 31, 100, 231, 170, 41,
-    203, 167, 6, 167, 251, 116, 219, 155, 231, 184, 218, 138, 11, 253, 114, 103, 182, 215, 62, 8, 131, 51, 246, 214,
-    245, 58, 60, 43, 243, 38, 195, 131, 237, 211, 199, 101, 86, 82, 115, 182, 29, 180, 99, 72, 72, 34, 56, 94, 168, 59,
-    166, 53, 192, 40, 60, 17, 110, 253, 98, 139, 220, 193, 77, 36, 228, 231, 138, 244, 45, 35, 214, 194, 139, 83, 57,
-    210, 64, 211, 174, 1, 139, 57, 2, 136, 166, 204, 209, 188, 34, 163, 162, 61, 104, 94, 245, 118, 153, 112, 163, 212,
-    88, 100, 76, 137, 223, 135, 75, 105, 71, 103, 228, 167, 77, 81, 236, 89, 95, 152, 163, 78, 240, 224, 16, 199, 211,
-    2, 172, 242, 96, 171, 101, 70, 96, 88, 39, 13, 222, 12, 5, 199, 119, 30, 110, 124, 143, 99, 198, 197, 222, 236, 96,
-    213, 191, 141, 157, 79, 110, 211, 183, 40, 235, 54, 18, 7, 122, 50, 152, 90, 34, 171, 181, 27, 114, 148, 19, 179, 3,
-    222, 233, 50, 13, 101, 92, 6, 112, 142, 107, 156, 43, 29, 245, 208, 197, 172, 242, 181, 163, 112, 125, 220, 135, 83,
-    127, 132, 135, 47, 132, 233, 0, 38, 46, 96, 182, 177, 12, 30, 31, 89, 135, 24, 92, 17, 237, 224, 111, 157, 203, 25,
-    76, 23, 198, 164, 180, 97, 19, 184, 155, 95, 208, 212, 170, 151, 206, 186, 198, 34, 136, 182, 58, 190, 194, 126,
-    184, 92, 62, 57, 246, 27, 36, 240, 83, 20, 112, 86, 191, 202, 197, 73, 5, 231, 50, 55, 230, 99, 44, 121, 241, 52,
-    246, 169, 79, 168, 32, 49, 125, 181, 138, 109, 145, 40, 233, 204, 88, 143, 228, 123, 164, 161, 86, 184, 111, 2, 168,
-    54, 200, 109, 166, 199, 4, 238, 36, 191, 37, 160, 178, 95, 170, 110, 48, 15, 84, 216, 181, 50, 167, 220, 170, 77,
-    119, 252, 217, 250, 138, 173, 133, 159, 176, 126, 152, 64, 20, 149, 62, 225, 71, 178, 91, 151, 208, 114, 146, 46,
-    74, 14, 158, 119, 239, 16, 73, 113, 176, 151, 169, 53, 139, 166, 42, 21, 248, 170, 96, 194, 20, 186, 207, 94, 240,
-    222, 41, 22, 191, 182, 147, 142, 39, 216, 44, 240, 101, 192, 255, 216, 29, 108, 247, 109, 197, 19, 137, 160, 18, 30,
-    224, 208, 118, 197, 211, 57, 150, 126, 169, 160, 42, 178, 173, 175, 39, 254, 132, 183, 240, 41, 192, 160, 141, 115,
-    243, 174, 161, 70, 69, 189, 4, 108, 39, 246, 138, 52, 29, 48, 167, 31, 3, 175, 68, 197, 255, 105, 65, 159, 136, 185,
-    108, 42, 75, 135, 122, 231, 6, 146, 110, 87, 226, 48, 5, 16, 36, 175, 138, 123, 146, 72, 171, 183, 111, 237, 113,
-    216, 37, 84, 102, 226, 86, 56, 61, 133, 25, 244, 124, 184, 30, 171, 163, 35, 246, 41, 116, 194, 101, 237, 119, 244,
-    205, 6, 61, 39, 164, 209, 164, 33, 155, 89, 126, 187, 243, 8, 110, 2, 138, 243, 105, 116, 236, 148, 34, 198, 191,
-    38, 200, 155, 92, 78, 174, 247, 166, 33, 249, 201, 63, 231, 235, 127, 169, 127, 10, 54, 95, 13, 239, 5, 36, 197, 33,
-    82, 44, 213, 59, 106, 196, 117, 60, 151, 176, 133, 1, 96, 28, 222, 142, 73, 103, 48, 1, 50, 142, 64, 215, 39, 122,
-    65, 168, 141, 232, 161, 172, 155, 201, 129, 96, 115, 50, 98, 151, 26, 119, 229, 8, 55, 216, 137, 138, 22, 24, 165,
-    121, 6, 163, 6, 29, 159, 163, 103, 131, 2, 75, 75, 228, 79, 198, 110, 209, 195, 1, 239, 98, 21, 0, 250, 9, 102, 93,
-    223, 97, 64, 157, 226, 241, 206, 61, 134, 182, 180, 17, 206, 183, 224, 148, 19, 51, 122, 26, 118, 221, 64, 41, 200,
-    27, 247, 20, 83, 69, 224, 200, 234, 69, 117, 44, 232, 13, 107, 84, 254, 9, 106, 54, 228, 60, 31, 152, 183, 240, 101,
-    35, 246, 0, 159, 233, 235, 252, 252, 37, 20, 71, 145, 130, 144, 142, 166, 65, 183, 193, 21, 56, 131, 222, 236, 159,
-    204, 116, 149, 94, 212, 84, 115, 28, 201, 99, 98, 212, 1, 31, 203, 78, 189, 145, 76, 177, 172, 184, 251, 129, 177,
-    148, 0, 48, 149, 182, 80, 230, 252, 31, 230, 181, 27, 248, 82, 215, 148, 195, 184, 2, 119, 80, 124, 15, 252, 168,
-    229, 124, 173, 64, 59, 77, 116, 108, 106, 19, 84, 28, 173, 246, 47, 100, 27, 209, 97, 63, 49, 59, 113, 106, 122,
-    115, 91, 87, 210, 27, 30, 99, 213, 20, 21, 117, 54, 182, 8, 66, 217, 170, 5, 135, 190, 245, 255, 247, 232, 163, 49,
-    138, 92, 146, 215, 173, 18, 115, 2, 117, 2, 65, 192, 121, 111, 4, 166, 148, 82, 40, 144, 236, 228, 147, 99, 91, 14,
-    198, 252, 20, 150, 93, 90, 64, 180, 160, 62, 139, 112, 56, 158, 23, 172, 187, 230, 255, 66, 111, 253, 67, 95, 248,
-    203, 23, 215, 33, 251, 91, 40, 203, 35, 71, 77, 215, 86, 220, 178, 150, 215, 77, 115, 153, 107, 67, 105, 224, 204,
-    247, 144, 141, 61, 151, 89, 144, 145, 192, 67, 238, 135, 4, 137, 230, 4, 82, 238, 15, 186, 150, 190, 145, 237, 104,
-    120, 36, 237, 224, 96, 200, 191, 42, 116, 103, 17, 31, 11, 236, 27, 200, 253, 143, 247, 37, 28, 138, 96, 168, 51,
-    186, 141, 220, 97, 82, 33, 141, 129, 184, 120, 63, 25, 239, 67, 0, 66, 13, 50, 192, 67, 181, 180, 112, 33, 15, 63,
-    184, 156, 221, 231, 39, 212, 207, 136, 54, 194, 102, 193, 71, 195, 127, 100, 195, 114, 217, 213, 233, 121, 85, 244,
-    31, 110, 175, 62, 72, 80, 4, 147, 92, 2, 106, 150, 240, 28, 185, 25, 153, 108, 247, 115, 92, 197, 27, 200, 101, 67,
-    91, 105, 199, 171, 111, 188, 243, 57, 11, 30, 71, 30, 0, 210, 122, 97, 141, 242, 34, 155, 87, 87, 32, 153, 232, 118,
-    41, 194, 82, 200, 110, 218, 135, 247, 160, 15, 73, 10, 86, 186, 191, 27, 206, 227, 111, 150, 98, 78, 38, 170, 36,
-    133, 131, 253, 232, 231, 149, 33, 74, 230, 221, 130, 11, 191, 111, 185, 75, 27, 108, 19, 13, 15, 170, 87, 225, 1,
-    221, 42, 238, 146, 10, 10, 69, 255, 202, 134, 55, 200, 92, 27, 46, 38, 29, 134, 74, 131, 153, 61, 40, 63, 241, 52,
-    76, 143, 151, 89, 208, 147, 238, 0, 210, 35, 99, 121, 181, 72, 94, 47, 15, 107, 44, 184, 142, 74, 175, 0, 225, 134,
-    105, 168, 97, 238, 199, 167, 200, 146, 124, 127, 59, 157, 15, 5, 237, 60, 17, 60, 73, 247, 193, 80, 208, 88, 187, 2,
-    93, 14, 15, 169, 77, 108, 10, 202, 96, 22, 27, 29, 166, 51, 95, 75, 194, 121, 132, 129, 118, 37, 130, 63, 193, 237,
-    163, 93, 117, 69, 206, 69, 109, 118, 69, 235, 115, 117, 79, 242, 68, 81, 231, 107, 152, 98, 82, 136, 214, 105, 41,
-    50, 79, 22, 35, 139, 80, 33, 3, 48, 241, 138, 91, 191, 106, 60, 85, 14, 71, 242, 179, 43, 7, 179, 222, 102, 125,
-    232, 204, 159, 62, 31, 9, 203, 242, 43, 10, 223, 149, 53, 67, 101, 114, 186, 88, 1, 71, 24, 34, 155, 105, 159, 240,
-    213, 22, 70, 90, 6, 203, 209, 82, 246, 38, 62, 113, 163, 139, 176, 29, 112, 125, 245, 182, 105, 98, 83, 206, 45,
-    239, 51, 144, 110, 233, 231, 59, 209, 215, 99, 62, 53, 89, 41, 127, 2, 85, 16, 114, 150, 100, 141, 227, 125, 116, 9,
-    156, 250, 209, 128, 253, 38, 121, 238, 234, 94, 85, 112, 25, 73, 174, 238, 229, 21, 197, 24, 81, 13, 10, 87, 68,
-    161, 72, 150, 140, 254, 69, 47, 79, 205, 2, 101, 113, 179, 217, 124, 36, 167, 28, 26, 8, 173, 47, 15, 222, 194, 148,
-    188, 59, 37, 157, 172, 49, 42, 224, 136, 223, 140, 246, 0, 11, 155, 202, 93, 143, 183, 240, 105, 218, 103, 92, 74,
-    39, 223, 157, 215, 48, 176, 141, 118, 175, 15, 66, 15, 226, 6, 133, 249, 215, 224, 188, 80, 68, 181, 134, 215, 161,
-    201, 106, 61, 113, 223, 200, 31, 139, 151, 235, 153, 119, 235, 139, 166, 246, 76, 206, 165, 254, 226, 59, 253, 16,
-    146, 118, 16, 233, 169, 93, 38, 79, 65, 56, 55, 113, 244, 123, 100, 143, 3, 15, 49, 196, 233, 96, 50, 104, 131, 87,
-    224, 137, 47, 24, 19, 98, 203, 115, 101, 3, 97, 224, 209, 134, 57, 241, 3, 254, 207, 216, 219, 195, 103, 20, 10,
-    230, 38, 243, 144, 243, 52, 215, 5, 99, 40, 173, 84, 47, 218, 31, 197, 97, 194, 97, 178, 161, 230, 1, 150, 189, 62,
-    243, 141, 121, 98, 39, 101, 53, 96, 40, 92, 8, 243, 185, 179, 134, 69, 56, 46, 31, 43, 113, 58, 36, 6, 57, 12, 175,
-    0, 64, 136, 84, 189, 151, 36, 251, 80, 223, 128, 139, 249, 177, 108, 25, 223, 143, 138, 177, 136, 159, 119, 167,
-    222, 63, 107, 98, 130, 61, 105, 220, 76, 229, 117, 231, 219, 79, 210, 36, 201, 202, 213, 219, 18, 235, 173, 16, 109,
-    176, 68, 130, 100, 235, 234, 222, 91, 89, 77, 191, 140, 11, 208, 187, 212, 74, 170, 212, 187, 197, 129, 110, 166,
-    66, 47, 81, 45, 32, 126, 201, 0, 109, 110, 25, 102, 221, 97, 74, 235, 6, 87, 13, 197, 99, 201, 48, 172, 250, 98,
-    127, 6, 142, 0, 219, 169, 31, 6, 165, 241, 208, 206, 239, 166, 74, 25, 90, 99, 110, 126, 64, 164, 10, 172, 126, 78,
-    39, 134, 12, 65, 59, 212, 154, 35, 51, 128, 237, 10, 108, 212, 158, 105, 125, 157, 239, 131, 182, 167, 7, 242, 136,
-    87, 107, 107, 206, 91, 80, 171, 204, 234, 83, 158, 185, 127, 191, 185, 89, 204, 45, 132, 60, 166, 81, 27, 80, 228,
-    36, 149, 129, 36, 2, 163, 41, 154, 35, 50, 27, 28, 182, 151, 238, 63, 85, 13, 115, 157, 169, 2, 159, 37, 246, 30,
-    157, 81, 220, 143, 70, 226, 224, 214, 137, 117, 53, 161, 216, 97, 175, 199, 2, 250, 117, 184, 16, 153, 29, 186, 61,
-    214, 42, 81, 228, 41, 107, 253, 54, 25, 51, 242, 94, 18, 25, 166, 57, 113, 27, 131, 101, 169, 84, 237, 234, 32, 125,
-    31, 78, 39, 218, 166, 179, 123, 92, 144, 189, 222, 251, 25, 215, 4, 98, 62, 226, 121, 98, 170, 180, 118, 163, 10,
-    70, 145, 249, 217, 223, 55, 181, 174, 120, 68, 173, 80, 87, 177, 217, 142, 34, 23, 109, 176, 60, 136, 1, 226, 91,
-    102, 121, 90, 123, 123, 243, 198, 102, 240, 25, 206, 255, 132, 5, 79, 109, 29, 94, 214, 18, 228, 238, 11, 157, 64,
-    92, 107, 6, 24, 109, 233, 156, 204, 22, 59, 189, 102, 173, 130, 162, 181, 127, 227, 73, 148, 248, 17, 52, 78, 199,
-    54, 202, 78, 134, 180, 202, 124, 17, 136, 142, 17, 71, 209, 218, 111, 22, 255, 163, 67, 1, 126, 83, 69, 244, 129,
-    231, 100, 130, 61, 225, 220, 198, 249, 230, 84, 174, 143, 25, 155, 105, 87, 207, 222, 246, 150, 9, 102, 210, 63,
-    238, 27, 174, 13, 43, 13, 29, 30, 112, 27, 184, 20, 84, 232, 252, 75, 69, 45, 144, 118, 153, 140, 14, 168, 204, 197,
-    113, 81, 173, 81, 152, 194, 105, 241, 76, 33, 203, 67, 216, 255, 57, 10, 134, 213, 196, 216, 79, 184, 76, 90, 246,
-    119, 98, 76, 197, 251, 253, 152, 73, 209, 201, 168, 180, 246, 212, 9, 14, 91, 10, 57, 167, 167, 188, 241, 15, 251,
-    191, 174, 158, 57, 128, 132, 140, 183, 13, 8, 155, 187, 17, 123, 245, 206, 140, 28, 111, 47, 84, 79, 225, 38, 151,
-    137, 210, 189, 110, 106, 122, 199, 133, 34, 140, 98, 201, 50, 176, 161, 248, 85, 174, 110, 53, 104, 185, 194, 131,
-    159, 167, 172, 190, 14, 247, 56, 16, 160, 86, 121, 201, 239, 157, 56, 219, 60, 249, 216, 237, 150, 251, 78, 43, 247,
-    203, 167, 5, 238, 140, 220, 233, 206, 83, 228, 213, 131, 10, 49, 211, 166, 119, 161, 36, 88, 236, 1, 98, 62, 89,
-    241, 4, 59, 115, 99, 77, 186, 171, 35, 68, 84, 249, 225, 73, 227, 48, 148, 72, 171, 135, 42, 95, 51, 29, 77, 5, 22,
-    90, 175, 188, 127, 83, 195, 236, 217, 10, 39, 215, 54, 162, 178, 19, 206, 180, 90, 70, 215, 116, 133, 136, 117, 75,
-    170, 146, 55, 84, 71, 234, 255, 92, 179, 224, 71, 204, 29, 112, 105, 104, 113, 237, 235, 40, 45, 231, 198, 171, 243,
-    19, 176, 219, 166, 122, 71, 165, 200, 18, 158, 54, 245, 91, 162, 42, 80, 6, 247, 85, 82, 69, 13, 246, 30, 239, 233,
-    228, 54, 129, 126, 54, 102, 19, 81, 134, 97, 108, 102, 9, 154, 134, 177, 115, 47, 62, 83, 166, 51, 175, 46, 44, 10,
-    128, 158, 86, 35, 128, 124, 144, 20, 64, 121, 62, 241, 217, 93, 85, 36, 58, 58, 242, 63, 146, 172, 64, 5, 167, 113,
-    96, 63, 172, 84, 149, 255, 214, 242, 107, 97, 69, 31, 97, 217, 168, 86, 8, 148, 62, 6, 124, 121, 53, 63, 201, 57,
-    177, 78, 0, 89, 204, 28, 38, 130, 170, 96, 168, 74, 149, 172, 209, 59, 252, 194, 11, 161, 43, 88, 249, 123, 147,
-    165, 125, 201, 122, 133, 42, 39, 94, 232, 75, 43, 120, 100, 37, 232, 155, 46, 51, 104, 31, 231, 238, 67, 229, 113,
-    74, 70, 156, 196, 12, 32, 174, 217, 219, 152, 115, 124, 246, 186, 58, 29, 93, 64, 151, 230, 194, 16, 173, 206, 246,
-    102, 138, 48, 201, 152, 125, 250, 29, 41, 21, 5, 238, 203, 34, 77, 69, 100, 233, 227, 28, 222, 76, 62, 83, 7, 225,
-    88, 69, 105, 86, 149, 165, 105, 8, 123, 20, 149, 12, 157, 82, 180, 37, 67, 237, 60, 46, 96, 46, 113, 107, 7, 73,
-    211, 221, 221, 228, 159, 175, 208, 127, 165, 55, 241, 159, 96, 38, 83, 210, 241, 58, 62, 156, 10, 108, 169, 140, 8,
-    9, 121, 168, 177, 64, 251, 198, 186, 145, 80, 135, 195, 239, 185, 136, 54, 192, 211, 84, 161, 65, 10, 197, 78, 40,
-    169, 64, 38, 193, 219, 190, 241, 252, 83, 123, 234, 222, 234, 242, 37, 166, 201, 86, 232, 218, 208, 199, 62, 28,
-    143, 58, 72, 19, 192, 252, 221, 188, 146, 147, 250, 73, 18, 103, 81, 38, 15, 80, 71, 97, 164, 57, 251, 173, 94, 227,
-    206, 184, 124, 111, 196, 131, 6, 99, 50, 79, 32, 237, 169, 82, 169, 5, 254, 10, 68, 36, 247, 226, 8, 164, 139, 191,
-    207, 228, 210, 190, 3, 238, 160, 74, 242, 90, 250, 139, 246, 137, 205, 202, 197, 179, 144, 81, 224, 5, 130, 242,
-    197, 253, 23, 184, 164, 84, 88, 4, 27, 241, 114, 242, 70, 179, 213, 148, 18, 97, 173, 70, 241, 109, 165, 11, 13,
-    216, 98, 59, 22, 248, 47, 197, 220, 128, 35, 39, 81, 210, 93, 166, 165, 214, 94, 131, 163, 109, 95, 244, 82, 142,
-    136, 159, 101, 97, 14, 145, 125, 129, 106, 99, 167, 44, 34, 143, 92, 205, 148, 123, 17, 239, 119, 144, 123, 28, 233,
-    133, 164, 120, 212, 194, 182, 111, 197, 151, 156, 101, 115, 198, 5, 203, 190, 13, 222, 53, 197, 109, 69, 89, 239,
-    155, 136, 11, 231, 94, 148, 136, 40, 16, 149, 116, 85, 41, 204, 177, 66, 35, 193, 139, 98, 76, 62, 152, 1, 247, 189,
-    62, 143, 56, 230, 106, 153, 247, 15, 12, 32, 67, 216, 108, 32, 196, 201, 203, 126, 130, 220, 90, 16, 123, 230, 218,
-    169, 161, 152, 93, 198, 160, 151, 23, 54, 188, 254, 145, 208, 224, 104, 94, 4, 76, 20, 38, 156, 158, 59, 124, 85,
-    150, 15, 20, 155, 192, 205, 166, 97, 213, 126, 38, 45, 142, 13, 137, 50, 45, 235, 252, 34, 141, 29, 49, 171, 117,
-    207, 159, 11, 167, 178, 225, 242, 221, 181, 206, 24, 110, 111, 220, 111, 86, 199, 25, 115, 129, 102, 114, 101, 58,
-    174, 78, 100, 208, 151, 41, 50, 91, 95, 89, 15, 75, 234, 1, 61, 85, 26, 195, 140, 51, 130, 15, 99, 148, 114, 221,
-    154, 124, 201, 211, 190, 157, 145, 216, 100, 85, 87, 79, 3, 5, 3, 174, 104, 158, 230, 221, 98, 191, 75, 84, 90, 205,
-    48, 46, 119, 36, 6, 253, 128, 246, 142, 42, 163, 192, 220, 64, 42, 200, 61, 77, 10, 62, 120, 141, 5, 150, 160, 100,
-    20, 172, 94, 68, 214, 94, 143, 112, 250, 64, 230, 93, 241, 41, 118, 153, 132, 102, 204, 199, 245, 213, 84, 130, 84,
-    26, 245, 99, 35, 57, 32, 132, 199, 114, 181, 158, 28, 230, 75, 200, 62, 74, 232, 58, 236, 109, 190, 151, 218, 206,
-    150, 214, 160, 70, 164, 76, 126, 62, 156, 227, 77, 73, 166, 95, 28, 71, 80, 125, 14, 43, 83, 75, 32, 34, 119, 222,
-    208, 109, 25, 90, 46, 142, 54, 87, 169, 201, 187, 71, 35, 160, 21, 127, 33, 19, 147, 80, 238, 112, 107, 90, 25, 125,
-    67, 189, 13, 106, 249, 60, 85, 47, 31, 48, 113, 44, 33, 69, 86, 23, 82, 46, 50, 130, 85, 61, 237, 161, 65, 126, 79,
-    72, 217, 16, 240, 105, 88, 54, 35, 106, 107, 119, 210, 166, 243, 211, 17, 135, 122, 222, 60, 113, 188, 91, 170, 15,
-    17, 124, 120, 213, 13, 0, 49, 75, 253, 24, 220, 193, 161, 118, 107, 90, 74, 234, 76, 233, 216, 96, 26, 225, 189,
-    114, 140, 148, 231, 109, 243, 239, 143, 224, 116, 97, 123, 126, 207, 181, 0, 147, 195, 210, 211, 84, 197, 235, 73,
-    15, 142, 175, 206, 92, 153, 155, 248, 188, 6, 97, 6, 207, 20, 59, 230, 209, 216, 98, 30, 58, 214, 234, 195, 238, 75,
-    56, 42, 178, 116, 30, 48, 218, 170, 116, 37, 81, 99, 166, 231, 98, 255, 44, 58, 5, 208, 145, 18, 45, 151, 127, 157,
-    123, 27, 71, 99, 108, 135, 173, 127, 213, 60, 252, 8, 34, 95, 168, 120, 240, 154, 43, 213, 186, 236, 98, 64, 72, 19,
-    111, 114, 202, 171, 254, 186, 164, 148, 40, 186, 183, 213, 60, 6, 49, 219, 31, 126, 230, 88, 219, 189, 52, 76, 39,
-    6, 135, 245, 14, 191, 131, 73, 207, 254, 39, 245, 51, 46, 18, 88, 245, 14, 244, 165, 232, 15, 76, 52, 208, 44, 181,
-    163, 174, 183, 245, 179, 142, 166, 50, 68, 163, 161, 7, 197, 80, 211, 136, 41, 191, 146, 30, 108, 89, 53, 248, 17,
-    93, 223, 106, 161, 161, 202, 171, 49, 3, 186, 214, 5, 48, 127, 102, 8, 68, 195, 7, 93, 105, 131, 7, 237, 32, 144,
-    71, 230, 58, 237, 79, 61, 58, 7, 12, 171, 14, 126, 92, 210, 157, 107, 182, 6, 254, 248, 194, 253, 94, 5, 237, 133,
-    218, 54, 8, 3, 253, 77, 154, 36, 141, 63, 32, 152, 9, 164, 50, 92, 207, 66, 176, 78, 48, 226, 248, 59, 16, 168, 52,
-    28, 238, 235, 205, 131, 99, 181, 171, 178, 223, 226, 68, 61, 159, 40, 14, 164, 179, 23, 152, 7, 79, 83, 150, 157,
-    173, 68, 48, 17, 96, 179, 15, 37, 131, 229, 34, 157, 250, 40, 110, 4, 250, 31, 46, 205, 111, 249, 110, 172, 96, 148,
-    185, 113, 221, 138, 1, 235, 190, 1, 92, 126, 113, 193, 78, 38, 253, 226, 201, 141, 131, 5, 229, 174, 250, 227, 255,
-    64, 192, 80, 204, 54, 55, 227, 13, 133, 59, 65, 72, 192, 129, 185, 161, 243, 186, 94, 82, 194, 254, 160, 115, 56,
-    232, 147, 200, 197, 215, 148, 119, 205, 148, 223, 64, 55, 74, 79, 96, 187, 37, 70, 183, 91, 128, 167, 215, 103, 191,
-    175, 202, 47, 254, 43, 4, 249, 27, 231, 101, 247, 33, 46, 113, 47, 98, 136, 148, 129, 13, 8, 72, 215, 247, 163, 161,
-    102, 41, 220, 49, 55, 23, 118, 75, 129, 91, 255, 54, 60, 74, 240, 1, 162, 3, 84, 194, 131, 40, 48, 166, 220, 98, 90,
-    14, 249, 240, 132, 49, 209, 78, 251, 154, 117, 101, 185, 73, 150, 231, 144, 38, 99, 61, 51, 80, 124, 208, 68, 248,
-    239, 234, 108, 183, 54, 1, 231, 135, 161, 43, 81, 18, 97, 234, 198, 128, 72, 5, 187, 27, 97, 12, 93, 213, 50, 131,
-    18, 229, 34, 180, 34, 119, 132, 145, 227, 21, 148, 170, 203, 223, 183, 2, 70, 83, 192, 51, 227, 135, 193, 207, 0,
-    21, 125, 83, 30, 94, 169, 92, 33, 15, 225, 187, 73, 80, 184, 162, 163, 171, 151, 218, 221, 216, 117, 198, 118, 148,
-    226, 248, 40, 100, 160, 163, 154, 35, 234, 201, 30, 251, 162, 16, 107, 58, 208, 206, 126, 9, 170, 246, 25, 6, 162,
-    245, 65, 88, 23, 24, 86, 53, 121, 155, 134, 147, 150, 212, 66, 76, 243, 253, 92, 242, 19, 133, 84, 178, 112, 206,
-    26, 123, 13, 132, 90, 246, 43, 46, 49, 0, 166, 31, 27, 30, 225, 46, 167, 20, 88, 34, 57, 39, 30, 128, 31, 60, 230,
-    132, 138, 133, 47, 62, 205, 151, 129, 19, 22, 199, 174, 197, 242, 40, 210, 61, 252, 135, 125, 47, 154, 134, 110, 53,
-    23, 66, 71, 150, 106, 213, 75, 131, 118, 202, 51, 36, 249, 250, 55, 156, 23, 187, 94, 239, 139, 214, 1, 222, 142,
-    154, 73, 79, 160, 252, 253, 68, 102, 169, 4, 2, 247, 115, 88, 152, 153, 45, 41, 78, 155, 92, 174, 193, 209, 133, 25,
-    144, 84, 103, 106, 34, 237, 67, 173, 181, 25, 113, 125, 94, 114, 70, 55, 203, 242, 77, 65, 96, 59, 123, 79, 153, 14,
-    210, 119, 142, 79, 249, 249, 239, 29, 146, 4, 94, 9, 131, 159, 223, 130, 33, 68, 5, 35, 5, 158, 157, 121, 210, 102,
-    146, 230, 113, 36, 14, 53, 35, 29, 130, 240, 5, 229, 239, 120, 136, 65, 71, 117, 80, 191, 79, 52, 64, 194, 10, 64,
-    211, 126, 126, 225, 252, 45, 162, 200, 73, 173, 51, 220, 32, 156, 31, 138, 153, 139, 166, 158, 235, 191, 162, 158,
-    211, 64, 247, 134, 194, 15, 186, 188, 157, 81, 50, 159, 52, 64, 136, 73, 235, 124, 17, 218, 156, 52, 138, 118, 78,
-    187, 214, 61, 181, 64, 148, 78, 201, 27, 1, 35, 170, 246, 105, 145, 3, 207, 131, 139, 172, 82, 17, 205, 51, 232,
-    123, 219, 12, 255, 181, 230, 154, 50, 69, 132, 132, 6, 35, 111, 202, 72, 58, 84, 170, 108, 79, 147, 19, 37, 249, 1,
-    109, 32, 172, 249, 158, 111, 30, 154, 117, 69, 170, 225, 126, 141, 42, 38, 23, 222, 243, 255, 31, 0, 212, 170, 7,
-    56, 113, 168, 211, 81, 152, 38, 198, 91, 89, 18, 188, 201, 29, 114, 120, 62, 83, 22, 104, 11, 67, 190, 36, 99, 118,
-    76, 65, 237, 232, 7, 136, 103, 118, 53, 71, 100, 60, 60, 211, 165, 112, 154, 59, 150, 132, 190, 111, 4, 38, 15, 18,
-    249, 11, 30, 74, 197, 44, 131, 147, 126, 149, 254, 152, 194, 189, 14, 139, 178, 183, 194, 222, 56, 36, 193, 74, 196,
-    159, 235, 101, 72, 2, 123, 201, 179, 146, 101, 171, 48, 25, 220, 174, 131, 62, 4, 9, 174, 133, 179, 36, 117, 210,
-    135, 248, 4, 132, 157, 157, 94, 12, 93, 100, 3, 225, 41, 118, 119, 195, 40, 140, 18, 230, 18, 35, 102, 155, 28, 127,
-    219, 65, 75, 130, 89, 5, 120, 207, 6, 91, 233, 51, 204, 9, 114, 7, 113, 187, 90, 90, 227, 33, 210, 211, 115, 67, 72,
-    208, 147, 77, 87, 191, 194, 68, 186, 222, 231, 211, 102, 240, 129, 224, 133, 24, 28, 196, 141, 254, 8, 180, 215,
-    210, 137, 169, 126, 47, 78, 183, 155, 198, 235, 179, 27, 210, 199, 31, 167, 101, 236, 50, 100, 137, 249, 227, 232,
-    146, 55, 96, 6, 75, 255, 134, 174, 67, 5, 242, 186, 140, 5, 242, 92, 98, 188, 35, 33, 209, 77, 98, 148, 86, 46, 116,
-    171, 194, 1, 116, 166, 142, 14, 243, 234, 135, 201, 129, 107, 164, 201, 252, 130, 164, 131, 154, 30, 246, 41, 54,
-    87, 107, 152, 94, 212, 98, 220, 0, 193, 126, 93, 223, 188, 108, 60, 208, 61, 137, 156, 165, 109, 188, 211, 187, 77,
-    138, 159, 142, 49, 81, 146, 20, 212, 106, 124, 235, 0, 163, 152, 48, 15, 214, 134, 35, 240, 116, 179, 30, 170, 215,
-    204, 99, 77, 198, 91, 26, 76, 99, 34, 140, 130, 91, 181, 195, 101, 204, 70, 30, 62, 145, 52, 14, 124, 55, 115, 139,
-    53, 100, 169, 158, 207, 184, 98, 90, 50, 107, 208, 102, 167, 192, 0, 207, 54, 229, 46, 239, 81, 248, 239, 230, 247,
-    243, 243, 74, 82, 85, 111, 6, 109, 98, 193, 55, 115, 119, 222, 227, 105, 65, 146, 64, 247, 220, 29, 252, 50, 129,
-    135, 118, 210, 111, 68, 5, 142, 128, 121, 55, 60, 244, 15, 161, 12, 187, 30, 225, 200, 176, 231, 86, 26, 99, 145,
-    157, 249, 164, 69, 132, 77, 242, 169, 48, 248, 15, 249, 42, 212, 219, 182, 104, 24, 20, 135, 61, 148, 149, 40, 211,
-    119, 28, 117, 129, 78, 118, 114, 234, 63, 128, 177, 123, 93, 237, 149, 82, 38, 242, 82, 169, 109, 91, 25, 77, 9, 42,
-    155, 189, 88, 17, 80, 167, 12, 249, 180, 173, 218, 173, 146, 139, 182, 195, 217, 224, 79, 227, 149, 229, 244, 198,
-    99, 41, 98, 48, 157, 239, 57, 226, 192, 131, 178, 91, 225, 50, 143, 237, 3, 110, 223, 59, 211, 198, 151, 59, 186,
-    152, 204, 96, 249, 222, 17, 208, 172, 122, 82, 90, 236, 167, 44, 199, 69, 212, 58, 43, 118, 182, 76, 79, 64, 181,
-    116, 211, 238, 174, 216, 137, 230, 67, 206, 200, 177, 244, 1, 36, 115, 179, 209, 196, 209, 49, 48, 168, 104, 213,
-    189, 59, 95, 95, 118, 106, 61, 183, 169, 194, 62, 182, 2, 113, 18, 58, 85, 169, 101, 127, 254, 94, 189, 251, 206,
-    154, 41, 117, 171, 82, 189, 101, 157, 16, 21, 161, 60, 78, 43, 112, 28, 104, 113, 111, 70, 32, 186, 91, 141, 115,
-    148, 103, 78, 119, 86, 59, 19, 194, 27, 166, 194, 167, 162, 238, 246, 166, 241, 8, 38, 167, 115, 245, 89, 192, 82,
-    229, 47, 225, 58, 54, 149, 156, 51, 147, 64, 33, 144, 254, 154, 161, 109, 36, 55, 80, 66, 119, 169, 187, 130, 142,
-    162, 110, 91, 88, 72, 144, 206, 155, 49, 115, 59, 132, 213, 19, 144, 117, 105, 3, 237, 160, 120, 41, 235, 54, 94, 0,
-    94, 170, 174, 129, 176, 78, 35, 6, 135, 253, 173, 61, 104, 99, 23, 113, 82, 98, 31, 43, 158, 57, 179, 239, 53, 168,
-    160, 132, 161, 96, 180, 235, 102, 64, 189, 160, 111, 74, 171, 186, 39, 124, 186, 247, 22, 12, 49, 183, 108, 191, 73,
-    39, 73, 232, 48, 248, 161, 62, 154, 98, 1, 125, 78, 28, 16, 215, 162, 11, 247, 5, 123, 176, 182, 220, 82, 53, 204,
-    182, 213, 80, 130, 168, 208, 3, 232, 40, 212, 239, 196, 78, 212, 8, 113, 22, 107, 56, 162, 236, 65, 24, 33, 132, 23,
-    183, 69, 33, 179, 246, 35, 99, 118, 18, 67, 207, 133, 114, 178, 141, 179, 226, 84, 229, 42, 27, 112, 169, 38, 178,
-    143, 153, 122, 246, 1, 95, 253, 77, 165, 138, 179, 70, 22, 196, 103, 253, 34, 149, 220, 179, 241, 98, 71, 128, 64,
-    196, 105, 93, 147, 39, 17, 76, 191, 149, 135, 198, 168, 19, 62, 166, 112, 29, 136, 245, 250, 54, 238, 210, 163, 0,
-    198, 32, 192, 94, 184, 5, 135, 50, 168, 2, 8, 54, 152, 170, 229, 29, 106, 195, 206, 146, 191, 235, 95, 212, 87, 251,
-    164, 1, 109, 122, 127, 252, 143, 107, 30, 86, 2, 216, 45, 128, 252, 213, 14, 252, 202, 58, 144, 51, 184, 231, 10,
-    57, 156, 10, 171, 100, 180, 103, 7, 106, 89, 65, 57, 8, 192, 227, 49, 213, 220, 0, 208, 111, 166, 134, 57, 108, 1,
-    251, 83, 238, 48, 239, 130, 159, 249, 222, 11, 51, 51, 78, 109, 201, 72, 221, 80, 113, 84, 61, 76, 184, 67, 79, 66,
-    35, 237, 235, 177, 239, 154, 64, 154, 181, 154, 185, 53, 24, 53, 82, 14, 237, 67, 63, 160, 208, 197, 31, 217, 176,
-    52, 11, 120, 222, 156, 179, 107, 64, 171, 66, 121, 5, 94, 72, 151, 240, 113, 106, 91, 215, 72, 151, 200, 50, 65,
-    218, 244, 70, 253, 203, 82, 9, 229, 60, 252, 19, 229, 105, 129, 234, 26, 197, 76, 164, 61, 75, 101, 43, 217, 113,
-    242, 43, 115, 143, 163, 111, 215, 187, 79, 115, 2, 94, 175, 81, 162, 28, 14, 101, 69, 229, 123, 17, 185, 252, 90,
-    38, 161, 72, 140, 60, 45, 109, 189, 232, 225, 204, 238, 35, 182, 144, 208, 164, 142, 108, 104, 224, 39, 121, 246,
-    204, 227, 74, 165, 0, 82, 19, 6, 19, 22, 84, 74, 110, 69, 120, 220, 51, 204, 75, 20, 9, 143, 107, 151, 18, 4, 143,
-    157, 46, 47, 43, 177, 62, 50, 137, 238, 174, 69, 154, 76, 13, 166, 85, 24, 155, 20, 231, 161, 26, 195, 150, 63, 35,
-    150, 82, 88, 110, 203, 132, 132, 167, 124, 246, 61, 89, 31, 96, 41, 208, 79, 120, 174, 82, 83, 68, 177, 79, 6, 161,
-    182, 157, 248, 176, 112, 197, 241, 243, 213, 150, 19, 52, 206, 120, 90, 249, 58, 146, 159, 36, 101, 168, 81, 42,
-    130, 102, 137, 150, 180, 211, 231, 217, 49, 162, 133, 53, 180, 85, 47, 193, 129, 107, 130, 254, 163, 238, 50, 182,
-    17, 174, 38, 8, 193, 246, 38, 43, 163, 126, 141, 120, 197, 19, 107, 196, 240, 152, 112, 142, 171, 188, 24, 114, 45,
-    159, 100, 119, 126, 48, 196, 17, 229, 92, 247, 166, 241, 129, 179, 161, 24, 68, 0, 131, 145, 171, 165, 189, 197,
-    128, 141, 163, 174, 236, 217, 24, 27, 22, 182, 52, 84, 128, 152, 177, 94, 102, 228, 206, 81, 91, 232, 95, 142, 41,
-    154, 218, 121, 242, 224, 253, 141, 244, 147, 222, 23, 225, 29, 222, 219, 184, 20, 2, 233, 70, 239, 87, 57, 112, 250,
-    229, 247, 12, 71, 34, 164, 150, 73, 102, 66, 185, 213, 226, 172, 217, 255, 125, 250, 98, 84, 35, 43, 81, 240, 200,
-    225, 102, 55, 174, 94, 95, 107, 196, 118, 157, 66, 244, 46, 34, 33, 162, 153, 28, 85, 36, 110, 86, 93, 212, 205,
-    214, 41, 188, 175, 224, 100, 99, 154, 185, 228, 193, 187, 246, 160, 239, 19, 3, 220, 123, 60, 126, 186, 34, 128,
-    236, 73, 155, 182, 242, 98, 183, 139, 217, 188, 180, 176, 107, 245, 135, 105, 184, 5, 7, 138, 52, 117, 146, 68, 17,
-    234, 141, 33, 214, 134, 74, 249, 225, 141, 211, 90, 255, 18, 207, 183, 63, 91, 24, 147, 134, 50, 193, 60, 41, 12,
-    66, 90, 12, 213, 254, 152, 62, 152, 145, 130, 108, 48, 173, 220, 72, 224, 178, 208, 102, 245, 233, 7, 146, 232, 74,
-    34, 232, 113, 232, 198, 11, 152, 171, 140, 209, 172, 83, 227, 20, 180, 64, 179, 60, 74, 247, 131, 220, 62, 255, 73,
-    160, 47, 141, 63, 8, 110, 38, 203, 166, 135, 198, 174, 52, 28, 94, 229, 95, 235, 36, 22, 163, 59, 135, 54, 192, 226,
-    153, 214, 49, 86, 20, 11, 36, 154, 160, 27, 131, 95, 133, 124, 204, 229, 247, 151, 141, 149, 189, 68, 103, 68, 71,
-    42, 18, 135, 41, 78, 185, 251, 1, 110, 93, 142, 79, 127, 43, 50, 105, 72, 195, 51, 102, 145, 76, 61, 44, 23, 198,
-    109, 120, 136, 115, 158, 5, 215, 128, 2, 253, 253, 214, 190, 32, 73, 80, 43, 255, 30, 166, 139, 182, 167, 170, 46,
-    57, 115, 1, 137, 91, 56, 134, 44, 184, 214, 229, 120, 41, 132, 144, 254, 81, 123, 40, 31, 198, 72, 29, 210, 101,
-    236, 185, 141, 41, 113, 158, 47, 241, 14, 109, 192, 194, 236, 42, 46, 182, 237, 115, 98, 249, 27, 120, 153, 108,
-    142, 251, 114, 94, 122, 11, 94, 9, 25, 232, 171, 246, 46, 12, 112, 135, 191, 112, 115, 132, 55, 8, 120, 122, 45,
-    202, 148, 61, 128, 222, 37, 17, 192, 14, 22, 132, 147, 14, 217, 157, 12, 121, 8, 107, 21, 247, 200, 179, 107, 164,
-    221, 97, 30, 105, 92, 111, 82, 20, 147, 220, 36, 227, 143, 238, 143, 35, 13, 19, 184, 107, 152, 227, 142, 167, 27,
-    181, 55, 55, 77, 207, 166, 12, 167, 96, 161, 211, 168, 38, 228, 228, 125, 248, 110, 163, 85, 212, 205, 247, 39, 75,
-    37, 56, 140, 21, 37, 21, 187, 223, 227, 33, 192, 152, 132, 137, 58, 84, 178, 42, 225, 16, 217, 59, 215, 112, 205,
-    191, 25, 34, 155, 102, 130, 127, 254, 47, 107, 15, 59, 146, 240, 243, 115, 232, 91, 192, 213, 139, 18, 21, 189, 176,
-    92, 170, 147, 63, 194, 184, 17, 65, 129, 227, 193, 88, 175, 239, 128, 30, 87, 58, 52, 208, 151, 86, 48, 115, 243,
-    238, 231, 112, 224, 142, 148, 220, 44, 241, 72, 36, 160, 248, 141, 132, 53, 188, 2, 228, 161, 208, 15, 187, 217,
-    182, 22, 193, 168, 157, 196, 212, 140, 225, 226, 236, 71, 58, 94, 241, 93, 101, 141, 79, 169, 97, 149, 173, 121,
-    117, 142, 204, 118, 225, 137, 218, 117, 116, 240, 105, 161, 246, 129, 38, 32, 35, 229, 49, 10, 3, 255, 202, 9, 127,
-    53, 131, 89, 142, 129, 177, 18, 52, 22, 144, 90, 204, 221, 181, 124, 212, 24, 167, 216, 31, 198, 243, 166, 26, 76,
-    43, 157, 254, 191, 146, 253, 156, 251, 162, 210, 123, 165, 121, 198, 59, 245, 16, 181, 173, 49, 148, 55, 137, 97,
-    64, 20, 34, 9, 203, 245, 28, 178, 9, 190, 95, 244, 82, 131, 211, 123, 132, 222, 233, 241, 155, 132, 231, 164, 239,
-    163, 30, 49, 11, 196, 171, 23, 186, 98, 2, 248, 249, 157, 54, 127, 186, 206, 28, 48, 194, 46, 181, 191, 139, 27, 18,
-    84, 39, 5, 253, 65, 78, 182, 1, 20, 80, 139, 123, 169, 75, 179, 75, 86, 4, 194, 37, 76, 213, 34, 144, 167, 249, 107,
-    56, 160, 12, 30, 83, 35, 238, 112, 174, 42, 188, 92, 120, 201, 156, 238, 206, 50, 112, 188, 45, 63, 81, 112, 35,
-    175, 73, 224, 149, 104, 2, 136, 206, 8, 33, 188, 225, 7, 165, 16, 157, 29, 248, 149, 68, 98, 96, 84, 200, 50, 199,
-    129, 19, 245, 121, 178, 23, 198, 69, 218, 63, 9, 227, 241, 142, 188, 151, 44, 105, 234, 110, 213, 76, 31, 40, 96,
-    198, 100, 165, 198, 35, 156, 245, 154, 182, 51, 9, 39, 93, 59, 211, 13, 31, 14, 113, 153, 124, 224, 130, 56, 120,
-    221, 152, 251, 255, 188, 247, 16, 130, 45, 130, 184, 34, 151, 170, 54, 224, 4, 139, 112, 179, 53, 205, 93, 211, 254,
-    54, 87, 218, 86, 10, 49, 229, 84, 136, 4, 61, 3, 135, 163, 159, 125, 140, 176, 113, 135, 48, 17, 159, 60, 253, 134,
-    94, 181, 104, 126, 15, 226, 151, 113, 88, 244, 45, 165, 9, 63, 68, 45, 31, 51, 193, 3, 229, 189, 191, 186, 255, 125,
-    47, 204, 20, 50, 96, 125, 3, 96, 254, 147, 55, 252, 236, 30, 179, 104, 220, 114, 232, 29, 121, 72, 75, 205, 248,
-    208, 159, 134, 53, 176, 203, 146, 62, 86, 113, 21, 137, 73, 231, 19, 248, 114, 24, 222, 75, 254, 133, 249, 221, 34,
-    163, 46, 148, 29, 251, 220, 68, 102, 217, 42, 135, 102, 159, 151, 74, 3, 164, 222, 59, 219, 29, 138, 240, 16, 58,
-    159, 101, 141, 96, 161, 127, 40, 108, 149, 136, 236, 144, 40, 136, 240, 201, 247, 216, 107, 227, 21, 133, 29, 34,
-    68, 10, 151, 28, 222, 185, 113, 15, 241, 81, 183, 125, 23, 124, 250, 168, 73, 84, 176, 210, 67, 207, 32, 67, 235,
-    13, 189, 79, 13, 93, 36, 129, 136, 115, 6, 24, 52, 99, 183, 90, 134, 79, 185, 247, 219, 16, 148, 7, 130, 109, 127,
-    133, 172, 107, 136, 59, 133, 84, 2, 134, 17, 139, 44, 75, 217, 38, 242, 60, 199, 17, 127, 131, 184, 0, 99, 44, 203,
-    111, 229, 222, 176, 85, 179, 75, 41, 251, 186, 143, 33, 171, 114, 135, 215, 133, 126, 124, 167, 24, 143, 33, 167,
-    58, 1, 141, 222, 134, 62, 49, 60, 251, 37, 48, 67, 69, 140, 133, 9, 238, 219, 136, 92, 106, 181, 140, 149, 50, 132,
-    81, 165, 197, 21, 84, 229, 24, 129, 51, 104, 84, 134, 84, 84, 247, 242, 148, 226, 243, 225, 244, 99, 189, 224, 15,
-    141, 101, 223, 214, 44, 28, 30, 42, 164, 118, 81, 180, 144, 109, 204, 90, 49, 103, 83, 112, 176, 178, 151, 133, 75,
-    31, 182, 105, 154, 74, 110, 28, 73, 95, 144, 4, 142, 13, 204, 112, 69, 52, 232, 190, 148, 218, 225, 210, 94, 159, 9,
-    108, 122, 124, 204, 103, 209, 215, 101, 71, 146, 162, 65, 190, 84, 58, 232, 101, 144, 69, 181, 245, 91, 237, 233,
-    74, 242, 144, 185, 205, 181, 54, 208, 245, 29, 174, 53, 228, 68, 121, 238, 220, 134, 147, 210, 0, 249, 131, 216,
-    248, 225, 113, 200, 199, 64, 197, 68, 127, 49, 197, 20, 5, 206, 202, 62, 170, 186, 127, 167, 151, 153, 154, 127, 28,
-    239, 205, 85, 74, 226, 145, 236, 49, 88, 82, 182, 45, 92, 221, 108, 98, 120, 89, 83, 24, 84, 245, 218, 88, 90, 252,
-    163, 15, 137, 5, 249, 197, 179, 212, 168, 46, 44, 161, 177, 212, 218, 72, 173, 168, 10, 151, 112, 142, 110, 114, 10,
-    97, 94, 175, 130, 178, 136, 12, 49, 255, 136, 70, 19, 59, 6, 167, 207, 199, 178, 62, 135, 159, 163, 28, 5, 7, 100,
-    92, 89, 93, 118, 88, 48, 112, 19, 162, 233, 140, 76, 119, 122, 53, 151, 204, 166, 129, 199, 119, 44, 82, 85, 122,
-    65, 63, 22, 191, 167, 242, 35, 3, 167, 48, 170, 24, 86, 119, 240, 252, 64, 189, 51, 133, 221, 130, 154, 67, 134,
-    184, 216, 243, 186, 107, 39, 192, 13, 39, 104, 227, 47, 198, 205, 215, 194, 223, 247, 10, 51, 124, 220, 194, 63, 81,
-    136, 107, 3, 28, 167, 249, 73, 189, 234, 121, 31, 56, 22, 204, 153, 18, 86, 42, 78, 29, 45, 155, 5, 141, 179, 226,
-    133, 35, 163, 250, 102, 100, 192, 34, 245, 180, 29, 57, 50, 96, 174, 1, 83, 158, 84, 220, 221, 61, 165, 3, 107, 199,
-    169, 180, 83, 171, 63, 120, 18, 155, 14, 197, 77, 122, 246, 157, 254, 34, 248, 228, 183, 48, 22, 56, 6, 66, 164,
-    107, 218, 113, 41, 239, 190, 227, 104, 160, 205, 31, 130, 6, 174, 249, 225, 14, 233, 212, 207, 41, 55, 103, 245, 76,
-    184, 41, 43, 15, 166, 87, 44, 240, 240, 29, 31, 96, 199, 110, 84, 230, 14, 185, 217, 150, 168, 77, 59, 242, 187,
-    225, 204, 39, 107, 4, 20, 214, 130, 232, 61, 196, 103, 223, 151, 239, 106, 36, 136, 123, 115, 101, 83, 153, 219, 60,
-    111, 41, 221, 71, 193, 135, 81, 110, 49, 170, 100, 62, 60, 9, 86, 137, 2, 204, 119, 155, 22, 213, 145, 144, 6, 240,
-    240, 18, 171, 250, 248, 137, 44, 232, 184, 247, 40, 169, 54, 96, 238, 7, 99, 107, 174, 124, 162, 253, 168, 8, 95,
-    41, 184, 232, 76, 213, 110, 141, 143, 251, 205, 8, 49, 183, 61, 225, 101, 33, 38, 81, 243, 110, 146, 58, 51, 110,
-    54, 156, 145, 192, 237, 143, 239, 236, 207, 115, 36, 182, 151, 34, 252, 155, 93, 216, 155, 48, 96, 183, 214, 152,
-    81, 40, 136, 140, 140, 58, 32, 15, 60, 100, 205, 119, 18, 23, 239, 136, 76, 187, 153, 184, 178, 51, 57, 226, 118,
-    30, 4, 223, 35, 131, 49, 79, 243, 16, 187, 26, 135, 39, 26, 223, 56, 210, 153, 128, 252, 194, 51, 3, 35, 149, 196,
-    232, 221, 221, 186, 35, 49, 104, 236, 99, 3, 58, 235, 117, 0, 133, 143, 94, 161, 180, 38, 115, 66, 190, 250, 151,
-    99, 92, 26, 106, 167, 77, 198, 83, 96, 246, 156, 236, 168, 177, 76, 222, 175, 54, 211, 122, 194, 149, 71, 57, 196,
-    151, 214, 75, 174, 121, 13, 97, 61, 173, 186, 127, 199, 183, 54, 0, 99, 245, 138, 24, 175, 233, 223, 190, 132, 197,
-    113, 12, 131, 105, 187, 164, 78, 43, 144, 90, 47, 13, 19, 106, 130, 25, 37, 6, 213, 60, 205, 243, 42, 77, 192, 58,
-    196, 169, 187, 104, 168, 30, 169, 37, 134, 51, 61, 189, 48, 27, 228, 212, 155, 42, 102, 160, 227, 194, 105, 27, 78,
-    247, 189, 40, 23, 185, 238, 58, 45, 19, 207, 225, 69, 46, 75, 89, 30, 163, 177, 155, 97, 198, 109, 84, 145, 24, 235,
-    179, 255, 44, 149, 153, 194, 249, 4, 43, 178, 49, 71, 144, 206, 110, 187, 225, 172, 190, 107, 148, 140, 96, 177, 83,
-    223, 159, 36, 159, 74, 152, 1, 32, 42, 40, 124, 196, 21, 236, 252, 192, 85, 240, 67, 136, 140, 87, 156, 185, 169,
-    236, 107, 12, 173, 188, 215, 124, 132, 96, 131, 181, 150, 85, 40, 1, 191, 45, 231, 65, 56, 145, 37, 44, 5, 18, 27,
-    241, 229, 232, 62, 215, 66, 170, 10, 90, 140, 1, 176, 156, 71, 177, 101, 102, 38, 10, 188, 153, 235, 121, 12, 206,
-    36, 50, 222, 97, 56, 122, 112, 73, 88, 155, 43, 243, 41, 129, 117, 86, 63, 208, 215, 6, 183, 157, 15, 135, 158, 23,
-    99, 26, 167, 70, 24, 44, 201, 229, 146, 24, 164, 166, 147, 179, 29, 132, 10, 159, 184, 194, 112, 48, 19, 128, 133,
-    190, 211, 210, 217, 121, 26, 143, 154, 186, 19, 151, 13, 126, 151, 178, 82, 195, 88, 86, 116, 116, 144, 209, 170,
-    63, 154, 210, 58, 190, 81, 236, 127, 202, 33, 153, 144, 189, 204, 94, 51, 61, 156, 25, 206, 254, 156, 149, 162, 233,
-    68, 150, 110, 84, 166, 107, 77, 27, 201, 115, 58, 68, 112, 60, 67, 81, 135, 196, 156, 16, 166, 74, 62, 163, 117, 84,
-    166, 115, 203, 226, 113, 27, 36, 179, 72, 248, 16, 41, 241, 169, 79, 0, 52, 47, 0, 185, 188, 70, 20, 19, 24, 110,
-    53, 124, 65, 241, 36, 176, 118, 52, 116, 238, 25, 98, 177, 111, 34, 112, 111, 31, 233, 224, 12, 117, 124, 40, 0,
-    238, 43, 202, 248, 0, 146, 123, 24, 153, 203, 234, 78, 9, 174, 103, 72, 73, 201, 180, 41, 47, 245, 138, 244, 191,
-    114, 80, 32, 30, 202, 58, 227, 126, 198, 247, 118, 107, 218, 61, 140, 35, 60, 222, 202, 147, 124, 140, 81, 169, 216,
-    171, 230, 149, 238, 155, 91, 253, 220, 141, 100, 42, 110, 164, 55, 217, 194, 228, 17, 5, 61, 2, 12, 249, 183, 15,
-    129, 18, 120, 251, 157, 72, 171, 124, 191, 185, 113, 157, 200, 246, 213, 108, 208, 233, 56, 156, 46, 131, 100, 215,
-    46, 199, 152, 49, 130, 254, 225, 251, 189, 26, 47, 139, 197, 97, 205, 135, 175, 157, 41, 210, 146, 182, 220, 146,
-    239, 43, 211, 208, 121, 108, 148, 89, 50, 65, 39, 136, 190, 185, 18, 98, 75, 113, 1, 35, 157, 86, 159, 139, 149,
-    220, 82, 51, 82, 126, 238, 56, 207, 99, 201, 59, 171, 204, 15, 197, 50, 51, 124, 21, 5, 120, 247, 212, 255, 175,
-    225, 41, 208, 149, 197, 43, 160, 181, 207, 244, 50, 68, 63, 85, 179, 182, 13, 83, 86, 12, 150, 152, 145, 55, 23, 37,
-    248, 11, 228, 45, 65, 198, 245, 29, 8, 85, 228, 162, 187, 14, 4, 183, 143, 255, 181, 15, 60, 218, 252, 169, 174, 87,
-    69, 137, 167, 210, 108, 166, 120, 214, 250, 238, 189, 147, 86, 211, 198, 200, 131, 67, 164, 237, 55, 243, 143, 7,
-    252, 152, 232, 125, 240, 203, 86, 229, 103, 65, 58, 112, 241, 138, 6, 211, 56, 72, 26, 104, 9, 218, 177, 130, 172,
-    253, 88, 23, 51, 66, 187, 16, 1, 136, 218, 167, 30, 82, 77, 84, 133, 47, 250, 52, 113, 9, 14, 99, 123, 7, 68, 5,
-    109, 197, 49, 43, 151, 170, 50, 193, 221, 102, 156, 125, 4, 5, 232, 134, 41, 6, 118, 114, 140, 224, 201, 49, 133, 9,
-    220, 9, 52, 66, 219, 40, 99, 68, 252, 23, 191, 137, 95, 159, 6, 150, 35, 105, 192, 206, 218, 178, 48, 130, 47, 68,
-    54, 247, 160, 134, 242, 84, 147, 83, 80, 200, 26, 171, 98, 136, 106, 227, 244, 167, 189, 231, 102, 206, 226, 115,
-    254, 23, 58, 106, 204, 192, 188, 31, 186, 153, 8, 36, 113, 185, 56, 74, 205, 235, 69, 152, 29, 142, 22, 49, 54, 133,
-    132, 185, 24, 85, 173, 248, 217, 205, 161, 231, 66, 241, 168, 124, 225, 111, 128, 68, 64, 152, 212, 63, 107, 122,
-    243, 88, 226, 196, 229, 217, 238, 103, 64, 181, 153, 69, 141, 150, 89, 124, 9, 32, 246, 46, 195, 46, 249, 64, 228,
-    157, 225, 40, 155, 82, 146, 19, 178, 92, 175, 220, 247, 27, 133, 243, 159, 76, 113, 30, 205, 75, 155, 126, 188, 2,
-    180, 27, 162, 232, 122, 103, 149, 37, 128, 148, 137, 204, 7, 188, 89, 21, 175, 2, 155, 26, 26, 33, 71, 95, 82, 243,
-    246, 143, 250, 237, 209, 79, 164, 217, 177, 222, 223, 0, 76, 65, 65, 42, 0, 127, 155, 211, 228, 122, 119, 183, 252,
-    102, 194, 185, 165, 236, 6, 68, 164, 246, 42, 241, 26, 78, 53, 118, 4, 93, 174, 81, 167, 170, 177, 140, 103, 217,
-    156, 26, 72, 243, 172, 96, 24, 152, 172, 101, 108, 227, 34, 116, 40, 88, 175, 72, 67, 102, 104, 119, 77, 245, 162,
-    63, 99, 130, 251, 87, 218, 166, 240, 41, 241, 250, 71, 29, 177, 251, 182, 69, 39, 243, 190, 20, 3, 200, 64, 178,
-    156, 137, 226, 28, 42, 10, 11, 208, 71, 60, 4, 99, 143, 175, 202, 170, 224, 75, 29, 252, 33, 10, 217, 2, 5, 136, 70,
-    35, 197, 103, 102, 40, 82, 188, 142, 250, 41, 195, 156, 5, 241, 132, 212, 76, 93, 88, 227, 59, 185, 159, 114, 77,
-    203, 82, 227, 2, 251, 247, 152, 198, 245, 100, 85, 211, 219, 69, 111, 54, 159, 235, 217, 45, 68, 26, 154, 5, 247,
-    198, 101, 221, 66, 128, 149, 185, 157, 32, 202, 90, 101, 195, 244, 157, 203, 0, 51, 220, 4, 108, 83, 150, 178, 89,
-    157, 230, 242, 110, 14, 189, 179, 154, 59, 105, 220, 234, 243, 203, 167, 37, 120, 94, 208, 8, 22, 190, 170, 170, 53,
-    10, 143, 100, 171, 87, 115, 183, 175, 89, 162, 222, 121, 113, 191, 59, 90, 235, 54, 208, 67, 146, 1, 83, 188, 179,
-    251, 170, 191, 152, 251, 90, 80, 233, 169, 31, 238, 86, 88, 229, 60, 28, 224, 199, 211, 124, 255, 47, 153, 86, 28,
-    187, 88, 226, 208, 208, 71, 5, 128, 20, 246, 21, 32, 154, 21, 12, 134, 183, 245, 159, 88, 139, 156, 233, 168, 65,
-    45, 230, 81, 109, 221, 115, 138, 31, 254, 146, 65, 29, 112, 223, 123, 0, 118, 247, 172, 40, 232, 156, 36, 90, 139,
-    23, 68, 178, 119, 187, 181, 144, 5, 154, 151, 92, 183, 88, 255, 38, 141, 212, 233, 107, 204, 231, 86, 59, 90, 36,
-    236, 211, 170, 232, 185, 172, 61, 240, 106, 224, 102, 215, 120, 159, 42, 128, 205, 221, 245, 164, 66, 158, 22, 81,
-    21, 17, 222, 83, 135, 95, 162, 119, 58, 56, 47, 224, 47, 117, 197, 113, 152, 100, 71, 193, 151, 155, 40, 249, 159,
-    211, 184, 169, 208, 246, 162, 249, 110, 137, 34, 74, 208, 101, 236, 215, 181, 103, 179, 21, 82, 237, 47, 230, 156,
-    98, 234, 24, 230, 173, 230, 52, 177, 33, 255, 87, 109, 105, 99, 177, 185, 120, 154, 50, 63, 102, 19, 43, 72, 106,
-    170, 243, 100, 75, 236, 153, 4, 25, 245, 14, 78, 155, 25, 11, 205, 138, 167, 29, 146, 148, 204, 121, 191, 242, 32,
-    11, 53, 195, 210, 50, 183, 165, 177, 77, 32, 80, 89, 200, 163, 206, 14, 136, 6, 3, 236, 152, 112, 178, 218, 231, 99,
-    86, 11, 132, 119, 164, 230, 208, 117, 139, 130, 157, 166, 38, 12, 92, 16, 122, 109, 139, 179, 225, 107, 164, 181,
-    188, 222, 106, 220, 52, 244, 169, 110, 11, 91, 145, 186, 35, 203, 70, 248, 228, 236, 177, 250, 32, 109, 206, 181,
-    194, 176, 142, 196, 0, 109, 229, 142, 255, 76, 171, 118, 171, 12, 199, 216, 20, 100, 16, 42, 12, 151, 210, 205, 222,
-    254, 206, 38, 58, 88, 9, 107, 64, 111, 226, 74, 198, 18, 40, 227, 232, 56, 195, 67, 162, 176, 234, 18, 75, 9, 211,
-    15, 233, 232, 238, 85, 5, 192, 123, 31, 162, 196, 237, 158, 147, 236, 118, 199, 197, 188, 60, 175, 39, 53, 59, 176,
-    43, 73, 58, 248, 121, 247, 9, 32, 81, 111, 17, 53, 67, 65, 24, 196, 99, 71, 241, 6, 132, 158, 246, 212, 159, 208, 1,
-    51, 86, 9, 140, 160, 114, 44, 19, 138, 120, 42, 34, 62, 106, 218, 157, 146, 200, 35, 67, 105, 23, 62, 152, 123, 100,
-    126, 20, 132, 189, 133, 157, 108, 209, 246, 144, 227, 20, 21, 23, 151, 155, 1, 212, 147, 2, 247, 90, 11, 184, 38,
-    239, 69, 184, 225, 170, 53, 192, 3, 27, 154, 180, 233, 31, 11, 166, 152, 86, 175, 21, 25, 12, 189, 191, 90, 238, 76,
-    83, 229, 98, 150, 162, 8, 145, 74, 143, 204, 229, 145, 181, 65, 194, 238, 82, 87, 67, 237, 232, 107, 23, 156, 4,
-    206, 236, 93, 131, 147, 70, 171, 50, 165, 125, 173, 217, 191, 106, 105, 26, 59, 81, 182, 170, 125, 205, 96, 195, 24,
-    171, 212, 107, 12, 109, 138, 3, 253, 179, 60, 107, 200, 157, 129, 241, 109, 179, 174, 213, 62, 172, 155, 55, 57, 95,
-    119, 143, 39, 70, 37, 250, 11, 130, 97, 167, 72, 203, 224, 251, 103, 113, 103, 10, 179, 219, 194, 17, 29, 31, 25,
-    194, 128, 171, 251, 215, 52, 52, 95, 248, 147, 227, 222, 84, 161, 25, 156, 90, 159, 168, 27, 99, 44, 162, 216, 209,
-    145, 107, 221, 118, 55, 87, 213, 32, 24, 88, 171, 66, 54, 27, 44, 118, 36, 198, 106, 9, 10, 181, 89, 149, 214, 53,
-    35, 38, 110, 225, 179, 197, 38, 86, 211, 196, 113, 199, 137, 95, 11, 207, 88, 175, 28, 14, 244, 236, 29, 107, 212,
-    53, 159, 78, 170, 177, 47, 84, 67, 118, 147, 246, 71, 191, 92, 74, 31, 124, 190, 4, 11, 145, 183, 158, 125, 213,
-    217, 89, 75, 165, 37, 154, 185, 96, 33, 126, 129, 127, 14, 135, 207, 35, 154, 196, 168, 216, 238, 55, 37, 89, 156,
-    117, 208, 156, 234, 55, 25, 54, 12, 164, 38, 98, 27, 99, 79, 121, 238, 129, 196, 155, 185, 17, 190, 140, 23, 177, 8,
-    128, 91, 162, 213, 163, 201, 195, 171, 181, 196, 152, 241, 29, 197, 83, 111, 213, 76, 79, 140, 7, 104, 220, 250, 60,
-    131, 94, 10, 130, 28, 51, 76, 77, 11, 221, 4, 241, 131, 196, 255, 9, 214, 31, 227, 43, 7, 173, 37, 179, 39, 53, 70,
-    12, 184, 168, 105, 42, 73, 157, 0, 175, 141, 34, 241, 82, 223, 81, 20, 44, 205, 194, 138, 252, 228, 112, 159, 19,
-    148, 162, 243, 90, 226, 58, 65, 234, 167, 193, 186, 199, 125, 3, 226, 21, 135, 191, 98, 254, 255, 1, 7, 106, 247,
-    251, 203, 179, 184, 22, 245, 188, 187, 178, 52, 14, 4, 32, 221, 7, 146, 98, 152, 241, 253, 123, 13, 122, 159, 235,
-    41, 81, 145, 190, 193, 67, 127, 160, 40, 54, 197, 101, 159, 174, 64, 235, 179, 114, 35, 255, 47, 117, 62, 211, 233,
-    253, 17, 251, 159, 101, 90, 59, 109, 170, 20, 243, 66, 216, 124, 80, 42, 46, 17, 2, 94, 1, 77, 243, 183, 231, 103,
-    95, 105, 215, 184, 74, 116, 124, 161, 230, 213, 97, 129, 160, 97, 23, 203, 5, 31, 93, 232, 6, 47, 158, 75, 201, 223,
-    131, 71, 243, 255, 193, 107, 197, 11, 150, 240, 235, 198, 111, 173, 166, 252, 234, 103, 155, 178, 230, 248, 216,
-    215, 227, 246, 172, 152, 172, 111, 195, 176, 253, 212, 152, 8, 172, 93, 119, 178, 225, 129, 213, 146, 91, 230, 102,
-    217, 110, 1, 94, 84, 19, 224, 248, 242, 204, 190, 39, 74, 59, 31, 32, 18, 146, 225, 236, 34, 43, 64, 205, 121, 111,
-    159, 119, 220, 14, 202, 151, 203, 195, 216, 23, 169, 164, 48, 196, 105, 127, 24, 24, 233, 166, 238, 37, 134, 12, 25,
-    104, 65, 139, 110, 227, 171, 108, 218, 214, 52, 172, 147, 55, 250, 35, 48, 26, 12, 44, 3, 139, 115, 24, 103, 96, 40,
-    19, 239, 165, 247, 177, 109, 249, 12, 38, 60, 188, 111, 51, 72, 219, 215, 78, 18, 41, 192, 182, 191, 224, 208, 29,
-    34, 200, 97, 191, 16, 6, 243, 245, 198, 143, 46, 151, 34, 10, 82, 87, 71, 96, 20, 40, 170, 99, 46, 40, 38, 24, 230,
-    114, 26, 109, 21, 174, 246, 191, 87, 31, 104, 118, 72, 115, 45, 49, 167, 133, 233, 77, 244, 124, 188, 2, 159, 252,
-    28, 9, 37, 254, 22, 170, 213, 119, 144, 98, 143, 94, 36, 33, 161, 128, 13, 157, 231, 35, 71, 106, 41, 129, 197, 249,
-    132, 161, 29, 48, 197, 183, 137, 78, 61, 240, 29, 91, 12, 222, 162, 164, 42, 41, 7, 39, 89, 128, 229, 104, 84, 163,
-    52, 229, 80, 197, 250, 246, 222, 48, 186, 43, 117, 157, 121, 8, 138, 121, 23, 143, 37, 97, 0, 92, 238, 77, 235, 139,
-    244, 201, 252, 88, 120, 252, 2, 124, 7, 76, 121, 60, 251, 115, 206, 90, 129, 239, 111, 234, 105, 100, 72, 203, 94,
-    154, 187, 186, 8, 248, 104, 70, 17, 123, 97, 69, 127, 183, 61, 251, 89, 117, 158, 207, 48, 222, 111, 235, 89, 63,
-    120, 73, 110, 14, 13, 55, 76, 164, 41, 146, 173, 34, 235, 73, 156, 199, 166, 37, 142, 53, 126, 42, 12, 133, 2, 153,
-    92, 87, 54, 42, 236, 191, 60, 202, 126, 71, 169, 87, 35, 161, 52, 66, 89, 101, 14, 148, 53, 182, 190, 146, 173, 137,
-    130, 62, 180, 204, 148, 240, 87, 150, 78, 232, 66, 250, 175, 93, 111, 255, 243, 206, 241, 161, 105, 60, 215, 85, 87,
-    176, 40, 30, 216, 195, 222, 163, 24, 144, 60, 91, 142, 159, 169, 1, 195, 209, 127, 92, 152, 82, 141, 234, 68, 251,
-    250, 103, 65, 225, 102, 220, 111, 191, 116, 214, 18, 179, 195, 70, 199, 90, 206, 170, 112, 49, 171, 30, 227, 176,
-    126, 24, 32, 94, 95, 224, 125, 111, 14, 227, 134, 67, 8, 147, 191, 28, 182, 143, 49, 45, 239, 39, 132, 105, 17, 6,
-    171, 89, 84, 90, 22, 124, 181, 189, 77, 162, 187, 59, 165, 51, 23, 252, 164, 103, 124, 202, 178, 64, 42, 111, 163,
-    245, 198, 13, 146, 127, 142, 92, 246, 80, 151, 171, 45, 152, 77, 247, 206, 84, 0, 119, 78, 83, 37, 76, 187, 19, 134,
-    184, 101, 90, 65, 142, 247, 133, 56, 1, 31, 177, 75, 103, 21, 244, 89, 49, 63, 194, 165, 156, 241, 48, 84, 123, 71,
-    111, 36, 46, 50, 53, 150, 88, 126, 79, 58, 255, 39, 211, 105, 8, 139, 144, 198, 172, 97, 254, 201, 212, 79, 137,
-    133, 157, 130, 142, 241, 143, 113, 113, 64, 41, 164, 145, 90, 215, 187, 15, 88, 247, 195, 60, 58, 241, 67, 247, 77,
-    95, 216, 249, 93, 116, 236, 253, 51, 32, 194, 240, 119, 5, 178, 179, 159, 228, 182, 35, 106, 28, 50, 57, 210, 70,
-    197, 178, 146, 255, 88, 42, 189, 19, 239, 231, 75, 93, 127, 109, 216, 202, 20, 44, 130, 148, 254, 86, 155, 103, 212,
-    253, 57, 202, 101, 151, 243, 24, 250, 221, 108, 193, 86, 87, 254, 66, 13, 100, 232, 20, 102, 14, 149, 176, 18, 92,
-    132, 147, 5, 2, 58, 203, 88, 42, 210, 186, 163, 28, 195, 59, 28, 68, 176, 153, 231, 143, 92, 77, 186, 67, 74, 210,
-    139, 123, 211, 26, 250, 21, 26, 185, 206, 37, 135, 1, 20, 246, 127, 157, 107, 35, 136, 75, 207, 168, 23, 249, 211,
-    0, 45, 112, 100, 188, 175, 113, 215, 55, 46, 254, 146, 138, 101, 126, 216, 7, 225, 235, 8, 133, 62, 182, 90, 142,
-    79, 247, 231, 141, 43, 140, 234, 8, 37, 232, 120, 205, 236, 50, 45, 96, 162, 41, 34, 238, 97, 86, 176, 9, 2, 50, 86,
-    246, 114, 85, 128, 40, 73, 208, 158, 157, 73, 121, 198, 17, 18, 24, 195, 210, 234, 160, 198, 83, 9, 111, 121, 6, 49,
-    130, 30, 138, 120, 157, 252, 121, 98, 83, 172, 213, 46, 127, 55, 159, 247, 56, 128, 230, 177, 236, 126, 84, 102, 75,
-    155, 226, 204, 76, 211, 239, 105, 164, 18, 26, 159, 114, 24, 179, 20, 83, 131, 190, 155, 24, 185, 223, 147, 106, 58,
-    254, 76, 176, 87, 55, 245, 237, 31, 32, 33, 253, 251, 62, 0, 6, 173, 245, 116, 173, 205, 117, 32, 91, 229, 123, 189,
-    14, 14, 104, 70, 89, 18, 253, 72, 249, 121, 120, 82, 25, 138, 180, 61, 108, 177, 63, 192, 107, 76, 183, 17, 200,
-    220, 21, 218, 6, 222, 58, 251, 53, 167, 209, 190, 151, 49, 76, 86, 17, 246, 133, 139, 127, 33, 160, 19, 43, 58, 60,
-    242, 247, 15, 122, 101, 54, 22, 2, 129, 38, 188, 244, 137, 178, 212, 151, 253, 83, 132, 200, 37, 105, 115, 187, 209,
-    71, 41, 66, 209, 78, 1, 188, 83, 71, 91, 50, 7, 54, 75, 118, 103, 116, 73, 191, 171, 44, 48, 105, 132, 151, 50, 12,
-    237, 243, 233, 145, 3, 90, 107, 159, 157, 15, 172, 70, 81, 230, 27, 192, 166, 21, 30, 104, 97, 7, 18, 31, 183, 118,
-    14, 112, 19, 221, 147, 165, 174, 144, 99, 229, 146, 149, 55, 205, 108, 239, 222, 7, 136, 181, 194, 134, 187, 146,
-    134, 7, 139, 240, 198, 136, 75, 198, 80, 41, 169, 238, 133, 241, 201, 25, 250, 1, 141, 48, 64, 187, 7, 235, 68, 224,
-    1, 9, 172, 38, 225, 39, 85, 170, 203, 122, 24, 183, 21, 1, 151, 176, 231, 218, 149, 210, 9, 52, 92, 101, 250, 45,
-    166, 112, 116, 50, 146, 21, 47, 78, 125, 147, 218, 199, 91, 112, 29, 249, 255, 97, 25, 93, 176, 254, 128, 199, 208,
-    101, 233, 12, 79, 163, 155, 123, 140, 128, 160, 185, 0, 229, 128, 136, 144, 159, 108, 155, 17, 248, 27, 55, 85, 2,
-    180, 76, 50, 93, 65, 254, 118, 103, 167, 11, 106, 25, 87, 246, 39, 231, 64, 106, 183, 168, 229, 121, 158, 242, 212,
-    167, 147, 60, 253, 192, 190, 156, 126, 147, 49, 52, 36, 59, 137, 178, 227, 128, 217, 159, 63, 63, 131, 15, 123, 175,
-    10, 99, 124, 228, 165, 2, 129, 60, 4, 214, 230, 25, 186, 35, 30, 161, 61, 173, 233, 158, 102, 114, 172, 200, 141,
-    242, 3, 178, 43, 183, 236, 248, 51, 183, 234, 105, 72, 119, 192, 125, 83, 202, 74, 40, 115, 124, 41, 93, 111, 93,
-    142, 151, 73, 131, 70, 58, 76, 180, 232, 84, 21, 109, 233, 146, 238, 237, 3, 250, 202, 220, 220, 165, 41, 69, 209,
-    188, 219, 94, 21, 81, 6, 11, 65, 163, 92, 148, 17, 34, 210, 90, 255, 232, 112, 107, 30, 32, 207, 16, 225, 155, 201,
-    213, 163, 199, 219, 72, 179, 20, 30, 222, 253, 92, 122, 109, 251, 169, 204, 220, 254, 142, 55, 160, 57, 236, 239,
-    238, 26, 9, 133, 198, 105, 227, 54, 204, 13, 134, 75, 195, 107, 56, 136, 110, 238, 34, 179, 208, 78, 98, 220, 66,
-    93, 12, 166, 14, 232, 252, 97, 109, 67, 133, 217, 193, 102, 72, 136, 219, 97, 84, 19, 232, 69, 9, 82, 114, 59, 153,
-    133, 92, 198, 245, 123, 217, 88, 79, 231, 227, 127, 78, 131, 10, 94, 192, 79, 40, 142, 194, 6, 184, 2, 197, 95, 81,
-    64, 36, 237, 48, 168, 21, 100, 46, 91, 85, 78, 206, 35, 65, 143, 136, 186, 204, 213, 177, 109, 165, 46, 22, 7, 96,
-    106, 138, 179, 35, 31, 155, 197, 115, 201, 21, 125, 16, 122, 236, 119, 185, 119, 151, 150, 69, 214, 92, 184, 199,
-    56, 60, 62, 93, 205, 6, 169, 107, 122, 234, 168, 122, 221, 248, 149, 95, 103, 93, 91, 218, 156, 97, 230, 62, 253,
-    252, 216, 157, 212, 177, 151, 146, 138, 184, 154, 98, 78, 88, 9, 44, 141, 234, 182, 117, 64, 125, 133, 43, 222, 218,
-    246, 229, 85, 241, 135, 235, 251, 147, 184, 110, 240, 110, 242, 54, 2, 233, 160, 248, 95, 189, 119, 101, 253, 193,
-    111, 167, 59, 18, 4, 225, 147, 249, 95, 34, 189, 25, 206, 7, 168, 222, 184, 224, 43, 170, 29, 197, 186, 194, 24,
-    124, 206, 40, 156, 131, 178, 55, 178, 128, 207, 185, 231, 143, 169, 76, 86, 11, 231, 138, 186, 75, 197, 232, 103,
-    255, 95, 234, 66, 243, 171, 35, 78, 185, 18, 245, 117, 197, 250, 177, 125, 7, 182, 251, 116, 51, 215, 8, 43, 235,
-    55, 144, 37, 254, 106, 56, 243, 125, 199, 197, 71, 215, 187, 76, 171, 244, 232, 168, 109, 159, 151, 80, 79, 50, 110,
-    129, 17, 90, 156, 248, 23, 129, 52, 166, 26, 138, 80, 2, 101, 247, 191, 153, 88, 211, 153, 212, 206, 64, 81, 102,
-    152, 139, 43, 218, 24, 45, 11, 37, 243, 9, 35, 253, 252, 79, 251, 133, 140, 11, 170, 162, 243, 54, 34, 186, 82, 163,
-    247, 118, 78, 242, 174, 130, 81, 54, 203, 65, 229, 1, 171, 249, 141, 172, 148, 18, 119, 198, 221, 104, 101, 81, 194,
-    149, 164, 190, 135, 88, 250, 72, 163, 53, 28, 133, 95, 39, 222, 249, 227, 138, 57, 244, 113, 32, 149, 69, 155, 97,
-    228, 24, 6, 252, 64, 111, 180, 121, 33, 203, 37, 151, 117, 91, 245, 163, 110, 34, 113, 3, 135, 85, 241, 157, 153,
-    206, 176, 44, 215, 209, 182, 2, 179, 236, 242, 211, 112, 255, 162, 145, 38, 69, 95, 79, 22, 156, 60, 187, 250, 213,
-    140, 0, 5, 120, 59, 115, 186, 49, 148, 162, 111, 188, 142, 114, 175, 189, 52, 78, 181, 108, 229, 150, 81, 138, 101,
-    127, 17, 115, 130, 116, 240, 44, 35, 220, 23, 211, 120, 51, 209, 103, 131, 128, 87, 85, 140, 185, 154, 204, 5, 83,
-    93, 7, 6, 231, 93, 65, 157, 205, 36, 232, 73, 157, 195, 43, 42, 26, 90, 147, 71, 213, 198, 84, 195, 3, 123, 149, 42,
-    196, 236, 133, 221, 221, 5, 3, 235, 83, 155, 169, 196, 195, 182, 146, 28, 40, 221, 186, 49, 37, 251, 40, 217, 78, 0,
-    88, 213, 63, 53, 150, 146, 87, 239, 252, 199, 142, 211, 238, 186, 150, 207, 247, 196, 198, 6, 177, 176, 152, 241,
-    143, 168, 13, 34, 19, 146, 46, 28, 16, 249, 116, 18, 226, 7, 66, 247, 48, 157, 11, 224, 253, 97, 78, 176, 176, 61,
-    117, 155, 15, 123, 54, 170, 107, 89, 143, 82, 193, 3, 227, 154, 53, 181, 56, 203, 208, 79, 105, 194, 253, 183, 62,
-    36, 183, 64, 187, 32, 166, 148, 71, 193, 109, 45, 48, 98, 90, 187, 113, 49, 25, 185, 163, 155, 24, 237, 54, 63, 105,
-    116, 71, 41, 248, 41, 69, 49, 28, 102, 189, 43, 6, 145, 215, 138, 202, 18, 211, 113, 131, 186, 86, 70, 128, 221,
-    230, 224, 81, 62, 117, 68, 172, 33, 16, 118, 154, 181, 77, 236, 80, 131, 188, 65, 157, 81, 112, 69, 47, 159, 175,
-    120, 201, 20, 55, 250, 177, 107, 128, 7, 123, 110, 227, 205, 209, 0, 227, 255, 21, 211, 72, 242, 30, 255, 219, 83,
-    210, 105, 88, 53, 246, 15, 82, 217, 204, 65, 62, 116, 211, 168, 109, 191, 209, 156, 105, 152, 139, 81, 206, 25, 30,
-    0, 118, 7, 179, 223, 34, 156, 204, 211, 168, 7, 71, 4, 175, 30, 170, 198, 5, 21, 85, 89, 125, 17, 144, 121, 159,
-    192, 55, 104, 13, 101, 105, 114, 151, 132, 104, 91, 40, 149, 82, 8, 87, 136, 172, 61, 158, 213, 141, 229, 40, 218,
-    225, 141, 241, 243, 29, 86, 50, 1, 136, 58, 226, 191, 118, 35, 31, 23, 118, 234, 67, 139, 34, 77, 109, 139, 23, 64,
-    59, 58, 102, 244, 170, 115, 250, 15, 92, 13, 30, 216, 250, 231, 151, 90, 110, 202, 76, 101, 140, 202, 86, 68, 1,
-    141, 117, 85, 107, 34, 172, 15, 71, 199, 160, 158, 238, 244, 192, 154, 125, 59, 10, 63, 166, 210, 68, 173, 159, 124,
-    215, 246, 109, 112, 218, 173, 143, 24, 141, 135, 0, 23, 178, 158, 225, 18, 208, 107, 232, 195, 65, 119, 146, 120,
-    173, 183, 12, 57, 139, 25, 246, 32, 26, 221, 143, 117, 151, 73, 222, 19, 52, 51, 204, 173, 210, 77, 171, 161, 129,
-    39, 172, 93, 60, 236, 174, 124, 145, 124, 73, 126, 152, 217, 152, 190, 84, 138, 27, 15, 170, 148, 141, 115, 1, 230,
-    211, 248, 166, 159, 86, 40, 109, 42, 230, 241, 210, 147, 248, 174, 250, 52, 146, 67, 138, 40, 233, 36, 182, 38, 248,
-    243, 239, 177, 186, 67, 15, 47, 154, 193, 120, 123, 117, 101, 250, 227, 218, 144, 244, 110, 110, 20, 51, 240, 69,
-    159, 49, 66, 230, 173, 218, 182, 161, 92, 213, 180, 175, 46, 132, 75, 137, 52, 126, 216, 48, 214, 106, 86, 143, 251,
-    19, 114, 165, 183, 241, 131, 24, 4, 255, 75, 219, 227, 147, 181, 101, 177, 228, 26, 127, 97, 103, 231, 74, 201, 222,
-    82, 185, 213, 41, 75, 57, 130, 246, 54, 2, 175, 211, 120, 48, 19, 191, 229, 134, 123, 245, 236, 47, 186, 83, 220,
-    60, 157, 40, 144, 124, 92, 87, 21, 30, 149, 170, 101, 128, 60, 8, 76, 119, 4, 153, 98, 234, 188, 53, 205, 205, 192,
-    43, 139, 26, 104, 9, 138, 140, 1, 199, 253, 214, 40, 10, 87, 33, 105, 228, 134, 207, 193, 251, 142, 146, 37, 29,
-    150, 174, 82, 41, 84, 3, 116, 116, 189, 92, 125, 1, 146, 88, 187, 149, 65, 181, 179, 159, 240, 92, 34, 168, 79, 138,
-    145, 49, 142, 197, 42, 135, 130, 98, 73, 61, 71, 47, 131, 98, 63, 125, 208, 196, 173, 64, 33, 225, 7, 198, 124, 88,
-    103, 175, 219, 161, 110, 183, 91, 32, 218, 31, 98, 2, 252, 153, 170, 168, 16, 27, 197, 18, 143, 96, 14, 215, 145,
-    32, 245, 42, 28, 168, 84, 68, 138, 70, 215, 34, 159, 73, 22, 48, 218, 177, 113, 24, 190, 226, 22, 248, 110, 177,
-    161, 207, 106, 79, 146, 40, 145, 189, 254, 146, 227, 93, 91, 124, 57, 141, 3, 54, 171, 105, 134, 7, 65, 84, 160,
-    105, 63, 110, 42, 157, 250, 210, 58, 38, 170, 90, 188, 181, 34, 194, 138, 234, 32, 50, 0, 163, 219, 111, 161, 218,
-    134, 131, 85, 206, 34, 239, 186, 199, 239, 224, 135, 166, 1, 8, 2, 144, 109, 240, 166, 102, 64, 5, 78, 148, 106, 91,
-    201, 250, 28, 168, 90, 217, 173, 205, 19, 163, 198, 222, 89, 94, 228, 31, 94, 6, 25, 127, 182, 70, 238, 205, 55,
-    101, 152, 9, 57, 244, 11, 77, 44, 238, 172, 247, 219, 208, 99, 234, 10, 93, 189, 201, 184, 244, 33, 139, 188, 49,
-    248, 198, 255, 40, 148, 125, 58, 231, 188, 231, 3, 253, 58, 149, 185, 218, 246, 103, 64, 243, 179, 221, 202, 86, 45,
-    205, 30, 79, 196, 9, 70, 166, 133, 28, 193, 172, 227, 88, 245, 165, 72, 18, 40, 177, 25, 0, 217, 171, 226, 102, 30,
-    12, 48, 13, 204, 48, 62, 173, 32, 38, 226, 234, 158, 73, 132, 245, 82, 201, 24, 87, 189, 153, 158, 22, 70, 194, 20,
-    239, 99, 56, 16, 206, 171, 225, 117, 168, 249, 92, 165, 36, 219, 35, 168, 37, 168, 78, 32, 3, 71, 181, 164, 139, 47,
-    76, 32, 20, 156, 8, 230, 140, 195, 221, 219, 88, 38, 201, 10, 18, 14, 202, 64, 205, 127, 45, 29, 151, 173, 243, 44,
-    29, 198, 141, 208, 42, 160, 0, 169, 9, 35, 113, 105, 54, 39, 74, 167, 13, 225, 111, 200, 48, 4, 238, 14, 147, 93,
-    58, 227, 33, 51, 128, 200, 110, 102, 101, 239, 150, 7, 165, 242, 61, 30, 165, 64, 24, 84, 74, 0, 192, 168, 210, 202,
-    169, 14, 230, 137, 225, 232, 198, 236, 180, 63, 209, 137, 225, 144, 48, 32, 172, 56, 154, 180, 152, 205, 231, 143,
-    223, 40, 10, 13, 104, 95, 110, 82, 18, 247, 95, 99, 251, 114, 7, 246, 29, 29, 61, 202, 36, 88, 170, 160, 35, 143,
-    84, 19, 105, 233, 239, 2, 241, 142, 214, 207, 186, 80, 63, 46, 6, 29, 36, 30, 124, 152, 145, 210, 129, 168, 148, 10,
-    97, 7, 95, 152, 157, 117, 175, 149, 186, 39, 113, 54, 196, 189, 31, 20, 129, 115, 222, 137, 1, 50, 41, 12, 146, 73,
-    1, 106, 58, 140, 31, 98, 53, 31, 85, 99, 74, 32, 183, 185, 144, 95, 146, 209, 27, 107, 142, 137, 103, 58, 204, 230,
-    105, 251, 228, 205, 19, 204, 83, 185, 232, 57, 186, 107, 104, 56, 35, 97, 31, 87, 245, 46, 201, 56, 254, 214, 34,
-    214, 20, 183, 127, 48, 35, 225, 208, 18, 56, 187, 8, 24, 103, 77, 67, 143, 64, 130, 133, 64, 212, 146, 254, 191,
-    174, 208, 36, 81, 9, 149, 197, 69, 144, 57, 252, 198, 92, 125, 135, 71, 45, 196, 191, 246, 252, 46, 238, 27, 203,
-    249, 245, 116, 15, 165, 124, 196, 65, 126, 129, 235, 189, 98, 129, 143, 114, 232, 80, 63, 159, 99, 173, 110, 238,
-    165, 51, 164, 118, 154, 204, 229, 253, 77, 192, 68, 106, 236, 91, 87, 9, 2, 247, 162, 170, 102, 243, 149, 235, 23,
-    115, 56, 62, 189, 30, 193, 223, 65, 37, 208, 132, 222, 74, 19, 96, 23, 237, 80, 147, 97, 93, 167, 132, 79, 240, 5,
-    65, 156, 158, 28, 183, 255, 78, 128, 96, 98, 130, 222, 131, 18, 176, 182, 17, 233, 170, 254, 51, 99, 41, 155, 64,
-    162, 73, 116, 201, 169, 4, 43, 26, 5, 131, 22, 39, 158, 246, 58, 170, 237, 189, 45, 11, 63, 188, 28, 134, 142, 166,
-    213, 35, 157, 60, 255, 215, 196, 2, 219, 136, 88, 215, 66, 9, 146, 238, 54, 48, 21, 138, 193, 147, 124, 198, 58,
-    154, 175, 186, 82, 173, 237, 158, 41, 220, 164, 8, 58, 196, 70, 20, 117, 129, 251, 211, 35, 174, 73, 164, 15, 175,
-    171, 101, 77, 224, 124, 57, 17, 99, 54, 73, 72, 238, 94, 195, 6, 120, 101, 110, 193, 121, 4, 40, 160, 164, 205, 233,
-    243, 115, 46, 81, 250, 155, 210, 14, 133, 184, 9, 36, 78, 210, 38, 32, 192, 44, 24, 52, 112, 27, 88, 38, 107, 111,
-    98, 107, 39, 192, 73, 220, 127, 32, 71, 53, 116, 188, 97, 101, 109, 230, 197, 1, 223, 235, 72, 11, 210, 22, 9, 211,
-    144, 135, 98, 171, 79, 128, 117, 62, 32, 39, 99, 218, 139, 92, 214, 244, 43, 132, 43, 231, 175, 240, 5, 240, 0, 69,
-    170, 252, 220, 222, 246, 222, 65, 141, 142, 22, 56, 13, 26, 31, 237, 22, 192, 73, 198, 143, 194, 192, 20, 136, 41,
-    103, 7, 100, 139, 212, 50, 127, 175, 228, 157, 211, 22, 42, 49, 197, 80, 129, 235, 182, 249, 121, 186, 51, 119, 160,
-    69, 47, 120, 207, 219, 115, 201, 211, 112, 37, 68, 37, 200, 41, 1, 26, 76, 73, 186, 171, 39, 131, 131, 220, 40, 133,
-    34, 244, 149, 152, 163, 209, 25, 18, 114, 26, 24, 106, 145, 78, 155, 215, 75, 191, 172, 179, 2, 52, 222, 64, 48, 23,
-    60, 201, 154, 131, 252, 67, 221, 141, 57, 144, 183, 47, 15, 66, 0, 216, 11, 37, 29, 59, 95, 195, 211, 100, 226, 140,
-    157, 160, 254, 197, 121, 168, 0, 198, 141, 172, 129, 57, 173, 189, 73, 36, 110, 2, 234, 154, 28, 214, 37, 4, 40,
-    177, 4, 213, 71, 1, 14, 252, 12, 184, 4, 173, 149, 232, 239, 19, 136, 61, 2, 27, 211, 126, 60, 103, 33, 227, 158,
-    102, 94, 200, 4, 9, 118, 222, 24, 51, 193, 1, 170, 190, 116, 250, 219, 23, 141, 242, 86, 225, 154, 84, 75, 21, 215,
-    99, 100, 228, 113, 110, 59, 233, 65, 184, 107, 22, 202, 128, 166, 209, 122, 102, 59, 125, 118, 124, 46, 125, 126,
-    103, 195, 39, 30, 92, 254, 141, 94, 53, 212, 8, 17, 80, 97, 150, 60, 245, 156, 58, 10, 115, 111, 202, 76, 156, 10,
-    248, 142, 95, 88, 131, 37, 79, 36, 8, 64, 87, 179, 151, 251, 169, 141, 72, 89, 80, 226, 227, 100, 92, 194, 31, 174,
-    125, 106, 189, 227, 225, 245, 232, 18, 169, 159, 96, 255, 62, 171, 154, 102, 55, 30, 133, 206, 164, 154, 122, 25,
-    196, 92, 5, 237, 112, 197, 46, 155, 56, 91, 100, 165, 255, 23, 52, 207, 225, 41, 207, 12, 248, 211, 194, 48, 36,
-    156, 86, 57, 90, 9, 229, 230, 106, 85, 19, 216, 75, 250, 145, 144, 224, 11, 209, 74, 206, 237, 100, 94, 20, 72, 127,
-    184, 209, 53, 87, 233, 79, 209, 125, 196, 224, 30, 81, 227, 143, 147, 169, 216, 160, 242, 186, 85, 253, 14, 30, 116,
-    50, 18, 180, 93, 85, 162, 33, 98, 37, 135, 39, 251, 78, 63, 13, 25, 213, 223, 84, 72, 240, 234, 154, 121, 142, 238,
-    73, 65, 186, 214, 79, 190, 230, 134, 110, 250, 163, 207, 144, 193, 184, 135, 149, 203, 200, 225, 6, 102, 140, 51,
-    159, 80, 6, 214, 61, 225, 83, 120, 115, 235, 176, 45, 221, 199, 213, 217, 23, 35, 46, 231, 21, 89, 228, 137, 9, 239,
-    72, 16, 150, 137, 37, 92, 131, 57, 118, 174, 12, 66, 115, 33, 160, 134, 36, 178, 24, 70, 55, 92, 30, 209, 70, 176,
-    176, 247, 169, 133, 182, 13, 88, 94, 252, 254, 167, 123, 24, 224, 232, 95, 158, 156, 247, 235, 183, 215, 152, 255,
-    180, 129, 3, 184, 40, 102, 4, 153, 114, 104, 115, 7, 38, 101, 228, 155, 119, 143, 176, 104, 105, 183, 215, 56, 15,
-    129, 37, 242, 171, 235, 42, 200, 56, 79, 236, 179, 147, 183, 247, 72, 80, 36, 63, 3, 33, 99, 84, 210, 38, 245, 159,
-    177, 56, 28, 50, 230, 227, 183, 236, 154, 234, 106, 196, 156, 126, 181, 242, 44, 106, 48, 250, 143, 146, 43, 120,
-    144, 192, 247, 166, 193, 134, 213, 79, 92, 105, 51, 213, 85, 70, 162, 138, 80, 131, 113, 83, 81, 252, 13, 126, 213,
-    147, 138, 23, 8, 183, 211, 207, 202, 140, 229, 230, 20, 180, 149, 126, 160, 119, 189, 147, 19, 97, 0, 241, 181, 218,
-    78, 170, 93, 145, 134, 16, 88, 140, 170, 188, 136, 1, 120, 39, 112, 12, 24, 248, 230, 64, 41, 147, 76, 6, 100, 151,
-    237, 146, 222, 93, 33, 198, 189, 225, 195, 117, 178, 12, 235, 188, 234, 104, 251, 241, 246, 72, 3, 46, 201, 247,
-    193, 167, 6, 233, 224, 199, 111, 221, 227, 130, 51, 242, 47, 210, 75, 137, 253, 46, 133, 80, 26, 207, 72, 121, 23,
-    89, 246, 242, 207, 99, 229, 121, 138, 94, 55, 168, 98, 205, 160, 129, 129, 241, 112, 202, 246, 78, 95, 95, 179, 101,
-    10, 19, 82, 231, 218, 188, 40, 254, 21, 11, 208, 50, 166, 72, 50, 66, 185, 192, 22, 171, 250, 228, 234, 74, 219,
-    231, 96, 62, 62, 227, 25, 177, 239, 192, 248, 190, 203, 224, 58, 180, 134, 25, 92, 97, 190, 129, 212, 181, 216, 23,
-    80, 95, 247, 96, 15, 173, 30, 49, 195, 74, 198, 62, 144, 115, 95, 63, 37, 142, 85, 229, 113, 158, 68, 197, 32, 147,
-    86, 86, 128, 29, 237, 98, 232, 108, 1, 115, 58, 64, 123, 44, 18, 212, 77, 178, 17, 240, 82, 86, 55, 188, 177, 150,
-    103, 9, 158, 233, 227, 217, 132, 57, 137, 154, 147, 52, 7, 33, 21, 65, 50, 218, 109, 147, 110, 186, 51, 158, 224,
-    142, 192, 243, 150, 141, 181, 246, 160, 13, 105, 84, 167, 51, 12, 216, 254, 43, 230, 202, 248, 144, 44, 62, 226,
-    254, 238, 210, 217, 221, 115, 20, 159, 161, 34, 128, 187, 200, 92, 250, 231, 72, 195, 244, 232, 254, 55, 102, 85,
-    53, 123, 159, 190, 21, 11, 77, 118, 16, 78, 53, 0, 166, 143, 241, 182, 147, 147, 19, 254, 31, 15, 140, 95, 124, 158,
-    66, 71, 76, 156, 137, 175, 50, 232, 237, 119, 110, 166, 221, 128, 57, 5, 179, 30, 34, 149, 104, 52, 14, 178, 226,
-    144, 90, 247, 13, 156, 199, 200, 219, 163, 86, 187, 195, 99, 118, 80, 124, 42, 189, 29, 124, 247, 184, 97, 91, 71,
-    245, 186, 185, 206, 253, 6, 18, 20, 210, 114, 10, 241, 18, 242, 222, 143, 77, 85, 33, 173, 136, 126, 223, 43, 124,
-    194, 114, 175, 144, 174, 216, 141, 230, 33, 145, 187, 193, 26, 22, 32, 182, 57, 115, 187, 229, 15, 54, 72, 144, 210,
-    240, 145, 192, 192, 1, 133, 71, 21, 181, 200, 234, 246, 174, 206, 214, 170, 220, 107, 20, 62, 211, 219, 106, 112,
-    138, 170, 7, 195, 174, 193, 145, 247, 213, 119, 152, 199, 244, 118, 73, 33, 95, 122, 240, 82, 180, 117, 103, 68,
-    150, 211, 68, 95, 46, 191, 224, 244, 118, 142, 239, 142, 80, 150, 146, 4, 146, 110, 130, 109, 180, 242, 112, 63,
-    200, 60, 47, 12, 15, 211, 147, 139, 176, 165, 61, 149, 91, 52, 218, 158, 199, 216, 197, 168, 46, 26, 227, 176, 179,
-    43, 37, 4, 206, 234, 233, 49, 205, 47, 183, 145, 214, 114, 204, 94, 127, 191, 89, 9, 212, 78, 104, 105, 217, 21,
-    153, 179, 196, 219, 238, 3, 120, 43, 50, 180, 244, 104, 244, 30, 83, 38, 218, 15, 60, 11, 215, 235, 153, 238, 31,
-    228, 245, 149, 31, 149, 91, 91, 235, 151, 25, 8, 161, 79, 38, 227, 103, 235, 21, 75, 6, 194, 196, 4, 181, 255, 193,
-    193, 113, 238, 237, 213, 225, 165, 55, 69, 252, 124, 114, 141, 35, 114, 76, 74, 29, 2, 132, 109, 24, 139, 24, 117,
-    62, 97, 119, 233, 97, 94, 7, 41, 93, 227, 130, 121, 29, 234, 86, 212, 154, 99, 82, 233, 106, 104, 113, 13, 91, 186,
-    144, 220, 16, 51, 55, 171, 69, 46, 143, 174, 222, 23, 125, 245, 61, 15, 99, 221, 128, 217, 134, 174, 153, 201, 119,
-    58, 169, 177, 211, 66, 214, 169, 159, 208, 220, 40, 244, 84, 97, 215, 165, 181, 67, 227, 44, 117, 252, 30, 228, 15,
-    4, 169, 68, 186, 132, 143, 127, 27, 244, 91, 196, 172, 199, 234, 170, 170, 78, 100, 218, 55, 238, 114, 208, 26, 26,
-    17, 123, 231, 130, 2, 132, 233, 67, 72, 119, 245, 197, 7, 245, 211, 65, 16, 9, 215, 132, 200, 193, 161, 23, 109, 57,
-    82, 63, 71, 65, 7, 39, 9, 174, 74, 1, 192, 12, 21, 72, 48, 167, 204, 166, 104, 24, 108, 232, 149, 81, 57, 251, 156,
-    144, 46, 28, 196, 87, 29, 173, 9, 254, 215, 177, 198, 147, 168, 4, 247, 67, 1, 26, 252, 162, 201, 9, 45, 93, 37, 68,
-    83, 143, 18, 234, 205, 147, 13, 143, 78, 37, 182, 211, 15, 236, 208, 23, 70, 90, 107, 112, 101, 72, 216, 135, 8, 76,
-    7, 52, 38, 73, 4, 167, 67, 49, 223, 20, 99, 253, 104, 62, 193, 188, 220, 10, 176, 99, 37, 160, 51, 231, 134, 236,
-    21, 9, 35, 6, 161, 175, 30, 57, 89, 84, 196, 16, 158, 2, 217, 24, 242, 2, 104, 176, 252, 134, 4, 62, 49, 158, 246,
-    115, 49, 53, 131, 82, 71, 213, 31, 247, 132, 4, 123, 236, 158, 182, 147, 58, 139, 228, 18, 45, 129, 57, 176, 103,
-    47, 22, 51, 142, 96, 202, 110, 228, 136, 190, 204, 171, 72, 207, 23, 49, 109, 218, 65, 43, 162, 242, 62, 170, 95,
-    124, 80, 205, 12, 229, 63, 157, 95, 240, 46, 91, 96, 122, 25, 125, 255, 202, 38, 165, 253, 6, 54, 18, 116, 17, 230,
-    209, 45, 200, 14, 27, 215, 33, 123, 89, 49, 113, 85, 0, 163, 115, 111, 99, 186, 202, 34, 178, 241, 203, 169, 249,
-    232, 139, 240, 181, 200, 203, 104, 47, 180, 157, 110, 43, 140, 181, 19, 160, 49, 250, 27, 196, 81, 220, 82, 62, 37,
-    124, 148, 60, 216, 94, 133, 145, 189, 56, 83, 216, 176, 162, 134, 7, 169, 181, 25, 131, 225, 17, 130, 248, 176, 118,
-    205, 240, 173, 4, 133, 99, 170, 71, 121, 26, 243, 16, 147, 216, 126, 175, 122, 216, 203, 58, 60, 3, 108, 95, 208,
-    27, 219, 75, 184, 180, 252, 31, 73, 45, 92, 147, 226, 163, 129, 171, 149, 214, 253, 188, 164, 247, 29, 192, 179,
-    186, 207, 0, 11, 46, 76, 56, 54, 233, 226, 68, 175, 205, 79, 103, 73, 86, 83, 146, 45, 5, 105, 248, 66, 219, 138,
-    119, 184, 58, 202, 159, 62, 121, 200, 157, 248, 188, 81, 192, 225, 167, 83, 167, 115, 101, 253, 17, 54, 221, 49,
-    132, 61, 160, 28, 6, 140, 206, 209, 173, 245, 89, 21, 177, 22, 24, 238, 75, 187, 65, 117, 120, 54, 182, 183, 165,
-    236, 11, 32, 175, 109, 100, 58, 1, 169, 86, 115, 37, 43, 43, 103, 140, 99, 115, 179, 185, 142, 32, 214, 141, 16,
-    129, 239, 7, 98, 196, 22, 118, 57, 92, 60, 37, 36, 4, 30, 219, 195, 202, 71, 110, 195, 45, 77, 107, 210, 39, 99,
-    213, 122, 142, 73, 212, 165, 4, 164, 121, 24, 111, 94, 103, 12, 12, 73, 103, 111, 236, 77, 128, 89, 194, 61, 16,
-    182, 246, 33, 199, 244, 55, 17, 128, 95, 200, 17, 116, 82, 162, 139, 44, 78, 72, 101, 227, 25, 68, 154, 50, 111, 72,
-    152, 67, 153, 190, 246, 62, 153, 110, 23, 19, 141, 61, 10, 189, 217, 48, 31, 99, 128, 95, 6, 204, 52, 210, 31, 35,
-    102, 43, 29, 112, 112, 15, 58, 242, 106, 241, 234, 230, 8, 154, 67, 4, 65, 241, 194, 113, 122, 11, 61, 172, 0, 90,
-    116, 34, 7, 166, 138, 80, 24, 49, 119, 218, 113, 212, 111, 210, 117, 108, 149, 161, 175, 71, 167, 68, 106, 136, 1,
-    243, 144, 176, 215, 27, 234, 117, 125, 30, 227, 183, 97, 90, 234, 121, 157, 96, 159, 83, 66, 37, 46, 82, 67, 152,
-    61, 50, 39, 166, 44, 2, 71, 157, 79, 229, 144, 77, 114, 64, 224, 31, 147, 79, 199, 49, 120, 17, 197, 244, 60, 137,
-    182, 157, 179, 177, 185, 118, 79, 37, 134, 169, 195, 168, 130, 66, 237, 86, 169, 5, 37, 190, 0, 222, 93, 99, 24, 42,
-    227, 115, 253, 154, 61, 34, 57, 175, 39, 221, 245, 50, 93, 158, 81, 48, 253, 78, 251, 53, 132, 68, 176, 168, 189,
-    217, 13, 37, 234, 222, 75, 137, 195, 165, 182, 117, 182, 11, 183, 201, 123, 42, 213, 173, 55, 144, 16, 154, 205,
-    114, 177, 255, 6, 218, 219, 59, 237, 173, 87, 200, 71, 97, 245, 55, 6, 1, 146, 31, 224, 14, 130, 52, 167, 145, 216,
-    181, 36, 221, 86, 184, 106, 30, 233, 216, 174, 239, 37, 41, 239, 189, 191, 38, 34, 61, 133, 70, 137, 162, 14, 66,
-    219, 130, 49, 49, 176, 229, 6, 188, 44, 255, 68, 236, 187, 51, 48, 146, 173, 68, 249, 131, 230, 51, 129, 104, 160,
-    249, 85, 59, 197, 18, 28, 49, 139, 254, 249, 242, 73, 58, 101, 57, 70, 165, 234, 43, 78, 122, 61, 115, 178, 159,
-    243, 195, 66, 115, 59, 59, 179, 113, 184, 248, 49, 111, 198, 206, 133, 226, 81, 19, 205, 23, 99, 147, 170, 87, 10,
-    77, 138, 62, 228, 159, 201, 2, 254, 252, 123, 141, 77, 44, 134, 99, 164, 217, 78, 204, 168, 5, 159, 210, 32, 80, 29,
-    67, 11, 158, 247, 187, 47, 23, 88, 67, 226, 154, 203, 216, 42, 94, 167, 32, 5, 155, 194, 133, 250, 124, 152, 146,
-    125, 164, 225, 50, 123, 13, 199, 54, 153, 143, 182, 83, 185, 226, 69, 15, 27, 245, 89, 189, 103, 65, 180, 66, 46,
-    160, 69, 200, 24, 104, 48, 168, 146, 170, 96, 160, 169, 142, 85, 241, 121, 168, 238, 149, 207, 49, 123, 162, 121,
-    93, 165, 118, 188, 117, 137, 203, 219, 231, 124, 192, 5, 243, 89, 152, 27, 54, 208, 150, 170, 45, 46, 16, 146, 209,
-    85, 233, 0, 32, 230, 213, 71, 29, 200, 246, 182, 23, 103, 112, 62, 45, 107, 102, 212, 241, 173, 66, 235, 205, 12,
-    26, 214, 113, 192, 151, 127, 46, 242, 43, 83, 126, 34, 84, 245, 239, 56, 43, 11, 15, 163, 245, 66, 76, 150, 139,
-    240, 243, 137, 90, 50, 10, 206, 39, 3, 53, 211, 154, 184, 81, 222, 107, 199, 64, 203, 143, 122, 143, 61, 202, 190,
-    3, 207, 99, 21, 138, 211, 78, 156, 31, 242, 241, 61, 248, 8, 138, 234, 216, 77, 36, 173, 238, 198, 241, 242, 90, 19,
-    74, 216, 18, 65, 18, 241, 237, 124, 140, 4, 92, 236, 81, 92, 242, 50, 168, 5, 196, 178, 122, 150, 175, 42, 234, 80,
-    23, 28, 173, 85, 225, 29, 55, 99, 19, 178, 131, 216, 61, 164, 97, 187, 7, 102, 107, 13, 231, 44, 166, 237, 54, 165,
-    190, 237, 45, 217, 93, 115, 200, 48, 151, 227, 56, 253, 125, 1, 82, 27, 36, 148, 14, 141, 225, 193, 70, 94, 157,
-    156, 104, 170, 79, 182, 201, 62, 252, 122, 169, 186, 45, 198, 32, 119, 225, 184, 123, 141, 119, 104, 72, 221, 111,
-    118, 57, 222, 18, 248, 122, 112, 237, 177, 56, 254, 137, 237, 38, 27, 121, 80, 234, 144, 254, 117, 134, 132, 69,
-    146, 127, 66, 212, 220, 8, 111, 176, 238, 221, 127, 1, 152, 231, 173, 243, 238, 71, 177, 252, 42, 191, 203, 171,
-    142, 53, 49, 112, 157, 163, 217, 169, 234, 209, 186, 179, 100, 198, 150, 94, 145, 126, 101, 253, 87, 193, 137, 28,
-    123, 138, 62, 248, 91, 213, 127, 246, 59, 118, 58, 145, 81, 207, 2, 48, 206, 251, 181, 173, 227, 255, 210, 116, 217,
-    37, 150, 94, 112, 178, 29, 14, 32, 99, 77, 181, 1, 214, 174, 22, 75, 86, 229, 133, 55, 222, 81, 196, 76, 246, 3,
-    210, 243, 228, 40, 152, 137, 29, 50, 61, 122, 235, 40, 170, 31, 181, 225, 118, 20, 111, 176, 158, 155, 56, 147, 41,
-    43, 231, 185, 36, 120, 88, 168, 52, 52, 226, 188, 51, 150, 76, 180, 84, 60, 161, 236, 180, 227, 176, 188, 95, 227,
-    55, 135, 153, 251, 221, 206, 174, 196, 72, 33, 117, 170, 202, 26, 91, 195, 63, 152, 129, 170, 141, 250, 47, 43, 231,
-    67, 241, 35, 32, 226, 142, 194, 99, 0, 91, 28, 118, 17, 13, 58, 244, 181, 52, 191, 30, 75, 69, 255, 213, 64, 155,
-    47, 248, 153, 75, 164, 22, 144, 209, 161, 198, 127, 51, 202, 151, 215, 78, 69, 180, 246, 57, 24, 15, 94, 221, 182,
-    31, 124, 205, 39, 171, 190, 113, 148, 38, 83, 19, 1, 65, 2, 183, 87, 112, 48, 209, 82, 26, 62, 153, 255, 122, 192,
-    26, 88, 62, 242, 46, 41, 71, 151, 171, 127, 248, 210, 199, 3, 4, 64, 3, 9, 242, 244, 32, 192, 254, 227, 199, 227,
-    30, 91, 224, 72, 50, 66, 234, 92, 190, 211, 27, 253, 183, 3, 242, 28, 114, 238, 69, 69, 156, 50, 59, 151, 53, 64,
-    146, 68, 109, 46, 245, 117, 95, 95, 99, 171, 157, 132, 31, 9, 179, 198, 101, 249, 31, 183, 182, 20, 37, 169, 205,
-    237, 28, 74, 178, 181, 3, 39, 173, 0, 183, 93, 35, 175, 239, 36, 136, 235, 204, 87, 77, 253, 239, 42, 45, 145, 175,
-    210, 71, 13, 98, 25, 187, 137, 221, 208, 97, 24, 107, 217, 78, 137, 221, 141, 66, 181, 245, 13, 92, 199, 59, 199,
-    158, 238, 98, 124, 169, 40, 6, 38, 230, 213, 89, 63, 78, 98, 78, 47, 5, 16, 113, 136, 240, 230, 213, 27, 54, 194,
-    37, 70, 42, 213, 37, 246, 63, 32, 75, 127, 182, 170, 158, 242, 54, 183, 163, 228, 182, 191, 25, 43, 108, 147, 51,
-    17, 191, 207, 24, 172, 22, 84, 177, 66, 66, 201, 204, 152, 49, 79, 189, 102, 82, 108, 122, 13, 167, 153, 124, 165,
-    59, 88, 102, 65, 244, 205, 62, 150, 94, 11, 170, 135, 53, 8, 176, 2, 185, 151, 188, 140, 16, 90, 153, 55, 255, 239,
-    249, 36, 194, 195, 82, 56, 117, 254, 135, 181, 205, 130, 133, 187, 64, 1, 180, 170, 37, 235, 94, 209, 160, 115, 142,
-    166, 32, 100, 60, 125, 61, 120, 88, 5, 144, 109, 237, 71, 93, 69, 237, 201, 205, 175, 178, 134, 89, 162, 38, 75,
-    244, 13, 72, 39, 230, 199, 27, 221, 181, 149, 80, 34, 163, 212, 216, 66, 132, 66, 10, 141, 153, 53, 97, 150, 62, 63,
-    189, 36, 41, 156, 67, 25, 223, 246, 11, 176, 69, 243, 80, 2, 181, 154, 114, 52, 174, 47, 191, 40, 115, 249, 153,
-    215, 211, 89, 5, 191, 158, 223, 174, 108, 168, 207, 205, 206, 15, 154, 177, 164, 140, 77, 252, 126, 176, 26, 78, 27,
-    60, 130, 73, 213, 101, 176, 30, 208, 132, 131, 42, 104, 57, 31, 210, 157, 146, 213, 12, 61, 139, 38, 252, 38, 94,
-    59, 23, 43, 40, 107, 226, 108, 190, 42, 126, 65, 210, 27, 87, 128, 167, 155, 39, 183, 132, 224, 23, 116, 165, 8, 34,
-    8, 159, 8, 123, 175, 187, 152, 214, 0, 94, 214, 150, 236, 238, 190, 72, 111, 19, 121, 50, 117, 22, 79, 249, 32, 32,
-    97, 223, 206, 242, 86, 68, 72, 2, 29, 248, 207, 171, 142, 77, 138, 55, 54, 69, 205, 131, 217, 160, 64, 205, 213, 7,
-    189, 22, 23, 248, 71, 245, 137, 131, 140, 116, 157, 61, 43, 200, 178, 132, 183, 87, 110, 104, 107, 48, 93, 216, 18,
-    50, 60, 224, 120, 210, 190, 121, 220, 9, 39, 84, 45, 164, 206, 40, 170, 189, 111, 57, 120, 117, 238, 194, 249, 60,
-    80, 17, 178, 125, 74, 27, 81, 31, 96, 21, 1, 152, 181, 146, 233, 105, 137, 51, 94, 209, 223, 64, 212, 130, 89, 31,
-    34, 44, 41, 56, 192, 113, 181, 229, 79, 126, 220, 25, 37, 149, 228, 124, 231, 100, 76, 42, 131, 242, 92, 11, 169,
-    14, 12, 89, 114, 172, 153, 239, 241, 216, 213, 134, 138, 154, 108, 92, 224, 7, 8, 142, 159, 232, 173, 53, 188, 236,
-    159, 92, 121, 13, 189, 212, 143, 234, 15, 56, 2, 187, 43, 65, 68, 68, 247, 68, 87, 145, 247, 209, 40, 185, 196, 101,
-    63, 213, 47, 91, 88, 133, 58, 99, 182, 198, 53, 24, 147, 66, 24, 130, 250, 147, 15, 39, 99, 212, 191, 221, 100, 22,
-    31, 173, 178, 10, 203, 230, 17, 155, 120, 106, 134, 212, 234, 47, 130, 160, 11, 185, 41, 203, 226, 127, 92, 186, 46,
-    53, 158, 194, 79, 236, 9, 38, 93, 92, 184, 172, 51, 60, 19, 12, 24, 155, 137, 94, 143, 126, 133, 108, 8, 251, 226,
-    138, 108, 81, 29, 224, 229, 185, 45, 148, 115, 59, 17, 215, 121, 34, 172, 121, 110, 90, 134, 226, 17, 241, 68, 177,
-    219, 241, 206, 130, 11, 121, 154, 248, 30, 22, 211, 183, 228, 63, 41, 231, 179, 255, 47, 242, 111, 37, 248, 210, 70,
-    97, 166, 192, 241, 141, 42, 189, 70, 31, 56, 235, 96, 136, 225, 135, 127, 245, 134, 222, 73, 244, 237, 90, 73, 6,
-    241, 240, 110, 144, 50, 228, 221, 62, 19, 198, 88, 203, 89, 1, 177, 104, 75, 203, 37, 239, 240, 122, 109, 208, 170,
-    3, 230, 3, 197, 129, 98, 174, 80, 120, 95, 16, 34, 244, 170, 58, 84, 66, 92, 34, 204, 182, 217, 119, 147, 234, 46,
-    28, 52, 241, 190, 71, 51, 230, 119, 140, 141, 127, 113, 248, 22, 10, 51, 182, 77, 121, 49, 154, 225, 97, 57, 151,
-    86, 76, 83, 4, 7, 199, 121, 210, 166, 214, 239, 108, 146, 163, 86, 64, 243, 143, 174, 95, 69, 191, 139, 97, 104, 71,
-    36, 115, 222, 30, 30, 144, 126, 240, 45, 218, 67, 218, 32, 37, 0, 227, 254, 32, 118, 21, 116, 128, 201, 182, 24,
-    105, 171, 74, 105, 156, 192, 83, 83, 245, 203, 183, 6, 177, 143, 246, 229, 117, 232, 100, 212, 177, 108, 34, 31, 27,
-    116, 109, 42, 8, 103, 169, 218, 231, 205, 237, 104, 25, 98, 127, 67, 126, 104, 103, 215, 34, 202, 62, 230, 57, 24,
-    93, 244, 220, 49, 189, 70, 137, 141, 193, 82, 179, 56, 48, 56, 68, 137, 164, 189, 25, 170, 92, 39, 46, 206, 18, 119,
-    70, 115, 17, 130, 36, 235, 235, 206, 34, 186, 100, 158, 202, 91, 228, 115, 88, 27, 90, 40, 61, 178, 139, 130, 231,
-    236, 52, 41, 237, 5, 66, 186, 82, 245, 81, 108, 82, 162, 181, 71, 175, 78, 113, 1, 11, 238, 169, 63, 223, 230, 93,
-    63, 123, 186, 35, 130, 146, 117, 187, 224, 106, 80, 144, 89, 91, 82, 117, 103, 13, 166, 168, 14, 200, 127, 170, 154,
-    98, 151, 100, 130, 101, 63, 64, 185, 233, 50, 97, 114, 20, 228, 27, 202, 160, 251, 84, 166, 249, 239, 231, 184, 10,
-    109, 50, 179, 160, 191, 148, 250, 12, 162, 86, 131, 135, 183, 48, 26, 15, 144, 57, 255, 218, 64, 133, 210, 141, 137,
-    98, 243, 140, 117, 58, 57, 145, 211, 6, 124, 127, 92, 137, 67, 41, 172, 67, 119, 67, 245, 215, 173, 183, 167, 149,
-    20, 235, 206, 63, 215, 10, 217, 121, 81, 173, 155, 43, 91, 193, 115, 7, 176, 227, 166, 149, 38, 9, 95, 89, 192, 161,
-    123, 147, 55, 240, 27, 19, 197, 131, 255, 7, 253, 100, 213, 230, 190, 163, 43, 122, 98, 65, 88, 40, 33, 0, 170, 198,
-    156, 148, 116, 102, 112, 66, 251, 210, 26, 46, 39, 107, 28, 201, 226, 157, 83, 88, 161, 37, 108, 230, 170, 69, 17,
-    192, 196, 180, 136, 177, 40, 197, 246, 86, 186, 39, 221, 91, 155, 141, 234, 3, 115, 218, 58, 27, 185, 202, 177, 212,
-    202, 71, 40, 237, 207, 120, 89, 240, 12, 166, 103, 194, 231, 190, 178, 6, 100, 226, 234, 121, 215, 43, 35, 196, 145,
-    204, 139, 252, 223, 106, 63, 226, 20, 46, 175, 20, 199, 51, 235, 75, 162, 17, 39, 162, 152, 220, 134, 96, 183, 12,
-    120, 132, 65, 123, 139, 217, 118, 142, 37, 24, 113, 171, 19, 96, 15, 187, 87, 111, 163, 212, 86, 66, 131, 81, 209,
-    113, 33, 208, 74, 130, 170, 119, 153, 224, 65, 54, 191, 252, 7, 98, 107, 71, 55, 90, 107, 41, 187, 156, 3, 201, 147,
-    74, 98, 39, 138, 98, 210, 110, 108, 30, 221, 139, 135, 8, 60, 240, 231, 29, 52, 159, 43, 96, 94, 52, 106, 64, 22,
-    96, 49, 108, 179, 63, 217, 84, 165, 13, 75, 243, 129, 109, 41, 21, 45, 124, 75, 53, 203, 53, 67, 148, 27, 112, 50,
-    253, 165, 222, 190, 60, 89, 82, 26, 137, 253, 174, 17, 7, 130, 90, 101, 246, 57, 152, 11, 128, 174, 91, 149, 219,
-    242, 242, 48, 118, 170, 77, 66, 28, 178, 36, 6, 32, 238, 10, 109, 90, 145, 55, 82, 129, 43, 230, 130, 22, 165, 66,
-    14, 10, 175, 155, 94, 115, 118, 237, 80, 82, 11, 208, 54, 239, 56, 109, 132, 2, 200, 149, 57, 57, 195, 42, 214, 77,
-    233, 34, 145, 189, 70, 41, 122, 32, 185, 194, 111, 120, 32, 10, 88, 212, 81, 59, 93, 172, 131, 22, 62, 243, 187, 58,
-    231, 3, 17, 75, 93, 143, 141, 15, 149, 159, 128, 247, 159, 218, 121, 14, 45, 22, 139, 134, 236, 125, 32, 114, 115,
-    30, 192, 45, 220, 236, 217, 28, 59, 188, 159, 26, 25, 175, 98, 102, 201, 13, 217, 77, 152, 53, 244, 20, 127, 248,
-    97, 40, 87, 189, 91, 222, 88, 100, 101, 139, 199, 127, 146, 190, 160, 170, 56, 108, 162, 187, 33, 118, 127, 17, 228,
-    247, 71, 6, 225, 120, 203, 39, 53, 225, 240, 195, 59, 10, 123, 154, 102, 15, 116, 77, 250, 86, 242, 190, 59, 94,
-    138, 45, 154, 154, 214, 79, 198, 238, 31, 117, 161, 180, 51, 201, 227, 85, 205, 239, 215, 164, 6, 59, 63, 120, 99,
-    173, 127, 222, 57, 251, 122, 4, 57, 34, 70, 225, 62, 237, 242, 252, 50, 223, 151, 76, 245, 0, 84, 80, 116, 243, 156,
-    161, 255, 83, 29, 206, 130, 97, 238, 80, 60, 171, 230, 45, 240, 74, 253, 45, 63, 164, 165, 130, 213, 159, 211, 247,
-    188, 200, 184, 7, 200, 227, 122, 37, 21, 204, 158, 206, 54, 35, 86, 112, 38, 52, 253, 20, 119, 71, 252, 63, 31, 79,
-    91, 55, 17, 54, 149, 242, 0, 122, 78, 107, 79, 238, 193, 222, 145, 156, 31, 220, 27, 54, 109, 110, 252, 159, 252,
-    188, 236, 59, 228, 235, 87, 140, 111, 158, 77, 77, 122, 200, 60, 39, 147, 102, 86, 135, 186, 191, 43, 182, 250, 246,
-    131, 211, 250, 185, 11, 27, 200, 175, 1, 166, 18, 205, 224, 161, 38, 59, 89, 43, 230, 129, 10, 12, 80, 136, 173,
-    220, 161, 237, 77, 13, 151, 215, 218, 15, 112, 204, 231, 99, 95, 33, 218, 213, 53, 135, 2, 46, 94, 90, 246, 251,
-    121, 192, 47, 126, 63, 173, 215, 139, 100, 168, 254, 78, 79, 67, 25, 191, 120, 220, 241, 117, 169, 119, 226, 146,
-    201, 235, 193, 73, 102, 107, 90, 238, 62, 35, 64, 194, 225, 137, 30, 17, 4, 98, 126, 88, 239, 203, 176, 199, 52, 60,
-    232, 232, 200, 26, 111, 150, 112, 54, 250, 14, 7, 190, 165, 65, 75, 226, 5, 1, 174, 117, 137, 118, 210, 106, 209,
-    233, 228, 130, 152, 45, 107, 94, 142, 157, 190, 121, 53, 179, 87, 135, 4, 93, 95, 70, 146, 126, 14, 99, 226, 28,
-    184, 97, 22, 199, 242, 173, 224, 252, 42, 129, 138, 232, 160, 10, 29, 84, 233, 247, 142, 13, 151, 157, 101, 52, 196,
-    238, 251, 163, 235, 193, 20, 114, 96, 181, 106, 139, 147, 224, 228, 135, 252, 18, 142, 198, 192, 110, 103, 152, 61,
-    233, 145, 51, 218, 98, 120, 252, 97, 172, 67, 209, 89, 223, 222, 149, 249, 203, 137, 97, 149, 53, 31, 28, 107, 14,
-    27, 248, 209, 209, 96, 25, 44, 101, 133, 9, 63, 67, 122, 229, 180, 120, 241, 100, 28, 175, 75, 59, 236, 163, 168,
-    209, 240, 87, 6, 222, 14, 135, 141, 109, 149, 79, 74, 31, 154, 202, 94, 169, 165, 32, 67, 62, 50, 240, 163, 90, 221,
-    242, 96, 153, 193, 249, 164, 221, 229, 241, 142, 222, 191, 130, 167, 78, 191, 179, 91, 88, 221, 173, 161, 181, 184,
-    243, 156, 113, 212, 30, 136, 20, 190, 247, 199, 168, 190, 82, 185, 169, 206, 132, 191, 101, 239, 84, 211, 146, 46,
-    10, 151, 189, 129, 68, 155, 199, 22, 228, 17, 231, 0, 65, 224, 11, 161, 155, 216, 70, 76, 244, 2, 134, 180, 124, 7,
-    211, 109, 229, 67, 191, 136, 191, 194, 155, 250, 122, 167, 43, 2, 57, 170, 233, 55, 237, 167, 153, 26, 150, 5, 91,
-    120, 47, 129, 30, 242, 233, 109, 144, 118, 236, 171, 220, 123, 15, 143, 52, 45, 5, 166, 112, 174, 236, 173, 175, 13,
-    169, 182, 198, 173, 122, 246, 121, 255, 40, 49, 220, 139, 108, 115, 65, 122, 108, 128, 58, 246, 9, 153, 19, 162, 9,
-    184, 114, 102, 155, 6, 160, 209, 35, 58, 122, 101, 14, 240, 37, 32, 128, 189, 86, 26, 68, 115, 109, 47, 126, 189,
-    104, 51, 196, 93, 191, 139, 143, 37, 135, 168, 130, 61, 62, 52, 52, 26, 34, 254, 164, 188, 111, 46, 29, 108, 167,
-    156, 167, 76, 67, 38, 153, 160, 26, 119, 39, 175, 64, 131, 32, 122, 126, 238, 22, 208, 72, 168, 90, 128, 191, 205,
-    162, 244, 150, 207, 67, 177, 70, 11, 183, 170, 134, 64, 40, 72, 244, 41, 134, 97, 2, 188, 132, 112, 65, 42, 193,
-    215, 214, 170, 46, 128, 43, 77, 59, 58, 225, 117, 153, 236, 161, 163, 78, 172, 212, 226, 31, 51, 202, 211, 93, 190,
-    130, 48, 163, 237, 247, 210, 238, 66, 187, 97, 162, 252, 190, 168, 175, 135, 253, 143, 131, 111, 156, 128, 52, 111,
-    186, 231, 184, 253, 135, 164, 218, 215, 12, 108, 87, 206, 148, 102, 125, 183, 155, 18, 85, 188, 242, 63, 131, 36,
-    168, 32, 29, 36, 60, 129, 24, 219, 228, 218, 78, 49, 87, 80, 126, 227, 242, 78, 74, 48, 100, 0, 196, 47, 177, 176,
-    59, 100, 211, 48, 123, 201, 131, 35, 21, 124, 197, 244, 219, 142, 64, 45, 139, 40, 188, 124, 36, 130, 218, 230, 14,
-    206, 249, 181, 86, 220, 199, 99, 251, 87, 6, 67, 244, 6, 81, 172, 138, 220, 159, 252, 153, 199, 218, 208, 235, 161,
-    187, 79, 197, 200, 55, 252, 78, 98, 19, 117, 170, 69, 128, 129, 131, 76, 207, 184, 136, 192, 121, 202, 11, 202, 82,
-    248, 7, 219, 81, 242, 86, 27, 255, 31, 247, 227, 201, 23, 234, 168, 66, 172, 236, 15, 157, 218, 68, 136, 174, 102,
-    223, 206, 82, 188, 208, 230, 114, 235, 218, 21, 120, 126, 74, 173, 136, 193, 152, 124, 80, 184, 234, 217, 141, 79,
-    211, 226, 245, 187, 163, 71, 210, 240, 216, 231, 250, 99, 59, 168, 201, 191, 248, 40, 192, 153, 250, 47, 207, 146,
-    253, 165, 124, 125, 209, 181, 127, 154, 25, 107, 9, 221, 178, 63, 172, 72, 137, 92, 210, 44, 127, 84, 4, 32, 190, 8,
-    21, 163, 135, 32, 191, 28, 194, 94, 198, 151, 12, 154, 141, 199, 172, 188, 203, 9, 133, 224, 167, 229, 200, 18, 234,
-    27, 217, 167, 64, 32, 248, 55, 205, 167, 34, 31, 78, 95, 9, 58, 216, 166, 48, 166, 156, 123, 129, 107, 249, 12, 169,
-    29, 150, 106, 86, 134, 213, 26, 149, 147, 230, 66, 24, 145, 46, 100, 170, 5, 216, 145, 42, 46, 86, 209, 55, 154, 69,
-    150, 135, 79, 4, 178, 24, 55, 44, 181, 148, 72, 92, 127, 61, 230, 23, 75, 66, 139, 175, 237, 204, 127, 105, 75, 55,
-    176, 245, 211, 5, 162, 66, 106, 24, 126, 193, 163, 97, 34, 41, 251, 226, 170, 241, 11, 104, 61, 208, 254, 31, 239,
-    99, 68, 62, 238, 74, 123, 205, 60, 108, 110, 106, 135, 113, 70, 244, 166, 246, 223, 171, 119, 160, 113, 155, 170,
-    140, 146, 18, 216, 26, 134, 110, 22, 85, 245, 80, 147, 211, 226, 42, 101, 222, 254, 248, 60, 183, 113, 58, 113, 43,
-    147, 238, 87, 98, 226, 204, 241, 192, 230, 223, 109, 0, 229, 245, 28, 118, 253, 146, 22, 122, 42, 106, 155, 236, 33,
-    26, 181, 239, 148, 255, 72, 186, 150, 93, 255, 85, 209, 117, 26, 243, 47, 141, 158, 130, 210, 212, 70, 160, 146, 64,
-    2, 108, 171, 99, 13, 131, 23, 101, 193, 145, 43, 242, 176, 207, 178, 172, 15, 129, 17, 217, 113, 6, 238, 158, 146,
-    79, 152, 67, 24, 89, 191, 161, 181, 206, 80, 188, 210, 219, 130, 67, 60, 30, 115, 162, 244, 184, 112, 234, 84, 171,
-    254, 215, 234, 131, 253, 250, 173, 31, 111, 35, 150, 5, 245, 253, 185, 154, 255, 55, 212, 97, 246, 238, 60, 222, 28,
-    20, 252, 96, 57, 114, 246, 55, 241, 201, 30, 176, 153, 59, 153, 119, 249, 156, 128, 106, 14, 83, 114, 38, 181, 156,
-    7, 46, 59, 23, 130, 146, 188, 137, 19, 86, 207, 139, 3, 196, 3, 247, 157, 219, 103, 81, 158, 89, 32, 178, 180, 192,
-    222, 215, 117, 212, 133, 143, 74, 58, 143, 121, 143, 120, 122, 104, 26, 3, 245, 73, 181, 66, 1, 47, 27, 118, 162,
-    128, 206, 173, 57, 233, 36, 64, 16, 64, 19, 175, 106, 17, 191, 22, 221, 237, 151, 215, 42, 209, 74, 18, 14, 135,
-    113, 210, 184, 226, 216, 188, 93, 244, 64, 188, 115, 157, 51, 207, 36, 189, 190, 128, 156, 46, 186, 0, 70, 227, 172,
-    20, 52, 130, 83, 62, 35, 152, 5, 68, 148, 49, 103, 40, 225, 74, 62, 188, 27, 40, 107, 206, 69, 105, 94, 234, 99,
-    227, 171, 172, 244, 121, 128, 160, 123, 69, 108, 9, 25, 89, 98, 24, 118, 35, 83, 31, 65, 236, 195, 143, 53, 200, 19,
-    192, 67, 11, 220, 99, 193, 192, 114, 183, 62, 196, 22, 100, 156, 214, 79, 118, 7, 73, 150, 34, 251, 132, 181, 30,
-    188, 35, 205, 232, 100, 225, 12, 170, 117, 114, 73, 140, 201, 71, 171, 181, 164, 118, 239, 149, 214, 97, 218, 147,
-    64, 70, 46, 126, 90, 224, 18, 233, 12, 51, 122, 125, 153, 63, 115, 144, 14, 47, 182, 100, 6, 230, 104, 136, 66, 198,
-    106, 147, 181, 241, 110, 188, 140, 102, 143, 136, 14, 132, 236, 118, 112, 88, 227, 209, 122, 102, 74, 31, 239, 210,
-    130, 190, 83, 42, 41, 122, 136, 54, 131, 254, 68, 92, 116, 215, 185, 51, 115, 24, 183, 228, 252, 95, 122, 13, 253,
-    210, 240, 78, 234, 58, 243, 31, 163, 111, 172, 90, 254, 13, 244, 242, 153, 37, 99, 92, 39, 12, 15, 244, 48, 23, 225,
-    62, 70, 203, 0, 110, 6, 235, 98, 190, 177, 190, 108, 235, 89, 237, 216, 0, 233, 83, 34, 77, 15, 158, 220, 182, 146,
-    50, 119, 62, 197, 184, 27, 192, 233, 71, 138, 209, 173, 224, 48, 178, 19, 147, 96, 205, 137, 29, 16, 79, 138, 96,
-    135, 69, 239, 106, 94, 116, 152, 116, 49, 186, 175, 255, 160, 57, 75, 31, 89, 93, 246, 94, 73, 91, 247, 131, 218,
-    20, 37, 20, 89, 149, 48, 150, 97, 141, 114, 252, 245, 131, 101, 12, 58, 231, 204, 135, 197, 246, 109, 140, 113, 123,
-    42, 123, 71, 29, 160, 138, 173, 216, 102, 110, 151, 182, 227, 161, 241, 92, 81, 41, 240, 128, 69, 102, 223, 192,
-    100, 140, 167, 23, 167, 146, 200, 249, 66, 134, 23, 94, 153, 220, 198, 80, 224, 208, 196, 197, 94, 174, 148, 128,
-    134, 232, 198, 26, 81, 110, 39, 2, 169, 202, 49, 66, 7, 97, 251, 175, 187, 145, 92, 238, 108, 114, 199, 130, 206,
-    131, 167, 250, 103, 41, 99, 87, 167, 105, 53, 113, 186, 104, 191, 199, 46, 78, 102, 86, 184, 8, 13, 67, 116, 216,
-    252, 110, 84, 164, 154, 120, 15, 244, 74, 196, 151, 71, 206, 213, 178, 33, 25, 133, 69, 233, 117, 218, 138, 15, 217,
-    71, 37, 52, 208, 190, 255, 72, 102, 72, 46, 186, 70, 162, 70, 149, 180, 11, 2, 209, 80, 74, 158, 23, 160, 71, 9,
-    145, 212, 202, 244, 56, 158, 178, 195, 76, 71, 127, 173, 141, 16, 229, 150, 50, 167, 179, 216, 100, 252, 125, 98,
-    11, 57, 225, 220, 221, 174, 248, 32, 157, 29, 253, 16, 62, 213, 72, 185, 63, 122, 9, 134, 179, 218, 230, 62, 93,
-    171, 195, 86, 241, 235, 172, 213, 229, 88, 79, 124, 119, 142, 2, 142, 139, 33, 13, 144, 44, 52, 250, 194, 249, 236,
-    250, 221, 144, 210, 89, 15, 121, 57, 24, 70, 127, 113, 19, 121, 23, 207, 26, 155, 156, 10, 182, 14, 18, 33, 60, 230,
-    183, 34, 137, 159, 201, 57, 217, 111, 5, 9, 205, 22, 165, 87, 99, 205, 242, 131, 132, 173, 44, 208, 156, 158, 145,
-    188, 225, 108, 73, 230, 56, 125, 97, 4, 156, 149, 34, 107, 183, 99, 67, 190, 120, 80, 127, 58, 43, 66, 133, 19, 7,
-    84, 35, 74, 107, 118, 160, 75, 154, 219, 244, 48, 150, 40, 137, 73, 219, 238, 217, 53, 94, 146, 179, 255, 250, 231,
-    114, 99, 48, 200, 74, 172, 110, 63, 113, 171, 255, 96, 182, 163, 65, 18, 45, 10, 124, 59, 119, 74, 155, 4, 144, 247,
-    196, 1, 178, 94, 16, 86, 82, 20, 182, 163, 238, 163, 33, 85, 175, 78, 61, 55, 108, 219, 84, 185, 154, 70, 100, 163,
-    130, 184, 7, 97, 85, 138, 185, 139, 138, 13, 4, 125, 71, 217, 171, 97, 50, 44, 82, 96, 51, 54, 153, 58, 27, 251,
-    163, 233, 169, 136, 26, 88, 235, 81, 177, 171, 192, 173, 9, 217, 33, 117, 224, 95, 188, 74, 213, 14, 21, 68, 80,
-    209, 155, 91, 203, 135, 122, 97, 123, 87, 8, 45, 68, 159, 241, 54, 47, 58, 244, 48, 102, 169, 90, 246, 13, 191, 156,
-    227, 46, 143, 88, 217, 52, 165, 202, 47, 170, 129, 235, 1, 89, 162, 173, 38, 26, 54, 40, 205, 14, 100, 110, 138,
-    172, 106, 114, 178, 14, 93, 220, 178, 154, 247, 11, 234, 49, 103, 41, 166, 29, 224, 95, 76, 45, 127, 0, 152, 103,
-    27, 146, 171, 254, 71, 119, 175, 207, 51, 94, 17, 228, 114, 78, 24, 100, 15, 246, 31, 243, 9, 228, 89, 30, 230, 6,
-    244, 95, 173, 207, 212, 71, 89, 119, 252, 78, 115, 115, 236, 69, 208, 3, 14, 255, 4, 218, 179, 133, 155, 211, 97,
-    112, 59, 5, 75, 1, 227, 176, 173, 162, 238, 127, 234, 7, 207, 46, 38, 137, 104, 245, 238, 121, 104, 3, 241, 231,
-    105, 124, 26, 229, 63, 211, 108, 116, 249, 161, 80, 174, 44, 170, 148, 119, 54, 242, 147, 22, 49, 197, 189, 124,
-    102, 196, 237, 239, 91, 65, 146, 27, 111, 139, 105, 8, 159, 35, 45, 97, 222, 196, 83, 19, 141, 175, 231, 179, 61,
-    131, 81, 131, 10, 209, 107, 37, 239, 10, 143, 97, 230, 64, 95, 186, 186, 78, 148, 100, 27, 91, 88, 86, 84, 240, 126,
-    61, 43, 219, 157, 4, 131, 73, 84, 26, 139, 183, 183, 133, 236, 55, 44, 12, 249, 15, 158, 151, 121, 94, 114, 18, 245,
-    137, 124, 221, 213, 232, 193, 83, 164, 130, 168, 223, 0, 145, 195, 187, 67, 75, 180, 78, 247, 229, 180, 235, 90, 30,
-    176, 15, 221, 167, 100, 182, 155, 27, 229, 242, 195, 36, 29, 70, 225, 67, 209, 37, 167, 100, 119, 170, 130, 217,
-    134, 59, 9, 204, 185, 8, 241, 111, 10, 109, 209, 81, 234, 124, 184, 117, 191, 26, 105, 26, 183, 139, 155, 155, 41,
-    89, 137, 141, 200, 156, 214, 239, 8, 211, 84, 181, 201, 69, 216, 174, 89, 91, 229, 183, 183, 244, 71, 84, 77, 12,
-    59, 180, 226, 102, 103, 11, 250, 101, 206, 220, 32, 237, 89, 172, 203, 94, 72, 79, 99, 203, 34, 46, 52, 182, 69,
-    239, 15, 179, 169, 138, 251, 154, 148, 56, 26, 121, 173, 62, 116, 160, 142, 192, 101, 196, 243, 66, 80, 238, 186, 6,
-    204, 227, 11, 104, 13, 199, 79, 133, 10, 53, 173, 255, 47, 72, 87, 50, 109, 9, 110, 95, 246, 189, 82, 43, 9, 103, 7,
-    165, 67, 42, 34, 223, 163, 123, 180, 179, 148, 120, 226, 198, 96, 197, 236, 181, 55, 77, 229, 237, 47, 193, 83, 26,
-    237, 254, 36, 97, 131, 115, 38, 25, 105, 187, 47, 238, 118, 48, 207, 182, 222, 63, 203, 202, 104, 205, 32, 21, 86,
-    21, 17, 2, 68, 149, 38, 104, 83, 224, 155, 16, 99, 229, 217, 199, 135, 3, 118, 57, 226, 16, 83, 219, 84, 229, 132,
-    75, 147, 254, 225, 55, 85, 72, 158, 48, 102, 209, 86, 158, 32, 71, 29, 131, 151, 217, 146, 115, 59, 166, 15, 206,
-    86, 163, 42, 16, 21, 150, 151, 162, 230, 225, 84, 79, 138, 27, 251, 191, 252, 21, 38, 185, 87, 246, 22, 5, 69, 254,
-    51, 11, 167, 108, 173, 142, 201, 14, 87, 125, 129, 52, 208, 51, 7, 148, 116, 2, 26, 181, 24, 1, 209, 28, 254, 14,
-    233, 18, 50, 118, 113, 194, 65, 227, 236, 251, 159, 255, 11, 74, 192, 88, 209, 65, 88, 79, 43, 191, 172, 139, 71,
-    231, 5, 176, 60, 216, 9, 43, 44, 222, 44, 227, 171, 228, 72, 153, 190, 229, 228, 181, 182, 120, 151, 184, 4, 156,
-    92, 92, 29, 62, 236, 160, 80, 206, 72, 176, 222, 150, 43, 187, 51, 103, 226, 179, 223, 200, 198, 185, 96, 36, 78,
-    40, 239, 205, 52, 187, 184, 59, 97, 188, 189, 80, 166, 109, 99, 61, 37, 97, 226, 143, 88, 55, 33, 247, 115, 195,
-    121, 133, 66, 139, 5, 24, 149, 219, 58, 28, 46, 61, 49, 3, 84, 19, 102, 61, 61, 70, 185, 170, 196, 10, 173, 123,
-    217, 65, 111, 5, 99, 139, 191, 80, 184, 6, 46, 15, 59, 177, 255, 194, 19, 232, 2, 68, 79, 70, 236, 50, 217, 212,
-    121, 234, 232, 64, 63, 135, 48, 211, 165, 128, 171, 4, 152, 248, 167, 17, 99, 248, 226, 124, 67, 147, 168, 22, 23,
-    200, 92, 231, 87, 90, 159, 113, 109, 236, 93, 204, 102, 196, 55, 3, 32, 233, 255, 197, 13, 170, 18, 9, 217, 145, 68,
-    130, 153, 239, 244, 164, 18, 110, 170, 228, 71, 212, 155, 220, 49, 167, 253, 157, 243, 102, 173, 187, 143, 88, 62,
-    170, 73, 115, 58, 124, 210, 2, 113, 209, 252, 8, 64, 54, 241, 209, 126, 142, 3, 85, 139, 156, 77, 213, 102, 244,
-    175, 51, 28, 212, 15, 227, 11, 225, 73, 87, 250, 157, 121, 111, 153, 250, 29, 56, 215, 194, 81, 49, 212, 223, 181,
-    99, 41, 54, 197, 150, 156, 243, 64, 214, 185, 203, 88, 12, 24, 55, 218, 61, 210, 193, 153, 190, 129, 155, 127, 254,
-    19, 130, 44, 59, 18, 5, 219, 212, 240, 141, 173, 129, 195, 88, 69, 48, 71, 148, 165, 188, 118, 34, 201, 84, 39, 205,
-    208, 73, 36, 56, 155, 81, 94, 236, 189, 117, 89, 54, 9, 147, 36, 98, 208, 43, 10, 103, 26, 81, 112, 254, 80, 214,
-    186, 143, 206, 111, 166, 130, 126, 194, 19, 228, 16, 131, 76, 132, 92, 223, 88, 170, 26, 249, 134, 162, 7, 31, 145,
-    69, 151, 91, 159, 187, 162, 77, 104, 119, 55, 3, 193, 86, 160, 247, 51, 251, 139, 210, 188, 33, 184, 118, 59, 205,
-    219, 128, 157, 3, 145, 124, 55, 52, 26, 164, 52, 241, 6, 34, 210, 22, 20, 66, 192, 250, 47, 3, 44, 26, 154, 96, 45,
-    229, 197, 188, 224, 155, 156, 63, 238, 114, 147, 85, 73, 211, 3, 225, 46, 2, 119, 124, 19, 214, 77, 187, 115, 38,
-    198, 98, 202, 153, 25, 64, 75, 203, 216, 189, 185, 230, 12, 18, 137, 247, 142, 93, 152, 107, 50, 13, 97, 102, 231,
-    25, 231, 130, 218, 8, 210, 105, 1, 81, 114, 66, 178, 20, 164, 82, 82, 81, 15, 200, 255, 131, 121, 130, 183, 140,
-    142, 150, 107, 88, 192, 202, 19, 249, 12, 89, 26, 182, 173, 105, 51, 196, 246, 125, 78, 221, 181, 129, 127, 135,
-    137, 223, 30, 147, 187, 150, 147, 11, 221, 146, 219, 234, 74, 60, 138, 194, 156, 217, 188, 246, 103, 13, 102, 233,
-    109, 153, 132, 227, 132, 134, 190, 226, 104, 170, 7, 153, 220, 45, 123, 210, 114, 131, 64, 165, 235, 162, 160, 188,
-    43, 119, 232, 112, 168, 193, 129, 184, 231, 137, 148, 21, 98, 52, 96, 85, 10, 31, 149, 4, 214, 12, 164, 71, 199,
-    200, 160, 100, 245, 136, 144, 6, 174, 112, 57, 251, 230, 146, 97, 173, 102, 150, 45, 65, 142, 227, 77, 37, 118, 66,
-    144, 45, 168, 126, 184, 119, 19, 227, 119, 212, 190, 23, 181, 128, 162, 223, 161, 12, 96, 83, 20, 40, 121, 109, 206,
-    216, 190, 171, 82, 43, 150, 106, 79, 210, 2, 60, 57, 181, 41, 6, 113, 170, 29, 238, 223, 148, 225, 58, 241, 219, 23,
-    44, 238, 39, 126, 182, 49, 187, 35, 92, 230, 234, 47, 218, 203, 115, 3, 62, 251, 214, 65, 10, 255, 197, 182, 195,
-    112, 118, 181, 139, 117, 225, 193, 140, 230, 114, 19, 72, 155, 140, 107, 251, 244, 180, 110, 139, 199, 82, 106, 123,
-    77, 91, 139, 140, 232, 252, 10, 74, 165, 2, 36, 222, 166, 146, 231, 164, 122, 216, 0, 191, 77, 201, 185, 151, 55,
-    98, 133, 72, 239, 188, 132, 50, 208, 208, 212, 124, 42, 189, 217, 12, 70, 77, 40, 134, 123, 237, 230, 12, 48, 164,
-    113, 130, 148, 40, 58, 242, 151, 62, 246, 69, 149, 102, 190, 86, 231, 87, 34, 82, 32, 55, 125, 14, 177, 37, 84, 249,
-    70, 233, 130, 44, 168, 126, 24, 252, 6, 181, 254, 28, 112, 202, 52, 216, 102, 60, 237, 183, 154, 249, 102, 60, 84,
-    239, 169, 169, 92, 161, 249, 75, 122, 118, 247, 255, 121, 22, 106, 254, 23, 16, 47, 165, 4, 164, 117, 203, 242, 145,
-    112, 216, 178, 6, 148, 235, 79, 163, 44, 165, 8, 250, 88, 11, 242, 203, 250, 127, 162, 85, 80, 10, 241, 35, 137,
-    219, 199, 64, 141, 178, 225, 191, 244, 12, 208, 198, 232, 110, 225, 2, 214, 158, 64, 193, 118, 219, 88, 83, 12, 235,
-    127, 94, 172, 117, 221, 218, 208, 122, 244, 174, 141, 209, 222, 86, 211, 133, 89, 168, 96, 172, 236, 127, 41, 1, 11,
-    212, 95, 77, 252, 253, 173, 241, 89, 202, 59, 85, 176, 189, 97, 194, 131, 123, 237, 245, 198, 163, 11, 224, 59, 83,
-    173, 212, 96, 246, 242, 75, 249, 28, 3, 252, 20, 237, 65, 135, 3, 109, 40, 215, 206, 22, 108, 158, 6, 103, 159, 97,
-    11, 15, 83, 111, 15, 43, 31, 21, 40, 145, 209, 21, 11, 43, 138, 142, 77, 185, 87, 121, 90, 213, 18, 115, 242, 82,
-    158, 120, 164, 113, 231, 170, 172, 115, 128, 166, 134, 225, 244, 191, 158, 12, 9, 178, 165, 100, 75, 96, 166, 6,
-    150, 2, 31, 217, 160, 5, 215, 115, 154, 67, 59, 56, 215, 167, 150, 182, 2, 111, 40, 69, 248, 211, 23, 198, 136, 96,
-    196, 155, 113, 75, 6, 154, 186, 101, 167, 154, 132, 180, 190, 44, 70, 229, 8, 252, 48, 250, 229, 20, 65, 113, 75,
-    71, 13, 226, 70, 53, 240, 7, 163, 100, 43, 65, 63, 154, 112, 24, 22, 154, 241, 223, 88, 90, 133, 92, 65, 100, 104,
-    244, 8, 189, 145, 215, 74, 20, 72, 240, 193, 25, 143, 82, 151, 239, 241, 148, 165, 47, 129, 39, 212, 255, 31, 197,
-    227, 72, 113, 212, 247, 177, 61, 94, 228, 2, 61, 195, 226, 22, 229, 17, 62, 180, 161, 11, 148, 3, 222, 242, 240,
-    122, 65, 230, 13, 224, 39, 154, 180, 117, 72, 254, 199, 186, 141, 94, 64, 178, 227, 80, 226, 124, 158, 223, 13, 58,
-    248, 197, 63, 47, 130, 89, 203, 234, 189, 38, 75, 37, 150, 195, 46, 228, 234, 235, 116, 111, 166, 220, 147, 95, 152,
-    4, 171, 240, 191, 115, 20, 45, 22, 161, 163, 16, 206, 16, 252, 94, 46, 99, 121, 143, 174, 142, 68, 193, 1, 253, 43,
-    54, 34, 156, 105, 128, 205, 46, 171, 131, 171, 234, 193, 19, 49, 105, 20, 254, 20, 44, 56, 107, 230, 137, 163, 81,
-    207, 180, 240, 57, 54, 71, 251, 87, 46, 118, 216, 215, 197, 194, 211, 180, 151, 5, 36, 237, 76, 116, 231, 134, 219,
-    135, 128, 212, 210, 14, 75, 184, 194, 46, 52, 61, 211, 54, 146, 159, 255, 146, 51, 32, 11, 69, 115, 34, 225, 126,
-    13, 80, 32, 48, 220, 75, 84, 151, 35, 148, 253, 47, 195, 236, 171, 197, 244, 174, 182, 178, 184, 117, 64, 39, 175,
-    123, 122, 132, 25, 181, 152, 181, 142, 117, 65, 160, 41, 98, 28, 29, 246, 209, 125, 115, 239, 8, 102, 231, 168, 66,
-    92, 101, 158, 37, 116, 93, 97, 175, 165, 146, 243, 199, 243, 232, 58, 239, 240, 63, 57, 118, 49, 58, 59, 179, 31,
-    183, 35, 127, 140, 174, 55, 184, 22, 238, 114, 228, 48, 122, 100, 109, 88, 172, 125, 152, 130, 11, 137, 169, 167,
-    100, 187, 165, 44, 84, 96, 216, 96, 90, 90, 176, 11, 130, 162, 102, 31, 162, 233, 68, 179, 166, 138, 78, 165, 124,
-    42, 61, 160, 62, 48, 4, 28, 198, 196, 184, 14, 179, 28, 98, 39, 10, 64, 255, 124, 187, 96, 232, 143, 4, 79, 90, 43,
-    19, 3, 175, 121, 53, 241, 62, 138, 178, 64, 120, 213, 205, 53, 75, 207, 196, 4, 209, 142, 243, 78, 63, 174, 158,
-    111, 64, 147, 45, 184, 114, 129, 39, 122, 68, 193, 165, 133, 132, 195, 141, 26, 164, 127, 160, 3, 23, 98, 204, 96,
-    109, 245, 53, 106, 218, 115, 46, 27, 116, 72, 149, 224, 85, 47, 151, 231, 91, 242, 227, 144, 175, 87, 7, 206, 51,
-    99, 117, 109, 211, 183, 227, 187, 30, 96, 60, 79, 21, 132, 36, 46, 131, 202, 20, 13, 95, 35, 46, 63, 134, 16, 83,
-    221, 213, 66, 255, 230, 98, 88, 146, 116, 190, 20, 212, 84, 220, 71, 51, 147, 253, 108, 181, 172, 36, 201, 195, 178,
-    84, 51, 168, 217, 232, 121, 46, 252, 125, 109, 20, 35, 194, 181, 8, 179, 47, 193, 144, 243, 248, 100, 221, 31, 151,
-    61, 34, 202, 78, 186, 186, 27, 117, 134, 50, 8, 70, 199, 135, 93, 241, 221, 188, 117, 79, 174, 206, 233, 217, 61,
-    191, 187, 183, 125, 203, 228, 199, 91, 126, 105, 195, 181, 91, 131, 0, 24, 68, 177, 60, 123, 217, 42, 248, 125, 32,
-    229, 102, 30, 21, 124, 168, 105, 32, 166, 95, 5, 114, 168, 107, 224, 144, 52, 41, 188, 91, 158, 108, 134, 143, 71,
-    50, 103, 94, 196, 228, 40, 198, 199, 35, 58, 156, 187, 214, 208, 208, 71, 61, 138, 16, 102, 87, 173, 121, 212, 59,
-    40, 194, 29, 99, 113, 33, 141, 206, 218, 16, 4, 45, 83, 97, 247, 217, 130, 163, 193, 252, 80, 250, 157, 34, 72, 124,
-    104, 5, 180, 197, 61, 154, 41, 115, 69, 42, 176, 244, 22, 251, 217, 230, 100, 227, 227, 212, 163, 151, 204, 246,
-    232, 243, 43, 32, 16, 40, 83, 125, 212, 215, 23, 192, 246, 54, 169, 185, 234, 43, 163, 55, 30, 144, 203, 35, 21, 96,
-    11, 199, 149, 23, 52, 237, 96, 202, 163, 12, 147, 222, 40, 118, 43, 76, 132, 246, 46, 143, 182, 242, 59, 203, 143,
-    36, 90, 24, 196, 81, 158, 121, 26, 239, 214, 133, 123, 184, 132, 17, 225, 241, 30, 239, 89, 96, 137, 109, 211, 192,
-    239, 242, 85, 202, 47, 207, 189, 59, 247, 38, 222, 109, 204, 105, 248, 102, 250, 46, 112, 101, 142, 124, 249, 131,
-    56, 126, 254, 57, 27, 31, 1, 221, 160, 162, 160, 56, 137, 214, 6, 90, 202, 123, 250, 63, 94, 230, 218, 230, 15, 25,
-    65, 113, 7, 153, 80, 214, 29, 20, 211, 125, 60, 221, 140, 1, 203, 19, 248, 77, 52, 112, 185, 165, 83, 142, 210, 31,
-    184, 246, 19, 42, 182, 172, 193, 150, 194, 120, 35, 116, 226, 111, 32, 59, 85, 23, 150, 201, 223, 47, 103, 190, 44,
-    72, 2, 250, 85, 22, 103, 184, 103, 230, 152, 244, 205, 247, 84, 8, 64, 90, 10, 117, 1, 162, 81, 195, 80, 222, 240,
-    42, 69, 186, 247, 190, 11, 14, 51, 139, 236, 191, 80, 179, 94, 246, 69, 153, 90, 43, 152, 182, 31, 198, 17, 165,
-    238, 17, 87, 108, 46, 189, 139, 11, 202, 201, 60, 225, 178, 36, 181, 50, 209, 81, 210, 58, 238, 245, 28, 225, 86,
-    119, 216, 17, 34, 24, 183, 105, 63, 211, 13, 225, 45, 200, 47, 86, 162, 44, 122, 4, 215, 38, 47, 166, 10, 203, 188,
-    11, 117, 167, 213, 170, 71, 42, 183, 50, 244, 5, 209, 191, 49, 157, 235, 11, 59, 17, 42, 249, 63, 175, 183, 98, 9,
-    93, 104, 211, 129, 164, 1, 161, 100, 252, 248, 131, 80, 39, 59, 37, 193, 216, 52, 212, 41, 240, 205, 54, 92, 44, 41,
-    170, 58, 190, 43, 226, 41, 233, 84, 93, 214, 225, 117, 39, 188, 24, 234, 219, 24, 184, 188, 99, 21, 160, 97, 33,
-    192, 88, 87, 244, 31, 92, 183, 249, 140, 208, 151, 76, 154, 86, 14, 49, 143, 85, 200, 39, 238, 4, 0, 104, 137, 3,
-    57, 4, 178, 198, 42, 111, 186, 215, 177, 210, 135, 91, 34, 24, 219, 61, 167, 178, 242, 153, 187, 171, 150, 117, 217,
-    22, 224, 209, 185, 171, 27, 167, 41, 109, 171, 145, 122, 229, 153, 219, 30, 236, 47, 118, 193, 221, 178, 214, 167,
-    77, 161, 140, 189, 78, 227, 42, 40, 10, 37, 216, 176, 117, 92, 48, 226, 178, 255, 112, 206, 186, 111, 115, 192, 251,
-    239, 31, 53, 21, 152, 48, 219, 3, 144, 31, 213, 95, 89, 76, 88, 84, 131, 100, 199, 106, 56, 188, 134, 242, 203, 79,
-    231, 72, 56, 33, 121, 86, 152, 29, 123, 128, 65, 169, 211, 11, 165, 43, 215, 187, 32, 18, 205, 232, 254, 59, 4, 66,
-    17, 44, 180, 193, 44, 236, 151, 79, 188, 113, 18, 4, 228, 58, 190, 115, 120, 161, 112, 111, 89, 23, 124, 161, 90,
-    54, 130, 67, 241, 45, 161, 127, 14, 173, 112, 235, 8, 94, 118, 119, 185, 47, 113, 88, 248, 131, 31, 88, 193, 179,
-    95, 174, 236, 11, 99, 150, 117, 174, 39, 195, 171, 75, 178, 134, 44, 200, 247, 35, 226, 96, 120, 0, 220, 83, 152,
-    187, 117, 173, 67, 191, 215, 199, 254, 53, 10, 12, 86, 228, 6, 84, 60, 214, 15, 220, 75, 107, 203, 196, 10, 62, 95,
-    218, 115, 40, 185, 97, 210, 186, 102, 31, 139, 13, 113, 18, 222, 216, 175, 57, 225, 238, 141, 178, 210, 189, 123,
-    141, 85, 145, 127, 183, 235, 43, 23, 205, 33, 255, 131, 55, 8, 20, 159, 208, 227, 91, 98, 44, 112, 207, 58, 203, 47,
-    49, 215, 233, 28, 230, 224, 208, 91, 131, 254, 145, 186, 35, 119, 92, 37, 254, 196, 234, 40, 30, 249, 39, 71, 213,
-    213, 113, 126, 116, 159, 147, 59, 203, 255, 221, 68, 173, 212, 7, 210, 20, 230, 232, 16, 40, 226, 107, 177, 136,
-    249, 114, 16, 216, 91, 140, 123, 81, 52, 43, 201, 158, 252, 229, 213, 194, 6, 251, 88, 222, 172, 205, 160, 255, 127,
-    42, 67, 119, 225, 126, 155, 66, 54, 49, 57, 18, 77, 162, 94, 155, 104, 157, 127, 5, 125, 158, 54, 76, 244, 68, 94,
-    229, 157, 29, 74, 228, 62, 92, 156, 230, 165, 181, 183, 77, 36, 229, 210, 248, 177, 128, 227, 136, 221, 86, 0, 9,
-    83, 165, 204, 19, 82, 173, 20, 212, 25, 89, 3, 159, 159, 86, 103, 156, 173, 66, 103, 25, 138, 170, 1, 117, 85, 125,
-    220, 38, 88, 56, 244, 8, 205, 153, 52, 231, 112, 233, 178, 85, 159, 224, 37, 17, 216, 85, 87, 57, 23, 94, 15, 158,
-    123, 116, 5, 214, 212, 172, 213, 58, 38, 27, 251, 98, 235, 1, 64, 97, 250, 239, 0, 36, 66, 30, 86, 59, 245, 63, 212,
-    191, 152, 67, 124, 126, 87, 197, 150, 243, 60, 227, 30, 155, 24, 210, 8, 177, 221, 3, 131, 244, 1, 207, 133, 3, 3,
-    253, 158, 65, 9, 26, 5, 141, 207, 105, 35, 95, 128, 236, 251, 182, 184, 106, 44, 116, 91, 22, 35, 10, 255, 211, 183,
-    104, 233, 149, 161, 116, 45, 47, 172, 221, 11, 48, 207, 199, 109, 206, 36, 86, 203, 82, 84, 78, 30, 10, 51, 166,
-    226, 65, 132, 140, 245, 12, 88, 89, 8, 76, 208, 60, 161, 232, 90, 186, 169, 162, 207, 235, 107, 140, 177, 221, 237,
-    241, 236, 186, 243, 201, 156, 133, 164, 6, 43, 23, 71, 47, 225, 222, 115, 196, 84, 13, 109, 37, 12, 139, 47, 23,
-    198, 90, 169, 197, 109, 102, 1, 131, 30, 63, 53, 129, 167, 216, 66, 30, 235, 102, 142, 238, 82, 82, 140, 18, 220,
-    61, 133, 126, 8, 238, 99, 65, 244, 240, 197, 13, 177, 29, 132, 206, 199, 10, 99, 252, 97, 17, 96, 37, 228, 216, 139,
-    113, 209, 88, 137, 214, 6, 44, 200, 111, 80, 179, 153, 230, 230, 242, 183, 70, 32, 223, 81, 81, 211, 243, 7, 20,
-    126, 169, 130, 78, 36, 182, 3, 74, 161, 147, 250, 83, 31, 40, 32, 139, 252, 130, 105, 245, 149, 219, 63, 108, 202,
-    179, 188, 211, 124, 177, 202, 162, 55, 213, 36, 24, 221, 198, 137, 178, 125, 203, 165, 152, 238, 148, 2, 135, 181,
-    113, 202, 237, 8, 139, 205, 166, 169, 0, 11, 171, 87, 130, 21, 120, 249, 28, 146, 53, 120, 25, 255, 237, 96, 132,
-    188, 12, 40, 150, 51, 3, 101, 62, 26, 90, 2, 249, 146, 16, 20, 5, 149, 133, 227, 131, 86, 145, 250, 232, 111, 190,
-    9, 50, 6, 132, 6, 35, 240, 160, 131, 224, 195, 44, 251, 146, 45, 200, 251, 158, 31, 223, 183, 128, 193, 76, 26, 216,
-    123, 245, 237, 80, 68, 124, 173, 10, 213, 242, 37, 74, 121, 91, 136, 209, 113, 129, 160, 37, 53, 196, 75, 166, 154,
-    24, 28, 85, 148, 1, 83, 155, 106, 156, 19, 204, 155, 3, 69, 11, 109, 215, 93, 88, 15, 224, 76, 47, 223, 20, 183,
-    191, 127, 28, 83, 148, 205, 2, 86, 34, 134, 31, 23, 28, 124, 196, 120, 207, 222, 177, 54, 151, 205, 187, 61, 106,
-    174, 91, 76, 109, 71, 124, 4, 20, 80, 151, 0, 229, 196, 122, 34, 22, 248, 170, 188, 86, 44, 99, 122, 147, 179, 154,
-    117, 182, 85, 168, 112, 129, 65, 117, 72, 161, 234, 142, 61, 182, 167, 232, 26, 253, 218, 206, 158, 44, 184, 38, 26,
-    25, 211, 64, 218, 254, 152, 67, 223, 33, 48, 116, 197, 28, 63, 30, 182, 74, 26, 22, 72, 167, 69, 127, 0, 132, 232,
-    150, 241, 149, 141, 79, 96, 229, 203, 223, 147, 135, 207, 116, 236, 58, 215, 25, 113, 130, 22, 219, 188, 8, 99, 25,
-    178, 118, 1, 190, 142, 107, 131, 255, 156, 40, 208, 207, 0, 198, 24, 121, 49, 221, 176, 244, 92, 243, 223, 208, 36,
-    132, 119, 225, 175, 225, 69, 29, 0, 202, 238, 248, 193, 157, 52, 65, 149, 214, 98, 1, 214, 241, 63, 136, 158, 64,
-    159, 117, 83, 253, 233, 159, 21, 76, 137, 191, 170, 233, 106, 193, 98, 143, 206, 98, 215, 125, 246, 8, 150, 131, 79,
-    17, 227, 57, 218, 155, 209, 19, 114, 242, 242, 218, 138, 230, 14, 1, 212, 239, 151, 145, 154, 242, 235, 248, 31, 30,
-    121, 87, 138, 168, 91, 250, 225, 11, 86, 247, 141, 144, 139, 73, 118, 12, 150, 79, 4, 146, 17, 57, 140, 28, 162, 88,
-    60, 126, 232, 25, 190, 250, 96, 149, 130, 46, 144, 173, 228, 164, 35, 206, 111, 60, 240, 198, 136, 236, 243, 96,
-    192, 255, 179, 186, 82, 209, 103, 216, 156, 17, 223, 250, 255, 150, 216, 208, 123, 252, 125, 222, 236, 147, 156,
-    247, 7, 231, 232, 199, 20, 39, 233, 213, 241, 86, 112, 40, 121, 251, 161, 88, 132, 132, 4, 119, 148, 114, 172, 5,
-    193, 67, 246, 165, 53, 149, 135, 116, 214, 28, 143, 234, 217, 116, 246, 154, 132, 44, 254, 213, 108, 4, 58, 139, 99,
-    17, 0, 21, 15, 116, 103, 46, 151, 137, 219, 2, 100, 252, 23, 83, 192, 195, 147, 61, 165, 196, 30, 236, 254, 219,
-    167, 46, 192, 117, 68, 99, 215, 215, 51, 109, 112, 219, 204, 147, 93, 232, 8, 223, 7, 241, 164, 203, 213, 177, 28,
-    61, 132, 166, 219, 235, 92, 163, 58, 205, 232, 75, 11, 119, 35, 25, 162, 72, 103, 131, 194, 57, 105, 80, 30, 135,
-    200, 251, 105, 93, 25, 37, 244, 112, 96, 46, 141, 213, 103, 152, 217, 140, 148, 247, 24, 22, 15, 5, 3, 249, 54, 75,
-    7, 250, 57, 84, 190, 117, 234, 71, 165, 77, 37, 75, 92, 167, 240, 78, 187, 50, 220, 95, 208, 55, 109, 129, 53, 147,
-    187, 153, 238, 109, 61, 44, 85, 154, 11, 226, 6, 250, 16, 20, 218, 37, 228, 223, 42, 59, 171, 230, 152, 252, 103,
-    105, 30, 67, 255, 79, 200, 160, 104, 10, 104, 161, 156, 232, 212, 43, 216, 115, 102, 50, 220, 176, 175, 190, 94, 4,
-    178, 20, 223, 36, 91, 58, 215, 149, 32, 140, 125, 69, 112, 159, 9, 11, 140, 84, 168, 98, 53, 54, 248, 47, 141, 41,
-    96, 180, 69, 222, 175, 192, 178, 194, 8, 130, 33, 128, 110, 167, 7, 211, 128, 124, 101, 224, 127, 36, 171, 23, 221,
-    149, 25, 207, 231, 205, 135, 24, 211, 25, 162, 218, 90, 39, 255, 206, 53, 219, 166, 77, 85, 201, 241, 158, 162, 213,
-    27, 228, 149, 213, 101, 106, 140, 43, 78, 142, 18, 134, 120, 141, 20, 127, 45, 14, 32, 203, 56, 121, 119, 185, 118,
-    226, 226, 83, 151, 195, 125, 59, 133, 181, 195, 202, 168, 233, 4, 222, 220, 155, 7, 156, 133, 173, 63, 94, 13, 166,
-    100, 243, 242, 221, 49, 233, 218, 121, 121, 163, 109, 80, 185, 183, 93, 166, 12, 193, 145, 161, 229, 11, 56, 124,
-    131, 8, 152, 73, 126, 129, 152, 146, 63, 101, 55, 201, 164, 131, 231, 203, 200, 8, 218, 70, 51, 205, 44, 0, 174,
-    147, 28, 162, 166, 110, 48, 139, 242, 212, 172, 217, 135, 93, 48, 132, 170, 121, 43, 180, 75, 20, 67, 119, 166, 117,
-    50, 173, 30, 21, 121, 220, 172, 220, 171, 172, 248, 89, 108, 39, 232, 1, 152, 27, 161, 36, 174, 138, 215, 17, 69,
-    92, 254, 87, 230, 1, 8, 39, 66, 183, 33, 58, 65, 21, 251, 5, 242, 224, 142, 245, 133, 81, 116, 241, 50, 160, 94, 97,
-    246, 138, 50, 206, 109, 241, 161, 73, 120, 116, 28, 60, 63, 28, 215, 122, 29, 142, 204, 228, 166, 148, 20, 86, 72,
-    1, 9, 217, 176, 5, 130, 56, 237, 180, 42, 224, 168, 65, 107, 105, 94, 88, 23, 79, 155, 49, 93, 51, 142, 32, 127, 37,
-    125, 222, 219, 203, 32, 34, 184, 252, 75, 38, 53, 22, 194, 75, 88, 51, 149, 96, 45, 15, 51, 86, 179, 207, 230, 16,
-    240, 66, 226, 97, 219, 31, 107, 212, 57, 145, 114, 116, 140, 85, 72, 149, 125, 138, 185, 215, 248, 86, 206, 179, 19,
-    176, 131, 227, 106, 195, 202, 44, 67, 210, 138, 194, 131, 174, 156, 253, 252, 139, 183, 104, 109, 35, 182, 103, 143,
-    101, 32, 105, 202, 155, 192, 221, 223, 178, 12, 29, 199, 113, 224, 114, 171, 96, 66, 84, 48, 196, 234, 208, 233, 69,
-    75, 120, 11, 101, 233, 61, 172, 170, 119, 131, 4, 233, 92, 145, 8, 178, 10, 248, 39, 254, 210, 33, 33, 253, 15, 54,
-    106, 20, 41, 89, 195, 84, 0, 51, 120, 194, 139, 48, 161, 113, 173, 184, 146, 125, 1, 72, 203, 125, 218, 152, 100,
-    240, 204, 192, 24, 100, 226, 45, 39, 230, 8, 113, 103, 2, 217, 182, 244, 59, 225, 149, 92, 86, 5, 30, 15, 66, 191,
-    159, 168, 94, 232, 4, 184, 212, 168, 172, 86, 20, 212, 90, 68, 226, 196, 16, 151, 111, 226, 184, 8, 158, 106, 127,
-    164, 39, 76, 120, 141, 34, 238, 194, 156, 203, 26, 220, 49, 188, 63, 56, 8, 128, 67, 185, 207, 83, 242, 184, 227,
-    200, 191, 205, 21, 174, 147, 255, 17, 215, 62, 42, 94, 69, 72, 219, 148, 47, 146, 232, 158, 156, 229, 142, 189, 87,
-    167, 134, 172, 209, 181, 131, 128, 5, 158, 30, 58, 164, 162, 101, 47, 19, 105, 16, 197, 49, 138, 39, 19, 74, 241,
-    237, 165, 194, 163, 111, 125, 80, 12, 15, 193, 112, 63, 243, 249, 54, 218, 126, 202, 151, 42, 135, 1, 231, 224, 230,
-    27, 165, 119, 86, 37, 130, 164, 227, 44, 105, 179, 41, 97, 148, 43, 162, 78, 74, 156, 252, 236, 158, 215, 65, 107,
-    176, 38, 223, 20, 25, 219, 213, 13, 88, 16, 134, 225, 163, 34, 184, 50, 174, 50, 51, 15, 190, 63, 2, 110, 228, 210,
-    129, 117, 63, 126, 208, 175, 202, 215, 16, 217, 179, 173, 121, 101, 86, 247, 246, 180, 27, 172, 13, 93, 245, 162,
-    48, 185, 139, 133, 214, 24, 125, 30, 227, 128, 108, 211, 58, 253, 232, 60, 49, 237, 74, 20, 162, 169, 88, 10, 64,
-    56, 70, 21, 149, 97, 203, 210, 239, 164, 74, 224, 190, 18, 54, 115, 120, 12, 34, 255, 154, 203, 44, 40, 27, 105, 36,
-    189, 135, 181, 203, 95, 70, 136, 167, 161, 98, 150, 63, 241, 170, 92, 82, 4, 148, 130, 160, 209, 119, 124, 199, 158,
-    254, 127, 109, 50, 195, 15, 202, 92, 89, 84, 185, 241, 247, 60, 195, 225, 67, 168, 106, 35, 174, 170, 178, 99, 169,
-    104, 202, 238, 168, 97, 109, 117, 9, 41, 164, 239, 119, 43, 43, 55, 132, 205, 23, 202, 8, 147, 107, 138, 239, 104,
-    68, 166, 167, 32, 96, 163, 18, 203, 170, 77, 1, 12, 30, 228, 46, 199, 115, 77, 57, 229, 148, 97, 151, 26, 7, 3, 101,
-    239, 108, 108, 112, 92, 166, 8, 248, 200, 159, 229, 51, 187, 86, 51, 39, 128, 92, 25, 106, 189, 150, 116, 48, 185,
-    27, 172, 113, 225, 169, 242, 144, 149, 26, 134, 128, 82, 3, 11, 162, 231, 92, 77, 214, 208, 218, 47, 118, 25, 71,
-    129, 136, 81, 93, 31, 0, 6, 241, 3, 137, 49, 105, 149, 237, 100, 184, 130, 125, 225, 5, 163, 148, 13, 53, 143, 90,
-    214, 56, 58, 196, 18, 156, 131, 247, 60, 30, 87, 126, 53, 157, 115, 233, 25, 232, 218, 166, 231, 170, 108, 188, 231,
-    140, 78, 202, 84, 89, 115, 19, 141, 7, 42, 175, 165, 10, 204, 110, 56, 83, 29, 167, 67, 251, 89, 78, 65, 210, 175,
-    115, 71, 34, 243, 94, 35, 71, 233, 37, 163, 31, 135, 107, 115, 183, 66, 213, 170, 222, 135, 53, 119, 250, 156, 105,
-    165, 221, 150, 114, 159, 33, 158, 181, 86, 127, 47, 188, 136, 191, 6, 191, 87, 203, 240, 122, 113, 39, 233, 248, 11,
-    103, 33, 229, 229, 90, 244, 99, 91, 80, 53, 227, 214, 1, 112, 125, 184, 191, 177, 244, 190, 43, 5, 202, 56, 198,
-    144, 143, 24, 21, 75, 215, 253, 149, 81, 253, 254, 69, 63, 203, 13, 156, 143, 221, 68, 122, 15, 7, 35, 200, 205, 50,
-    228, 125, 163, 148, 4, 52, 177, 87, 86, 35, 8, 61, 167, 197, 224, 240, 183, 145, 63, 163, 166, 75, 169, 137, 211,
-    153, 190, 206, 187, 28, 234, 253, 150, 14, 140, 144, 80, 136, 74, 135, 188, 58, 246, 239, 103, 108, 36, 180, 106,
-    49, 98, 95, 121, 0, 22, 150, 87, 200, 206, 132, 77, 51, 68, 183, 97, 148, 245, 60, 160, 234, 146, 207, 28, 76, 106,
-    248, 29, 190, 116, 144, 163, 187, 199, 204, 219, 190, 77, 111, 187, 54, 248, 12, 204, 40, 90, 240, 72, 72, 136, 201,
-    149, 118, 126, 215, 217, 86, 223, 114, 139, 98, 229, 159, 224, 170, 146, 51, 246, 147, 94, 161, 163, 30, 43, 72, 45,
-    2, 56, 31, 195, 137, 63, 39, 45, 219, 119, 231, 234, 114, 164, 144, 20, 17, 223, 246, 149, 183, 197, 200, 79, 132,
-    130, 192, 247, 181, 164, 108, 38, 121, 155, 172, 146, 185, 178, 95, 245, 106, 193, 175, 199, 211, 226, 134, 215,
-    159, 10, 137, 212, 163, 253, 96, 72, 117, 5, 246, 194, 102, 17, 46, 53, 51, 121, 112, 235, 18, 83, 185, 41, 39, 136,
-    87, 166, 227, 131, 64, 247, 172, 153, 173, 189, 254, 81, 100, 218, 128, 12, 170, 187, 228, 69, 175, 169, 208, 194,
-    248, 190, 188, 110, 90, 56, 86, 168, 252, 146, 215, 24, 197, 130, 242, 91, 97, 209, 60, 147, 47, 123, 215, 162, 209,
-    205, 1, 95, 11, 188, 231, 7, 57, 50, 32, 205, 136, 132, 85, 91, 223, 184, 32, 22, 118, 133, 126, 104, 18, 87, 179,
-    87, 135, 188, 56, 61, 163, 21, 219, 47, 251, 130, 187, 196, 22, 43, 124, 48, 27, 12, 33, 15, 166, 64, 111, 120, 13,
-    154, 190, 18, 84, 52, 246, 159, 88, 104, 162, 159, 42, 170, 47, 157, 247, 32, 192, 170, 16, 40, 234, 190, 154, 206,
-    168, 53, 83, 62, 166, 31, 21, 174, 37, 57, 160, 185, 52, 78, 34, 87, 29, 62, 39, 119, 24, 246, 144, 165, 22, 86, 89,
-    137, 68, 213, 44, 59, 247, 104, 97, 85, 36, 108, 249, 242, 169, 122, 72, 199, 81, 128, 71, 181, 226, 191, 121, 103,
-    142, 232, 113, 56, 60, 96, 12, 27, 183, 110, 183, 87, 203, 156, 9, 205, 125, 248, 155, 179, 137, 152, 72, 239, 18,
-    248, 69, 208, 15, 247, 22, 200, 209, 39, 28, 215, 167, 244, 156, 191, 244, 190, 149, 5, 38, 76, 220, 248, 114, 91,
-    202, 192, 214, 90, 160, 15, 94, 250, 173, 48, 232, 167, 48, 86, 167, 9, 130, 90, 144, 249, 104, 33, 48, 135, 108,
-    254, 248, 192, 176, 13, 68, 48, 51, 35, 16, 227, 171, 71, 250, 208, 81, 64, 146, 200, 10, 79, 113, 35, 0, 246, 90,
-    104, 227, 77, 176, 142, 12, 44, 83, 243, 95, 238, 58, 97, 159, 213, 40, 222, 47, 131, 39, 235, 101, 44, 105, 16,
-    136, 196, 227, 35, 211, 94, 82, 235, 237, 231, 122, 110, 167, 204, 189, 12, 150, 69, 251, 90, 180, 85, 245, 139,
-    178, 7, 127, 53, 170, 26, 90, 83, 58, 199, 152, 243, 97, 42, 217, 102, 180, 178, 123, 204, 79, 186, 149, 198, 171,
-    101, 182, 22, 253, 54, 148, 16, 200, 137, 233, 129, 21, 12, 154, 205, 46, 150, 248, 111, 3, 210, 27, 150, 12, 21,
-    105, 60, 62, 6, 217, 171, 234, 55, 190, 97, 137, 131, 157, 61, 152, 202, 202, 250, 148, 189, 87, 223, 151, 188, 52,
-    200, 6, 88, 143, 16, 187, 224, 77, 9, 43, 100, 13, 234, 22, 69, 162, 103, 100, 202, 232, 40, 230, 149, 167, 161,
-    105, 96, 252, 238, 104, 178, 23, 8, 70, 117, 133, 225, 174, 141, 140, 13, 162, 132, 127, 215, 18, 218, 143, 227,
-    161, 53, 211, 64, 46, 172, 209, 181, 0, 236, 141, 108, 32, 117, 53, 18, 134, 215, 174, 122, 77, 197, 75, 69, 74,
-    254, 93, 241, 87, 118, 245, 218, 167, 222, 193, 168, 138, 169, 120, 5, 29, 138, 37, 187, 212, 194, 65, 232, 219,
-    203, 135, 120, 189, 131, 116, 213, 94, 134, 227, 172, 136, 192, 252, 180, 231, 82, 85, 55, 90, 193, 58, 121, 76,
-    140, 91, 255, 49, 6, 204, 73, 106, 81, 96, 228, 223, 188, 240, 151, 51, 44, 103, 92, 151, 179, 244, 117, 91, 180,
-    244, 71, 47, 97, 145, 115, 6, 159, 126, 27, 205, 48, 182, 178, 69, 153, 90, 5, 56, 185, 224, 195, 118, 55, 222, 143,
-    90, 172, 87, 14, 166, 158, 6, 47, 127, 66, 77, 190, 78, 53, 235, 224, 214, 216, 72, 28, 102, 232, 85, 142, 81, 153,
-    43, 124, 190, 130, 175, 119, 8, 241, 223, 181, 40, 201, 127, 2, 82, 15, 59, 8, 50, 206, 164, 173, 17, 91, 198, 210,
-    40, 169, 118, 228, 127, 191, 252, 170, 164, 3, 206, 97, 187, 187, 52, 188, 37, 219, 103, 243, 48, 203, 254, 170,
-    150, 182, 52, 247, 1, 223, 245, 71, 146, 140, 108, 153, 13, 211, 243, 92, 246, 61, 196, 187, 56, 76, 177, 15, 49,
-    57, 191, 58, 178, 239, 141, 102, 113, 181, 187, 151, 16, 110, 146, 106, 119, 51, 147, 195, 148, 62, 140, 142, 221,
-    231, 66, 151, 52, 110, 140, 85, 178, 139, 238, 52, 176, 227, 153, 206, 231, 150, 39, 232, 207, 220, 127, 107, 168,
-    80, 133, 156, 116, 139, 73, 137, 126, 36, 167, 7, 140, 117, 160, 241, 115, 253, 224, 99, 75, 209, 108, 55, 228, 31,
-    39, 128, 81, 27, 0, 79, 255, 245, 239, 197, 135, 238, 178, 223, 19, 16, 108, 223, 98, 151, 235, 96, 53, 142, 69, 5,
-    27, 129, 56, 210, 188, 109, 225, 110, 133, 149, 10, 149, 84, 109, 197, 137, 35, 146, 78, 212, 207, 135, 23, 79, 80,
-    1, 141, 203, 210, 176, 118, 213, 154, 92, 191, 80, 69, 70, 244, 159, 135, 7, 174, 169, 162, 227, 227, 41, 152, 8,
-    31, 152, 100, 116, 210, 209, 226, 12, 81, 91, 112, 17, 116, 198, 164, 1, 248, 120, 9, 222, 216, 73, 150, 81, 18,
-    132, 185, 181, 146, 59, 54, 98, 172, 122, 35, 241, 24, 24, 11, 221, 207, 71, 104, 209, 182, 78, 251, 191, 113, 100,
-    158, 16, 99, 199, 125, 103, 215, 164, 153, 19, 14, 198, 232, 1, 58, 79, 147, 113, 190, 85, 74, 243, 155, 134, 155,
-    87, 1, 2, 24, 69, 84, 103, 16, 187, 32, 20, 81, 211, 46, 84, 161, 89, 80, 207, 36, 15, 193, 5, 217, 34, 18, 122, 54,
-    79, 72, 5, 138, 95, 217, 124, 237, 229, 22, 127, 76, 57, 209, 215, 20, 194, 198, 217, 222, 255, 213, 95, 116, 188,
-    36, 11, 138, 177, 49, 200, 204, 244, 72, 148, 231, 183, 69, 32, 139, 81, 61, 29, 243, 134, 31, 126, 135, 152, 216,
-    31, 89, 39, 172, 71, 155, 162, 159, 140, 28, 188, 21, 161, 72, 165, 11, 168, 196, 178, 135, 26, 161, 92, 202, 80,
-    152, 3, 37, 229, 248, 92, 133, 230, 155, 80, 91, 30, 227, 39, 116, 200, 83, 36, 184, 139, 254, 152, 120, 60, 137,
-    231, 172, 196, 44, 89, 89, 190, 90, 47, 145, 207, 17, 203, 90, 25, 5, 31, 175, 37, 22, 38, 62, 165, 121, 202, 183,
-    190, 68, 1, 125, 210, 70, 154, 69, 196, 249, 29, 51, 165, 25, 86, 185, 119, 145, 25, 100, 162, 237, 201, 214, 15,
-    242, 199, 139, 64, 229, 249, 19, 194, 178, 150, 176, 208, 220, 56, 225, 223, 216, 237, 242, 23, 39, 255, 186, 223,
-    211, 214, 239, 115, 182, 1, 158, 82, 2, 4, 21, 153, 203, 155, 104, 34, 56, 169, 248, 90, 6, 201, 229, 161, 200, 192,
-    157, 21, 17, 42, 193, 46, 21, 30, 114, 185, 94, 37, 200, 107, 225, 157, 125, 202, 190, 106, 102, 19, 100, 135, 76,
-    198, 183, 92, 60, 187, 144, 2, 15, 48, 96, 129, 189, 119, 64, 55, 245, 235, 94, 198, 56, 192, 137, 83, 1, 47, 34,
-    217, 162, 176, 76, 128, 200, 22, 153, 144, 221, 88, 58, 229, 204, 124, 240, 48, 236, 108, 64, 20, 190, 42, 235, 22,
-    5, 143, 154, 128, 82, 61, 148, 159, 66, 189, 150, 76, 10, 110, 121, 147, 78, 52, 75, 216, 132, 112, 118, 253, 194,
-    149, 248, 210, 200, 155, 124, 219, 135, 255, 153, 108, 125, 19, 177, 110, 213, 50, 141, 193, 235, 47, 82, 27, 46,
-    133, 162, 125, 134, 136, 187, 30, 163, 155, 105, 147, 116, 244, 210, 137, 80, 156, 58, 70, 95, 68, 29, 111, 11, 19,
-    218, 83, 14, 226, 136, 50, 201, 80, 102, 232, 136, 34, 38, 219, 140, 192, 185, 49, 156, 168, 28, 240, 46, 18, 217,
-    13, 117, 90, 189, 24, 232, 106, 243, 239, 201, 203, 1, 235, 1, 76, 39, 168, 136, 84, 88, 2, 53, 226, 71, 246, 204,
-    245, 209, 60, 122, 97, 136, 234, 70, 58, 163, 159, 32, 253, 70, 134, 53, 74, 60, 154, 104, 206, 160, 173, 5, 137,
-    214, 75, 199, 101, 156, 0, 249, 85, 97, 21, 249, 209, 79, 189, 153, 173, 219, 230, 63, 40, 84, 65, 88, 159, 179,
-    212, 46, 245, 224, 25, 116, 234, 86, 32, 58, 1, 204, 62, 131, 47, 246, 148, 135, 151, 195, 169, 231, 235, 23, 96,
-    86, 124, 171, 253, 62, 119, 243, 203, 26, 101, 87, 96, 103, 159, 18, 125, 105, 240, 5, 208, 60, 207, 162, 251, 201,
-    139, 151, 137, 87, 45, 24, 105, 143, 173, 232, 85, 86, 202, 240, 174, 190, 105, 68, 166, 112, 49, 219, 47, 69, 22,
-    238, 119, 1, 58, 54, 69, 59, 70, 141, 27, 19, 148, 149, 76, 237, 114, 152, 67, 5, 95, 16, 42, 90, 210, 69, 73, 9,
-    35, 249, 161, 73, 161, 25, 31, 210, 13, 50, 129, 20, 102, 177, 40, 201, 192, 233, 214, 164, 60, 87, 18, 30, 68, 185,
-    186, 126, 164, 108, 101, 127, 146, 205, 196, 85, 149, 21, 131, 14, 72, 205, 235, 180, 69, 119, 243, 13, 1, 54, 254,
-    159, 215, 229, 147, 99, 85, 240, 52, 219, 163, 215, 21, 206, 95, 149, 196, 86, 223, 98, 178, 194, 181, 159, 135, 90,
-    157, 233, 52, 209, 244, 202, 32, 0, 183, 33, 85, 111, 168, 185, 216, 58, 35, 1, 233, 43, 76, 199, 147, 68, 47, 83,
-    80, 186, 47, 25, 5, 60, 79, 149, 200, 54, 237, 51, 139, 23, 105, 252, 173, 156, 213, 69, 222, 233, 171, 29, 221,
-    197, 244, 130, 38, 208, 53, 240, 219, 236, 116, 163, 44, 215, 174, 187, 131, 67, 199, 240, 171, 217, 195, 159, 187,
-    84, 44, 109, 189, 237, 61, 173, 88, 232, 210, 22, 100, 179, 176, 242, 103, 139, 247, 16, 21, 164, 221, 50, 234, 234,
-    77, 12, 83, 179, 110, 149, 14, 94, 193, 230, 22, 153, 110, 29, 196, 35, 174, 58, 14, 26, 212, 181, 130, 113, 137,
-    177, 84, 46, 24, 33, 246, 64, 118, 228, 252, 123, 16, 185, 245, 128, 180, 76, 96, 99, 193, 7, 200, 73, 110, 62, 208,
-    240, 213, 135, 8, 100, 169, 134, 252, 21, 142, 91, 254, 16, 83, 165, 253, 220, 64, 50, 119, 180, 126, 173, 217, 225,
-    71, 245, 204, 235, 72, 238, 228, 36, 31, 51, 235, 136, 167, 93, 160, 46, 41, 3, 207, 118, 25, 30, 65, 4, 119, 6,
-    235, 43, 138, 110, 185, 84, 37, 97, 4, 244, 124, 77, 117, 8, 84, 207, 207, 97, 252, 30, 212, 24, 19, 51, 246, 44,
-    197, 251, 12, 230, 129, 2, 4, 65, 60, 45, 28, 69, 177, 230, 137, 52, 89, 83, 144, 169, 90, 52, 102, 132, 69, 223,
-    181, 24, 58, 105, 252, 14, 162, 15, 44, 17, 88, 199, 238, 32, 137, 40, 121, 248, 55, 244, 62, 17, 1, 234, 202, 103,
-    152, 97, 154, 59, 229, 4, 245, 70, 98, 93, 31, 232, 125, 1, 128, 190, 48, 13, 201, 72, 36, 240, 192, 206, 168, 13,
-    213, 220, 20, 247, 219, 117, 100, 213, 107, 9, 41, 201, 229, 55, 194, 152, 162, 168, 129, 198, 7, 124, 184, 126, 19,
-    54, 203, 213, 162, 230, 200, 252, 167, 232, 133, 245, 113, 247, 62, 49, 107, 42, 149, 227, 37, 170, 205, 189, 233,
-    207, 112, 76, 50, 148, 237, 222, 83, 231, 161, 46, 168, 185, 18, 196, 120, 155, 119, 37, 156, 155, 112, 106, 255, 6,
-    15, 232, 212, 57, 94, 88, 59, 55, 10, 238, 40, 55, 141, 10, 44, 78, 154, 178, 145, 170, 197, 128, 73, 83, 44, 77, 6,
-    152, 145, 252, 26, 25, 254, 0, 59, 192, 110, 205, 147, 32, 16, 185, 119, 135, 123, 157, 131, 8, 123, 171, 89, 133,
-    0, 81, 87, 166, 236, 30, 179, 86, 229, 141, 27, 94, 254, 245, 141, 204, 87, 143, 12, 35, 206, 235, 158, 235, 64,
-    110, 148, 12, 145, 78, 142, 245, 188, 59, 71, 226, 106, 243, 136, 112, 106, 235, 72, 250, 116, 62, 111, 185, 141,
-    44, 176, 31, 240, 143, 61, 205, 243, 182, 188, 78, 58, 76, 185, 90, 63, 120, 129, 3, 40, 14, 14, 105, 251, 175, 204,
-    205, 171, 33, 33, 7, 25, 187, 80, 18, 55, 174, 253, 192, 200, 117, 32, 186, 149, 34, 221, 12, 237, 70, 48, 13, 93,
-    193, 71, 181, 215, 3, 13, 87, 171, 5, 121, 119, 47, 147, 202, 61, 140, 127, 111, 218, 67, 12, 143, 19, 109, 54, 48,
-    109, 107, 230, 118, 31, 167, 48, 198, 51, 180, 181, 245, 100, 120, 117, 34, 72, 102, 8, 100, 79, 144, 102, 47, 44,
-    51, 50, 21, 98, 19, 224, 52, 114, 162, 112, 18, 129, 40, 90, 78, 165, 229, 35, 47, 187, 207, 162, 113, 12, 67, 184,
-    1, 55, 107, 210, 44, 125, 58, 114, 135, 65, 128, 77, 111, 161, 115, 61, 120, 152, 254, 38, 210, 201, 18, 151, 55,
-    41, 59, 65, 203, 220, 161, 121, 204, 134, 41, 202, 245, 155, 47, 115, 86, 82, 46, 184, 126, 152, 103, 188, 180, 181,
-    159, 104, 99, 98, 140, 239, 190, 24, 209, 26, 103, 151, 122, 115, 169, 59, 187, 176, 184, 126, 158, 157, 78, 246,
-    243, 148, 201, 91, 32, 106, 185, 27, 145, 196, 196, 85, 66, 212, 164, 177, 136, 248, 55, 176, 189, 162, 45, 205,
-    187, 84, 153, 31, 7, 126, 244, 233, 220, 190, 166, 149, 65, 38, 103, 30, 194, 239, 233, 220, 82, 82, 202, 239, 81,
-    135, 205, 218, 128, 242, 75, 143, 114, 153, 149, 108, 117, 6, 27, 227, 196, 214, 71, 33, 102, 46, 121, 18, 132, 157,
-    179, 221, 123, 10, 184, 1, 249, 32, 180, 83, 129, 12, 26, 100, 219, 123, 34, 179, 137, 175, 216, 136, 90, 203, 83,
-    89, 199, 99, 126, 3, 33, 193, 145, 167, 172, 208, 238, 132, 233, 254, 130, 51, 98, 145, 219, 78, 179, 117, 41, 33,
-    151, 62, 118, 2, 221, 187, 10, 12, 110, 142, 144, 55, 161, 232, 171, 136, 67, 58, 149, 216, 100, 65, 245, 156, 219,
-    141, 97, 63, 184, 221, 100, 103, 154, 31, 248, 60, 242, 128, 201, 85, 68, 68, 24, 161, 147, 243, 129, 173, 238, 169,
-    81, 7, 100, 88, 160, 217, 59, 157, 239, 12, 121, 215, 85, 229, 124, 175, 91, 89, 103, 29, 214, 236, 58, 26, 19, 125,
-    160, 77, 49, 87, 134, 161, 111, 23, 64, 107, 7, 209, 96, 100, 77, 61, 202, 214, 120, 8, 70, 172, 152, 196, 135, 215,
-    109, 116, 160, 181, 50, 162, 210, 66, 10, 20, 229, 36, 146, 15, 105, 70, 84, 149, 117, 196, 231, 192, 238, 26, 139,
-    38, 34, 243, 13, 126, 79, 221, 198, 16, 120, 114, 139, 7, 213, 61, 70, 229, 184, 61, 12, 247, 89, 190, 25, 48, 101,
-    211, 236, 152, 21, 206, 197, 95, 75, 253, 186, 70, 154, 45, 47, 153, 45, 105, 89, 148, 17, 80, 69, 61, 188, 109, 20,
-    64, 10, 145, 134, 207, 236, 62, 213, 117, 38, 190, 112, 119, 89, 24, 232, 192, 158, 34, 255, 69, 42, 85, 211, 77,
-    32, 31, 11, 235, 101, 228, 144, 51, 161, 240, 141, 144, 185, 149, 113, 171, 255, 244, 80, 113, 211, 227, 107, 9,
-    183, 42, 170, 183, 207, 152, 196, 40, 61, 93, 249, 96, 13, 253, 121, 176, 37, 224, 70, 111, 158, 1, 79, 36, 27, 141,
-    81, 128, 40, 213, 50, 36, 17, 130, 176, 7, 131, 207, 156, 41, 148, 41, 174, 190, 105, 59, 113, 170, 228, 3, 40, 147,
-    140, 87, 239, 198, 165, 205, 114, 7, 222, 51, 166, 93, 158, 34, 175, 8, 35, 24, 229, 193, 131, 75, 244, 181, 52,
-    174, 227, 177, 104, 36, 99, 128, 192, 50, 206, 18, 209, 12, 23, 48, 129, 39, 240, 215, 18, 37, 224, 248, 172, 201,
-    39, 196, 171, 223, 149, 198, 195, 175, 248, 102, 142, 196, 1, 21, 11, 233, 191, 250, 134, 82, 139, 86, 22, 207, 165,
-    2, 122, 176, 95, 183, 101, 28, 68, 240, 12, 179, 155, 168, 219, 216, 147, 30, 51, 107, 207, 143, 129, 137, 137, 61,
-    253, 158, 246, 214, 229, 169, 225, 127, 211, 134, 142, 120, 54, 89, 124, 40, 32, 103, 63, 179, 203, 50, 13, 181,
-    207, 190, 211, 116, 142, 52, 110, 165, 103, 235, 72, 129, 34, 219, 195, 90, 253, 122, 213, 228, 55, 128, 7, 21, 176,
-    36, 109, 146, 52, 108, 189, 160, 144, 30, 102, 136, 178, 105, 62, 9, 132, 76, 23, 61, 194, 205, 73, 176, 152, 53,
-    136, 246, 86, 219, 67, 140, 202, 193, 182, 219, 144, 53, 82, 104, 124, 182, 232, 116, 210, 90, 226, 28, 199, 120,
-    125, 178, 173, 9, 190, 107, 51, 53, 200, 94, 188, 79, 126, 217, 165, 146, 127, 146, 42, 197, 18, 122, 194, 173, 247,
-    241, 3, 5, 12, 229, 47, 76, 131, 255, 177, 229, 147, 49, 69, 146, 68, 208, 173, 35, 182, 223, 220, 66, 180, 42, 174,
-    245, 253, 43, 12, 203, 117, 86, 106, 41, 17, 84, 66, 233, 24, 247, 155, 118, 161, 167, 38, 71, 11, 235, 1, 153, 109,
-    193, 212, 184, 241, 11, 68, 252, 108, 8, 76, 233, 141, 199, 184, 210, 49, 85, 126, 123, 60, 216, 137, 240, 195, 30,
-    121, 33, 167, 172, 230, 136, 66, 197, 15, 183, 152, 17, 89, 22, 211, 25, 210, 174, 147, 101, 79, 79, 255, 153, 191,
-    21, 175, 251, 155, 133, 106, 164, 103, 0, 104, 156, 196, 76, 234, 152, 167, 166, 184, 150, 181, 3, 201, 88, 9, 33,
-    160, 176, 197, 127, 220, 70, 89, 106, 203, 93, 101, 106, 10, 49, 99, 235, 181, 250, 222, 139, 214, 37, 200, 101,
-    188, 114, 47, 222, 174, 238, 187, 115, 181, 110, 206, 141, 70, 9, 226, 105, 203, 166, 230, 97, 146, 94, 74, 47, 141,
-    125, 214, 44, 56, 139, 231, 116, 125, 89, 120, 214, 161, 207, 120, 198, 100, 115, 33, 122, 197, 36, 183, 175, 86,
-    34, 239, 249, 41, 44, 55, 185, 212, 53, 216, 153, 133, 80, 21, 223, 63, 194, 136, 125, 237, 113, 202, 3, 89, 147,
-    80, 173, 73, 248, 187, 14, 148, 4, 55, 193, 107, 168, 213, 44, 116, 79, 223, 230, 201, 94, 151, 16, 136, 29, 142,
-    155, 3, 211, 78, 230, 133, 199, 151, 182, 246, 88, 78, 165, 95, 25, 78, 112, 254, 128, 118, 151, 89, 132, 112, 39,
-    168, 4, 175, 93, 119, 3, 139, 222, 112, 173, 26, 121, 59, 156, 196, 167, 118, 80, 85, 132, 72, 0, 127, 150, 251,
-    251, 172, 154, 84, 71, 230, 251, 183, 24, 240, 172, 22, 106, 194, 118, 64, 129, 99, 149, 163, 233, 147, 21, 231,
-    173, 130, 66, 54, 41, 156, 153, 153, 205, 153, 199, 127, 33, 55, 217, 118, 43, 44, 36, 48, 104, 191, 121, 122, 131,
-    229, 177, 193, 13, 17, 100, 191, 80, 168, 95, 28, 5, 45, 146, 116, 42, 104, 186, 95, 89, 180, 200, 21, 129, 144,
-    134, 201, 124, 134, 255, 195, 192, 99, 92, 76, 171, 196, 197, 144, 135, 34, 68, 94, 128, 224, 214, 65, 125, 219, 33,
-    61, 60, 62, 18, 214, 0, 70, 43, 34, 247, 177, 230, 236, 90, 106, 50, 190, 129, 209, 145, 13, 56, 85, 89, 11, 41,
-    123, 199, 17, 187, 43, 114, 230, 34, 147, 88, 61, 20, 62, 38, 60, 79, 146, 144, 131, 207, 158, 198, 82, 34, 96, 66,
-    244, 177, 193, 99, 70, 9, 146, 137, 230, 231, 141, 112, 32, 189, 22, 160, 82, 250, 183, 241, 42, 165, 174, 249, 253,
-    128, 41, 50, 110, 46, 11, 202, 2, 78, 147, 47, 192, 212, 26, 111, 69, 171, 235, 6, 30, 64, 138, 49, 143, 204, 237,
-    150, 111, 167, 87, 197, 216, 113, 139, 5, 91, 207, 40, 201, 41, 141, 169, 80, 14, 219, 124, 49, 1, 206, 89, 217,
-    121, 150, 121, 135, 180, 174, 164, 231, 18, 194, 30, 15, 70, 22, 87, 220, 179, 112, 255, 19, 85, 229, 125, 138, 99,
-    6, 211, 11, 34, 236, 207, 141, 47, 211, 232, 105, 2, 118, 75, 208, 227, 118, 99, 107, 245, 113, 65, 235, 27, 38, 68,
-    81, 75, 23, 248, 176, 153, 47, 14, 8, 210, 173, 194, 188, 19, 83, 183, 200, 18, 226, 130, 214, 251, 233, 134, 2,
-    205, 138, 205, 30, 60, 79, 135, 95, 21, 88, 168, 109, 76, 43, 95, 130, 85, 157, 4, 57, 63, 226, 87, 101, 207, 152,
-    92, 4, 82, 110, 183, 149, 173, 25, 221, 55, 148, 179, 182, 6, 97, 157, 188, 144, 2, 81, 21, 250, 200, 105, 170, 118,
-    18, 241, 117, 96, 63, 221, 214, 231, 233, 229, 176, 120, 249, 118, 34, 239, 136, 109, 111, 205, 66, 99, 68, 122,
-    143, 139, 39, 162, 60, 206, 47, 67, 4, 131, 189, 149, 82, 80, 57, 229, 71, 145, 152, 141, 100, 136, 33, 163, 59,
-    204, 76, 155, 215, 219, 199, 53, 29, 8, 140, 231, 180, 212, 31, 2, 137, 138, 38, 19, 171, 201, 182, 207, 223, 109,
-    150, 229, 104, 199, 129, 206, 56, 226, 237, 163, 180, 35, 236, 170, 181, 120, 204, 101, 197, 13, 254, 48, 240, 99,
-    134, 228, 127, 9, 238, 104, 245, 227, 180, 35, 16, 105, 38, 83, 49, 194, 161, 20, 30, 159, 253, 157, 255, 190, 237,
-    152, 199, 218, 242, 205, 130, 107, 224, 132, 142, 33, 39, 92, 241, 140, 135, 233, 99, 219, 63, 184, 78, 22, 225,
-    155, 64, 89, 147, 159, 225, 130, 221, 175, 123, 209, 121, 193, 71, 169, 127, 103, 66, 8, 62, 121, 244, 177, 181,
-    223, 31, 163, 105, 91, 139, 238, 6, 36, 3, 182, 118, 44, 239, 176, 126, 64, 93, 93, 226, 169, 31, 168, 17, 216, 4,
-    116, 29, 164, 95, 166, 109, 34, 192, 61, 68, 79, 6, 73, 182, 235, 234, 85, 156, 53, 164, 23
+    59, 184, 56, 93, 70, 82, 112, 35, 6, 120, 46, 131, 149, 168, 162, 184, 25, 153, 139, 77, 156, 176, 120, 162, 54, 0,
+    249, 145, 233, 86, 221, 96, 150, 59, 240, 24, 156, 143, 213, 49, 200, 189, 63, 239, 159, 210, 101, 61, 105, 224,
+    128, 97, 93, 22, 103, 26, 83, 200, 242, 233, 18, 108, 62, 51, 84, 27, 211, 142, 26, 66, 200, 60, 7, 183, 65, 88, 7,
+    30, 158, 24, 160, 173, 243, 69, 93, 15, 175, 215, 76, 164, 94, 77, 83, 91, 9, 188, 47, 178, 230, 253, 27, 45, 63,
+    48, 1, 150, 124, 207, 157, 74, 94, 88, 122, 58, 179, 236, 192, 130, 58, 140, 152, 172, 176, 7, 120, 27, 177, 184,
+    147, 191, 59, 63, 192, 249, 203, 212, 136, 121, 95, 4, 80, 235, 196, 253, 64, 152, 102, 40, 103, 169, 179, 61, 49,
+    250, 118, 1, 232, 1, 213, 74, 21, 197, 174, 44, 138, 234, 142, 27, 222, 65, 147, 192, 248, 158, 226, 23, 166, 103,
+    75, 118, 245, 213, 140, 73, 156, 236, 241, 118, 151, 237, 133, 58, 112, 121, 27, 244, 110, 248, 201, 82, 188, 135,
+    176, 135, 105, 223, 236, 187, 113, 145, 101, 237, 207, 48, 248, 147, 228, 133, 3, 211, 242, 70, 223, 27, 68, 125,
+    212, 58, 86, 252, 72, 136, 130, 234, 148, 195, 191, 44, 78, 224, 119, 129, 83, 245, 50, 177, 17, 78, 95, 197, 1,
+    171, 28, 194, 196, 3, 156, 59, 248, 146, 201, 11, 51, 151, 47, 220, 222, 145, 214, 155, 117, 229, 7, 52, 123, 159,
+    185, 49, 70, 28, 59, 250, 242, 40, 46, 126, 4, 195, 49, 7, 246, 139, 253, 245, 131, 101, 141, 220, 203, 192, 68, 32,
+    191, 210, 237, 64, 239, 92, 145, 229, 134, 42, 89, 254, 183, 188, 3, 4, 86, 243, 226, 108, 59, 48, 42, 99, 207, 175,
+    125, 31, 129, 125, 94, 162, 10, 153, 228, 2, 125, 150, 222, 104, 159, 30, 65, 231, 134, 191, 212, 55, 36, 138, 50,
+    220, 221, 51, 246, 68, 180, 155, 48, 229, 186, 193, 96, 162, 160, 162, 128, 176, 146, 221, 208, 177, 75, 76, 207,
+    208, 224, 124, 53, 104, 255, 123, 64, 159, 90, 36, 191, 8, 149, 51, 154, 34, 131, 208, 28, 164, 80, 242, 230, 254,
+    28, 232, 141, 180, 74, 143, 142, 77, 123, 124, 176, 98, 182, 253, 8, 253, 80, 172, 77, 155, 249, 117, 77, 74, 31,
+    191, 215, 215, 190, 186, 144, 81, 143, 6, 160, 45, 130, 0, 221, 212, 251, 133, 173, 217, 154, 152, 67, 22, 235, 217,
+    31, 218, 46, 94, 142, 84, 84, 88, 17, 112, 62, 249, 61, 116, 205, 92, 196, 80, 178, 176, 195, 168, 161, 241, 241,
+    138, 199, 247, 254, 25, 52, 254, 239, 210, 186, 158, 106, 162, 162, 190, 100, 152, 39, 174, 112, 207, 211, 247, 61,
+    131, 86, 202, 139, 127, 23, 210, 120, 205, 166, 227, 118, 247, 38, 37, 27, 89, 27, 225, 120, 146, 41, 129, 158, 67,
+    51, 19, 78, 171, 116, 85, 203, 122, 196, 17, 111, 112, 246, 151, 58, 154, 64, 51, 251, 185, 146, 231, 183, 45, 216,
+    119, 232, 184, 197, 113, 179, 56, 110, 114, 181, 150, 160, 58, 153, 63, 126, 1, 156, 28, 179, 168, 254, 79, 128,
+    231, 125, 232, 142, 82, 17, 130, 208, 81, 66, 12, 27, 56, 55, 128, 146, 189, 212, 24, 143, 60, 170, 174, 169, 31,
+    136, 210, 100, 249, 121, 7, 147, 233, 153, 32, 235, 95, 57, 197, 180, 190, 148, 3, 251, 204, 159, 216, 27, 245, 228,
+    2, 47, 86, 25, 245, 40, 9, 229, 148, 100, 182, 182, 158, 11, 151, 199, 219, 24, 113, 23, 160, 122, 165, 90, 171, 47,
+    119, 93, 19, 112, 211, 225, 127, 82, 249, 73, 213, 37, 31, 84, 89, 158, 208, 225, 111, 184, 85, 141, 143, 59, 138,
+    222, 139, 11, 135, 192, 47, 193, 161, 91, 76, 125, 56, 135, 14, 197, 144, 51, 106, 13, 177, 228, 246, 183, 89, 204,
+    48, 135, 62, 54, 219, 38, 80, 76, 18, 6, 169, 127, 206, 150, 28, 35, 174, 212, 135, 134, 139, 152, 122, 90, 31, 50,
+    247, 235, 215, 186, 127, 252, 169, 28, 105, 114, 34, 106, 141, 134, 1, 151, 175, 235, 66, 188, 98, 92, 239, 23, 123,
+    191, 18, 30, 89, 100, 4, 37, 27, 15, 83, 214, 118, 19, 117, 103, 180, 4, 222, 214, 53, 124, 145, 140, 190, 94, 192,
+    117, 237, 42, 160, 9, 169, 240, 63, 15, 152, 196, 254, 104, 189, 130, 55, 90, 8, 115, 237, 114, 94, 2, 164, 155,
+    197, 225, 210, 104, 93, 84, 207, 234, 25, 130, 158, 100, 82, 20, 49, 177, 178, 215, 181, 227, 24, 165, 209, 57, 248,
+    119, 220, 173, 125, 73, 110, 35, 192, 109, 240, 147, 125, 80, 234, 133, 72, 158, 187, 116, 231, 71, 36, 94, 108, 92,
+    153, 129, 43, 45, 89, 153, 85, 95, 63, 251, 114, 204, 81, 228, 107, 103, 198, 223, 223, 97, 69, 200, 177, 140, 243,
+    47, 14, 184, 46, 149, 224, 120, 236, 84, 83, 137, 71, 138, 33, 105, 17, 66, 56, 15, 188, 62, 236, 250, 155, 164, 34,
+    208, 53, 175, 27, 49, 253, 40, 217, 198, 44, 189, 29, 169, 179, 162, 47, 132, 55, 90, 10, 185, 143, 22, 107, 221,
+    74, 159, 252, 207, 210, 140, 185, 34, 196, 136, 36, 181, 86, 65, 64, 160, 48, 204, 80, 130, 217, 113, 195, 244, 192,
+    129, 90, 100, 92, 213, 177, 76, 167, 19, 236, 105, 125, 23, 80, 16, 111, 18, 159, 136, 161, 128, 79, 43, 96, 105,
+    214, 202, 174, 234, 55, 74, 104, 56, 108, 31, 44, 221, 27, 181, 246, 119, 208, 175, 188, 245, 134, 127, 152, 200,
+    206, 43, 134, 230, 141, 152, 79, 10, 88, 12, 157, 230, 69, 10, 242, 100, 60, 50, 20, 98, 69, 129, 92, 162, 138, 99,
+    215, 220, 253, 236, 147, 7, 105, 237, 208, 236, 235, 223, 88, 215, 111, 133, 150, 166, 92, 115, 247, 21, 204, 188,
+    136, 16, 215, 246, 123, 39, 192, 63, 169, 106, 250, 42, 69, 237, 122, 153, 147, 97, 254, 223, 224, 185, 83, 177,
+    105, 62, 223, 151, 88, 78, 252, 144, 180, 193, 115, 113, 247, 234, 121, 162, 196, 214, 44, 85, 8, 254, 134, 253, 34,
+    228, 105, 197, 82, 215, 157, 13, 28, 203, 51, 237, 142, 141, 99, 240, 147, 104, 244, 219, 180, 192, 167, 138, 104,
+    225, 1, 183, 225, 204, 27, 143, 151, 179, 152, 210, 141, 42, 148, 126, 137, 120, 251, 60, 229, 108, 221, 42, 47, 64,
+    120, 2, 58, 250, 144, 228, 208, 233, 120, 0, 174, 127, 13, 173, 149, 164, 58, 154, 83, 46, 232, 6, 61, 4, 235, 184,
+    68, 228, 220, 117, 177, 184, 134, 107, 232, 204, 192, 242, 152, 186, 150, 56, 84, 11, 250, 154, 131, 59, 59, 51,
+    240, 197, 141, 2, 160, 101, 190, 81, 202, 131, 39, 186, 199, 182, 8, 194, 182, 217, 15, 149, 180, 244, 80, 135, 202,
+    146, 125, 101, 94, 70, 46, 56, 4, 56, 38, 73, 73, 195, 47, 89, 28, 139, 71, 244, 128, 203, 20, 238, 64, 174, 189,
+    169, 12, 210, 170, 139, 201, 101, 222, 118, 121, 198, 178, 100, 120, 89, 119, 5, 232, 17, 140, 123, 227, 145, 203,
+    179, 222, 79, 120, 196, 106, 48, 108, 250, 193, 67, 238, 23, 19, 138, 150, 73, 101, 96, 125, 138, 3, 174, 189, 62,
+    174, 45, 217, 143, 208, 12, 189, 76, 92, 132, 105, 152, 249, 85, 52, 239, 114, 103, 139, 21, 84, 144, 53, 46, 115,
+    190, 92, 39, 99, 144, 154, 22, 65, 12, 103, 53, 198, 37, 164, 125, 219, 38, 207, 58, 198, 129, 135, 40, 191, 1, 207,
+    247, 23, 105, 111, 96, 220, 127, 18, 247, 72, 214, 198, 18, 12, 228, 79, 94, 215, 136, 2, 4, 179, 240, 24, 16, 137,
+    47, 217, 229, 58, 220, 237, 93, 93, 159, 251, 26, 74, 210, 3, 48, 14, 249, 247, 77, 20, 245, 161, 63, 235, 26, 221,
+    169, 67, 40, 168, 99, 252, 16, 135, 188, 148, 255, 134, 36, 36, 161, 28, 66, 177, 150, 72, 95, 49, 74, 208, 187, 17,
+    160, 194, 182, 162, 160, 43, 241, 158, 202, 172, 200, 221, 86, 62, 52, 138, 109, 168, 47, 73, 122, 21, 181, 160, 35,
+    212, 172, 216, 48, 246, 144, 178, 219, 227, 162, 212, 43, 97, 241, 9, 11, 211, 159, 175, 38, 42, 205, 151, 186, 245,
+    119, 237, 142, 178, 217, 231, 203, 240, 154, 136, 65, 200, 153, 181, 52, 225, 147, 80, 156, 102, 92, 169, 20, 131,
+    253, 242, 192, 249, 174, 104, 103, 99, 119, 236, 149, 83, 246, 55, 50, 243, 70, 96, 46, 120, 219, 7, 149, 173, 215,
+    106, 213, 88, 107, 113, 247, 32, 8, 79, 148, 213, 196, 159, 54, 107, 2, 193, 42, 235, 144, 15, 168, 151, 119, 168,
+    80, 179, 69, 97, 82, 15, 34, 206, 204, 186, 159, 227, 88, 233, 171, 235, 86, 168, 81, 234, 135, 78, 231, 207, 250,
+    23, 61, 229, 100, 254, 202, 134, 223, 203, 27, 101, 244, 232, 18, 95, 9, 153, 130, 75, 66, 27, 223, 53, 35, 227, 69,
+    173, 209, 220, 46, 176, 213, 174, 244, 193, 88, 36, 123, 78, 150, 200, 195, 61, 226, 253, 49, 52, 28, 242, 251, 225,
+    145, 254, 243, 192, 174, 199, 89, 194, 28, 142, 35, 169, 35, 223, 152, 217, 191, 152, 171, 41, 217, 117, 20, 64, 57,
+    240, 127, 121, 24, 73, 115, 36, 174, 203, 60, 68, 163, 135, 199, 6, 23, 214, 185, 30, 4, 90, 219, 122, 27, 176, 154,
+    187, 37, 215, 117, 229, 21, 228, 129, 241, 176, 14, 110, 148, 121, 41, 228, 63, 255, 74, 190, 70, 86, 223, 78, 151,
+    191, 236, 94, 120, 88, 62, 141, 53, 29, 131, 8, 24, 122, 189, 16, 147, 25, 127, 155, 38, 39, 249, 169, 249, 20, 174,
+    98, 111, 65, 208, 190, 65, 192, 61, 143, 31, 164, 243, 148, 212, 39, 152, 117, 182, 193, 175, 17, 239, 99, 73, 245,
+    202, 41, 176, 226, 69, 199, 204, 214, 89, 157, 23, 85, 108, 159, 162, 239, 151, 186, 146, 30, 176, 55, 7, 146, 104,
+    132, 19, 235, 143, 176, 186, 23, 199, 46, 101, 89, 127, 235, 124, 175, 6, 156, 69, 208, 34, 99, 93, 142, 43, 126,
+    232, 139, 57, 110, 64, 253, 88, 169, 150, 231, 206, 92, 131, 70, 77, 121, 251, 143, 12, 114, 53, 180, 223, 202, 151,
+    115, 50, 32, 250, 224, 73, 245, 255, 118, 98, 92, 197, 37, 253, 3, 189, 146, 112, 244, 166, 35, 53, 66, 67, 29, 114,
+    129, 61, 93, 77, 252, 153, 59, 189, 122, 120, 29, 198, 38, 158, 162, 210, 231, 23, 44, 134, 68, 155, 95, 244, 127,
+    138, 86, 201, 203, 142, 230, 165, 230, 208, 36, 93, 47, 192, 233, 183, 195, 139, 221, 47, 72, 146, 123, 126, 163,
+    202, 93, 250, 76, 102, 223, 20, 43, 182, 77, 164, 102, 146, 73, 163, 231, 187, 207, 249, 44, 165, 208, 167, 23, 61,
+    129, 223, 198, 82, 184, 67, 1, 96, 2, 108, 15, 91, 0, 40, 209, 170, 213, 219, 27, 225, 31, 63, 192, 37, 111, 167,
+    52, 231, 254, 95, 206, 18, 18, 101, 12, 74, 44, 212, 81, 18, 243, 196, 163, 174, 64, 171, 201, 7, 23, 15, 74, 171,
+    131, 218, 218, 179, 129, 108, 241, 9, 107, 212, 179, 241, 67, 17, 229, 59, 6, 222, 233, 21, 203, 161, 49, 173, 144,
+    136, 43, 66, 48, 218, 156, 170, 148, 49, 116, 234, 80, 205, 113, 156, 126, 183, 197, 163, 200, 136, 201, 177, 35,
+    227, 52, 145, 236, 185, 246, 164, 63, 46, 194, 174, 173, 17, 195, 137, 179, 16, 228, 130, 163, 28, 10, 6, 119, 104,
+    234, 65, 175, 166, 98, 45, 204, 191, 155, 103, 16, 62, 198, 60, 249, 37, 8, 177, 161, 87, 70, 167, 104, 238, 85, 26,
+    44, 156, 66, 114, 186, 242, 174, 247, 34, 229, 19, 191, 20, 60, 45, 49, 173, 174, 201, 185, 196, 169, 182, 157, 60,
+    81, 223, 34, 161, 42, 167, 172, 244, 197, 23, 86, 173, 26, 128, 15, 196, 41, 6, 107, 97, 141, 161, 147, 255, 98,
+    146, 114, 89, 170, 182, 14, 168, 224, 139, 22, 60, 237, 119, 161, 231, 122, 55, 187, 57, 157, 245, 5, 132, 57, 76,
+    66, 40, 2, 157, 249, 26, 141, 177, 226, 148, 98, 90, 115, 206, 133, 106, 55, 22, 69, 237, 75, 105, 5, 236, 117, 96,
+    20, 181, 22, 50, 130, 142, 67, 0, 65, 138, 144, 212, 104, 77, 61, 147, 125, 77, 31, 48, 106, 135, 190, 173, 193,
+    228, 136, 154, 112, 123, 183, 253, 87, 227, 64, 119, 172, 50, 32, 212, 232, 115, 117, 117, 80, 68, 74, 69, 53, 154,
+    216, 127, 147, 183, 43, 124, 154, 233, 21, 81, 37, 227, 228, 81, 56, 17, 4, 70, 95, 21, 191, 13, 45, 167, 87, 158,
+    32, 27, 34, 241, 210, 112, 170, 236, 142, 167, 4, 112, 111, 119, 6, 229, 197, 140, 22, 192, 109, 96, 52, 83, 160,
+    71, 51, 78, 121, 187, 152, 92, 62, 133, 232, 172, 115, 232, 4, 87, 114, 210, 90, 99, 187, 11, 15, 67, 132, 70, 29,
+    71, 40, 149, 121, 147, 154, 162, 155, 20, 69, 80, 139, 125, 72, 194, 253, 147, 146, 241, 109, 109, 202, 205, 31, 56,
+    9, 199, 242, 248, 239, 254, 148, 91, 11, 130, 71, 192, 124, 132, 213, 238, 27, 134, 129, 167, 98, 182, 162, 189,
+    212, 181, 139, 199, 236, 126, 88, 247, 116, 126, 39, 59, 174, 169, 156, 238, 85, 139, 30, 225, 47, 131, 227, 44, 38,
+    155, 157, 57, 219, 168, 126, 193, 144, 252, 28, 48, 142, 84, 172, 57, 199, 32, 48, 63, 117, 146, 154, 171, 84, 124,
+    235, 79, 156, 227, 197, 239, 90, 60, 78, 155, 124, 33, 147, 213, 74, 30, 62, 68, 241, 217, 174, 247, 105, 100, 157,
+    203, 23, 84, 27, 56, 226, 74, 111, 10, 204, 81, 97, 36, 229, 240, 19, 205, 162, 84, 222, 41, 231, 89, 114, 150, 183,
+    245, 220, 0, 78, 160, 141, 227, 242, 93, 6, 136, 205, 23, 18, 192, 118, 180, 117, 127, 19, 200, 77, 225, 148, 82,
+    18, 125, 245, 34, 237, 251, 88, 129, 109, 158, 100, 9, 95, 203, 16, 215, 185, 85, 141, 203, 15, 172, 72, 150, 67,
+    212, 33, 223, 0, 24, 176, 155, 39, 40, 91, 244, 230, 10, 17, 206, 41, 45, 168, 42, 150, 88, 97, 238, 192, 164, 132,
+    26, 170, 243, 193, 141, 19, 192, 216, 251, 68, 247, 33, 76, 146, 63, 173, 90, 1, 8, 59, 116, 58, 65, 21, 158, 36,
+    101, 203, 111, 2, 207, 71, 210, 169, 7, 208, 233, 17, 119, 158, 194, 52, 195, 61, 106, 221, 27, 33, 162, 19, 163,
+    120, 175, 241, 142, 168, 149, 140, 90, 194, 204, 236, 60, 34, 2, 44, 239, 220, 70, 161, 251, 158, 126, 103, 189, 11,
+    248, 57, 234, 236, 241, 141, 54, 99, 72, 87, 90, 14, 20, 199, 8, 199, 54, 125, 208, 40, 254, 199, 167, 56, 61, 195,
+    57, 124, 147, 77, 136, 34, 154, 180, 177, 243, 244, 107, 250, 237, 97, 55, 35, 51, 129, 231, 2, 249, 119, 136, 172,
+    230, 29, 248, 69, 81, 77, 108, 167, 164, 103, 110, 79, 156, 120, 39, 125, 101, 108, 177, 115, 209, 250, 235, 118,
+    141, 161, 195, 140, 173, 141, 227, 172, 245, 218, 159, 233, 74, 210, 96, 139, 53, 240, 23, 129, 208, 159, 71, 192,
+    53, 180, 204, 170, 203, 74, 111, 212, 100, 75, 133, 12, 203, 126, 4, 213, 69, 13, 212, 149, 139, 183, 40, 101, 251,
+    160, 158, 215, 24, 169, 231, 12, 220, 126, 157, 29, 236, 56, 145, 47, 121, 185, 249, 135, 47, 133, 125, 90, 117, 85,
+    3, 77, 53, 122, 49, 251, 183, 249, 76, 125, 3, 199, 196, 41, 226, 232, 213, 192, 170, 92, 45, 39, 39, 7, 179, 159,
+    20, 205, 247, 80, 184, 211, 95, 230, 209, 39, 96, 100, 87, 178, 107, 201, 228, 161, 102, 141, 197, 3, 59, 119, 235,
+    144, 102, 198, 13, 122, 150, 158, 191, 138, 18, 140, 106, 115, 65, 143, 221, 139, 100, 136, 86, 167, 7, 47, 235,
+    239, 160, 25, 184, 197, 160, 34, 90, 20, 40, 222, 73, 188, 151, 28, 167, 24, 246, 63, 40, 47, 142, 132, 96, 9, 150,
+    241, 69, 255, 169, 186, 172, 56, 251, 142, 138, 34, 243, 159, 143, 122, 241, 253, 115, 231, 148, 206, 32, 86, 123,
+    203, 102, 255, 232, 128, 233, 252, 213, 76, 17, 99, 247, 160, 140, 106, 56, 139, 47, 116, 7, 58, 129, 148, 41, 144,
+    113, 97, 254, 214, 134, 31, 37, 227, 78, 218, 34, 91, 77, 22, 201, 139, 35, 158, 93, 90, 201, 105, 185, 236, 142,
+    245, 23, 119, 152, 8, 207, 99, 101, 142, 146, 91, 137, 151, 219, 38, 229, 247, 53, 79, 60, 114, 14, 224, 114, 42,
+    110, 254, 76, 78, 87, 215, 155, 95, 127, 86, 65, 225, 230, 125, 99, 126, 128, 173, 5, 254, 204, 196, 50, 178, 254,
+    105, 137, 148, 66, 245, 68, 121, 143, 150, 255, 247, 246, 123, 43, 106, 168, 224, 5, 233, 70, 204, 129, 235, 254,
+    181, 142, 145, 2, 176, 120, 73, 151, 148, 161, 173, 64, 229, 91, 164, 193, 188, 180, 122, 166, 156, 122, 161, 186,
+    59, 21, 213, 60, 202, 18, 78, 110, 53, 83, 145, 232, 164, 67, 232, 220, 63, 10, 102, 27, 209, 254, 42, 142, 110, 28,
+    59, 248, 72, 161, 2, 98, 112, 22, 115, 222, 210, 182, 127, 154, 252, 224, 250, 87, 102, 229, 44, 226, 155, 177, 46,
+    198, 234, 102, 14, 173, 216, 85, 229, 47, 9, 4, 88, 74, 173, 195, 198, 170, 194, 121, 127, 39, 187, 194, 193, 71,
+    229, 194, 10, 252, 206, 250, 8, 161, 48, 25, 120, 31, 167, 117, 1, 124, 142, 179, 217, 1, 222, 53, 181, 48, 22, 16,
+    64, 248, 227, 159, 137, 114, 159, 139, 155, 124, 140, 94, 3, 115, 51, 62, 47, 154, 219, 156, 48, 47, 55, 144, 250,
+    125, 105, 243, 187, 42, 58, 178, 189, 45, 46, 125, 11, 149, 48, 86, 123, 0, 135, 75, 65, 204, 121, 158, 48, 197, 0,
+    210, 86, 45, 191, 68, 204, 77, 40, 248, 216, 91, 250, 201, 119, 141, 68, 3, 222, 105, 208, 111, 164, 195, 108, 51,
+    216, 126, 33, 11, 72, 85, 177, 123, 215, 26, 3, 25, 254, 201, 171, 190, 247, 95, 196, 192, 95, 166, 212, 130, 129,
+    91, 89, 149, 48, 127, 148, 234, 70, 17, 178, 17, 130, 98, 128, 107, 129, 162, 47, 50, 59, 107, 150, 98, 52, 115, 7,
+    74, 4, 172, 3, 37, 55, 150, 198, 125, 153, 248, 173, 155, 7, 119, 136, 61, 102, 71, 242, 188, 151, 11, 132, 165,
+    204, 121, 234, 129, 211, 22, 44, 252, 236, 168, 225, 240, 3, 53, 86, 124, 104, 103, 24, 205, 236, 25, 202, 185, 185,
+    26, 102, 34, 119, 244, 62, 61, 9, 4, 146, 197, 61, 191, 179, 186, 53, 239, 192, 155, 128, 87, 227, 14, 121, 95, 130,
+    228, 9, 8, 66, 186, 55, 0, 57, 104, 232, 47, 170, 230, 166, 43, 3, 54, 28, 219, 52, 109, 154, 134, 251, 207, 232,
+    61, 229, 112, 246, 57, 17, 27, 57, 39, 150, 99, 81, 52, 187, 229, 159, 46, 44, 251, 217, 50, 215, 108, 146, 67, 173,
+    240, 119, 246, 152, 4, 33, 222, 210, 250, 195, 247, 88, 45, 90, 60, 169, 122, 182, 214, 61, 145, 212, 222, 198, 198,
+    228, 38, 247, 171, 74, 14, 104, 87, 50, 0, 52, 144, 140, 152, 201, 125, 120, 12, 215, 253, 66, 97, 143, 158, 191,
+    114, 94, 45, 200, 246, 49, 212, 92, 49, 245, 154, 89, 12, 78, 55, 72, 142, 217, 212, 3, 242, 220, 103, 112, 243, 94,
+    43, 83, 18, 105, 19, 16, 15, 203, 164, 78, 130, 143, 66, 64, 174, 135, 226, 138, 47, 165, 119, 91, 25, 118, 45, 28,
+    175, 109, 146, 155, 125, 152, 159, 199, 188, 184, 219, 175, 228, 48, 173, 110, 138, 46, 169, 114, 239, 223, 174,
+    150, 181, 5, 98, 9, 219, 22, 171, 116, 64, 237, 22, 132, 54, 243, 200, 182, 100, 153, 50, 24, 15, 208, 209, 57, 73,
+    41, 243, 52, 23, 92, 40, 57, 111, 145, 4, 105, 59, 36, 155, 59, 46, 221, 97, 27, 17, 138, 94, 187, 29, 16, 111, 251,
+    221, 25, 181, 188, 191, 8, 55, 198, 244, 25, 250, 98, 142, 226, 29, 175, 102, 79, 82, 173, 53, 198, 51, 211, 187, 3,
+    129, 109, 166, 99, 185, 254, 110, 14, 117, 89, 82, 136, 98, 205, 205, 127, 22, 119, 166, 148, 3, 190, 239, 228, 228,
+    181, 72, 50, 239, 214, 89, 155, 235, 102, 80, 110, 79, 169, 57, 151, 208, 65, 85, 0, 233, 91, 131, 21, 44, 217, 180,
+    86, 8, 245, 54, 248, 206, 31, 231, 52, 240, 236, 108, 117, 106, 12, 67, 137, 207, 129, 63, 182, 78, 147, 10, 16,
+    198, 174, 20, 183, 217, 81, 155, 29, 176, 171, 38, 151, 111, 1, 136, 5, 82, 29, 94, 83, 195, 85, 180, 14, 238, 93,
+    37, 244, 66, 236, 111, 8, 128, 48, 189, 133, 28, 247, 7, 130, 106, 18, 15, 12, 113, 45, 119, 223, 41, 21, 215, 124,
+    152, 81, 129, 118, 163, 145, 37, 216, 97, 50, 136, 33, 44, 163, 98, 66, 218, 104, 30, 51, 37, 248, 216, 104, 23,
+    148, 18, 125, 102, 206, 38, 143, 55, 229, 28, 253, 37, 208, 91, 216, 45, 160, 208, 46, 82, 94, 243, 255, 25, 239,
+    163, 9, 193, 68, 89, 129, 30, 13, 162, 238, 159, 70, 3, 129, 5, 177, 180, 169, 255, 184, 224, 247, 46, 252, 92, 6,
+    180, 189, 78, 212, 124, 58, 128, 141, 5, 95, 253, 70, 195, 70, 12, 243, 106, 122, 137, 80, 223, 94, 143, 142, 30,
+    117, 41, 117, 35, 129, 147, 139, 101, 87, 63, 171, 71, 120, 163, 17, 112, 131, 199, 96, 149, 58, 154, 228, 222, 203,
+    124, 215, 109, 61, 65, 129, 171, 93, 155, 3, 43, 87, 102, 234, 18, 182, 150, 201, 154, 182, 232, 131, 13, 6, 65,
+    192, 35, 84, 102, 201, 73, 210, 78, 197, 159, 13, 72, 56, 129, 2, 138, 251, 142, 51, 13, 187, 160, 130, 39, 254,
+    221, 158, 20, 64, 94, 162, 89, 210, 58, 0, 11, 123, 21, 134, 95, 2, 226, 52, 230, 27, 57, 6, 69, 117, 69, 252, 52,
+    78, 144, 78, 15, 168, 36, 157, 187, 181, 103, 246, 26, 150, 165, 227, 88, 206, 71, 41, 57, 211, 117, 0, 86, 5, 133,
+    77, 129, 127, 19, 222, 59, 170, 180, 61, 113, 29, 13, 245, 222, 35, 56, 74, 203, 46, 187, 71, 51, 247, 150, 73, 51,
+    250, 163, 213, 2, 39, 79, 226, 54, 55, 223, 131, 56, 160, 119, 113, 201, 2, 204, 73, 232, 150, 227, 102, 52, 110,
+    190, 49, 34, 191, 94, 28, 228, 160, 225, 42, 71, 96, 240, 104, 230, 234, 59, 225, 110, 251, 198, 127, 5, 91, 58,
+    118, 84, 15, 187, 39, 43, 143, 191, 247, 174, 134, 80, 0, 117, 53, 235, 86, 189, 144, 64, 26, 188, 74, 31, 106, 97,
+    236, 11, 8, 156, 87, 33, 252, 13, 67, 6, 212, 64, 97, 157, 17, 19, 123, 235, 55, 122, 75, 101, 180, 159, 100, 223,
+    65, 173, 194, 143, 115, 225, 21, 41, 126, 133, 42, 112, 69, 122, 0, 119, 49, 176, 44, 55, 114, 139, 9, 91, 129, 167,
+    20, 173, 222, 121, 48, 49, 187, 81, 204, 181, 121, 30, 7, 14, 28, 152, 14, 247, 118, 68, 53, 30, 226, 16, 70, 114,
+    68, 229, 187, 245, 203, 235, 129, 71, 13, 145, 238, 186, 98, 215, 141, 79, 190, 40, 172, 233, 138, 95, 220, 64, 145,
+    127, 105, 74, 52, 60, 232, 194, 123, 9, 125, 59, 16, 217, 195, 241, 100, 111, 8, 22, 166, 50, 69, 74, 143, 125, 112,
+    111, 231, 202, 36, 217, 74, 14, 109, 154, 227, 34, 172, 246, 127, 69, 185, 219, 71, 144, 168, 217, 141, 232, 164,
+    188, 221, 48, 45, 148, 31, 129, 219, 214, 148, 222, 184, 142, 136, 11, 197, 169, 102, 196, 51, 156, 132, 138, 17,
+    33, 94, 147, 57, 228, 215, 159, 144, 229, 197, 127, 124, 119, 135, 100, 92, 121, 208, 219, 136, 233, 113, 223, 52,
+    240, 106, 211, 4, 110, 167, 217, 127, 177, 241, 6, 8, 78, 252, 6, 24, 1, 55, 189, 147, 214, 80, 46, 93, 26, 220, 47,
+    33, 7, 141, 154, 107, 103, 155, 57, 4, 89, 222, 241, 8, 196, 98, 233, 141, 18, 153, 194, 250, 53, 53, 150, 0, 211,
+    173, 124, 146, 7, 107, 140, 75, 45, 179, 164, 253, 186, 221, 174, 72, 94, 194, 124, 226, 210, 235, 145, 177, 182,
+    82, 128, 93, 238, 67, 114, 85, 245, 237, 19, 59, 155, 222, 184, 110, 89, 190, 72, 115, 120, 142, 177, 151, 114, 219,
+    177, 142, 96, 168, 235, 125, 96, 24, 7, 119, 152, 145, 26, 185, 201, 54, 2, 188, 191, 242, 188, 242, 56, 140, 13,
+    28, 76, 223, 158, 63, 56, 61, 135, 69, 152, 193, 231, 64, 185, 196, 33, 147, 107, 250, 5, 110, 175, 73, 198, 29,
+    222, 167, 213, 157, 39, 37, 206, 136, 63, 133, 14, 131, 251, 251, 159, 62, 7, 35, 73, 190, 216, 135, 159, 229, 212,
+    97, 70, 145, 198, 121, 159, 213, 19, 128, 193, 100, 103, 83, 91, 219, 44, 5, 188, 50, 109, 96, 74, 58, 129, 222, 19,
+    241, 166, 148, 105, 125, 221, 124, 15, 12, 97, 239, 241, 51, 51, 96, 176, 230, 35, 150, 183, 238, 126, 127, 181,
+    127, 148, 184, 188, 201, 138, 68, 36, 58, 91, 251, 101, 45, 148, 161, 186, 141, 123, 23, 100, 34, 23, 112, 22, 51,
+    90, 13, 68, 237, 199, 158, 189, 111, 156, 230, 134, 178, 159, 29, 183, 159, 138, 229, 75, 53, 103, 220, 81, 54, 87,
+    216, 171, 133, 43, 48, 29, 175, 216, 246, 189, 202, 170, 152, 230, 222, 61, 130, 189, 191, 121, 187, 21, 24, 47,
+    225, 194, 195, 162, 44, 31, 213, 113, 222, 218, 37, 31, 233, 196, 0, 224, 208, 104, 28, 110, 99, 127, 182, 118, 155,
+    73, 99, 213, 177, 72, 147, 8, 198, 77, 95, 76, 70, 56, 251, 250, 136, 122, 224, 213, 21, 144, 240, 165, 29, 238,
+    247, 129, 137, 185, 151, 72, 250, 203, 76, 235, 20, 28, 234, 5, 216, 191, 147, 181, 128, 218, 245, 14, 5, 187, 44,
+    145, 101, 21, 172, 185, 3, 90, 94, 71, 96, 171, 231, 43, 18, 208, 86, 214, 75, 250, 246, 238, 112, 94, 78, 188, 171,
+    235, 203, 139, 93, 25, 136, 44, 67, 59, 249, 165, 45, 121, 196, 225, 218, 124, 104, 244, 180, 159, 85, 109, 147, 55,
+    92, 126, 117, 204, 111, 8, 98, 101, 190, 220, 84, 11, 18, 92, 245, 193, 75, 242, 24, 54, 66, 196, 118, 152, 87, 185,
+    112, 65, 102, 84, 175, 115, 46, 123, 103, 154, 55, 77, 236, 7, 38, 97, 10, 149, 52, 198, 136, 26, 90, 185, 38, 171,
+    197, 111, 248, 133, 189, 220, 167, 135, 124, 122, 169, 170, 230, 134, 253, 76, 71, 156, 133, 143, 17, 213, 186, 102,
+    127, 244, 200, 179, 219, 182, 66, 42, 15, 25, 84, 239, 46, 35, 27, 133, 112, 104, 232, 52, 37, 197, 90, 83, 27, 53,
+    79, 104, 149, 230, 72, 101, 0, 213, 46, 154, 20, 226, 201, 189, 200, 222, 158, 146, 239, 98, 176, 164, 44, 169, 204,
+    34, 124, 194, 203, 107, 88, 13, 196, 78, 246, 119, 105, 59, 195, 164, 63, 195, 66, 236, 83, 123, 30, 127, 72, 249,
+    69, 34, 43, 151, 28, 78, 241, 101, 191, 124, 236, 30, 111, 252, 207, 74, 197, 106, 143, 92, 90, 231, 161, 220, 202,
+    30, 119, 46, 119, 245, 85, 40, 40, 217, 63, 86, 4, 249, 215, 65, 228, 120, 164, 236, 155, 161, 173, 209, 15, 166,
+    159, 182, 202, 87, 101, 211, 156, 68, 137, 189, 120, 241, 164, 130, 31, 60, 240, 15, 213, 16, 189, 10, 176, 208,
+    153, 22, 42, 120, 21, 3, 127, 123, 134, 19, 189, 180, 21, 179, 179, 252, 185, 59, 54, 2, 86, 118, 156, 73, 57, 127,
+    222, 50, 228, 95, 87, 146, 4, 33, 68, 93, 1, 146, 115, 60, 50, 62, 75, 189, 156, 122, 145, 27, 114, 223, 220, 143,
+    104, 3, 130, 196, 65, 208, 249, 157, 243, 199, 95, 221, 214, 172, 145, 210, 91, 104, 111, 201, 181, 19, 254, 147,
+    107, 235, 106, 254, 51, 1, 37, 11, 109, 43, 59, 172, 219, 13, 178, 63, 93, 110, 120, 71, 229, 163, 9, 157, 253, 42,
+    240, 91, 128, 35, 227, 160, 49, 195, 29, 153, 1, 237, 116, 185, 14, 209, 120, 136, 112, 34, 173, 19, 67, 56, 193,
+    104, 59, 114, 1, 228, 120, 165, 131, 21, 28, 207, 239, 0, 65, 45, 42, 188, 154, 46, 118, 93, 199, 207, 19, 230, 22,
+    46, 190, 33, 92, 155, 162, 168, 6, 230, 2, 60, 30, 133, 149, 208, 181, 200, 12, 77, 189, 238, 67, 165, 55, 193, 27,
+    130, 222, 240, 143, 169, 3, 135, 135, 59, 195, 66, 37, 108, 119, 203, 6, 143, 201, 29, 119, 80, 195, 100, 50, 165,
+    243, 124, 144, 79, 55, 16, 172, 56, 45, 164, 111, 78, 88, 77, 24, 61, 204, 231, 14, 164, 144, 106, 95, 104, 205,
+    128, 47, 169, 124, 200, 20, 82, 43, 113, 190, 62, 178, 47, 66, 181, 240, 26, 79, 181, 10, 216, 117, 80, 52, 70, 37,
+    135, 45, 161, 14, 227, 61, 11, 12, 162, 87, 168, 194, 230, 137, 52, 162, 58, 175, 1, 88, 98, 126, 199, 28, 253, 141,
+    117, 93, 170, 118, 10, 116, 42, 111, 217, 128, 73, 56, 47, 219, 150, 9, 127, 65, 227, 70, 75, 254, 61, 212, 16, 35,
+    80, 169, 122, 245, 18, 43, 212, 13, 226, 75, 148, 142, 240, 38, 43, 255, 180, 127, 101, 89, 89, 24, 121, 48, 142,
+    21, 178, 77, 207, 197, 211, 110, 104, 237, 154, 221, 75, 111, 26, 74, 44, 25, 235, 250, 173, 51, 170, 85, 1, 242,
+    59, 3, 104, 244, 25, 86, 16, 174, 187, 80, 61, 106, 198, 231, 18, 9, 142, 0, 111, 249, 253, 176, 42, 72, 96, 135,
+    83, 87, 92, 197, 100, 231, 242, 176, 38, 80, 181, 167, 240, 120, 193, 197, 255, 40, 61, 207, 64, 70, 166, 70, 156,
+    63, 218, 180, 76, 208, 206, 26, 71, 77, 168, 200, 111, 155, 38, 48, 95, 34, 55, 192, 139, 156, 18, 133, 134, 34,
+    187, 9, 97, 218, 143, 10, 189, 163, 113, 146, 181, 255, 25, 122, 55, 141, 69, 133, 62, 148, 49, 17, 110, 18, 101,
+    181, 19, 216, 183, 105, 171, 228, 189, 236, 110, 186, 84, 231, 146, 55, 0, 157, 151, 183, 135, 188, 184, 179, 79,
+    173, 33, 181, 0, 73, 106, 23, 243, 140, 96, 65, 47, 149, 111, 135, 147, 53, 40, 110, 68, 253, 71, 104, 254, 96, 87,
+    13, 9, 51, 82, 98, 113, 114, 85, 225, 135, 32, 101, 250, 70, 94, 8, 246, 184, 138, 226, 102, 48, 216, 55, 64, 70,
+    159, 163, 32, 30, 219, 13, 58, 129, 38, 68, 70, 52, 169, 180, 6, 212, 87, 252, 66, 12, 213, 218, 183, 157, 206, 146,
+    147, 24, 172, 121, 16, 70, 86, 166, 213, 16, 151, 126, 236, 42, 223, 184, 186, 8, 64, 237, 244, 167, 45, 16, 93, 0,
+    51, 77, 24, 36, 124, 228, 121, 117, 125, 131, 154, 100, 66, 132, 48, 251, 152, 93, 59, 19, 24, 185, 63, 93, 134, 71,
+    66, 203, 193, 124, 228, 150, 117, 21, 165, 123, 159, 150, 237, 81, 55, 54, 166, 250, 223, 204, 82, 79, 171, 202, 42,
+    164, 183, 250, 230, 139, 217, 216, 77, 66, 166, 230, 187, 108, 44, 79, 155, 31, 247, 17, 191, 163, 104, 62, 74, 189,
+    125, 178, 76, 221, 151, 71, 234, 85, 235, 240, 98, 150, 21, 182, 181, 5, 95, 162, 212, 67, 211, 52, 5, 65, 136, 157,
+    68, 240, 91, 138, 11, 129, 172, 187, 223, 166, 201, 32, 176, 74, 17, 145, 51, 130, 86, 185, 65, 165, 67, 160, 97,
+    237, 196, 210, 17, 184, 252, 165, 142, 205, 132, 13, 39, 4, 204, 248, 226, 195, 141, 159, 29, 217, 174, 108, 23,
+    162, 150, 124, 77, 192, 130, 30, 54, 151, 34, 186, 185, 234, 243, 61, 137, 190, 130, 232, 96, 107, 73, 105, 34, 35,
+    75, 206, 141, 47, 133, 225, 84, 215, 215, 163, 143, 239, 19, 158, 35, 18, 237, 140, 135, 201, 3, 0, 30, 31, 70, 62,
+    175, 156, 8, 101, 124, 194, 21, 37, 111, 31, 66, 79, 69, 152, 172, 8, 174, 35, 104, 29, 140, 104, 132, 204, 80, 15,
+    223, 16, 36, 102, 11, 170, 169, 71, 70, 100, 28, 70, 26, 171, 82, 202, 254, 244, 202, 201, 140, 55, 151, 58, 98,
+    190, 120, 125, 153, 182, 237, 13, 55, 76, 224, 240, 104, 170, 71, 237, 253, 31, 80, 216, 180, 80, 249, 89, 167, 44,
+    226, 197, 102, 251, 227, 143, 203, 87, 98, 101, 70, 151, 146, 56, 10, 155, 78, 103, 40, 96, 250, 171, 52, 201, 11,
+    244, 212, 214, 31, 69, 11, 104, 149, 48, 132, 38, 125, 154, 243, 210, 51, 64, 82, 60, 96, 119, 161, 221, 85, 155,
+    186, 162, 63, 171, 60, 116, 125, 51, 80, 253, 243, 160, 252, 93, 122, 251, 73, 180, 136, 177, 251, 249, 35, 10, 167,
+    255, 21, 149, 222, 88, 213, 105, 118, 90, 122, 92, 221, 206, 251, 223, 121, 102, 29, 47, 12, 243, 141, 101, 43, 59,
+    109, 253, 204, 12, 197, 190, 165, 157, 156, 32, 125, 167, 227, 128, 6, 29, 128, 171, 44, 109, 194, 243, 151, 250,
+    169, 82, 66, 109, 7, 226, 141, 215, 6, 210, 128, 147, 206, 196, 50, 122, 93, 12, 181, 13, 72, 235, 180, 149, 50, 62,
+    190, 205, 145, 112, 9, 106, 103, 166, 53, 195, 247, 204, 65, 123, 109, 3, 106, 49, 90, 100, 135, 98, 216, 215, 16,
+    157, 53, 160, 241, 216, 129, 195, 207, 133, 158, 80, 79, 22, 144, 30, 123, 9, 157, 110, 198, 105, 167, 179, 99, 125,
+    14, 55, 245, 42, 68, 250, 7, 72, 144, 230, 7, 27, 200, 180, 188, 119, 254, 91, 187, 168, 223, 166, 221, 116, 231, 0,
+    143, 194, 11, 66, 71, 32, 190, 236, 133, 198, 55, 238, 167, 121, 150, 100, 59, 59, 123, 58, 48, 234, 153, 24, 136,
+    249, 185, 242, 166, 149, 159, 208, 134, 243, 169, 100, 40, 37, 109, 246, 36, 251, 141, 227, 135, 55, 63, 130, 76,
+    216, 22, 143, 194, 29, 243, 36, 14, 221, 83, 106, 197, 38, 228, 69, 63, 36, 167, 225, 86, 104, 147, 150, 194, 245,
+    130, 74, 253, 243, 34, 76, 23, 63, 212, 130, 240, 122, 56, 57, 198, 230, 254, 92, 8, 8, 63, 77, 94, 45, 183, 101,
+    23, 204, 177, 129, 97, 88, 36, 64, 243, 54, 86, 207, 159, 41, 220, 210, 116, 0, 117, 37, 251, 86, 77, 150, 200, 7,
+    194, 113, 151, 25, 32, 200, 81, 41, 190, 172, 237, 85, 253, 151, 31, 177, 15, 100, 235, 63, 155, 250, 153, 95, 186,
+    170, 40, 69, 0, 221, 81, 79, 3, 74, 152, 137, 119, 224, 112, 175, 106, 78, 182, 164, 116, 71, 114, 82, 171, 100,
+    160, 24, 205, 93, 3, 186, 51, 26, 9, 126, 246, 122, 56, 203, 190, 220, 81, 38, 217, 176, 63, 167, 198, 64, 180, 182,
+    118, 31, 249, 170, 103, 215, 156, 238, 108, 172, 86, 0, 248, 89, 97, 186, 212, 112, 188, 55, 19, 10, 202, 164, 127,
+    223, 25, 26, 38, 121, 126, 87, 29, 215, 67, 216, 14, 218, 191, 61, 150, 155, 132, 238, 95, 116, 21, 161, 28, 183, 6,
+    171, 248, 148, 37, 154, 171, 180, 21, 145, 101, 32, 14, 230, 13, 106, 108, 93, 162, 148, 206, 111, 220, 102, 135,
+    198, 1, 200, 60, 154, 84, 112, 81, 185, 244, 5, 167, 67, 33, 240, 173, 35, 55, 181, 76, 37, 149, 14, 43, 62, 67, 0,
+    101, 71, 77, 126, 182, 175, 37, 99, 100, 216, 114, 72, 104, 127, 181, 115, 73, 168, 245, 16, 181, 181, 18, 77, 255,
+    33, 34, 90, 139, 49, 29, 20, 166, 132, 71, 57, 158, 198, 172, 138, 11, 47, 145, 207, 92, 195, 194, 22, 231, 1, 90,
+    146, 25, 16, 155, 93, 19, 221, 207, 248, 141, 3, 59, 185, 76, 90, 100, 254, 214, 186, 133, 42, 121, 76, 138, 122,
+    30, 97, 116, 129, 151, 21, 224, 206, 209, 124, 60, 76, 45, 174, 165, 113, 86, 2, 136, 155, 90, 43, 8, 154, 253, 208,
+    104, 159, 37, 127, 0, 243, 51, 124, 116, 125, 47, 80, 233, 98, 237, 49, 12, 3, 220, 10, 245, 43, 189, 194, 136, 43,
+    87, 66, 62, 252, 147, 240, 242, 83, 35, 238, 226, 65, 244, 145, 235, 204, 170, 238, 128, 90, 195, 93, 29, 182, 62,
+    104, 233, 186, 135, 45, 24, 159, 12, 32, 35, 100, 250, 147, 49, 73, 92, 223, 145, 87, 243, 102, 224, 38, 214, 116,
+    82, 58, 12, 141, 2, 224, 125, 189, 209, 27, 212, 192, 113, 224, 50, 47, 103, 114, 92, 139, 9, 90, 167, 187, 120,
+    220, 175, 10, 58, 37, 112, 58, 67, 75, 255, 137, 59, 129, 69, 64, 199, 247, 178, 31, 166, 248, 162, 122, 234, 143,
+    36, 190, 102, 127, 49, 13, 98, 246, 66, 15, 11, 137, 37, 41, 117, 114, 186, 107, 184, 225, 42, 21, 223, 24, 124, 14,
+    196, 198, 166, 66, 88, 40, 249, 220, 97, 119, 86, 251, 146, 70, 220, 195, 225, 234, 219, 134, 223, 11, 102, 121, 5,
+    221, 61, 232, 40, 210, 14, 237, 144, 188, 116, 158, 17, 96, 54, 233, 94, 184, 123, 129, 29, 214, 143, 233, 125, 7,
+    2, 254, 29, 239, 117, 7, 17, 94, 94, 40, 248, 92, 142, 194, 250, 232, 49, 232, 135, 26, 222, 253, 133, 156, 119,
+    127, 103, 134, 244, 41, 71, 171, 0, 28, 71, 238, 132, 253, 245, 218, 210, 30, 0, 245, 239, 50, 216, 234, 117, 86,
+    241, 44, 117, 28, 243, 127, 212, 192, 49, 27, 156, 139, 193, 95, 159, 21, 123, 20, 165, 1, 88, 148, 132, 191, 220,
+    145, 68, 77, 224, 24, 20, 54, 232, 37, 87, 240, 117, 36, 10, 104, 7, 27, 228, 32, 250, 11, 171, 10, 99, 168, 62,
+    101, 89, 172, 14, 92, 227, 15, 152, 119, 147, 131, 107, 47, 157, 4, 18, 132, 160, 82, 68, 192, 104, 27, 64, 182, 61,
+    158, 247, 26, 254, 110, 155, 105, 41, 236, 63, 77, 234, 215, 215, 188, 68, 88, 206, 169, 182, 4, 237, 155, 134, 239,
+    41, 14, 28, 199, 161, 189, 149, 253, 162, 127, 135, 109, 65, 192, 71, 102, 154, 143, 184, 159, 96, 77, 63, 204, 34,
+    241, 159, 47, 90, 64, 205, 177, 171, 162, 150, 53, 200, 35, 118, 18, 164, 8, 102, 191, 58, 42, 204, 87, 142, 56,
+    138, 234, 51, 63, 168, 117, 250, 119, 177, 50, 73, 4, 188, 79, 63, 33, 67, 92, 55, 224, 210, 79, 96, 101, 33, 162,
+    189, 175, 185, 110, 254, 40, 30, 78, 226, 43, 223, 133, 160, 77, 153, 226, 157, 42, 236, 250, 165, 130, 106, 20,
+    156, 147, 168, 189, 51, 5, 4, 190, 81, 71, 196, 243, 219, 98, 191, 2, 163, 39, 41, 54, 143, 120, 106, 122, 202, 28,
+    40, 255, 206, 96, 118, 88, 23, 103, 139, 210, 252, 0, 162, 166, 176, 160, 2, 176, 195, 30, 157, 89, 107, 13, 154,
+    20, 112, 224, 152, 223, 37, 183, 208, 164, 168, 197, 255, 39, 110, 192, 37, 187, 136, 40, 27, 252, 96, 37, 40, 6,
+    150, 202, 71, 144, 10, 104, 1, 49, 232, 164, 85, 108, 173, 187, 154, 213, 112, 155, 78, 12, 203, 101, 215, 64, 183,
+    84, 89, 86, 33, 38, 16, 246, 74, 195, 31, 63, 1, 155, 41, 60, 75, 192, 121, 157, 97, 11, 125, 240, 248, 228, 217,
+    181, 20, 174, 128, 77, 169, 208, 5, 69, 49, 189, 107, 113, 250, 179, 4, 49, 206, 167, 232, 57, 67, 117, 27, 231,
+    108, 78, 126, 159, 144, 8, 144, 110, 17, 179, 146, 159, 11, 192, 244, 7, 79, 22, 75, 27, 224, 174, 235, 121, 27, 71,
+    219, 142, 46, 87, 128, 114, 246, 186, 168, 64, 47, 26, 38, 148, 79, 47, 111, 26, 31, 208, 97, 46, 47, 50, 129, 19,
+    124, 1, 48, 190, 253, 45, 141, 112, 108, 148, 208, 236, 156, 209, 66, 88, 213, 89, 243, 162, 209, 48, 160, 69, 213,
+    86, 79, 207, 14, 236, 243, 146, 212, 13, 227, 165, 202, 240, 235, 195, 185, 157, 15, 51, 124, 12, 240, 57, 245, 174,
+    137, 184, 73, 13, 8, 105, 58, 17, 30, 183, 175, 72, 45, 61, 249, 77, 130, 50, 100, 143, 17, 168, 116, 141, 148, 17,
+    245, 208, 16, 165, 68, 151, 88, 15, 173, 143, 9, 186, 14, 211, 223, 174, 130, 199, 142, 147, 40, 57, 243, 82, 193,
+    219, 36, 22, 200, 230, 35, 115, 203, 201, 228, 103, 77, 209, 25, 182, 87, 117, 95, 16, 182, 219, 189, 46, 202, 200,
+    0, 38, 210, 216, 112, 208, 240, 156, 131, 246, 215, 177, 129, 91, 57, 194, 216, 20, 63, 144, 101, 45, 0, 103, 43,
+    96, 56, 141, 11, 33, 229, 161, 149, 107, 212, 83, 88, 172, 61, 2, 224, 188, 40, 224, 223, 25, 137, 221, 131, 171,
+    242, 254, 8, 49, 24, 152, 128, 47, 201, 48, 177, 193, 66, 99, 128, 213, 163, 50, 48, 25, 211, 62, 77, 15, 175, 40,
+    169, 255, 160, 32, 129, 23, 128, 171, 149, 11, 176, 41, 101, 137, 149, 212, 40, 147, 48, 64, 25, 62, 218, 60, 97, 8,
+    207, 73, 96, 3, 178, 203, 226, 118, 47, 22, 172, 133, 109, 180, 13, 141, 163, 96, 159, 22, 236, 137, 177, 168, 71,
+    118, 22, 231, 178, 114, 45, 46, 180, 166, 2, 190, 56, 41, 48, 246, 213, 168, 150, 40, 19, 161, 199, 50, 107, 118,
+    117, 130, 124, 218, 113, 106, 112, 77, 95, 187, 93, 17, 73, 231, 5, 51, 243, 33, 124, 8, 176, 159, 131, 139, 31, 27,
+    104, 208, 22, 103, 108, 18, 177, 57, 135, 239, 199, 64, 215, 190, 115, 5, 122, 116, 141, 180, 204, 5, 42, 232, 219,
+    76, 245, 166, 35, 210, 152, 238, 167, 124, 89, 47, 245, 72, 117, 154, 47, 90, 39, 234, 219, 210, 218, 240, 136, 34,
+    62, 214, 222, 75, 54, 194, 98, 195, 82, 207, 10, 121, 216, 181, 164, 193, 109, 120, 216, 75, 219, 216, 141, 193, 4,
+    248, 207, 218, 181, 168, 182, 149, 16, 99, 36, 180, 145, 212, 2, 172, 233, 122, 39, 80, 89, 24, 166, 73, 246, 73,
+    94, 166, 233, 165, 245, 71, 3, 97, 243, 55, 40, 135, 146, 159, 96, 213, 124, 254, 221, 56, 232, 45, 123, 210, 64,
+    233, 239, 8, 152, 152, 65, 175, 187, 251, 63, 68, 62, 190, 178, 62, 137, 241, 253, 110, 218, 46, 130, 41, 68, 195,
+    247, 192, 21, 232, 164, 214, 214, 248, 240, 113, 111, 215, 115, 160, 126, 5, 214, 97, 194, 206, 109, 230, 63, 135,
+    237, 13, 232, 28, 251, 121, 128, 57, 205, 91, 152, 148, 177, 3, 244, 17, 3, 244, 192, 68, 187, 1, 34, 94, 40, 93, 7,
+    181, 66, 87, 40, 67, 27, 61, 120, 167, 120, 29, 234, 233, 24, 229, 12, 186, 121, 154, 121, 130, 111, 22, 148, 179,
+    177, 77, 211, 95, 165, 7, 250, 244, 108, 190, 124, 32, 162, 89, 176, 195, 189, 40, 253, 159, 77, 232, 74, 80, 89,
+    134, 51, 218, 234, 32, 159, 32, 6, 175, 71, 105, 208, 240, 53, 142, 34, 159, 189, 93, 121, 93, 66, 97, 160, 235, 8,
+    223, 165, 190, 199, 144, 85, 81, 187, 44, 72, 203, 160, 222, 23, 87, 193, 89, 51, 227, 54, 68, 64, 39, 175, 238,
+    132, 103, 75, 14, 165, 224, 183, 227, 22, 24, 197, 97, 251, 68, 27, 142, 130, 154, 117, 125, 148, 99, 112, 87, 254,
+    190, 142, 141, 105, 168, 76, 157, 67, 10, 55, 186, 133, 167, 174, 189, 52, 186, 129, 169, 65, 208, 33, 165, 98, 114,
+    165, 113, 28, 58, 70, 168, 194, 11, 115, 251, 110, 181, 212, 177, 148, 150, 140, 247, 25, 58, 178, 169, 138, 166,
+    116, 137, 21, 235, 77, 86, 43, 169, 238, 43, 170, 11, 160, 227, 221, 190, 91, 73, 184, 184, 190, 199, 71, 240, 185,
+    74, 34, 93, 11, 254, 62, 200, 160, 170, 240, 117, 149, 107, 137, 234, 15, 218, 78, 70, 154, 129, 221, 56, 183, 118,
+    0, 117, 31, 0, 232, 18, 134, 161, 56, 20, 203, 215, 76, 116, 205, 148, 143, 188, 177, 186, 199, 197, 232, 212, 92,
+    108, 251, 63, 84, 176, 152, 145, 246, 170, 113, 184, 146, 111, 202, 146, 219, 69, 16, 241, 11, 124, 53, 71, 17, 108,
+    9, 246, 56, 65, 20, 63, 99, 238, 144, 53, 199, 215, 88, 55, 179, 193, 80, 47, 41, 7, 96, 20, 179, 17, 66, 117, 54,
+    107, 55, 22, 162, 88, 178, 217, 176, 161, 183, 17, 251, 47, 83, 253, 195, 51, 53, 48, 104, 142, 201, 231, 45, 36,
+    154, 183, 195, 41, 177, 12, 238, 96, 88, 202, 61, 25, 19, 117, 241, 21, 103, 231, 70, 33, 66, 164, 5, 173, 9, 195,
+    78, 97, 189, 181, 36, 62, 114, 158, 19, 96, 197, 10, 196, 30, 40, 241, 15, 51, 205, 88, 12, 121, 136, 247, 8, 157,
+    106, 58, 84, 191, 165, 82, 184, 25, 141, 166, 9, 182, 201, 249, 97, 75, 54, 78, 185, 211, 5, 121, 207, 168, 75, 9,
+    39, 237, 41, 36, 168, 227, 114, 102, 223, 255, 252, 39, 28, 124, 100, 176, 139, 199, 52, 255, 188, 160, 183, 98,
+    217, 203, 174, 34, 159, 142, 93, 103, 206, 96, 153, 65, 53, 121, 181, 7, 56, 166, 238, 95, 246, 193, 178, 110, 55,
+    19, 205, 250, 47, 77, 168, 206, 41, 103, 185, 1, 95, 223, 47, 126, 220, 44, 77, 247, 213, 183, 77, 190, 98, 241, 15,
+    104, 245, 187, 232, 145, 164, 16, 42, 246, 202, 142, 52, 160, 38, 39, 15, 208, 180, 204, 145, 110, 11, 18, 219, 99,
+    141, 54, 0, 64, 212, 212, 52, 241, 177, 70, 34, 21, 129, 78, 189, 72, 2, 184, 250, 41, 211, 212, 242, 56, 199, 203,
+    202, 220, 234, 93, 80, 38, 93, 229, 233, 136, 36, 202, 104, 70, 176, 44, 8, 40, 154, 244, 146, 188, 175, 96, 212,
+    142, 37, 161, 78, 121, 70, 44, 108, 184, 25, 30, 112, 132, 234, 91, 217, 77, 11, 44, 135, 80, 186, 226, 110, 104,
+    21, 66, 180, 72, 4, 132, 247, 144, 24, 1, 26, 213, 172, 36, 75, 27, 239, 102, 145, 52, 187, 108, 47, 129, 158, 63,
+    46, 72, 40, 7, 198, 172, 38, 132, 239, 250, 252, 253, 171, 156, 120, 211, 55, 253, 218, 122, 48, 191, 215, 162, 112,
+    110, 244, 81, 220, 196, 74, 135, 180, 41, 71, 29, 98, 231, 186, 108, 10, 31, 240, 181, 238, 219, 53, 81, 180, 107,
+    12, 45, 5, 2, 156, 71, 142, 143, 92, 83, 130, 254, 122, 184, 13, 208, 1, 255, 200, 80, 243, 165, 90, 178, 8, 187,
+    27, 234, 126, 53, 245, 216, 180, 155, 228, 146, 214, 78, 33, 102, 122, 130, 57, 72, 167, 6, 24, 203, 204, 94, 247,
+    19, 142, 37, 30, 220, 38, 144, 172, 141, 227, 213, 191, 161, 243, 163, 148, 172, 153, 79, 169, 55, 136, 158, 41, 22,
+    188, 94, 73, 198, 145, 171, 69, 24, 51, 76, 166, 230, 207, 32, 141, 213, 191, 26, 20, 8, 247, 13, 228, 35, 89, 47,
+    106, 66, 199, 179, 188, 189, 98, 44, 196, 192, 60, 160, 19, 26, 227, 118, 247, 195, 197, 148, 237, 101, 146, 214,
+    138, 119, 210, 193, 140, 253, 102, 136, 124, 29, 70, 64, 105, 235, 143, 217, 150, 27, 4, 30, 179, 87, 1, 225, 29,
+    18, 74, 145, 59, 34, 113, 252, 122, 144, 133, 132, 206, 227, 120, 243, 137, 182, 5, 225, 58, 84, 171, 237, 146, 32,
+    12, 249, 94, 21, 92, 180, 167, 94, 90, 146, 80, 132, 242, 237, 111, 34, 58, 138, 112, 176, 138, 81, 178, 186, 190,
+    206, 237, 203, 133, 138, 39, 188, 97, 28, 44, 46, 10, 227, 131, 163, 218, 209, 23, 137, 190, 96, 139, 114, 84, 53,
+    71, 148, 10, 154, 173, 123, 220, 236, 168, 26, 13, 32, 175, 180, 8, 206, 207, 48, 17, 38, 121, 147, 79, 249, 97, 4,
+    232, 31, 107, 195, 61, 147, 165, 60, 110, 70, 142, 246, 8, 211, 59, 83, 113, 74, 52, 52, 245, 15, 156, 251, 69, 80,
+    166, 197, 104, 83, 107, 42, 54, 34, 1, 24, 158, 17, 25, 109, 41, 123, 1, 97, 217, 238, 41, 242, 6, 155, 147, 188,
+    74, 221, 39, 37, 33, 132, 239, 178, 89, 209, 197, 54, 140, 218, 6, 77, 115, 74, 107, 243, 227, 137, 218, 239, 101,
+    119, 89, 182, 49, 190, 22, 193, 178, 120, 216, 143, 152, 123, 239, 80, 60, 226, 2, 207, 93, 174, 185, 231, 81, 214,
+    143, 234, 16, 137, 253, 140, 237, 129, 253, 152, 17, 88, 164, 156, 30, 39, 197, 5, 133, 30, 87, 126, 204, 234, 32,
+    49, 47, 54, 198, 96, 204, 21, 222, 3, 146, 102, 115, 2, 179, 183, 82, 160, 140, 226, 145, 69, 77, 108, 144, 237,
+    168, 233, 44, 142, 161, 3, 197, 245, 171, 35, 62, 198, 153, 128, 108, 102, 111, 139, 177, 91, 15, 97, 158, 44, 28,
+    91, 101, 30, 248, 155, 167, 106, 8, 238, 27, 71, 141, 175, 205, 103, 154, 191, 96, 113, 86, 108, 109, 184, 160, 78,
+    201, 100, 84, 231, 25, 188, 35, 38, 143, 53, 139, 131, 50, 226, 126, 53, 153, 157, 172, 28, 19, 37, 65, 224, 118,
+    191, 134, 208, 225, 10, 146, 254, 147, 103, 71, 233, 161, 254, 144, 58, 74, 77, 81, 53, 58, 232, 121, 164, 80, 109,
+    9, 99, 123, 234, 222, 1, 187, 182, 101, 102, 207, 20, 85, 195, 41, 115, 235, 70, 224, 104, 191, 180, 120, 122, 232,
+    100, 158, 147, 180, 6, 136, 212, 180, 176, 243, 223, 243, 251, 32, 130, 254, 203, 86, 169, 77, 101, 203, 83, 84,
+    222, 94, 66, 70, 25, 27, 209, 49, 213, 49, 192, 33, 158, 232, 125, 35, 239, 249, 54, 101, 200, 190, 97, 63, 165,
+    241, 38, 244, 71, 112, 255, 219, 214, 7, 33, 255, 231, 5, 167, 30, 117, 198, 252, 162, 145, 118, 120, 8, 179, 4,
+    135, 48, 157, 4, 242, 200, 24, 245, 244, 8, 5, 70, 61, 248, 87, 29, 249, 250, 73, 17, 34, 84, 122, 135, 30, 227,
+    252, 239, 211, 149, 145, 162, 53, 195, 38, 133, 90, 226, 2, 206, 74, 124, 242, 68, 123, 90, 1, 254, 249, 155, 6, 42,
+    34, 117, 92, 41, 177, 182, 236, 229, 27, 92, 166, 110, 9, 8, 229, 92, 81, 32, 231, 46, 92, 188, 244, 129, 179, 238,
+    45, 86, 99, 101, 4, 60, 21, 145, 228, 6, 133, 111, 115, 221, 88, 60, 65, 5, 105, 101, 61, 127, 250, 103, 140, 87,
+    123, 22, 204, 166, 210, 243, 154, 239, 204, 139, 234, 56, 114, 222, 27, 163, 10, 59, 119, 164, 174, 111, 143, 227,
+    120, 235, 180, 209, 187, 195, 7, 165, 35, 62, 188, 222, 33, 203, 138, 8, 115, 161, 94, 113, 97, 90, 207, 156, 67,
+    152, 60, 54, 6, 174, 246, 90, 84, 102, 1, 138, 171, 151, 117, 237, 196, 153, 152, 30, 151, 219, 55, 53, 48, 43, 236,
+    230, 199, 178, 96, 68, 31, 125, 81, 33, 30, 229, 171, 91, 223, 43, 84, 147, 189, 131, 198, 54, 23, 167, 115, 137,
+    62, 128, 70, 74, 159, 67, 60, 121, 254, 37, 129, 175, 168, 219, 194, 135, 174, 103, 50, 29, 199, 237, 131, 96, 82,
+    105, 218, 31, 77, 28, 99, 146, 205, 49, 186, 102, 134, 172, 52, 106, 74, 12, 195, 5, 42, 130, 108, 197, 167, 197,
+    161, 121, 84, 235, 150, 97, 11, 229, 147, 83, 251, 201, 148, 19, 251, 62, 99, 222, 66, 64, 240, 158, 252, 135, 243,
+    95, 73, 237, 25, 67, 12, 145, 6, 232, 25, 194, 19, 180, 94, 63, 82, 151, 33, 38, 135, 165, 114, 50, 9, 128, 15, 89,
+    18, 208, 48, 17, 125, 209, 98, 163, 177, 235, 238, 46, 248, 225, 111, 75, 231, 30, 204, 105, 144, 176, 255, 6, 232,
+    38, 220, 116, 207, 34, 37, 93, 141, 199, 163, 90, 60, 27, 221, 55, 237, 251, 40, 21, 99, 11, 207, 2, 224, 38, 17,
+    76, 91, 183, 59, 197, 146, 162, 99, 248, 127, 252, 213, 86, 103, 56, 195, 114, 90, 99, 24, 107, 158, 61, 148, 157,
+    7, 221, 120, 41, 221, 84, 117, 85, 135, 212, 114, 102, 72, 178, 53, 180, 34, 160, 162, 151, 228, 109, 50, 87, 253,
+    233, 201, 176, 79, 59, 164, 99, 230, 7, 136, 199, 159, 28, 10, 201, 154, 142, 148, 170, 125, 28, 146, 43, 169, 72,
+    247, 176, 94, 204, 105, 226, 0, 235, 76, 132, 115, 148, 119, 106, 97, 243, 255, 165, 110, 141, 251, 66, 136, 109,
+    51, 171, 169, 26, 255, 154, 230, 177, 244, 252, 165, 239, 154, 187, 140, 245, 13, 175, 149, 4, 88, 84, 111, 44, 122,
+    213, 79, 56, 80, 79, 190, 5, 244, 155, 88, 184, 125, 40, 52, 207, 102, 179, 36, 188, 238, 218, 103, 140, 129, 149,
+    178, 194, 255, 168, 147, 140, 83, 44, 82, 230, 71, 58, 53, 37, 122, 183, 243, 105, 238, 209, 137, 43, 35, 248, 77,
+    234, 180, 183, 29, 31, 76, 101, 91, 33, 239, 145, 99, 43, 234, 227, 229, 162, 209, 202, 88, 120, 55, 210, 6, 9, 0,
+    146, 32, 70, 168, 86, 169, 33, 144, 99, 17, 238, 160, 85, 100, 199, 18, 131, 236, 154, 252, 11, 41, 178, 195, 119,
+    10, 101, 248, 252, 43, 209, 97, 6, 149, 41, 226, 209, 219, 116, 13, 67, 73, 227, 248, 14, 82, 242, 197, 241, 68,
+    166, 252, 107, 171, 150, 128, 132, 225, 114, 205, 146, 168, 200, 189, 241, 181, 152, 103, 42, 145, 204, 110, 162,
+    37, 128, 249, 32, 217, 121, 64, 50, 184, 142, 237, 48, 92, 243, 174, 7, 163, 188, 50, 102, 14, 179, 121, 66, 139,
+    168, 93, 10, 163, 132, 99, 36, 206, 87, 200, 224, 215, 116, 141, 66, 34, 103, 63, 16, 4, 191, 123, 53, 129, 189,
+    111, 83, 99, 219, 176, 86, 227, 200, 197, 91, 128, 56, 38, 54, 249, 193, 24, 85, 171, 104, 165, 252, 38, 218, 249,
+    121, 186, 125, 37, 160, 251, 72, 23, 102, 85, 203, 236, 132, 253, 51, 227, 68, 188, 2, 226, 8, 113, 163, 30, 191,
+    118, 95, 145, 222, 62, 79, 110, 145, 162, 144, 45, 249, 178, 236, 19, 41, 217, 137, 251, 98, 242, 84, 53, 160, 80,
+    35, 240, 105, 142, 75, 128, 64, 255, 55, 232, 251, 184, 144, 202, 51, 191, 252, 208, 24, 174, 184, 49, 236, 2, 22,
+    95, 243, 180, 126, 53, 205, 102, 24, 96, 50, 187, 215, 216, 18, 169, 200, 90, 246, 68, 79, 41, 11, 155, 214, 231,
+    85, 7, 71, 4, 92, 242, 15, 100, 228, 43, 55, 214, 170, 155, 62, 48, 125, 1, 130, 216, 228, 182, 176, 190, 131, 71,
+    42, 107, 98, 55, 251, 17, 174, 79, 20, 44, 244, 111, 224, 210, 59, 103, 189, 26, 252, 72, 100, 63, 103, 129, 98,
+    240, 97, 139, 250, 150, 183, 18, 108, 214, 119, 175, 201, 82, 54, 245, 117, 198, 242, 46, 74, 45, 192, 211, 114, 80,
+    77, 164, 90, 239, 246, 201, 21, 250, 163, 100, 27, 110, 87, 76, 46, 249, 91, 59, 23, 94, 105, 156, 246, 188, 67,
+    173, 26, 64, 159, 130, 214, 84, 242, 60, 95, 26, 253, 254, 144, 97, 195, 34, 73, 120, 9, 153, 2, 81, 73, 234, 244,
+    250, 254, 18, 19, 67, 176, 190, 86, 219, 93, 49, 67, 70, 44, 41, 8, 64, 91, 220, 184, 7, 187, 169, 38, 29, 166, 100,
+    63, 110, 36, 124, 6, 193, 38, 98, 101, 65, 84, 135, 95, 19, 133, 156, 141, 78, 59, 102, 191, 103, 199, 99, 13, 206,
+    48, 31, 238, 136, 15, 217, 215, 98, 188, 167, 20, 10, 57, 203, 197, 37, 130, 66, 181, 14, 254, 164, 122, 240, 189,
+    90, 176, 222, 184, 53, 246, 44, 214, 117, 168, 166, 155, 90, 88, 128, 46, 184, 117, 120, 212, 162, 170, 61, 7, 166,
+    162, 156, 117, 222, 172, 237, 158, 3, 219, 72, 41, 82, 107, 122, 187, 234, 243, 174, 188, 24, 208, 187, 184, 31, 59,
+    33, 97, 171, 50, 24, 6, 214, 231, 39, 70, 221, 234, 167, 26, 157, 104, 139, 37, 158, 93, 207, 118, 75, 100, 87, 179,
+    233, 78, 57, 233, 184, 138, 110, 142, 217, 138, 60, 203, 253, 174, 133, 67, 140, 234, 152, 27, 153, 6, 34, 110, 35,
+    96, 248, 123, 45, 55, 240, 207, 190, 207, 136, 174, 11, 138, 111, 172, 16, 132, 157, 220, 110, 153, 239, 220, 144,
+    156, 138, 74, 61, 230, 221, 184, 249, 132, 9, 221, 125, 143, 140, 119, 91, 66, 91, 16, 211, 24, 20, 175, 196, 36,
+    41, 197, 8, 84, 237, 145, 20, 69, 251, 120, 178, 75, 155, 160, 186, 6, 79, 103, 183, 227, 219, 230, 183, 165, 208,
+    36, 79, 180, 210, 83, 160, 221, 94, 230, 92, 184, 189, 31, 129, 4, 210, 12, 46, 164, 127, 159, 230, 159, 236, 72,
+    34, 231, 203, 223, 88, 61, 115, 254, 190, 251, 17, 178, 10, 14, 70, 222, 255, 13, 41, 213, 16, 147, 51, 138, 249,
+    225, 166, 143, 233, 194, 154, 11, 12, 39, 174, 57, 20, 39, 214, 85, 68, 53, 60, 78, 207, 48, 184, 1, 52, 170, 28,
+    122, 190, 143, 103, 237, 31, 202, 140, 194, 45, 56, 96, 20, 19, 3, 221, 40, 101, 154, 18, 209, 21, 140, 149, 113,
+    104, 73, 251, 195, 160, 60, 209, 251, 193, 13, 212, 108, 83, 140, 106, 151, 201, 136, 192, 9, 136, 31, 71, 39, 244,
+    146, 66, 20, 194, 112, 112, 226, 202, 102, 16, 109, 47, 136, 60, 177, 209, 231, 49, 211, 225, 12, 78, 242, 135, 47,
+    198, 10, 16, 194, 87, 28, 192, 206, 228, 125, 98, 245, 94, 81, 29, 209, 2, 27, 122, 58, 196, 71, 41, 222, 196, 70,
+    167, 96, 157, 18, 119, 132, 71, 107, 234, 107, 105, 55, 70, 18, 18, 24, 184, 140, 10, 1, 15, 137, 121, 38, 215, 154,
+    38, 50, 101, 228, 89, 251, 198, 55, 238, 26, 170, 74, 176, 158, 199, 53, 213, 199, 29, 69, 168, 94, 87, 107, 195,
+    151, 5, 121, 38, 165, 173, 101, 15, 130, 186, 165, 35, 126, 164, 206, 245, 48, 240, 153, 57, 204, 96, 72, 252, 250,
+    174, 133, 224, 201, 13, 32, 167, 83, 183, 40, 238, 234, 162, 122, 121, 220, 12, 124, 93, 40, 77, 110, 88, 228, 170,
+    91, 164, 132, 159, 177, 169, 152, 30, 215, 1, 135, 187, 88, 161, 157, 127, 211, 104, 242, 93, 144, 189, 237, 164,
+    32, 222, 164, 23, 237, 89, 122, 68, 105, 196, 157, 67, 28, 228, 72, 43, 208, 130, 143, 29, 4, 153, 188, 186, 14, 6,
+    149, 181, 250, 198, 137, 90, 126, 91, 100, 221, 224, 187, 46, 12, 78, 201, 45, 8, 55, 170, 33, 14, 91, 142, 119,
+    147, 100, 107, 112, 39, 216, 6, 16, 116, 133, 237, 138, 163, 48, 4, 182, 32, 122, 65, 221, 250, 38, 15, 77, 73, 125,
+    95, 143, 143, 234, 122, 6, 125, 160, 253, 116, 239, 43, 145, 19, 153, 83, 123, 51, 209, 151, 150, 146, 118, 219,
+    144, 80, 186, 50, 119, 76, 168, 244, 118, 203, 229, 47, 50, 168, 218, 121, 188, 157, 170, 202, 138, 40, 243, 140,
+    255, 221, 77, 26, 219, 173, 165, 155, 115, 157, 95, 131, 24, 8, 58, 67, 199, 162, 152, 146, 69, 71, 40, 59, 4, 36,
+    52, 116, 171, 108, 187, 240, 73, 76, 229, 166, 91, 149, 232, 66, 134, 246, 98, 193, 145, 239, 166, 222, 202, 93,
+    184, 37, 124, 255, 206, 41, 26, 230, 104, 169, 149, 237, 52, 38, 112, 243, 50, 212, 153, 248, 192, 218, 112, 114,
+    90, 112, 147, 90, 247, 97, 70, 37, 97, 20, 7, 181, 43, 233, 109, 133, 120, 121, 16, 125, 176, 38, 213, 157, 142,
+    126, 101, 226, 231, 134, 243, 97, 53, 249, 206, 150, 90, 126, 155, 64, 133, 161, 16, 138, 73, 19, 134, 174, 133,
+    223, 188, 112, 130, 162, 62, 106, 25, 189, 118, 210, 90, 230, 198, 27, 116, 64, 151, 200, 134, 73, 102, 23, 54, 228,
+    246, 109, 76, 254, 82, 92, 147, 254, 76, 189, 174, 86, 163, 197, 1, 185, 244, 44, 171, 126, 1, 122, 43, 13, 123,
+    206, 73, 14, 201, 102, 23, 58, 56, 218, 49, 208, 132, 131, 186, 118, 239, 195, 248, 159, 107, 114, 209, 180, 101,
+    163, 123, 81, 28, 112, 57, 204, 25, 98, 230, 255, 82, 60, 167, 0, 225, 6, 222, 242, 59, 26, 5, 29, 75, 84, 207, 37,
+    201, 104, 28, 180, 203, 232, 179, 225, 167, 180, 113, 27, 193, 128, 30, 106, 146, 215, 101, 203, 185, 35, 38, 45,
+    102, 241, 171, 72, 93, 38, 89, 223, 57, 70, 5, 254, 165, 105, 190, 153, 11, 81, 23, 214, 239, 254, 40, 84, 148, 218,
+    90, 209, 251, 235, 156, 217, 249, 145, 103, 155, 235, 119, 228, 152, 35, 249, 72, 113, 100, 255, 46, 40, 151, 1, 37,
+    69, 87, 179, 222, 197, 85, 20, 252, 30, 54, 170, 63, 101, 60, 155, 2, 224, 189, 90, 252, 41, 53, 121, 170, 131, 44,
+    135, 122, 139, 203, 79, 204, 228, 121, 169, 183, 84, 246, 107, 77, 181, 56, 200, 108, 167, 152, 35, 171, 124, 254,
+    105, 162, 176, 81, 194, 45, 11, 6, 105, 209, 150, 54, 232, 131, 168, 68, 99, 244, 219, 253, 130, 160, 132, 156, 188,
+    55, 132, 29, 67, 151, 11, 162, 100, 182, 20, 200, 210, 106, 245, 124, 112, 40, 137, 106, 229, 24, 92, 89, 167, 174,
+    169, 44, 151, 129, 5, 31, 251, 134, 108, 205, 6, 188, 218, 47, 181, 132, 110, 96, 242, 241, 194, 248, 124, 159, 4,
+    240, 27, 133, 198, 143, 61, 28, 237, 59, 240, 19, 138, 167, 2, 80, 216, 142, 116, 186, 187, 124, 196, 95, 162, 180,
+    60, 147, 167, 254, 82, 176, 221, 175, 131, 55, 150, 135, 129, 105, 224, 180, 237, 27, 22, 196, 69, 110, 42, 236,
+    196, 23, 25, 47, 240, 64, 80, 214, 10, 151, 209, 61, 65, 159, 136, 185, 110, 36, 65, 139, 59, 146, 86, 146, 16, 18,
+    162, 2, 16, 58, 51, 190, 157, 101, 167, 89, 143, 183, 44, 163, 61, 159, 15, 23, 118, 218, 9, 46, 61, 133, 13, 231,
+    102, 152, 9, 230, 255, 106, 184, 28, 116, 230, 124, 232, 102, 179, 224, 58, 44, 64, 225, 138, 194, 104, 221, 26, 95,
+    174, 247, 30, 110, 2, 138, 170, 56, 68, 251, 135, 32, 199, 241, 126, 202, 131, 42, 13, 234, 170, 237, 114, 165, 158,
+    69, 164, 251, 54, 171, 103, 121, 119, 95, 11, 239, 85, 114, 132, 122, 79, 59, 209, 34, 121, 201, 89, 2, 144, 179,
+    141, 11, 119, 88, 155, 201, 73, 31, 105, 83, 4, 216, 8, 130, 102, 125, 93, 160, 141, 149, 239, 174, 236, 146, 129,
+    114, 119, 51, 104, 132, 17, 107, 244, 47, 57, 219, 206, 146, 12, 26, 206, 120, 86, 162, 62, 10, 208, 177, 97, 155,
+    6, 85, 63, 230, 65, 206, 111, 226, 214, 77, 225, 109, 24, 27, 246, 26, 65, 81, 193, 36, 4, 195, 173, 190, 170, 44,
+    157, 176, 230, 12, 201, 172, 169, 149, 18, 127, 109, 86, 59, 247, 79, 44, 156, 26, 243, 25, 3, 84, 161, 207, 225,
+    66, 101, 36, 172, 78, 100, 85, 254, 24, 119, 63, 245, 55, 77, 209, 173, 191, 111, 102, 235, 73, 130, 250, 245, 252,
+    189, 36, 93, 90, 157, 214, 215, 140, 166, 49, 150, 192, 6, 58, 147, 146, 236, 132, 135, 61, 149, 81, 153, 48, 119,
+    12, 199, 127, 106, 128, 81, 80, 133, 84, 166, 138, 78, 236, 239, 237, 173, 245, 167, 130, 69, 127, 202, 251, 29,
+    246, 234, 80, 229, 229, 23, 177, 30, 226, 135, 212, 176, 16, 112, 28, 112, 53, 189, 177, 239, 126, 246, 22, 118, 71,
+    127, 33, 122, 31, 91, 21, 143, 246, 34, 73, 0, 219, 111, 61, 96, 55, 48, 38, 80, 50, 91, 87, 157, 66, 78, 56, 229,
+    85, 90, 59, 127, 250, 37, 109, 197, 172, 7, 137, 176, 241, 177, 239, 228, 177, 36, 243, 11, 208, 135, 208, 66, 38,
+    84, 42, 20, 65, 143, 110, 19, 85, 242, 200, 73, 43, 133, 179, 143, 195, 109, 41, 56, 204, 233, 30, 136, 81, 88, 119,
+    178, 161, 54, 192, 45, 58, 144, 115, 235, 155, 226, 234, 92, 36, 169, 6, 119, 250, 229, 33, 162, 117, 195, 76, 103,
+    194, 60, 78, 90, 201, 21, 248, 190, 193, 156, 101, 122, 201, 124, 72, 125, 252, 241, 237, 146, 222, 115, 138, 20,
+    177, 153, 213, 67, 238, 134, 13, 218, 165, 92, 29, 192, 0, 184, 131, 178, 153, 217, 97, 103, 105, 180, 161, 79, 151,
+    144, 38, 53, 41, 49, 31, 15, 228, 12, 238, 226, 195, 190, 43, 28, 225, 50, 239, 22, 171, 142, 207, 64, 86, 52, 144,
+    129, 174, 120, 102, 117, 202, 75, 3, 1, 66, 126, 150, 38, 255, 225, 84, 33, 21, 60, 172, 220, 152, 183, 62, 194,
+    219, 136, 54, 133, 27, 158, 9, 140, 50, 91, 130, 49, 137, 146, 157, 34, 7, 191, 46, 126, 170, 45, 103, 69, 12, 166,
+    31, 84, 1, 209, 251, 91, 229, 86, 201, 76, 205, 110, 93, 166, 77, 132, 40, 83, 78, 111, 221, 186, 57, 178, 255, 59,
+    103, 41, 75, 9, 75, 137, 56, 47, 186, 217, 51, 153, 64, 1, 89, 212, 174, 80, 53, 219, 109, 217, 96, 200, 129, 233,
+    231, 81, 42, 71, 112, 189, 165, 20, 162, 174, 34, 209, 19, 0, 116, 237, 114, 197, 195, 189, 180, 242, 152, 49, 38,
+    224, 211, 230, 21, 238, 72, 174, 81, 8, 106, 19, 18, 21, 225, 2, 175, 1, 181, 111, 160, 183, 27, 23, 86, 232, 135,
+    139, 48, 223, 74, 88, 51, 47, 79, 139, 2, 145, 209, 55, 44, 63, 163, 31, 125, 163, 151, 94, 203, 144, 228, 73, 204,
+    35, 97, 54, 171, 83, 25, 53, 65, 108, 49, 175, 195, 92, 169, 0, 250, 156, 44, 167, 45, 161, 224, 182, 132, 150, 112,
+    98, 40, 138, 65, 16, 238, 60, 4, 56, 64, 184, 210, 80, 208, 89, 244, 5, 64, 0, 89, 237, 8, 110, 15, 226, 66, 40, 42,
+    52, 144, 21, 58, 46, 166, 75, 244, 229, 118, 45, 149, 35, 223, 246, 239, 10, 48, 95, 200, 16, 126, 106, 27, 162, 48,
+    67, 90, 231, 15, 83, 148, 45, 154, 116, 85, 134, 206, 107, 96, 124, 27, 96, 52, 152, 75, 96, 8, 47, 250, 227, 78,
+    242, 124, 123, 27, 2, 69, 244, 190, 62, 72, 173, 197, 64, 100, 232, 192, 130, 62, 94, 12, 154, 254, 123, 68, 240,
+    128, 62, 73, 53, 37, 186, 30, 54, 82, 13, 35, 141, 120, 180, 252, 143, 81, 24, 20, 69, 225, 159, 31, 177, 119, 84,
+    42, 240, 152, 220, 53, 110, 72, 182, 248, 33, 113, 95, 215, 107, 172, 118, 198, 43, 253, 254, 100, 185, 146, 126,
+    125, 4, 80, 46, 111, 82, 6, 64, 125, 221, 79, 134, 167, 38, 33, 71, 172, 189, 159, 197, 173, 42, 125, 228, 255, 76,
+    25, 54, 93, 69, 250, 164, 215, 92, 196, 42, 81, 25, 7, 67, 81, 245, 29, 197, 192, 176, 53, 60, 70, 241, 2, 112, 89,
+    207, 146, 62, 98, 234, 34, 25, 17, 157, 35, 6, 209, 151, 153, 170, 118, 106, 201, 174, 57, 41, 240, 157, 204, 142,
+    184, 78, 86, 214, 134, 19, 179, 189, 235, 120, 145, 50, 18, 27, 68, 156, 201, 167, 115, 128, 128, 67, 186, 8, 98,
+    30, 255, 6, 147, 249, 142, 150, 129, 69, 71, 246, 201, 155, 247, 152, 36, 111, 108, 195, 218, 88, 218, 155, 233,
+    237, 66, 224, 146, 162, 182, 26, 139, 201, 253, 224, 49, 179, 8, 158, 116, 94, 208, 175, 107, 38, 92, 70, 55, 38,
+    80, 231, 111, 35, 129, 25, 13, 93, 215, 225, 117, 127, 32, 215, 60, 194, 146, 45, 46, 20, 113, 194, 50, 61, 76, 49,
+    215, 146, 199, 124, 241, 113, 191, 158, 226, 240, 210, 101, 3, 92, 149, 104, 177, 197, 179, 99, 142, 95, 120, 51,
+    190, 11, 75, 155, 23, 143, 107, 198, 127, 180, 241, 181, 81, 211, 230, 102, 171, 150, 122, 123, 50, 22, 118, 124,
+    105, 25, 83, 191, 136, 187, 151, 67, 56, 103, 27, 48, 56, 55, 47, 67, 106, 66, 173, 52, 64, 142, 87, 160, 136, 32,
+    244, 91, 207, 197, 194, 251, 240, 108, 16, 154, 204, 138, 171, 129, 136, 120, 178, 206, 112, 114, 37, 206, 18, 60,
+    202, 87, 243, 107, 255, 214, 79, 210, 19, 220, 222, 158, 171, 13, 225, 166, 22, 115, 172, 22, 215, 115, 229, 232,
+    200, 27, 92, 21, 191, 221, 58, 197, 173, 218, 77, 178, 128, 184, 149, 212, 40, 180, 12, 2, 90, 44, 97, 109, 215, 21,
+    34, 49, 25, 48, 158, 33, 25, 172, 63, 30, 75, 134, 66, 220, 52, 186, 250, 98, 127, 95, 206, 43, 209, 163, 92, 95,
+    233, 167, 164, 149, 189, 255, 86, 87, 22, 36, 116, 102, 93, 164, 10, 172, 126, 78, 54, 134, 17, 69, 100, 135, 193,
+    95, 118, 195, 208, 38, 123, 208, 170, 120, 112, 159, 196, 192, 247, 226, 7, 134, 201, 24, 125, 61, 149, 9, 6, 169,
+    215, 248, 78, 151, 250, 42, 207, 254, 118, 198, 13, 132, 115, 201, 2, 88, 100, 245, 103, 203, 213, 64, 56, 163, 55,
+    151, 79, 127, 86, 91, 220, 204, 189, 101, 43, 89, 39, 207, 189, 0, 138, 38, 248, 87, 249, 75, 201, 155, 55, 250,
+    191, 149, 128, 62, 1, 176, 194, 109, 179, 140, 72, 174, 62, 148, 17, 213, 65, 243, 120, 237, 45, 89, 245, 108, 109,
+    181, 60, 95, 126, 241, 65, 28, 6, 186, 106, 36, 28, 141, 34, 169, 26, 232, 225, 63, 104, 83, 95, 59, 136, 175, 178,
+    41, 69, 153, 182, 157, 218, 92, 209, 16, 113, 127, 141, 108, 104, 180, 180, 114, 185, 80, 13, 210, 183, 213, 181,
+    122, 230, 228, 114, 64, 166, 84, 0, 231, 141, 204, 53, 29, 117, 249, 41, 253, 84, 182, 8, 110, 57, 14, 34, 99, 133,
+    151, 119, 181, 93, 186, 202, 145, 0, 79, 60, 5, 68, 212, 28, 175, 214, 30, 194, 7, 27, 52, 4, 0, 27, 211, 149, 135,
+    57, 56, 188, 102, 193, 217, 239, 242, 26, 169, 28, 230, 236, 12, 51, 74, 206, 16, 215, 127, 129, 179, 137, 50, 93,
+    207, 164, 82, 6, 148, 218, 3, 87, 177, 144, 84, 66, 41, 22, 54, 183, 212, 171, 84, 197, 98, 162, 140, 231, 232, 225,
+    85, 143, 128, 86, 196, 107, 79, 168, 189, 149, 133, 105, 33, 137, 97, 181, 70, 253, 2, 39, 105, 15, 79, 85, 28, 167,
+    18, 66, 163, 241, 19, 12, 57, 220, 26, 194, 193, 73, 207, 152, 132, 49, 122, 184, 4, 186, 213, 101, 248, 87, 41,
+    199, 95, 252, 176, 35, 2, 210, 192, 223, 233, 68, 176, 113, 93, 254, 62, 127, 95, 235, 225, 226, 193, 13, 146, 155,
+    170, 135, 246, 219, 20, 75, 22, 64, 124, 228, 234, 232, 186, 36, 240, 236, 162, 130, 112, 132, 152, 128, 248, 0, 69,
+    204, 235, 70, 91, 226, 143, 128, 11, 60, 122, 91, 84, 242, 99, 129, 147, 192, 176, 44, 119, 106, 198, 208, 37, 215,
+    54, 172, 44, 180, 177, 242, 28, 163, 102, 96, 114, 165, 206, 130, 159, 171, 163, 163, 14, 226, 53, 11, 172, 74, 109,
+    140, 236, 148, 125, 200, 59, 235, 212, 225, 140, 168, 31, 63, 228, 194, 238, 20, 249, 205, 209, 227, 139, 67, 162,
+    146, 222, 97, 65, 253, 164, 77, 169, 36, 84, 160, 92, 98, 120, 127, 245, 16, 69, 33, 44, 101, 188, 179, 102, 69,
+    117, 251, 240, 69, 244, 1, 159, 77, 233, 141, 32, 73, 71, 15, 73, 70, 87, 31, 160, 141, 108, 94, 216, 252, 151, 81,
+    117, 140, 110, 251, 176, 52, 202, 183, 77, 65, 204, 97, 130, 207, 56, 9, 168, 138, 83, 19, 117, 249, 235, 83, 162,
+    224, 69, 222, 110, 123, 38, 12, 117, 229, 238, 114, 46, 225, 196, 194, 162, 1, 165, 158, 245, 126, 72, 236, 200, 95,
+    191, 59, 245, 75, 244, 48, 25, 74, 181, 92, 82, 91, 66, 187, 74, 237, 151, 171, 39, 155, 105, 120, 42, 88, 112, 146,
+    120, 32, 100, 85, 213, 214, 227, 66, 36, 35, 68, 163, 7, 230, 42, 59, 7, 138, 149, 19, 6, 157, 120, 147, 2, 16, 123,
+    60, 174, 187, 28, 67, 99, 86, 97, 191, 120, 226, 243, 3, 72, 146, 101, 69, 6, 174, 94, 159, 255, 212, 242, 74, 65,
+    86, 10, 113, 158, 193, 24, 75, 190, 51, 16, 112, 101, 51, 34, 142, 55, 171, 76, 103, 8, 153, 91, 119, 152, 164, 115,
+    168, 94, 200, 162, 181, 37, 173, 229, 28, 187, 56, 94, 249, 100, 137, 238, 40, 135, 122, 235, 120, 100, 110, 253, 7,
+    38, 109, 48, 49, 184, 147, 52, 18, 112, 90, 243, 229, 29, 240, 77, 77, 4, 162, 220, 12, 124, 174, 217, 209, 138, 63,
+    127, 240, 238, 57, 7, 9, 20, 158, 244, 150, 30, 171, 193, 227, 102, 188, 24, 233, 221, 62, 243, 0, 62, 21, 62, 252,
+    143, 36, 67, 71, 40, 203, 247, 73, 145, 114, 47, 89, 65, 248, 81, 82, 59, 27, 216, 181, 89, 69, 53, 82, 251, 15,
+    133, 81, 240, 122, 17, 239, 18, 48, 53, 10, 107, 97, 65, 66, 222, 204, 204, 193, 222, 235, 149, 9, 176, 114, 162,
+    157, 77, 38, 80, 151, 160, 105, 121, 208, 36, 122, 181, 191, 27, 8, 107, 173, 164, 5, 251, 238, 177, 128, 86, 192,
+    207, 187, 243, 185, 119, 224, 240, 35, 187, 12, 52, 138, 102, 10, 133, 64, 25, 197, 209, 170, 240, 245, 87, 109,
+    232, 236, 160, 242, 115, 138, 201, 16, 249, 221, 211, 213, 36, 82, 208, 104, 31, 17, 230, 236, 207, 253, 138, 158,
+    247, 75, 64, 38, 5, 4, 95, 68, 55, 96, 167, 54, 245, 169, 79, 177, 227, 188, 127, 111, 197, 155, 67, 104, 126, 18,
+    126, 168, 248, 116, 166, 30, 253, 65, 68, 50, 247, 226, 28, 179, 132, 168, 219, 252, 195, 157, 64, 184, 203, 84,
+    169, 60, 179, 205, 181, 168, 216, 206, 130, 171, 138, 23, 163, 12, 159, 226, 213, 243, 27, 186, 210, 123, 73, 19,
+    80, 170, 48, 188, 65, 146, 219, 149, 85, 111, 183, 68, 133, 107, 167, 23, 60, 200, 97, 56, 49, 245, 39, 210, 179,
+    213, 103, 96, 17, 140, 24, 229, 138, 224, 88, 130, 188, 109, 91, 194, 90, 149, 133, 213, 58, 50, 14, 248, 51, 194,
+    70, 110, 175, 58, 32, 212, 18, 139, 246, 122, 17, 250, 111, 227, 122, 22, 225, 204, 131, 107, 225, 226, 245, 106,
+    207, 128, 219, 105, 53, 139, 63, 138, 185, 13, 245, 116, 239, 88, 50, 67, 191, 204, 205, 89, 187, 26, 204, 223, 113,
+    68, 199, 41, 9, 123, 216, 245, 111, 42, 215, 154, 48, 73, 47, 149, 13, 234, 253, 60, 149, 89, 167, 90, 131, 182, 13,
+    67, 55, 2, 223, 106, 60, 194, 201, 203, 114, 137, 152, 7, 23, 124, 230, 149, 175, 165, 148, 90, 203, 162, 151, 23,
+    54, 188, 254, 145, 219, 250, 105, 10, 71, 67, 21, 43, 141, 155, 56, 108, 28, 158, 9, 5, 223, 131, 212, 161, 116,
+    148, 113, 58, 37, 141, 15, 137, 56, 42, 231, 233, 52, 208, 89, 47, 177, 113, 198, 203, 47, 191, 162, 194, 162, 158,
+    243, 133, 48, 110, 123, 254, 117, 84, 213, 3, 54, 149, 21, 125, 38, 12, 191, 110, 119, 196, 150, 56, 48, 14, 13, 31,
+    12, 94, 185, 12, 47, 21, 94, 136, 182, 45, 210, 25, 41, 199, 52, 139, 213, 85, 151, 142, 178, 147, 157, 218, 16,
+    124, 68, 85, 10, 41, 14, 166, 67, 221, 177, 152, 115, 177, 82, 70, 3, 146, 107, 117, 52, 116, 53, 190, 206, 201,
+    222, 5, 181, 233, 208, 17, 96, 137, 107, 105, 18, 8, 69, 155, 40, 133, 175, 123, 83, 242, 42, 9, 243, 90, 140, 84,
+    180, 22, 169, 28, 217, 58, 119, 132, 165, 106, 248, 205, 185, 189, 6, 193, 119, 63, 251, 99, 113, 98, 116, 188, 141,
+    118, 136, 175, 126, 195, 95, 212, 122, 15, 164, 125, 214, 46, 144, 211, 180, 141, 191, 214, 242, 25, 234, 26, 60,
+    71, 193, 242, 69, 88, 239, 69, 122, 95, 8, 41, 28, 103, 112, 93, 113, 123, 37, 236, 219, 59, 38, 84, 44, 217, 105,
+    4, 169, 176, 244, 114, 102, 143, 86, 51, 112, 127, 139, 95, 226, 103, 76, 79, 73, 103, 5, 246, 38, 125, 188, 51, 64,
+    39, 8, 23, 57, 44, 33, 3, 90, 67, 21, 24, 39, 207, 92, 112, 176, 242, 67, 78, 86, 81, 229, 66, 252, 96, 95, 46, 39,
+    113, 72, 56, 208, 182, 189, 194, 108, 138, 63, 142, 123, 89, 176, 83, 174, 90, 21, 105, 120, 159, 82, 83, 106, 6,
+    203, 93, 208, 213, 167, 110, 63, 12, 24, 175, 78, 172, 152, 43, 73, 189, 234, 102, 198, 136, 184, 37, 255, 158, 192,
+    175, 38, 64, 60, 34, 142, 226, 60, 149, 217, 134, 136, 0, 219, 153, 108, 6, 163, 171, 194, 18, 193, 153, 224, 200,
+    25, 112, 15, 158, 75, 102, 232, 130, 147, 76, 2, 21, 199, 234, 213, 238, 75, 12, 36, 175, 113, 93, 126, 150, 237,
+    108, 37, 78, 111, 229, 191, 46, 184, 5, 43, 29, 229, 193, 71, 107, 220, 102, 139, 108, 9, 93, 100, 101, 185, 133,
+    99, 220, 63, 246, 7, 51, 120, 187, 88, 241, 194, 98, 215, 180, 130, 33, 105, 72, 66, 54, 32, 129, 142, 249, 182,
+    141, 143, 102, 236, 199, 158, 5, 13, 52, 198, 24, 122, 194, 25, 202, 180, 98, 3, 111, 65, 171, 180, 30, 186, 169, 8,
+    192, 238, 99, 169, 118, 111, 0, 28, 174, 86, 167, 252, 251, 72, 0, 59, 153, 109, 163, 161, 139, 191, 227, 191, 196,
+    208, 1, 77, 178, 177, 23, 130, 74, 135, 155, 98, 133, 193, 47, 109, 12, 57, 172, 68, 20, 207, 56, 166, 177, 136,
+    229, 122, 59, 188, 154, 31, 32, 120, 100, 93, 2, 184, 17, 26, 64, 137, 6, 247, 114, 150, 69, 178, 58, 236, 66, 109,
+    101, 70, 93, 154, 92, 118, 75, 151, 201, 64, 255, 20, 233, 245, 199, 252, 26, 85, 164, 196, 148, 12, 6, 12, 233, 92,
+    209, 113, 195, 124, 44, 217, 69, 142, 115, 92, 207, 13, 233, 30, 107, 214, 166, 108, 108, 250, 121, 50, 230, 244,
+    192, 191, 86, 170, 175, 243, 128, 134, 31, 121, 207, 124, 83, 249, 228, 4, 221, 24, 18, 4, 148, 162, 234, 121, 50,
+    14, 108, 225, 65, 108, 206, 204, 112, 210, 138, 120, 68, 12, 242, 17, 39, 218, 12, 197, 80, 135, 43, 223, 187, 127,
+    171, 201, 57, 255, 188, 80, 68, 100, 96, 182, 76, 67, 227, 214, 132, 184, 211, 80, 163, 229, 209, 246, 248, 50, 239,
+    19, 138, 125, 31, 227, 15, 180, 39, 68, 88, 234, 188, 235, 246, 241, 188, 80, 33, 220, 168, 144, 127, 37, 236, 146,
+    131, 143, 131, 166, 99, 129, 224, 132, 12, 96, 106, 82, 35, 227, 105, 120, 167, 85, 253, 211, 161, 9, 252, 232, 129,
+    26, 208, 55, 83, 166, 25, 255, 2, 183, 104, 111, 39, 4, 113, 177, 153, 194, 89, 10, 70, 176, 165, 152, 144, 121, 35,
+    152, 98, 123, 80, 67, 111, 134, 106, 238, 60, 9, 82, 232, 16, 242, 51, 102, 138, 198, 40, 3, 154, 204, 43, 88, 22,
+    138, 177, 172, 49, 193, 60, 179, 213, 49, 92, 167, 69, 146, 210, 150, 34, 80, 57, 18, 116, 125, 204, 32, 184, 174,
+    175, 75, 236, 59, 72, 229, 159, 207, 104, 79, 3, 49, 165, 133, 214, 62, 91, 250, 90, 82, 32, 64, 216, 54, 172, 31,
+    243, 7, 247, 99, 50, 132, 239, 166, 81, 146, 175, 210, 251, 182, 79, 26, 26, 215, 116, 213, 161, 200, 192, 19, 16,
+    110, 83, 8, 94, 187, 114, 121, 93, 182, 158, 81, 68, 173, 180, 163, 171, 151, 250, 132, 179, 66, 225, 108, 131, 253,
+    240, 43, 123, 235, 246, 212, 117, 162, 156, 89, 133, 231, 94, 67, 61, 241, 221, 99, 11, 244, 191, 31, 17, 180, 228,
+    83, 6, 78, 26, 117, 36, 108, 140, 193, 137, 241, 166, 98, 5, 237, 251, 0, 166, 88, 197, 17, 226, 6, 195, 7, 117, 31,
+    198, 87, 225, 0, 111, 43, 23, 237, 81, 79, 89, 251, 114, 230, 37, 88, 3, 55, 55, 18, 187, 27, 111, 249, 201, 134,
+    209, 101, 31, 136, 148, 131, 21, 23, 151, 179, 194, 189, 50, 152, 98, 252, 228, 125, 10, 182, 169, 11, 30, 44, 97,
+    113, 177, 66, 243, 2, 136, 127, 156, 45, 62, 255, 247, 50, 217, 13, 189, 31, 250, 143, 215, 72, 222, 158, 147, 12,
+    4, 238, 212, 249, 8, 119, 165, 75, 86, 149, 121, 66, 134, 153, 40, 56, 81, 155, 65, 175, 206, 149, 148, 25, 130, 95,
+    119, 102, 81, 232, 95, 188, 181, 1, 108, 127, 92, 99, 15, 57, 215, 183, 4, 86, 41, 56, 118, 76, 129, 13, 217, 37,
+    203, 95, 229, 172, 182, 88, 220, 64, 104, 23, 154, 145, 137, 220, 96, 5, 38, 111, 13, 138, 206, 62, 134, 39, 139,
+    168, 93, 51, 126, 124, 103, 13, 145, 227, 11, 177, 206, 124, 153, 72, 75, 33, 0, 154, 73, 55, 1, 222, 21, 20, 197,
+    50, 37, 163, 235, 106, 130, 141, 7, 252, 62, 130, 125, 144, 7, 134, 155, 200, 131, 155, 232, 182, 128, 208, 156, 9,
+    245, 158, 181, 84, 227, 201, 207, 1, 101, 222, 97, 3, 154, 14, 231, 126, 58, 153, 166, 25, 137, 120, 118, 177, 149,
+    125, 224, 7, 171, 2, 139, 127, 31, 103, 130, 240, 64, 139, 84, 152, 129, 147, 237, 75, 7, 200, 55, 168, 116, 219,
+    39, 178, 249, 177, 172, 40, 29, 219, 134, 103, 120, 111, 201, 72, 47, 97, 233, 34, 7, 226, 32, 39, 192, 52, 113,
+    109, 230, 176, 208, 94, 21, 173, 98, 6, 254, 180, 48, 159, 44, 61, 10, 201, 208, 175, 82, 87, 212, 208, 70, 104, 78,
+    168, 221, 72, 152, 74, 157, 22, 12, 28, 166, 203, 123, 123, 100, 58, 101, 22, 106, 26, 73, 165, 37, 51, 53, 78, 79,
+    157, 175, 59, 201, 110, 97, 118, 10, 106, 62, 80, 249, 163, 87, 155, 105, 128, 130, 186, 97, 4, 62, 89, 91, 249, 77,
+    36, 74, 193, 100, 186, 155, 127, 156, 252, 192, 135, 171, 83, 220, 234, 252, 129, 149, 106, 115, 146, 68, 153, 200,
+    233, 90, 15, 63, 121, 214, 191, 192, 43, 226, 125, 48, 142, 225, 243, 110, 45, 29, 166, 132, 179, 118, 92, 213, 139,
+    244, 20, 154, 220, 155, 88, 88, 70, 66, 9, 236, 5, 35, 97, 132, 118, 202, 95, 194, 30, 46, 125, 157, 91, 101, 159,
+    17, 19, 195, 91, 34, 114, 208, 9, 76, 227, 55, 209, 15, 115, 71, 115, 194, 15, 10, 193, 33, 206, 135, 124, 85, 5,
+    250, 130, 86, 19, 207, 210, 94, 186, 209, 238, 196, 58, 240, 197, 216, 136, 4, 30, 134, 217, 189, 20, 172, 202, 195,
+    136, 191, 42, 109, 75, 163, 146, 197, 240, 172, 82, 203, 201, 83, 173, 55, 239, 58, 33, 206, 187, 174, 177, 194,
+    112, 64, 77, 15, 227, 223, 226, 76, 84, 158, 225, 193, 27, 242, 34, 39, 248, 5, 36, 200, 105, 50, 193, 16, 119, 101,
+    226, 144, 100, 82, 190, 144, 30, 189, 177, 213, 130, 128, 123, 140, 207, 174, 221, 227, 141, 150, 28, 130, 30, 37,
+    82, 127, 159, 16, 139, 12, 143, 65, 132, 126, 35, 154, 237, 124, 58, 216, 63, 137, 179, 184, 98, 243, 140, 185, 67,
+    250, 216, 178, 112, 90, 133, 87, 131, 47, 114, 152, 0, 170, 143, 100, 62, 204, 136, 34, 240, 118, 249, 76, 233, 242,
+    200, 48, 82, 225, 86, 27, 9, 35, 125, 140, 212, 30, 238, 143, 35, 156, 20, 5, 99, 157, 65, 6, 59, 21, 99, 148, 118,
+    98, 175, 206, 220, 180, 121, 20, 113, 113, 132, 44, 155, 208, 12, 201, 115, 227, 124, 225, 84, 189, 169, 247, 249,
+    232, 243, 75, 27, 79, 103, 6, 105, 96, 204, 117, 124, 125, 147, 254, 109, 93, 144, 15, 231, 196, 26, 244, 52, 150,
+    212, 50, 210, 120, 87, 74, 158, 156, 53, 47, 49, 242, 91, 189, 13, 188, 70, 166, 150, 227, 164, 126, 95, 100, 158,
+    140, 181, 179, 89, 203, 7, 167, 166, 119, 156, 27, 234, 46, 212, 210, 177, 100, 2, 20, 231, 41, 200, 208, 102, 238,
+    96, 9, 48, 208, 0, 55, 36, 236, 118, 153, 172, 36, 3, 239, 215, 29, 112, 132, 81, 190, 36, 93, 26, 85, 4, 1, 136,
+    181, 89, 19, 3, 233, 14, 235, 174, 165, 196, 232, 188, 139, 167, 200, 131, 226, 67, 141, 248, 255, 208, 145, 38, 88,
+    49, 126, 220, 204, 107, 208, 252, 178, 165, 20, 227, 53, 151, 163, 15, 44, 152, 83, 212, 220, 147, 1, 190, 135, 204,
+    38, 227, 156, 91, 198, 201, 7, 46, 42, 244, 252, 123, 209, 65, 151, 111, 112, 35, 155, 90, 84, 3, 179, 114, 131,
+    253, 166, 195, 143, 161, 11, 206, 139, 212, 238, 8, 52, 122, 183, 149, 150, 192, 32, 62, 185, 105, 156, 178, 63, 13,
+    95, 99, 57, 109, 179, 172, 203, 38, 182, 28, 120, 87, 105, 80, 189, 116, 121, 187, 75, 242, 161, 135, 209, 45, 56,
+    239, 82, 187, 123, 155, 14, 1, 177, 60, 79, 34, 112, 18, 117, 40, 117, 77, 101, 249, 87, 143, 110, 145, 102, 95, 50,
+    1, 59, 19, 137, 71, 228, 139, 176, 231, 216, 224, 165, 232, 79, 119, 132, 91, 201, 120, 206, 1, 200, 46, 245, 52,
+    62, 220, 147, 56, 192, 91, 105, 155, 232, 154, 190, 105, 44, 98, 84, 85, 117, 169, 173, 209, 159, 161, 55, 30, 87,
+    93, 131, 217, 157, 101, 36, 37, 131, 223, 95, 144, 111, 48, 66, 238, 170, 120, 44, 246, 54, 11, 34, 125, 223, 253,
+    157, 184, 81, 47, 72, 148, 181, 172, 124, 111, 99, 84, 52, 82, 122, 61, 22, 250, 100, 228, 226, 24, 235, 242, 210,
+    138, 101, 249, 232, 43, 8, 189, 228, 90, 91, 179, 143, 120, 116, 174, 255, 20, 28, 47, 145, 108, 183, 83, 43, 5,
+    234, 35, 225, 161, 50, 202, 122, 94, 115, 78, 126, 81, 152, 131, 76, 171, 68, 44, 155, 176, 206, 30, 122, 128, 172,
+    133, 125, 147, 183, 147, 90, 164, 126, 178, 176, 130, 73, 192, 8, 118, 0, 52, 46, 162, 181, 55, 37, 52, 135, 84,
+    248, 9, 119, 243, 163, 108, 45, 19, 78, 22, 189, 161, 124, 166, 141, 190, 229, 74, 199, 22, 27, 115, 185, 104, 233,
+    221, 210, 124, 234, 38, 66, 238, 94, 215, 158, 239, 3, 88, 249, 112, 232, 20, 195, 135, 231, 160, 37, 5, 213, 15,
+    168, 36, 16, 212, 83, 74, 30, 244, 166, 128, 201, 162, 47, 59, 155, 124, 79, 215, 185, 177, 63, 249, 224, 185, 20,
+    222, 50, 144, 27, 236, 94, 237, 127, 251, 72, 2, 50, 134, 172, 181, 78, 58, 134, 151, 196, 227, 253, 93, 192, 70,
+    140, 249, 8, 36, 40, 105, 183, 165, 107, 30, 21, 7, 217, 60, 128, 181, 221, 18, 191, 158, 111, 222, 1, 186, 226, 23,
+    52, 156, 12, 179, 43, 136, 90, 22, 47, 78, 65, 35, 71, 224, 243, 55, 152, 211, 27, 138, 102, 225, 132, 44, 104, 8,
+    250, 26, 243, 56, 239, 134, 146, 234, 204, 68, 53, 54, 74, 35, 250, 108, 177, 20, 115, 79, 46, 19, 184, 10, 12, 88,
+    96, 220, 226, 175, 170, 154, 18, 148, 172, 215, 252, 53, 45, 49, 67, 70, 174, 95, 55, 189, 208, 217, 26, 141, 183,
+    97, 9, 108, 218, 153, 179, 117, 71, 231, 90, 49, 2, 27, 10, 155, 225, 115, 113, 0, 133, 13, 167, 142, 123, 3, 192,
+    183, 119, 246, 153, 1, 3, 237, 63, 248, 20, 226, 110, 192, 230, 27, 207, 83, 225, 61, 0, 33, 126, 237, 124, 189, 51,
+    126, 202, 224, 71, 234, 131, 14, 112, 3, 19, 162, 86, 189, 90, 4, 97, 83, 183, 100, 29, 180, 244, 90, 43, 162, 72,
+    159, 38, 39, 56, 189, 255, 234, 132, 167, 125, 233, 194, 172, 225, 158, 57, 122, 178, 43, 117, 234, 194, 171, 11,
+    132, 13, 29, 30, 67, 64, 28, 79, 76, 107, 84, 120, 194, 55, 208, 70, 87, 31, 202, 36, 158, 64, 25, 159, 158, 62, 39,
+    113, 226, 48, 69, 214, 171, 234, 116, 147, 10, 24, 188, 25, 11, 141, 66, 253, 224, 65, 149, 186, 40, 32, 150, 67,
+    20, 110, 155, 223, 199, 164, 61, 249, 33, 74, 7, 62, 96, 156, 124, 33, 191, 91, 29, 94, 242, 2, 9, 163, 184, 159,
+    190, 188, 50, 146, 193, 244, 194, 141, 1, 118, 195, 126, 102, 247, 36, 132, 157, 106, 45, 239, 19, 45, 137, 110,
+    148, 160, 179, 194, 235, 220, 101, 129, 138, 37, 247, 94, 37, 223, 211, 50, 214, 185, 205, 254, 42, 182, 70, 241,
+    117, 4, 163, 164, 19, 35, 184, 72, 148, 115, 198, 31, 63, 245, 229, 141, 103, 149, 238, 172, 91, 48, 99, 210, 88,
+    54, 111, 61, 170, 23, 233, 77, 189, 249, 163, 214, 224, 181, 66, 28, 21, 193, 206, 245, 225, 224, 132, 207, 146,
+    228, 196, 169, 138, 50, 15, 95, 191, 47, 72, 207, 129, 250, 23, 46, 230, 254, 81, 91, 225, 81, 142, 97, 136, 218,
+    48, 231, 165, 169, 134, 235, 146, 146, 17, 180, 15, 140, 206, 178, 28, 75, 230, 66, 189, 92, 43, 119, 187, 168, 228,
+    15, 65, 107, 183, 151, 72, 107, 81, 185, 214, 228, 233, 196, 176, 33, 179, 47, 94, 99, 115, 16, 240, 200, 235, 100,
+    37, 234, 83, 67, 109, 147, 100, 193, 95, 243, 62, 114, 35, 185, 151, 4, 69, 35, 41, 90, 10, 153, 251, 216, 102, 241,
+    250, 245, 127, 101, 152, 240, 172, 213, 236, 222, 161, 169, 19, 26, 195, 96, 62, 55, 255, 48, 193, 242, 95, 143,
+    190, 187, 49, 225, 155, 197, 174, 164, 245, 7, 184, 204, 111, 249, 72, 71, 136, 58, 29, 209, 97, 24, 214, 133, 45,
+    209, 200, 21, 151, 177, 214, 129, 77, 246, 0, 212, 230, 110, 1, 10, 188, 207, 92, 140, 22, 8, 13, 64, 95, 33, 204,
+    249, 129, 48, 130, 208, 208, 15, 127, 138, 241, 83, 224, 168, 149, 63, 167, 170, 61, 154, 234, 65, 32, 189, 33, 190,
+    230, 3, 152, 183, 222, 210, 141, 78, 173, 36, 174, 68, 228, 40, 98, 200, 211, 250, 26, 201, 1, 179, 48, 134, 27, 20,
+    100, 48, 155, 170, 203, 133, 159, 48, 29, 24, 137, 18, 166, 99, 124, 248, 104, 221, 73, 151, 188, 207, 198, 58, 68,
+    29, 13, 111, 135, 180, 86, 149, 41, 210, 57, 210, 187, 190, 156, 219, 178, 179, 71, 32, 92, 93, 40, 115, 175, 55,
+    79, 155, 230, 2, 123, 20, 149, 66, 104, 15, 63, 126, 92, 160, 58, 122, 147, 93, 120, 48, 53, 196, 102, 109, 193,
+    117, 210, 77, 215, 214, 51, 228, 238, 133, 240, 117, 14, 120, 41, 207, 39, 159, 199, 198, 182, 170, 38, 36, 126, 13,
+    149, 89, 3, 223, 96, 246, 178, 240, 97, 60, 143, 152, 228, 112, 112, 42, 77, 135, 64, 87, 228, 115, 184, 162, 150,
+    103, 124, 152, 126, 191, 14, 66, 211, 133, 154, 56, 54, 162, 234, 108, 37, 227, 83, 66, 219, 89, 140, 249, 124, 48,
+    57, 34, 94, 77, 66, 189, 229, 197, 45, 91, 26, 213, 171, 52, 94, 141, 52, 27, 64, 121, 61, 141, 140, 96, 187, 194,
+    101, 66, 135, 32, 89, 203, 193, 63, 130, 215, 73, 121, 98, 57, 94, 227, 198, 168, 98, 214, 144, 45, 119, 90, 68, 63,
+    23, 85, 211, 228, 56, 221, 139, 161, 208, 33, 21, 64, 238, 108, 158, 229, 188, 240, 91, 249, 69, 8, 92, 216, 163, 4,
+    171, 105, 140, 252, 186, 35, 163, 234, 103, 250, 2, 165, 72, 196, 191, 191, 104, 15, 25, 39, 140, 33, 0, 28, 165,
+    233, 201, 62, 208, 154, 153, 130, 45, 95, 188, 55, 239, 91, 146, 57, 217, 24, 142, 159, 5, 30, 143, 104, 147, 40,
+    182, 106, 122, 7, 43, 253, 184, 231, 0, 190, 28, 155, 218, 206, 66, 26, 246, 137, 83, 228, 192, 123, 182, 159, 20,
+    88, 129, 176, 147, 3, 251, 252, 130, 36, 84, 26, 57, 204, 156, 13, 99, 61, 224, 188, 229, 125, 169, 220, 211, 170,
+    57, 245, 88, 97, 180, 182, 216, 198, 15, 171, 0, 208, 161, 209, 10, 166, 194, 171, 3, 198, 164, 150, 198, 141, 195,
+    182, 216, 234, 67, 43, 27, 178, 118, 98, 152, 71, 172, 45, 150, 160, 55, 60, 142, 141, 65, 238, 197, 205, 117, 118,
+    172, 38, 228, 180, 197, 42, 78, 98, 220, 60, 65, 74, 255, 142, 39, 99, 37, 243, 88, 137, 136, 173, 18, 53, 68, 172,
+    73, 219, 219, 240, 87, 211, 14, 230, 214, 26, 205, 242, 164, 23, 5, 121, 198, 191, 148, 130, 224, 139, 236, 185,
+    130, 123, 163, 54, 203, 120, 191, 68, 226, 154, 58, 213, 60, 139, 36, 20, 47, 23, 100, 143, 182, 78, 253, 127, 131,
+    17, 195, 91, 206, 138, 48, 149, 187, 141, 243, 156, 139, 249, 181, 172, 247, 93, 118, 108, 250, 191, 42, 173, 81,
+    70, 191, 181, 186, 40, 68, 171, 196, 95, 54, 240, 48, 248, 255, 147, 23, 93, 65, 96, 97, 247, 84, 13, 176, 0, 1, 4,
+    132, 123, 171, 5, 230, 28, 29, 47, 203, 126, 14, 250, 5, 156, 212, 235, 111, 47, 174, 0, 125, 33, 51, 163, 60, 152,
+    31, 217, 74, 120, 191, 242, 226, 204, 56, 92, 144, 100, 61, 44, 20, 82, 196, 25, 210, 151, 88, 32, 194, 135, 35, 22,
+    140, 248, 42, 151, 54, 212, 110, 192, 160, 28, 96, 80, 74, 200, 50, 181, 142, 94, 184, 78, 220, 110, 202, 71, 206,
+    12, 80, 147, 208, 177, 147, 210, 96, 95, 201, 22, 135, 126, 46, 15, 96, 133, 32, 147, 216, 99, 221, 198, 168, 184,
+    110, 113, 68, 62, 89, 146, 52, 57, 111, 103, 153, 10, 247, 160, 117, 59, 236, 150, 199, 183, 249, 238, 53, 221, 102,
+    246, 211, 86, 153, 206, 4, 194, 75, 222, 85, 131, 102, 156, 15, 156, 240, 120, 119, 159, 83, 4, 54, 251, 69, 217,
+    78, 114, 93, 158, 175, 203, 48, 234, 168, 120, 133, 99, 64, 213, 121, 229, 205, 113, 175, 73, 55, 24, 224, 131, 108,
+    71, 179, 101, 165, 18, 43, 17, 33, 93, 103, 134, 56, 243, 134, 174, 226, 187, 40, 125, 152, 18, 47, 96, 32, 92, 48,
+    185, 164, 39, 234, 224, 89, 237, 104, 188, 107, 238, 16, 102, 87, 89, 155, 188, 149, 206, 181, 116, 161, 195, 157,
+    124, 88, 113, 123, 155, 65, 238, 84, 161, 38, 95, 206, 25, 253, 159, 188, 226, 40, 166, 47, 176, 18, 239, 151, 18,
+    34, 156, 40, 179, 102, 158, 146, 87, 24, 185, 203, 60, 215, 22, 136, 169, 95, 109, 188, 112, 155, 121, 161, 101, 35,
+    100, 153, 136, 249, 196, 51, 131, 240, 128, 243, 196, 103, 242, 93, 195, 6, 34, 5, 29, 154, 14, 138, 248, 97, 6,
+    190, 87, 178, 50, 85, 89, 241, 191, 19, 21, 156, 222, 82, 135, 99, 81, 245, 64, 255, 94, 95, 72, 47, 129, 136, 112,
+    4, 19, 119, 91, 230, 71, 156, 28, 185, 228, 212, 16, 148, 7, 140, 109, 126, 204, 166, 99, 151, 122, 136, 94, 71,
+    139, 95, 215, 121, 65, 140, 124, 166, 50, 199, 11, 123, 206, 251, 21, 127, 109, 201, 102, 182, 216, 227, 23, 179, 5,
+    60, 241, 179, 202, 32, 229, 47, 218, 143, 241, 22, 17, 207, 107, 137, 61, 186, 121, 29, 223, 210, 128, 58, 127, 38,
+    168, 96, 35, 72, 86, 151, 201, 5, 228, 136, 212, 13, 124, 228, 192, 155, 127, 206, 81, 243, 229, 17, 7, 239, 58,
+    143, 61, 102, 86, 213, 7, 70, 175, 165, 131, 189, 171, 161, 168, 38, 232, 238, 87, 131, 62, 188, 236, 62, 31, 87, 7,
+    134, 55, 94, 160, 155, 62, 140, 5, 49, 93, 61, 117, 239, 215, 142, 152, 79, 94, 228, 105, 134, 89, 104, 89, 17, 23,
+    215, 114, 156, 0, 212, 112, 22, 123, 183, 255, 161, 200, 173, 251, 31, 147, 31, 110, 5, 29, 173, 104, 141, 130, 87,
+    64, 137, 228, 92, 186, 84, 104, 221, 114, 130, 94, 172, 237, 73, 191, 239, 88, 171, 177, 189, 201, 176, 109, 220,
+    188, 81, 139, 32, 233, 95, 127, 169, 198, 209, 202, 146, 76, 251, 165, 216, 171, 227, 96, 194, 194, 89, 192, 74,
+    101, 118, 155, 26, 7, 208, 206, 33, 239, 254, 122, 175, 140, 219, 154, 61, 60, 174, 218, 85, 15, 177, 156, 249, 49,
+    78, 86, 176, 104, 19, 223, 62, 119, 103, 28, 4, 18, 87, 245, 143, 87, 81, 252, 167, 4, 200, 2, 228, 210, 246, 158,
+    229, 127, 39, 173, 247, 198, 148, 99, 236, 237, 3, 220, 39, 199, 56, 80, 30, 52, 122, 178, 205, 229, 211, 87, 116,
+    238, 167, 85, 0, 52, 16, 191, 203, 199, 168, 99, 208, 252, 238, 57, 103, 46, 32, 93, 41, 95, 116, 109, 48, 114, 70,
+    165, 174, 150, 5, 40, 37, 112, 199, 252, 166, 150, 132, 100, 54, 2, 85, 123, 75, 113, 82, 236, 245, 163, 7, 70, 182,
+    120, 168, 5, 90, 121, 229, 247, 86, 189, 56, 158, 155, 133, 223, 93, 193, 246, 157, 132, 166, 107, 107, 195, 66, 54,
+    100, 235, 98, 211, 203, 210, 150, 157, 238, 5, 59, 124, 142, 197, 112, 6, 131, 98, 79, 85, 162, 242, 6, 168, 253,
+    114, 68, 104, 83, 239, 214, 68, 67, 99, 28, 15, 97, 178, 68, 144, 179, 178, 217, 108, 243, 208, 119, 127, 243, 53,
+    186, 177, 27, 32, 57, 102, 140, 1, 65, 208, 73, 209, 207, 111, 173, 87, 122, 244, 188, 176, 30, 190, 120, 38, 84,
+    214, 42, 201, 64, 97, 240, 218, 228, 107, 167, 184, 246, 113, 38, 102, 85, 66, 185, 108, 217, 108, 36, 229, 162,
+    225, 54, 233, 156, 46, 133, 24, 231, 241, 244, 79, 208, 245, 177, 122, 99, 96, 254, 76, 152, 40, 42, 7, 172, 0, 57,
+    172, 179, 92, 90, 98, 246, 107, 89, 237, 93, 249, 134, 150, 180, 29, 29, 244, 141, 237, 196, 108, 105, 30, 97, 209,
+    149, 251, 45, 213, 107, 139, 218, 139, 104, 39, 157, 46, 126, 49, 84, 211, 147, 121, 117, 111, 185, 86, 213, 135,
+    71, 103, 101, 235, 49, 104, 123, 89, 66, 203, 69, 206, 69, 158, 0, 144, 208, 197, 75, 191, 220, 29, 183, 156, 243,
+    144, 47, 192, 188, 232, 62, 218, 35, 113, 208, 13, 126, 58, 162, 40, 232, 204, 241, 13, 84, 98, 244, 173, 28, 213,
+    123, 147, 198, 244, 196, 78, 61, 244, 112, 218, 116, 38, 59, 85, 177, 115, 130, 17, 39, 102, 32, 144, 139, 192, 159,
+    129, 243, 230, 193, 123, 38, 131, 210, 35, 238, 185, 70, 222, 213, 51, 108, 169, 249, 215, 81, 33, 149, 203, 168,
+    54, 108, 13, 127, 60, 133, 48, 46, 19, 230, 205, 7, 239, 153, 238, 157, 54, 37, 160, 122, 29, 48, 223, 127, 197, 82,
+    110, 201, 42, 138, 69, 213, 55, 28, 223, 61, 222, 222, 149, 196, 250, 2, 1, 120, 220, 138, 204, 156, 204, 183, 77,
+    54, 108, 229, 53, 92, 104, 191, 39, 22, 209, 199, 76, 196, 206, 87, 6, 31, 251, 188, 204, 56, 119, 10, 57, 179, 86,
+    220, 75, 52, 235, 156, 162, 237, 234, 24, 148, 131, 42, 128, 126, 144, 149, 15, 40, 192, 149, 218, 14, 250, 109, 0,
+    119, 43, 229, 251, 125, 219, 188, 101, 26, 45, 238, 158, 24, 178, 228, 206, 166, 132, 197, 101, 15, 131, 114, 170,
+    164, 78, 97, 156, 18, 37, 81, 90, 106, 138, 25, 34, 74, 193, 62, 208, 248, 63, 77, 196, 63, 216, 181, 161, 104, 185,
+    16, 170, 50, 150, 103, 55, 251, 103, 23, 249, 210, 223, 103, 40, 165, 176, 166, 123, 17, 94, 226, 248, 94, 42, 149,
+    216, 124, 49, 9, 205, 245, 71, 41, 14, 24, 17, 191, 171, 213, 119, 198, 63, 85, 212, 8, 236, 179, 172, 59, 159, 145,
+    142, 232, 8, 127, 178, 59, 26, 199, 144, 43, 185, 210, 166, 170, 97, 193, 137, 122, 226, 16, 137, 211, 127, 204,
+    123, 152, 18, 36, 44, 100, 123, 142, 78, 190, 255, 129, 77, 235, 67, 213, 211, 22, 211, 136, 240, 202, 67, 103, 211,
+    178, 215, 99, 182, 35, 207, 181, 244, 20, 103, 50, 252, 101, 174, 2, 29, 141, 53, 50, 22, 16, 24, 186, 179, 173,
+    110, 243, 81, 168, 12, 74, 166, 12, 183, 134, 91, 135, 41, 88, 101, 95, 240, 163, 239, 102, 42, 131, 114, 126, 153,
+    69, 62, 114, 113, 82, 22, 214, 121, 184, 19, 153, 58, 31, 61, 200, 179, 65, 146, 157, 25, 131, 143, 34, 45, 85, 244,
+    85, 117, 6, 239, 236, 134, 3, 188, 183, 195, 202, 82, 202, 33, 138, 174, 230, 107, 48, 27, 203, 197, 251, 131, 221,
+    202, 107, 28, 180, 151, 182, 4, 220, 67, 39, 224, 245, 7, 135, 79, 26, 97, 99, 132, 183, 174, 18, 211, 208, 34, 218,
+    22, 250, 114, 205, 37, 203, 200, 244, 129, 102, 112, 117, 213, 90, 239, 253, 151, 189, 170, 227, 84, 198, 53, 0,
+    237, 99, 81, 90, 200, 118, 34, 76, 109, 59, 68, 8, 195, 135, 206, 18, 146, 74, 63, 166, 104, 79, 187, 102, 204, 238,
+    122, 25, 125, 252, 31, 210, 1, 56, 230, 251, 65, 6, 54, 38, 22, 250, 191, 71, 26, 9, 24, 125, 47, 111, 64, 241, 47,
+    185, 36, 41, 104, 242, 25, 65, 152, 76, 119, 91, 91, 106, 171, 213, 94, 111, 105, 36, 8, 171, 63, 133, 198, 65, 140,
+    127, 30, 223, 140, 180, 7, 69, 129, 38, 75, 68, 245, 179, 43, 56, 186, 209, 186, 239, 35, 72, 113, 74, 142, 108,
+    239, 107, 223, 186, 96, 107, 241, 122, 176, 98, 53, 201, 137, 222, 114, 142, 54, 156, 204, 152, 252, 218, 251, 151,
+    71, 249, 220, 191, 97, 59, 58, 131, 42, 214, 211, 173, 1, 78, 125, 78, 14, 207, 179, 72, 159, 85, 35, 168, 179, 24,
+    137, 72, 196, 185, 16, 213, 135, 192, 217, 114, 149, 248, 117, 172, 111, 194, 40, 247, 107, 213, 136, 57, 128, 232,
+    220, 187, 191, 0, 88, 152, 136, 94, 205, 211, 184, 155, 42, 216, 128, 250, 130, 146, 214, 37, 151, 224, 125, 114,
+    146, 28, 54, 10, 113, 196, 197, 234, 42, 110, 12, 33, 34, 57, 138, 90, 152, 234, 197, 204, 82, 51, 32, 92, 238, 125,
+    200, 101, 205, 36, 154, 138, 78, 139, 71, 119, 51, 91, 46, 57, 252, 195, 188, 248, 164, 43, 224, 140, 220, 23, 242,
+    184, 204, 189, 57, 83, 34, 109, 172, 183, 12, 95, 11, 113, 190, 199, 212, 115, 49, 42, 183, 15, 238, 47, 28, 131,
+    163, 109, 27, 28, 230, 171, 189, 14, 53, 178, 195, 192, 162, 23, 125, 147, 252, 232, 149, 88, 80, 158, 236, 134, 43,
+    164, 106, 206, 228, 187, 189, 136, 25, 146, 135, 132, 177, 2, 180, 241, 48, 247, 134, 16, 193, 217, 228, 123, 160,
+    158, 5, 180, 32, 69, 39, 69, 163, 144, 14, 211, 34, 72, 26, 72, 25, 194, 229, 160, 173, 247, 30, 29, 59, 13, 231,
+    69, 87, 190, 142, 164, 30, 84, 76, 68, 132, 100, 248, 46, 1, 59, 5, 36, 89, 15, 71, 5, 111, 140, 101, 104, 183, 182,
+    121, 199, 210, 69, 147, 97, 27, 7, 166, 195, 43, 39, 123, 103, 131, 246, 153, 110, 193, 82, 151, 46, 103, 126, 214,
+    57, 50, 94, 177, 12, 169, 153, 20, 194, 10, 255, 103, 13, 220, 199, 206, 231, 43, 159, 47, 14, 44, 163, 180, 132,
+    209, 80, 129, 90, 64, 214, 78, 232, 120, 220, 52, 164, 164, 245, 236, 186, 62, 156, 161, 68, 226, 71, 62, 43, 132,
+    143, 237, 25, 243, 154, 9, 123, 55, 242, 100, 6, 138, 157, 85, 159, 17, 154, 17, 46, 115, 227, 140, 250, 24, 89,
+    187, 248, 146, 215, 173, 224, 82, 251, 140, 115, 245, 36, 195, 27, 25, 212, 243, 122, 123, 118, 236, 65, 231, 196,
+    233, 150, 247, 42, 8, 254, 146, 36, 204, 156, 93, 41, 64, 61, 250, 40, 213, 35, 233, 9, 235, 150, 178, 48, 211, 72,
+    148, 15, 178, 125, 155, 249, 214, 94, 130, 232, 176, 76, 125, 24, 138, 110, 158, 120, 173, 64, 242, 23, 224, 175,
+    18, 111, 136, 46, 162, 128, 128, 204, 65, 166, 16, 74, 185, 65, 198, 76, 8, 108, 13, 8, 5, 235, 133, 131, 250, 153,
+    244, 70, 162, 223, 227, 192, 198, 24, 73, 14, 77, 109, 26, 40, 203, 249, 255, 96, 116, 176, 187, 103, 223, 248, 133,
+    202, 34, 111, 202, 198, 23, 196, 32, 106, 123, 99, 77, 94, 173, 71, 167, 183, 183, 201, 47, 232, 175, 50, 31, 213,
+    142, 80, 22, 232, 254, 76, 101, 248, 110, 99, 63, 30, 166, 91, 95, 109, 121, 60, 67, 249, 224, 124, 88, 134, 236,
+    31, 251, 169, 189, 11, 149, 152, 95, 12, 209, 156, 211, 37, 49, 178, 255, 67, 71, 149, 11, 231, 142, 207, 201, 71,
+    103, 95, 81, 218, 87, 46, 114, 41, 218, 171, 241, 136, 195, 2, 89, 205, 7, 104, 146, 64, 67, 164, 71, 58, 210, 58,
+    47, 122, 92, 154, 179, 223, 96, 140, 234, 125, 227, 136, 177, 6, 19, 11, 241, 121, 169, 244, 96, 56, 161, 39, 151,
+    27, 196, 221, 173, 251, 216, 76, 119, 209, 182, 17, 127, 36, 235, 186, 147, 104, 120, 59, 174, 106, 169, 156, 111,
+    205, 9, 154, 252, 252, 190, 21, 245, 113, 93, 227, 130, 230, 185, 15, 104, 206, 42, 61, 15, 210, 231, 16, 159, 139,
+    147, 99, 122, 191, 207, 233, 70, 102, 241, 203, 217, 170, 189, 45, 14, 77, 146, 83, 118, 236, 170, 162, 48, 31, 195,
+    54, 201, 24, 64, 147, 219, 97, 160, 226, 25, 29, 210, 43, 25, 172, 18, 225, 83, 134, 16, 90, 197, 225, 162, 164,
+    238, 220, 172, 58, 11, 165, 181, 59, 193, 49, 43, 147, 77, 23, 216, 251, 250, 17, 134, 47, 147, 113, 60, 251, 3,
+    177, 132, 157, 5, 73, 219, 107, 183, 72, 105, 169, 50, 39, 188, 186, 199, 162, 111, 224, 240, 233, 162, 114, 9, 161,
+    47, 46, 153, 60, 195, 67, 227, 208, 33, 76, 50, 131, 24, 56, 66, 207, 157, 18, 223, 145, 15, 20, 221, 6, 19, 160,
+    99, 171, 173, 227, 52, 190, 167, 113, 151, 13, 189, 59, 159, 223, 249, 0, 141, 229, 87, 8, 108, 9, 202, 229, 153,
+    207, 240, 243, 43, 226, 98, 240, 116, 171, 49, 182, 25, 229, 243, 232, 222, 139, 36, 181, 87, 20, 70, 0, 136, 30,
+    222, 1, 255, 119, 4, 30, 25, 198, 106, 101, 201, 41, 197, 116, 16, 151, 216, 176, 7, 198, 235, 252, 141, 152, 150,
+    169, 168, 165, 63, 215, 113, 21, 208, 79, 205, 241, 143, 76, 131, 52, 55, 220, 4, 201, 174, 74, 173, 8, 248, 246,
+    186, 97, 161, 120, 190, 112, 30, 88, 83, 212, 255, 39, 151, 104, 107, 120, 3, 49, 60, 82, 134, 210, 2, 13, 181, 141,
+    89, 9, 182, 86, 27, 206, 56, 38, 190, 161, 230, 67, 163, 224, 145, 57, 234, 242, 35, 12, 55, 223, 219, 110, 242,
+    133, 212, 105, 16, 102, 100, 148, 146, 232, 28, 210, 88, 8, 166, 219, 44, 230, 141, 221, 103, 5, 10, 164, 54, 189,
+    235, 151, 111, 205, 223, 218, 243, 63, 101, 71, 99, 39, 53, 149, 244, 225, 89, 194, 195, 148, 220, 112, 204, 3, 251,
+    166, 126, 78, 102, 210, 237, 102, 236, 70, 128, 165, 194, 168, 240, 48, 36, 212, 246, 248, 165, 140, 232, 4, 32,
+    239, 194, 160, 76, 230, 67, 227, 25, 203, 216, 70, 71, 17, 33, 9, 150, 192, 137, 128, 187, 216, 38, 91, 76, 68, 39,
+    118, 90, 131, 92, 198, 96, 84, 133, 230, 92, 229, 96, 134, 238, 163, 38, 125, 76, 156, 37, 134, 147, 226, 87, 22,
+    246, 73, 80, 231, 163, 217, 179, 172, 224, 5, 232, 246, 154, 20, 130, 84, 53, 121, 247, 11, 102, 115, 248, 4, 150,
+    88, 44, 33, 85, 31, 91, 112, 96, 62, 202, 121, 52, 144, 121, 204, 172, 194, 248, 193, 181, 60, 5, 19, 71, 186, 223,
+    1, 67, 19, 138, 9, 36, 111, 114, 75, 254, 147, 136, 188, 82, 46, 101, 21, 46, 190, 75, 43, 44, 41, 183, 153, 192,
+    210, 86, 176, 159, 156, 225, 20, 35, 90, 212, 168, 102, 230, 208, 80, 128, 77, 77, 249, 11, 206, 23, 235, 204, 171,
+    39, 197, 9, 94, 217, 234, 185, 16, 66, 245, 147, 27, 143, 16, 84, 29, 240, 165, 14, 164, 122, 27, 247, 118, 150,
+    179, 36, 153, 68, 133, 130, 227, 211, 242, 13, 154, 171, 2, 33, 77, 231, 189, 103, 91, 210, 65, 136, 165, 14, 213,
+    247, 69, 183, 35, 247, 96, 181, 200, 246, 118, 119, 93, 98, 24, 242, 151, 106, 200, 35, 228, 84, 162, 216, 114, 0,
+    30, 150, 10, 252, 165, 43, 107, 238, 146, 136, 184, 97, 179, 174, 148, 121, 189, 210, 116, 54, 24, 93, 206, 40, 90,
+    39, 178, 78, 193, 86, 166, 71, 200, 165, 253, 74, 122, 32, 19, 184, 204, 137, 77, 77, 94, 88, 142, 181, 175, 183,
+    193, 62, 99, 11, 172, 206, 189, 222, 5, 128, 16, 138, 90, 153, 225, 25, 114, 34, 164, 197, 135, 206, 57, 223, 68,
+    42, 68, 150, 49, 80, 95, 176, 16, 116, 36, 43, 116, 43, 141, 56, 96, 33, 168, 74, 157, 214, 51, 102, 53, 47, 253,
+    128, 152, 104, 19, 209, 254, 120, 207, 204, 31, 93, 128, 25, 151, 121, 42, 251, 236, 2, 40, 150, 118, 216, 40, 169,
+    162, 44, 78, 15, 45, 223, 173, 10, 144, 15, 97, 24, 124, 182, 23, 29, 137, 225, 138, 125, 232, 223, 12, 77, 232,
+    107, 152, 145, 127, 26, 116, 217, 63, 81, 135, 207, 57, 138, 129, 176, 154, 187, 120, 65, 121, 187, 87, 237, 208,
+    233, 44, 82, 111, 68, 255, 105, 67, 31, 107, 93, 44, 231, 131, 131, 211, 224, 0, 226, 159, 72, 229, 75, 186, 65,
+    183, 144, 238, 149, 195, 253, 168, 200, 214, 231, 66, 152, 18, 40, 213, 7, 106, 205, 26, 103, 157, 241, 62, 146,
+    117, 25, 138, 10, 101, 88, 77, 104, 194, 18, 211, 194, 254, 224, 11, 153, 94, 175, 79, 0, 187, 102, 128, 2, 9, 30,
+    69, 160, 174, 34, 115, 1, 159, 37, 175, 141, 105, 165, 83, 212, 21, 14, 46, 193, 211, 195, 255, 230, 49, 134, 18,
+    147, 166, 187, 27, 230, 114, 109, 200, 140, 169, 197, 162, 63, 2, 249, 21, 148, 182, 115, 182, 232, 22, 84, 107,
+    243, 253, 221, 242, 179, 80, 161, 171, 172, 180, 35, 87, 66, 59, 220, 25, 200, 33, 218, 178, 186, 19, 27, 96, 155,
+    201, 104, 94, 145, 188, 154, 0, 45, 228, 118, 98, 149, 37, 207, 242, 90, 182, 209, 51, 53, 184, 75, 103, 36, 220,
+    247, 180, 3, 234, 214, 126, 92, 124, 119, 226, 83, 194, 79, 205, 107, 28, 44, 38, 84, 86, 85, 11, 0, 224, 177, 231,
+    119, 64, 39, 159, 176, 87, 60, 40, 189, 236, 213, 42, 140, 178, 117, 91, 200, 76, 32, 105, 232, 90, 43, 133, 67,
+    193, 207, 198, 87, 161, 234, 205, 46, 135, 25, 199, 191, 250, 128, 46, 150, 161, 191, 234, 106, 128, 178, 239, 191,
+    139, 215, 216, 179, 130, 213, 163, 19, 149, 248, 236, 208, 151, 76, 238, 76, 37, 186, 236, 151, 195, 192, 88, 234,
+    110, 149, 47, 16, 27, 0, 30, 235, 185, 246, 201, 169, 48, 30, 125, 19, 58, 83, 129, 236, 227, 118, 62, 91, 157, 117,
+    109, 214, 120, 153, 17, 141, 217, 142, 183, 196, 17, 250, 226, 57, 223, 102, 110, 93, 30, 232, 169, 253, 37, 133,
+    11, 27, 116, 65, 158, 113, 179, 165, 96, 159, 204, 115, 182, 147, 101, 251, 53, 127, 77, 12, 4, 16, 223, 120, 16,
+    113, 107, 51, 18, 239, 165, 224, 172, 109, 255, 18, 34, 51, 181, 44, 49, 26, 217, 214, 78, 16, 60, 215, 173, 184,
+    185, 150, 94, 125, 200, 34, 217, 20, 18, 243, 227, 196, 197, 107, 158, 102, 44, 83, 114, 67, 118, 85, 119, 170, 126,
+    49, 45, 34, 6, 190, 105, 24, 74, 31, 166, 228, 163, 95, 14, 105, 116, 22, 58, 37, 114, 129, 140, 230, 66, 230, 48,
+    156, 100, 247, 175, 12, 27, 103, 254, 99, 151, 194, 99, 154, 55, 198, 80, 36, 120, 232, 204, 63, 199, 178, 102, 24,
+    104, 49, 247, 223, 169, 164, 179, 57, 53, 204, 156, 202, 25, 120, 166, 85, 14, 75, 211, 231, 244, 109, 1, 11, 47,
+    93, 189, 232, 111, 79, 163, 34, 229, 9, 169, 223, 254, 221, 115, 245, 103, 35, 239, 42, 88, 205, 55, 3, 205, 96, 11,
+    50, 70, 252, 10, 229, 145, 246, 163, 208, 74, 104, 244, 10, 125, 7, 32, 34, 113, 171, 22, 136, 27, 252, 191, 50,
+    254, 115, 57, 70, 191, 92, 200, 154, 253, 65, 187, 56, 92, 21, 125, 97, 68, 118, 183, 43, 251, 89, 119, 141, 216,
+    56, 203, 45, 215, 85, 1, 124, 72, 98, 66, 82, 95, 15, 176, 45, 221, 174, 48, 167, 88, 169, 252, 224, 54, 178, 15,
+    48, 22, 8, 132, 41, 214, 91, 95, 44, 57, 207, 183, 52, 143, 51, 13, 169, 37, 44, 140, 121, 110, 21, 43, 75, 196, 28,
+    187, 189, 208, 132, 132, 161, 51, 232, 136, 251, 191, 0, 188, 95, 235, 81, 204, 172, 71, 122, 180, 174, 168, 227,
+    239, 72, 123, 157, 20, 0, 148, 61, 79, 138, 173, 217, 175, 17, 193, 99, 6, 147, 137, 189, 99, 139, 147, 41, 73, 154,
+    67, 210, 164, 11, 239, 180, 1, 8, 178, 39, 248, 103, 189, 105, 222, 31, 177, 132, 50, 134, 21, 226, 230, 57, 116,
+    251, 26, 170, 163, 122, 23, 33, 85, 26, 206, 112, 105, 21, 202, 213, 99, 22, 158, 207, 6, 183, 177, 49, 50, 238, 97,
+    201, 61, 86, 104, 175, 66, 84, 22, 88, 47, 183, 143, 65, 180, 177, 37, 169, 125, 19, 218, 161, 52, 117, 237, 181,
+    100, 40, 38, 150, 240, 204, 55, 138, 44, 148, 31, 180, 23, 208, 195, 35, 141, 5, 218, 192, 84, 8, 52, 26, 23, 103,
+    93, 244, 75, 210, 251, 53, 74, 6, 221, 248, 207, 119, 8, 80, 158, 68, 105, 21, 246, 0, 126, 104, 248, 162, 177, 226,
+    48, 28, 82, 92, 40, 40, 109, 127, 27, 143, 84, 113, 95, 11, 226, 121, 148, 54, 10, 147, 244, 248, 232, 80, 202, 233,
+    255, 113, 238, 236, 245, 166, 255, 253, 171, 83, 85, 103, 26, 131, 230, 48, 167, 146, 60, 96, 166, 251, 109, 54,
+    243, 39, 207, 85, 72, 206, 249, 93, 116, 181, 189, 21, 60, 230, 183, 35, 7, 170, 197, 138, 228, 170, 39, 117, 92,
+    119, 85, 247, 78, 198, 241, 221, 179, 14, 58, 254, 74, 167, 249, 47, 117, 111, 120, 209, 240, 22, 27, 207, 219, 176,
+    18, 131, 57, 183, 176, 1, 223, 112, 145, 165, 75, 181, 145, 59, 132, 24, 1, 134, 23, 66, 45, 234, 12, 16, 77, 164,
+    184, 16, 86, 141, 176, 39, 22, 36, 198, 53, 126, 177, 247, 162, 1, 255, 63, 29, 111, 151, 156, 169, 198, 31, 27,
+    151, 73, 87, 147, 213, 50, 129, 38, 242, 9, 28, 213, 149, 104, 192, 107, 71, 177, 36, 136, 14, 71, 242, 40, 178,
+    191, 78, 173, 142, 41, 105, 53, 102, 172, 153, 34, 220, 36, 52, 230, 198, 151, 101, 48, 159, 83, 160, 171, 39, 143,
+    112, 131, 98, 201, 78, 237, 244, 156, 35, 135, 164, 92, 56, 249, 111, 193, 240, 124, 56, 47, 182, 104, 114, 226, 49,
+    17, 138, 14, 30, 40, 117, 246, 113, 83, 199, 50, 10, 140, 218, 195, 13, 47, 133, 8, 68, 65, 157, 195, 163, 227, 201,
+    24, 40, 96, 52, 23, 123, 202, 81, 221, 75, 134, 148, 108, 121, 94, 192, 234, 77, 31, 55, 250, 229, 24, 201, 218,
+    167, 215, 97, 77, 111, 93, 203, 248, 160, 118, 136, 218, 90, 198, 111, 123, 250, 3, 24, 141, 52, 115, 140, 155, 179,
+    47, 196, 182, 230, 9, 94, 137, 43, 209, 69, 93, 239, 248, 4, 27, 97, 188, 231, 111, 108, 93, 224, 235, 116, 222,
+    158, 31, 2, 83, 178, 17, 239, 21, 26, 116, 79, 65, 76, 142, 27, 201, 104, 93, 92, 2, 128, 169, 41, 108, 167, 63,
+    153, 29, 105, 181, 4, 139, 147, 89, 245, 6, 163, 74, 158, 104, 219, 131, 243, 165, 33, 80, 86, 65, 238, 248, 133,
+    42, 106, 138, 2, 109, 107, 112, 186, 164, 98, 66, 38, 126, 95, 24, 193, 25, 188, 206, 156, 182, 223, 210, 180, 81,
+    156, 156, 13, 90, 48, 158, 216, 103, 51, 5, 142, 76, 25, 216, 109, 5, 101, 108, 78, 100, 115, 112, 111, 115, 8, 202,
+    251, 44, 70, 38, 209, 240, 17, 62, 195, 213, 200, 195, 56, 84, 42, 133, 215, 70, 172, 48, 76, 167, 30, 196, 247, 71,
+    30, 62, 73, 87, 2, 33, 164, 123, 4, 124, 95, 235, 176, 200, 181, 156, 116, 162, 142, 172, 106, 149, 62, 172, 238, 1,
+    148, 229, 193, 203, 243, 156, 134, 123, 217, 187, 248, 136, 76, 203, 78, 41, 168, 192, 194, 178, 203, 6, 239, 16,
+    236, 113, 4, 232, 20, 225, 92, 191, 94, 93, 165, 113, 204, 50, 26, 227, 201, 98, 110, 244, 49, 27, 190, 179, 248,
+    215, 147, 218, 70, 125, 94, 125, 156, 99, 160, 103, 114, 64, 218, 90, 50, 5, 88, 133, 224, 241, 82, 38, 83, 154,
+    228, 125, 10, 81, 170, 240, 140, 197, 182, 83, 251, 31, 79, 172, 155, 125, 220, 223, 162, 248, 2, 250, 158, 204,
+    191, 139, 109, 138, 17, 248, 27, 37, 124, 65, 255, 11, 8, 105, 80, 232, 63, 127, 171, 9, 61, 54, 85, 227, 118, 160,
+    64, 124, 183, 241, 145, 81, 159, 211, 208, 189, 221, 99, 147, 213, 161, 140, 57, 212, 61, 54, 112, 12, 164, 181,
+    241, 157, 253, 130, 110, 49, 153, 13, 68, 232, 61, 101, 104, 236, 160, 26, 156, 113, 80, 212, 234, 12, 173, 88, 66,
+    187, 121, 173, 154, 157, 80, 80, 141, 202, 216, 180, 1, 179, 42, 188, 184, 157, 82, 181, 174, 40, 25, 73, 129, 123,
+    85, 139, 77, 42, 119, 80, 36, 85, 42, 44, 229, 151, 31, 159, 91, 52, 72, 190, 133, 65, 20, 103, 168, 219, 189, 239,
+    33, 240, 203, 145, 140, 224, 121, 19, 240, 178, 198, 20, 97, 16, 73, 35, 2, 234, 23, 135, 77, 120, 128, 2, 168, 190,
+    53, 58, 72, 58, 195, 71, 242, 208, 228, 220, 238, 241, 168, 38, 199, 22, 60, 194, 222, 88, 103, 118, 151, 181, 134,
+    159, 171, 192, 21, 236, 58, 238, 188, 165, 78, 74, 146, 145, 68, 245, 26, 137, 28, 202, 81, 151, 119, 47, 221, 127,
+    225, 111, 240, 151, 36, 39, 154, 117, 73, 12, 167, 24, 234, 177, 40, 122, 13, 225, 222, 194, 39, 74, 150, 198, 55,
+    26, 86, 182, 24, 81, 29, 112, 59, 175, 190, 124, 170, 144, 22, 186, 126, 109, 169, 241, 32, 31, 205, 66, 94, 139,
+    119, 105, 148, 202, 21, 190, 25, 193, 99, 85, 3, 97, 239, 76, 231, 69, 50, 47, 118, 82, 88, 212, 10, 64, 206, 193,
+    182, 206, 243, 181, 109, 163, 56, 95, 24, 122, 35, 162, 155, 89, 29, 155, 180, 110, 242, 54, 125, 52, 94, 198, 87,
+    221, 48, 141, 153, 1, 199, 14, 253, 215, 22, 95, 46, 5, 157, 79, 225, 31, 71, 200, 205, 63, 155, 205, 163, 1, 44,
+    77, 40, 228, 210, 121, 247, 101, 180, 189, 241, 244, 243, 128, 214, 217, 187, 159, 136, 42, 16, 1, 14, 46, 145, 178,
+    164, 13, 17, 60, 215, 69, 235, 254, 222, 130, 60, 133, 244, 159, 156, 134, 185, 39, 249, 105, 244, 48, 69, 229, 210,
+    198, 58, 211, 38, 112, 168, 211, 101, 191, 35, 122, 32, 232, 164, 207, 104, 57, 128, 122, 176, 115, 170, 168, 172,
+    177, 124, 232, 15, 197, 186, 238, 123, 99, 248, 63, 169, 168, 207, 76, 222, 184, 242, 143, 162, 218, 209, 56, 70,
+    97, 178, 204, 180, 80, 197, 229, 61, 253, 74, 234, 110, 144, 185, 3, 119, 153, 43, 213, 78, 164, 224, 185, 25, 46,
+    168, 245, 103, 76, 135, 88, 126, 177, 61, 128, 53, 187, 57, 118, 208, 10, 165, 162, 52, 161, 202, 69, 139, 202, 205,
+    134, 76, 211, 218, 74, 122, 109, 37, 147, 11, 21, 208, 252, 29, 224, 117, 250, 82, 144, 124, 103, 22, 148, 206, 141,
+    111, 233, 172, 134, 143, 100, 113, 61, 217, 212, 34, 201, 24, 63, 59, 124, 164, 85, 51, 150, 139, 87, 232, 151, 233,
+    59, 137, 204, 195, 126, 119, 226, 42, 192, 239, 46, 21, 161, 131, 244, 96, 23, 191, 4, 187, 24, 249, 164, 216, 188,
+    253, 99, 18, 228, 240, 84, 84, 111, 229, 230, 240, 252, 158, 11, 173, 11, 179, 105, 83, 178, 39, 64, 188, 141, 158,
+    133, 30, 223, 40, 78, 196, 80, 206, 119, 238, 8, 15, 235, 59, 25, 210, 24, 57, 202, 100, 159, 48, 71, 229, 226, 108,
+    37, 94, 61, 182, 40, 155, 254, 155, 182, 187, 85, 134, 146, 238, 116, 252, 135, 144, 160, 6, 230, 155, 163, 4, 100,
+    57, 52, 98, 166, 62, 194, 241, 175, 217, 72, 23, 120, 59, 78, 155, 23, 164, 154, 99, 172, 212, 2, 250, 235, 101, 1,
+    249, 72, 211, 230, 45, 138, 46, 37, 109, 38, 212, 37, 191, 96, 26, 183, 126, 176, 104, 102, 169, 19, 147, 250, 30,
+    5, 134, 245, 204, 149, 14, 10, 20, 59, 55, 150, 54, 32, 226, 197, 82, 234, 26, 193, 155, 97, 97, 84, 19, 253, 4,
+    240, 194, 5, 145, 109, 56, 144, 60, 174, 183, 214, 135, 164, 82, 24, 242, 74, 136, 220, 150, 205, 249, 192, 14, 122,
+    255, 178, 50, 34, 189, 68, 152, 0, 57, 82, 209, 61, 94, 225, 166, 39, 253, 189, 196, 157, 150, 233, 240, 201, 207,
+    228, 236, 196, 32, 177, 174, 149, 243, 193, 231, 15, 20, 21, 146, 40, 21, 7, 156, 73, 36, 171, 29, 79, 168, 101,
+    222, 67, 224, 171, 69, 78, 191, 160, 43, 119, 199, 64, 56, 52, 168, 101, 61, 200, 105, 195, 2, 226, 164, 32, 177,
+    50, 135, 200, 85, 122, 210, 155, 240, 103, 118, 234, 80, 237, 119, 169, 152, 52, 210, 46, 7, 52, 125, 31, 220, 37,
+    118, 82, 147, 181, 243, 73, 188, 35, 91, 32, 45, 73, 71, 187, 2, 76, 114, 65, 53, 189, 66, 78, 139, 145, 166, 203,
+    31, 216, 110, 200, 238, 19, 31, 195, 138, 175, 189, 95, 72, 54, 108, 188, 34, 83, 57, 214, 243, 18, 238, 72, 231,
+    162, 16, 186, 70, 127, 84, 46, 154, 180, 52, 209, 14, 39, 165, 201, 57, 195, 48, 103, 62, 224, 128, 153, 0, 146,
+    226, 29, 217, 89, 182, 10, 152, 153, 20, 153, 81, 92, 103, 174, 76, 77, 153, 137, 116, 125, 87, 215, 231, 50, 189,
+    201, 216, 56, 131, 130, 67, 194, 52, 5, 103, 52, 64, 248, 245, 34, 194, 157, 131, 237, 87, 17, 59, 161, 28, 253,
+    153, 7, 13, 61, 4, 54, 89, 146, 108, 173, 252, 6, 94, 68, 122, 123, 59, 140, 130, 47, 65, 76, 228, 38, 18, 87, 152,
+    161, 61, 140, 213, 223, 160, 21, 211, 226, 133, 241, 161, 110, 66, 124, 18, 137, 38, 226, 254, 32, 33, 22, 73, 55,
+    242, 4, 182, 99, 70, 103, 219, 3, 66, 53, 73, 44, 221, 175, 101, 224, 4, 83, 7, 18, 148, 165, 234, 150, 78, 119,
+    220, 89, 3, 216, 151, 18, 21, 94, 155, 117, 22, 101, 76, 239, 38, 71, 150, 249, 204, 165, 192, 199, 187, 115, 38,
+    64, 73, 233, 210, 60, 255, 220, 89, 222, 183, 108, 108, 138, 183, 252, 11, 206, 170, 22, 45, 247, 163, 173, 79, 153,
+    113, 255, 150, 23, 40, 195, 5, 242, 223, 73, 125, 164, 13, 247, 49, 75, 197, 149, 119, 191, 46, 215, 23, 33, 57,
+    155, 237, 134, 77, 215, 237, 208, 61, 243, 95, 36, 152, 172, 46, 189, 45, 49, 55, 206, 193, 144, 163, 75, 158, 21,
+    13, 242, 198, 218, 64, 76, 180, 152, 208, 183, 187, 86, 30, 46, 125, 163, 167, 154, 198, 191, 183, 165, 92, 209,
+    116, 135, 2, 231, 115, 246, 114, 169, 149, 176, 226, 162, 19, 34, 58, 136, 201, 98, 121, 35, 125, 224, 225, 167,
+    202, 254, 98, 31, 97, 40, 219, 113, 218, 124, 30, 230, 251, 199, 186, 239, 108, 181, 166, 229, 99, 215, 1, 255, 33,
+    99, 145, 52, 218, 103, 81, 173, 255, 94, 68, 214, 173, 165, 201, 25, 4, 211, 78, 136, 252, 195, 248, 38, 246, 211,
+    95, 106, 109, 103, 160, 24, 145, 151, 31, 159, 150, 96, 3, 85, 174, 250, 32, 75, 181, 154, 36, 100, 75, 228, 176,
+    196, 38, 171, 191, 59, 176, 23, 149, 36, 215, 70, 134, 121, 80, 22, 71, 30, 228, 168, 54, 188, 50, 91, 67, 94, 25,
+    211, 43, 184, 190, 7, 201, 222, 194, 57, 205, 0, 60, 0, 201, 166, 23, 175, 254, 220, 101, 93, 89, 119, 55, 177, 193,
+    250, 140, 168, 196, 152, 33, 22, 146, 249, 4, 125, 22, 16, 125, 108, 247, 74, 12, 92, 192, 68, 226, 217, 78, 181,
+    205, 218, 179, 66, 124, 225, 29, 170, 129, 46, 133, 197, 42, 135, 130, 71, 73, 35, 86, 117, 222, 46, 118, 125, 145,
+    253, 161, 66, 33, 236, 0, 216, 57, 126, 103, 177, 214, 163, 32, 248, 89, 34, 199, 54, 97, 29, 241, 241, 144, 219,
+    28, 79, 143, 36, 143, 114, 9, 133, 140, 34, 224, 32, 22, 181, 86, 24, 197, 22, 177, 107, 177, 71, 22, 21, 229, 151,
+    80, 124, 247, 254, 80, 162, 127, 171, 171, 195, 13, 104, 218, 50, 149, 175, 242, 146, 227, 64, 26, 122, 50, 159, 65,
+    45, 167, 37, 185, 118, 3, 69, 232, 126, 52, 110, 44, 209, 235, 196, 123, 35, 160, 91, 188, 178, 33, 220, 132, 184,
+    101, 98, 71, 135, 211, 114, 172, 231, 201, 206, 16, 184, 112, 166, 253, 214, 176, 191, 217, 224, 93, 77, 93, 203,
+    119, 252, 233, 115, 14, 50, 15, 152, 127, 9, 159, 179, 91, 156, 9, 229, 163, 158, 31, 157, 200, 139, 85, 17, 180,
+    121, 81, 10, 26, 110, 225, 26, 238, 198, 103, 67, 141, 40, 48, 229, 71, 16, 44, 253, 172, 227, 208, 216, 35, 171,
+    90, 112, 172, 214, 247, 163, 97, 223, 237, 85, 174, 135, 227, 121, 242, 34, 124, 253, 235, 194, 4, 151, 101, 205,
+    171, 157, 250, 51, 16, 210, 175, 208, 131, 84, 53, 169, 89, 92, 204, 18, 94, 228, 194, 28, 215, 172, 186, 44, 208,
+    178, 71, 18, 63, 177, 8, 108, 130, 230, 183, 57, 8, 12, 48, 62, 198, 8, 58, 252, 114, 74, 175, 189, 219, 7, 210,
+    135, 3, 152, 87, 5, 246, 191, 139, 13, 64, 205, 84, 185, 38, 84, 61, 204, 185, 227, 30, 223, 148, 126, 136, 116,
+    209, 41, 225, 63, 165, 99, 97, 55, 124, 183, 224, 202, 126, 106, 97, 13, 150, 10, 185, 194, 128, 239, 222, 77, 99,
+    246, 50, 92, 31, 234, 83, 219, 118, 107, 17, 195, 253, 218, 46, 11, 221, 227, 215, 40, 183, 12, 177, 5, 54, 101, 19,
+    100, 101, 23, 218, 90, 186, 119, 198, 42, 95, 255, 121, 206, 31, 110, 163, 121, 114, 197, 220, 45, 40, 60, 247, 248,
+    68, 156, 229, 122, 69, 241, 66, 5, 78, 114, 4, 223, 169, 244, 198, 195, 67, 181, 195, 131, 252, 220, 160, 145, 59,
+    225, 217, 212, 176, 93, 58, 196, 2, 203, 140, 249, 232, 214, 177, 238, 30, 35, 54, 27, 120, 73, 54, 7, 228, 76, 16,
+    231, 76, 35, 220, 61, 39, 126, 251, 40, 48, 233, 149, 39, 192, 17, 76, 107, 241, 139, 28, 181, 166, 208, 235, 171,
+    91, 63, 46, 6, 18, 116, 47, 124, 131, 220, 135, 207, 152, 211, 86, 32, 20, 82, 128, 157, 50, 232, 153, 225, 39, 97,
+    42, 210, 185, 72, 66, 213, 115, 134, 198, 94, 35, 39, 0, 144, 63, 46, 123, 45, 199, 68, 32, 123, 15, 114, 108, 83,
+    115, 161, 161, 156, 93, 192, 238, 10, 124, 139, 129, 107, 51, 225, 201, 123, 254, 192, 156, 104, 156, 24, 132, 232,
+    30, 147, 121, 115, 24, 104, 111, 19, 85, 153, 11, 193, 46, 191, 158, 107, 132, 48, 183, 96, 59, 109, 178, 158, 85,
+    56, 179, 28, 24, 6, 111, 85, 176, 123, 150, 214, 64, 250, 211, 249, 191, 233, 220, 73, 32, 97, 156, 215, 94, 182,
+    120, 229, 204, 94, 34, 201, 23, 126, 144, 234, 231, 158, 74, 254, 88, 149, 246, 188, 53, 16, 167, 70, 215, 77, 120,
+    198, 162, 189, 38, 186, 142, 20, 171, 15, 119, 245, 66, 238, 49, 166, 201, 16, 188, 122, 212, 146, 145, 182, 15,
+    151, 15, 120, 228, 77, 58, 24, 103, 203, 194, 213, 80, 148, 136, 194, 37, 69, 82, 69, 217, 121, 222, 243, 90, 17,
+    243, 188, 221, 119, 101, 110, 106, 227, 50, 196, 78, 93, 162, 183, 69, 162, 90, 18, 197, 134, 117, 159, 149, 123,
+    185, 14, 7, 239, 239, 162, 47, 138, 152, 117, 136, 204, 255, 4, 90, 27, 187, 124, 134, 117, 4, 167, 171, 34, 37,
+    126, 66, 163, 27, 51, 149, 241, 58, 170, 237, 246, 114, 110, 108, 214, 45, 135, 220, 249, 215, 109, 207, 107, 239,
+    195, 134, 86, 207, 248, 31, 157, 3, 94, 168, 251, 55, 123, 78, 200, 214, 212, 118, 194, 49, 158, 248, 236, 6, 173,
+    163, 205, 81, 192, 251, 64, 80, 249, 29, 72, 48, 129, 133, 150, 114, 184, 82, 163, 11, 237, 246, 40, 15, 226, 100,
+    79, 82, 89, 54, 79, 66, 162, 106, 218, 40, 71, 68, 108, 148, 63, 6, 49, 187, 137, 140, 206, 200, 31, 41, 18, 165,
+    211, 208, 62, 143, 235, 15, 56, 70, 192, 62, 44, 143, 17, 107, 46, 36, 81, 102, 44, 125, 43, 19, 72, 26, 243, 110,
+    153, 99, 102, 1, 46, 110, 247, 99, 4, 30, 228, 229, 1, 223, 235, 38, 30, 208, 83, 78, 135, 209, 214, 63, 254, 95,
+    224, 21, 39, 97, 121, 35, 194, 198, 24, 141, 162, 23, 132, 37, 231, 254, 234, 67, 189, 38, 24, 192, 177, 143, 148,
+    242, 208, 16, 201, 224, 85, 23, 29, 81, 73, 169, 112, 138, 11, 154, 207, 216, 201, 12, 234, 60, 74, 106, 8, 175,
+    187, 57, 77, 138, 222, 236, 161, 119, 76, 36, 228, 71, 179, 205, 142, 225, 95, 202, 75, 117, 223, 47, 99, 59, 238,
+    196, 48, 148, 128, 41, 61, 45, 45, 162, 5, 10, 112, 19, 17, 236, 227, 114, 146, 140, 133, 109, 218, 74, 177, 209,
+    189, 179, 219, 12, 20, 60, 84, 75, 51, 137, 42, 133, 147, 110, 175, 166, 166, 85, 98, 138, 82, 119, 27, 44, 150,
+    226, 218, 174, 114, 134, 199, 124, 144, 248, 102, 67, 67, 95, 130, 93, 63, 9, 59, 37, 130, 131, 91, 226, 156, 152,
+    164, 210, 200, 113, 131, 67, 145, 200, 172, 203, 106, 199, 168, 73, 4, 71, 24, 160, 250, 83, 214, 77, 65, 121, 150,
+    19, 207, 84, 7, 14, 227, 22, 243, 81, 227, 149, 154, 166, 86, 172, 114, 36, 108, 205, 123, 55, 21, 10, 165, 209,
+    116, 22, 217, 76, 60, 5, 170, 35, 114, 218, 8, 249, 162, 59, 174, 209, 89, 137, 254, 91, 230, 214, 98, 58, 102, 242,
+    43, 98, 233, 98, 111, 122, 249, 19, 173, 122, 18, 218, 197, 179, 158, 110, 39, 107, 127, 116, 114, 70, 62, 69, 110,
+    254, 46, 61, 88, 177, 210, 92, 62, 199, 11, 18, 87, 102, 155, 63, 250, 157, 119, 30, 46, 56, 200, 121, 223, 41, 252,
+    193, 0, 90, 155, 85, 30, 58, 26, 123, 94, 140, 144, 145, 236, 143, 70, 63, 30, 197, 232, 118, 25, 139, 29, 239, 127,
+    88, 236, 226, 247, 197, 175, 80, 171, 209, 50, 254, 41, 163, 211, 59, 57, 122, 194, 236, 160, 137, 119, 24, 219, 10,
+    76, 239, 49, 199, 17, 220, 26, 95, 119, 168, 254, 89, 122, 205, 235, 116, 211, 81, 246, 167, 153, 20, 56, 206, 9,
+    59, 66, 92, 174, 253, 119, 13, 83, 204, 83, 248, 159, 230, 163, 47, 217, 89, 197, 224, 99, 124, 16, 107, 123, 247,
+    142, 55, 79, 185, 30, 239, 111, 255, 233, 33, 86, 137, 202, 145, 167, 188, 231, 197, 188, 84, 247, 12, 3, 109, 41,
+    21, 249, 9, 87, 186, 77, 47, 26, 206, 17, 196, 33, 60, 30, 118, 232, 253, 84, 83, 254, 175, 206, 65, 184, 238, 119,
+    115, 233, 214, 14, 185, 225, 134, 127, 251, 226, 200, 146, 197, 250, 184, 161, 203, 239, 216, 84, 119, 133, 37, 218,
+    69, 16, 151, 42, 246, 65, 59, 112, 247, 226, 101, 144, 153, 219, 217, 115, 98, 127, 199, 58, 75, 225, 162, 74, 184,
+    13, 3, 159, 157, 38, 95, 128, 61, 114, 173, 13, 14, 103, 57, 166, 136, 74, 168, 87, 109, 116, 11, 91, 209, 63, 227,
+    218, 192, 169, 165, 159, 23, 18, 62, 179, 254, 205, 55, 91, 193, 247, 28, 195, 207, 174, 243, 222, 223, 242, 211,
+    191, 235, 92, 224, 126, 46, 81, 136, 125, 49, 54, 88, 78, 32, 160, 190, 103, 133, 165, 110, 39, 249, 132, 97, 23,
+    229, 59, 182, 142, 251, 32, 221, 111, 25, 184, 161, 212, 187, 231, 23, 40, 125, 109, 50, 122, 41, 17, 210, 105, 188,
+    211, 176, 103, 70, 100, 252, 247, 183, 150, 219, 186, 85, 196, 140, 123, 177, 222, 33, 98, 27, 185, 216, 215, 43,
+    33, 195, 170, 224, 166, 225, 175, 207, 5, 60, 38, 51, 189, 16, 23, 133, 157, 74, 144, 119, 83, 78, 230, 70, 43, 155,
+    147, 248, 94, 77, 147, 156, 233, 189, 146, 224, 237, 102, 159, 211, 49, 178, 63, 172, 219, 53, 18, 118, 202, 244,
+    193, 71, 249, 65, 222, 210, 26, 22, 136, 166, 177, 143, 77, 78, 86, 3, 41, 80, 254, 235, 83, 40, 210, 92, 84, 113,
+    134, 233, 130, 155, 72, 110, 210, 252, 177, 193, 119, 188, 100, 168, 135, 227, 85, 242, 210, 242, 7, 92, 44, 193,
+    226, 202, 174, 7, 235, 231, 195, 102, 223, 168, 156, 110, 165, 45, 231, 8, 170, 249, 97, 218, 82, 2, 172, 25, 121,
+    5, 98, 255, 205, 200, 9, 160, 123, 132, 56, 121, 143, 105, 223, 229, 200, 131, 176, 114, 248, 167, 79, 73, 111, 244,
+    39, 8, 93, 0, 230, 205, 180, 97, 163, 27, 111, 151, 16, 162, 91, 63, 67, 166, 150, 95, 169, 187, 230, 213, 13, 249,
+    227, 115, 51, 63, 173, 87, 179, 229, 157, 228, 227, 197, 148, 97, 144, 154, 75, 3, 99, 166, 212, 159, 174, 197, 79,
+    16, 75, 239, 98, 1, 219, 93, 21, 203, 89, 205, 51, 151, 81, 91, 28, 33, 193, 10, 231, 105, 221, 21, 229, 50, 168,
+    95, 105, 135, 119, 168, 96, 230, 8, 70, 68, 60, 65, 113, 46, 15, 205, 86, 181, 92, 164, 80, 78, 91, 241, 142, 223,
+    81, 54, 241, 234, 240, 182, 185, 27, 137, 129, 157, 113, 83, 10, 35, 65, 18, 232, 62, 147, 47, 189, 52, 158, 241,
+    143, 129, 244, 148, 137, 247, 201, 148, 13, 78, 109, 245, 34, 5, 206, 187, 62, 240, 139, 239, 135, 62, 125, 225,
+    226, 188, 154, 148, 131, 125, 20, 251, 224, 115, 160, 148, 218, 89, 209, 164, 31, 134, 229, 227, 232, 52, 101, 85,
+    57, 126, 154, 181, 89, 30, 85, 112, 30, 32, 47, 79, 141, 204, 166, 243, 147, 228, 82, 164, 19, 14, 165, 73, 124,
+    212, 34, 8, 76, 246, 197, 236, 19, 247, 174, 42, 61, 255, 197, 233, 49, 111, 159, 21, 72, 202, 48, 98, 70, 231, 243,
+    159, 3, 178, 82, 244, 130, 140, 254, 179, 92, 174, 197, 45, 56, 3, 37, 50, 217, 3, 56, 210, 168, 107, 78, 16, 163,
+    238, 171, 137, 241, 22, 77, 108, 139, 32, 59, 170, 88, 183, 222, 192, 4, 25, 32, 247, 212, 40, 197, 63, 124, 184,
+    51, 255, 175, 174, 200, 136, 226, 13, 156, 179, 234, 89, 65, 101, 182, 110, 50, 225, 201, 14, 31, 94, 144, 152, 144,
+    222, 192, 168, 68, 212, 96, 2, 175, 219, 236, 246, 177, 212, 157, 255, 146, 107, 99, 127, 137, 183, 107, 114, 199,
+    153, 53, 254, 220, 234, 215, 184, 215, 37, 141, 216, 226, 118, 117, 29, 95, 102, 249, 83, 185, 52, 119, 6, 194, 196,
+    75, 93, 41, 253, 165, 244, 100, 255, 185, 155, 84, 145, 146, 69, 153, 40, 214, 47, 245, 248, 123, 40, 129, 57, 33,
+    10, 68, 130, 159, 197, 253, 205, 48, 143, 94, 19, 207, 221, 128, 214, 223, 170, 85, 73, 162, 237, 197, 123, 112, 81,
+    220, 232, 180, 47, 212, 103, 173, 236, 133, 43, 155, 74, 124, 226, 87, 109, 220, 36, 71, 123, 220, 56, 210, 171,
+    200, 217, 141, 33, 112, 30, 33, 177, 158, 51, 167, 13, 20, 28, 139, 107, 121, 81, 177, 180, 223, 251, 24, 253, 228,
+    155, 17, 143, 89, 100, 172, 181, 29, 27, 172, 78, 57, 181, 127, 241, 78, 15, 35, 203, 209, 0, 189, 191, 149, 193,
+    31, 183, 173, 205, 239, 191, 53, 51, 231, 99, 120, 195, 59, 126, 78, 29, 34, 13, 130, 50, 77, 203, 88, 48, 82, 86,
+    123, 254, 42, 5, 69, 103, 89, 201, 135, 64, 12, 190, 36, 149, 203, 111, 68, 210, 41, 55, 57, 103, 118, 253, 207,
+    159, 64, 30, 34, 172, 79, 51, 136, 252, 144, 94, 48, 204, 119, 80, 55, 151, 173, 194, 193, 178, 214, 184, 73, 27,
+    145, 144, 144, 89, 144, 253, 131, 221, 153, 120, 217, 119, 36, 211, 173, 168, 78, 227, 48, 123, 175, 19, 170, 15, 8,
+    161, 1, 249, 187, 183, 58, 1, 232, 9, 210, 165, 194, 174, 187, 170, 15, 111, 222, 55, 171, 103, 159, 1, 90, 71, 56,
+    231, 212, 34, 128, 186, 95, 110, 100, 253, 193, 65, 239, 135, 1, 71, 95, 132, 147, 158, 155, 226, 6, 13, 44, 12,
+    122, 93, 7, 105, 18, 22, 170, 11, 94, 192, 120, 56, 94, 15, 163, 205, 238, 69, 25, 47, 168, 204, 0, 22, 228, 211,
+    213, 113, 30, 220, 63, 7, 252, 40, 195, 254, 185, 219, 147, 168, 4, 178, 3, 69, 71, 180, 187, 216, 28, 80, 69, 111,
+    5, 93, 193, 34, 252, 156, 202, 95, 157, 28, 21, 186, 218, 0, 187, 134, 67, 70, 45, 42, 56, 113, 9, 141, 200, 124,
+    84, 26, 62, 113, 29, 80, 165, 89, 62, 145, 4, 52, 189, 43, 50, 136, 240, 170, 9, 187, 126, 33, 177, 127, 246, 167,
+    173, 27, 13, 113, 72, 244, 255, 31, 106, 97, 80, 197, 88, 166, 31, 154, 87, 183, 14, 12, 245, 206, 197, 2, 37, 32,
+    137, 250, 60, 40, 126, 213, 30, 69, 250, 31, 246, 193, 39, 12, 194, 236, 129, 195, 52, 131, 228, 9, 35, 196, 122,
+    155, 89, 98, 31, 60, 153, 123, 202, 120, 234, 219, 190, 198, 234, 69, 205, 82, 101, 86, 238, 65, 24, 186, 245, 11,
+    185, 84, 58, 77, 211, 8, 244, 29, 156, 30, 248, 52, 69, 47, 42, 92, 41, 164, 162, 52, 179, 225, 60, 62, 17, 118, 29,
+    252, 209, 91, 157, 89, 66, 150, 123, 59, 26, 37, 49, 71, 12, 178, 69, 15, 3, 251, 135, 4, 229, 185, 153, 238, 208,
+    239, 227, 217, 145, 128, 241, 100, 124, 237, 212, 62, 8, 147, 244, 0, 187, 118, 224, 72, 214, 9, 240, 1, 20, 37, 36,
+    215, 106, 145, 77, 153, 129, 188, 101, 11, 151, 178, 214, 155, 80, 248, 240, 69, 215, 240, 74, 204, 189, 184, 122,
+    171, 185, 235, 71, 180, 106, 184, 4, 54, 86, 183, 30, 157, 194, 124, 128, 33, 236, 203, 126, 103, 86, 34, 94, 155,
+    79, 143, 76, 188, 162, 232, 10, 92, 77, 64, 205, 171, 224, 183, 190, 128, 253, 190, 235, 225, 247, 84, 137, 235,
+    184, 227, 60, 72, 113, 4, 82, 9, 170, 188, 13, 236, 235, 70, 113, 100, 69, 87, 135, 123, 86, 38, 180, 2, 148, 204,
+    51, 149, 33, 254, 158, 100, 77, 189, 254, 138, 218, 63, 206, 234, 226, 5, 245, 54, 103, 248, 55, 112, 211, 53, 133,
+    6, 233, 18, 12, 142, 135, 159, 238, 223, 84, 3, 249, 11, 40, 163, 90, 241, 9, 48, 42, 100, 165, 240, 228, 181, 93,
+    116, 236, 126, 127, 121, 83, 252, 86, 9, 100, 101, 10, 98, 169, 106, 81, 167, 177, 152, 32, 214, 141, 95, 146, 152,
+    80, 61, 147, 13, 123, 47, 75, 6, 121, 113, 47, 78, 250, 196, 206, 78, 41, 139, 94, 27, 77, 205, 3, 79, 201, 118,
+    167, 4, 218, 169, 6, 208, 94, 24, 123, 92, 103, 12, 12, 73, 71, 54, 135, 122, 173, 79, 217, 109, 67, 230, 246, 58,
+    221, 255, 104, 7, 128, 95, 205, 24, 101, 82, 174, 148, 120, 78, 30, 62, 175, 14, 74, 254, 57, 108, 95, 136, 93, 205,
+    248, 165, 109, 202, 114, 73, 87, 143, 13, 18, 185, 221, 48, 9, 99, 128, 124, 14, 206, 53, 129, 9, 59, 106, 59, 19,
+    6, 51, 51, 50, 254, 109, 191, 181, 136, 75, 176, 86, 83, 43, 163, 143, 112, 96, 47, 57, 173, 59, 98, 122, 108, 71,
+    199, 196, 99, 28, 59, 103, 138, 101, 136, 59, 192, 56, 70, 210, 232, 236, 23, 130, 91, 105, 193, 63, 202, 253, 216,
+    179, 25, 201, 124, 46, 15, 171, 182, 36, 105, 216, 48, 153, 100, 136, 27, 18, 35, 46, 20, 79, 154, 53, 62, 44, 227,
+    104, 48, 98, 220, 27, 250, 138, 77, 125, 4, 174, 14, 130, 75, 215, 39, 106, 67, 218, 187, 58, 200, 180, 208, 231,
+    231, 148, 122, 76, 57, 232, 188, 193, 237, 193, 14, 162, 12, 254, 29, 103, 253, 83, 131, 0, 33, 71, 42, 227, 42,
+    137, 181, 48, 58, 57, 175, 39, 221, 230, 83, 14, 244, 126, 34, 248, 99, 176, 45, 136, 70, 213, 154, 189, 224, 19,
+    46, 216, 206, 87, 137, 194, 212, 248, 52, 129, 69, 171, 231, 68, 16, 220, 141, 16, 185, 38, 165, 167, 78, 217, 154,
+    47, 167, 204, 11, 206, 158, 106, 243, 99, 55, 193, 116, 72, 1, 238, 83, 163, 39, 148, 96, 248, 195, 131, 228, 25,
+    207, 114, 177, 62, 28, 183, 145, 169, 254, 49, 62, 246, 177, 251, 101, 18, 57, 195, 78, 154, 238, 14, 89, 156, 152,
+    115, 63, 244, 199, 6, 168, 109, 227, 91, 184, 255, 124, 124, 206, 242, 68, 249, 131, 228, 43, 157, 120, 231, 225,
+    79, 57, 130, 87, 82, 103, 243, 171, 182, 187, 75, 34, 19, 122, 115, 188, 254, 25, 80, 112, 21, 123, 179, 159, 163,
+    170, 22, 48, 58, 36, 181, 117, 189, 245, 11, 36, 153, 191, 216, 236, 53, 84, 240, 21, 124, 159, 248, 25, 67, 0, 183,
+    104, 191, 211, 135, 8, 242, 243, 114, 219, 117, 20, 187, 19, 204, 217, 3, 238, 237, 23, 150, 194, 108, 105, 61, 65,
+    89, 223, 255, 241, 75, 6, 81, 2, 242, 152, 222, 152, 124, 27, 165, 52, 36, 206, 230, 159, 231, 127, 144, 154, 56,
+    162, 192, 39, 121, 4, 216, 87, 147, 151, 165, 4, 232, 236, 24, 1, 115, 182, 126, 172, 89, 69, 251, 29, 44, 184, 0,
+    148, 95, 55, 42, 180, 128, 190, 0, 242, 238, 154, 24, 179, 110, 239, 238, 149, 207, 49, 123, 162, 121, 93, 155, 113,
+    149, 120, 150, 225, 242, 224, 63, 154, 76, 190, 105, 207, 94, 122, 150, 134, 182, 46, 40, 17, 217, 155, 1, 219, 77,
+    30, 133, 163, 56, 114, 207, 192, 150, 41, 66, 81, 16, 27, 14, 64, 228, 130, 140, 115, 208, 231, 126, 57, 156, 73,
+    130, 151, 41, 26, 255, 41, 81, 45, 98, 27, 179, 242, 127, 16, 88, 46, 181, 173, 6, 3, 218, 147, 172, 164, 192, 7,
+    60, 98, 141, 16, 14, 29, 211, 130, 177, 7, 151, 105, 204, 88, 128, 149, 6, 210, 106, 157, 250, 89, 198, 28, 3, 138,
+    193, 119, 213, 76, 179, 215, 45, 248, 25, 193, 191, 150, 77, 107, 228, 162, 241, 168, 168, 30, 86, 13, 143, 54, 65,
+    20, 241, 227, 112, 192, 14, 98, 249, 85, 86, 190, 123, 168, 65, 198, 179, 18, 148, 189, 50, 210, 74, 71, 89, 227,
+    16, 133, 25, 100, 83, 48, 251, 167, 196, 38, 174, 110, 253, 29, 18, 59, 32, 235, 62, 166, 200, 9, 152, 131, 220,
+    106, 222, 27, 39, 212, 61, 210, 147, 52, 226, 125, 46, 99, 61, 108, 228, 8, 141, 167, 205, 68, 90, 141, 208, 97,
+    235, 101, 130, 155, 100, 182, 36, 236, 249, 1, 135, 39, 109, 206, 186, 115, 155, 117, 52, 7, 156, 113, 96, 35, 198,
+    4, 132, 45, 54, 189, 130, 117, 179, 151, 237, 82, 90, 38, 6, 250, 147, 237, 111, 242, 204, 9, 245, 112, 1, 146, 206,
+    70, 68, 163, 208, 200, 48, 120, 215, 171, 155, 233, 193, 4, 238, 180, 64, 130, 136, 224, 221, 53, 77, 60, 167, 230,
+    237, 219, 133, 209, 145, 227, 66, 211, 183, 87, 140, 46, 125, 128, 15, 147, 222, 61, 99, 214, 123, 180, 123, 195,
+    86, 249, 108, 32, 110, 153, 81, 166, 71, 63, 152, 214, 190, 172, 241, 168, 132, 32, 160, 100, 148, 56, 108, 242, 72,
+    73, 7, 56, 7, 240, 120, 221, 211, 24, 30, 29, 199, 158, 102, 131, 16, 167, 28, 246, 111, 147, 163, 202, 59, 159,
+    132, 12, 25, 46, 67, 230, 107, 254, 29, 187, 177, 39, 18, 111, 174, 147, 241, 107, 145, 39, 76, 181, 136, 17, 121,
+    84, 188, 52, 40, 243, 167, 17, 151, 10, 235, 86, 99, 180, 248, 255, 171, 178, 190, 107, 195, 21, 166, 155, 174, 155,
+    204, 138, 222, 68, 119, 68, 141, 143, 34, 91, 220, 28, 221, 140, 231, 129, 191, 99, 30, 252, 95, 241, 33, 73, 147,
+    140, 197, 127, 0, 75, 30, 102, 19, 85, 104, 183, 128, 48, 190, 87, 76, 72, 225, 158, 44, 214, 98, 191, 243, 16, 247,
+    92, 185, 192, 185, 243, 47, 102, 140, 207, 136, 27, 1, 211, 180, 97, 108, 89, 0, 198, 243, 88, 37, 195, 73, 232,
+    128, 96, 196, 105, 16, 69, 36, 64, 47, 244, 30, 56, 39, 197, 82, 114, 123, 200, 218, 100, 200, 13, 95, 117, 167, 96,
+    112, 95, 254, 250, 113, 244, 198, 128, 25, 84, 85, 5, 20, 183, 250, 124, 133, 191, 206, 196, 252, 22, 64, 235, 28,
+    54, 8, 181, 14, 160, 209, 43, 240, 180, 66, 224, 28, 105, 174, 30, 9, 140, 63, 114, 197, 113, 123, 153, 89, 105, 98,
+    172, 48, 93, 73, 101, 176, 135, 198, 78, 89, 191, 133, 40, 193, 24, 172, 184, 85, 33, 172, 196, 198, 93, 68, 182,
+    249, 25, 101, 234, 80, 162, 122, 55, 178, 227, 70, 199, 233, 180, 31, 6, 202, 170, 63, 39, 143, 163, 130, 64, 12,
+    98, 2, 245, 215, 221, 154, 76, 1, 121, 217, 112, 176, 247, 255, 106, 252, 244, 14, 92, 195, 54, 208, 158, 221, 94,
+    41, 175, 61, 16, 60, 230, 213, 89, 63, 72, 109, 95, 57, 28, 7, 52, 251, 200, 168, 129, 7, 44, 194, 100, 68, 101,
+    211, 58, 183, 0, 103, 122, 51, 191, 166, 135, 252, 93, 223, 163, 143, 144, 173, 30, 34, 76, 145, 59, 84, 211, 148,
+    85, 248, 121, 66, 175, 84, 55, 151, 150, 204, 108, 18, 242, 39, 71, 110, 86, 9, 234, 147, 48, 250, 59, 21, 67, 18,
+    200, 196, 40, 222, 112, 13, 228, 199, 122, 93, 159, 0, 191, 202, 239, 237, 104, 86, 194, 86, 230, 223, 157, 97, 249,
+    177, 46, 52, 33, 207, 162, 151, 156, 142, 225, 219, 40, 68, 150, 134, 17, 171, 10, 229, 198, 26, 130, 253, 69, 114,
+    27, 86, 112, 45, 115, 35, 240, 26, 146, 36, 101, 69, 237, 162, 216, 250, 226, 174, 56, 180, 38, 57, 192, 72, 6, 1,
+    156, 176, 21, 209, 198, 244, 42, 99, 130, 237, 240, 12, 200, 116, 21, 192, 212, 3, 17, 238, 83, 49, 254, 4, 57, 209,
+    16, 37, 214, 179, 9, 200, 38, 144, 56, 71, 146, 186, 67, 113, 254, 15, 149, 23, 49, 251, 247, 180, 162, 61, 76, 140,
+    178, 211, 223, 109, 160, 201, 165, 206, 55, 184, 191, 240, 196, 97, 152, 29, 144, 82, 73, 15, 35, 142, 73, 194, 101,
+    226, 9, 219, 150, 145, 41, 99, 125, 108, 224, 210, 147, 211, 10, 61, 152, 98, 179, 52, 12, 51, 26, 58, 62, 57, 225,
+    112, 184, 36, 58, 2, 128, 25, 107, 137, 177, 211, 26, 166, 140, 230, 92, 40, 236, 95, 115, 17, 237, 82, 35, 250,
+    229, 132, 195, 9, 26, 147, 158, 171, 128, 188, 68, 100, 17, 33, 119, 119, 38, 89, 221, 36, 48, 125, 246, 197, 240,
+    24, 29, 74, 54, 20, 248, 204, 177, 194, 16, 138, 56, 124, 105, 158, 187, 217, 170, 4, 152, 135, 30, 174, 13, 17,
+    224, 75, 161, 196, 231, 157, 122, 153, 104, 52, 204, 164, 197, 228, 17, 124, 41, 15, 54, 84, 204, 9, 42, 45, 176,
+    98, 129, 235, 104, 149, 74, 113, 32, 38, 177, 204, 99, 227, 233, 40, 62, 49, 125, 245, 134, 237, 106, 20, 80, 228,
+    11, 73, 5, 87, 29, 105, 87, 68, 159, 186, 140, 248, 42, 221, 112, 25, 146, 207, 105, 219, 209, 83, 54, 109, 122,
+    109, 125, 194, 87, 188, 249, 79, 103, 149, 0, 63, 143, 255, 115, 171, 61, 9, 40, 160, 239, 79, 66, 150, 56, 47, 43,
+    89, 234, 214, 224, 191, 216, 216, 145, 207, 170, 75, 82, 168, 47, 15, 198, 220, 253, 172, 53, 184, 238, 141, 81, 53,
+    10, 248, 167, 170, 162, 30, 112, 21, 176, 63, 72, 68, 117, 196, 102, 124, 212, 243, 153, 39, 181, 222, 107, 112,
+    156, 110, 23, 99, 196, 44, 125, 157, 213, 33, 93, 216, 22, 75, 197, 170, 203, 92, 118, 113, 143, 233, 205, 35, 3,
+    86, 173, 171, 68, 234, 228, 23, 222, 51, 35, 134, 153, 193, 110, 147, 138, 13, 189, 44, 221, 179, 39, 82, 184, 41,
+    53, 140, 202, 28, 135, 71, 38, 69, 31, 159, 255, 25, 60, 75, 111, 110, 247, 209, 12, 141, 115, 145, 35, 64, 249,
+    206, 142, 121, 16, 28, 228, 244, 234, 124, 207, 62, 37, 19, 254, 121, 37, 163, 101, 108, 73, 132, 185, 66, 225, 124,
+    220, 184, 155, 182, 219, 25, 105, 204, 226, 74, 92, 195, 254, 248, 46, 105, 160, 253, 167, 124, 240, 86, 34, 170,
+    222, 81, 102, 184, 220, 159, 133, 41, 171, 16, 68, 118, 170, 104, 201, 238, 170, 97, 248, 209, 207, 14, 248, 172,
+    27, 110, 22, 239, 255, 125, 141, 39, 244, 154, 113, 51, 133, 15, 142, 91, 59, 185, 124, 7, 133, 50, 231, 178, 107,
+    119, 149, 229, 13, 163, 6, 211, 133, 103, 253, 31, 106, 16, 68, 62, 249, 248, 60, 90, 74, 4, 59, 208, 247, 211, 124,
+    157, 190, 102, 56, 52, 169, 188, 88, 48, 163, 49, 138, 135, 58, 97, 240, 19, 13, 58, 182, 90, 125, 33, 223, 230, 46,
+    119, 201, 68, 23, 26, 10, 6, 210, 37, 145, 233, 130, 168, 86, 128, 249, 16, 46, 178, 163, 235, 33, 93, 188, 229,
+    122, 123, 28, 118, 47, 202, 78, 77, 137, 106, 178, 126, 196, 19, 224, 36, 44, 69, 160, 183, 32, 32, 60, 117, 196,
+    251, 171, 28, 82, 190, 25, 98, 145, 210, 3, 30, 182, 157, 150, 17, 247, 135, 237, 169, 96, 187, 42, 135, 255, 114,
+    32, 47, 17, 50, 106, 48, 22, 112, 238, 192, 179, 195, 237, 112, 74, 107, 107, 1, 59, 106, 71, 193, 114, 205, 121,
+    252, 112, 93, 81, 244, 193, 56, 251, 68, 137, 143, 208, 82, 181, 57, 52, 40, 65, 130, 141, 252, 4, 170, 12, 123, 97,
+    158, 30, 114, 76, 68, 0, 212, 15, 229, 237, 200, 51, 172, 52, 193, 202, 17, 193, 101, 11, 25, 8, 41, 56, 161, 135,
+    205, 249, 171, 124, 111, 160, 32, 71, 190, 72, 254, 81, 62, 27, 187, 170, 6, 165, 84, 32, 68, 11, 245, 231, 56, 222,
+    231, 24, 61, 50, 174, 47, 157, 154, 121, 178, 169, 108, 86, 195, 101, 63, 97, 104, 35, 66, 171, 228, 48, 196, 127,
+    186, 213, 102, 140, 43, 198, 87, 12, 50, 159, 193, 15, 67, 59, 20, 221, 20, 217, 170, 251, 70, 175, 233, 163, 231,
+    240, 15, 97, 63, 187, 160, 164, 133, 248, 26, 181, 86, 146, 128, 160, 126, 110, 6, 150, 40, 251, 211, 16, 165, 201,
+    130, 141, 39, 160, 170, 113, 127, 58, 134, 192, 69, 120, 98, 29, 138, 84, 122, 130, 118, 1, 88, 249, 191, 216, 211,
+    230, 147, 18, 201, 202, 33, 193, 8, 177, 21, 35, 192, 249, 67, 35, 171, 20, 125, 192, 218, 170, 220, 46, 11, 104,
+    89, 199, 226, 96, 148, 103, 240, 26, 25, 139, 243, 137, 100, 128, 122, 228, 211, 136, 131, 29, 72, 1, 110, 97, 11,
+    116, 28, 187, 129, 154, 129, 32, 103, 99, 24, 186, 185, 62, 4, 39, 97, 4, 206, 167, 154, 28, 12, 189, 96, 123, 167,
+    174, 89, 13, 193, 129, 230, 157, 179, 51, 150, 246, 65, 169, 106, 152, 33, 211, 196, 216, 3, 117, 205, 60, 17, 175,
+    158, 163, 207, 134, 72, 105, 224, 128, 108, 89, 162, 95, 162, 51, 145, 250, 190, 178, 83, 106, 232, 166, 99, 152,
+    110, 42, 192, 157, 221, 159, 252, 235, 70, 5, 195, 74, 46, 240, 2, 133, 107, 163, 124, 231, 39, 34, 178, 187, 218,
+    173, 99, 188, 21, 122, 160, 107, 96, 142, 138, 119, 144, 49, 15, 49, 255, 12, 47, 14, 254, 87, 126, 185, 206, 88, 2,
+    196, 95, 181, 85, 43, 194, 80, 194, 254, 112, 209, 241, 14, 101, 239, 220, 53, 32, 46, 71, 16, 74, 117, 58, 167,
+    210, 5, 140, 188, 116, 49, 33, 138, 97, 135, 113, 127, 23, 219, 206, 128, 64, 55, 181, 241, 16, 110, 142, 100, 34,
+    89, 113, 43, 95, 26, 115, 127, 111, 184, 109, 141, 88, 234, 79, 65, 167, 210, 41, 57, 70, 59, 119, 90, 49, 213, 114,
+    15, 223, 27, 49, 25, 237, 173, 203, 174, 34, 13, 69, 89, 199, 188, 251, 17, 111, 199, 30, 66, 239, 52, 139, 90, 152,
+    180, 74, 222, 205, 131, 180, 65, 41, 187, 4, 64, 4, 198, 41, 4, 48, 169, 77, 97, 88, 192, 26, 77, 130, 21, 231, 204,
+    78, 246, 66, 98, 75, 166, 208, 123, 116, 124, 233, 107, 95, 18, 151, 46, 245, 58, 109, 155, 91, 142, 209, 15, 34,
+    234, 38, 142, 18, 235, 44, 252, 254, 112, 14, 126, 41, 254, 182, 46, 55, 7, 44, 74, 192, 120, 44, 96, 231, 213, 83,
+    62, 139, 226, 104, 202, 64, 88, 3, 49, 157, 148, 24, 222, 203, 199, 230, 133, 201, 104, 107, 116, 81, 211, 215, 189,
+    108, 105, 28, 105, 81, 243, 110, 138, 165, 159, 57, 42, 189, 186, 26, 24, 235, 27, 41, 199, 65, 227, 73, 135, 19,
+    185, 64, 57, 179, 65, 30, 75, 129, 76, 147, 18, 45, 43, 160, 212, 65, 131, 253, 246, 230, 87, 80, 182, 179, 83, 63,
+    45, 85, 241, 249, 94, 29, 240, 110, 155, 94, 122, 212, 237, 136, 24, 41, 97, 149, 113, 68, 40, 25, 177, 113, 253,
+    239, 105, 48, 201, 1, 147, 207, 141, 22, 132, 255, 90, 51, 241, 225, 109, 211, 242, 8, 213, 181, 146, 173, 4, 9, 55,
+    103, 105, 168, 91, 219, 117, 234, 126, 3, 122, 58, 74, 186, 62, 237, 242, 252, 50, 223, 198, 84, 239, 16, 35, 11,
+    116, 241, 146, 171, 243, 18, 104, 158, 130, 28, 190, 7, 43, 171, 236, 42, 237, 67, 234, 11, 4, 177, 170, 161, 203,
+    155, 206, 245, 188, 221, 233, 9, 149, 237, 30, 59, 68, 235, 137, 212, 37, 37, 86, 111, 60, 127, 168, 90, 119, 48,
+    181, 115, 58, 77, 93, 63, 17, 97, 194, 164, 77, 51, 0, 88, 74, 162, 196, 201, 220, 192, 86, 131, 64, 37, 87, 51,
+    180, 222, 170, 147, 173, 33, 233, 172, 3, 140, 35, 168, 94, 69, 93, 201, 60, 54, 143, 15, 76, 156, 255, 172, 41,
+    163, 243, 185, 223, 135, 248, 137, 1, 93, 200, 172, 2, 187, 5, 207, 169, 245, 60, 117, 113, 61, 162, 204, 95, 66,
+    114, 203, 251, 137, 240, 255, 78, 27, 219, 215, 218, 15, 106, 212, 250, 99, 95, 33, 218, 213, 7, 158, 25, 10, 31, 7,
+    178, 190, 53, 135, 11, 76, 57, 165, 218, 133, 68, 162, 195, 74, 102, 67, 79, 228, 49, 146, 160, 120, 232, 3, 235,
+    209, 238, 235, 251, 68, 96, 103, 88, 236, 54, 32, 12, 204, 251, 139, 120, 58, 18, 119, 105, 67, 191, 204, 173, 201,
+    54, 114, 254, 232, 142, 32, 125, 152, 97, 40, 251, 14, 10, 177, 165, 69, 25, 253, 2, 77, 250, 116, 130, 118, 195,
+    124, 219, 236, 234, 222, 154, 104, 56, 92, 160, 137, 161, 125, 89, 254, 26, 192, 112, 6, 19, 0, 197, 101, 5, 122,
+    227, 2, 168, 115, 96, 219, 179, 232, 185, 228, 78, 198, 190, 251, 167, 51, 31, 79, 230, 241, 140, 74, 223, 238, 51,
+    24, 201, 250, 220, 171, 232, 201, 70, 49, 112, 135, 98, 201, 199, 226, 197, 128, 177, 19, 205, 136, 129, 108, 93,
+    130, 124, 231, 132, 5, 218, 121, 57, 254, 103, 227, 82, 146, 5, 139, 137, 163, 249, 141, 152, 113, 139, 97, 24, 76,
+    48, 77, 5, 244, 181, 148, 71, 88, 45, 123, 144, 72, 96, 67, 47, 203, 168, 97, 129, 117, 28, 191, 71, 37, 169, 176,
+    219, 214, 225, 90, 4, 191, 13, 150, 204, 119, 137, 0, 90, 82, 212, 140, 121, 240, 183, 36, 18, 97, 118, 242, 169,
+    90, 136, 235, 42, 208, 193, 156, 130, 201, 199, 234, 128, 218, 186, 139, 140, 93, 149, 164, 24, 12, 136, 227, 179,
+    179, 176, 235, 137, 19, 194, 19, 157, 22, 190, 246, 210, 164, 178, 82, 223, 136, 205, 150, 169, 123, 242, 87, 135,
+    143, 46, 68, 132, 202, 227, 72, 249, 130, 61, 240, 21, 252, 10, 93, 180, 95, 134, 236, 140, 85, 66, 224, 87, 152,
+    174, 124, 26, 211, 109, 255, 71, 252, 158, 246, 218, 139, 188, 126, 167, 121, 67, 60, 176, 174, 63, 253, 175, 213,
+    64, 219, 9, 75, 34, 86, 208, 93, 170, 135, 110, 132, 103, 171, 226, 210, 104, 27, 159, 46, 81, 88, 241, 39, 234,
+    182, 164, 129, 3, 179, 180, 249, 234, 77, 240, 109, 247, 45, 41, 193, 198, 56, 113, 74, 106, 122, 251, 96, 175, 89,
+    141, 88, 247, 89, 141, 127, 127, 145, 74, 186, 158, 113, 61, 122, 112, 5, 220, 113, 100, 195, 239, 84, 47, 68, 113,
+    112, 59, 110, 184, 99, 26, 133, 81, 250, 250, 228, 37, 241, 179, 128, 53, 29, 37, 114, 40, 53, 237, 148, 176, 53,
+    63, 87, 50, 232, 203, 142, 69, 14, 55, 211, 255, 26, 5, 53, 147, 13, 134, 5, 73, 56, 219, 22, 236, 71, 187, 83, 199,
+    225, 205, 236, 221, 142, 217, 89, 209, 5, 74, 242, 170, 244, 1, 106, 24, 143, 127, 221, 52, 16, 191, 150, 116, 12,
+    67, 219, 207, 192, 218, 125, 198, 112, 66, 126, 106, 238, 62, 184, 227, 238, 252, 76, 180, 183, 175, 54, 37, 214,
+    228, 90, 163, 133, 45, 166, 231, 235, 161, 241, 95, 140, 103, 163, 244, 164, 239, 235, 196, 175, 141, 180, 111, 139,
+    135, 99, 39, 243, 210, 253, 154, 132, 133, 136, 226, 31, 110, 88, 201, 159, 35, 95, 240, 180, 88, 26, 236, 219, 59,
+    157, 34, 163, 100, 35, 4, 60, 202, 86, 148, 237, 139, 61, 32, 75, 86, 120, 248, 242, 85, 72, 126, 44, 62, 159, 93,
+    166, 157, 119, 86, 230, 22, 121, 163, 209, 23, 66, 72, 133, 177, 139, 226, 67, 43, 155, 46, 129, 34, 36, 148, 218,
+    230, 1, 221, 239, 188, 108, 216, 216, 82, 177, 12, 72, 82, 233, 19, 64, 215, 223, 131, 203, 231, 145, 154, 212, 183,
+    224, 246, 165, 92, 199, 203, 124, 170, 11, 50, 29, 119, 170, 98, 215, 154, 184, 84, 145, 212, 197, 244, 125, 192, 9,
+    234, 30, 163, 69, 149, 100, 228, 29, 65, 190, 73, 198, 210, 207, 8, 131, 247, 27, 213, 226, 108, 210, 234, 127, 141,
+    173, 34, 128, 156, 80, 131, 203, 243, 96, 237, 220, 21, 9, 114, 72, 217, 173, 214, 151, 124, 71, 184, 251, 228, 206,
+    24, 150, 187, 237, 223, 228, 70, 195, 240, 228, 225, 183, 63, 114, 162, 205, 161, 216, 61, 208, 246, 181, 99, 250,
+    152, 245, 247, 53, 127, 201, 198, 41, 184, 30, 97, 11, 201, 180, 63, 222, 19, 197, 76, 204, 119, 25, 29, 87, 97,
+    152, 24, 21, 178, 204, 117, 241, 28, 154, 17, 139, 189, 71, 218, 200, 197, 138, 188, 205, 8, 196, 241, 187, 229,
+    229, 26, 225, 7, 146, 243, 7, 34, 236, 50, 204, 151, 50, 89, 92, 82, 30, 86, 208, 173, 56, 161, 143, 82, 207, 122,
+    254, 18, 170, 22, 198, 43, 23, 202, 242, 26, 198, 147, 251, 94, 6, 145, 34, 121, 228, 68, 141, 223, 110, 2, 95, 144,
+    51, 159, 76, 128, 135, 88, 13, 185, 24, 54, 38, 248, 159, 70, 71, 117, 121, 170, 66, 13, 112, 134, 180, 190, 128,
+    118, 103, 64, 55, 226, 166, 215, 11, 174, 75, 124, 20, 54, 215, 189, 109, 97, 46, 181, 247, 248, 242, 20, 111, 60,
+    149, 253, 90, 212, 0, 74, 53, 217, 81, 105, 206, 43, 62, 58, 105, 194, 100, 66, 232, 242, 226, 195, 160, 56, 189,
+    126, 207, 183, 139, 153, 65, 158, 17, 157, 113, 83, 106, 163, 126, 134, 156, 232, 47, 101, 244, 213, 181, 24, 184,
+    108, 42, 48, 39, 133, 237, 17, 73, 241, 129, 240, 233, 169, 129, 62, 108, 169, 206, 23, 120, 174, 148, 87, 117, 100,
+    102, 145, 173, 58, 29, 191, 161, 136, 185, 11, 175, 144, 24, 179, 82, 202, 124, 4, 188, 58, 129, 208, 129, 141, 151,
+    108, 146, 214, 5, 51, 89, 140, 111, 88, 179, 46, 77, 138, 145, 7, 196, 145, 143, 251, 134, 40, 141, 69, 242, 83, 43,
+    177, 144, 247, 39, 235, 77, 112, 127, 158, 139, 182, 131, 29, 158, 162, 163, 239, 45, 93, 107, 105, 187, 133, 203,
+    100, 249, 45, 149, 254, 215, 193, 224, 159, 187, 146, 54, 14, 53, 150, 116, 245, 188, 253, 139, 218, 24, 158, 36,
+    215, 243, 127, 153, 40, 35, 204, 110, 122, 60, 195, 6, 186, 203, 102, 209, 151, 79, 172, 83, 203, 146, 154, 30, 22,
+    50, 29, 107, 133, 157, 34, 100, 125, 38, 179, 225, 220, 198, 32, 117, 134, 217, 119, 222, 123, 251, 159, 200, 70,
+    15, 219, 23, 13, 133, 219, 221, 148, 130, 32, 195, 195, 252, 76, 33, 137, 98, 132, 108, 121, 37, 78, 71, 142, 81,
+    248, 97, 14, 55, 11, 97, 241, 205, 146, 173, 11, 243, 34, 80, 7, 120, 76, 251, 104, 57, 177, 9, 152, 187, 197, 146,
+    40, 225, 87, 19, 47, 155, 113, 221, 184, 244, 180, 145, 86, 252, 70, 165, 26, 211, 38, 197, 45, 171, 191, 130, 130,
+    18, 169, 12, 4, 164, 223, 4, 62, 158, 83, 127, 109, 221, 67, 52, 132, 33, 49, 59, 240, 78, 10, 180, 25, 4, 46, 195,
+    15, 32, 94, 184, 82, 232, 189, 166, 164, 46, 193, 236, 107, 84, 62, 8, 21, 13, 52, 92, 51, 33, 118, 14, 86, 230,
+    203, 139, 48, 206, 125, 194, 65, 27, 144, 45, 132, 144, 49, 169, 63, 234, 6, 97, 142, 147, 79, 95, 15, 71, 130, 51,
+    236, 181, 250, 22, 181, 56, 138, 190, 32, 160, 90, 217, 99, 108, 83, 140, 214, 28, 249, 153, 232, 63, 187, 175, 195,
+    32, 233, 210, 79, 78, 36, 8, 89, 233, 71, 248, 23, 116, 96, 63, 142, 114, 70, 154, 66, 51, 189, 100, 80, 189, 38,
+    176, 92, 196, 65, 132, 162, 251, 114, 180, 144, 50, 137, 129, 64, 207, 184, 34, 55, 105, 235, 198, 76, 41, 24, 36,
+    242, 151, 147, 253, 17, 42, 106, 64, 154, 53, 214, 249, 3, 70, 32, 142, 161, 63, 54, 13, 224, 205, 185, 105, 88, 60,
+    220, 130, 243, 79, 236, 55, 185, 5, 238, 40, 142, 89, 233, 105, 227, 229, 139, 36, 56, 80, 110, 64, 42, 225, 61, 12,
+    231, 121, 92, 132, 84, 51, 94, 163, 124, 188, 151, 183, 112, 235, 64, 164, 193, 7, 160, 83, 42, 79, 92, 208, 138,
+    144, 141, 51, 64, 35, 152, 232, 59, 216, 249, 64, 217, 186, 245, 224, 113, 133, 28, 223, 119, 205, 139, 102, 124,
+    55, 219, 108, 208, 86, 164, 77, 83, 39, 147, 103, 43, 234, 175, 254, 170, 119, 26, 68, 20, 26, 149, 94, 72, 109,
+    235, 131, 192, 22, 81, 28, 71, 208, 6, 163, 67, 168, 46, 254, 187, 214, 51, 122, 47, 227, 220, 194, 149, 169, 62,
+    193, 96, 35, 121, 32, 10, 63, 229, 156, 184, 207, 125, 103, 195, 182, 226, 188, 167, 7, 31, 104, 214, 205, 86, 77,
+    218, 194, 32, 157, 224, 27, 230, 211, 253, 237, 67, 159, 19, 8, 198, 152, 217, 70, 211, 157, 137, 219, 92, 157, 152,
+    159, 137, 186, 205, 15, 5, 115, 32, 9, 171, 152, 116, 1, 32, 105, 237, 220, 177, 131, 41, 233, 97, 101, 163, 128,
+    213, 142, 240, 187, 41, 43, 92, 88, 235, 104, 56, 54, 160, 102, 239, 134, 37, 66, 32, 68, 246, 41, 72, 24, 123, 195,
+    248, 119, 84, 168, 145, 54, 89, 161, 74, 215, 230, 29, 138, 229, 191, 52, 24, 198, 10, 189, 50, 254, 152, 74, 130,
+    2, 39, 79, 208, 212, 233, 22, 22, 74, 117, 251, 99, 169, 21, 148, 163, 66, 27, 203, 74, 64, 130, 65, 255, 3, 11,
+    179, 202, 142, 194, 60, 143, 225, 135, 9, 21, 46, 143, 204, 31, 248, 146, 98, 252, 240, 157, 51, 182, 32, 39, 69,
+    98, 162, 184, 212, 180, 245, 55, 212, 25, 230, 89, 55, 212, 24, 224, 122, 120, 48, 135, 161, 205, 163, 62, 88, 164,
+    200, 19, 234, 241, 255, 149, 172, 88, 4, 77, 120, 141, 5, 142, 205, 53, 13, 130, 94, 99, 243, 247, 225, 178, 179,
+    145, 185, 147, 68, 15, 41, 101, 87, 22, 81, 125, 25, 88, 7, 137, 31, 145, 155, 40, 173, 12, 7, 55, 110, 207, 184,
+    63, 198, 138, 136, 37, 197, 103, 14, 90, 159, 95, 247, 19, 88, 222, 248, 145, 200, 244, 105, 171, 215, 176, 140,
+    185, 192, 109, 20, 160, 62, 96, 47, 59, 154, 150, 32, 124, 229, 37, 119, 225, 57, 16, 85, 63, 36, 66, 214, 101, 121,
+    38, 43, 72, 77, 107, 200, 121, 139, 151, 170, 127, 149, 41, 210, 12, 160, 143, 169, 50, 100, 158, 157, 177, 183,
+    214, 96, 111, 119, 210, 12, 185, 105, 38, 96, 246, 164, 41, 248, 139, 4, 27, 47, 28, 101, 61, 36, 31, 201, 65, 133,
+    245, 225, 16, 160, 90, 8, 74, 82, 95, 226, 228, 251, 225, 96, 69, 163, 26, 109, 5, 108, 209, 87, 252, 215, 18, 100,
+    198, 148, 146, 87, 55, 124, 169, 240, 251, 158, 15, 35, 125, 77, 136, 167, 19, 92, 59, 116, 67, 6, 89, 252, 76, 116,
+    199, 142, 167, 180, 200, 8, 9, 162, 5, 179, 148, 207, 255, 20, 208, 38, 57, 215, 93, 158, 120, 227, 124, 98, 59, 63,
+    241, 169, 124, 199, 166, 80, 39, 108, 64, 35, 43, 80, 140, 241, 54, 64, 116, 209, 18, 86, 232, 70, 254, 17, 241,
+    155, 174, 34, 220, 31, 233, 113, 162, 193, 52, 176, 209, 237, 13, 81, 165, 252, 104, 95, 102, 68, 132, 46, 97, 102,
+    138, 231, 56, 116, 186, 9, 90, 218, 184, 132, 187, 1, 229, 56, 103, 60, 171, 84, 240, 82, 24, 68, 81, 12, 146, 80,
+    15, 152, 161, 226, 21, 127, 168, 203, 61, 71, 5, 228, 80, 108, 113, 65, 91, 184, 64, 255, 10, 188, 28, 98, 161, 91,
+    161, 24, 150, 218, 227, 74, 117, 99, 246, 125, 60, 32, 168, 76, 146, 67, 74, 174, 28, 200, 236, 219, 148, 223, 53,
+    110, 106, 39, 67, 3, 237, 250, 219, 130, 238, 121, 224, 88, 205, 96, 110, 151, 106, 208, 238, 120, 109, 10, 231,
+    229, 55, 57, 45, 255, 100, 183, 123, 98, 253, 186, 74, 170, 61, 177, 219, 111, 117, 164, 198, 81, 22, 140, 190, 124,
+    112, 212, 172, 246, 68, 37, 130, 31, 56, 139, 46, 80, 159, 103, 20, 114, 146, 210, 89, 67, 197, 234, 181, 186, 49,
+    208, 94, 211, 43, 213, 117, 47, 243, 4, 223, 118, 224, 90, 95, 236, 229, 28, 150, 84, 19, 66, 92, 11, 2, 189, 51,
+    111, 41, 222, 143, 19, 145, 31, 13, 82, 149, 230, 220, 218, 138, 124, 22, 8, 183, 64, 219, 193, 49, 11, 37, 18, 245,
+    137, 37, 187, 244, 235, 211, 69, 186, 159, 171, 137, 83, 222, 214, 187, 61, 14, 240, 123, 235, 228, 165, 186, 20,
+    95, 255, 93, 226, 234, 54, 230, 161, 23, 237, 228, 195, 50, 29, 70, 250, 67, 197, 22, 171, 42, 40, 196, 215, 201,
+    207, 72, 6, 156, 177, 8, 236, 46, 84, 36, 131, 113, 250, 99, 179, 117, 191, 26, 105, 61, 170, 148, 151, 134, 58, 26,
+    200, 221, 168, 166, 195, 238, 67, 158, 22, 251, 250, 106, 213, 182, 89, 91, 229, 183, 173, 250, 27, 25, 102, 75, 13,
+    183, 210, 106, 96, 12, 254, 116, 213, 240, 33, 161, 5, 229, 142, 76, 72, 78, 99, 154, 122, 111, 123, 136, 116, 235,
+    26, 244, 255, 195, 183, 172, 166, 60, 36, 120, 172, 122, 27, 239, 217, 248, 112, 205, 244, 100, 29, 186, 252, 94,
+    157, 216, 78, 36, 19, 199, 39, 192, 91, 30, 190, 229, 55, 114, 95, 48, 102, 9, 110, 95, 229, 219, 5, 112, 76, 23,
+    81, 255, 23, 93, 45, 146, 244, 115, 180, 201, 213, 54, 221, 195, 90, 209, 229, 226, 104, 30, 244, 229, 114, 150, 81,
+    55, 174, 214, 52, 119, 147, 35, 117, 73, 70, 169, 98, 204, 59, 109, 134, 247, 198, 46, 128, 132, 1, 139, 11, 2, 119,
+    29, 22, 23, 87, 181, 45, 97, 88, 220, 203, 121, 50, 178, 238, 202, 201, 90, 51, 57, 156, 85, 22, 140, 91, 160, 212,
+    68, 216, 213, 234, 102, 12, 26, 213, 13, 123, 214, 80, 157, 119, 16, 29, 146, 242, 154, 215, 39, 80, 148, 2, 199,
+    97, 167, 122, 88, 92, 192, 215, 172, 153, 176, 88, 77, 254, 52, 246, 167, 252, 21, 38, 185, 68, 151, 94, 21, 61,
+    172, 41, 74, 134, 64, 176, 153, 222, 21, 81, 104, 132, 121, 146, 49, 31, 240, 51, 51, 26, 169, 0, 60, 198, 82, 161,
+    108, 254, 68, 5, 49, 59, 131, 22, 217, 249, 181, 208, 186, 29, 64, 217, 92, 153, 91, 5, 65, 95, 189, 254, 170, 0,
+    174, 70, 224, 32, 193, 19, 54, 112, 130, 44, 245, 171, 228, 73, 153, 165, 248, 204, 179, 182, 120, 137, 176, 25,
+    156, 18, 15, 83, 121, 221, 185, 83, 254, 73, 243, 145, 211, 64, 131, 38, 110, 229, 160, 156, 158, 196, 160, 113, 52,
+    119, 16, 225, 130, 102, 240, 134, 46, 101, 182, 241, 72, 188, 111, 2, 3, 32, 78, 231, 133, 91, 114, 58, 213, 104,
+    193, 108, 150, 81, 180, 76, 31, 156, 151, 44, 44, 54, 59, 42, 15, 90, 31, 100, 75, 20, 64, 185, 224, 176, 75, 155,
+    60, 184, 22, 43, 116, 36, 212, 232, 12, 249, 20, 82, 80, 100, 171, 182, 144, 74, 151, 106, 1, 30, 99, 242, 58, 206,
+    211, 50, 191, 166, 25, 39, 238, 97, 214, 161, 128, 224, 83, 205, 225, 245, 5, 107, 187, 183, 48, 126, 192, 133, 25,
+    67, 193, 92, 224, 93, 88, 204, 63, 57, 252, 81, 221, 126, 155, 55, 85, 11, 172, 250, 197, 8, 178, 19, 8, 158, 139,
+    20, 156, 201, 139, 229, 176, 18, 120, 163, 190, 69, 206, 250, 204, 56, 249, 188, 220, 197, 37, 181, 162, 134, 22,
+    36, 233, 4, 85, 45, 103, 132, 2, 37, 199, 220, 8, 66, 93, 251, 206, 124, 193, 76, 26, 178, 132, 83, 212, 55, 238,
+    237, 112, 26, 216, 5, 183, 87, 189, 75, 15, 178, 218, 15, 73, 155, 230, 44, 40, 212, 193, 118, 60, 220, 200, 208,
+    43, 104, 122, 211, 151, 153, 195, 92, 196, 166, 142, 89, 37, 3, 36, 212, 54, 199, 188, 208, 240, 162, 146, 124, 204,
+    18, 139, 40, 106, 30, 81, 150, 176, 164, 179, 140, 221, 138, 8, 114, 44, 90, 136, 226, 232, 34, 32, 195, 106, 115,
+    210, 212, 75, 58, 113, 138, 91, 67, 184, 187, 114, 80, 122, 19, 148, 57, 39, 131, 32, 1, 32, 23, 88, 57, 234, 74,
+    214, 174, 143, 216, 101, 238, 211, 112, 154, 76, 166, 0, 197, 65, 143, 8, 243, 104, 233, 92, 151, 211, 230, 37, 31,
+    133, 4, 129, 86, 135, 164, 243, 87, 46, 99, 103, 103, 224, 66, 160, 245, 112, 203, 192, 155, 236, 113, 252, 33, 107,
+    215, 174, 215, 146, 93, 216, 59, 17, 99, 72, 237, 54, 233, 110, 97, 210, 23, 32, 70, 242, 235, 47, 21, 44, 10, 251,
+    57, 107, 190, 151, 232, 186, 206, 235, 35, 175, 55, 202, 77, 39, 144, 29, 244, 97, 122, 34, 56, 48, 222, 93, 141,
+    126, 24, 209, 33, 145, 253, 82, 125, 90, 199, 201, 252, 235, 143, 64, 39, 150, 184, 224, 8, 220, 89, 54, 24, 65, 45,
+    167, 92, 158, 140, 185, 71, 254, 74, 7, 95, 90, 70, 173, 81, 202, 7, 21, 7, 82, 143, 234, 232, 101, 146, 172, 250,
+    220, 141, 87, 1, 140, 156, 36, 190, 69, 26, 19, 253, 153, 120, 60, 202, 237, 51, 0, 223, 173, 226, 118, 136, 131,
+    197, 28, 155, 229, 215, 197, 49, 209, 147, 139, 224, 24, 114, 195, 143, 162, 216, 245, 230, 105, 11, 35, 218, 109,
+    133, 187, 243, 143, 205, 252, 165, 106, 173, 10, 155, 220, 110, 44, 155, 62, 134, 15, 154, 226, 242, 234, 243, 123,
+    76, 232, 108, 162, 197, 195, 153, 237, 169, 156, 12, 104, 100, 41, 85, 92, 18, 138, 9, 198, 15, 136, 21, 210, 215,
+    129, 45, 214, 185, 189, 82, 138, 72, 37, 181, 208, 143, 44, 231, 47, 216, 12, 86, 221, 236, 94, 53, 99, 68, 215, 96,
+    234, 124, 160, 31, 80, 213, 113, 251, 189, 22, 181, 209, 184, 139, 250, 88, 117, 5, 76, 126, 46, 56, 147, 131, 173,
+    224, 82, 63, 210, 4, 74, 205, 6, 105, 44, 241, 98, 54, 108, 175, 43, 248, 209, 210, 247, 32, 220, 208, 21, 57, 171,
+    28, 127, 171, 112, 174, 38, 77, 234, 161, 109, 218, 157, 79, 7, 121, 235, 153, 31, 7, 215, 147, 135, 203, 117, 89,
+    238, 205, 51, 197, 221, 194, 197, 105, 21, 91, 151, 145, 39, 213, 248, 245, 34, 171, 130, 71, 98, 96, 70, 67, 157,
+    131, 161, 168, 20, 24, 193, 8, 50, 203, 186, 145, 253, 245, 96, 143, 15, 178, 77, 154, 190, 143, 59, 38, 206, 104,
+    237, 177, 152, 50, 150, 196, 214, 114, 90, 237, 248, 27, 84, 81, 3, 183, 119, 228, 143, 83, 105, 183, 101, 146, 135,
+    79, 114, 177, 195, 43, 250, 24, 234, 40, 241, 27, 207, 16, 125, 17, 112, 8, 108, 8, 177, 43, 88, 183, 25, 135, 193,
+    2, 162, 50, 68, 181, 67, 163, 225, 25, 70, 214, 61, 208, 35, 33, 209, 172, 148, 241, 109, 61, 49, 231, 167, 185, 16,
+    176, 245, 12, 118, 21, 184, 223, 94, 16, 111, 234, 27, 18, 123, 128, 4, 173, 48, 148, 160, 147, 89, 215, 170, 1,
+    138, 160, 30, 175, 120, 239, 37, 187, 72, 12, 209, 199, 246, 116, 228, 79, 18, 76, 164, 117, 223, 159, 222, 27, 208,
+    224, 191, 167, 170, 12, 199, 133, 223, 106, 254, 75, 212, 211, 8, 138, 69, 222, 76, 106, 16, 247, 125, 69, 189, 125,
+    203, 148, 237, 86, 235, 143, 161, 197, 218, 92, 211, 147, 91, 232, 37, 248, 221, 114, 110, 19, 71, 128, 16, 98, 191,
+    217, 137, 170, 23, 240, 117, 66, 173, 189, 113, 204, 146, 121, 224, 186, 221, 239, 118, 175, 116, 28, 132, 208, 104,
+    243, 167, 69, 248, 9, 71, 163, 70, 182, 7, 182, 11, 123, 58, 140, 130, 54, 38, 193, 85, 100, 222, 108, 22, 4, 65,
+    34, 91, 96, 35, 24, 52, 193, 215, 86, 95, 43, 196, 191, 75, 181, 83, 56, 76, 213, 98, 118, 251, 122, 146, 113, 238,
+    56, 181, 237, 156, 42, 133, 176, 205, 181, 179, 189, 147, 5, 0, 178, 238, 38, 14, 98, 132, 8, 139, 7, 13, 149, 238,
+    76, 185, 48, 191, 71, 106, 106, 185, 228, 139, 190, 20, 28, 102, 7, 190, 145, 84, 146, 213, 60, 136, 199, 55, 115,
+    68, 219, 163, 43, 140, 159, 203, 253, 188, 52, 34, 162, 56, 242, 38, 209, 224, 6, 78, 123, 87, 41, 88, 165, 3, 21,
+    236, 37, 174, 102, 40, 91, 120, 204, 52, 93, 20, 158, 209, 244, 11, 40, 242, 72, 58, 47, 69, 234, 24, 141, 145, 220,
+    73, 31, 78, 191, 255, 86, 132, 84, 139, 248, 161, 231, 171, 35, 131, 65, 249, 238, 9, 195, 201, 90, 83, 223, 247,
+    177, 61, 29, 247, 102, 111, 129, 162, 70, 190, 67, 48, 186, 187, 80, 237, 54, 157, 201, 244, 52, 14, 163, 92, 146,
+    112, 142, 166, 111, 73, 255, 208, 146, 204, 27, 12, 136, 237, 79, 196, 49, 202, 153, 70, 30, 183, 141, 93, 120, 176,
+    94, 201, 235, 211, 115, 12, 25, 209, 225, 38, 190, 171, 192, 118, 121, 182, 140, 155, 111, 128, 70, 255, 189, 158,
+    50, 38, 113, 83, 161, 221, 85, 156, 37, 224, 83, 43, 77, 99, 200, 196, 207, 83, 168, 55, 225, 125, 110, 107, 208,
+    90, 138, 159, 113, 169, 226, 240, 234, 228, 6, 47, 105, 18, 249, 20, 58, 56, 18, 196, 154, 164, 93, 243, 250, 188,
+    126, 54, 71, 251, 87, 46, 118, 216, 215, 246, 194, 131, 191, 140, 16, 54, 250, 75, 85, 237, 143, 200, 141, 128, 210,
+    211, 1, 79, 189, 192, 104, 58, 96, 172, 24, 202, 205, 168, 162, 36, 58, 9, 69, 115, 34, 225, 7, 38, 0, 31, 39, 209,
+    86, 85, 145, 35, 148, 195, 47, 201, 236, 189, 197, 173, 216, 153, 163, 177, 34, 31, 116, 175, 50, 46, 173, 23, 244,
+    168, 242, 209, 54, 17, 159, 56, 100, 28, 19, 250, 159, 34, 29, 172, 38, 110, 161, 208, 3, 12, 103, 154, 116, 79, 17,
+    62, 251, 245, 177, 255, 206, 232, 249, 119, 167, 147, 97, 42, 60, 120, 38, 59, 219, 90, 230, 19, 121, 151, 171, 32,
+    165, 12, 242, 53, 252, 42, 120, 124, 123, 30, 172, 106, 138, 150, 10, 194, 245, 243, 47, 130, 170, 98, 27, 37, 216,
+    8, 31, 4, 172, 83, 203, 175, 33, 123, 163, 243, 85, 164, 172, 142, 85, 190, 106, 100, 104, 242, 123, 96, 34, 81,
+    209, 244, 176, 9, 170, 14, 98, 45, 1, 64, 253, 60, 244, 37, 205, 206, 9, 72, 90, 41, 89, 79, 250, 103, 124, 181,
+    107, 136, 164, 64, 103, 215, 203, 53, 77, 222, 141, 31, 208, 140, 189, 6, 120, 205, 131, 106, 99, 137, 100, 165,
+    121, 245, 58, 127, 68, 146, 144, 169, 173, 236, 235, 115, 198, 8, 177, 61, 63, 94, 251, 98, 50, 187, 123, 126, 132,
+    60, 59, 84, 85, 67, 146, 163, 81, 39, 149, 250, 83, 255, 225, 215, 187, 87, 108, 235, 126, 115, 95, 101, 201, 243,
+    245, 247, 68, 96, 104, 120, 6, 200, 56, 56, 207, 215, 64, 28, 26, 59, 118, 51, 221, 70, 127, 221, 134, 77, 226, 236,
+    115, 88, 146, 116, 190, 22, 135, 7, 222, 116, 50, 150, 218, 111, 174, 139, 58, 140, 213, 147, 69, 34, 167, 159, 161,
+    55, 120, 132, 62, 45, 65, 100, 166, 227, 73, 231, 110, 158, 134, 243, 248, 100, 208, 9, 180, 63, 36, 203, 28, 244,
+    243, 0, 105, 209, 109, 85, 72, 164, 200, 125, 199, 222, 169, 115, 1, 246, 157, 233, 181, 124, 168, 236, 150, 58,
+    151, 165, 132, 3, 119, 103, 217, 238, 91, 166, 8, 15, 87, 162, 57, 36, 143, 111, 183, 49, 85, 182, 40, 120, 51, 119,
+    173, 94, 32, 166, 14, 29, 126, 170, 25, 215, 157, 20, 51, 190, 37, 248, 110, 155, 157, 93, 3, 37, 6, 251, 163, 10,
+    194, 193, 44, 60, 215, 241, 130, 155, 222, 68, 123, 192, 81, 40, 53, 230, 119, 155, 126, 102, 253, 21, 119, 113,
+    108, 194, 157, 218, 113, 69, 119, 85, 97, 239, 196, 180, 245, 137, 144, 7, 161, 137, 115, 53, 35, 16, 92, 230, 238,
+    126, 205, 108, 115, 12, 126, 224, 222, 21, 248, 185, 191, 34, 167, 208, 199, 157, 145, 202, 243, 225, 228, 36, 47,
+    19, 34, 5, 38, 128, 156, 20, 193, 226, 80, 236, 235, 173, 28, 182, 63, 31, 203, 211, 47, 110, 96, 6, 203, 156, 48,
+    99, 177, 38, 141, 157, 67, 184, 245, 38, 99, 43, 93, 210, 196, 112, 214, 182, 152, 119, 136, 160, 54, 11, 74, 170,
+    75, 209, 85, 75, 157, 147, 207, 97, 176, 151, 93, 161, 182, 72, 245, 74, 63, 236, 62, 234, 139, 223, 250, 71, 218,
+    54, 132, 247, 111, 234, 59, 197, 42, 139, 101, 250, 23, 203, 45, 112, 109, 131, 48, 236, 148, 126, 33, 186, 98, 77,
+    52, 68, 207, 169, 178, 236, 42, 194, 128, 67, 1, 154, 39, 226, 51, 86, 173, 231, 230, 12, 28, 64, 58, 83, 222, 82,
+    242, 7, 24, 133, 122, 33, 212, 185, 64, 194, 32, 233, 81, 120, 47, 240, 232, 105, 222, 130, 21, 252, 236, 71, 96,
+    166, 229, 220, 150, 144, 62, 104, 43, 182, 36, 21, 41, 7, 18, 152, 204, 192, 100, 9, 154, 32, 78, 72, 224, 25, 91,
+    99, 178, 102, 192, 205, 195, 222, 247, 83, 33, 15, 74, 4, 124, 31, 195, 87, 204, 73, 207, 177, 63, 12, 160, 247,
+    164, 88, 87, 118, 137, 206, 179, 79, 181, 66, 254, 88, 136, 19, 52, 132, 241, 67, 143, 75, 199, 240, 13, 83, 110,
+    53, 246, 220, 1, 201, 203, 104, 227, 175, 45, 186, 62, 219, 83, 210, 57, 238, 245, 12, 169, 5, 74, 233, 21, 40, 61,
+    236, 45, 117, 150, 93, 133, 43, 207, 34, 79, 189, 120, 125, 73, 205, 103, 58, 234, 33, 218, 187, 30, 101, 229, 131,
+    164, 93, 40, 221, 35, 234, 89, 178, 173, 40, 153, 189, 66, 53, 73, 115, 172, 44, 230, 170, 112, 18, 63, 124, 133,
+    196, 253, 25, 215, 39, 221, 240, 159, 86, 39, 35, 56, 247, 223, 100, 162, 108, 229, 205, 76, 29, 98, 8, 182, 57,
+    249, 51, 248, 82, 176, 5, 109, 193, 251, 120, 50, 247, 68, 190, 144, 33, 183, 236, 48, 84, 224, 89, 45, 227, 92, 73,
+    229, 92, 11, 231, 159, 152, 216, 140, 90, 214, 27, 67, 118, 138, 65, 194, 52, 226, 94, 24, 100, 152, 92, 91, 69,
+    164, 129, 76, 48, 233, 150, 133, 210, 155, 74, 37, 22, 216, 122, 206, 231, 182, 171, 187, 190, 209, 42, 141, 85,
+    197, 192, 142, 170, 38, 182, 37, 124, 234, 195, 63, 167, 131, 195, 6, 249, 76, 35, 159, 155, 227, 137, 177, 77, 232,
+    211, 213, 11, 235, 107, 30, 6, 38, 207, 171, 115, 66, 102, 177, 253, 179, 17, 155, 244, 57, 85, 198, 250, 249, 76,
+    54, 28, 144, 46, 185, 17, 150, 12, 200, 83, 88, 75, 19, 27, 208, 102, 240, 121, 49, 233, 148, 162, 152, 27, 167, 80,
+    122, 33, 109, 1, 168, 88, 124, 140, 19, 180, 203, 26, 236, 40, 214, 254, 58, 84, 134, 208, 242, 126, 18, 24, 75,
+    111, 245, 145, 76, 212, 154, 76, 251, 127, 8, 6, 144, 62, 188, 115, 112, 161, 102, 111, 67, 60, 49, 237, 72, 112,
+    144, 71, 238, 59, 182, 101, 92, 227, 57, 255, 68, 50, 45, 58, 254, 89, 34, 21, 191, 160, 6, 13, 229, 173, 124, 179,
+    238, 27, 98, 154, 117, 191, 10, 216, 129, 90, 172, 212, 77, 135, 177, 16, 161, 32, 45, 71, 183, 26, 253, 228, 54,
+    189, 77, 165, 140, 145, 200, 37, 28, 67, 4, 175, 32, 65, 57, 204, 4, 141, 83, 113, 201, 200, 16, 117, 111, 246, 100,
+    39, 174, 76, 208, 175, 120, 3, 199, 3, 107, 16, 170, 253, 182, 33, 244, 236, 214, 230, 193, 222, 115, 196, 0, 143,
+    125, 183, 235, 43, 0, 205, 61, 236, 131, 55, 8, 20, 159, 198, 227, 91, 99, 44, 117, 206, 22, 141, 121, 116, 163,
+    172, 79, 180, 207, 197, 85, 142, 185, 216, 184, 45, 7, 19, 71, 214, 198, 236, 57, 78, 182, 106, 20, 143, 220, 50,
+    44, 75, 200, 186, 46, 233, 233, 202, 88, 184, 228, 11, 206, 14, 182, 189, 73, 40, 200, 38, 248, 135, 146, 82, 25,
+    206, 122, 159, 96, 83, 41, 39, 212, 131, 252, 243, 213, 194, 20, 239, 89, 219, 233, 142, 238, 255, 31, 109, 30, 127,
+    168, 126, 179, 21, 16, 57, 35, 2, 76, 162, 65, 129, 35, 222, 49, 5, 17, 223, 120, 110, 240, 15, 16, 140, 200, 93,
+    15, 132, 28, 73, 130, 161, 171, 175, 181, 57, 21, 228, 147, 212, 253, 201, 183, 200, 157, 13, 24, 75, 7, 177, 156,
+    19, 66, 179, 7, 247, 5, 76, 2, 147, 163, 77, 39, 203, 228, 20, 18, 5, 190, 163, 100, 49, 27, 86, 237, 34, 77, 127,
+    162, 65, 129, 184, 3, 227, 110, 192, 174, 19, 214, 226, 43, 103, 155, 111, 67, 46, 92, 5, 77, 199, 47, 8, 25, 230,
+    204, 162, 207, 56, 74, 30, 227, 106, 185, 118, 15, 39, 220, 160, 72, 70, 21, 60, 85, 56, 230, 6, 215, 172, 140, 4,
+    52, 13, 69, 137, 181, 250, 63, 209, 31, 146, 28, 210, 30, 177, 221, 7, 143, 167, 59, 131, 204, 87, 42, 170, 176, 73,
+    3, 44, 31, 153, 237, 121, 60, 15, 157, 246, 249, 164, 184, 92, 107, 90, 3, 68, 110, 53, 177, 207, 252, 59, 233, 231,
+    224, 124, 103, 40, 190, 248, 11, 106, 215, 221, 124, 130, 97, 16, 155, 78, 68, 95, 96, 64, 12, 227, 182, 87, 199,
+    187, 251, 93, 1, 11, 21, 78, 209, 48, 179, 170, 88, 162, 205, 229, 234, 229, 112, 148, 183, 193, 163, 184, 236, 169,
+    190, 250, 217, 140, 163, 7, 34, 13, 69, 102, 181, 143, 122, 129, 7, 91, 87, 37, 16, 219, 43, 71, 153, 90, 252, 231,
+    118, 123, 3, 135, 4, 122, 10, 149, 191, 179, 83, 8, 233, 62, 198, 169, 38, 71, 147, 16, 222, 97, 204, 48, 24, 175,
+    126, 28, 233, 226, 199, 96, 177, 73, 179, 195, 192, 6, 34, 241, 107, 84, 84, 33, 251, 210, 137, 38, 148, 27, 132,
+    200, 66, 28, 216, 36, 82, 163, 134, 218, 169, 240, 166, 70, 32, 245, 24, 76, 193, 253, 15, 46, 126, 226, 210, 76,
+    93, 248, 72, 122, 183, 192, 248, 83, 19, 120, 61, 140, 179, 159, 46, 172, 218, 151, 25, 118, 144, 252, 241, 128, 53,
+    197, 208, 189, 60, 131, 108, 87, 147, 223, 137, 178, 110, 216, 228, 211, 172, 211, 76, 172, 244, 111, 219, 170, 66,
+    139, 141, 135, 180, 12, 13, 139, 86, 132, 80, 108, 224, 15, 222, 94, 23, 84, 185, 249, 116, 144, 179, 8, 56, 218,
+    53, 44, 104, 63, 12, 88, 94, 182, 194, 84, 37, 26, 132, 187, 162, 179, 90, 144, 252, 232, 119, 255, 77, 61, 102,
+    161, 17, 55, 248, 176, 157, 186, 146, 34, 225, 144, 30, 139, 204, 147, 55, 223, 175, 137, 151, 84, 0, 202, 121, 176,
+    245, 66, 85, 2, 250, 73, 132, 193, 104, 7, 103, 91, 252, 144, 45, 208, 181, 46, 37, 208, 59, 252, 204, 72, 5, 76,
+    202, 64, 6, 155, 102, 156, 0, 223, 134, 16, 89, 43, 108, 223, 16, 64, 3, 226, 62, 54, 138, 83, 141, 243, 54, 72,
+    122, 195, 227, 10, 92, 20, 156, 11, 81, 26, 97, 138, 82, 201, 222, 163, 33, 132, 155, 143, 126, 36, 174, 51, 9, 41,
+    110, 104, 27, 8, 109, 212, 87, 160, 157, 98, 70, 71, 168, 251, 254, 8, 97, 113, 115, 129, 168, 215, 57, 190, 18,
+    155, 61, 204, 6, 4, 17, 238, 184, 162, 113, 248, 226, 184, 44, 238, 208, 221, 179, 55, 186, 17, 30, 7, 221, 75, 194,
+    190, 216, 6, 153, 87, 101, 36, 130, 106, 100, 89, 231, 10, 79, 89, 127, 167, 32, 49, 86, 183, 251, 130, 249, 151,
+    138, 3, 73, 196, 205, 213, 147, 215, 215, 9, 226, 127, 152, 63, 113, 128, 51, 220, 177, 11, 84, 82, 251, 38, 27,
+    232, 169, 102, 172, 240, 143, 43, 134, 193, 26, 196, 58, 125, 46, 205, 167, 224, 0, 167, 148, 236, 41, 201, 61, 164,
+    175, 158, 11, 94, 50, 212, 226, 253, 128, 157, 57, 116, 212, 223, 68, 6, 202, 183, 119, 193, 210, 115, 198, 106, 80,
+    255, 183, 205, 86, 89, 201, 180, 175, 184, 54, 128, 52, 186, 199, 48, 205, 116, 245, 0, 150, 191, 14, 53, 194, 104,
+    192, 204, 154, 14, 116, 239, 249, 136, 152, 239, 8, 68, 251, 237, 148, 219, 140, 244, 220, 243, 31, 17, 59, 18, 206,
+    203, 25, 180, 172, 59, 82, 240, 135, 141, 140, 74, 34, 4, 151, 69, 6, 219, 88, 117, 174, 30, 166, 23, 35, 111, 254,
+    73, 234, 253, 117, 193, 187, 0, 178, 254, 173, 189, 62, 199, 113, 122, 243, 192, 205, 168, 246, 124, 198, 250, 182,
+    177, 81, 223, 41, 149, 197, 86, 229, 181, 174, 210, 182, 147, 94, 248, 44, 140, 130, 195, 201, 162, 20, 238, 249,
+    198, 19, 39, 231, 152, 153, 78, 97, 59, 10, 227, 254, 27, 141, 207, 58, 98, 144, 120, 224, 29, 219, 65, 157, 136,
+    46, 158, 147, 123, 208, 10, 152, 199, 194, 122, 254, 145, 214, 0, 225, 207, 99, 2, 51, 218, 111, 87, 77, 51, 78,
+    103, 124, 105, 141, 234, 237, 68, 111, 231, 5, 80, 215, 215, 210, 18, 175, 131, 53, 230, 235, 156, 174, 61, 155, 77,
+    26, 109, 215, 191, 118, 63, 93, 212, 219, 136, 92, 231, 71, 128, 5, 176, 166, 171, 131, 245, 91, 98, 211, 246, 154,
+    252, 95, 254, 77, 150, 177, 63, 36, 122, 59, 25, 243, 80, 125, 129, 201, 32, 47, 108, 21, 169, 144, 169, 62, 126,
+    29, 38, 229, 61, 40, 75, 193, 253, 107, 128, 217, 154, 208, 186, 91, 81, 23, 11, 3, 237, 113, 3, 98, 207, 122, 102,
+    159, 36, 174, 44, 182, 99, 44, 21, 9, 232, 198, 67, 160, 45, 203, 95, 183, 59, 111, 243, 3, 159, 171, 153, 239, 100,
+    25, 62, 27, 235, 78, 224, 6, 146, 85, 80, 239, 41, 248, 206, 42, 59, 171, 162, 138, 228, 102, 121, 0, 27, 253, 65,
+    187, 225, 81, 27, 127, 234, 199, 170, 154, 30, 228, 123, 125, 54, 138, 239, 223, 253, 91, 33, 163, 8, 143, 110, 26,
+    123, 230, 160, 63, 142, 56, 26, 34, 254, 4, 10, 133, 81, 237, 108, 57, 52, 140, 29, 139, 50, 116, 181, 93, 206, 147,
+    196, 253, 157, 10, 227, 122, 128, 90, 175, 64, 249, 156, 102, 97, 230, 99, 38, 160, 91, 147, 218, 73, 216, 236, 192,
+    132, 0, 223, 11, 229, 214, 30, 108, 201, 206, 37, 204, 187, 86, 92, 157, 239, 153, 169, 133, 68, 228, 195, 248, 110,
+    43, 135, 41, 95, 152, 64, 148, 113, 139, 81, 15, 0, 45, 103, 252, 16, 63, 119, 167, 106, 248, 226, 68, 145, 142,
+    113, 33, 130, 250, 221, 133, 163, 251, 83, 155, 252, 208, 73, 209, 209, 230, 1, 90, 94, 186, 69, 178, 235, 208, 118,
+    243, 138, 32, 60, 252, 122, 15, 227, 174, 28, 251, 20, 205, 240, 151, 131, 26, 29, 84, 164, 127, 229, 54, 24, 152,
+    167, 134, 19, 101, 50, 212, 164, 153, 228, 195, 195, 18, 193, 20, 6, 195, 48, 15, 166, 150, 82, 235, 168, 108, 45,
+    140, 181, 211, 230, 130, 211, 38, 119, 186, 145, 109, 125, 156, 87, 71, 94, 118, 189, 63, 35, 227, 25, 31, 127, 210,
+    209, 132, 227, 235, 156, 80, 115, 33, 231, 17, 130, 59, 161, 38, 253, 217, 140, 67, 122, 88, 254, 69, 224, 29, 2,
+    116, 4, 232, 113, 4, 84, 83, 200, 10, 234, 187, 201, 170, 135, 73, 18, 198, 39, 181, 88, 38, 145, 134, 105, 206,
+    106, 227, 156, 77, 46, 38, 30, 36, 79, 5, 145, 70, 22, 128, 148, 182, 241, 189, 20, 94, 93, 27, 23, 232, 173, 70,
+    218, 116, 243, 242, 76, 248, 147, 93, 50, 37, 8, 41, 78, 0, 201, 53, 18, 109, 222, 99, 67, 120, 54, 132, 154, 157,
+    18, 27, 183, 212, 101, 37, 45, 65, 130, 31, 88, 93, 204, 50, 24, 76, 101, 58, 254, 219, 206, 62, 167, 13, 182, 97,
+    187, 81, 49, 198, 61, 133, 122, 96, 130, 77, 15, 225, 60, 197, 189, 152, 166, 6, 141, 175, 81, 166, 183, 161, 57,
+    149, 235, 48, 84, 210, 198, 140, 204, 254, 146, 243, 234, 189, 191, 123, 39, 92, 226, 55, 144, 116, 60, 62, 133,
+    207, 151, 251, 195, 224, 83, 31, 166, 42, 224, 69, 186, 97, 72, 72, 62, 150, 178, 153, 164, 125, 8, 48, 66, 38, 217,
+    52, 165, 133, 98, 135, 23, 174, 70, 213, 67, 172, 0, 252, 23, 248, 210, 61, 98, 254, 8, 33, 97, 83, 37, 10, 149,
+    123, 21, 55, 110, 148, 216, 115, 240, 29, 174, 176, 177, 103, 83, 76, 218, 108, 149, 154, 113, 179, 131, 133, 94, 2,
+    163, 12, 42, 196, 8, 104, 107, 86, 134, 182, 179, 109, 248, 214, 4, 7, 20, 93, 89, 5, 170, 147, 225, 75, 234, 52,
+    181, 194, 235, 159, 114, 32, 255, 119, 110, 206, 179, 109, 232, 9, 238, 139, 75, 147, 36, 125, 165, 39, 70, 119,
+    132, 103, 247, 223, 208, 209, 91, 217, 42, 180, 41, 49, 77, 199, 13, 132, 198, 83, 239, 164, 241, 156, 240, 223, 21,
+    248, 223, 230, 23, 133, 120, 42, 65, 78, 67, 143, 213, 42, 152, 245, 214, 213, 255, 129, 248, 3, 170, 130, 166, 222,
+    166, 202, 142, 75, 217, 27, 38, 230, 179, 101, 110, 11, 96, 28, 220, 114, 136, 111, 86, 24, 208, 230, 167, 198, 184,
+    119, 39, 1, 2, 21, 195, 77, 113, 214, 251, 35, 153, 49, 134, 152, 42, 244, 82, 209, 224, 254, 0, 226, 48, 90, 113,
+    210, 133, 255, 33, 32, 177, 49, 5, 211, 47, 172, 84, 74, 202, 163, 238, 134, 161, 91, 59, 157, 34, 219, 25, 9, 249,
+    192, 66, 7, 18, 158, 160, 236, 43, 189, 63, 182, 116, 101, 75, 236, 120, 52, 99, 239, 242, 198, 63, 126, 41, 242,
+    186, 133, 136, 18, 193, 195, 238, 88, 92, 85, 228, 195, 156, 81, 242, 72, 30, 221, 169, 44, 223, 194, 195, 149, 37,
+    112, 25, 169, 244, 45, 156, 62, 178, 182, 108, 100, 176, 82, 1, 234, 182, 74, 28, 36, 103, 65, 92, 151, 32, 201,
+    166, 195, 169, 91, 212, 137, 7, 50, 85, 105, 13, 76, 160, 212, 146, 34, 94, 88, 81, 40, 168, 145, 181, 203, 95, 63,
+    128, 241, 151, 110, 139, 59, 161, 239, 12, 4, 59, 154, 158, 235, 138, 53, 50, 238, 191, 248, 84, 100, 113, 158, 104,
+    141, 94, 83, 65, 156, 244, 198, 56, 204, 249, 95, 224, 51, 71, 247, 228, 243, 89, 161, 106, 193, 191, 178, 54, 39,
+    80, 5, 38, 192, 231, 119, 43, 104, 43, 138, 205, 10, 200, 80, 220, 105, 161, 226, 122, 95, 155, 175, 43, 124, 161,
+    71, 153, 184, 7, 82, 77, 67, 186, 101, 212, 38, 31, 40, 165, 209, 126, 155, 124, 78, 80, 36, 203, 100, 112, 113, 80,
+    235, 92, 250, 195, 194, 235, 64, 181, 18, 17, 43, 139, 31, 10, 103, 169, 135, 121, 127, 163, 86, 182, 37, 171, 128,
+    189, 145, 186, 26, 130, 137, 112, 28, 11, 227, 187, 80, 103, 208, 207, 219, 57, 112, 14, 26, 129, 186, 76, 86, 92,
+    18, 6, 242, 8, 218, 116, 102, 137, 225, 105, 163, 203, 113, 253, 73, 226, 143, 14, 53, 154, 92, 215, 56, 45, 213, 0,
+    156, 152, 235, 49, 87, 100, 76, 89, 209, 115, 236, 0, 163, 153, 151, 245, 231, 38, 176, 171, 193, 127, 204, 93, 72,
+    54, 96, 194, 66, 109, 183, 169, 93, 222, 32, 16, 22, 6, 165, 71, 247, 9, 91, 8, 200, 175, 56, 12, 119, 180, 50, 42,
+    73, 195, 44, 172, 25, 168, 103, 61, 163, 119, 192, 185, 250, 154, 120, 111, 224, 140, 48, 237, 187, 148, 117, 144,
+    57, 215, 170, 74, 105, 108, 171, 137, 182, 67, 189, 94, 204, 247, 122, 118, 60, 187, 214, 53, 85, 47, 170, 172, 23,
+    185, 85, 71, 22, 54, 255, 212, 17, 106, 49, 229, 177, 232, 250, 218, 108, 53, 202, 33, 223, 129, 143, 24, 21, 93,
+    218, 188, 129, 7, 172, 206, 65, 56, 219, 81, 153, 144, 206, 15, 104, 77, 5, 59, 187, 134, 4, 238, 56, 223, 216, 71,
+    30, 129, 90, 99, 55, 25, 26, 132, 194, 168, 156, 148, 138, 115, 236, 242, 0, 146, 158, 208, 220, 238, 145, 247, 91,
+    239, 232, 138, 19, 194, 131, 29, 132, 35, 244, 159, 62, 241, 227, 38, 97, 56, 180, 86, 49, 123, 83, 52, 84, 69, 154,
+    19, 141, 130, 195, 117, 51, 69, 167, 87, 195, 169, 122, 241, 239, 156, 195, 71, 76, 96, 252, 3, 184, 36, 195, 243,
+    237, 232, 202, 217, 249, 25, 46, 244, 31, 196, 30, 236, 34, 82, 239, 41, 9, 204, 169, 168, 126, 97, 219, 254, 89,
+    213, 45, 137, 30, 176, 192, 187, 234, 195, 107, 173, 212, 76, 229, 255, 10, 100, 0, 118, 66, 9, 19, 220, 142, 109,
+    7, 30, 194, 122, 202, 241, 54, 248, 213, 68, 114, 211, 247, 140, 168, 203, 202, 88, 215, 219, 138, 190, 251, 166,
+    73, 51, 116, 154, 160, 195, 247, 251, 13, 176, 55, 140, 253, 217, 209, 209, 145, 205, 136, 12, 133, 202, 247, 251,
+    122, 82, 119, 75, 185, 192, 94, 22, 44, 83, 51, 119, 112, 136, 6, 95, 180, 56, 106, 168, 12, 236, 178, 149, 64, 147,
+    141, 142, 190, 172, 181, 4, 42, 139, 197, 21, 183, 191, 165, 1, 175, 232, 244, 198, 245, 163, 189, 24, 104, 6, 103,
+    190, 161, 146, 193, 24, 156, 246, 221, 86, 121, 209, 60, 147, 47, 106, 181, 178, 184, 249, 67, 12, 93, 128, 243, 7,
+    57, 126, 110, 130, 216, 130, 65, 69, 202, 165, 61, 23, 96, 194, 38, 106, 28, 62, 226, 84, 133, 168, 50, 108, 187,
+    15, 143, 38, 172, 174, 228, 172, 81, 5, 63, 102, 78, 29, 32, 88, 249, 76, 20, 33, 102, 173, 153, 8, 67, 43, 254,
+    156, 71, 35, 247, 209, 124, 226, 122, 218, 206, 121, 141, 248, 116, 44, 248, 255, 190, 215, 185, 51, 20, 36, 194, 1,
+    68, 158, 50, 42, 162, 184, 49, 85, 110, 79, 17, 41, 120, 13, 89, 184, 177, 185, 68, 9, 91, 131, 72, 215, 123, 28,
+    248, 113, 55, 69, 60, 96, 251, 128, 146, 47, 115, 192, 67, 150, 89, 165, 193, 187, 122, 118, 195, 160, 21, 111, 51,
+    113, 46, 11, 130, 105, 183, 96, 203, 155, 95, 147, 50, 163, 253, 171, 214, 219, 65, 164, 38, 233, 95, 220, 19, 188,
+    92, 156, 154, 10, 27, 129, 240, 181, 205, 144, 161, 188, 131, 5, 48, 80, 149, 202, 111, 30, 214, 203, 130, 108, 167,
+    11, 82, 240, 187, 99, 231, 189, 48, 23, 255, 64, 207, 98, 209, 246, 124, 40, 126, 206, 108, 184, 189, 140, 254, 99,
+    71, 56, 118, 109, 69, 164, 238, 114, 243, 196, 122, 87, 193, 216, 29, 92, 125, 51, 2, 246, 27, 56, 139, 24, 255,
+    182, 60, 42, 94, 200, 91, 208, 42, 33, 200, 156, 111, 196, 106, 232, 108, 255, 113, 59, 20, 65, 152, 141, 225, 98,
+    209, 42, 119, 242, 233, 243, 97, 96, 175, 220, 250, 83, 148, 93, 141, 64, 228, 106, 245, 133, 171, 7, 66, 118, 253,
+    95, 35, 18, 56, 161, 153, 245, 111, 40, 253, 121, 164, 190, 54, 142, 77, 162, 241, 129, 129, 107, 164, 60, 229, 36,
+    209, 109, 141, 156, 174, 183, 17, 6, 184, 217, 46, 142, 169, 111, 3, 182, 62, 149, 91, 40, 110, 32, 36, 7, 140, 177,
+    231, 48, 169, 102, 219, 166, 154, 53, 200, 243, 222, 237, 133, 248, 103, 213, 196, 171, 42, 198, 12, 9, 155, 90,
+    226, 226, 106, 26, 120, 126, 34, 249, 30, 76, 249, 125, 39, 154, 188, 115, 176, 196, 185, 179, 118, 119, 231, 197,
+    37, 254, 25, 79, 32, 42, 214, 179, 161, 200, 220, 2, 233, 175, 116, 134, 75, 136, 196, 208, 186, 50, 200, 92, 99,
+    250, 130, 183, 36, 236, 157, 10, 35, 114, 38, 52, 154, 146, 188, 122, 73, 245, 71, 69, 74, 229, 81, 251, 77, 55,
+    193, 202, 233, 202, 199, 168, 145, 179, 110, 75, 74, 141, 57, 172, 156, 150, 77, 186, 202, 194, 150, 61, 241, 141,
+    125, 145, 24, 139, 234, 186, 212, 193, 186, 227, 231, 34, 85, 91, 12, 207, 52, 102, 76, 207, 64, 234, 63, 94, 133,
+    27, 39, 39, 108, 237, 203, 183, 161, 141, 97, 123, 55, 20, 194, 165, 166, 17, 91, 177, 242, 71, 63, 49, 150, 111,
+    11, 156, 53, 85, 195, 50, 218, 136, 76, 182, 66, 23, 127, 154, 251, 200, 50, 25, 192, 218, 100, 172, 89, 14, 186,
+    131, 79, 33, 27, 27, 3, 255, 110, 37, 244, 235, 135, 194, 26, 91, 127, 228, 77, 155, 12, 223, 41, 36, 241, 128, 166,
+    70, 48, 180, 144, 234, 101, 132, 73, 14, 31, 29, 27, 8, 34, 194, 184, 188, 94, 21, 200, 222, 42, 221, 65, 233, 120,
+    179, 191, 242, 232, 82, 253, 44, 246, 165, 52, 194, 96, 138, 96, 244, 52, 203, 195, 173, 141, 189, 100, 187, 64,
+    145, 155, 4, 213, 232, 68, 157, 12, 227, 243, 85, 247, 43, 169, 241, 107, 13, 179, 13, 33, 49, 189, 59, 183, 244,
+    193, 47, 113, 242, 163, 215, 85, 58, 187, 101, 112, 123, 169, 205, 217, 18, 255, 193, 152, 163, 19, 128, 106, 46,
+    223, 18, 228, 203, 178, 38, 131, 188, 151, 206, 143, 211, 118, 221, 220, 217, 122, 122, 227, 5, 203, 134, 51, 135,
+    75, 162, 17, 84, 226, 61, 129, 116, 189, 243, 114, 249, 234, 99, 29, 132, 62, 53, 203, 31, 46, 160, 84, 29, 18, 126,
+    243, 229, 196, 223, 128, 160, 250, 150, 95, 63, 55, 140, 76, 172, 228, 110, 36, 197, 16, 75, 92, 151, 127, 141, 231,
+    55, 185, 125, 213, 157, 79, 217, 75, 111, 194, 171, 35, 147, 46, 155, 137, 195, 59, 83, 4, 7, 144, 192, 222, 178,
+    125, 253, 134, 21, 250, 25, 23, 33, 204, 159, 137, 30, 174, 239, 186, 239, 242, 61, 177, 69, 88, 144, 100, 10, 151,
+    249, 163, 55, 86, 95, 97, 10, 125, 201, 229, 94, 248, 22, 42, 214, 216, 106, 136, 18, 40, 235, 235, 242, 183, 42,
+    53, 80, 171, 114, 36, 184, 26, 100, 94, 200, 142, 119, 100, 216, 185, 72, 183, 188, 59, 55, 221, 30, 34, 200, 124,
+    103, 203, 252, 220, 17, 14, 247, 195, 2, 113, 79, 133, 113, 190, 83, 89, 246, 152, 130, 205, 8, 113, 80, 70, 115,
+    108, 99, 30, 183, 34, 120, 100, 199, 59, 19, 185, 67, 82, 168, 42, 5, 216, 8, 143, 107, 86, 8, 18, 75, 73, 9, 159,
+    31, 153, 57, 129, 194, 23, 123, 9, 112, 211, 207, 93, 215, 144, 245, 223, 209, 209, 68, 51, 202, 107, 24, 159, 161,
+    38, 161, 130, 183, 99, 139, 192, 186, 19, 97, 202, 0, 18, 90, 186, 197, 25, 101, 130, 137, 204, 92, 23, 39, 210, 2,
+    223, 134, 132, 129, 10, 163, 82, 232, 72, 170, 65, 137, 129, 132, 167, 35, 237, 65, 134, 30, 221, 66, 114, 249, 183,
+    25, 135, 222, 141, 71, 89, 85, 183, 96, 118, 209, 91, 51, 169, 202, 226, 152, 120, 60, 137, 249, 172, 197, 45, 118,
+    90, 191, 90, 67, 202, 130, 70, 223, 87, 1, 23, 79, 247, 113, 81, 112, 55, 236, 61, 225, 231, 149, 86, 9, 108, 210,
+    80, 154, 69, 201, 242, 26, 53, 165, 22, 71, 174, 123, 178, 24, 33, 255, 168, 153, 215, 9, 232, 204, 131, 84, 172,
+    245, 92, 134, 198, 128, 191, 202, 157, 106, 225, 237, 148, 208, 249, 17, 36, 236, 191, 219, 144, 213, 186, 81, 186,
+    18, 144, 88, 30, 6, 43, 212, 135, 213, 95, 103, 63, 165, 250, 82, 85, 228, 238, 163, 158, 143, 129, 80, 39, 43, 149,
+    45, 20, 21, 123, 234, 8, 119, 141, 16, 239, 204, 78, 217, 242, 119, 108, 12, 34, 206, 76, 206, 171, 71, 47, 170,
+    224, 104, 30, 35, 12, 204, 240, 48, 42, 108, 166, 161, 89, 201, 33, 192, 217, 15, 64, 127, 126, 172, 252, 227, 25,
+    214, 139, 103, 206, 140, 226, 24, 127, 163, 170, 100, 222, 46, 178, 37, 18, 51, 180, 42, 245, 81, 29, 149, 152, 225,
+    109, 33, 155, 128, 68, 188, 129, 125, 31, 107, 93, 152, 23, 121, 23, 140, 207, 75, 97, 254, 135, 209, 173, 128, 202,
+    156, 96, 204, 210, 204, 172, 2, 113, 122, 253, 76, 209, 50, 130, 193, 234, 38, 23, 25, 32, 143, 160, 58, 206, 136,
+    245, 22, 180, 138, 126, 207, 48, 185, 145, 206, 84, 146, 46, 73, 116, 87, 51, 101, 71, 79, 147, 6, 21, 247, 158, 33,
+    174, 17, 44, 175, 221, 43, 127, 137, 146, 192, 205, 112, 170, 182, 28, 142, 107, 67, 233, 23, 125, 78, 172, 3, 195,
+    102, 182, 144, 135, 136, 49, 226, 8, 73, 113, 237, 222, 19, 44, 7, 59, 227, 0, 175, 152, 193, 129, 22, 50, 119, 132,
+    234, 70, 127, 199, 142, 42, 237, 1, 205, 6, 18, 121, 202, 76, 218, 170, 164, 65, 177, 192, 92, 197, 115, 204, 26,
+    174, 124, 42, 49, 221, 238, 48, 150, 184, 151, 183, 206, 15, 28, 111, 46, 60, 136, 132, 231, 11, 195, 206, 77, 76,
+    230, 2, 109, 94, 16, 194, 58, 214, 51, 227, 147, 205, 141, 138, 188, 229, 219, 26, 99, 23, 72, 138, 205, 67, 9, 150,
+    239, 46, 78, 123, 65, 83, 225, 18, 58, 84, 229, 3, 210, 54, 131, 245, 190, 133, 175, 197, 150, 64, 62, 5, 109, 189,
+    160, 225, 48, 19, 250, 180, 162, 234, 35, 113, 171, 32, 49, 151, 99, 69, 66, 237, 106, 78, 63, 103, 7, 60, 16, 251,
+    9, 4, 137, 216, 14, 245, 127, 179, 2, 4, 85, 81, 113, 14, 153, 89, 79, 72, 46, 239, 243, 125, 175, 31, 46, 218, 3,
+    34, 128, 81, 102, 246, 116, 140, 140, 201, 214, 185, 43, 11, 89, 66, 16, 242, 147, 124, 231, 49, 54, 127, 237, 131,
+    222, 21, 176, 3, 160, 79, 72, 205, 172, 174, 53, 66, 205, 88, 23, 35, 179, 219, 144, 211, 214, 97, 81, 231, 45, 200,
+    240, 153, 78, 151, 65, 197, 174, 17, 149, 35, 229, 230, 160, 206, 213, 52, 222, 229, 60, 151, 190, 139, 126, 30,
+    162, 57, 64, 126, 206, 226, 132, 78, 59, 75, 168, 37, 2, 253, 208, 19, 106, 83, 58, 251, 97, 6, 2, 58, 119, 172,
+    152, 94, 175, 118, 132, 22, 127, 222, 161, 157, 150, 28, 146, 191, 221, 70, 154, 148, 183, 213, 98, 251, 118, 207,
+    156, 175, 109, 234, 126, 213, 185, 183, 155, 83, 130, 232, 214, 215, 174, 220, 129, 113, 36, 117, 177, 234, 48, 175,
+    113, 254, 158, 14, 104, 200, 176, 246, 95, 183, 205, 112, 122, 205, 179, 5, 193, 203, 108, 35, 112, 212, 16, 234,
+    104, 74, 231, 182, 34, 212, 44, 83, 229, 8, 191, 50, 5, 92, 157, 218, 206, 63, 220, 246, 107, 101, 57, 33, 225, 64,
+    112, 248, 226, 42, 30, 163, 247, 149, 174, 3, 83, 32, 151, 82, 143, 118, 35, 99, 180, 194, 211, 144, 30, 117, 155,
+    216, 165, 21, 236, 26, 177, 61, 16, 236, 181, 176, 114, 55, 115, 242, 33, 255, 174, 186, 25, 135, 146, 190, 27, 177,
+    182, 115, 64, 98, 150, 142, 169, 57, 231, 14, 41, 30, 214, 99, 79, 77, 14, 72, 5, 78, 162, 127, 174, 123, 191, 108,
+    100, 121, 39, 227, 96, 14, 61, 8, 1, 242, 218, 125, 185, 75, 156, 81, 69, 37, 162, 55, 222, 236, 23, 228, 196, 86,
+    85, 55, 50, 40, 27, 4, 191, 229, 139, 90, 94, 87, 153, 238, 76, 52, 37, 129, 66, 215, 181, 20, 38, 74, 190, 29, 128,
+    11, 43, 25, 86, 128, 173, 44, 206, 102, 69, 238, 36, 237, 125, 9, 27, 251, 196, 107, 128, 109, 225, 98, 131, 47,
+    242, 74, 114, 19, 81, 187, 125, 104, 200, 164, 118, 44, 222, 106, 39, 226, 239, 210, 255, 89, 158, 233, 28, 225,
+    205, 50, 53, 217, 105, 111, 24, 214, 244, 39, 140, 214, 241, 168, 217, 137, 19, 50, 222, 55, 85, 117, 232, 216, 164,
+    173, 147, 190, 253, 186, 250, 164, 36, 170, 42, 63, 54, 36, 216, 180, 26, 189, 203, 185, 228, 159, 47, 13, 116, 161,
+    251, 149, 9, 166, 247, 5, 153, 181, 27, 173, 39, 194, 119, 68, 201, 213, 80, 122, 251, 11, 95, 183, 149, 127, 72,
+    85, 99, 126, 117, 184, 66, 122, 222, 64, 52, 78, 133, 190, 210, 242, 137, 209, 54, 5, 118, 29, 23, 144, 133, 233,
+    95, 12, 179, 68, 37, 144, 124, 206, 152, 10, 28, 154, 120, 128, 93, 145, 138, 79, 99, 167, 2, 133, 18, 85, 72, 176,
+    251, 4, 225, 24, 172, 185, 14, 94, 128, 176, 220, 226, 68, 158, 21, 58, 210, 233, 208, 168, 23, 33, 195, 46, 138, 9,
+    167, 255, 253, 56, 97, 243, 101, 182, 147, 127, 38, 202, 80, 226, 125, 62, 117, 237, 164, 121, 189, 29, 244, 146,
+    39, 209, 229, 182, 187, 67, 33, 15, 181, 8, 63, 125, 196, 83, 37, 29, 92, 101, 186, 169, 199, 154, 169, 63, 37, 84,
+    25, 186, 87, 15, 114, 179, 161, 192, 254, 113, 52, 190, 140, 55, 137, 28, 172, 94, 51, 72, 15, 219, 40, 219, 217, 3,
+    119, 22, 229, 56, 125, 38, 125, 253, 154, 45, 197, 125, 46, 216, 52, 93, 200, 72, 44, 104, 112, 40, 48, 184, 101,
+    17, 189, 107, 198, 49, 186, 191, 214, 42, 35, 50, 67, 105, 107, 8, 116, 79, 166, 71, 62, 63, 15, 40, 1, 28, 65, 199,
+    54, 111, 145, 97, 9, 173, 43, 77, 44, 167, 235, 44, 41, 161, 205, 237, 35, 75, 102, 169, 2, 118, 127, 208, 60, 46,
+    124, 45, 212, 78, 208, 102, 115, 231, 66, 9, 88, 204, 179, 126, 152, 156, 12, 207, 100, 37, 74, 14, 132, 142, 146,
+    58, 154, 211, 110, 184, 189, 210, 107, 111, 14, 23, 5, 251, 86, 182, 113, 166, 228, 240, 207, 62, 94, 116, 146, 168,
+    166, 2, 211, 116, 123, 153, 70, 122, 151, 40, 219, 245, 246, 56, 143, 140, 73, 210, 247, 155, 202, 76, 23, 49, 244,
+    56, 198, 144, 135, 3, 88, 211, 171, 166, 205, 248, 22, 190, 191, 154, 57, 206, 139, 6, 140, 7, 84, 105, 193, 206,
+    191, 190, 167, 186, 91, 50, 120, 91, 210, 164, 171, 152, 25, 120, 200, 178, 16, 217, 132, 136, 162, 250, 72, 148,
+    53, 129, 143, 110, 12, 26, 79, 170, 210, 129, 110, 100, 116, 32, 100, 14, 154, 157, 250, 221, 115, 8, 230, 83, 186,
+    27, 168, 20, 166, 22, 26, 106, 230, 111, 37, 170, 137, 192, 206, 148, 18, 203, 97, 94, 200, 99, 99, 4, 41, 143, 146,
+    226, 172, 149, 225, 142, 242, 242, 141, 41, 38, 197, 214, 27, 156, 66, 57, 54, 204, 123, 102, 77, 192, 187, 25, 3,
+    105, 199, 138, 55, 176, 169, 252, 202, 7, 125, 167, 151, 42, 24, 176, 156, 169, 204, 42, 42, 218, 156, 114, 32, 252,
+    64, 171, 110, 179, 208, 140, 22, 31, 28, 66, 187, 158, 174, 143, 193, 250, 236, 89, 10, 104, 90, 193, 142, 127, 253,
+    201, 13, 116, 215, 89, 249, 95, 247, 28, 91, 123, 1, 208, 251, 39, 26, 15, 119, 162, 22, 121, 28, 161, 172, 60, 22,
+    71, 107, 27, 193, 41, 66, 96, 114, 148, 180, 47, 60, 69, 165, 139, 144, 141, 206, 101, 57, 165, 178, 36, 180, 159,
+    20, 73, 70, 190, 82, 132, 11, 121, 81, 19, 143, 33, 157, 180, 157, 177, 82, 145, 96, 3, 228, 94, 121, 88, 214, 195,
+    3, 49, 113, 132, 92, 138, 111, 68, 222, 165, 51, 62, 254, 75, 249, 51, 54, 115, 146, 244, 146, 33, 207, 143, 12, 35,
+    184, 144, 82, 128, 39, 45, 149, 98, 115, 69, 148, 18, 80, 73, 126, 164, 44, 3, 90, 79, 153, 156, 138, 184, 5, 226,
+    17, 20, 221, 22, 4, 61, 127, 252, 244, 181, 8, 222, 46, 66, 85, 133, 17, 43, 43, 4, 168, 43, 171, 187, 60, 184, 181,
+    217, 203, 235, 222, 82, 168, 224, 244, 46, 35, 255, 246, 46, 9, 253, 103, 254, 181, 236, 154, 211, 111, 56, 30, 177,
+    96, 31, 172, 94, 228, 25, 165, 77, 40, 208, 13, 27, 34, 6, 141, 93, 204, 101, 255, 32, 18, 17, 153, 179, 70, 153,
+    215, 158, 99, 216, 60, 168, 173, 99, 52, 48, 170, 162, 34, 61, 144, 131, 70, 230, 220, 162, 193, 106, 11, 133, 51,
+    166, 93, 158, 34, 175, 8, 35, 73, 253, 219, 148, 77, 250, 209, 115, 156, 251, 180, 97, 114, 123, 154, 194, 101, 247,
+    29, 201, 115, 74, 117, 241, 91, 240, 173, 83, 117, 222, 240, 160, 225, 39, 236, 171, 199, 156, 144, 219, 181, 250,
+    38, 191, 214, 8, 9, 22, 235, 144, 195, 208, 92, 135, 84, 120, 229, 184, 53, 124, 164, 87, 178, 125, 1, 9, 164, 14,
+    171, 218, 231, 253, 193, 134, 31, 125, 58, 217, 131, 206, 205, 250, 41, 250, 135, 240, 156, 255, 224, 173, 91, 196,
+    157, 158, 120, 33, 89, 12, 47, 57, 66, 57, 190, 128, 113, 67, 183, 248, 166, 207, 125, 223, 46, 57, 238, 120, 243,
+    26, 138, 41, 156, 141, 25, 186, 63, 230, 225, 101, 139, 31, 87, 184, 36, 69, 146, 44, 101, 235, 180, 146, 16, 53,
+    194, 155, 108, 40, 19, 142, 79, 29, 28, 137, 133, 12, 224, 212, 98, 204, 185, 76, 195, 86, 157, 169, 213, 224, 158,
+    201, 45, 36, 43, 93, 190, 244, 114, 210, 66, 255, 42, 192, 40, 11, 247, 184, 9, 196, 42, 125, 8, 204, 94, 246, 59,
+    63, 239, 187, 146, 1, 215, 104, 146, 88, 34, 135, 233, 167, 166, 84, 31, 75, 233, 45, 123, 206, 214, 150, 228, 151,
+    116, 56, 215, 8, 230, 183, 35, 190, 249, 207, 106, 186, 62, 208, 160, 214, 46, 54, 199, 69, 86, 118, 44, 64, 88, 21,
+    163, 53, 241, 149, 55, 181, 185, 55, 20, 65, 176, 83, 134, 111, 241, 222, 254, 243, 18, 73, 251, 61, 91, 10, 228,
+    223, 221, 175, 143, 111, 20, 46, 77, 51, 206, 217, 246, 128, 72, 53, 102, 147, 240, 173, 210, 3, 147, 60, 134, 149,
+    8, 119, 81, 144, 27, 207, 243, 157, 17, 77, 29, 222, 222, 246, 86, 255, 240, 132, 158, 111, 233, 37, 2, 112, 234,
+    135, 114, 236, 158, 131, 166, 188, 191, 151, 28, 201, 27, 71, 100, 198, 166, 222, 106, 202, 76, 82, 20, 137, 124,
+    84, 113, 4, 53, 94, 235, 159, 224, 141, 151, 156, 96, 139, 47, 216, 116, 46, 216, 189, 243, 174, 39, 189, 111, 196,
+    143, 24, 76, 179, 74, 209, 172, 235, 41, 167, 109, 38, 96, 144, 63, 210, 38, 47, 223, 224, 53, 127, 17, 45, 153,
+    135, 142, 96, 219, 100, 113, 105, 63, 132, 44, 247, 251, 94, 32, 196, 250, 122, 46, 101, 131, 204, 32, 213, 147,
+    153, 54, 77, 152, 61, 250, 149, 123, 200, 120, 139, 16, 116, 218, 90, 160, 125, 227, 224, 99, 164, 26, 61, 213, 103,
+    254, 213, 12, 110, 83, 156, 225, 197, 66, 138, 10, 199, 1, 152, 215, 17, 205, 74, 230, 209, 158, 140, 172, 246, 126,
+    108, 149, 95, 19, 94, 124, 227, 147, 97, 195, 94, 136, 122, 99, 181, 5, 232, 27, 52, 65, 204, 210, 4, 224, 86, 46,
+    22, 223, 141, 239, 12, 76, 20, 193, 17, 24, 27, 193, 176, 171, 236, 192, 23, 0, 189, 173, 164, 103, 230, 172, 22,
+    98, 200, 98, 101, 159, 107, 130, 134, 245, 153, 14, 160, 216, 210, 19, 79, 102, 180, 138, 158, 201, 152, 220, 113,
+    59, 45, 150, 106, 110, 47, 49, 50, 96, 190, 99, 41, 215, 236, 254, 250, 124, 16, 105, 175, 21, 251, 88, 13, 4, 58,
+    129, 32, 39, 98, 182, 89, 16, 182, 136, 84, 218, 163, 149, 139, 43, 207, 253, 219, 168, 58, 82, 8, 197, 222, 138,
+    177, 192, 107, 7, 31, 223, 162, 151, 16, 32, 129, 54, 51, 45, 97, 3, 149, 71, 34, 3, 38, 246, 155, 229, 237, 124,
+    92, 52, 188, 150, 204, 158, 4, 118, 6, 61, 68, 103, 67, 200, 90, 154, 36, 108, 163, 119, 193, 17, 124, 49, 127, 60,
+    25, 71, 138, 156, 240, 242, 175, 231, 83, 14, 55, 8, 178, 246, 229, 34, 73, 19, 154, 198, 189, 169, 220, 50, 60,
+    179, 26, 162, 52, 201, 165, 254, 45, 169, 252, 183, 180, 222, 113, 109, 120, 46, 82, 165, 39, 83, 137, 33, 199, 208,
+    74, 104, 88, 182, 236, 74, 67, 64, 196, 24, 142, 204, 223, 146, 46, 166, 123, 197, 157, 113, 223, 4, 97, 207, 41,
+    217, 103, 194, 157, 92, 79, 200, 105, 44, 6, 128, 89, 156, 122, 138, 121, 138, 187, 172, 186, 185, 87, 216, 72, 36,
+    7, 40, 96, 186, 250, 126, 255, 114, 20, 191, 109, 130, 99, 22, 248, 72, 117, 169, 175, 203, 32, 194, 240, 43, 0,
+    120, 37, 147, 216, 114, 45, 36, 176, 113, 62, 167, 76, 101, 19, 9, 14, 81, 236, 167, 143, 63, 25, 21, 128, 245, 139,
+    241, 59, 29, 236, 143, 67, 141, 217, 142, 233, 166, 186, 28, 165, 156, 193, 78, 111, 1, 148, 13, 12, 88, 234, 42,
+    26, 10, 12, 166, 83, 155, 73, 57, 108, 239, 28, 51, 138, 130, 79, 28, 82, 51, 232, 208, 251, 41, 209, 63, 146, 228,
+    167, 94, 50, 196, 164, 254, 24, 30, 52, 189, 148, 40, 253, 87, 7, 171, 2, 41, 127, 143, 248, 191, 187, 139, 129,
+    111, 171, 63, 32, 247, 254, 46, 118, 209, 73, 53, 77, 104, 155, 150, 43, 160, 72, 235, 56, 89, 6, 147, 184, 128,
+    104, 88, 59, 238, 71, 145, 152, 141, 76, 133, 60, 188, 55, 205, 68, 223, 244, 221, 208, 47, 22, 27, 142, 167, 241,
+    152, 60, 19, 146, 201, 50, 21, 169, 157, 190, 128, 220, 38, 223, 166, 47, 233, 132, 219, 59, 230, 241, 189, 231,
+    108, 249, 254, 176, 121, 203, 97, 141, 94, 242, 42, 240, 111, 154, 229, 60, 23, 214, 100, 179, 180, 142, 33, 3, 115,
+    107, 7, 49, 250, 226, 60, 23, 142, 168, 141, 182, 130, 243, 209, 203, 203, 240, 141, 205, 46, 195, 132, 136, 116,
+    55, 20, 219, 148, 194, 239, 103, 223, 102, 239, 17, 83, 177, 252, 120, 99, 223, 171, 224, 205, 232, 174, 126, 210,
+    127, 206, 45, 184, 108, 6, 3, 76, 94, 68, 243, 164, 184, 227, 94, 130, 99, 30, 214, 171, 71, 63, 22, 167, 96, 87,
+    178, 245, 47, 11, 70, 16, 161, 183, 29, 160, 27, 204, 0, 99, 6, 246, 7, 239, 32, 31, 138, 102, 0, 8, 55, 6, 156,
+    250, 250, 79, 151, 100, 217, 29, 95, 184, 254, 152, 183, 240, 215, 46, 149, 100, 82, 137, 168, 40, 22, 130, 81, 28,
+    113, 41, 135, 245, 165, 135, 108, 72, 139, 49, 179, 128, 11, 185, 244, 0, 253, 66, 47, 223, 29, 40, 92, 196, 30,
+    196, 194, 45, 40, 162, 172, 62, 20, 254, 246, 166, 181, 248, 177, 114, 24, 19, 136, 171, 244, 104, 77, 114, 16, 189,
+    122, 228, 130, 118, 4, 79, 96, 118, 122, 218, 166, 77, 221, 255, 190, 231, 104, 108, 15, 161, 40, 254, 10, 129, 229,
+    196, 250, 47, 90, 236, 210, 197, 211, 156, 112, 187, 149, 110, 225, 159, 37, 12, 194, 127, 24, 122, 105, 70, 171,
+    212, 58, 13, 76, 159, 217, 72, 48, 172, 153, 123, 94, 127, 241, 242, 138, 157, 4, 50, 129, 86, 192, 195, 167, 51,
+    253, 156, 187, 193, 236, 243, 155, 48, 108, 91, 194, 101, 93, 245, 27, 165, 246, 170, 243, 54, 94, 133, 60, 46, 52,
+    137, 165, 185, 225, 110, 237, 101, 198, 227, 104, 34, 118, 65, 110, 203, 174, 18, 61, 194, 20, 191, 31, 254, 35,
+    145, 111, 249, 27, 25, 157, 165, 230, 163, 144, 191, 91, 184, 118, 213, 229, 46, 152, 85, 21, 103, 95, 142, 140,
+    102, 250, 253, 116, 242, 165, 190, 203, 237, 142, 44, 243, 180, 111, 89, 10, 127, 242, 19, 66, 229, 247, 161, 81,
+    39, 151, 235, 157, 69, 165, 26, 109, 215, 184, 71, 214, 95, 149, 189, 1, 65, 145, 25, 42, 241, 83, 41, 67, 82, 115,
+    158, 29, 48, 22, 1, 223, 175, 31, 36, 206, 177, 38, 26, 172, 223, 211, 100, 165, 61, 172, 249, 36, 203, 181, 249,
+    135, 144, 80, 6, 26, 17, 80, 253, 36, 99, 196, 54, 224, 194, 28, 225, 29, 141, 236, 108, 31, 208, 88, 47, 246, 164,
+    173, 241, 194, 233, 233, 174, 237, 191, 195, 104, 199, 54, 95, 63, 12, 175, 0, 55, 1, 41, 139, 222, 89, 144, 163,
+    73, 114, 129, 57, 3, 181, 251, 123, 179, 107, 129, 50, 161, 193, 215, 16, 7, 36, 70, 231, 49, 123, 118, 37, 249,
+    142, 49, 204, 95, 96, 122, 130, 190, 231, 109, 92, 52, 84, 24, 102, 115, 206, 83, 7, 4, 63, 82, 172, 208, 126, 223,
+    38, 195, 6, 80, 81, 206, 5, 47, 21, 229, 83, 130, 156, 158, 250, 115, 84, 217, 165, 39, 176, 142, 67, 94, 51, 0,
+    108, 142, 215, 113, 179, 233, 236, 138, 137, 98, 252, 207, 141, 76, 103, 44, 146, 101, 38, 159, 78, 131, 114, 162,
+    157, 87, 178, 67, 153, 134, 165, 190, 249, 198, 99, 88, 40, 45, 175, 61, 65, 131, 118, 101, 135, 84, 125, 201, 222,
+    134, 226, 144, 238, 152, 252, 21, 95, 32, 109, 75, 53, 158, 112, 226, 108, 123, 175, 10, 185, 200, 29, 75, 250, 117,
+    104, 124, 242, 102, 42, 131, 172, 190, 249, 177, 126, 57, 92, 51, 245, 158, 143, 17, 149, 170, 64, 30, 150, 243, 85,
+    250, 232, 195, 137, 45, 96, 79, 126, 56, 249, 7, 1, 69, 127, 223, 142, 248, 147, 163, 191, 13, 80, 169, 212, 197,
+    112, 96, 2, 95, 226, 185, 41, 213, 113, 49, 64, 211, 198, 12, 124, 51, 5, 201, 197, 134, 176, 233, 20, 248, 214,
+    177, 82, 110, 210, 177, 114, 244, 206, 134, 185, 233, 68, 198, 158, 74, 23, 63, 197, 213, 34, 35, 90, 225, 183, 123,
+    42, 162, 177, 20, 211, 162, 144, 205, 151, 57, 79, 100, 114, 47, 59, 248, 181, 50, 133, 103, 218, 94, 120, 39, 238,
+    214, 164, 3, 70, 169, 232, 64, 96, 95, 93, 119, 62, 138, 98, 68, 188, 243, 206, 131, 127, 184, 26, 89, 184, 228,
+    215, 43, 60, 226, 212, 211, 231, 5, 197, 61, 83, 24, 110, 87, 108, 136, 79, 208, 170, 214, 173, 162, 121, 245, 205,
+    233, 73, 36, 129, 188, 39, 75, 239, 140, 226, 105, 40, 94, 199, 226, 26, 71, 244, 221, 127, 175, 117, 122, 122, 191,
+    109, 164, 80, 6, 233, 168, 23, 14, 107, 162, 43, 109, 6, 12, 14, 182, 55, 4, 84, 120, 195, 195, 157, 159, 151, 125,
+    142, 144, 143, 175, 192, 241, 30, 219, 204, 221, 169, 230, 134, 95, 131, 32, 120, 37, 254, 185, 53, 52, 48, 81, 122,
+    231, 118, 62, 135, 58, 42, 139, 57, 141, 38, 107, 47, 105, 218, 119, 114, 96, 9, 234, 180, 193, 95, 102, 61, 98,
+    248, 20, 114, 106, 168, 3, 165, 66, 60, 0, 244, 218, 157, 156, 207, 217, 157, 149, 53, 245, 67, 117, 127, 169, 244,
+    138, 38, 66, 190, 130, 172, 140, 172, 187, 78, 159, 179, 9, 26, 190, 9, 78, 205, 149, 229, 104, 201, 53, 28, 186,
+    141, 210, 124, 47, 86, 16, 7, 130, 15, 100, 37, 3, 197, 164, 134, 17, 211, 69, 18, 202, 200, 133, 169, 108, 250, 56,
+    129, 113, 182, 242, 19, 240, 162, 21, 27, 52, 183, 170, 165, 6, 16, 85, 171, 18, 129, 169, 161, 249, 85, 27, 143,
+    12, 123, 208, 8, 78, 119, 72, 24, 110, 27, 19, 67, 71, 184, 230, 196, 153, 56, 149, 119, 214, 142, 139, 168, 204,
+    65, 76, 18, 9, 88, 203, 64, 33, 222, 2, 240, 254, 129, 220, 166, 209, 241, 85, 243, 170, 157, 175, 50, 20, 47, 230,
+    2, 23, 114, 25, 169, 63, 41, 108, 145, 175, 207, 112, 185, 175, 57, 109, 34, 89, 230, 142, 143, 83, 112, 8, 81, 183,
+    16, 247, 153, 113, 110, 250, 128, 16, 109, 83, 80, 78, 48, 47, 104, 155, 164, 12, 79, 221, 109, 1, 70, 219, 35, 199,
+    102, 166, 197, 124, 193, 165, 0, 67, 122, 78, 125, 248, 162, 201, 236, 44, 253, 175, 161, 48, 212, 186, 162, 215,
+    109, 249, 112, 65, 69, 96, 59, 133, 20, 213, 221, 13, 17, 251, 242, 174, 184, 239, 89, 129, 186, 110, 10, 144, 113,
+    117, 48, 247, 162, 198, 160, 47, 248, 41, 134, 141, 157, 168, 197, 60, 131, 118, 25, 103, 250, 231, 125, 19, 53, 79,
+    240, 223, 161, 13, 202, 207, 43, 44, 174, 96, 92, 110, 8, 108, 134, 0, 31, 2, 149, 178, 75, 6, 161, 179, 161, 200,
+    13, 120, 249, 183, 246, 241, 147, 91, 116, 45, 115, 189, 154, 164, 189, 222, 50, 214, 170, 252, 133, 96, 167, 156,
+    85, 93, 169, 27, 47, 188, 159, 183, 186, 186, 4, 25, 124, 195, 235, 142, 173, 5, 82, 125, 106, 68, 127, 120, 93,
+    117, 118, 107, 97, 193, 176, 86, 162, 144, 13, 136, 92, 77, 190, 189, 53, 86, 162, 82, 96, 70, 182, 113, 167, 233,
+    170, 221, 104, 121, 82, 35, 197, 22, 187, 151, 223, 102, 169, 7, 135, 115, 59, 66, 0, 221, 143, 183, 72, 113, 29,
+    23, 221, 206, 11, 112, 9, 146, 73, 13, 209, 74, 86, 43, 251, 138, 194, 27, 94, 151, 228, 71, 228, 45, 255, 116, 168,
+    105, 202, 230, 233, 137, 40, 113, 246, 72, 94, 31, 120, 202, 107, 87, 35, 12, 173, 236, 230, 130, 110, 166, 147, 63,
+    85, 98, 160, 133, 186, 232, 104, 123, 100, 150, 17, 61, 65, 151, 44, 75, 133, 33, 194, 179, 175, 130, 229, 115, 225,
+    126, 159, 75, 183, 128, 6, 128, 176, 217, 29, 144, 193, 184, 10, 233, 138, 250, 26, 33, 128, 134, 27, 3, 248, 112,
+    135, 16, 232, 114, 158, 210, 8, 193, 191, 101, 206, 10, 157, 192, 227, 223, 63, 18, 47, 27, 167, 51, 61, 91, 64,
+    132, 226, 216, 192, 86, 107, 33, 156, 92, 168, 75, 110, 16, 125, 52, 86, 116, 198, 21, 14, 124, 40, 190, 45, 158,
+    199, 20, 135, 132, 57, 163, 178, 25, 30, 143, 13, 239, 209, 179, 145, 129, 65, 247, 142, 217, 20, 190, 67, 184, 116,
+    155, 235, 223, 75, 25, 129, 26, 204, 232, 63, 173, 2, 122, 249, 92, 113, 154, 232, 49, 163, 78, 237, 77, 29, 247,
+    215, 185, 122, 223, 3, 247, 49, 222, 224, 147, 246, 104, 21, 55, 72, 200, 158, 187, 65, 221, 158, 3, 194, 9, 222,
+    206, 71, 162, 130, 142, 121, 16, 34, 62, 144, 162, 46, 147, 199, 225, 180, 25, 48, 136, 61, 171, 12, 226, 196, 172,
+    127, 35, 93, 62, 14, 55, 107, 179, 164, 147, 167, 117, 99, 0, 68, 11, 3, 36, 178, 109, 25, 217, 119, 18, 39, 40,
+    195, 86, 150, 22, 61, 131, 154, 206, 98, 172, 43, 130, 90, 240, 233, 246, 121, 8, 129, 39, 221, 106, 134, 28, 108,
+    54, 105, 134, 175, 134, 27, 35, 133, 16, 65, 47, 122, 188, 148, 217, 97, 131, 120, 209, 132, 57, 41, 91, 62, 116,
+    251, 59, 111, 122, 88, 64, 108, 162, 96, 224, 129, 220, 76, 179, 61, 83, 249, 177, 116, 170, 23, 81, 205, 1, 237,
+    102, 29, 157, 119, 48, 215, 7, 251, 31, 247, 124, 147, 201, 12, 114, 161, 51, 41, 85, 230, 208, 74, 214, 157, 228,
+    117, 81, 118, 138, 3, 9, 238, 120, 98, 2, 205, 91, 186, 242, 140, 2, 177, 161, 126, 126, 52, 23, 142, 141, 115, 196,
+    102, 223, 18, 131, 162, 83, 96, 216, 132, 109, 202, 48, 100, 176, 235, 240, 96, 157, 201, 203, 167, 230, 100, 119,
+    251, 121, 91, 178, 45, 121, 67, 70, 104, 146, 99, 84, 196, 126, 100, 96, 175, 126, 149, 228, 231, 186, 93, 143, 38,
+    5, 126, 101, 8, 16, 9, 110, 39, 57, 81, 71, 185, 101, 122, 93, 17, 87, 178, 188, 122, 171, 86, 96, 218, 182, 224,
+    162, 5, 123, 141, 136, 123, 74, 111, 26, 207, 67, 23, 247, 19, 225, 179, 15, 109, 199, 82, 154, 20, 104, 175, 210,
+    160, 138, 136, 120, 112, 228, 238, 127, 194, 224, 162, 143, 190, 85, 24, 5, 44, 21, 208, 175, 12, 211, 253, 100,
+    196, 185, 39, 155, 247, 54, 186, 241, 0, 246, 155, 222, 65, 114, 254, 27, 108, 95, 154, 94, 182, 123, 111, 59, 153,
+    106, 11, 15, 218, 124, 123, 114, 175, 242, 86, 171, 84, 108, 62, 117, 171, 11, 8, 222, 115, 20, 2, 120, 254, 176,
+    27, 158, 151, 174, 70, 47, 70, 69, 217, 224, 30, 49, 78, 69, 129, 115, 62, 137, 49, 241, 40, 105, 139, 97, 205, 134,
+    226, 118, 35, 175, 123, 78, 236, 4, 93, 170, 189, 82, 141, 183, 189, 168, 203, 118, 131, 1, 76, 162, 151, 89, 189,
+    144, 65, 108, 149, 51, 236, 15, 135, 78, 42, 160, 95, 57, 216, 232, 153, 215, 8, 108, 104, 147, 240, 255, 98, 188,
+    10, 66, 23, 250, 223, 53, 207, 85, 34, 70, 116, 75, 205, 238, 188, 117, 240, 74, 131, 103, 248, 230, 87, 181, 142,
+    212, 175, 0, 255, 70, 230, 239, 240, 239, 201, 135, 195, 19, 203, 94, 227, 97, 87, 131, 128, 57, 174, 97, 96, 196,
+    28, 146, 80, 176, 34, 47, 119, 177, 68, 193, 133, 203, 102, 121, 32, 245, 255, 177, 167, 77, 243, 15, 0, 254, 168,
+    140, 186, 252, 239, 200, 150, 139, 41, 172, 130, 45, 101, 236, 89, 116, 78, 241, 120, 44, 178, 154, 13, 123, 223,
+    191, 216, 107, 123, 74, 116, 96, 83, 177, 229, 62, 160, 92, 144, 220, 254, 233, 235, 116, 252, 18, 106, 110, 10, 99,
+    195, 230, 80, 120, 31, 47, 20, 134, 60, 6, 216, 163, 61, 65, 48, 184, 7, 67, 250, 165, 167, 23, 152, 152, 192, 102,
+    125, 76, 251, 225, 78, 224, 53, 178, 166, 57, 98, 208, 248, 39, 191, 228, 178, 245, 135, 96, 135, 230, 200, 123,
+    204, 204, 194, 99, 3, 102, 94, 106, 15, 247, 29, 39, 62, 178, 33, 225, 234, 125, 176, 210, 211, 4, 14, 129, 54, 242,
+    235, 142, 192, 59, 57, 202, 162, 173, 168, 156, 229, 130, 234, 121, 97, 191, 223, 179, 23, 178, 200, 189, 182, 25,
+    121, 43, 174, 130, 102, 74, 93, 160, 187, 27, 65, 162, 43, 57, 205, 234, 147, 95, 253, 81, 168, 254, 168, 222, 13,
+    7, 160, 185, 207, 142, 244, 253, 179, 78, 27, 33, 215, 245, 33, 32, 188, 178, 199, 210, 248, 198, 207, 70, 40, 207,
+    170, 14, 150, 126, 234, 46, 192, 5, 102, 161, 33, 133, 183, 7, 20, 117, 235, 149, 90, 135, 219, 184, 181, 27, 25,
+    204, 13, 72, 122, 30, 95, 243, 210, 141, 182, 165, 149, 217, 98, 106, 80, 137, 63, 1, 199, 118, 76, 30, 6, 63, 41,
+    235, 242, 252, 146, 239, 18, 187, 119, 182, 231, 211, 55, 149, 199, 144, 197, 150, 171, 214, 68, 151, 165, 24, 53,
+    10, 100, 51, 29, 162, 249, 76, 39, 133, 137, 26, 4, 60, 32, 119, 71, 102, 51, 130, 169, 96, 196, 109, 154, 105, 36,
+    210, 164, 183, 104, 250, 222, 141, 39, 254, 152, 244, 249, 190, 78, 109, 128, 240, 20, 53, 232, 103, 218, 14, 126,
+    209, 73, 43, 76, 156, 241, 109, 191, 77, 213, 62, 100, 111, 27, 223, 172, 113, 38, 37, 98, 2, 43, 237, 73, 37, 160,
+    185, 160, 95, 181, 90, 59, 166, 214, 35, 235, 133, 248, 61, 81, 75, 173, 45, 162, 140, 38, 119, 140, 48, 12, 164,
+    98, 110, 17, 224, 60, 165, 156, 208, 206, 153, 178, 213, 152, 239, 247, 123, 190, 110, 222, 110, 137, 115, 32, 58,
+    112, 161, 186, 207, 175, 76, 45, 132, 186, 67, 116, 89, 176, 16, 46, 31, 78, 224, 147, 182, 109, 100, 106, 132, 85,
+    85, 146, 200, 151, 223, 210, 80, 11, 189, 193, 196, 132, 84, 88, 249, 198, 103, 237, 80, 147, 98, 148, 46, 228, 60,
+    249, 189, 68, 81, 132, 51, 107, 180, 191, 201, 89, 190, 161, 19, 117, 89, 156, 55, 92, 99, 160, 252, 20, 96, 17,
+    205, 17, 182, 168, 31, 41, 35, 96, 251, 27, 247, 139, 129, 133, 247, 150, 85, 84, 34, 241, 46, 249, 23, 177, 36,
+    184, 136, 85, 120, 101, 106, 200, 140, 73, 169, 59, 216, 8, 231, 39, 99, 182, 221, 148, 62, 3, 96, 213, 254, 150,
+    241, 22, 183, 221, 163, 186, 86, 75, 234, 119, 62, 198, 51, 50, 144, 130, 94, 251, 73, 167, 179, 45, 29, 251, 194,
+    72, 192, 114, 210, 136, 5, 187, 27, 138, 173, 206, 184, 64, 179, 66, 68, 146, 208, 71, 242, 134, 81, 195, 40, 90,
+    25, 207, 169, 235, 29, 153, 108, 123, 102, 242, 49, 74, 207, 236, 92, 139, 131, 48, 14, 123, 67, 53, 76, 29, 243,
+    17, 176, 233, 203, 122, 81, 84, 178, 201, 15, 54, 184, 215, 199, 191, 44, 121, 41, 15, 216, 242, 240, 237, 200, 162,
+    72, 207, 31, 152, 238, 192, 2, 115, 250, 3, 11, 133, 191, 164, 30, 140, 232, 135, 136, 147, 15, 95, 92, 229, 214,
+    181, 77, 170, 246, 220, 143, 161, 80, 215, 232, 149, 18, 73, 104, 201, 58, 184, 38, 243, 8, 12, 70, 183, 219, 207,
+    213, 177, 17, 158, 46, 162, 15, 91, 217, 233, 9, 160, 129, 161, 164, 134, 175, 186, 214, 100, 57, 102, 157, 138, 26,
+    227, 119, 81, 167, 183, 153, 146, 150, 155, 32, 110, 3, 234, 69, 226, 109, 207, 226, 244, 3, 109, 13, 205, 23, 172,
+    187, 113, 46, 148, 136, 129, 128, 76, 124, 45, 189, 188, 195, 167, 185, 157, 229, 55, 23, 37, 200, 158, 242, 18,
+    131, 22, 167, 60, 32, 174, 26, 201, 244, 29, 173, 220, 181, 206, 110, 250, 147, 203, 72, 200, 50, 44, 52, 95, 245,
+    198, 220, 86, 54, 192, 136, 210, 228, 14, 229, 105, 99, 160, 185, 150, 159, 209, 61, 228, 165, 146, 77, 165, 98,
+    126, 174, 111, 198, 95, 208, 111, 150, 248, 196, 186, 8, 49, 138, 216, 125, 185, 201, 201, 180, 129, 213, 64, 211,
+    166, 18, 178, 42, 31, 82, 190, 253, 98, 34, 201, 207, 150, 240, 237, 200, 68, 84, 112, 252, 209, 203, 220, 156, 37,
+    24, 41, 109, 13, 175, 144, 160, 74, 46, 109, 42, 88, 181, 81, 51, 20, 66, 53, 64, 59, 226, 44, 40, 174, 181, 60, 23,
+    246, 145, 68, 56, 201, 201, 94, 90, 45, 203, 105, 85, 100, 79, 59, 136, 45, 99, 255, 20, 111, 139, 74, 191, 41, 254,
+    185, 236, 4, 99, 101, 190, 172, 141, 16, 41, 73, 115, 254, 66, 178, 74, 173, 163, 178, 47, 1, 6, 153, 176, 83, 201,
+    11, 229, 222, 226, 198, 91, 54, 196, 22, 32, 203, 115, 98, 170, 5, 188, 193, 6, 28, 37, 4, 4, 139, 31, 63, 170, 62,
+    136, 87, 229, 57, 26, 90, 197, 110, 181, 198, 244, 109, 237, 164, 202, 67, 138, 154, 25, 44, 37, 34, 23, 238, 114,
+    105, 71, 53, 35, 224, 106, 71, 214, 208, 64, 84, 189, 207, 7, 6, 174, 179, 35, 32, 21, 52, 127, 78, 211, 76, 93, 80,
+    22, 16, 116, 232, 134, 135, 43, 28, 241, 159, 243, 132, 43, 53, 170, 20, 73, 189, 149, 229, 159, 197, 225, 115, 146,
+    220, 224, 10, 107, 0, 2, 41, 22, 24, 168, 169, 171, 251, 196, 13, 72, 22, 73, 124, 105, 17, 22, 44, 61, 218, 245,
+    240, 169, 175, 106, 159, 224, 25, 162, 210, 44, 12, 85, 249, 124, 130, 206, 132, 54, 182, 247, 219, 248, 152, 197,
+    231, 108, 180, 105, 81, 60, 74, 201, 10, 12, 2, 124, 170, 190, 164, 36, 238, 129, 210, 68, 164, 24, 169, 45, 64,
+    200, 26, 149, 37, 252, 15, 172, 140, 211, 24, 127, 117, 234, 246, 67, 158, 181, 183, 34, 194, 253, 141, 104, 66,
+    248, 8, 136, 94, 239, 110, 186, 202, 125, 242, 102, 45, 139, 34, 103, 210, 203, 66, 130, 22, 66, 79, 250, 196, 130,
+    2, 37, 165, 238, 38, 157, 126, 95, 26, 143, 184, 167, 168, 53, 147, 202, 187, 59, 201, 140, 28, 51, 246, 110, 230,
+    154, 249, 172, 80, 218, 248, 63, 233, 108, 179, 45, 114, 253, 160, 175, 51, 173, 56, 152, 57, 27, 215, 75, 64, 45,
+    147, 98, 211, 74, 161, 50, 248, 126, 253, 62, 21, 9, 66, 197, 135, 236, 45, 69, 169, 63, 25, 105, 6, 246, 104, 223,
+    57, 142, 218, 110, 114, 18, 60, 247, 228, 106, 132, 173, 39, 190, 5, 32, 64, 70, 50, 153, 98, 24, 199, 56, 249, 235,
+    99, 123, 224, 62, 197, 130, 45, 11, 86, 152, 31, 44, 4, 157, 80, 54, 199, 134, 49, 76, 49, 250, 66, 131, 78, 255,
+    10, 224, 55, 31, 147, 4, 113, 27, 248, 189, 231, 82, 43, 147, 73, 122, 32, 102, 93, 134, 194, 100, 250, 38, 15, 134,
+    16, 71, 50, 199, 134, 77, 215, 122, 213, 90, 220, 41, 45, 78, 145, 41, 75, 149, 194, 231, 40, 189, 48, 44, 73, 141,
+    213, 62, 148, 81, 52, 52, 121, 28, 249, 250, 24, 67, 65, 189, 131, 175, 255, 179, 140, 74, 152, 8, 26, 227, 77, 61,
+    210, 30, 115, 51, 233, 66, 171, 42, 7, 48, 206, 122, 168, 133, 29, 254, 228, 150, 166, 122, 222, 231, 0, 59, 31, 95,
+    136, 169, 170, 157, 15, 229, 60, 254, 68, 11, 40, 114, 159, 182, 252, 244, 90, 103, 46, 139, 56, 161, 118, 139, 61,
+    230, 92, 22, 188, 115, 91, 141, 130, 197, 86, 31, 173, 43, 246, 203, 200, 244, 50, 77, 232, 50, 171, 172, 111, 254,
+    221, 230, 86, 95, 99, 71, 129, 247, 213, 246, 223, 210, 120, 174, 51, 209, 122, 106, 58, 241, 148, 117, 222, 251,
+    138, 209, 118, 56, 1, 163, 226, 210, 136, 172, 22, 139, 98, 20, 124, 90, 65, 64, 140, 71, 59, 61, 54, 29, 73, 230,
+    204, 0, 12, 147, 124, 191, 239, 4, 21, 97, 49, 199, 64, 149, 28, 84, 166, 192, 39, 137, 221, 101, 1, 85, 133, 230,
+    1, 154, 198, 254, 85, 184, 218, 238, 4, 82, 103, 245, 136, 211, 29, 85, 189, 151, 131, 184, 199, 195, 205, 27, 6,
+    172, 85, 31, 18, 5, 108, 97, 58, 48, 31, 192, 220, 72, 106, 88, 224, 241, 130, 165, 246, 5, 224, 240, 134, 187, 254,
+    115, 123, 36, 17, 253, 135, 40, 252, 123, 60, 138, 246, 96, 97, 156, 198, 35, 37, 53, 47, 245, 134, 235, 75, 243,
+    227, 211, 120, 84, 207, 209, 218, 244, 237, 63, 87, 254, 38, 230, 221, 75, 186, 228, 157, 207, 135, 99, 58, 94, 29,
+    5, 164, 87, 90, 254, 201, 91, 226, 54, 205, 190, 168, 136, 31, 211, 6, 174, 2, 228, 230, 62, 103, 206, 52, 50, 133,
+    171, 53, 177, 120, 12, 133, 22, 119, 205, 176, 77, 106, 96, 54, 138, 90, 209, 238, 200, 16, 180, 74, 18, 163, 137,
+    173, 142, 206, 186, 38, 187, 206, 168, 122, 15, 119, 104, 110, 87, 215, 33, 124, 210, 178, 149, 75, 57, 221, 194,
+    199, 120, 243, 201, 38, 123, 249, 12, 18, 102, 17, 43, 253, 129, 44, 144, 179, 115, 183, 65, 137, 43, 64, 61, 118,
+    240, 122, 251, 237, 252, 243, 183, 255, 51, 150, 141, 97, 147, 253, 200, 55, 205, 254, 12, 57, 38, 214, 121, 243, 3,
+    95, 69, 2, 217, 121, 209, 217, 157, 44, 65, 131, 123, 234, 39, 167, 235, 101, 193, 232, 84, 234, 153, 142, 238, 24,
+    247, 12, 108, 34, 201, 247, 2, 1, 201, 17, 96, 141, 145, 70, 221, 90, 189, 191, 238, 214, 204, 88, 220, 231, 77,
+    179, 189, 27, 39, 40, 89, 60, 162, 192, 63, 154, 246, 148, 162, 201, 9, 231, 90, 188, 166, 60, 254, 161, 73, 70,
+    246, 13, 201, 10, 221, 31, 16, 29, 159, 19, 213, 87, 220, 161, 19, 179, 48, 198, 109, 153, 60, 114, 157, 131, 15,
+    51, 93, 115, 223, 31, 46, 149, 191, 254, 116, 38, 245, 117, 153, 230, 233, 133, 85, 27, 123, 117, 173, 212, 210,
+    173, 155, 97, 182, 38, 178, 239, 53, 46, 177, 215, 159, 245, 168, 123, 182, 229, 139, 99
 };  // g_palPlatformJsonData[]
 
 } // Pal
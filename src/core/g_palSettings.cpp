@@ -80,6 +80,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.disableOptimizedDisplay = false;
     m_settings.overlayReportHDR = true;
     m_settings.preferredPipelineUploadHeap = PipelineHeapDeferToClient;
+    m_settings.enablePipelineCodeDedup = false;
 #if PAL_DEVELOPER_BUILD
     m_settings.insertGuardPageBetweenWddm2VAs = false;
 #endif
@@ -91,6 +92,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.updateOneGpuVirtualAddress = false;
     m_settings.alwaysResident = false;
     m_settings.disableSyncobjFence = false;
+    m_settings.enableFenceCompletionThread = false;
     m_settings.disableSdmaEngine = false;
     m_settings.enableVmAlwaysValid = VmAlwaysValidDefaultEnable;
     m_settings.disableSyncObject = false;
@@ -289,6 +291,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.preferredPipelineUploadHeap,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnablePipelineCodeDedupStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enablePipelineCodeDedup,
+                           InternalSettingScope::PrivatePalKey);
+
 #if PAL_DEVELOPER_BUILD
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pInsertGuardPageBetweenWddm2VAsStr,
                            Util::ValueType::Boolean,
@@ -331,6 +338,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.disableSyncobjFence,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnableFenceCompletionThreadStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enableFenceCompletionThread,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pDisableSdmaEngineStr,
                            Util::ValueType::Boolean,
                            &m_settings.disableSdmaEngine,
@@ -744,6 +756,11 @@ void SettingsLoader::InitSettingsInfo()
     info.pValuePtr = &m_settings.preferredPipelineUploadHeap;
     info.valueSize = sizeof(m_settings.preferredPipelineUploadHeap);
     m_settingsInfoMap.Insert(1170638299, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enablePipelineCodeDedup;
+    info.valueSize = sizeof(m_settings.enablePipelineCodeDedup);
+    m_settingsInfoMap.Insert(3977322071, info);
 #if PAL_DEVELOPER_BUILD
 
     info.type      = SettingType::Boolean;
@@ -787,6 +804,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.disableSyncobjFence);
     m_settingsInfoMap.Insert(1287715858, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enableFenceCompletionThread;
+    info.valueSize = sizeof(m_settings.enableFenceCompletionThread);
+    m_settingsInfoMap.Insert(2267293149, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.disableSdmaEngine;
     info.valueSize = sizeof(m_settings.disableSdmaEngine);
@@ -1068,7 +1090,7 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palJsonData[0];
             component.settingsDataSize = sizeof(g_palJsonData);
-            component.settingsDataHash = 3655312250;
+            component.settingsDataHash = 314681944;
             component.settingsDataHeader.isEncoded = true;
             component.settingsDataHeader.magicBufferId = 402778310;
             component.settingsDataHeader.magicBufferOffset = 0;
@@ -186,6 +186,7 @@ struct PalSettings : public Pal::DriverSettings
     bool                                        disableOptimizedDisplay;
     bool                                        overlayReportHDR;
     PreferredPipelineUploadHeap                 preferredPipelineUploadHeap;
+    bool                                        enablePipelineCodeDedup;
 #if PAL_DEVELOPER_BUILD
     bool                                        insertGuardPageBetweenWddm2VAs;
 #endif
@@ -197,6 +198,7 @@ struct PalSettings : public Pal::DriverSettings
     bool                                        updateOneGpuVirtualAddress;
     bool                                        alwaysResident;
     bool                                        disableSyncobjFence;
+    bool                                        enableFenceCompletionThread;
     bool                                        disableSdmaEngine;
     VmAlwaysValidEnable                         enableVmAlwaysValid;
     bool                                        disableSyncObject;
@@ -279,6 +281,7 @@ static const char* pAddr2DisableSModes8BppColorStr = "#3379142860";
 static const char* pDisableOptimizedDisplayStr = "#3371140286";
 static const char* pOverlayReportHDRStr = "#2354711641";
 static const char* pPreferredPipelineUploadHeapStr = "#1170638299";
+static const char* pEnablePipelineCodeDedupStr = "#3977322071";
 #if PAL_DEVELOPER_BUILD
 static const char* pInsertGuardPageBetweenWddm2VAsStr = "#3303637006";
 #endif
@@ -290,6 +293,7 @@ static const char* pForce64kPageGranularityStr = "#1833432496";
 static const char* pUpdateOneGpuVirtualAddressStr = "#4178383571";
 static const char* pAlwaysResidentStr = "#198913068";
 static const char* pDisableSyncobjFenceStr = "#1287715858";
+static const char* pEnableFenceCompletionThreadStr = "#2267293149";
 static const char* pDisableSdmaEngineStr = "#2254617940";
 static const char* pEnableVmAlwaysValidStr = "#1718264096";
 static const char* pDisableSyncObjectStr = "#830933859";
@@ -371,6 +375,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 3371140286,
 2354711641,
 1170638299,
+3977322071,
 #if PAL_DEVELOPER_BUILD
 3303637006,
 #endif
@@ -382,6 +387,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 4178383571,
 198913068,
 1287715858,
+2267293149,
 2254617940,
 1718264096,
 830933859,
@@ -1014,1257 +1020,1307 @@ static const uint8 g_palJsonData[] = {
     119, 217, 167, 99, 210, 176, 49, 143, 210, 15, 76, 236, 172, 172, 100, 161, 158, 43, 173, 243, 50, 249, 125, 45, 44,
     64, 24, 170, 87, 108, 128, 101, 103, 44, 206, 40, 111, 158, 50, 64, 214, 254, 134, 5, 106, 86, 188, 207, 6, 86, 107,
     75, 119, 157, 75, 192, 53, 63, 27, 234, 218, 142, 236, 243, 155, 201, 216, 20, 92, 33, 102, 147, 90, 33, 160, 100,
-    31, 219, 159, 205, 94, 76, 192, 107, 23, 164, 50, 63, 145, 162, 107, 173, 2, 77, 104, 238, 65, 205, 87, 244, 203, 0,
-    178, 87, 53, 7, 183, 87, 21, 22, 241, 101, 5, 194, 224, 233, 170, 3, 215, 146, 163, 22, 219, 177, 232, 151, 95, 61,
-    96, 24, 16, 241, 76, 53, 219, 80, 203, 84, 83, 5, 197, 217, 239, 76, 101, 36, 188, 29, 36, 10, 254, 16, 61, 20, 231,
-    63, 12, 205, 175, 235, 44, 124, 184, 70, 141, 241, 234, 252, 224, 100, 20, 22, 188, 157, 133, 197, 232, 119, 161,
-    234, 14, 121, 220, 222, 227, 213, 234, 84, 151, 16, 155, 47, 48, 61, 207, 100, 55, 196, 81, 55, 137, 0, 246, 189,
-    94, 248, 175, 169, 219, 216, 174, 151, 2, 103, 208, 128, 29, 240, 224, 73, 171, 154, 70, 189, 28, 150, 164, 211,
-    176, 29, 118, 36, 108, 11, 185, 175, 168, 102, 236, 109, 118, 116, 81, 0, 71, 50, 112, 38, 132, 213, 3, 85, 42, 234,
-    81, 19, 23, 82, 92, 64, 60, 14, 26, 18, 157, 43, 13, 117, 214, 95, 21, 99, 54, 182, 16, 81, 195, 180, 42, 146, 182,
-    192, 188, 161, 131, 244, 127, 153, 70, 131, 205, 202, 90, 59, 84, 42, 20, 65, 153, 57, 78, 10, 167, 211, 92, 50,
-    146, 152, 194, 145, 127, 106, 30, 197, 255, 51, 155, 85, 77, 33, 225, 238, 122, 139, 121, 105, 215, 69, 250, 168,
-    242, 249, 67, 41, 151, 2, 99, 191, 206, 34, 246, 118, 206, 76, 41, 250, 46, 79, 69, 151, 34, 192, 237, 148, 217, 41,
-    52, 173, 107, 94, 110, 225, 234, 233, 198, 222, 114, 130, 89, 249, 212, 150, 126, 225, 201, 16, 159, 176, 30, 5,
-    208, 84, 239, 169, 179, 145, 184, 108, 127, 114, 178, 173, 75, 140, 194, 114, 59, 101, 52, 30, 31, 224, 10, 243,
-    173, 200, 160, 117, 74, 180, 50, 187, 51, 238, 155, 222, 84, 89, 37, 195, 202, 250, 120, 127, 50, 250, 89, 0, 5, 89,
-    50, 135, 114, 160, 179, 89, 115, 1, 53, 189, 159, 219, 244, 30, 210, 196, 131, 52, 210, 90, 204, 27, 138, 51, 80,
-    128, 116, 199, 144, 164, 49, 17, 179, 61, 60, 178, 39, 9, 66, 14, 177, 94, 11, 1, 131, 232, 89, 240, 25, 221, 89,
-    251, 111, 77, 148, 1, 159, 47, 85, 65, 59, 197, 186, 114, 234, 182, 119, 78, 104, 73, 25, 29, 192, 113, 105, 141,
-    156, 44, 144, 18, 20, 118, 213, 165, 114, 56, 195, 107, 213, 111, 207, 192, 187, 145, 21, 99, 22, 24, 180, 179, 16,
-    156, 188, 111, 208, 84, 88, 33, 184, 103, 131, 151, 225, 233, 170, 194, 33, 114, 242, 141, 180, 27, 188, 120, 162,
-    77, 5, 107, 90, 21, 9, 237, 3, 225, 84, 234, 111, 245, 129, 23, 23, 86, 186, 154, 131, 45, 206, 25, 23, 52, 44, 79,
-    158, 6, 152, 158, 59, 59, 46, 184, 28, 114, 250, 222, 71, 214, 147, 168, 8, 208, 41, 101, 49, 188, 85, 23, 124, 98,
-    127, 45, 169, 142, 95, 168, 0, 249, 150, 44, 177, 38, 186, 253, 226, 244, 178, 68, 73, 9, 189, 121, 52, 206, 83, 53,
-    17, 126, 136, 243, 100, 237, 124, 223, 75, 85, 66, 26, 166, 8, 42, 36, 245, 4, 61, 55, 49, 151, 70, 108, 123, 166,
-    71, 185, 211, 120, 101, 214, 122, 147, 160, 133, 81, 99, 67, 244, 4, 118, 114, 21, 184, 50, 36, 16, 167, 89, 71,
-    157, 58, 136, 38, 12, 148, 142, 105, 55, 126, 119, 87, 56, 143, 0, 59, 74, 97, 222, 193, 67, 240, 122, 56, 85, 75,
-    8, 232, 151, 39, 84, 171, 227, 96, 105, 239, 196, 146, 60, 90, 66, 148, 242, 121, 50, 223, 134, 32, 14, 45, 63, 193,
-    30, 52, 82, 15, 42, 144, 126, 156, 229, 149, 87, 15, 88, 121, 161, 157, 17, 213, 48, 122, 42, 246, 156, 230, 39, 33,
-    23, 180, 185, 35, 4, 12, 136, 56, 232, 42, 129, 49, 255, 231, 109, 231, 199, 96, 34, 108, 21, 127, 72, 69, 31, 85,
-    103, 208, 83, 167, 235, 62, 59, 69, 147, 250, 164, 243, 253, 125, 52, 209, 184, 115, 80, 49, 78, 29, 172, 145, 207,
-    80, 139, 126, 103, 8, 4, 82, 77, 247, 80, 140, 142, 140, 103, 39, 85, 224, 25, 103, 125, 142, 151, 27, 97, 252, 114,
-    88, 80, 203, 30, 16, 207, 210, 218, 242, 57, 61, 223, 225, 63, 43, 166, 212, 158, 194, 143, 67, 4, 222, 139, 29,
-    176, 187, 196, 109, 149, 56, 94, 82, 74, 156, 132, 235, 61, 171, 134, 68, 175, 20, 97, 4, 192, 77, 218, 173, 167,
-    209, 176, 83, 64, 245, 208, 146, 161, 150, 62, 109, 92, 212, 220, 94, 213, 222, 185, 187, 127, 246, 140, 229, 174,
-    0, 137, 185, 250, 162, 43, 172, 79, 146, 53, 16, 234, 161, 122, 46, 73, 77, 52, 45, 62, 234, 107, 53, 215, 3, 76,
-    28, 215, 235, 118, 99, 114, 208, 0, 206, 139, 33, 47, 9, 121, 193, 126, 98, 76, 122, 247, 211, 230, 112, 189, 62,
-    231, 146, 144, 193, 202, 99, 2, 8, 171, 111, 169, 204, 225, 100, 130, 67, 40, 112, 232, 76, 35, 185, 52, 178, 5,
-    215, 119, 163, 181, 224, 3, 143, 181, 63, 254, 202, 99, 45, 99, 3, 36, 110, 40, 84, 73, 243, 168, 254, 134, 85, 44,
-    104, 14, 54, 113, 43, 52, 3, 61, 11, 252, 3, 76, 149, 92, 254, 197, 43, 239, 74, 156, 146, 194, 241, 188, 56, 8,
-    144, 152, 128, 179, 144, 147, 117, 191, 219, 41, 37, 47, 195, 11, 111, 203, 30, 199, 75, 198, 151, 91, 151, 14, 214,
-    205, 140, 171, 4, 225, 230, 24, 109, 185, 89, 193, 97, 240, 230, 194, 91, 94, 77, 240, 223, 28, 197, 235, 223, 93,
-    178, 149, 178, 210, 138, 38, 237, 2, 102, 29, 2, 97, 107, 211, 47, 97, 102, 92, 116, 197, 109, 91, 254, 112, 5, 91,
-    151, 32, 156, 125, 235, 165, 116, 127, 6, 142, 10, 223, 162, 27, 81, 243, 165, 208, 183, 162, 242, 100, 65, 8, 36,
-    91, 106, 98, 164, 73, 242, 17, 2, 62, 150, 64, 25, 40, 196, 236, 110, 116, 209, 153, 81, 62, 230, 221, 72, 126, 149,
-    204, 131, 181, 166, 5, 138, 221, 19, 126, 122, 221, 11, 121, 193, 158, 169, 122, 158, 253, 50, 234, 247, 99, 222,
-    98, 219, 62, 231, 83, 125, 102, 246, 36, 146, 153, 22, 82, 248, 100, 153, 96, 114, 72, 91, 131, 218, 189, 117, 95,
-    9, 110, 157, 229, 92, 204, 91, 175, 8, 158, 71, 146, 155, 60, 204, 238, 204, 210, 12, 83, 147, 194, 108, 185, 193,
-    5, 253, 62, 138, 3, 151, 7, 184, 76, 251, 48, 76, 227, 110, 35, 253, 123, 47, 97, 253, 90, 18, 0, 166, 26, 48, 3,
-    167, 32, 181, 24, 160, 168, 110, 76, 70, 78, 39, 138, 250, 252, 43, 83, 158, 188, 209, 188, 21, 147, 71, 64, 62,
-    176, 115, 108, 164, 180, 118, 142, 31, 66, 155, 181, 205, 221, 57, 246, 225, 88, 114, 191, 67, 71, 188, 192, 175,
-    101, 76, 41, 132, 112, 160, 29, 166, 22, 51, 55, 106, 60, 50, 176, 132, 114, 172, 77, 133, 196, 147, 87, 16, 111, 5,
-    63, 152, 16, 236, 249, 12, 142, 31, 31, 44, 67, 26, 88, 231, 131, 200, 22, 55, 181, 35, 144, 151, 189, 181, 60, 180,
-    73, 219, 251, 14, 58, 81, 219, 85, 215, 94, 137, 164, 197, 63, 95, 198, 185, 80, 69, 218, 216, 33, 94, 184, 197,
-    118, 48, 70, 24, 38, 213, 155, 251, 125, 193, 125, 173, 135, 162, 184, 247, 73, 147, 151, 89, 138, 57, 12, 140, 134,
-    165, 193, 25, 50, 138, 107, 179, 73, 249, 4, 110, 66, 8, 79, 20, 31, 185, 18, 6, 211, 219, 19, 12, 54, 150, 61, 208,
-    140, 74, 130, 208, 199, 118, 78, 232, 5, 130, 194, 42, 252, 75, 54, 219, 13, 203, 173, 55, 15, 205, 192, 223, 136,
-    78, 181, 81, 85, 179, 62, 127, 76, 203, 175, 239, 152, 92, 219, 203, 233, 163, 246, 195, 4, 14, 102, 45, 124, 165,
-    167, 175, 253, 78, 181, 220, 180, 130, 107, 145, 130, 157, 251, 23, 71, 153, 165, 8, 118, 176, 153, 140, 28, 36, 41,
-    26, 73, 249, 99, 178, 190, 247, 156, 124, 57, 35, 130, 210, 15, 195, 49, 228, 18, 176, 174, 241, 30, 250, 41, 38,
-    41, 224, 146, 193, 142, 253, 250, 255, 27, 235, 112, 70, 190, 6, 68, 205, 238, 129, 58, 128, 122, 189, 251, 235,
-    140, 184, 90, 10, 255, 202, 171, 30, 226, 216, 252, 249, 139, 85, 254, 217, 199, 40, 67, 170, 166, 33, 156, 40, 86,
-    241, 68, 120, 122, 99, 167, 53, 112, 33, 37, 108, 167, 178, 98, 89, 66, 236, 179, 10, 177, 102, 180, 65, 254, 141,
-    36, 89, 122, 20, 81, 70, 38, 19, 162, 249, 73, 87, 203, 248, 192, 7, 33, 205, 96, 225, 178, 11, 141, 128, 75, 85,
-    196, 100, 154, 210, 117, 93, 170, 128, 14, 29, 1, 169, 217, 83, 168, 227, 0, 212, 7, 43, 105, 124, 102, 226, 252,
-    60, 53, 246, 180, 240, 191, 62, 180, 206, 247, 51, 26, 171, 188, 73, 186, 42, 167, 4, 160, 50, 5, 77, 251, 78, 14,
-    27, 13, 246, 30, 239, 233, 228, 54, 129, 126, 54, 102, 19, 81, 134, 97, 108, 102, 9, 154, 134, 165, 115, 34, 50, 68,
-    150, 10, 171, 59, 38, 19, 157, 191, 69, 21, 134, 111, 141, 3, 7, 28, 112, 128, 242, 95, 26, 109, 56, 34, 150, 120,
-    179, 170, 81, 3, 165, 97, 89, 57, 178, 19, 195, 182, 154, 195, 81, 120, 65, 4, 103, 143, 164, 0, 75, 176, 42, 16,
-    52, 67, 59, 114, 195, 109, 238, 28, 67, 0, 145, 75, 50, 219, 238, 35, 182, 1, 152, 229, 146, 41, 184, 239, 11, 182,
-    104, 92, 241, 103, 146, 169, 50, 193, 55, 205, 42, 99, 104, 246, 68, 39, 44, 48, 57, 245, 222, 8, 23, 105, 9, 188,
-    171, 89, 139, 74, 86, 87, 209, 222, 29, 124, 243, 144, 214, 158, 63, 121, 246, 186, 36, 23, 28, 90, 150, 233, 209,
-    92, 188, 213, 224, 102, 179, 23, 165, 204, 118, 240, 79, 45, 69, 28, 189, 152, 49, 73, 74, 97, 234, 238, 89, 213, 2,
-    39, 83, 85, 254, 29, 68, 44, 86, 149, 166, 96, 26, 59, 80, 149, 47, 200, 66, 179, 44, 68, 168, 117, 47, 38, 122, 99,
-    107, 85, 68, 146, 193, 219, 254, 212, 175, 157, 78, 172, 48, 241, 159, 119, 40, 29, 135, 241, 54, 121, 134, 11, 111,
-    224, 142, 25, 23, 32, 183, 184, 5, 234, 202, 184, 141, 86, 134, 195, 239, 184, 128, 115, 232, 246, 117, 161, 90, 14,
-    196, 84, 63, 254, 64, 105, 226, 205, 169, 255, 236, 94, 63, 165, 223, 172, 154, 6, 238, 223, 31, 245, 221, 211, 192,
-    35, 25, 133, 38, 68, 68, 202, 236, 219, 249, 223, 133, 236, 27, 17, 111, 73, 36, 15, 82, 6, 97, 173, 35, 188, 166,
-    75, 173, 135, 167, 105, 125, 210, 155, 82, 44, 53, 1, 114, 238, 187, 75, 182, 20, 173, 80, 15, 101, 178, 175, 57,
-    181, 158, 240, 154, 168, 240, 172, 77, 161, 229, 17, 163, 110, 250, 142, 254, 154, 200, 219, 131, 169, 217, 89, 161,
-    26, 148, 244, 215, 191, 83, 233, 210, 1, 8, 67, 113, 170, 33, 184, 106, 189, 215, 157, 18, 119, 173, 93, 144, 60,
-    230, 85, 94, 130, 63, 105, 37, 181, 98, 219, 220, 244, 98, 104, 86, 130, 2, 231, 236, 195, 68, 147, 173, 97, 29,
-    130, 88, 170, 138, 144, 101, 85, 94, 220, 51, 214, 72, 99, 184, 32, 116, 204, 94, 195, 246, 43, 32, 239, 123, 176,
-    44, 68, 164, 183, 242, 106, 208, 196, 179, 104, 210, 137, 223, 39, 48, 129, 111, 247, 225, 69, 178, 16, 205, 110, 6,
-    22, 163, 221, 204, 29, 238, 72, 218, 156, 91, 66, 196, 104, 12, 101, 195, 177, 60, 102, 212, 137, 124, 86, 43, 145,
-    68, 184, 241, 79, 214, 119, 180, 75, 212, 237, 65, 65, 4, 17, 198, 104, 40, 196, 201, 187, 124, 131, 243, 18, 11,
-    44, 172, 218, 255, 156, 140, 68, 205, 229, 141, 83, 117, 170, 240, 222, 218, 173, 54, 94, 69, 119, 17, 121, 151,
-    138, 63, 99, 16, 182, 1, 13, 222, 129, 152, 232, 55, 210, 120, 58, 39, 133, 92, 157, 61, 15, 235, 236, 52, 229, 11,
-    57, 182, 112, 194, 138, 26, 166, 163, 235, 242, 221, 181, 206, 24, 110, 122, 222, 104, 83, 195, 30, 56, 212, 40, 43,
-    125, 94, 233, 97, 99, 133, 136, 56, 100, 77, 95, 89, 1, 85, 250, 1, 96, 24, 86, 141, 248, 45, 130, 31, 97, 207, 62,
-    147, 151, 112, 199, 203, 245, 222, 223, 137, 18, 64, 74, 6, 0, 2, 79, 170, 74, 150, 236, 214, 37, 225, 68, 5, 90,
-    208, 59, 37, 37, 40, 38, 178, 216, 134, 151, 107, 189, 234, 214, 65, 63, 196, 44, 64, 22, 14, 59, 201, 20, 139, 169,
-    98, 90, 228, 94, 15, 245, 79, 144, 122, 174, 31, 230, 15, 221, 60, 126, 153, 132, 110, 227, 198, 248, 244, 10, 195,
-    65, 43, 232, 48, 36, 49, 56, 139, 143, 70, 185, 137, 42, 246, 13, 218, 60, 10, 167, 108, 132, 99, 171, 223, 249,
-    202, 150, 220, 240, 5, 164, 23, 33, 40, 206, 188, 22, 31, 250, 10, 76, 84, 8, 125, 20, 103, 115, 14, 35, 32, 97,
-    211, 201, 119, 23, 27, 98, 128, 44, 85, 195, 235, 167, 65, 25, 179, 23, 118, 112, 9, 196, 9, 179, 55, 48, 11, 88,
-    111, 17, 237, 87, 114, 245, 114, 79, 96, 52, 34, 60, 40, 109, 27, 86, 65, 98, 38, 34, 195, 77, 55, 197, 188, 4, 78,
-    86, 81, 227, 89, 225, 114, 67, 35, 46, 66, 97, 51, 198, 182, 236, 204, 19, 219, 51, 140, 13, 124, 178, 70, 237, 21,
-    89, 70, 41, 237, 13, 1, 119, 75, 253, 85, 215, 218, 177, 103, 105, 2, 2, 173, 63, 251, 202, 100, 43, 232, 172, 38,
-    141, 155, 243, 39, 241, 237, 129, 132, 51, 71, 107, 127, 140, 157, 64, 199, 146, 180, 140, 18, 223, 188, 97, 30,
-    155, 236, 129, 16, 150, 155, 134, 249, 6, 97, 31, 208, 5, 100, 240, 209, 156, 87, 11, 57, 214, 181, 213, 238, 75, 9,
-    38, 178, 104, 89, 62, 192, 168, 0, 20, 81, 99, 177, 228, 122, 255, 50, 58, 4, 254, 214, 81, 47, 153, 42, 204, 74,
-    36, 66, 106, 34, 237, 228, 45, 210, 63, 250, 10, 101, 59, 233, 41, 206, 217, 117, 156, 249, 192, 111, 72, 99, 80,
-    56, 55, 202, 196, 173, 253, 151, 145, 32, 183, 147, 217, 3, 13, 56, 245, 1, 110, 248, 80, 218, 161, 99, 1, 107, 101,
-    171, 240, 15, 178, 190, 91, 128, 183, 37, 237, 87, 120, 83, 11, 179, 84, 178, 230, 178, 84, 26, 107, 198, 44, 236,
-    200, 158, 246, 234, 191, 158, 220, 115, 95, 190, 161, 26, 199, 9, 146, 159, 103, 159, 143, 60, 34, 126, 61, 183, 74,
-    13, 253, 113, 166, 176, 147, 234, 127, 24, 190, 215, 31, 39, 117, 20, 83, 3, 253, 15, 87, 4, 202, 84, 222, 19, 181,
-    23, 229, 58, 238, 77, 63, 111, 73, 66, 134, 92, 123, 80, 151, 210, 65, 186, 85, 234, 244, 195, 249, 74, 8, 172, 196,
-    136, 64, 25, 29, 231, 92, 221, 125, 217, 47, 99, 200, 78, 152, 50, 69, 195, 15, 228, 78, 115, 209, 168, 47, 96, 174,
-    50, 23, 226, 171, 136, 152, 89, 180, 190, 180, 219, 194, 13, 33, 152, 106, 22, 179, 174, 92, 139, 76, 79, 92, 219,
-    249, 175, 69, 60, 22, 121, 227, 15, 36, 137, 171, 111, 215, 191, 120, 74, 30, 242, 18, 44, 219, 111, 200, 71, 193,
-    0, 217, 234, 54, 202, 143, 9, 236, 190, 80, 21, 112, 96, 205, 58, 108, 218, 240, 132, 137, 199, 89, 160, 239, 201,
-    224, 170, 71, 246, 123, 231, 109, 123, 233, 17, 189, 48, 14, 9, 137, 242, 235, 132, 176, 180, 26, 60, 216, 177, 129,
-    52, 113, 171, 213, 144, 130, 155, 206, 32, 144, 131, 210, 81, 104, 35, 1, 122, 251, 7, 66, 250, 109, 243, 201, 163,
-    103, 210, 227, 159, 24, 230, 52, 35, 249, 74, 180, 33, 160, 99, 122, 113, 77, 35, 199, 165, 194, 80, 91, 72, 170,
-    167, 141, 211, 68, 35, 200, 62, 52, 0, 105, 126, 157, 89, 249, 113, 50, 23, 164, 87, 196, 27, 111, 143, 214, 102,
-    10, 180, 147, 61, 88, 79, 251, 150, 166, 39, 197, 107, 229, 129, 49, 54, 245, 74, 133, 223, 145, 34, 125, 116, 94,
-    29, 75, 214, 109, 228, 235, 175, 37, 181, 105, 125, 181, 204, 153, 43, 72, 18, 19, 177, 138, 233, 121, 14, 248, 84,
-    36, 99, 102, 200, 39, 171, 81, 172, 105, 180, 108, 56, 201, 185, 164, 95, 213, 253, 241, 202, 182, 73, 29, 17, 215,
-    116, 233, 131, 202, 203, 87, 67, 41, 83, 69, 18, 238, 64, 116, 92, 145, 152, 86, 88, 187, 180, 239, 229, 149, 141,
-    223, 179, 66, 225, 108, 131, 253, 240, 43, 123, 235, 246, 212, 117, 162, 156, 89, 150, 238, 94, 2, 40, 244, 199,
-    105, 72, 241, 162, 4, 27, 185, 227, 28, 3, 94, 86, 110, 108, 107, 155, 132, 217, 211, 132, 90, 68, 243, 236, 1, 180,
-    93, 208, 84, 251, 67, 223, 28, 50, 30, 131, 69, 250, 1, 42, 50, 17, 164, 82, 82, 72, 253, 51, 179, 3, 29, 2, 55, 45,
-    26, 170, 27, 34, 232, 200, 210, 133, 111, 3, 136, 144, 138, 4, 95, 212, 182, 197, 248, 40, 132, 39, 171, 204, 68,
-    38, 201, 172, 42, 56, 62, 86, 91, 184, 110, 204, 77, 159, 104, 184, 33, 42, 245, 235, 58, 210, 0, 172, 76, 162, 206,
-    133, 117, 215, 149, 140, 73, 71, 175, 228, 191, 90, 102, 169, 95, 65, 208, 60, 88, 152, 220, 126, 43, 86, 213, 92,
-    181, 205, 215, 192, 86, 135, 95, 113, 34, 20, 253, 83, 249, 250, 11, 35, 111, 72, 117, 11, 63, 202, 228, 4, 74, 103,
-    104, 117, 67, 213, 39, 223, 57, 211, 7, 173, 233, 164, 72, 198, 4, 122, 22, 128, 152, 223, 208, 55, 72, 18, 104, 76,
-    157, 207, 115, 204, 98, 130, 230, 109, 96, 71, 123, 51, 17, 219, 188, 11, 164, 204, 121, 144, 92, 4, 96, 86, 183,
-    67, 63, 64, 196, 15, 5, 196, 115, 112, 238, 253, 33, 178, 155, 65, 233, 35, 139, 41, 211, 75, 199, 208, 197, 143,
-    157, 244, 178, 204, 184, 238, 112, 245, 209, 135, 80, 226, 255, 211, 73, 38, 135, 45, 85, 240, 85, 180, 52, 36, 153,
-    167, 48, 196, 37, 10, 220, 142, 105, 249, 20, 212, 92, 197, 3, 7, 45, 195, 254, 14, 177, 23, 207, 196, 147, 182, 6,
-    65, 252, 63, 183, 58, 155, 54, 251, 138, 234, 145, 34, 8, 220, 206, 27, 61, 35, 231, 76, 117, 29, 168, 116, 59, 208,
-    51, 38, 174, 107, 63, 20, 232, 192, 151, 120, 10, 178, 117, 73, 165, 250, 113, 137, 122, 18, 79, 135, 149, 201, 27,
-    17, 151, 243, 75, 110, 84, 235, 133, 4, 134, 38, 184, 30, 15, 95, 233, 135, 45, 53, 49, 125, 71, 30, 116, 12, 79,
-    172, 102, 97, 110, 63, 0, 210, 253, 16, 138, 57, 36, 118, 96, 56, 117, 106, 247, 176, 118, 162, 122, 137, 170, 171,
-    119, 84, 107, 91, 85, 141, 22, 28, 78, 144, 54, 212, 216, 112, 150, 177, 150, 133, 177, 67, 204, 133, 165, 197, 197,
-    60, 34, 131, 13, 247, 210, 166, 123, 72, 118, 58, 134, 178, 217, 44, 234, 112, 50, 201, 136, 170, 34, 8, 0, 165,
-    131, 144, 51, 92, 195, 131, 180, 93, 200, 222, 171, 82, 11, 71, 85, 7, 245, 31, 106, 126, 143, 38, 150, 16, 146, 55,
-    38, 96, 159, 92, 41, 158, 80, 33, 199, 21, 34, 120, 156, 7, 72, 243, 38, 220, 64, 114, 7, 115, 210, 3, 22, 208, 100,
-    239, 145, 122, 73, 70, 201, 220, 3, 117, 240, 210, 82, 185, 152, 247, 210, 45, 240, 245, 222, 128, 18, 3, 213, 204,
-    240, 23, 249, 252, 214, 137, 174, 59, 99, 27, 147, 132, 131, 253, 165, 93, 196, 219, 31, 191, 101, 200, 50, 42, 141,
-    238, 172, 233, 155, 34, 97, 8, 0, 241, 138, 253, 93, 75, 217, 184, 149, 5, 180, 70, 35, 253, 7, 62, 214, 121, 121,
-    149, 87, 103, 108, 161, 144, 50, 110, 162, 192, 8, 230, 248, 129, 197, 152, 50, 129, 212, 243, 137, 168, 198, 195,
-    76, 181, 11, 62, 84, 112, 211, 94, 194, 98, 204, 100, 128, 47, 113, 244, 174, 98, 43, 155, 119, 221, 196, 248, 59,
-    169, 222, 170, 90, 226, 207, 196, 108, 27, 192, 14, 155, 65, 49, 166, 17, 233, 199, 48, 90, 250, 128, 60, 244, 54,
-    185, 9, 152, 222, 196, 34, 127, 193, 80, 31, 2, 100, 101, 128, 197, 11, 142, 215, 114, 218, 0, 10, 62, 234, 67, 45,
-    124, 35, 96, 136, 103, 125, 167, 208, 203, 184, 52, 39, 127, 107, 134, 74, 176, 195, 0, 222, 122, 229, 47, 172, 8,
-    189, 180, 167, 220, 224, 240, 89, 78, 87, 124, 4, 54, 46, 203, 118, 124, 107, 214, 243, 36, 15, 212, 51, 246, 198,
-    11, 255, 117, 201, 212, 116, 227, 126, 95, 28, 156, 135, 60, 19, 53, 253, 100, 177, 27, 240, 68, 164, 152, 151, 255,
-    74, 95, 32, 197, 217, 251, 165, 69, 134, 81, 165, 241, 117, 250, 40, 237, 61, 200, 223, 167, 42, 93, 122, 182, 57,
-    129, 210, 126, 154, 59, 29, 60, 129, 91, 117, 106, 252, 76, 147, 181, 118, 116, 163, 156, 84, 60, 183, 18, 224, 109,
-    30, 60, 92, 18, 44, 155, 177, 76, 69, 80, 166, 66, 175, 230, 228, 139, 201, 150, 151, 179, 196, 155, 165, 79, 254,
-    158, 252, 240, 220, 38, 20, 108, 55, 144, 239, 57, 216, 255, 247, 179, 54, 210, 123, 135, 243, 74, 122, 223, 105,
-    155, 141, 215, 111, 253, 162, 200, 119, 177, 242, 9, 157, 159, 21, 33, 62, 254, 252, 127, 211, 10, 138, 120, 50, 53,
-    239, 66, 11, 64, 186, 57, 165, 232, 163, 197, 133, 213, 80, 130, 220, 244, 243, 75, 108, 54, 169, 151, 173, 214, 6,
-    63, 190, 96, 215, 230, 120, 89, 66, 112, 124, 49, 250, 254, 231, 57, 154, 10, 126, 27, 111, 87, 181, 118, 111, 185,
-    23, 189, 167, 213, 193, 41, 119, 167, 80, 130, 106, 146, 9, 5, 182, 119, 26, 108, 11, 6, 57, 70, 96, 72, 101, 251,
-    14, 192, 33, 183, 126, 106, 59, 86, 53, 24, 218, 100, 235, 142, 175, 230, 236, 252, 182, 231, 10, 66, 152, 77, 221,
-    127, 140, 68, 175, 108, 180, 116, 4, 212, 145, 42, 133, 13, 59, 210, 171, 150, 243, 42, 17, 39, 70, 82, 113, 165,
-    175, 214, 147, 162, 32, 28, 12, 27, 199, 250, 145, 99, 103, 49, 214, 202, 91, 156, 59, 38, 18, 245, 165, 53, 49,
-    228, 50, 95, 12, 66, 228, 253, 136, 189, 75, 39, 95, 128, 181, 172, 116, 104, 99, 24, 120, 23, 80, 112, 31, 246, 55,
-    234, 176, 38, 229, 237, 195, 205, 59, 249, 172, 18, 23, 220, 238, 95, 91, 167, 153, 3, 114, 176, 247, 30, 45, 38,
-    150, 127, 171, 75, 38, 96, 231, 35, 243, 185, 34, 154, 51, 13, 127, 58, 51, 29, 207, 162, 11, 247, 5, 104, 219, 228,
-    159, 120, 37, 211, 180, 213, 80, 134, 165, 155, 64, 166, 40, 170, 170, 128, 96, 207, 8, 124, 69, 44, 108, 227, 245,
-    15, 57, 100, 150, 30, 167, 9, 58, 225, 184, 106, 44, 88, 24, 87, 235, 158, 114, 186, 196, 168, 239, 67, 204, 120,
-    17, 123, 174, 36, 182, 145, 208, 106, 253, 44, 91, 249, 72, 167, 148, 254, 8, 20, 227, 107, 253, 55, 216, 148, 231,
-    241, 122, 5, 213, 86, 196, 11, 28, 220, 20, 82, 4, 246, 214, 179, 199, 140, 49, 40, 170, 108, 76, 228, 180, 180, 56,
-    248, 245, 162, 7, 201, 36, 247, 89, 173, 30, 201, 123, 170, 12, 108, 113, 189, 168, 251, 1, 127, 149, 157, 221, 227,
-    229, 69, 214, 49, 218, 178, 22, 122, 97, 98, 225, 136, 97, 3, 84, 79, 144, 110, 178, 179, 192, 31, 248, 132, 59,
-    148, 55, 234, 225, 14, 52, 213, 20, 170, 113, 160, 127, 10, 37, 85, 4, 120, 17, 196, 231, 44, 134, 154, 10, 204, 46,
-    163, 139, 40, 96, 70, 244, 103, 172, 119, 237, 188, 155, 230, 221, 70, 123, 126, 13, 85, 199, 108, 145, 67, 113, 89,
-    47, 32, 249, 15, 22, 28, 70, 211, 239, 161, 163, 155, 16, 215, 226, 150, 221, 112, 46, 55, 67, 15, 189, 68, 51, 191,
-    223, 149, 68, 141, 247, 80, 10, 108, 214, 133, 246, 111, 9, 179, 70, 60, 71, 72, 29, 138, 229, 127, 107, 90, 192,
-    73, 211, 176, 95, 80, 129, 184, 97, 249, 192, 1, 74, 252, 48, 253, 27, 239, 45, 204, 231, 11, 198, 89, 239, 109, 24,
-    105, 43, 172, 87, 252, 42, 115, 141, 250, 32, 152, 147, 64, 124, 4, 18, 168, 114, 169, 59, 7, 96, 87, 188, 127, 46,
-    180, 252, 19, 32, 230, 68, 203, 108, 22, 121, 170, 254, 167, 216, 238, 74, 174, 224, 229, 179, 154, 35, 124, 255,
-    39, 122, 240, 135, 225, 55, 222, 72, 31, 59, 6, 85, 17, 83, 71, 119, 83, 122, 145, 122, 219, 5, 112, 14, 140, 42,
-    133, 12, 31, 216, 215, 107, 105, 83, 252, 95, 11, 141, 234, 177, 67, 160, 13, 21, 160, 17, 59, 155, 6, 166, 181, 86,
-    195, 187, 35, 39, 149, 90, 29, 56, 196, 201, 199, 224, 15, 246, 61, 95, 31, 48, 122, 158, 10, 8, 189, 87, 73, 5,
-    166, 69, 59, 173, 187, 184, 249, 233, 48, 156, 183, 183, 228, 157, 16, 113, 141, 33, 8, 180, 44, 143, 202, 61, 47,
-    225, 81, 125, 186, 110, 141, 154, 167, 194, 234, 208, 95, 162, 134, 52, 182, 12, 96, 142, 148, 112, 151, 249, 239,
-    250, 17, 190, 37, 167, 34, 71, 152, 165, 32, 35, 191, 114, 133, 51, 135, 86, 105, 243, 225, 138, 103, 143, 226, 175,
-    13, 117, 44, 158, 50, 109, 60, 119, 179, 31, 240, 64, 191, 183, 235, 141, 164, 161, 23, 79, 65, 131, 140, 176, 179,
-    189, 205, 129, 136, 164, 236, 169, 157, 113, 43, 123, 239, 58, 69, 196, 157, 189, 94, 125, 161, 201, 30, 26, 253,
-    91, 218, 32, 147, 223, 56, 234, 179, 169, 147, 231, 154, 214, 23, 225, 30, 197, 206, 179, 24, 76, 168, 81, 245, 93,
-    106, 111, 181, 235, 227, 12, 19, 29, 153, 218, 79, 41, 93, 184, 213, 239, 189, 132, 255, 117, 199, 36, 88, 126, 39,
-    20, 245, 207, 239, 99, 44, 171, 67, 84, 127, 196, 99, 134, 94, 186, 35, 103, 39, 169, 212, 24, 79, 112, 106, 18, 78,
-    155, 207, 207, 105, 230, 238, 237, 110, 54, 215, 175, 225, 193, 188, 227, 228, 166, 28, 27, 192, 52, 104, 101, 186,
-    118, 210, 251, 95, 133, 182, 229, 114, 166, 239, 208, 183, 178, 163, 19, 184, 186, 101, 255, 84, 11, 199, 119, 68,
-    211, 69, 28, 192, 153, 47, 214, 132, 4, 177, 181, 155, 150, 26, 162, 84, 159, 226, 108, 79, 10, 184, 207, 96, 139,
-    29, 45, 27, 1, 71, 3, 133, 249, 132, 51, 155, 218, 203, 63, 123, 129, 221, 6, 233, 181, 151, 95, 238, 230, 6, 131,
-    171, 4, 96, 242, 117, 188, 216, 11, 152, 255, 216, 151, 180, 78, 177, 11, 252, 67, 252, 30, 43, 214, 198, 246, 1,
-    216, 16, 208, 46, 138, 56, 19, 103, 39, 153, 228, 146, 135, 186, 36, 2, 4, 174, 3, 167, 99, 126, 178, 58, 128, 27,
-    196, 252, 143, 145, 120, 88, 7, 20, 50, 137, 220, 76, 196, 5, 249, 43, 220, 172, 245, 214, 143, 234, 235, 24, 58,
-    84, 75, 62, 0, 249, 111, 70, 197, 169, 21, 42, 122, 131, 71, 104, 89, 109, 59, 12, 196, 53, 96, 158, 90, 52, 59, 7,
-    208, 109, 125, 174, 118, 214, 76, 148, 214, 116, 176, 186, 135, 200, 123, 14, 120, 43, 130, 110, 168, 137, 182, 176,
-    183, 46, 63, 109, 9, 154, 23, 6, 207, 46, 199, 190, 160, 42, 8, 143, 146, 236, 107, 121, 126, 86, 196, 9, 31, 250,
-    34, 220, 168, 130, 38, 99, 129, 121, 233, 20, 22, 221, 129, 214, 56, 39, 190, 164, 32, 98, 135, 94, 83, 205, 95,
-    198, 168, 31, 126, 57, 92, 27, 80, 1, 135, 218, 147, 100, 89, 123, 215, 156, 127, 116, 157, 42, 88, 104, 104, 101,
-    143, 148, 19, 190, 204, 121, 84, 192, 103, 85, 201, 179, 25, 146, 209, 77, 47, 61, 73, 29, 237, 226, 162, 119, 214,
-    144, 45, 119, 88, 92, 61, 27, 22, 139, 168, 127, 241, 133, 163, 217, 33, 3, 64, 238, 79, 140, 242, 147, 228, 85,
-    249, 112, 47, 77, 208, 170, 79, 255, 44, 230, 249, 160, 56, 224, 164, 43, 189, 31, 189, 75, 194, 210, 231, 34, 72,
-    47, 32, 203, 75, 85, 82, 141, 220, 211, 45, 199, 159, 128, 152, 33, 120, 179, 102, 189, 89, 156, 93, 146, 35, 142,
-    142, 1, 53, 157, 37, 165, 115, 226, 41, 6, 87, 113, 172, 232, 165, 23, 254, 93, 211, 215, 141, 16, 21, 244, 185, 93,
-    250, 137, 108, 133, 147, 25, 93, 140, 172, 195, 92, 168, 167, 215, 5, 78, 60, 63, 153, 156, 74, 56, 115, 231, 238,
-    227, 125, 232, 157, 129, 148, 55, 235, 72, 119, 231, 227, 139, 138, 56, 240, 64, 241, 228, 192, 8, 167, 206, 191,
-    87, 192, 165, 216, 180, 197, 140, 219, 226, 244, 91, 104, 17, 224, 18, 71, 142, 65, 175, 34, 138, 228, 124, 126,
-    218, 202, 101, 233, 200, 219, 117, 39, 182, 103, 183, 251, 138, 122, 100, 106, 223, 62, 67, 4, 176, 140, 20, 123,
-    53, 131, 89, 159, 157, 176, 27, 61, 22, 155, 84, 212, 222, 252, 116, 207, 15, 230, 192, 31, 199, 248, 168, 72, 5,
-    121, 159, 213, 177, 148, 251, 166, 255, 189, 151, 45, 240, 121, 157, 105, 181, 93, 243, 236, 108, 129, 103, 154,
-    109, 20, 7, 101, 127, 204, 246, 7, 187, 127, 131, 17, 195, 91, 159, 146, 42, 132, 236, 143, 152, 161, 175, 250, 165,
-    227, 239, 71, 116, 95, 248, 191, 31, 243, 30, 2, 159, 170, 154, 34, 115, 181, 208, 79, 58, 213, 37, 183, 231, 206,
-    79, 15, 79, 39, 9, 178, 5, 56, 163, 5, 4, 21, 158, 54, 255, 7, 135, 71, 29, 36, 196, 114, 9, 180, 90, 156, 165, 249,
-    86, 31, 206, 89, 59, 71, 16, 175, 32, 160, 21, 159, 21, 28, 228, 173, 163, 140, 26, 88, 153, 35, 51, 54, 22, 38,
-    226, 5, 210, 162, 8, 117, 132, 222, 99, 83, 220, 232, 61, 133, 54, 195, 84, 193, 160, 1, 45, 67, 53, 222, 50, 181,
-    131, 80, 184, 70, 159, 58, 142, 69, 235, 9, 67, 165, 199, 172, 213, 223, 121, 87, 203, 43, 155, 120, 109, 3, 94,
-    202, 32, 159, 237, 110, 222, 205, 190, 254, 49, 32, 72, 60, 108, 209, 23, 61, 32, 56, 155, 18, 131, 240, 87, 53,
-    237, 153, 221, 181, 216, 214, 57, 222, 64, 187, 155, 19, 233, 239, 2, 203, 88, 207, 109, 158, 120, 219, 23, 144,
-    171, 120, 101, 155, 89, 16, 38, 181, 11, 219, 69, 126, 77, 193, 199, 142, 97, 207, 182, 112, 146, 100, 11, 128, 55,
-    188, 213, 24, 254, 79, 43, 1, 253, 139, 113, 75, 177, 54, 246, 70, 60, 10, 37, 19, 43, 193, 21, 160, 175, 191, 186,
-    250, 125, 48, 129, 1, 52, 97, 125, 18, 101, 253, 150, 59, 232, 165, 9, 178, 43, 241, 108, 227, 94, 102, 13, 6, 220,
-    178, 200, 192, 195, 110, 241, 228, 157, 115, 81, 54, 15, 218, 14, 200, 27, 255, 68, 8, 220, 47, 233, 145, 169, 226,
-    40, 166, 47, 174, 6, 254, 145, 89, 122, 232, 99, 154, 102, 207, 221, 5, 83, 159, 222, 57, 205, 29, 136, 169, 95,
-    125, 221, 49, 202, 86, 228, 127, 46, 114, 153, 155, 236, 217, 53, 131, 181, 154, 164, 142, 74, 228, 88, 147, 27, 62,
-    3, 94, 150, 14, 138, 252, 125, 2, 252, 94, 185, 55, 23, 84, 224, 251, 94, 90, 179, 220, 71, 129, 39, 2, 231, 88,
-    185, 76, 72, 91, 108, 151, 221, 115, 7, 30, 35, 40, 227, 90, 133, 89, 239, 235, 232, 95, 209, 5, 163, 126, 118, 137,
-    224, 48, 196, 57, 169, 95, 70, 173, 10, 153, 13, 76, 209, 37, 203, 125, 131, 61, 41, 143, 251, 67, 73, 105, 217, 96,
-    228, 216, 224, 67, 191, 4, 51, 177, 229, 143, 102, 129, 98, 140, 158, 174, 90, 76, 207, 76, 144, 44, 238, 42, 28,
-    221, 195, 140, 45, 43, 42, 191, 96, 37, 73, 90, 152, 196, 14, 228, 136, 158, 72, 98, 176, 140, 199, 125, 134, 4,
-    188, 221, 80, 25, 232, 16, 139, 35, 45, 86, 146, 11, 84, 186, 218, 213, 230, 248, 183, 171, 49, 250, 208, 22, 199,
-    7, 235, 220, 27, 6, 83, 19, 157, 57, 86, 176, 220, 97, 142, 29, 69, 71, 120, 79, 190, 168, 192, 182, 0, 44, 172, 32,
-    156, 95, 116, 82, 90, 23, 148, 74, 153, 76, 237, 122, 2, 62, 228, 177, 157, 145, 210, 153, 94, 220, 62, 41, 89, 92,
-    250, 67, 137, 132, 37, 8, 198, 249, 23, 146, 84, 124, 251, 117, 143, 68, 251, 187, 8, 239, 197, 65, 182, 183, 186,
-    206, 131, 58, 157, 236, 62, 178, 37, 224, 110, 115, 248, 157, 147, 150, 219, 8, 251, 156, 145, 248, 162, 65, 200,
-    221, 93, 204, 7, 49, 116, 131, 106, 87, 233, 221, 50, 187, 255, 88, 175, 151, 190, 223, 100, 91, 227, 153, 31, 123,
-    187, 137, 236, 114, 6, 23, 230, 104, 93, 206, 33, 52, 60, 28, 81, 45, 90, 235, 198, 84, 86, 176, 175, 47, 200, 28,
-    244, 130, 169, 218, 233, 62, 55, 229, 149, 200, 208, 105, 248, 237, 22, 179, 114, 131, 127, 53, 66, 97, 8, 132, 199,
-    240, 217, 73, 120, 236, 148, 78, 14, 52, 71, 233, 138, 151, 133, 114, 221, 218, 241, 48, 76, 53, 35, 12, 37, 22, 48,
-    27, 53, 107, 94, 176, 229, 194, 66, 57, 96, 35, 197, 221, 173, 132, 133, 122, 58, 22, 13, 50, 69, 113, 20, 246, 162,
-    233, 50, 87, 172, 61, 185, 74, 94, 96, 164, 240, 65, 189, 59, 159, 221, 145, 223, 76, 128, 164, 217, 243, 161, 118,
-    39, 213, 23, 55, 102, 239, 123, 146, 209, 223, 219, 154, 181, 65, 113, 57, 222, 254, 49, 2, 130, 64, 66, 24, 165,
-    181, 28, 239, 188, 43, 1, 47, 15, 178, 201, 86, 13, 124, 65, 88, 99, 135, 7, 171, 183, 252, 138, 40, 135, 246, 107,
-    127, 198, 52, 247, 237, 82, 55, 126, 93, 184, 54, 78, 203, 81, 159, 148, 61, 176, 81, 118, 215, 226, 241, 81, 146,
-    41, 79, 12, 151, 16, 221, 95, 125, 227, 157, 252, 113, 181, 224, 164, 38, 7, 47, 6, 3, 157, 100, 197, 109, 40, 249,
-    238, 249, 44, 146, 197, 92, 174, 11, 170, 242, 164, 20, 157, 178, 222, 55, 115, 74, 238, 10, 171, 53, 40, 27, 143,
-    79, 45, 179, 179, 69, 107, 39, 249, 118, 23, 173, 93, 185, 181, 215, 191, 26, 23, 163, 199, 168, 144, 110, 105, 28,
-    112, 199, 131, 254, 42, 208, 59, 139, 220, 196, 97, 96, 211, 46, 61, 82, 79, 214, 140, 125, 122, 111, 185, 64, 210,
-    128, 66, 103, 55, 251, 126, 127, 108, 78, 11, 193, 87, 131, 84, 151, 8, 144, 218, 196, 6, 162, 209, 18, 186, 210,
-    177, 145, 44, 222, 173, 180, 111, 135, 110, 50, 217, 64, 67, 40, 239, 57, 162, 147, 241, 90, 121, 102, 230, 138, 27,
-    192, 94, 138, 139, 229, 236, 69, 111, 250, 126, 195, 70, 58, 33, 81, 227, 123, 213, 88, 114, 33, 5, 223, 199, 149,
-    170, 202, 185, 163, 156, 62, 104, 196, 182, 53, 233, 187, 64, 196, 133, 48, 108, 170, 251, 213, 5, 110, 195, 168,
-    165, 62, 33, 11, 112, 44, 205, 55, 41, 16, 228, 136, 28, 242, 153, 251, 135, 58, 118, 228, 98, 31, 36, 223, 53, 197,
-    27, 78, 166, 12, 174, 8, 213, 6, 28, 223, 63, 201, 135, 230, 248, 193, 50, 68, 33, 151, 155, 140, 156, 213, 240, 35,
-    49, 104, 236, 99, 3, 58, 248, 0, 91, 215, 252, 25, 244, 199, 107, 47, 79, 212, 181, 158, 44, 121, 11, 91, 173, 81,
-    206, 81, 109, 215, 150, 227, 238, 238, 30, 143, 196, 116, 128, 61, 230, 128, 11, 47, 192, 214, 132, 14, 188, 51, 65,
-    54, 10, 160, 233, 125, 219, 186, 102, 29, 100, 236, 133, 86, 252, 173, 156, 137, 142, 136, 121, 27, 136, 99, 239,
-    181, 27, 47, 147, 89, 50, 12, 86, 43, 145, 18, 97, 66, 193, 55, 201, 243, 60, 77, 204, 34, 129, 185, 171, 38, 187,
-    13, 190, 98, 142, 124, 54, 190, 48, 15, 226, 205, 158, 107, 88, 137, 164, 194, 118, 22, 74, 225, 189, 122, 20, 242,
-    190, 33, 31, 77, 130, 162, 101, 44, 67, 28, 95, 246, 228, 215, 86, 206, 123, 101, 196, 31, 221, 163, 178, 63, 188,
-    154, 220, 241, 6, 43, 245, 121, 73, 144, 166, 43, 234, 198, 187, 177, 122, 149, 137, 123, 172, 83, 223, 159, 125,
-    249, 107, 155, 14, 47, 58, 55, 40, 146, 71, 169, 186, 210, 76, 243, 86, 154, 210, 3, 219, 137, 240, 250, 97, 92,
-    250, 253, 129, 109, 203, 105, 128, 229, 154, 22, 101, 58, 179, 62, 224, 68, 122, 159, 53, 4, 2, 26, 12, 243, 187,
-    189, 113, 196, 74, 167, 5, 17, 232, 16, 233, 207, 13, 176, 106, 72, 44, 93, 232, 205, 172, 72, 34, 197, 10, 43, 221,
-    70, 57, 126, 111, 97, 21, 197, 102, 176, 19, 194, 52, 19, 63, 190, 150, 67, 135, 222, 86, 207, 160, 115, 95, 29,
-    189, 64, 35, 43, 228, 237, 199, 23, 190, 167, 193, 188, 29, 143, 1, 147, 181, 209, 59, 2, 81, 130, 139, 218, 148,
-    252, 217, 127, 30, 181, 136, 245, 76, 149, 76, 124, 224, 226, 0, 145, 24, 11, 57, 97, 156, 195, 245, 33, 219, 150,
-    90, 143, 82, 219, 105, 213, 56, 175, 139, 166, 206, 81, 101, 83, 217, 67, 249, 179, 143, 223, 235, 172, 117, 129,
-    127, 69, 161, 96, 80, 116, 200, 33, 116, 13, 100, 112, 99, 20, 149, 223, 135, 94, 177, 92, 110, 255, 58, 125, 176,
-    48, 243, 224, 120, 78, 34, 175, 31, 172, 68, 23, 179, 212, 0, 79, 122, 15, 10, 189, 161, 76, 52, 13, 26, 32, 125,
-    44, 105, 246, 38, 185, 34, 37, 110, 223, 81, 83, 158, 1, 46, 23, 29, 4, 168, 221, 27, 56, 32, 97, 78, 200, 52, 142,
-    246, 20, 141, 90, 31, 218, 153, 139, 1, 79, 131, 36, 70, 124, 250, 249, 100, 104, 132, 211, 187, 252, 35, 74, 47,
-    11, 216, 93, 167, 34, 137, 235, 46, 46, 241, 126, 174, 9, 52, 194, 202, 133, 124, 140, 66, 160, 221, 158, 182, 192,
-    168, 208, 82, 246, 219, 179, 55, 114, 58, 197, 14, 214, 214, 228, 23, 69, 125, 71, 96, 204, 187, 13, 208, 10, 98,
-    249, 165, 7, 136, 110, 159, 255, 101, 154, 202, 224, 250, 111, 199, 246, 123, 181, 32, 143, 102, 177, 15, 210, 142,
-    60, 148, 228, 222, 225, 246, 79, 97, 210, 221, 18, 138, 176, 180, 154, 51, 199, 142, 248, 149, 146, 192, 56, 148,
-    166, 126, 111, 147, 81, 32, 23, 61, 199, 131, 168, 44, 33, 6, 62, 44, 34, 158, 31, 158, 177, 131, 152, 13, 97, 80,
-    93, 233, 48, 222, 100, 130, 107, 211, 132, 76, 227, 113, 108, 52, 121, 42, 116, 255, 147, 231, 181, 240, 50, 167,
-    208, 129, 77, 230, 227, 158, 170, 35, 13, 109, 99, 254, 150, 13, 2, 72, 35, 130, 196, 197, 124, 43, 40, 181, 65,
-    161, 45, 41, 131, 187, 44, 14, 85, 228, 166, 239, 15, 61, 164, 134, 215, 164, 25, 108, 143, 252, 252, 146, 75, 71,
-    137, 165, 139, 35, 233, 102, 195, 230, 255, 254, 133, 1, 153, 128, 143, 167, 2, 178, 241, 59, 225, 144, 66, 211,
-    139, 224, 56, 162, 157, 23, 164, 101, 85, 97, 0, 209, 128, 12, 219, 32, 68, 30, 94, 88, 218, 170, 225, 183, 251, 91,
-    94, 36, 1, 227, 88, 3, 178, 192, 245, 31, 89, 92, 1, 182, 7, 156, 81, 21, 23, 55, 20, 114, 57, 109, 41, 29, 223,
-    116, 103, 181, 172, 43, 203, 221, 70, 152, 96, 27, 7, 178, 199, 121, 41, 123, 113, 135, 246, 197, 43, 236, 20, 222,
-    52, 47, 107, 202, 112, 36, 16, 170, 67, 187, 157, 72, 194, 67, 197, 111, 10, 209, 136, 200, 162, 40, 218, 124, 18,
-    100, 178, 251, 200, 217, 82, 148, 70, 76, 203, 0, 169, 49, 219, 124, 166, 173, 245, 252, 252, 37, 156, 173, 7, 227,
-    2, 47, 45, 152, 132, 251, 4, 167, 217, 94, 59, 99, 185, 64, 11, 136, 206, 6, 208, 84, 180, 86, 13, 33, 162, 139,
-    160, 20, 25, 240, 248, 154, 215, 170, 172, 107, 240, 130, 122, 251, 106, 197, 74, 61, 150, 176, 120, 94, 117, 224,
-    86, 225, 146, 182, 150, 251, 103, 51, 230, 235, 105, 152, 141, 16, 102, 64, 58, 224, 50, 197, 50, 161, 9, 168, 190,
-    164, 57, 146, 78, 157, 15, 225, 45, 196, 168, 216, 25, 181, 249, 146, 72, 106, 1, 153, 26, 201, 49, 235, 15, 189,
-    95, 176, 236, 54, 33, 217, 106, 204, 195, 186, 192, 13, 216, 85, 29, 238, 3, 159, 11, 24, 111, 21, 28, 97, 247, 180,
-    236, 183, 223, 242, 86, 183, 218, 244, 219, 197, 48, 124, 67, 15, 111, 2, 68, 135, 194, 212, 107, 116, 184, 169,
-    126, 217, 187, 203, 131, 111, 96, 135, 205, 23, 209, 37, 42, 55, 109, 65, 24, 224, 113, 226, 179, 186, 194, 107,
-    203, 161, 16, 29, 168, 254, 126, 20, 235, 233, 87, 119, 248, 108, 97, 62, 28, 240, 26, 125, 115, 41, 68, 0, 185,
-    181, 59, 99, 197, 165, 87, 238, 248, 141, 66, 151, 128, 51, 82, 133, 195, 129, 94, 119, 164, 247, 81, 83, 175, 85,
-    162, 148, 153, 226, 84, 94, 82, 18, 142, 85, 32, 21, 123, 225, 154, 238, 130, 135, 81, 21, 138, 54, 85, 147, 112,
-    80, 129, 108, 58, 209, 62, 7, 103, 123, 144, 255, 196, 84, 150, 228, 113, 225, 249, 134, 8, 4, 29, 241, 121, 169,
-    141, 18, 13, 152, 4, 214, 63, 211, 226, 170, 254, 255, 76, 124, 209, 199, 29, 125, 72, 206, 178, 134, 47, 44, 127,
-    255, 102, 170, 218, 23, 152, 20, 252, 218, 244, 186, 37, 245, 109, 95, 243, 212, 179, 235, 45, 49, 192, 92, 126, 55,
-    222, 242, 6, 159, 139, 147, 26, 56, 150, 145, 160, 10, 79, 178, 138, 156, 170, 209, 108, 94, 99, 131, 68, 74, 251,
-    139, 165, 52, 22, 132, 126, 164, 85, 71, 155, 157, 94, 136, 249, 113, 72, 157, 8, 62, 170, 16, 225, 18, 200, 95, 10,
-    236, 177, 231, 242, 173, 251, 160, 16, 15, 235, 196, 126, 154, 94, 102, 203, 63, 34, 213, 227, 204, 71, 206, 67,
-    212, 108, 106, 165, 86, 240, 184, 222, 90, 1, 183, 92, 187, 95, 34, 242, 112, 120, 235, 205, 149, 253, 51, 247, 250,
-    251, 181, 104, 85, 244, 4, 126, 184, 59, 199, 74, 164, 152, 81, 11, 19, 144, 57, 58, 94, 213, 189, 30, 192, 183, 35,
-    23, 223, 45, 1, 228, 11, 254, 226, 192, 19, 184, 179, 96, 151, 62, 189, 63, 208, 128, 251, 119, 214, 229, 71, 12,
-    120, 25, 154, 182, 201, 224, 187, 204, 55, 169, 54, 164, 63, 131, 63, 250, 29, 171, 231, 169, 230, 140, 99, 161, 78,
-    31, 66, 75, 179, 75, 151, 77, 220, 50, 21, 23, 9, 216, 123, 54, 159, 123, 128, 47, 85, 191, 210, 180, 7, 223, 167,
-    248, 202, 208, 208, 246, 167, 228, 126, 155, 86, 21, 128, 73, 204, 224, 146, 119, 136, 100, 45, 159, 16, 133, 155,
-    70, 190, 92, 247, 241, 177, 119, 163, 33, 255, 69, 69, 24, 96, 149, 245, 61, 135, 117, 45, 108, 3, 74, 88, 103, 195,
-    129, 0, 39, 179, 134, 85, 74, 138, 78, 86, 129, 116, 96, 217, 187, 226, 84, 178, 165, 140, 3, 231, 179, 33, 71, 117,
-    154, 217, 80, 246, 154, 145, 40, 69, 51, 40, 163, 154, 254, 126, 211, 81, 108, 176, 215, 44, 223, 151, 203, 103, 7,
-    30, 151, 107, 229, 163, 208, 28, 200, 223, 216, 251, 61, 3, 69, 3, 27, 40, 159, 233, 160, 100, 227, 179, 188, 222,
-    72, 221, 27, 183, 233, 59, 76, 124, 202, 240, 102, 146, 94, 142, 167, 245, 173, 241, 39, 124, 198, 183, 181, 235,
-    142, 220, 0, 114, 233, 205, 167, 0, 236, 107, 162, 0, 198, 159, 92, 1, 92, 62, 16, 155, 218, 137, 154, 136, 139,
-    107, 125, 77, 5, 99, 119, 127, 166, 52, 147, 78, 116, 144, 190, 29, 212, 68, 135, 176, 226, 15, 90, 66, 144, 65,
-    233, 150, 171, 4, 50, 192, 115, 12, 179, 141, 228, 159, 195, 246, 5, 141, 240, 176, 60, 253, 116, 4, 52, 165, 54,
-    78, 49, 191, 105, 179, 6, 109, 28, 113, 19, 15, 77, 12, 14, 146, 56, 21, 167, 117, 136, 138, 255, 193, 132, 251, 8,
-    116, 92, 8, 132, 224, 34, 96, 91, 138, 56, 9, 37, 52, 122, 205, 204, 134, 202, 61, 79, 107, 125, 27, 142, 96, 73,
-    109, 16, 145, 235, 214, 210, 51, 197, 255, 137, 242, 112, 82, 66, 193, 198, 92, 158, 220, 11, 245, 71, 2, 180, 39,
-    168, 13, 184, 134, 151, 39, 203, 0, 23, 206, 209, 162, 15, 66, 197, 142, 16, 163, 1, 18, 45, 234, 232, 10, 137, 113,
-    95, 194, 116, 146, 189, 40, 221, 1, 198, 128, 212, 221, 224, 16, 204, 244, 80, 90, 0, 209, 239, 103, 91, 210, 77,
-    148, 167, 93, 192, 185, 71, 248, 29, 184, 115, 186, 196, 184, 98, 37, 101, 45, 81, 182, 186, 106, 202, 98, 211, 84,
-    185, 200, 59, 22, 30, 153, 64, 221, 179, 40, 42, 248, 159, 146, 186, 57, 246, 190, 154, 48, 241, 149, 83, 39, 13,
-    92, 128, 46, 80, 72, 174, 9, 154, 18, 180, 11, 252, 224, 253, 86, 118, 110, 4, 174, 156, 213, 2, 100, 72, 27, 182,
-    183, 166, 226, 199, 34, 52, 95, 248, 240, 255, 163, 90, 197, 94, 163, 86, 138, 168, 8, 88, 53, 239, 140, 211, 137,
-    12, 141, 71, 36, 66, 211, 55, 108, 86, 165, 94, 52, 100, 100, 53, 14, 194, 117, 76, 109, 225, 30, 222, 251, 61, 103,
-    87, 57, 250, 170, 205, 103, 6, 188, 229, 116, 207, 206, 0, 29, 207, 1, 222, 15, 34, 249, 234, 19, 58, 218, 47, 157,
-    83, 246, 141, 100, 7, 67, 0, 220, 234, 12, 149, 96, 120, 84, 50, 243, 71, 63, 136, 240, 197, 41, 196, 217, 120, 70,
-    232, 107, 154, 220, 51, 75, 85, 152, 48, 81, 133, 129, 113, 205, 242, 160, 150, 163, 124, 21, 104, 147, 121, 192,
-    179, 243, 32, 121, 121, 74, 155, 113, 75, 14, 86, 90, 109, 240, 129, 160, 211, 248, 77, 238, 211, 70, 204, 87, 248,
-    2, 240, 227, 226, 156, 147, 236, 226, 151, 214, 167, 126, 133, 24, 53, 148, 26, 124, 189, 20, 109, 246, 253, 41,
-    196, 60, 75, 205, 45, 104, 6, 8, 11, 148, 65, 158, 151, 222, 250, 95, 201, 13, 227, 67, 66, 252, 16, 160, 60, 44,
-    83, 7, 187, 163, 5, 113, 4, 218, 111, 244, 222, 107, 162, 78, 211, 88, 20, 59, 248, 223, 142, 247, 192, 61, 140, 57,
-    136, 167, 223, 15, 248, 34, 109, 231, 171, 167, 155, 227, 48, 18, 175, 25, 192, 252, 82, 243, 233, 16, 85, 119, 239,
-    253, 199, 189, 178, 20, 187, 238, 248, 133, 57, 75, 66, 55, 220, 14, 213, 46, 211, 241, 185, 65, 13, 100, 146, 133,
-    60, 83, 212, 239, 143, 12, 62, 177, 127, 123, 153, 33, 195, 248, 19, 182, 252, 61, 53, 176, 10, 126, 41, 144, 249,
-    225, 7, 233, 147, 120, 71, 55, 117, 166, 22, 129, 99, 201, 106, 84, 13, 33, 25, 71, 31, 84, 0, 183, 236, 185, 51,
-    20, 127, 142, 235, 0, 47, 33, 249, 169, 142, 38, 161, 160, 110, 30, 140, 31, 108, 46, 132, 29, 32, 175, 67, 204,
-    249, 214, 85, 194, 241, 207, 99, 223, 95, 163, 246, 227, 141, 60, 198, 236, 252, 188, 91, 147, 166, 181, 179, 145,
-    215, 194, 177, 142, 133, 233, 33, 195, 177, 225, 214, 217, 13, 226, 77, 37, 159, 237, 131, 193, 219, 66, 232, 40,
-    232, 98, 67, 25, 48, 19, 232, 248, 229, 204, 175, 48, 72, 103, 80, 41, 16, 183, 232, 230, 99, 46, 69, 201, 62, 57,
-    214, 127, 216, 17, 151, 210, 150, 187, 144, 92, 158, 225, 38, 200, 107, 111, 14, 37, 238, 234, 179, 37, 146, 64, 55,
-    100, 8, 134, 122, 199, 190, 117, 218, 135, 46, 248, 167, 53, 250, 51, 54, 79, 113, 62, 93, 139, 50, 38, 96, 109, 45,
-    16, 237, 239, 165, 252, 91, 226, 9, 57, 51, 175, 42, 4, 91, 214, 242, 94, 7, 106, 158, 255, 233, 205, 135, 79, 107,
-    202, 121, 217, 94, 5, 251, 233, 136, 151, 34, 204, 34, 21, 64, 109, 75, 121, 84, 126, 239, 89, 61, 48, 38, 71, 240,
-    114, 26, 69, 31, 175, 212, 167, 95, 41, 110, 50, 49, 60, 59, 126, 138, 148, 220, 69, 251, 117, 187, 2, 137, 252, 14,
-    48, 108, 173, 87, 140, 197, 119, 129, 41, 218, 16, 36, 110, 232, 204, 58, 196, 189, 117, 25, 37, 103, 164, 132, 252,
-    133, 165, 11, 52, 197, 139, 200, 64, 55, 191, 74, 26, 64, 202, 235, 167, 59, 55, 11, 40, 81, 232, 231, 116, 81, 236,
-    113, 177, 82, 248, 242, 225, 222, 97, 160, 106, 37, 168, 48, 20, 128, 114, 25, 132, 36, 9, 21, 64, 166, 14, 231,
-    205, 191, 237, 248, 5, 50, 158, 67, 51, 42, 15, 48, 116, 128, 36, 145, 12, 146, 224, 124, 238, 109, 43, 86, 219, 21,
-    138, 202, 238, 76, 230, 54, 15, 26, 45, 70, 75, 124, 240, 37, 225, 91, 3, 160, 197, 54, 250, 38, 203, 85, 35, 116,
-    75, 98, 41, 6, 25, 66, 245, 109, 146, 238, 5, 170, 111, 191, 172, 188, 85, 134, 88, 14, 16, 4, 152, 30, 208, 91, 94,
-    101, 63, 231, 186, 120, 166, 126, 70, 238, 110, 12, 138, 54, 86, 27, 49, 73, 162, 62, 177, 179, 199, 137, 156, 130,
-    116, 160, 206, 195, 242, 49, 183, 77, 239, 86, 227, 183, 11, 38, 253, 175, 143, 230, 240, 72, 36, 157, 20, 0, 152,
-    57, 76, 135, 141, 220, 177, 59, 141, 123, 28, 130, 196, 169, 23, 207, 200, 118, 26, 246, 11, 223, 237, 9, 174, 182,
-    30, 79, 165, 38, 237, 44, 144, 96, 155, 80, 253, 245, 107, 201, 71, 206, 170, 112, 49, 171, 62, 248, 169, 109, 21,
-    61, 85, 106, 201, 112, 87, 3, 219, 215, 46, 88, 216, 187, 22, 169, 162, 114, 100, 167, 39, 202, 38, 92, 36, 232, 24,
-    17, 90, 122, 61, 229, 132, 69, 176, 178, 50, 130, 60, 31, 209, 231, 46, 52, 169, 173, 110, 61, 86, 154, 246, 204,
-    41, 154, 98, 131, 13, 248, 92, 149, 193, 8, 142, 86, 218, 221, 80, 21, 33, 29, 28, 122, 95, 185, 3, 149, 204, 62,
-    11, 20, 212, 239, 218, 56, 42, 84, 143, 79, 102, 25, 184, 6, 49, 81, 249, 177, 179, 249, 45, 91, 17, 2, 109, 42, 70,
-    113, 4, 139, 127, 115, 70, 11, 164, 109, 150, 34, 25, 132, 135, 164, 191, 4, 137, 182, 246, 46, 236, 173, 247, 153,
-    184, 202, 173, 71, 93, 98, 2, 158, 171, 100, 165, 206, 125, 46, 133, 247, 96, 127, 191, 108, 245, 73, 24, 231, 180,
-    0, 51, 254, 177, 29, 115, 233, 250, 97, 65, 225, 244, 158, 228, 162, 50, 126, 95, 124, 59, 249, 83, 215, 186, 136,
-    253, 95, 123, 179, 9, 237, 200, 8, 126, 105, 41, 131, 159, 35, 122, 240, 220, 183, 8, 146, 34, 154, 184, 77, 210,
-    123, 150, 241, 110, 181, 152, 126, 193, 86, 68, 234, 43, 3, 104, 234, 114, 85, 31, 130, 183, 23, 77, 167, 152, 105,
-    89, 119, 213, 88, 82, 135, 241, 187, 11, 223, 35, 31, 73, 218, 202, 229, 248, 94, 11, 156, 65, 27, 236, 213, 50,
-    129, 61, 246, 14, 0, 242, 154, 98, 214, 107, 71, 177, 76, 198, 24, 34, 166, 117, 254, 237, 11, 189, 201, 84, 30, 97,
-    54, 157, 153, 12, 147, 118, 127, 216, 211, 147, 111, 124, 135, 73, 162, 197, 11, 135, 78, 140, 123, 203, 87, 246,
-    251, 141, 3, 134, 172, 19, 117, 244, 70, 213, 179, 50, 105, 92, 179, 104, 112, 167, 99, 78, 216, 74, 33, 40, 113,
-    225, 126, 68, 199, 66, 8, 143, 228, 200, 0, 104, 219, 8, 5, 122, 136, 223, 163, 162, 135, 81, 101, 125, 96, 17, 102,
-    219, 74, 138, 0, 206, 150, 78, 112, 73, 137, 219, 110, 63, 114, 243, 212, 32, 140, 168, 239, 152, 37, 84, 106, 72,
-    220, 180, 133, 121, 148, 243, 71, 143, 14, 56, 180, 71, 57, 139, 101, 55, 226, 216, 141, 62, 148, 249, 165, 78, 31,
-    195, 123, 198, 79, 74, 130, 182, 31, 34, 40, 239, 255, 63, 75, 76, 249, 231, 57, 138, 156, 7, 101, 1, 132, 46, 243,
-    14, 19, 113, 80, 4, 82, 178, 13, 218, 117, 112, 84, 76, 137, 166, 110, 39, 229, 107, 222, 59, 102, 179, 27, 197,
-    208, 89, 201, 65, 138, 127, 185, 41, 255, 148, 248, 227, 56, 85, 67, 86, 160, 204, 199, 111, 59, 238, 79, 116, 32,
-    123, 240, 247, 127, 124, 73, 100, 15, 10, 147, 47, 181, 211, 134, 186, 194, 153, 231, 22, 210, 223, 116, 13, 50,
-    234, 253, 110, 32, 1, 136, 2, 87, 139, 20, 14, 24, 59, 76, 2, 90, 121, 105, 111, 7, 241, 169, 52, 92, 96, 146, 219,
-    16, 62, 223, 141, 141, 147, 56, 69, 59, 142, 215, 80, 172, 48, 96, 169, 28, 205, 247, 81, 30, 62, 88, 70, 5, 24,
-    183, 118, 14, 112, 125, 239, 175, 224, 248, 194, 49, 162, 159, 158, 112, 240, 112, 250, 216, 16, 149, 244, 200, 203,
-    229, 156, 134, 101, 202, 191, 235, 203, 2, 142, 60, 4, 171, 236, 238, 165, 157, 79, 189, 92, 217, 100, 86, 161, 22,
-    249, 52, 252, 94, 65, 153, 101, 194, 35, 26, 245, 201, 114, 9, 163, 117, 70, 235, 230, 165, 129, 239, 198, 7, 56, 7,
-    101, 248, 36, 180, 116, 117, 121, 216, 65, 61, 3, 90, 194, 168, 130, 1, 17, 72, 183, 255, 124, 0, 75, 237, 190, 207,
-    130, 243, 105, 225, 10, 26, 160, 137, 40, 203, 194, 244, 167, 80, 207, 132, 130, 157, 147, 32, 136, 86, 172, 94,
-    117, 73, 90, 241, 10, 70, 84, 88, 235, 49, 49, 238, 71, 122, 3, 25, 170, 120, 253, 7, 104, 183, 254, 219, 125, 204,
-    250, 197, 181, 147, 48, 208, 192, 167, 144, 51, 199, 54, 101, 114, 56, 168, 163, 245, 132, 248, 152, 120, 96, 129,
-    1, 31, 232, 61, 101, 104, 236, 160, 26, 156, 32, 72, 206, 252, 66, 186, 47, 18, 160, 52, 248, 212, 189, 11, 26, 200,
-    142, 131, 248, 80, 163, 62, 254, 236, 140, 52, 238, 242, 109, 25, 37, 192, 43, 94, 133, 64, 42, 48, 50, 101, 26, 25,
-    111, 173, 222, 92, 137, 88, 58, 99, 177, 165, 69, 69, 54, 170, 213, 241, 162, 2, 208, 192, 134, 155, 251, 103, 6,
-    245, 255, 132, 22, 121, 126, 10, 3, 6, 187, 70, 135, 6, 90, 139, 12, 142, 167, 53, 54, 84, 51, 130, 92, 184, 149,
-    167, 150, 134, 195, 138, 26, 221, 87, 37, 200, 151, 7, 41, 60, 132, 254, 218, 193, 235, 156, 66, 252, 37, 167, 188,
-    183, 2, 109, 155, 151, 67, 226, 23, 217, 1, 205, 30, 141, 61, 112, 221, 41, 218, 104, 179, 134, 120, 114, 223, 15,
-    8, 5, 179, 30, 162, 230, 50, 126, 0, 165, 217, 213, 39, 84, 138, 143, 34, 78, 67, 177, 72, 64, 30, 57, 1, 133, 213,
-    78, 141, 163, 55, 219, 79, 67, 169, 251, 38, 29, 198, 67, 26, 194, 109, 38, 220, 202, 71, 169, 11, 208, 112, 66, 76,
-    53, 170, 42, 238, 94, 126, 56, 51, 91, 83, 134, 11, 71, 222, 207, 180, 206, 222, 160, 118, 163, 46, 8, 30, 103, 102,
-    197, 169, 105, 64, 155, 144, 87, 201, 14, 56, 97, 93, 202, 85, 152, 59, 145, 158, 0, 130, 93, 174, 199, 30, 3, 127,
-    86, 201, 17, 225, 34, 96, 165, 233, 63, 192, 240, 153, 84, 110, 24, 40, 237, 213, 121, 235, 110, 180, 189, 158, 249,
-    197, 165, 151, 132, 131, 191, 201, 38, 27, 10, 92, 44, 229, 175, 242, 92, 84, 98, 153, 71, 133, 151, 245, 166, 3,
-    162, 208, 175, 224, 134, 171, 11, 176, 41, 161, 38, 69, 229, 162, 225, 18, 156, 122, 42, 180, 195, 119, 209, 120,
-    40, 30, 200, 144, 230, 82, 36, 181, 86, 135, 5, 176, 184, 246, 237, 35, 190, 108, 151, 251, 221, 95, 71, 206, 51,
-    156, 139, 241, 127, 243, 128, 216, 160, 251, 208, 169, 76, 86, 1, 227, 129, 190, 28, 147, 188, 54, 145, 10, 173,
-    106, 185, 142, 34, 77, 170, 20, 202, 100, 151, 161, 227, 44, 14, 255, 183, 47, 69, 130, 88, 108, 129, 108, 195, 111,
-    197, 98, 59, 226, 105, 201, 199, 88, 206, 172, 41, 253, 181, 181, 248, 57, 196, 143, 50, 14, 36, 41, 231, 78, 9,
-    221, 226, 13, 185, 33, 188, 29, 172, 27, 26, 105, 245, 212, 187, 29, 212, 136, 211, 194, 28, 5, 107, 130, 149, 101,
-    137, 91, 110, 55, 41, 180, 17, 106, 220, 206, 108, 192, 175, 201, 23, 236, 245, 238, 50, 43, 186, 120, 149, 247,
-    122, 90, 236, 182, 199, 65, 121, 159, 75, 171, 1, 233, 243, 129, 224, 162, 99, 32, 219, 193, 114, 32, 81, 134, 219,
-    165, 161, 131, 73, 246, 88, 163, 32, 6, 145, 23, 108, 138, 249, 160, 182, 44, 230, 122, 6, 145, 76, 222, 55, 177,
-    24, 65, 163, 23, 119, 231, 37, 117, 159, 114, 206, 101, 18, 245, 172, 35, 76, 116, 7, 145, 3, 162, 211, 220, 243,
-    170, 23, 222, 130, 187, 47, 191, 166, 254, 144, 61, 201, 183, 208, 46, 80, 93, 1, 94, 130, 62, 130, 224, 237, 140,
-    20, 78, 44, 126, 41, 234, 104, 209, 253, 7, 249, 202, 87, 191, 183, 33, 72, 251, 34, 182, 207, 73, 238, 123, 59, 52,
-    99, 136, 97, 167, 122, 119, 138, 95, 134, 45, 51, 209, 103, 131, 128, 87, 85, 140, 185, 154, 204, 5, 68, 91, 6, 30,
-    243, 69, 67, 147, 187, 103, 204, 65, 142, 200, 38, 45, 56, 94, 176, 67, 154, 153, 86, 219, 79, 54, 154, 29, 249,
-    253, 154, 220, 242, 11, 85, 162, 35, 208, 157, 196, 220, 188, 142, 16, 43, 139, 255, 126, 105, 151, 115, 148, 9,
-    110, 13, 130, 61, 40, 174, 186, 65, 222, 172, 196, 129, 144, 251, 166, 150, 191, 214, 231, 131, 2, 185, 173, 149,
-    162, 217, 235, 13, 101, 53, 146, 63, 24, 59, 184, 74, 38, 224, 73, 10, 182, 102, 200, 88, 242, 184, 36, 25, 235,
-    224, 51, 121, 221, 27, 43, 92, 237, 52, 26, 223, 115, 208, 4, 226, 187, 58, 250, 103, 201, 200, 38, 60, 208, 187,
-    240, 115, 112, 163, 80, 239, 113, 168, 217, 20, 201, 42, 14, 51, 99, 70, 185, 34, 127, 93, 146, 162, 190, 24, 234,
-    55, 24, 110, 118, 28, 96, 182, 3, 9, 50, 30, 53, 250, 124, 68, 143, 145, 167, 220, 62, 150, 96, 207, 244, 25, 18,
-    145, 199, 238, 237, 20, 114, 50, 100, 233, 2, 61, 69, 214, 163, 87, 160, 11, 209, 174, 6, 170, 26, 52, 8, 122, 209,
-    159, 63, 149, 85, 114, 235, 233, 56, 128, 105, 34, 101, 164, 171, 142, 70, 160, 255, 16, 201, 30, 254, 10, 187, 150,
-    31, 131, 90, 68, 107, 191, 76, 100, 204, 217, 106, 125, 35, 150, 168, 53, 240, 156, 148, 56, 252, 202, 0, 240, 48,
-    5, 75, 59, 69, 253, 254, 9, 142, 194, 196, 227, 77, 19, 79, 165, 29, 234, 153, 65, 103, 116, 64, 127, 21, 217, 70,
-    173, 203, 12, 95, 76, 121, 124, 55, 142, 142, 97, 2, 78, 234, 82, 66, 120, 154, 169, 120, 200, 128, 141, 162, 3,
-    214, 225, 132, 240, 131, 39, 119, 119, 25, 137, 38, 226, 154, 123, 112, 10, 22, 100, 236, 75, 154, 110, 82, 32, 213,
-    25, 64, 95, 123, 55, 212, 133, 97, 255, 36, 31, 90, 91, 201, 241, 240, 148, 95, 98, 197, 76, 98, 143, 134, 75, 80,
-    7, 131, 3, 79, 37, 5, 169, 52, 67, 137, 239, 219, 191, 146, 137, 242, 103, 106, 43, 0, 140, 158, 29, 224, 159, 0,
-    155, 227, 120, 118, 157, 187, 143, 65, 249, 175, 31, 42, 178, 149, 225, 18, 208, 68, 225, 148, 106, 107, 211, 61,
-    173, 201, 73, 125, 186, 5, 234, 49, 5, 150, 219, 48, 160, 4, 253, 48, 59, 62, 205, 164, 212, 33, 254, 239, 212, 120,
-    172, 93, 60, 238, 182, 96, 129, 59, 81, 100, 154, 156, 221, 240, 2, 248, 74, 94, 229, 198, 198, 85, 20, 253, 213,
-    247, 230, 201, 19, 68, 72, 40, 163, 189, 135, 199, 250, 174, 224, 15, 146, 82, 142, 1, 166, 106, 245, 97, 189, 222,
-    228, 165, 249, 83, 7, 44, 139, 204, 55, 122, 57, 127, 170, 168, 230, 154, 239, 39, 81, 38, 92, 214, 120, 207, 59,
-    10, 228, 164, 158, 243, 250, 58, 200, 245, 170, 42, 213, 25, 137, 98, 65, 145, 37, 221, 103, 93, 141, 251, 127, 78,
-    147, 209, 236, 135, 30, 4, 236, 108, 136, 181, 205, 244, 36, 130, 246, 86, 108, 107, 55, 243, 72, 212, 210, 80, 211,
-    240, 63, 80, 20, 145, 242, 35, 84, 252, 156, 36, 34, 24, 167, 243, 244, 38, 182, 185, 121, 171, 26, 220, 43, 208, 1,
-    150, 120, 87, 18, 15, 88, 216, 159, 54, 139, 46, 91, 84, 86, 29, 222, 34, 163, 240, 22, 210, 142, 218, 116, 137, 91,
-    106, 60, 201, 168, 23, 173, 162, 142, 40, 96, 30, 37, 126, 253, 138, 220, 136, 151, 195, 177, 6, 18, 155, 175, 91,
-    47, 105, 70, 41, 118, 234, 94, 27, 50, 149, 85, 187, 156, 23, 173, 169, 141, 236, 1, 44, 204, 8, 173, 139, 51, 130,
-    151, 100, 206, 207, 121, 2, 105, 19, 59, 243, 41, 96, 60, 144, 254, 169, 18, 36, 239, 2, 205, 112, 120, 97, 226,
-    216, 236, 38, 183, 55, 0, 238, 119, 115, 24, 228, 180, 175, 227, 82, 94, 148, 116, 151, 63, 77, 222, 218, 30, 224,
-    46, 22, 228, 76, 94, 136, 52, 246, 59, 157, 77, 95, 15, 232, 178, 76, 59, 216, 228, 28, 172, 127, 171, 131, 156, 15,
-    48, 146, 98, 166, 175, 250, 199, 242, 16, 65, 57, 99, 192, 65, 120, 138, 44, 166, 53, 19, 73, 184, 111, 51, 96, 32,
-    159, 180, 128, 121, 1, 166, 90, 253, 177, 33, 213, 132, 164, 99, 117, 69, 130, 212, 123, 233, 242, 136, 156, 16,
-    171, 107, 239, 254, 159, 166, 179, 217, 253, 86, 90, 71, 135, 109, 240, 166, 102, 64, 5, 78, 148, 106, 91, 201, 250,
-    28, 191, 64, 225, 169, 210, 18, 129, 204, 176, 26, 25, 128, 48, 94, 19, 27, 126, 192, 25, 189, 197, 55, 0, 203, 99,
-    10, 237, 69, 2, 105, 184, 228, 162, 134, 129, 111, 232, 108, 124, 171, 204, 171, 232, 61, 139, 166, 124, 172, 196,
-    190, 42, 242, 92, 53, 245, 168, 233, 27, 186, 32, 217, 230, 192, 189, 46, 12, 192, 234, 203, 192, 6, 55, 185, 89,
-    73, 222, 71, 66, 249, 193, 91, 129, 229, 175, 107, 231, 245, 92, 95, 106, 166, 94, 0, 217, 171, 226, 102, 30, 12,
-    48, 58, 214, 8, 58, 178, 33, 4, 232, 132, 221, 14, 224, 216, 91, 206, 30, 87, 130, 154, 186, 12, 11, 128, 22, 247,
-    21, 123, 48, 212, 185, 227, 30, 223, 135, 56, 205, 36, 150, 1, 237, 34, 163, 89, 105, 52, 96, 252, 163, 132, 126,
-    30, 32, 66, 183, 65, 240, 131, 192, 211, 210, 29, 106, 245, 60, 85, 19, 204, 85, 136, 120, 38, 79, 195, 137, 225,
-    31, 11, 149, 221, 223, 53, 183, 66, 226, 75, 102, 32, 3, 42, 9, 14, 201, 78, 194, 107, 135, 111, 6, 231, 29, 137,
-    60, 100, 161, 117, 110, 216, 219, 39, 10, 113, 170, 158, 15, 164, 227, 122, 86, 246, 64, 40, 11, 34, 67, 253, 161,
-    247, 198, 169, 24, 230, 137, 243, 244, 223, 229, 188, 2, 198, 156, 208, 154, 98, 127, 202, 10, 212, 144, 188, 243,
-    154, 238, 186, 89, 4, 62, 90, 112, 92, 52, 109, 133, 123, 18, 231, 81, 31, 220, 55, 107, 37, 183, 124, 10, 253, 131,
-    99, 206, 17, 41, 56, 145, 166, 13, 190, 166, 214, 236, 253, 18, 61, 96, 84, 28, 51, 22, 53, 197, 159, 182, 198, 138,
-    144, 25, 108, 6, 64, 206, 212, 119, 238, 151, 133, 96, 83, 50, 215, 176, 30, 90, 207, 113, 212, 212, 29, 111, 39,
-    120, 201, 109, 29, 56, 101, 142, 7, 55, 126, 4, 72, 62, 12, 52, 175, 187, 158, 41, 209, 245, 19, 120, 133, 132, 96,
-    24, 200, 197, 109, 180, 187, 207, 11, 156, 24, 164, 254, 29, 178, 118, 101, 36, 51, 51, 86, 49, 190, 6, 216, 46,
-    239, 134, 103, 134, 66, 154, 117, 45, 98, 169, 153, 64, 4, 187, 0, 30, 101, 38, 52, 226, 80, 175, 209, 73, 219, 215,
-    230, 179, 235, 135, 1, 107, 74, 149, 132, 87, 148, 117, 231, 222, 15, 56, 143, 73, 61, 136, 188, 191, 195, 11, 171,
-    29, 202, 229, 247, 53, 27, 236, 120, 211, 76, 116, 138, 253, 189, 104, 129, 154, 59, 163, 18, 120, 157, 95, 163, 61,
-    227, 147, 49, 165, 102, 220, 147, 229, 188, 15, 151, 31, 51, 184, 4, 2, 26, 71, 227, 254, 239, 113, 184, 181, 239,
-    90, 98, 99, 116, 248, 79, 162, 140, 41, 13, 197, 204, 243, 5, 83, 37, 67, 239, 123, 149, 40, 66, 166, 164, 22, 244,
-    8, 87, 208, 132, 72, 132, 188, 106, 225, 92, 84, 191, 254, 188, 51, 129, 128, 121, 220, 151, 203, 4, 28, 13, 167,
-    124, 158, 38, 104, 210, 223, 121, 101, 95, 7, 169, 21, 33, 158, 224, 124, 190, 237, 230, 91, 42, 41, 212, 27, 151,
-    216, 239, 213, 54, 157, 44, 186, 206, 141, 68, 144, 162, 88, 213, 3, 21, 144, 186, 49, 122, 74, 138, 236, 208, 84,
-    202, 56, 173, 187, 186, 83, 234, 164, 158, 120, 211, 250, 73, 97, 190, 29, 72, 48, 129, 137, 146, 114, 179, 110,
-    171, 22, 252, 189, 125, 65, 241, 105, 92, 71, 34, 111, 28, 18, 182, 14, 240, 75, 53, 123, 110, 181, 56, 75, 32, 241,
-    214, 140, 184, 215, 80, 38, 35, 191, 203, 149, 38, 137, 165, 15, 30, 70, 209, 58, 107, 131, 98, 24, 72, 60, 88, 115,
-    58, 62, 117, 19, 71, 74, 219, 126, 180, 117, 62, 69, 123, 60, 173, 51, 93, 91, 187, 129, 64, 142, 199, 13, 25, 220,
-    67, 0, 201, 130, 199, 52, 238, 20, 241, 96, 123, 50, 46, 100, 211, 158, 26, 204, 160, 105, 152, 100, 162, 254, 132,
-    26, 239, 23, 73, 178, 240, 222, 137, 215, 209, 70, 211, 244, 85, 121, 72, 26, 115, 172, 86, 154, 26, 157, 208, 159,
-    189, 77, 220, 123, 56, 17, 100, 210, 154, 19, 121, 146, 232, 207, 140, 90, 97, 15, 211, 80, 129, 235, 182, 147, 60,
-    184, 61, 19, 231, 112, 32, 107, 193, 216, 37, 154, 156, 101, 37, 55, 118, 162, 31, 9, 93, 21, 0, 168, 176, 49, 198,
-    142, 153, 120, 194, 10, 248, 157, 156, 246, 213, 12, 18, 56, 0, 76, 126, 147, 102, 145, 214, 4, 232, 236, 231, 2,
-    70, 159, 3, 37, 117, 125, 134, 171, 216, 182, 6, 204, 132, 44, 133, 245, 126, 83, 2, 14, 219, 84, 37, 29, 98, 43,
-    230, 196, 126, 224, 156, 152, 181, 196, 205, 123, 163, 0, 198, 141, 172, 163, 47, 137, 189, 78, 37, 80, 14, 232,
-    210, 85, 134, 4, 2, 47, 189, 4, 197, 23, 2, 15, 246, 16, 255, 30, 253, 222, 208, 227, 24, 137, 115, 54, 108, 245,
-    66, 30, 40, 60, 232, 223, 102, 95, 194, 74, 121, 73, 145, 23, 33, 146, 8, 248, 175, 59, 170, 210, 24, 143, 245, 94,
-    170, 154, 85, 127, 89, 194, 127, 127, 247, 117, 42, 111, 242, 19, 173, 96, 22, 153, 208, 161, 202, 96, 104, 112, 63,
-    118, 42, 14, 121, 45, 78, 192, 2, 44, 125, 153, 245, 43, 67, 184, 124, 110, 54, 115, 198, 101, 186, 197, 53, 73, 61,
-    121, 141, 108, 137, 71, 235, 205, 23, 17, 192, 23, 80, 9, 71, 19, 118, 153, 216, 173, 237, 204, 30, 63, 89, 237,
-    242, 55, 8, 153, 77, 245, 54, 80, 160, 140, 240, 173, 185, 77, 253, 199, 50, 254, 51, 179, 150, 42, 122, 57, 129,
-    220, 172, 128, 120, 77, 222, 13, 31, 189, 103, 134, 30, 152, 49, 72, 124, 233, 239, 80, 126, 138, 191, 48, 134, 66,
-    174, 169, 155, 5, 32, 221, 4, 57, 13, 18, 229, 249, 107, 6, 7, 138, 14, 170, 214, 170, 232, 23, 221, 11, 197, 242,
-    33, 121, 27, 5, 123, 186, 152, 112, 5, 248, 78, 248, 104, 210, 168, 52, 87, 173, 198, 147, 252, 245, 177, 233, 176,
-    73, 180, 10, 2, 124, 41, 92, 242, 14, 7, 229, 14, 121, 61, 213, 15, 130, 33, 57, 33, 92, 154, 213, 27, 91, 184, 225,
-    219, 68, 184, 238, 72, 83, 233, 220, 14, 185, 236, 194, 43, 251, 172, 141, 157, 132, 240, 181, 183, 131, 156, 230,
-    18, 35, 153, 63, 218, 4, 4, 222, 46, 225, 76, 49, 123, 225, 229, 112, 223, 136, 135, 158, 62, 54, 56, 175, 50, 86,
-    239, 131, 11, 180, 6, 69, 133, 202, 125, 3, 215, 99, 99, 234, 82, 94, 59, 100, 169, 132, 25, 167, 20, 68, 112, 21,
-    30, 146, 119, 166, 216, 247, 185, 153, 151, 18, 31, 92, 254, 240, 193, 53, 63, 235, 250, 26, 215, 158, 182, 233,
-    133, 134, 153, 233, 156, 194, 77, 240, 126, 46, 81, 136, 125, 49, 54, 88, 78, 32, 160, 190, 103, 133, 165, 110, 39,
-    249, 132, 97, 23, 229, 59, 182, 142, 251, 32, 221, 111, 25, 184, 161, 212, 187, 245, 11, 105, 57, 63, 7, 111, 118,
-    86, 220, 115, 190, 166, 172, 96, 108, 117, 172, 162, 224, 214, 143, 186, 57, 133, 220, 66, 177, 208, 29, 110, 37,
-    189, 217, 219, 103, 126, 144, 212, 202, 247, 133, 238, 158, 33, 30, 49, 85, 244, 86, 84, 180, 148, 77, 209, 63, 26,
-    28, 243, 66, 32, 133, 208, 174, 81, 77, 162, 223, 190, 191, 144, 222, 216, 81, 249, 201, 126, 246, 82, 185, 203, 0,
-    83, 84, 241, 135, 221, 84, 198, 76, 144, 132, 89, 22, 207, 156, 169, 157, 68, 9, 76, 112, 90, 3, 254, 241, 72, 35,
-    212, 26, 88, 37, 214, 222, 128, 140, 82, 47, 214, 255, 166, 161, 52, 253, 33, 168, 245, 162, 4, 234, 245, 227, 15,
-    85, 103, 149, 167, 180, 248, 87, 154, 191, 128, 58, 139, 234, 193, 97, 240, 47, 176, 10, 198, 214, 109, 210, 21, 26,
-    182, 27, 19, 38, 67, 238, 219, 204, 40, 167, 60, 228, 119, 60, 141, 108, 204, 231, 216, 213, 229, 32, 250, 167, 42,
-    26, 5, 217, 62, 89, 15, 110, 243, 210, 164, 38, 228, 23, 126, 131, 102, 242, 5, 109, 15, 254, 212, 81, 214, 173,
-    230, 140, 97, 220, 235, 112, 112, 112, 225, 1, 193, 182, 205, 177, 242, 128, 218, 38, 136, 140, 92, 37, 46, 242,
-    146, 212, 188, 142, 13, 68, 95, 147, 33, 94, 147, 49, 34, 199, 78, 134, 104, 213, 15, 11, 106, 119, 148, 91, 240,
-    107, 207, 2, 240, 109, 192, 69, 56, 161, 94, 172, 39, 232, 18, 68, 34, 26, 95, 118, 15, 18, 207, 71, 189, 94, 152,
-    23, 7, 30, 161, 176, 211, 122, 55, 188, 210, 211, 219, 199, 127, 139, 186, 154, 54, 84, 64, 124, 65, 1, 153, 93,
-    148, 35, 163, 61, 208, 225, 192, 227, 228, 156, 142, 240, 215, 211, 112, 49, 28, 247, 18, 8, 218, 191, 42, 248, 223,
-    232, 215, 101, 62, 255, 179, 216, 153, 157, 144, 38, 90, 163, 226, 107, 200, 199, 156, 7, 226, 233, 82, 193, 148,
-    186, 167, 119, 55, 69, 59, 107, 141, 221, 26, 78, 27, 108, 70, 101, 4, 12, 175, 230, 174, 239, 147, 242, 82, 164,
-    15, 4, 157, 77, 45, 134, 78, 69, 27, 179, 139, 186, 102, 169, 237, 97, 110, 255, 169, 168, 56, 36, 183, 4, 108, 202,
-    6, 33, 17, 162, 165, 215, 86, 245, 76, 181, 198, 253, 206, 164, 95, 174, 221, 19, 41, 3, 98, 122, 143, 29, 86, 255,
-    160, 100, 91, 71, 227, 186, 171, 247, 180, 85, 83, 50, 194, 114, 27, 186, 71, 188, 222, 192, 4, 25, 6, 238, 223, 63,
-    154, 109, 55, 241, 96, 253, 145, 160, 205, 193, 238, 14, 158, 175, 132, 124, 123, 79, 198, 16, 97, 227, 206, 27,
-    119, 92, 140, 157, 177, 208, 140, 224, 68, 133, 84, 6, 191, 221, 190, 246, 178, 128, 134, 245, 143, 44, 43, 41, 206,
-    159, 36, 103, 158, 232, 48, 212, 253, 203, 133, 161, 212, 70, 150, 221, 234, 55, 83, 42, 12, 38, 177, 14, 241, 64,
-    107, 0, 145, 129, 82, 85, 39, 253, 224, 182, 82, 142, 250, 131, 93, 142, 135, 65, 153, 40, 192, 36, 180, 254, 127,
-    56, 201, 127, 13, 21, 14, 243, 199, 151, 186, 228, 60, 220, 66, 50, 142, 196, 141, 145, 140, 248, 70, 56, 253, 188,
-    188, 38, 36, 14, 143, 177, 189, 108, 134, 59, 252, 130, 135, 46, 139, 6, 45, 226, 6, 64, 213, 9, 8, 42, 152, 80,
-    153, 193, 133, 138, 199, 41, 125, 18, 35, 224, 134, 41, 180, 78, 2, 102, 193, 18, 47, 31, 163, 186, 130, 163, 74,
-    243, 163, 168, 92, 194, 30, 2, 243, 243, 94, 45, 173, 94, 25, 227, 55, 180, 84, 64, 34, 192, 214, 3, 164, 182, 172,
-    134, 72, 228, 248, 196, 140, 241, 69, 2, 237, 118, 111, 151, 100, 124, 64, 72, 105, 55, 151, 99, 10, 203, 78, 48,
-    43, 34, 89, 227, 46, 9, 70, 101, 88, 167, 164, 88, 15, 250, 123, 199, 203, 86, 27, 186, 106, 0, 52, 73, 126, 170,
-    143, 203, 17, 120, 125, 255, 87, 99, 165, 233, 130, 86, 42, 206, 33, 72, 45, 149, 131, 202, 202, 169, 147, 148, 50,
-    116, 225, 144, 213, 70, 147, 179, 147, 198, 179, 54, 191, 30, 36, 192, 238, 153, 83, 170, 40, 112, 219, 15, 180, 11,
-    72, 247, 68, 130, 202, 130, 120, 18, 162, 38, 202, 232, 134, 172, 156, 187, 1, 124, 222, 102, 177, 33, 210, 35, 6,
-    12, 98, 166, 130, 15, 177, 168, 91, 107, 96, 233, 134, 79, 245, 133, 103, 8, 26, 215, 134, 148, 142, 241, 85, 86,
-    62, 76, 120, 10, 5, 5, 37, 26, 189, 64, 5, 130, 54, 25, 99, 38, 175, 219, 164, 51, 86, 47, 231, 129, 70, 3, 252,
-    192, 215, 99, 81, 163, 113, 29, 188, 13, 213, 251, 185, 206, 194, 247, 80, 137, 31, 98, 71, 186, 242, 138, 72, 113,
-    2, 37, 68, 10, 233, 51, 252, 221, 130, 22, 150, 74, 56, 176, 210, 67, 244, 202, 21, 45, 113, 42, 124, 126, 80, 200,
-    198, 8, 89, 2, 62, 115, 68, 31, 234, 65, 54, 145, 20, 34, 250, 125, 108, 205, 179, 145, 72, 190, 126, 44, 191, 51,
-    254, 140, 161, 5, 13, 39, 82, 181, 177, 23, 57, 74, 94, 219, 93, 139, 30, 220, 91, 228, 92, 41, 243, 216, 134, 4,
-    35, 112, 190, 254, 55, 21, 40, 157, 91, 6, 219, 61, 228, 140, 5, 62, 249, 232, 164, 143, 46, 128, 234, 93, 31, 201,
-    51, 172, 42, 53, 30, 49, 134, 51, 133, 98, 233, 130, 251, 206, 254, 73, 194, 67, 44, 106, 209, 65, 3, 188, 167, 10,
-    189, 82, 111, 94, 129, 11, 226, 17, 131, 90, 237, 117, 21, 45, 40, 82, 65, 231, 153, 61, 142, 232, 31, 58, 94, 41,
-    31, 245, 200, 91, 154, 93, 72, 147, 127, 56, 30, 108, 41, 26, 91, 176, 112, 76, 32, 255, 200, 91, 231, 161, 250,
-    161, 243, 207, 223, 202, 135, 137, 212, 64, 59, 172, 135, 121, 58, 169, 244, 11, 189, 49, 248, 68, 141, 9, 237, 19,
-    59, 51, 126, 207, 112, 234, 27, 168, 155, 180, 117, 70, 217, 244, 178, 188, 67, 255, 227, 76, 209, 161, 53, 218,
-    189, 225, 28, 138, 186, 236, 83, 173, 114, 191, 4, 54, 86, 252, 65, 245, 135, 56, 181, 45, 240, 218, 126, 103, 86,
-    52, 25, 203, 21, 194, 76, 191, 178, 253, 31, 3, 55, 1, 157, 134, 228, 165, 183, 139, 215, 172, 201, 234, 247, 84,
-    137, 178, 253, 210, 1, 64, 110, 8, 78, 25, 248, 245, 15, 244, 143, 120, 32, 99, 85, 89, 213, 82, 19, 105, 248, 115,
-    203, 152, 101, 180, 38, 254, 133, 102, 38, 202, 234, 163, 188, 81, 192, 225, 167, 83, 167, 115, 101, 252, 9, 52,
-    232, 32, 132, 11, 168, 11, 38, 192, 131, 147, 227, 216, 117, 3, 180, 43, 28, 247, 97, 247, 41, 48, 56, 101, 247,
-    242, 243, 246, 18, 49, 189, 8, 120, 122, 84, 183, 86, 31, 100, 51, 48, 118, 191, 127, 66, 187, 240, 221, 32, 191,
-    206, 4, 211, 196, 68, 53, 129, 22, 28, 107, 23, 13, 52, 37, 49, 60, 213, 201, 232, 78, 114, 147, 82, 25, 40, 234,
-    50, 94, 223, 60, 209, 75, 218, 240, 79, 156, 108, 71, 40, 25, 56, 14, 20, 63, 93, 102, 167, 104, 135, 70, 196, 1,
-    24, 171, 231, 106, 146, 186, 55, 72, 205, 25, 218, 9, 113, 86, 186, 149, 65, 88, 81, 119, 234, 1, 62, 219, 48, 127,
-    91, 223, 29, 153, 248, 219, 40, 137, 108, 23, 30, 221, 45, 2, 166, 214, 48, 9, 99, 128, 64, 1, 128, 2, 218, 89, 74,
-    50, 105, 84, 49, 63, 4, 53, 254, 109, 191, 181, 139, 79, 176, 64, 20, 101, 204, 195, 69, 118, 20, 61, 172, 37, 75,
-    53, 39, 24, 199, 146, 85, 12, 45, 36, 153, 96, 148, 111, 202, 56, 69, 157, 179, 162, 81, 238, 71, 110, 128, 13, 248,
-    146, 253, 158, 85, 202, 58, 108, 30, 227, 190, 97, 67, 248, 117, 133, 37, 143, 28, 18, 35, 41, 93, 89, 212, 34, 61,
-    44, 243, 45, 77, 19, 168, 7, 251, 139, 8, 107, 9, 226, 22, 208, 69, 218, 46, 96, 67, 218, 161, 38, 133, 226, 149,
-    168, 171, 252, 116, 81, 113, 194, 184, 206, 253, 132, 20, 224, 74, 164, 73, 50, 185, 79, 144, 29, 48, 24, 78, 162,
-    34, 195, 181, 48, 58, 57, 175, 39, 221, 247, 40, 75, 141, 43, 100, 165, 31, 237, 62, 217, 74, 215, 163, 234, 199,
-    30, 39, 233, 149, 29, 204, 147, 181, 175, 112, 152, 18, 157, 229, 96, 58, 255, 163, 6, 159, 24, 148, 131, 106, 206,
-    171, 28, 159, 246, 48, 249, 140, 80, 199, 81, 112, 238, 122, 68, 3, 138, 107, 163, 39, 148, 96, 248, 195, 163, 228,
-    19, 211, 87, 185, 39, 80, 233, 145, 159, 249, 34, 61, 238, 239, 249, 26, 122, 124, 135, 107, 138, 228, 27, 95, 210,
-    214, 32, 102, 236, 163, 24, 236, 72, 243, 81, 173, 168, 42, 40, 220, 181, 72, 191, 192, 220, 33, 136, 96, 233, 251,
-    77, 72, 148, 81, 76, 118, 231, 165, 180, 181, 59, 114, 44, 109, 96, 161, 250, 43, 93, 121, 16, 127, 167, 216, 173,
-    176, 20, 70, 46, 39, 152, 54, 244, 189, 97, 47, 212, 252, 148, 236, 93, 17, 161, 32, 111, 132, 225, 12, 72, 3, 188,
-    4, 228, 158, 192, 98, 161, 180, 56, 152, 73, 39, 182, 52, 238, 186, 4, 253, 163, 8, 187, 201, 45, 70, 2, 4, 98, 202,
-    237, 254, 2, 28, 89, 96, 226, 144, 217, 159, 98, 92, 169, 71, 87, 170, 247, 132, 246, 104, 152, 142, 108, 191, 221,
-    40, 56, 91, 139, 85, 188, 158, 247, 94, 184, 181, 93, 15, 27, 178, 108, 167, 127, 4, 245, 23, 99, 239, 65, 200, 9,
-    37, 113, 236, 199, 230, 93, 225, 172, 142, 88, 255, 53, 172, 204, 152, 205, 55, 56, 236, 60, 95, 183, 34, 174, 96,
-    150, 253, 219, 226, 61, 219, 9, 241, 68, 200, 78, 54, 129, 166, 174, 57, 36, 12, 156, 129, 67, 245, 9, 40, 161, 157,
-    73, 31, 201, 252, 179, 27, 112, 119, 53, 44, 107, 101, 210, 189, 181, 3, 226, 205, 12, 30, 202, 123, 220, 210, 111,
-    124, 250, 38, 22, 42, 40, 72, 224, 169, 63, 44, 77, 0, 181, 167, 4, 76, 148, 147, 183, 189, 133, 14, 120, 39, 143,
-    55, 3, 14, 220, 156, 253, 26, 151, 107, 144, 17, 149, 214, 46, 222, 118, 153, 235, 27, 144, 18, 25, 136, 185, 107,
-    138, 4, 223, 226, 57, 237, 94, 217, 165, 135, 89, 39, 188, 250, 180, 168, 164, 9, 7, 1, 141, 27, 2, 40, 249, 239,
-    119, 142, 81, 12, 186, 123, 94, 248, 0, 228, 15, 196, 163, 59, 129, 161, 40, 216, 87, 0, 16, 140, 92, 147, 25, 100,
-    85, 54, 176, 251, 144, 109, 149, 97, 184, 84, 16, 35, 76, 223, 107, 197, 246, 51, 186, 176, 246, 46, 145, 63, 114,
-    198, 51, 210, 193, 91, 236, 113, 102, 32, 10, 97, 162, 29, 151, 235, 220, 89, 25, 213, 156, 127, 233, 114, 182, 221,
-    113, 171, 58, 253, 186, 95, 135, 53, 126, 195, 170, 115, 149, 121, 114, 74, 189, 60, 45, 127, 131, 4, 246, 108, 103,
-    133, 190, 125, 168, 147, 187, 13, 42, 117, 89, 131, 207, 167, 117, 237, 212, 18, 150, 116, 93, 215, 151, 94, 42,
-    224, 223, 194, 125, 46, 213, 165, 235, 184, 223, 4, 239, 181, 105, 137, 198, 169, 179, 118, 102, 53, 228, 187, 190,
-    219, 220, 156, 142, 128, 103, 204, 144, 81, 149, 120, 40, 210, 61, 147, 206, 61, 81, 148, 9, 243, 76, 195, 68, 186,
-    53, 108, 56, 174, 22, 239, 4, 54, 211, 226, 175, 163, 255, 179, 202, 110, 162, 124, 253, 110, 49, 170, 26, 30, 54,
-    109, 87, 240, 59, 132, 155, 26, 8, 27, 196, 135, 49, 217, 86, 171, 93, 184, 85, 157, 178, 194, 46, 146, 154, 73, 32,
-    38, 66, 239, 105, 162, 79, 252, 164, 116, 51, 122, 174, 219, 218, 109, 222, 102, 13, 249, 168, 84, 105, 95, 187, 51,
-    51, 167, 175, 18, 149, 71, 178, 23, 53, 149, 254, 246, 176, 178, 152, 84, 233, 41, 194, 207, 169, 152, 204, 157,
-    218, 72, 50, 122, 170, 143, 41, 91, 195, 24, 142, 216, 193, 226, 183, 105, 62, 242, 95, 251, 98, 123, 182, 195, 195,
-    45, 72, 124, 26, 113, 86, 85, 50, 255, 195, 48, 187, 18, 68, 7, 231, 216, 97, 143, 37, 245, 155, 5, 236, 93, 132,
-    129, 182, 243, 101, 61, 218, 151, 212, 89, 23, 142, 245, 116, 58, 7, 81, 210, 177, 11, 42, 193, 115, 225, 136, 37,
-    148, 38, 92, 2, 7, 19, 8, 243, 77, 36, 3, 207, 80, 26, 3, 219, 174, 40, 218, 26, 73, 52, 244, 38, 98, 30, 214, 253,
-    80, 254, 208, 140, 1, 88, 1, 85, 41, 179, 244, 56, 235, 252, 231, 196, 184, 77, 21, 182, 92, 115, 27, 190, 24, 239,
-    196, 95, 163, 175, 15, 181, 11, 63, 218, 69, 69, 213, 38, 8, 132, 63, 90, 133, 90, 46, 122, 182, 107, 93, 117, 127,
-    155, 157, 133, 23, 89, 169, 133, 126, 229, 12, 187, 253, 20, 97, 150, 192, 228, 73, 76, 160, 249, 25, 101, 147, 91,
-    243, 124, 55, 172, 238, 40, 146, 235, 186, 111, 73, 186, 128, 60, 48, 185, 175, 148, 85, 16, 97, 24, 146, 131, 156,
-    218, 108, 11, 44, 213, 1, 197, 238, 204, 66, 169, 254, 74, 70, 151, 110, 153, 158, 175, 73, 108, 180, 63, 17, 61,
-    182, 213, 95, 112, 67, 33, 4, 123, 82, 45, 122, 196, 224, 168, 144, 1, 63, 197, 105, 69, 101, 200, 56, 162, 10, 111,
-    96, 105, 184, 189, 156, 189, 17, 128, 163, 218, 176, 169, 3, 106, 118, 152, 51, 17, 144, 222, 5, 233, 57, 6, 250, 1,
-    105, 195, 202, 158, 41, 79, 170, 111, 89, 108, 91, 37, 195, 169, 80, 149, 93, 113, 69, 51, 223, 234, 11, 226, 113,
-    41, 143, 177, 31, 32, 158, 60, 139, 242, 207, 130, 19, 58, 245, 43, 237, 237, 129, 71, 201, 179, 119, 123, 56, 208,
-    182, 156, 133, 130, 163, 140, 10, 71, 149, 149, 68, 165, 11, 255, 136, 68, 130, 224, 11, 87, 25, 30, 51, 37, 51,
-    119, 169, 2, 252, 117, 117, 12, 239, 186, 172, 161, 194, 166, 46, 193, 118, 111, 243, 78, 26, 22, 207, 193, 89, 156,
-    132, 186, 25, 32, 220, 164, 179, 56, 197, 125, 46, 196, 155, 92, 19, 229, 95, 51, 191, 51, 20, 195, 0, 63, 247, 170,
-    95, 141, 105, 220, 94, 24, 193, 251, 119, 119, 252, 24, 153, 88, 48, 169, 185, 253, 237, 28, 95, 138, 174, 154, 225,
-    84, 156, 187, 128, 130, 47, 191, 230, 247, 140, 97, 214, 63, 161, 30, 68, 10, 126, 196, 20, 154, 42, 185, 78, 251,
-    150, 158, 32, 36, 103, 31, 147, 162, 138, 143, 55, 40, 141, 64, 252, 50, 29, 55, 61, 54, 62, 120, 229, 115, 175, 40,
-    52, 14, 130, 109, 66, 132, 183, 222, 118, 253, 193, 177, 82, 50, 238, 41, 35, 91, 190, 22, 125, 188, 164, 221, 153,
-    26, 20, 137, 197, 171, 136, 178, 91, 98, 86, 59, 56, 37, 17, 67, 248, 44, 57, 116, 206, 195, 189, 90, 78, 72, 17,
-    20, 238, 202, 187, 147, 10, 206, 42, 45, 65, 143, 159, 217, 182, 8, 128, 218, 55, 240, 88, 86, 211, 6, 236, 131,
-    129, 194, 60, 218, 77, 53, 140, 152, 151, 170, 116, 105, 106, 41, 63, 87, 143, 80, 102, 123, 219, 43, 228, 163, 121,
-    204, 25, 58, 2, 58, 227, 147, 97, 173, 187, 127, 46, 37, 63, 161, 146, 151, 41, 85, 21, 228, 103, 8, 85, 125, 17,
-    111, 121, 84, 183, 148, 145, 233, 97, 138, 57, 65, 148, 236, 76, 142, 128, 23, 90, 32, 12, 32, 58, 147, 49, 227,
-    170, 119, 55, 191, 31, 38, 139, 241, 115, 237, 39, 107, 127, 138, 230, 93, 16, 229, 67, 64, 91, 77, 175, 203, 224,
-    240, 222, 221, 149, 129, 138, 125, 80, 157, 98, 92, 140, 184, 236, 165, 116, 168, 236, 152, 64, 123, 85, 248, 143,
-    217, 198, 15, 126, 6, 160, 50, 88, 70, 59, 150, 37, 79, 220, 180, 246, 49, 174, 232, 32, 52, 209, 59, 89, 95, 224,
-    49, 116, 177, 216, 41, 26, 135, 0, 75, 212, 200, 158, 3, 50, 38, 153, 227, 221, 50, 46, 8, 228, 166, 7, 208, 224,
-    42, 218, 125, 82, 195, 194, 174, 35, 203, 236, 43, 165, 43, 203, 179, 49, 82, 184, 10, 55, 152, 192, 77, 137, 93,
-    36, 104, 92, 164, 229, 48, 59, 95, 40, 26, 182, 200, 27, 218, 44, 204, 45, 3, 182, 238, 169, 106, 23, 38, 248, 244,
-    240, 51, 156, 100, 59, 97, 215, 40, 97, 238, 48, 34, 121, 195, 240, 1, 163, 104, 128, 236, 208, 141, 204, 75, 54,
-    206, 250, 41, 17, 216, 227, 228, 53, 54, 225, 255, 237, 53, 188, 101, 110, 191, 197, 81, 109, 186, 220, 181, 196,
-    43, 190, 70, 23, 59, 225, 127, 201, 226, 135, 124, 247, 134, 211, 74, 244, 233, 88, 73, 27, 188, 255, 96, 137, 58,
-    225, 157, 122, 125, 197, 64, 200, 31, 19, 170, 35, 84, 203, 23, 199, 228, 46, 118, 193, 248, 14, 226, 15, 143, 196,
-    83, 239, 81, 62, 22, 9, 58, 227, 229, 47, 94, 14, 89, 42, 208, 240, 223, 107, 222, 255, 40, 26, 113, 255, 178, 82,
-    101, 133, 65, 200, 131, 117, 36, 190, 30, 67, 63, 175, 73, 112, 60, 217, 244, 122, 112, 201, 10, 8, 83, 19, 7, 199,
-    127, 147, 173, 195, 252, 123, 193, 201, 40, 53, 243, 173, 247, 96, 11, 249, 164, 99, 60, 75, 101, 110, 142, 29, 9,
-    213, 57, 188, 114, 159, 19, 230, 36, 50, 72, 204, 236, 109, 103, 95, 43, 128, 158, 239, 91, 34, 231, 83, 63, 198,
-    153, 25, 79, 186, 159, 169, 86, 199, 135, 244, 172, 112, 158, 105, 209, 170, 108, 113, 73, 78, 116, 112, 103, 51,
-    119, 137, 148, 230, 200, 174, 38, 25, 122, 100, 88, 126, 100, 51, 154, 84, 201, 55, 179, 53, 12, 17, 161, 142, 15,
-    162, 74, 231, 204, 235, 86, 229, 106, 117, 104, 110, 138, 167, 223, 28, 169, 104, 46, 51, 223, 26, 89, 70, 117, 32,
-    203, 42, 225, 205, 213, 52, 178, 127, 153, 174, 86, 227, 97, 13, 22, 14, 98, 100, 245, 204, 244, 246, 229, 51, 42,
-    160, 77, 15, 235, 16, 182, 22, 8, 94, 188, 166, 84, 165, 74, 62, 72, 7, 239, 229, 118, 150, 160, 118, 34, 123, 177,
-    60, 148, 129, 101, 190, 237, 97, 27, 144, 120, 108, 101, 38, 38, 18, 184, 175, 42, 129, 97, 188, 144, 115, 129, 56,
-    199, 92, 29, 119, 217, 130, 1, 10, 104, 79, 150, 52, 204, 168, 190, 16, 253, 172, 161, 208, 245, 25, 70, 43, 185,
-    198, 191, 133, 250, 28, 159, 24, 145, 187, 187, 51, 95, 61, 145, 47, 247, 222, 68, 190, 213, 193, 194, 98, 162, 170,
-    121, 118, 56, 134, 144, 95, 57, 61, 80, 198, 15, 77, 142, 118, 76, 8, 188, 239, 142, 242, 232, 142, 88, 189, 139,
-    110, 226, 69, 249, 86, 119, 210, 139, 54, 82, 193, 103, 31, 191, 225, 195, 174, 10, 102, 98, 121, 235, 213, 91, 176,
-    82, 219, 32, 35, 167, 156, 250, 16, 130, 86, 233, 220, 128, 151, 27, 5, 78, 97, 34, 70, 124, 94, 239, 218, 215, 169,
-    97, 110, 103, 78, 225, 185, 117, 41, 106, 103, 63, 207, 164, 175, 83, 10, 177, 37, 87, 168, 187, 121, 17, 222, 129,
-    149, 152, 180, 44, 223, 246, 124, 174, 111, 223, 35, 211, 198, 207, 66, 109, 202, 56, 80, 240, 158, 230, 138, 202,
-    6, 13, 230, 156, 121, 78, 185, 15, 183, 122, 141, 228, 253, 230, 83, 39, 200, 233, 114, 148, 102, 103, 226, 190,
-    253, 179, 158, 220, 97, 48, 227, 124, 81, 208, 34, 224, 64, 159, 80, 138, 37, 13, 148, 190, 234, 143, 76, 129, 89,
-    126, 190, 91, 115, 150, 151, 34, 147, 54, 27, 118, 169, 8, 82, 81, 187, 1, 68, 177, 205, 90, 14, 222, 95, 211, 115,
-    32, 199, 103, 219, 236, 69, 158, 247, 2, 32, 145, 255, 18, 90, 103, 10, 54, 108, 114, 42, 175, 213, 5, 142, 216, 3,
-    51, 26, 156, 85, 138, 116, 120, 1, 193, 152, 145, 10, 104, 181, 246, 11, 97, 142, 57, 108, 28, 115, 4, 82, 30, 113,
-    51, 48, 252, 111, 186, 90, 174, 61, 76, 240, 164, 118, 123, 5, 60, 65, 64, 49, 242, 53, 64, 150, 104, 102, 63, 229,
-    162, 222, 249, 98, 89, 20, 47, 156, 251, 243, 17, 17, 130, 35, 1, 217, 55, 146, 21, 195, 250, 31, 206, 187, 206,
-    231, 16, 122, 180, 10, 61, 10, 178, 114, 48, 48, 237, 22, 52, 22, 199, 0, 21, 221, 106, 232, 204, 38, 179, 6, 85,
-    95, 184, 205, 56, 44, 48, 174, 102, 83, 27, 176, 121, 169, 92, 32, 139, 77, 141, 248, 4, 53, 237, 38, 153, 18, 154,
-    117, 190, 177, 87, 27, 87, 41, 186, 237, 123, 121, 49, 123, 81, 138, 61, 124, 96, 237, 192, 70, 121, 133, 248, 106,
-    160, 113, 89, 2, 9, 157, 141, 24, 172, 144, 139, 158, 214, 131, 121, 116, 108, 70, 182, 158, 254, 116, 103, 6, 50,
-    81, 192, 97, 147, 161, 217, 67, 107, 243, 153, 30, 25, 160, 64, 107, 208, 6, 227, 73, 135, 19, 185, 64, 57, 179,
-    101, 3, 90, 147, 75, 154, 50, 43, 53, 166, 195, 93, 153, 249, 206, 227, 119, 90, 129, 163, 19, 126, 100, 3, 133,
-    180, 18, 74, 209, 120, 202, 7, 40, 230, 230, 222, 53, 35, 124, 212, 57, 13, 122, 42, 180, 113, 241, 172, 63, 124,
-    146, 96, 144, 206, 137, 29, 133, 182, 77, 34, 227, 173, 117, 151, 183, 70, 243, 142, 179, 128, 102, 56, 24, 82, 79,
-    155, 118, 240, 27, 203, 64, 35, 82, 85, 35, 197, 79, 238, 209, 221, 14, 238, 196, 13, 160, 77, 98, 74, 56, 219, 211,
-    164, 227, 86, 52, 219, 210, 123, 172, 7, 18, 181, 231, 37, 234, 72, 175, 31, 59, 164, 172, 227, 133, 246, 130, 160,
-    149, 197, 233, 67, 166, 160, 83, 37, 68, 149, 204, 158, 118, 110, 6, 44, 124, 32, 240, 2, 40, 38, 181, 42, 84, 116,
-    79, 54, 88, 97, 241, 177, 64, 47, 9, 78, 12, 184, 148, 192, 145, 239, 76, 170, 71, 62, 93, 49, 234, 159, 170, 128,
-    248, 51, 173, 233, 79, 250, 44, 161, 72, 69, 93, 152, 103, 100, 173, 84, 26, 189, 190, 160, 56, 245, 172, 244, 141,
-    176, 181, 153, 44, 8, 207, 138, 31, 183, 4, 130, 170, 245, 16, 118, 121, 43, 196, 137, 12, 1, 70, 198, 242, 222,
-    185, 253, 86, 109, 139, 151, 143, 72, 6, 143, 183, 54, 81, 59, 216, 179, 37, 157, 15, 40, 4, 24, 160, 190, 54, 140,
-    91, 37, 109, 230, 245, 134, 101, 160, 209, 65, 70, 6, 89, 240, 62, 152, 231, 119, 183, 3, 231, 154, 198, 226, 168,
-    73, 125, 122, 8, 250, 58, 111, 18, 156, 164, 206, 55, 4, 3, 100, 104, 17, 253, 202, 173, 136, 53, 107, 160, 232,
-    155, 60, 107, 142, 101, 41, 191, 93, 27, 160, 161, 75, 75, 224, 68, 29, 252, 121, 130, 59, 209, 125, 212, 229, 225,
-    130, 152, 124, 103, 92, 189, 222, 131, 112, 22, 183, 24, 216, 6, 69, 60, 24, 196, 5, 74, 60, 129, 92, 237, 52, 67,
-    202, 170, 192, 244, 186, 11, 161, 151, 234, 176, 15, 8, 2, 172, 184, 194, 121, 204, 209, 50, 28, 135, 172, 178, 255,
-    178, 140, 22, 87, 104, 169, 124, 151, 142, 176, 255, 136, 179, 24, 205, 136, 129, 108, 77, 153, 112, 230, 137, 41,
-    219, 49, 58, 253, 104, 234, 69, 194, 90, 139, 198, 134, 229, 203, 155, 97, 199, 101, 25, 11, 111, 0, 14, 162, 148,
-    149, 1, 80, 62, 55, 175, 39, 30, 67, 127, 233, 168, 123, 163, 115, 0, 249, 93, 60, 188, 178, 231, 208, 244, 24, 74,
-    131, 77, 193, 214, 44, 180, 67, 74, 27, 214, 148, 13, 171, 132, 44, 84, 25, 35, 182, 156, 70, 152, 227, 101, 140,
-    149, 243, 187, 204, 208, 197, 148, 212, 186, 170, 171, 79, 153, 163, 86, 83, 253, 175, 179, 166, 183, 226, 199, 125,
-    135, 89, 170, 1, 187, 236, 197, 164, 164, 82, 207, 224, 136, 199, 142, 108, 232, 68, 129, 143, 49, 94, 207, 159,
-    173, 72, 129, 199, 119, 193, 34, 217, 69, 95, 230, 78, 157, 169, 150, 80, 90, 165, 60, 162, 130, 57, 16, 156, 124,
-    254, 72, 184, 143, 246, 203, 139, 170, 104, 173, 121, 23, 117, 174, 231, 61, 165, 160, 214, 3, 148, 68, 5, 100, 62,
-    211, 91, 164, 175, 106, 155, 34, 249, 170, 151, 60, 78, 223, 98, 0, 15, 174, 63, 251, 212, 177, 181, 92, 179, 245,
-    220, 225, 30, 251, 126, 240, 58, 125, 199, 219, 118, 48, 31, 56, 42, 205, 127, 181, 31, 139, 75, 234, 78, 158, 43,
-    114, 140, 77, 236, 148, 115, 58, 61, 63, 34, 219, 113, 111, 217, 238, 0, 108, 74, 111, 104, 55, 60, 179, 104, 93,
-    208, 67, 191, 205, 149, 99, 202, 169, 210, 52, 25, 35, 39, 27, 105, 174, 138, 136, 57, 107, 29, 14, 230, 211, 140,
-    15, 20, 99, 153, 217, 87, 49, 54, 170, 75, 145, 39, 121, 125, 230, 20, 247, 108, 189, 91, 199, 177, 144, 172, 156,
-    213, 242, 74, 146, 66, 68, 232, 168, 158, 35, 116, 20, 131, 107, 214, 1, 64, 224, 211, 42, 76, 3, 132, 152, 154,
-    163, 36, 151, 45, 29, 126, 106, 183, 72, 151, 229, 240, 187, 84, 174, 204, 175, 50, 58, 206, 217, 73, 162, 135, 100,
-    136, 247, 255, 148, 228, 64, 237, 85, 225, 178, 239, 204, 172, 142, 238, 218, 140, 122, 159, 214, 123, 61, 168, 171,
-    155, 184, 178, 177, 221, 222, 25, 35, 4, 128, 209, 5, 64, 182, 171, 1, 92, 158, 237, 59, 136, 42, 189, 116, 29, 36,
-    54, 141, 41, 218, 247, 203, 2, 32, 29, 95, 61, 182, 183, 117, 9, 43, 124, 0, 198, 69, 208, 222, 75, 81, 234, 19, 58,
-    237, 148, 28, 18, 121, 226, 244, 208, 140, 0, 108, 208, 25, 183, 34, 99, 140, 192, 228, 100, 202, 228, 168, 117,
-    159, 134, 38, 251, 59, 71, 2, 172, 82, 0, 245, 219, 160, 207, 168, 206, 152, 204, 208, 178, 224, 152, 74, 234, 216,
-    115, 150, 28, 37, 53, 117, 190, 115, 156, 136, 139, 100, 210, 144, 130, 133, 50, 143, 91, 203, 89, 234, 6, 197, 93,
-    230, 0, 94, 176, 83, 129, 184, 142, 70, 139, 253, 12, 131, 188, 35, 156, 205, 38, 137, 167, 32, 205, 212, 19, 132,
-    159, 229, 112, 233, 218, 82, 64, 114, 9, 224, 161, 201, 159, 115, 65, 244, 252, 223, 201, 19, 150, 235, 164, 223,
-    181, 84, 195, 245, 219, 225, 172, 121, 118, 167, 204, 254, 232, 34, 208, 216, 187, 99, 248, 209, 240, 160, 127, 57,
-    142, 231, 125, 186, 25, 103, 26, 209, 182, 46, 149, 70, 139, 57, 149, 121, 125, 90, 108, 99, 153, 25, 43, 167, 200,
-    127, 189, 4, 128, 2, 159, 207, 30, 131, 159, 210, 200, 237, 129, 29, 200, 162, 176, 162, 208, 18, 235, 23, 159, 203,
-    1, 110, 238, 63, 218, 199, 109, 89, 83, 24, 45, 23, 219, 180, 50, 176, 204, 4, 207, 81, 224, 66, 136, 28, 199, 37,
-    4, 205, 225, 11, 143, 159, 250, 9, 82, 197, 101, 91, 133, 107, 194, 198, 97, 7, 84, 144, 49, 131, 77, 149, 135, 120,
-    41, 247, 106, 21, 14, 248, 140, 90, 91, 117, 122, 164, 3, 13, 84, 129, 174, 185, 193, 125, 108, 64, 55, 226, 182,
-    208, 9, 182, 70, 118, 80, 126, 197, 191, 122, 36, 32, 182, 178, 175, 246, 24, 111, 60, 195, 232, 77, 134, 69, 64,
-    46, 196, 90, 111, 139, 20, 93, 12, 86, 194, 110, 80, 184, 227, 249, 208, 167, 116, 177, 116, 207, 172, 145, 220, 21,
-    144, 27, 207, 127, 31, 95, 228, 82, 158, 211, 238, 42, 36, 223, 253, 240, 34, 246, 107, 54, 52, 105, 193, 248, 84,
-    117, 227, 133, 230, 193, 238, 193, 106, 14, 134, 228, 84, 65, 207, 186, 17, 59, 34, 97, 149, 249, 32, 1, 191, 175,
-    197, 243, 11, 249, 174, 28, 255, 65, 192, 50, 82, 243, 57, 154, 203, 131, 202, 155, 15, 171, 216, 97, 21, 122, 172,
-    49, 17, 128, 10, 98, 201, 223, 102, 174, 246, 129, 139, 131, 38, 129, 18, 223, 114, 6, 189, 212, 197, 14, 200, 65,
-    19, 125, 236, 155, 186, 226, 29, 172, 131, 136, 204, 21, 46, 79, 101, 235, 163, 249, 60, 184, 13, 180, 190, 146,
-    177, 194, 220, 246, 173, 27, 35, 125, 150, 84, 194, 226, 184, 185, 231, 113, 197, 108, 225, 204, 54, 207, 30, 3,
-    174, 87, 62, 121, 176, 61, 250, 130, 87, 254, 207, 79, 157, 126, 235, 220, 214, 47, 38, 81, 97, 10, 157, 249, 1,
-    104, 122, 2, 149, 192, 131, 143, 7, 69, 207, 151, 85, 185, 108, 146, 159, 205, 67, 108, 220, 23, 34, 164, 154, 218,
-    137, 159, 48, 129, 135, 244, 123, 55, 139, 121, 130, 126, 101, 38, 89, 3, 193, 92, 251, 109, 64, 7, 54, 42, 129,
-    130, 131, 228, 14, 241, 118, 81, 26, 61, 75, 231, 33, 44, 247, 85, 154, 227, 141, 213, 94, 243, 75, 3, 41, 208, 45,
-    148, 187, 241, 248, 160, 95, 238, 120, 179, 26, 211, 112, 227, 41, 181, 191, 128, 219, 83, 229, 111, 9, 172, 146,
-    22, 53, 150, 116, 105, 127, 222, 66, 102, 160, 55, 99, 42, 240, 108, 11, 143, 22, 14, 74, 194, 10, 53, 55, 166, 103,
-    245, 168, 189, 183, 46, 194, 238, 109, 19, 50, 92, 88, 121, 33, 83, 37, 35, 63, 94, 104, 167, 225, 130, 52, 192, 60,
-    207, 74, 78, 188, 44, 135, 132, 116, 168, 120, 219, 79, 34, 216, 247, 88, 92, 9, 91, 157, 51, 250, 229, 224, 80,
-    161, 104, 238, 175, 46, 160, 91, 149, 117, 34, 6, 207, 219, 83, 181, 163, 227, 49, 227, 238, 143, 16, 239, 157, 92,
-    74, 104, 18, 27, 174, 55, 254, 22, 103, 33, 41, 135, 77, 68, 157, 41, 63, 170, 53, 8, 252, 106, 135, 64, 148, 75,
-    212, 252, 178, 62, 183, 147, 125, 138, 197, 76, 134, 244, 0, 51, 105, 231, 212, 90, 107, 93, 35, 231, 218, 149, 190,
-    69, 42, 41, 79, 134, 55, 155, 250, 8, 2, 22, 147, 162, 121, 54, 17, 211, 207, 235, 79, 124, 60, 241, 240, 229, 74,
-    193, 33, 188, 85, 202, 35, 191, 88, 233, 61, 231, 254, 140, 58, 36, 82, 43, 14, 123, 209, 57, 17, 231, 110, 21, 155,
-    70, 122, 69, 165, 59, 166, 213, 249, 75, 231, 76, 227, 196, 17, 243, 28, 59, 7, 80, 202, 150, 144, 141, 118, 92, 37,
-    150, 166, 21, 192, 170, 127, 184, 191, 161, 179, 122, 139, 7, 147, 113, 136, 202, 67, 84, 91, 150, 108, 215, 81,
-    190, 90, 90, 106, 153, 106, 61, 234, 175, 249, 239, 34, 7, 76, 15, 26, 199, 64, 76, 96, 165, 187, 219, 20, 4, 24,
-    20, 131, 54, 128, 109, 137, 113, 173, 176, 204, 41, 41, 123, 255, 214, 194, 131, 185, 32, 196, 44, 20, 79, 32, 55,
-    24, 136, 217, 185, 194, 106, 112, 134, 169, 233, 189, 243, 43, 50, 73, 227, 205, 72, 87, 150, 203, 110, 158, 231,
-    87, 226, 212, 176, 186, 2, 211, 80, 52, 194, 143, 159, 40, 252, 145, 129, 156, 70, 202, 194, 199, 212, 169, 150, 91,
-    20, 48, 112, 93, 246, 220, 49, 27, 102, 66, 254, 145, 187, 199, 51, 189, 43, 67, 236, 142, 215, 131, 235, 178, 5,
-    126, 83, 80, 174, 110, 19, 60, 237, 42, 229, 155, 54, 38, 35, 125, 232, 41, 9, 93, 117, 198, 240, 109, 2, 225, 213,
-    52, 121, 175, 13, 149, 246, 16, 138, 221, 245, 22, 5, 202, 4, 168, 57, 232, 203, 33, 217, 68, 97, 107, 130, 170,
-    150, 25, 106, 74, 17, 253, 100, 166, 64, 154, 178, 17, 80, 159, 25, 94, 210, 113, 255, 1, 74, 167, 213, 218, 148,
-    110, 202, 167, 128, 12, 20, 56, 134, 192, 92, 178, 160, 115, 242, 227, 140, 116, 254, 32, 108, 123, 48, 170, 238,
-    217, 169, 254, 2, 149, 1, 194, 28, 40, 153, 70, 163, 61, 12, 61, 159, 165, 155, 185, 114, 19, 168, 194, 92, 242,
-    188, 243, 215, 235, 46, 12, 88, 127, 131, 21, 135, 204, 85, 76, 207, 124, 32, 189, 191, 166, 163, 181, 146, 179,
-    210, 90, 14, 25, 118, 94, 2, 89, 110, 52, 84, 15, 203, 21, 144, 139, 2, 188, 57, 7, 33, 47, 202, 187, 32, 131, 152,
-    138, 97, 144, 34, 47, 31, 156, 89, 247, 28, 71, 216, 252, 159, 200, 181, 54, 171, 156, 158, 147, 181, 193, 112, 65,
-    229, 46, 47, 53, 32, 150, 210, 1, 75, 229, 49, 123, 224, 117, 1, 76, 52, 39, 76, 130, 17, 92, 26, 60, 72, 82, 96,
-    154, 3, 129, 150, 160, 100, 135, 34, 136, 12, 135, 188, 158, 29, 64, 178, 182, 238, 228, 166, 104, 102, 102, 157,
-    74, 183, 114, 47, 52, 166, 182, 50, 185, 148, 81, 22, 33, 22, 100, 111, 116, 26, 196, 69, 134, 183, 236, 1, 250, 29,
-    73, 26, 4, 126, 237, 240, 179, 220, 113, 69, 230, 76, 37, 68, 62, 128, 28, 232, 137, 78, 119, 176, 227, 183, 66, 55,
-    79, 220, 146, 186, 134, 4, 109, 34, 30, 217, 196, 44, 116, 45, 95, 121, 58, 66, 198, 104, 80, 232, 179, 212, 181,
-    218, 76, 21, 176, 20, 247, 175, 196, 184, 50, 217, 45, 126, 224, 98, 255, 11, 144, 14, 123, 5, 21, 193, 212, 5, 169,
-    169, 62, 68, 113, 72, 41, 35, 77, 156, 180, 6, 27, 50, 252, 58, 96, 234, 115, 179, 66, 243, 171, 164, 100, 206, 15,
-    241, 37, 165, 139, 103, 227, 138, 189, 44, 83, 170, 238, 105, 86, 96, 72, 158, 90, 125, 125, 140, 162, 55, 61, 253,
-    66, 109, 203, 173, 147, 245, 6, 247, 25, 41, 124, 244, 84, 248, 21, 46, 17, 85, 1, 152, 113, 23, 132, 168, 185, 15,
-    119, 151, 140, 59, 80, 5, 230, 42, 1, 26, 97, 4, 238, 82, 218, 21, 188, 28, 18, 151, 73, 187, 13, 128, 140, 157, 15,
-    53, 70, 227, 66, 39, 40, 184, 20, 182, 80, 83, 128, 80, 145, 168, 152, 198, 221, 21, 114, 105, 54, 8, 87, 170, 246,
-    153, 172, 237, 102, 173, 88, 205, 54, 80, 147, 56, 202, 238, 119, 113, 3, 204, 164, 62, 57, 99, 164, 61, 181, 106,
-    106, 254, 134, 77, 183, 52, 149, 158, 107, 125, 174, 202, 103, 13, 205, 180, 118, 98, 213, 232, 208, 78, 98, 178,
-    27, 118, 159, 46, 87, 157, 45, 91, 34, 246, 212, 69, 82, 197, 230, 166, 186, 120, 204, 68, 131, 116, 148, 58, 15,
-    251, 67, 139, 103, 250, 74, 29, 184, 208, 47, 250, 16, 5, 95, 81, 73, 0, 231, 118, 63, 6, 212, 151, 84, 150, 85, 86,
-    6, 206, 165, 249, 197, 236, 103, 31, 10, 252, 9, 143, 208, 49, 94, 55, 29, 176, 221, 98, 140, 177, 228, 220, 16,
-    181, 132, 181, 198, 8, 144, 201, 185, 27, 30, 240, 124, 251, 250, 162, 184, 79, 13, 184, 95, 239, 180, 121, 180,
-    151, 12, 251, 248, 193, 123, 85, 5, 211, 77, 202, 53, 166, 102, 58, 226, 211, 202, 138, 118, 27, 138, 221, 14, 237,
-    97, 21, 101, 207, 65, 163, 113, 163, 49, 227, 95, 57, 110, 174, 148, 155, 141, 48, 72, 144, 148, 229, 158, 130, 245,
-    89, 223, 17, 249, 254, 70, 216, 190, 88, 87, 255, 195, 231, 224, 24, 84, 85, 79, 17, 241, 249, 100, 99, 7, 170, 112,
-    135, 221, 33, 187, 10, 239, 136, 104, 77, 71, 38, 209, 59, 63, 56, 165, 97, 166, 16, 184, 229, 160, 197, 170, 246,
-    33, 17, 111, 184, 115, 42, 237, 205, 248, 103, 205, 168, 7, 38, 188, 243, 68, 218, 237, 66, 60, 2, 140, 101, 135,
-    89, 63, 172, 182, 54, 91, 80, 50, 113, 78, 48, 95, 189, 132, 19, 48, 24, 66, 6, 168, 85, 11, 112, 220, 161, 97, 250,
-    251, 199, 116, 150, 139, 44, 146, 193, 246, 126, 5, 152, 190, 63, 136, 81, 91, 239, 137, 121, 43, 208, 54, 127, 93,
-    45, 230, 117, 253, 120, 42, 148, 182, 223, 63, 206, 215, 69, 255, 45, 28, 103, 25, 17, 80, 31, 193, 62, 34, 96, 242,
-    213, 73, 38, 180, 173, 156, 203, 45, 104, 57, 150, 81, 8, 138, 11, 243, 132, 18, 245, 223, 226, 37, 67, 86, 131, 98,
-    62, 152, 27, 166, 99, 17, 72, 196, 226, 130, 219, 55, 94, 226, 65, 239, 113, 177, 59, 16, 21, 131, 145, 184, 171,
-    163, 86, 87, 252, 88, 199, 139, 213, 23, 107, 240, 10, 168, 14, 29, 7, 191, 42, 69, 134, 41, 177, 157, 207, 14, 74,
-    96, 146, 58, 202, 120, 82, 218, 37, 117, 12, 180, 9, 38, 149, 23, 254, 34, 224, 20, 32, 56, 49, 155, 67, 208, 235,
-    241, 131, 249, 64, 21, 142, 30, 202, 85, 88, 79, 43, 191, 172, 129, 67, 249, 3, 224, 111, 136, 95, 6, 42, 195, 111,
-    187, 231, 163, 123, 218, 251, 177, 143, 135, 187, 113, 178, 180, 86, 195, 16, 4, 95, 123, 140, 141, 91, 217, 88,
-    224, 155, 198, 125, 132, 61, 101, 181, 236, 221, 208, 162, 229, 34, 119, 81, 25, 247, 193, 117, 245, 154, 122, 99,
-    169, 235, 3, 235, 38, 90, 49, 53, 74, 248, 135, 77, 114, 39, 211, 125, 208, 62, 131, 95, 173, 0, 18, 210, 213, 58,
-    111, 62, 61, 53, 83, 17, 94, 33, 7, 40, 64, 166, 168, 151, 68, 214, 42, 234, 73, 104, 46, 119, 129, 249, 86, 171,
-    85, 7, 19, 114, 244, 231, 156, 17, 206, 12, 42, 12, 109, 229, 113, 132, 135, 121, 157, 161, 85, 86, 171, 49, 245,
-    165, 148, 218, 75, 218, 225, 188, 16, 117, 246, 238, 126, 40, 182, 139, 19, 22, 192, 31, 174, 28, 74, 137, 113, 59,
-    218, 77, 218, 120, 154, 126, 81, 16, 229, 246, 202, 90, 252, 70, 88, 182, 194, 10, 144, 214, 194, 235, 167, 83, 111,
-    174, 245, 69, 129, 205, 137, 62, 227, 184, 222, 196, 37, 173, 173, 202, 22, 101, 255, 5, 64, 32, 124, 202, 4, 37,
-    215, 195, 4, 65, 28, 250, 204, 124, 192, 86, 17, 185, 128, 79, 195, 100, 161, 225, 49, 29, 213, 4, 183, 123, 131,
-    62, 91, 187, 209, 75, 46, 172, 195, 41, 116, 153, 218, 51, 112, 194, 152, 217, 56, 100, 113, 132, 193, 216, 147,
-    120, 217, 177, 233, 90, 53, 52, 61, 217, 23, 214, 247, 130, 184, 131, 150, 126, 143, 75, 199, 126, 79, 95, 73, 140,
-    245, 183, 196, 238, 192, 134, 8, 19, 29, 77, 137, 228, 244, 63, 112, 255, 84, 60, 206, 147, 0, 111, 58, 181, 87, 94,
-    241, 162, 115, 79, 63, 64, 137, 43, 39, 131, 45, 18, 101, 4, 92, 53, 236, 64, 147, 165, 201, 140, 120, 171, 130,
-    108, 194, 18, 241, 16, 134, 76, 155, 17, 247, 117, 163, 94, 217, 134, 162, 7, 31, 145, 69, 151, 85, 158, 186, 176,
-    3, 106, 107, 101, 76, 235, 4, 181, 232, 121, 159, 165, 241, 153, 110, 238, 104, 14, 159, 181, 193, 205, 63, 153,
-    116, 32, 56, 2, 168, 54, 128, 59, 33, 204, 23, 46, 108, 221, 235, 64, 86, 104, 77, 226, 46, 124, 165, 132, 227, 178,
-    206, 135, 110, 226, 112, 188, 22, 96, 193, 76, 190, 44, 99, 117, 29, 57, 214, 66, 191, 121, 6, 148, 65, 200, 187,
-    22, 86, 73, 136, 241, 242, 241, 141, 38, 17, 128, 180, 215, 17, 206, 76, 113, 80, 50, 63, 255, 125, 217, 198, 248,
-    16, 218, 95, 86, 13, 52, 23, 189, 24, 200, 31, 102, 85, 5, 202, 184, 252, 111, 130, 183, 152, 153, 153, 124, 76,
-    216, 219, 48, 186, 90, 50, 4, 237, 203, 32, 117, 135, 215, 104, 74, 154, 173, 155, 57, 196, 144, 197, 21, 154, 164,
-    132, 147, 116, 158, 223, 253, 238, 26, 111, 203, 130, 160, 206, 155, 225, 107, 28, 33, 131, 44, 215, 188, 243, 159,
-    201, 251, 182, 5, 142, 10, 164, 214, 107, 36, 189, 38, 132, 93, 184, 238, 228, 233, 190, 37, 1, 171, 70, 164, 211,
-    128, 166, 235, 183, 129, 17, 104, 120, 120, 79, 8, 88, 177, 0, 147, 6, 143, 91, 139, 197, 129, 127, 233, 212, 209,
-    27, 185, 56, 22, 250, 242, 158, 38, 242, 102, 213, 5, 72, 221, 211, 74, 46, 107, 95, 141, 13, 182, 40, 207, 56, 85,
-    195, 106, 149, 168, 20, 240, 146, 162, 216, 185, 12, 35, 95, 31, 35, 127, 41, 220, 208, 188, 185, 23, 106, 208, 122,
-    17, 128, 45, 36, 54, 158, 54, 16, 115, 185, 0, 233, 210, 148, 163, 104, 176, 236, 7, 60, 163, 7, 78, 138, 97, 184,
-    7, 71, 234, 230, 123, 192, 251, 126, 0, 127, 237, 215, 81, 7, 190, 139, 228, 245, 100, 121, 246, 194, 33, 239, 223,
-    150, 196, 105, 22, 89, 200, 217, 65, 225, 167, 180, 98, 131, 130, 69, 35, 38, 16, 23, 189, 212, 249, 229, 6, 78,
-    202, 29, 32, 231, 160, 153, 236, 237, 96, 226, 0, 189, 106, 140, 169, 156, 114, 106, 191, 78, 236, 179, 129, 35,
-    199, 222, 194, 106, 42, 204, 228, 15, 88, 76, 18, 168, 102, 252, 137, 89, 116, 240, 115, 136, 232, 114, 101, 134,
-    214, 124, 131, 85, 172, 5, 232, 17, 209, 90, 52, 80, 54, 126, 47, 86, 248, 104, 114, 186, 15, 161, 238, 14, 170,
-    117, 92, 175, 65, 243, 188, 72, 48, 155, 106, 134, 112, 99, 164, 190, 223, 182, 115, 109, 34, 232, 170, 178, 24,
-    131, 240, 66, 47, 80, 233, 185, 1, 67, 119, 186, 59, 17, 74, 135, 30, 174, 48, 148, 160, 197, 110, 204, 174, 79,
-    198, 231, 59, 238, 96, 242, 37, 232, 9, 89, 156, 241, 236, 56, 206, 14, 29, 92, 224, 41, 154, 207, 170, 30, 211,
-    226, 139, 181, 177, 86, 209, 136, 195, 65, 227, 9, 145, 134, 76, 195, 4, 224, 13, 118, 23, 253, 41, 22, 249, 40,
-    148, 148, 134, 81, 227, 152, 128, 194, 213, 74, 194, 136, 20, 234, 98, 180, 152, 60, 10, 27, 90, 143, 29, 122, 187,
-    141, 148, 172, 21, 230, 117, 85, 179, 166, 110, 213, 138, 112, 185, 252, 219, 243, 118, 173, 119, 29, 201, 194, 115,
-    229, 225, 70, 238, 10, 82, 232, 22, 235, 79, 227, 29, 41, 7, 195, 207, 7, 108, 158, 6, 35, 170, 100, 20, 15, 125,
-    52, 70, 115, 54, 26, 34, 162, 219, 91, 94, 121, 138, 242, 31, 242, 119, 121, 66, 197, 39, 48, 164, 57, 202, 45, 166,
-    127, 131, 237, 139, 105, 130, 170, 212, 175, 189, 242, 146, 65, 92, 254, 165, 13, 5, 35, 146, 11, 129, 75, 10, 210,
-    160, 5, 185, 97, 128, 79, 99, 120, 155, 224, 198, 189, 89, 84, 102, 68, 233, 207, 6, 206, 159, 111, 210, 152, 102,
-    46, 11, 148, 180, 102, 176, 222, 210, 249, 236, 105, 103, 244, 8, 177, 96, 238, 185, 64, 83, 60, 107, 4, 90, 167,
-    70, 74, 190, 68, 149, 97, 34, 87, 76, 153, 113, 7, 76, 166, 213, 215, 29, 122, 188, 0, 67, 33, 38, 165, 42, 174,
-    136, 207, 74, 88, 6, 191, 129, 21, 195, 17, 170, 239, 240, 217, 245, 106, 209, 113, 245, 241, 2, 143, 151, 9, 62,
-    244, 187, 234, 127, 10, 176, 21, 126, 156, 186, 74, 240, 87, 52, 241, 251, 10, 218, 40, 159, 249, 250, 42, 91, 180,
-    74, 222, 46, 203, 143, 122, 89, 230, 208, 239, 132, 94, 94, 178, 228, 15, 210, 103, 149, 215, 7, 52, 182, 201, 107,
-    108, 164, 95, 201, 237, 236, 50, 73, 3, 152, 179, 24, 242, 132, 195, 119, 121, 240, 148, 198, 16, 169, 3, 179, 250,
-    158, 38, 32, 123, 76, 239, 130, 38, 214, 20, 246, 95, 47, 126, 114, 222, 182, 130, 31, 193, 4, 249, 51, 55, 46, 208,
-    52, 211, 219, 56, 171, 250, 148, 173, 228, 17, 47, 117, 1, 249, 95, 121, 118, 18, 168, 219, 244, 113, 252, 249, 178,
-    119, 29, 6, 226, 91, 96, 41, 216, 134, 226, 198, 157, 135, 149, 19, 112, 249, 86, 107, 162, 155, 199, 137, 150, 244,
-    206, 79, 91, 177, 212, 37, 99, 50, 237, 46, 205, 145, 255, 188, 124, 111, 0, 2, 31, 121, 172, 57, 127, 24, 105, 100,
-    233, 86, 93, 162, 17, 143, 223, 48, 192, 162, 226, 164, 186, 150, 141, 171, 169, 36, 88, 43, 173, 42, 88, 151, 0,
-    163, 137, 181, 152, 117, 84, 218, 104, 50, 49, 25, 231, 222, 106, 84, 254, 17, 106, 170, 252, 64, 68, 53, 209, 84,
-    83, 82, 112, 183, 178, 199, 234, 203, 241, 249, 117, 238, 196, 57, 45, 106, 52, 56, 57, 249, 80, 231, 80, 106, 146,
-    183, 116, 191, 22, 238, 113, 167, 105, 63, 76, 56, 88, 149, 69, 199, 193, 91, 174, 184, 190, 104, 246, 241, 46, 76,
-    20, 147, 94, 90, 101, 166, 22, 145, 174, 111, 90, 132, 233, 66, 165, 231, 131, 13, 247, 39, 68, 43, 165, 62, 96, 91,
-    28, 151, 228, 176, 22, 191, 60, 97, 39, 19, 73, 179, 117, 153, 104, 255, 202, 71, 17, 31, 41, 55, 14, 169, 105, 114,
-    175, 48, 241, 194, 119, 113, 199, 214, 41, 79, 201, 129, 80, 237, 203, 243, 82, 51, 224, 137, 125, 22, 166, 33, 241,
-    62, 231, 63, 115, 70, 146, 198, 242, 224, 231, 235, 22, 149, 98, 130, 36, 113, 17, 190, 52, 122, 238, 38, 126, 132,
-    60, 98, 50, 116, 64, 128, 181, 79, 58, 150, 172, 0, 176, 244, 215, 197, 18, 40, 201, 102, 123, 105, 46, 157, 183,
-    177, 168, 68, 96, 104, 125, 4, 203, 61, 56, 207, 215, 64, 15, 124, 52, 51, 101, 199, 16, 94, 232, 148, 66, 219, 224,
-    122, 14, 215, 59, 242, 96, 196, 87, 153, 21, 101, 210, 171, 127, 179, 176, 61, 218, 149, 245, 8, 118, 228, 235, 236,
-    101, 51, 179, 61, 45, 81, 79, 229, 180, 12, 246, 102, 195, 136, 167, 234, 42, 241, 63, 176, 53, 44, 216, 0, 229,
-    215, 0, 99, 150, 117, 89, 74, 197, 225, 124, 231, 216, 175, 105, 83, 174, 212, 164, 141, 63, 254, 185, 209, 90, 196,
-    241, 223, 86, 121, 32, 217, 226, 17, 139, 14, 20, 20, 181, 62, 53, 153, 106, 189, 44, 87, 238, 105, 52, 27, 58, 239,
-    60, 60, 187, 13, 90, 114, 254, 82, 237, 153, 88, 53, 172, 110, 184, 52, 198, 198, 11, 25, 41, 64, 239, 243, 110,
-    212, 199, 61, 40, 223, 226, 147, 129, 159, 8, 117, 218, 83, 66, 25, 252, 108, 182, 122, 103, 244, 86, 35, 52, 50,
-    134, 218, 206, 101, 82, 98, 51, 49, 179, 204, 253, 247, 200, 146, 123, 245, 210, 107, 74, 100, 28, 94, 129, 206,
-    126, 194, 101, 52, 96, 55, 166, 208, 21, 219, 139, 191, 18, 160, 248, 212, 161, 142, 196, 250, 227, 192, 4, 45, 20,
-    41, 16, 51, 157, 154, 21, 141, 189, 82, 226, 159, 238, 47, 164, 122, 86, 201, 178, 45, 103, 39, 54, 201, 141, 0,
-    117, 178, 96, 187, 138, 23, 128, 243, 47, 99, 61, 13, 173, 181, 124, 212, 208, 187, 125, 136, 178, 41, 93, 3, 168,
-    10, 211, 103, 26, 145, 147, 209, 34, 255, 219, 93, 241, 249, 13, 191, 11, 113, 214, 40, 213, 206, 139, 181, 98, 204,
-    45, 195, 163, 43, 237, 6, 222, 109, 204, 105, 161, 23, 192, 27, 52, 54, 214, 7, 186, 176, 53, 117, 162, 59, 67, 80,
-    3, 254, 161, 169, 177, 110, 194, 231, 30, 24, 139, 52, 204, 124, 25, 255, 209, 167, 89, 76, 7, 72, 27, 151, 6, 195,
-    1, 20, 163, 122, 57, 250, 140, 88, 140, 71, 172, 10, 14, 122, 160, 175, 31, 157, 210, 82, 188, 185, 8, 46, 241, 160,
-    146, 192, 245, 109, 56, 110, 247, 100, 47, 45, 59, 26, 148, 203, 142, 59, 103, 217, 40, 69, 11, 184, 85, 28, 86,
-    182, 102, 207, 213, 226, 200, 231, 119, 12, 45, 76, 19, 105, 4, 236, 94, 244, 71, 215, 185, 47, 4, 187, 240, 184,
-    20, 89, 122, 139, 168, 146, 89, 165, 83, 229, 65, 140, 14, 50, 133, 189, 91, 149, 73, 167, 214, 23, 30, 88, 2, 217,
-    177, 80, 134, 213, 112, 240, 180, 39, 185, 37, 216, 71, 222, 110, 214, 221, 35, 225, 76, 112, 138, 25, 46, 19, 252,
-    107, 103, 156, 15, 214, 45, 192, 42, 3, 175, 120, 122, 67, 153, 38, 59, 226, 110, 200, 182, 11, 103, 184, 129, 252,
-    21, 120, 250, 55, 254, 89, 220, 184, 42, 220, 235, 16, 112, 93, 46, 251, 111, 188, 254, 46, 11, 121, 105, 192, 135,
-    238, 27, 226, 39, 223, 185, 152, 111, 40, 59, 63, 253, 192, 102, 240, 35, 233, 207, 110, 20, 107, 93, 152, 7, 159,
-    41, 176, 104, 165, 67, 69, 193, 251, 59, 37, 255, 87, 162, 217, 9, 137, 155, 42, 34, 131, 45, 41, 239, 73, 74, 248,
-    83, 1, 183, 172, 130, 220, 149, 9, 134, 82, 16, 49, 174, 86, 199, 47, 224, 92, 116, 5, 137, 82, 7, 4, 188, 198, 36,
-    117, 247, 148, 135, 203, 130, 80, 43, 89, 224, 25, 212, 180, 228, 158, 177, 182, 148, 54, 139, 20, 221, 192, 174,
-    162, 33, 175, 42, 111, 169, 223, 50, 177, 129, 168, 118, 142, 58, 50, 146, 137, 227, 139, 230, 12, 170, 222, 144,
-    69, 247, 58, 116, 67, 28, 202, 249, 110, 90, 123, 171, 178, 174, 86, 213, 160, 114, 111, 200, 183, 245, 76, 98, 9,
-    143, 43, 158, 80, 144, 22, 196, 88, 10, 104, 112, 123, 208, 51, 207, 116, 49, 188, 131, 229, 211, 78, 246, 94, 34,
-    33, 98, 75, 141, 73, 47, 138, 25, 169, 201, 15, 165, 49, 217, 176, 105, 16, 197, 240, 242, 124, 25, 75, 86, 125,
-    184, 145, 107, 202, 136, 80, 171, 62, 77, 64, 230, 43, 191, 38, 112, 237, 47, 58, 9, 36, 61, 185, 91, 51, 160, 2,
-    248, 46, 161, 126, 85, 183, 23, 192, 127, 48, 97, 115, 174, 121, 62, 25, 182, 243, 19, 8, 236, 175, 73, 169, 237,
-    94, 99, 146, 107, 170, 33, 223, 136, 30, 171, 153, 65, 198, 179, 53, 176, 41, 59, 75, 243, 73, 190, 245, 112, 168,
-    24, 246, 158, 208, 237, 44, 79, 65, 26, 170, 63, 86, 49, 215, 3, 192, 7, 113, 152, 239, 20, 127, 114, 217, 105, 46,
-    184, 40, 195, 238, 98, 17, 145, 76, 35, 91, 146, 251, 250, 39, 244, 186, 204, 169, 148, 204, 122, 128, 69, 135, 58,
-    211, 197, 21, 39, 159, 50, 240, 150, 57, 20, 84, 159, 208, 227, 91, 124, 44, 111, 210, 17, 136, 120, 116, 197, 255,
-    28, 246, 153, 132, 7, 209, 228, 158, 170, 52, 22, 76, 61, 151, 209, 187, 18, 13, 225, 47, 0, 129, 129, 60, 73, 94,
-    139, 156, 39, 255, 223, 203, 70, 171, 216, 7, 192, 16, 213, 235, 5, 75, 243, 43, 254, 144, 186, 66, 28, 196, 86,
-    141, 48, 13, 96, 96, 242, 145, 185, 172, 215, 218, 98, 213, 23, 252, 233, 223, 187, 170, 92, 60, 67, 34, 215, 59,
-    188, 67, 61, 50, 55, 18, 28, 150, 29, 213, 104, 245, 58, 65, 74, 138, 54, 77, 226, 68, 94, 229, 215, 19, 46, 163,
-    22, 92, 132, 239, 243, 173, 173, 79, 18, 233, 138, 194, 186, 142, 187, 218, 138, 127, 0, 23, 66, 164, 218, 36, 104,
-    174, 70, 191, 76, 71, 84, 181, 159, 1, 63, 209, 159, 20, 18, 13, 185, 230, 29, 119, 42, 78, 145, 107, 31, 73, 173,
-    71, 159, 184, 99, 176, 32, 134, 141, 67, 147, 180, 104, 69, 159, 83, 87, 39, 53, 90, 20, 208, 50, 26, 70, 239, 200,
-    254, 138, 56, 62, 95, 172, 109, 244, 35, 67, 39, 179, 237, 14, 82, 1, 40, 90, 60, 246, 38, 221, 133, 138, 12, 35,
-    124, 22, 199, 240, 243, 52, 227, 9, 155, 9, 165, 65, 230, 156, 27, 139, 161, 56, 224, 154, 27, 48, 228, 159, 75, 4,
-    15, 30, 150, 228, 114, 61, 13, 253, 185, 188, 135, 184, 93, 42, 117, 70, 20, 56, 26, 178, 192, 185, 114, 235, 255,
-    137, 97, 101, 21, 191, 197, 11, 62, 213, 147, 52, 147, 125, 69, 138, 10, 13, 14, 9, 80, 38, 235, 172, 93, 195, 232,
-    243, 30, 78, 88, 4, 79, 132, 5, 143, 202, 88, 244, 230, 160, 237, 241, 113, 151, 174, 211, 245, 235, 175, 179, 240,
-    210, 197, 202, 161, 29, 32, 10, 14, 56, 240, 205, 39, 234, 102, 43, 80, 102, 11, 196, 110, 7, 198, 90, 191, 151,
-    114, 115, 25, 143, 20, 63, 50, 145, 178, 136, 22, 23, 164, 96, 198, 230, 19, 80, 154, 85, 157, 55, 128, 125, 14,
-    167, 100, 1, 181, 190, 150, 98, 179, 71, 197, 128, 250, 14, 48, 251, 73, 80, 119, 37, 180, 141, 139, 47, 128, 9,
-    223, 150, 21, 109, 156, 116, 0, 187, 216, 182, 189, 181, 151, 66, 62, 207, 21, 116, 199, 253, 31, 24, 121, 165, 152,
-    78, 10, 250, 35, 77, 151, 221, 238, 76, 88, 50, 105, 145, 174, 132, 105, 186, 218, 151, 13, 126, 136, 228, 245, 128,
-    124, 223, 147, 137, 41, 213, 80, 89, 146, 214, 194, 230, 41, 218, 214, 222, 166, 198, 18, 153, 166, 121, 201, 170,
-    64, 217, 138, 134, 146, 2, 21, 135, 27, 218, 80, 40, 217, 28, 146, 98, 49, 27, 231, 155, 49, 218, 245, 79, 14, 159,
-    37, 46, 118, 58, 15, 12, 81, 182, 222, 86, 91, 72, 199, 141, 233, 147, 65, 143, 229, 235, 35, 239, 64, 126, 65, 163,
-    23, 54, 177, 188, 155, 231, 144, 97, 182, 220, 118, 142, 218, 157, 24, 203, 174, 152, 149, 29, 87, 145, 52, 242,
-    173, 21, 70, 71, 169, 13, 145, 156, 48, 79, 117, 10, 146, 149, 41, 198, 246, 118, 105, 151, 13, 177, 254, 108, 45,
-    47, 203, 1, 1, 186, 125, 137, 80, 202, 135, 29, 88, 12, 101, 151, 93, 31, 3, 226, 103, 64, 165, 85, 147, 180, 46,
-    82, 1, 195, 225, 3, 92, 36, 219, 61, 69, 26, 117, 207, 108, 212, 220, 160, 23, 161, 230, 136, 112, 40, 172, 85, 58,
-    46, 99, 104, 18, 94, 36, 214, 92, 172, 198, 98, 70, 71, 189, 249, 249, 13, 101, 39, 32, 206, 160, 148, 111, 237, 85,
-    182, 99, 137, 66, 50, 0, 161, 146, 136, 33, 166, 167, 232, 92, 239, 206, 194, 168, 57, 179, 36, 95, 67, 215, 106,
-    255, 206, 171, 117, 236, 92, 70, 125, 201, 106, 35, 85, 229, 19, 2, 120, 114, 232, 105, 51, 78, 193, 184, 177, 244,
-    146, 154, 93, 124, 248, 201, 222, 147, 135, 159, 76, 164, 73, 162, 2, 71, 198, 91, 142, 242, 42, 113, 87, 253, 51,
-    88, 166, 234, 60, 201, 190, 203, 0, 193, 158, 89, 148, 23, 104, 41, 199, 186, 231, 82, 233, 221, 161, 23, 153, 98,
-    226, 232, 169, 69, 108, 36, 217, 233, 234, 193, 155, 53, 49, 135, 205, 64, 30, 213, 191, 118, 136, 148, 85, 162, 65,
-    100, 128, 128, 232, 104, 125, 207, 254, 228, 182, 106, 193, 59, 251, 225, 113, 211, 121, 182, 94, 211, 239, 111, 24,
-    226, 105, 210, 235, 129, 31, 122, 227, 229, 218, 137, 227, 62, 51, 199, 196, 210, 218, 223, 162, 248, 247, 18, 9,
-    112, 16, 212, 170, 67, 246, 227, 109, 119, 225, 157, 129, 144, 80, 114, 17, 144, 78, 72, 138, 11, 59, 235, 34, 177,
-    95, 54, 126, 233, 25, 142, 251, 118, 197, 190, 14, 165, 173, 254, 189, 62, 209, 103, 54, 244, 133, 197, 141, 219,
-    75, 245, 199, 137, 131, 106, 181, 34, 151, 199, 9, 129, 244, 166, 152, 182, 147, 94, 248, 44, 140, 130, 208, 176,
-    246, 65, 175, 250, 165, 80, 117, 183, 128, 182, 16, 36, 125, 29, 209, 210, 42, 221, 138, 106, 52, 175, 118, 226, 74,
-    132, 67, 133, 235, 121, 220, 213, 48, 243, 26, 153, 197, 196, 122, 225, 139, 159, 0, 255, 153, 48, 77, 127, 249, 61,
-    84, 68, 36, 28, 51, 70, 99, 217, 200, 244, 69, 73, 178, 16, 65, 219, 223, 136, 50, 165, 196, 122, 194, 221, 248,
-    144, 3, 177, 127, 55, 17, 220, 189, 116, 96, 57, 149, 211, 194, 92, 231, 71, 128, 5, 176, 166, 186, 241, 161, 12,
-    38, 216, 145, 218, 172, 0, 230, 19, 196, 175, 121, 46, 126, 48, 29, 164, 6, 41, 129, 181, 109, 57, 115, 26, 182,
-    145, 190, 105, 41, 88, 121, 164, 126, 122, 44, 235, 249, 122, 143, 206, 151, 130, 226, 18, 28, 45, 72, 94, 190, 113,
-    105, 48, 241, 62, 83, 160, 48, 239, 9, 180, 48, 43, 16, 21, 255, 217, 65, 177, 98, 212, 18, 142, 114, 60, 253, 103,
-    170, 140, 180, 186, 127, 4, 33, 85, 241, 29, 254, 72, 179, 83, 66, 231, 42, 241, 214, 113, 33, 239, 173, 152, 233,
-    119, 112, 24, 23, 174, 12, 133, 231, 30, 6, 117, 172, 152, 249, 152, 40, 249, 96, 43, 39, 155, 248, 233, 243, 69, 7,
-    167, 31, 206, 39, 20, 123, 207, 132, 99, 203, 56, 110, 99, 177, 3, 71, 208, 29, 237, 1, 125, 114, 168, 78, 169, 41,
-    112, 177, 84, 217, 175, 192, 244, 171, 95, 176, 32, 216, 70, 167, 32, 201, 130, 112, 70, 241, 98, 105, 184, 25, 199,
-    151, 117, 252, 239, 196, 196, 86, 154, 77, 134, 158, 90, 60, 191, 251, 36, 202, 175, 90, 94, 155, 227, 146, 148,
-    208, 23, 190, 155, 209, 101, 30, 156, 53, 95, 184, 5, 148, 59, 194, 81, 125, 21, 0, 32, 223, 127, 49, 119, 149, 38,
-    217, 243, 69, 139, 150, 102, 44, 147, 181, 252, 192, 187, 238, 67, 144, 233, 141, 73, 160, 221, 228, 107, 125, 65,
-    179, 108, 160, 164, 143, 116, 178, 136, 81, 126, 131, 40, 65, 245, 173, 9, 186, 27, 148, 181, 192, 129, 118, 53, 74,
-    131, 52, 171, 123, 91, 187, 161, 144, 96, 43, 53, 210, 163, 137, 244, 138, 141, 68, 234, 3, 35, 205, 43, 5, 187,
-    130, 82, 253, 168, 53, 91, 169, 183, 198, 165, 205, 159, 9, 119, 208, 252, 123, 28, 177, 93, 70, 24, 84, 186, 55,
-    32, 232, 31, 2, 104, 148, 200, 205, 165, 168, 173, 89, 119, 102, 244, 89, 209, 86, 156, 103, 168, 137, 146, 67, 19,
-    29, 168, 97, 251, 26, 19, 102, 82, 183, 1, 62, 67, 58, 251, 18, 164, 226, 140, 251, 241, 10, 66, 248, 113, 253, 13,
-    97, 169, 196, 60, 129, 6, 174, 209, 10, 90, 125, 76, 111, 126, 10, 201, 106, 54, 146, 141, 161, 166, 234, 81, 18,
-    72, 16, 1, 223, 241, 119, 202, 125, 240, 243, 28, 247, 171, 68, 77, 114, 67, 0, 87, 3, 220, 4, 73, 39, 155, 18, 118,
-    126, 125, 222, 219, 203, 51, 46, 165, 219, 92, 41, 36, 23, 199, 80, 20, 43, 143, 98, 95, 62, 30, 86, 251, 219, 154,
-    40, 183, 8, 163, 54, 251, 5, 51, 227, 43, 158, 105, 123, 140, 68, 74, 219, 36, 216, 189, 154, 239, 67, 219, 255, 75,
-    250, 155, 161, 106, 148, 234, 44, 87, 208, 136, 185, 199, 232, 163, 208, 237, 185, 228, 50, 39, 92, 226, 55, 139,
-    97, 61, 35, 168, 218, 143, 236, 132, 248, 73, 14, 197, 98, 244, 52, 234, 37, 26, 12, 96, 155, 234, 208, 176, 49,
-    100, 107, 15, 97, 169, 107, 233, 198, 70, 135, 17, 174, 10, 216, 68, 187, 53, 237, 6, 241, 197, 48, 33, 225, 37, 42,
-    114, 84, 105, 28, 195, 54, 65, 124, 73, 129, 214, 99, 161, 7, 226, 132, 244, 68, 1, 72, 206, 108, 193, 137, 117,
-    187, 142, 135, 26, 4, 207, 108, 111, 235, 8, 127, 106, 69, 195, 193, 166, 112, 181, 203, 2, 5, 29, 15, 101, 93, 226,
-    145, 204, 64, 172, 33, 168, 203, 191, 173, 29, 94, 128, 72, 9, 200, 131, 76, 214, 56, 203, 173, 73, 204, 106, 127,
-    190, 32, 76, 100, 197, 34, 187, 248, 147, 200, 74, 206, 97, 239, 107, 127, 120, 155, 68, 187, 193, 7, 254, 156, 241,
-    132, 155, 223, 2, 172, 211, 176, 84, 163, 33, 51, 87, 2, 94, 219, 215, 59, 146, 238, 150, 215, 167, 201, 191, 117,
-    167, 159, 172, 222, 176, 207, 132, 107, 152, 31, 48, 228, 249, 41, 45, 15, 111, 3, 203, 115, 193, 101, 86, 56, 199,
-    237, 165, 198, 162, 96, 97, 102, 64, 84, 131, 103, 120, 149, 176, 112, 153, 79, 195, 144, 107, 207, 72, 241, 245,
-    227, 7, 174, 40, 64, 37, 130, 185, 252, 124, 120, 227, 102, 36, 154, 105, 172, 85, 82, 219, 189, 188, 200, 161, 84,
-    118, 249, 55, 207, 29, 26, 240, 192, 3, 85, 18, 204, 168, 241, 42, 161, 55, 180, 62, 103, 20, 164, 59, 7, 111, 243,
-    150, 192, 54, 123, 57, 190, 175, 201, 214, 18, 135, 242, 251, 85, 48, 83, 237, 235, 175, 83, 146, 90, 28, 243, 162,
-    50, 244, 213, 192, 212, 53, 100, 8, 232, 187, 121, 215, 49, 184, 242, 104, 109, 185, 93, 83, 254, 234, 15, 82, 30,
-    96, 94, 23, 151, 54, 201, 166, 198, 169, 80, 236, 166, 18, 55, 99, 63, 69, 32, 246, 130, 128, 62, 71, 66, 48, 104,
-    234, 199, 234, 221, 95, 102, 209, 203, 132, 106, 128, 126, 185, 227, 14, 117, 5, 154, 136, 231, 153, 7, 44, 238,
-    151, 252, 77, 98, 59, 231, 36, 206, 95, 76, 117, 177, 231, 209, 127, 131, 173, 18, 198, 43, 2, 168, 230, 235, 55,
-    155, 37, 244, 239, 237, 112, 96, 104, 9, 41, 237, 224, 98, 110, 35, 19, 215, 159, 48, 139, 31, 148, 46, 201, 212,
-    104, 69, 184, 167, 40, 126, 170, 95, 228, 166, 31, 66, 58, 30, 238, 54, 146, 124, 88, 38, 171, 203, 37, 194, 26,
-    111, 70, 33, 216, 120, 108, 113, 27, 190, 18, 232, 132, 206, 233, 49, 147, 23, 24, 50, 150, 29, 81, 35, 239, 178,
-    111, 54, 161, 88, 226, 52, 147, 132, 241, 188, 182, 15, 197, 203, 49, 83, 58, 186, 227, 92, 43, 137, 131, 140, 40,
-    112, 14, 9, 146, 252, 6, 31, 92, 86, 57, 255, 31, 147, 112, 124, 145, 225, 73, 177, 207, 123, 177, 90, 226, 194, 27,
-    125, 143, 80, 215, 106, 14, 211, 4, 142, 148, 236, 38, 86, 68, 83, 24, 208, 108, 216, 26, 247, 220, 240, 184, 164,
-    108, 212, 162, 221, 123, 217, 81, 92, 98, 88, 216, 73, 58, 232, 169, 8, 224, 36, 25, 88, 78, 176, 89, 251, 90, 26,
-    91, 216, 181, 37, 20, 108, 182, 50, 37, 83, 143, 39, 173, 22, 232, 120, 120, 161, 106, 137, 255, 240, 142, 57, 117,
-    248, 197, 32, 237, 250, 135, 121, 142, 117, 135, 168, 93, 106, 106, 186, 142, 187, 10, 167, 81, 133, 240, 53, 37,
-    60, 161, 214, 40, 18, 108, 233, 238, 78, 187, 115, 91, 4, 50, 249, 150, 71, 53, 51, 253, 217, 242, 171, 246, 71, 50,
-    198, 49, 145, 207, 141, 16, 1, 79, 156, 227, 140, 26, 239, 137, 25, 49, 132, 95, 142, 221, 231, 76, 120, 4, 7, 35,
-    200, 205, 51, 234, 98, 164, 142, 4, 58, 140, 67, 81, 58, 8, 33, 176, 198, 168, 242, 221, 196, 115, 148, 179, 69,
-    181, 197, 154, 153, 151, 137, 132, 17, 253, 248, 157, 8, 140, 171, 79, 220, 106, 185, 167, 44, 161, 215, 107, 35,
-    118, 149, 125, 54, 119, 67, 122, 26, 22, 154, 79, 196, 149, 132, 95, 55, 78, 163, 113, 218, 187, 62, 162, 183, 142,
-    146, 75, 78, 12, 206, 13, 178, 118, 156, 241, 245, 142, 129, 229, 238, 30, 57, 248, 14, 242, 59, 235, 40, 112, 242,
-    114, 7, 192, 171, 194, 75, 107, 195, 213, 26, 130, 104, 137, 81, 249, 159, 247, 237, 201, 126, 180, 192, 92, 128,
-    170, 5, 33, 65, 111, 12, 40, 56, 206, 128, 122, 76, 84, 150, 49, 200, 254, 108, 131, 131, 7, 88, 208, 248, 154, 182,
-    193, 245, 76, 135, 222, 192, 247, 181, 164, 126, 34, 102, 141, 187, 217, 243, 230, 7, 172, 121, 207, 181, 156, 211,
-    231, 145, 208, 149, 30, 137, 199, 190, 245, 99, 74, 46, 31, 186, 137, 71, 23, 61, 0, 127, 108, 127, 205, 64, 91,
-    185, 37, 43, 182, 80, 175, 176, 215, 21, 220, 187, 146, 188, 233, 248, 88, 42, 250, 231, 43, 144, 161, 167, 76, 249,
-    171, 203, 203, 248, 168, 181, 43, 41, 12, 125, 169, 242, 195, 147, 89, 131, 177, 225, 23, 119, 219, 115, 217, 102,
-    36, 132, 171, 229, 223, 67, 81, 9, 179, 166, 28, 61, 124, 111, 136, 138, 169, 82, 8, 192, 141, 32, 28, 37, 132, 99,
-    57, 95, 21, 253, 116, 152, 253, 43, 38, 228, 15, 151, 61, 180, 162, 188, 172, 18, 61, 58, 42, 115, 47, 115, 30, 166,
-    10, 46, 47, 40, 157, 143, 91, 65, 43, 242, 204, 70, 57, 253, 219, 112, 250, 118, 216, 168, 68, 129, 251, 60, 3, 237,
-    178, 138, 128, 230, 102, 64, 52, 182, 92, 3, 217, 121, 104, 246, 250, 37, 22, 32, 22, 31, 71, 59, 54, 93, 246, 254,
-    252, 68, 126, 26, 203, 37, 129, 56, 59, 245, 125, 48, 11, 99, 22, 190, 160, 141, 57, 22, 142, 18, 182, 74, 183, 223,
-    252, 46, 34, 247, 240, 2, 114, 63, 101, 26, 12, 199, 83, 162, 80, 199, 135, 69, 146, 127, 135, 243, 246, 216, 191,
-    95, 224, 3, 249, 64, 203, 18, 247, 22, 200, 136, 71, 49, 198, 172, 244, 154, 184, 160, 243, 201, 5, 97, 89, 153,
-    187, 56, 40, 192, 193, 210, 90, 240, 83, 31, 187, 152, 98, 231, 164, 63, 65, 182, 48, 140, 88, 251, 255, 112, 111,
-    112, 212, 110, 221, 232, 220, 185, 15, 28, 117, 49, 58, 22, 234, 184, 17, 172, 210, 31, 25, 144, 250, 14, 91, 121,
-    55, 14, 238, 17, 4, 174, 0, 247, 228, 87, 127, 25, 208, 95, 251, 30, 53, 196, 156, 119, 135, 117, 217, 116, 133, 54,
-    105, 40, 2, 217, 200, 225, 28, 148, 123, 80, 245, 237, 243, 88, 102, 164, 215, 250, 69, 148, 93, 154, 83, 226, 106,
-    242, 142, 164, 11, 109, 123, 252, 67, 33, 68, 113, 238, 148, 244, 113, 120, 196, 126, 165, 251, 121, 195, 21, 233,
-    216, 145, 138, 42, 191, 37, 252, 53, 150, 37, 141, 136, 234, 211, 34, 39, 137, 254, 49, 218, 234, 35, 66, 253, 2,
-    153, 13, 13, 101, 115, 54, 26, 139, 252, 241, 54, 188, 109, 204, 144, 207, 59, 215, 207, 219, 225, 156, 252, 87,
-    217, 216, 177, 118, 137, 52, 11, 144, 23, 174, 181, 71, 91, 100, 112, 76, 226, 22, 91, 180, 103, 99, 194, 247, 37,
-    225, 157, 236, 240, 101, 52, 182, 221, 41, 178, 11, 0, 13, 59, 133, 177, 189, 197, 140, 62, 215, 224, 126, 193, 23,
-    201, 147, 255, 161, 47, 156, 79, 126, 243, 209, 226, 63, 230, 142, 4, 110, 56, 114, 115, 188, 211, 188, 102, 102,
-    224, 67, 83, 28, 182, 18, 186, 92, 103, 133, 154, 253, 139, 134, 241, 208, 186, 39, 5, 17, 192, 2, 185, 209, 135, 0,
-    160, 158, 136, 190, 124, 229, 182, 114, 195, 27, 131, 226, 152, 142, 221, 230, 189, 180, 82, 113, 9, 57, 193, 53,
-    99, 92, 155, 74, 217, 113, 77, 148, 75, 100, 39, 35, 220, 203, 190, 161, 143, 41, 62, 65, 82, 228, 160, 183, 85, 91,
-    181, 183, 122, 54, 101, 140, 117, 7, 130, 126, 124, 193, 50, 216, 153, 71, 185, 87, 17, 51, 143, 250, 143, 40, 80,
-    213, 216, 83, 172, 92, 0, 161, 139, 72, 45, 3, 23, 19, 160, 22, 124, 166, 221, 198, 151, 74, 28, 40, 183, 3, 205,
-    111, 159, 98, 126, 176, 214, 141, 119, 60, 189, 249, 181, 60, 132, 33, 91, 80, 57, 43, 22, 51, 133, 240, 234, 29,
-    12, 131, 156, 126, 204, 37, 170, 38, 250, 252, 198, 229, 69, 218, 44, 249, 172, 115, 182, 33, 197, 97, 163, 99, 155,
-    168, 174, 152, 160, 66, 165, 83, 152, 216, 76, 178, 184, 111, 141, 26, 241, 214, 92, 241, 27, 228, 166, 59, 3, 229,
-    44, 17, 57, 181, 58, 249, 172, 195, 55, 21, 162, 173, 152, 7, 113, 131, 112, 106, 124, 137, 142, 142, 87, 255, 184,
-    215, 252, 83, 197, 52, 114, 154, 7, 187, 144, 240, 123, 179, 241, 217, 149, 235, 245, 86, 158, 218, 216, 120, 107,
-    235, 14, 136, 195, 123, 200, 28, 130, 47, 64, 163, 6, 138, 39, 168, 237, 107, 251, 248, 104, 13, 203, 56, 122, 136,
-    28, 33, 179, 83, 25, 15, 44, 226, 244, 223, 144, 141, 237, 187, 198, 8, 3, 51, 223, 81, 140, 236, 119, 111, 199, 10,
-    63, 0, 200, 60, 154, 161, 102, 251, 33, 147, 148, 15, 156, 67, 109, 248, 162, 43, 214, 127, 201, 200, 133, 23, 79,
-    92, 66, 149, 206, 214, 178, 112, 145, 138, 19, 243, 92, 22, 11, 207, 155, 159, 27, 166, 238, 235, 227, 183, 113,
-    132, 70, 83, 134, 102, 93, 216, 208, 228, 94, 95, 89, 101, 8, 115, 193, 229, 72, 248, 41, 45, 208, 219, 106, 136,
-    16, 2, 168, 185, 187, 211, 59, 60, 17, 189, 113, 61, 187, 84, 59, 10, 214, 140, 90, 111, 158, 168, 92, 169, 169,
-    117, 97, 152, 20, 109, 132, 78, 34, 192, 177, 144, 70, 56, 180, 195, 20, 52, 23, 218, 35, 243, 35, 79, 246, 157,
-    130, 219, 1, 68, 66, 10, 84, 96, 119, 85, 239, 107, 52, 87, 158, 63, 30, 254, 89, 28, 255, 37, 8, 210, 22, 141, 40,
-    16, 10, 48, 66, 73, 5, 159, 25, 216, 59, 189, 204, 15, 110, 88, 106, 135, 130, 20, 213, 133, 229, 195, 212, 216, 9,
-    118, 166, 80, 23, 145, 183, 116, 130, 133, 179, 109, 131, 133, 183, 66, 109, 202, 75, 49, 81, 166, 212, 14, 104,
-    210, 155, 202, 65, 89, 98, 154, 67, 141, 171, 131, 131, 27, 239, 68, 243, 9, 186, 76, 158, 210, 250, 196, 67, 237,
-    10, 160, 11, 203, 88, 90, 249, 185, 25, 133, 136, 194, 17, 12, 4, 237, 50, 103, 138, 3, 115, 245, 197, 224, 154, 47,
-    62, 229, 208, 160, 211, 103, 2, 27, 240, 114, 0, 136, 241, 23, 155, 1, 77, 68, 18, 145, 41, 14, 32, 25, 169, 103,
-    255, 135, 186, 68, 1, 101, 153, 4, 223, 69, 172, 188, 76, 4, 182, 23, 85, 239, 36, 222, 44, 100, 203, 174, 153, 245,
-    18, 229, 194, 200, 31, 174, 251, 44, 193, 224, 135, 183, 203, 210, 49, 175, 213, 211, 187, 202, 73, 97, 188, 157,
-    223, 149, 209, 239, 113, 161, 6, 213, 7, 76, 95, 84, 188, 194, 145, 122, 119, 35, 180, 182, 12, 6, 153, 182, 185,
-    144, 156, 207, 70, 65, 120, 156, 117, 93, 89, 79, 250, 69, 61, 200, 105, 174, 206, 58, 232, 236, 107, 127, 30, 116,
-    145, 60, 244, 179, 126, 63, 182, 159, 104, 30, 35, 22, 212, 237, 48, 42, 108, 166, 161, 119, 215, 32, 214, 194, 19,
-    68, 62, 55, 192, 177, 210, 31, 193, 144, 67, 194, 129, 229, 58, 123, 170, 237, 59, 185, 115, 188, 104, 81, 24, 132,
-    38, 247, 85, 75, 204, 208, 145, 84, 61, 149, 165, 76, 178, 129, 111, 31, 116, 115, 145, 7, 53, 94, 142, 193, 63, 58,
-    202, 135, 128, 244, 210, 129, 159, 96, 215, 200, 193, 250, 26, 125, 120, 156, 117, 222, 52, 153, 207, 228, 57, 82,
-    35, 41, 135, 229, 117, 149, 208, 190, 18, 175, 147, 59, 206, 63, 162, 151, 139, 119, 155, 105, 90, 121, 64, 80, 121,
-    74, 91, 155, 21, 84, 179, 158, 113, 148, 11, 57, 250, 223, 51, 102, 148, 148, 131, 131, 57, 158, 163, 16, 234, 90,
-    88, 227, 22, 52, 87, 171, 74, 216, 96, 241, 138, 202, 195, 13, 238, 9, 93, 104, 164, 222, 23, 96, 22, 55, 177, 17,
-    164, 137, 142, 158, 14, 106, 32, 159, 230, 78, 127, 199, 153, 35, 230, 1, 198, 13, 74, 60, 209, 94, 155, 186, 162,
-    0, 177, 202, 72, 130, 126, 215, 93, 177, 107, 49, 101, 207, 244, 100, 151, 236, 136, 246, 208, 7, 30, 110, 32, 74,
-    136, 160, 198, 74, 196, 206, 65, 76, 181, 86, 42, 13, 1, 207, 127, 187, 34, 250, 180, 198, 223, 130, 166, 166, 199,
-    32, 111, 89, 110, 148, 224, 102, 40, 128, 206, 26, 101, 65, 85, 121, 199, 27, 113, 26, 218, 12, 128, 45, 133, 253,
-    251, 138, 171, 149, 140, 72, 47, 13, 120, 182, 163, 234, 62, 65, 214, 163, 247, 251, 56, 100, 172, 32, 57, 150, 103,
-    0, 20, 255, 123, 28, 55, 96, 10, 115, 68, 182, 31, 12, 146, 134, 87, 161, 99, 190, 67, 6, 26, 70, 120, 31, 208, 85,
-    78, 5, 55, 233, 167, 104, 167, 94, 55, 221, 20, 112, 158, 24, 120, 246, 40, 201, 150, 197, 214, 247, 59, 87, 18, 24,
-    85, 162, 245, 103, 239, 58, 41, 125, 187, 202, 200, 94, 141, 80, 132, 70, 89, 133, 224, 225, 120, 84, 218, 95, 82,
-    49, 249, 219, 197, 246, 197, 98, 67, 178, 40, 210, 163, 221, 24, 222, 93, 143, 158, 84, 135, 45, 176, 233, 187, 129,
-    159, 120, 133, 164, 38, 154, 186, 130, 50, 69, 232, 112, 64, 49, 252, 230, 133, 120, 39, 13, 187, 53, 29, 253, 128,
-    64, 41, 5, 3, 245, 99, 100, 79, 113, 11, 210, 242, 19, 252, 60, 134, 25, 106, 255, 230, 193, 215, 80, 207, 248, 198,
-    78, 139, 134, 225, 139, 123, 167, 55, 216, 145, 195, 113, 171, 59, 213, 208, 254, 195, 123, 193, 170, 165, 150, 145,
-    220, 141, 66, 45, 83, 176, 215, 35, 142, 84, 225, 149, 127, 39, 137, 254, 199, 118, 164, 220, 112, 108, 205, 179,
-    34, 212, 222, 118, 111, 45, 214, 103, 232, 25, 127, 244, 165, 63, 214, 38, 29, 172, 102, 252, 15, 5, 12, 193, 149,
-    158, 62, 210, 255, 76, 105, 105, 25, 174, 20, 61, 206, 254, 110, 83, 246, 185, 175, 188, 76, 12, 34, 214, 80, 233,
-    95, 42, 101, 133, 199, 213, 215, 71, 33, 197, 154, 161, 27, 224, 24, 192, 22, 30, 239, 184, 220, 41, 122, 52, 128,
-    105, 182, 235, 226, 84, 213, 242, 235, 70, 201, 228, 57, 31, 98, 150, 215, 223, 4, 242, 24, 104, 86, 159, 49, 78,
-    77, 15, 82, 20, 70, 160, 113, 203, 56, 138, 101, 54, 100, 46, 243, 105, 10, 23, 73, 27, 254, 148, 43, 185, 30, 131,
-    89, 73, 19, 225, 44, 209, 236, 27, 172, 255, 75, 72, 112, 14, 60, 20, 72, 182, 218, 143, 14, 26, 18, 213, 169, 36,
-    113, 55, 148, 95, 215, 161, 9, 33, 66, 240, 75, 219, 64, 96, 52, 94, 206, 184, 126, 198, 102, 89, 172, 49, 233, 56,
-    69, 25, 249, 215, 44, 207, 52, 172, 96, 180, 35, 238, 78, 39, 16, 67, 232, 43, 58, 141, 255, 39, 11, 201, 109, 50,
-    244, 235, 134, 175, 10, 208, 232, 93, 236, 210, 59, 39, 150, 40, 57, 37, 192, 234, 108, 142, 165, 183, 170, 207,
-    142, 25, 126, 140, 105, 26, 51, 203, 218, 162, 228, 157, 186, 177, 171, 220, 172, 58, 239, 123, 96, 98, 114, 220,
-    175, 17, 233, 195, 163, 232, 205, 62, 4, 117, 228, 246, 217, 83, 239, 166, 34, 154, 180, 27, 175, 112, 135, 56, 102,
-    206, 192, 4, 123, 234, 2, 93, 242, 135, 114, 87, 84, 97, 59, 38, 186, 102, 122, 223, 79, 31, 93, 200, 175, 152, 169,
-    199, 197, 74, 83, 57, 123, 71, 208, 208, 170, 10, 25, 205, 13, 48, 213, 121, 198, 142, 6, 58, 173, 106, 137, 68,
-    157, 151, 8, 121, 243, 17, 194, 42, 20, 80, 173, 251, 87, 160, 67, 224, 129, 0, 16, 165, 161, 202, 229, 22, 129, 4,
-    34, 206, 227, 158, 253, 68, 109, 141, 66, 135, 11, 193, 231, 244, 58, 6, 251, 106, 171, 193, 109, 41, 251, 80, 250,
-    114, 37, 111, 191, 139, 98, 180, 94, 243, 146, 50, 218, 184, 182, 133, 77, 104, 24, 181, 77, 126, 110, 209, 3, 33,
-    21, 77, 96, 238, 180, 199, 212, 234, 33, 33, 86, 31, 182, 66, 2, 33, 252, 190, 143, 254, 117, 102, 168, 131, 60,
-    200, 11, 174, 90, 127, 64, 14, 152, 101, 133, 128, 1, 85, 31, 232, 35, 56, 112, 47, 184, 139, 51, 134, 48, 37, 143,
-    4, 93, 223, 11, 51, 96, 120, 124, 42, 190, 113, 86, 171, 107, 144, 21, 176, 248, 244, 52, 43, 35, 101, 105, 46, 30,
-    105, 70, 142, 2, 33, 34, 16, 46, 12, 6, 21, 233, 38, 33, 156, 96, 13, 160, 32, 76, 44, 191, 229, 101, 61, 168, 155,
-    235, 34, 14, 110, 179, 71, 48, 114, 215, 63, 102, 108, 104, 211, 85, 130, 106, 101, 170, 98, 36, 109, 204, 171, 117,
-    134, 145, 79, 207, 127, 110, 72, 79, 193, 193, 171, 41, 143, 134, 121, 255, 244, 134, 43, 123, 65, 67, 23, 182, 124,
-    253, 32, 233, 182, 187, 247, 43, 68, 115, 178, 235, 241, 71, 211, 2, 52, 205, 52, 47, 193, 120, 172, 165, 173, 111,
-    249, 129, 16, 191, 233, 212, 235, 95, 3, 110, 246, 68, 147, 220, 173, 17, 89, 251, 181, 160, 160, 235, 0, 185, 248,
-    192, 120, 130, 171, 71, 159, 27, 86, 20, 177, 192, 189, 158, 133, 135, 97, 98, 45, 91, 146, 138, 160, 146, 21, 100,
-    206, 240, 16, 217, 132, 136, 176, 254, 70, 148, 55, 129, 232, 98, 24, 69, 37, 230, 200, 196, 89, 35, 61, 99, 109,
-    69, 163, 154, 219, 215, 101, 8, 230, 83, 236, 37, 178, 22, 157, 86, 91, 47, 243, 127, 38, 190, 153, 227, 202, 148,
-    10, 209, 7, 80, 132, 68, 114, 11, 39, 148, 141, 182, 252, 202, 173, 218, 177, 238, 207, 125, 36, 245, 220, 75, 176,
-    125, 40, 32, 246, 112, 100, 24, 144, 165, 73, 49, 120, 218, 145, 48, 173, 224, 173, 196, 29, 127, 170, 141, 100, 59,
-    180, 210, 230, 137, 97, 117, 204, 156, 82, 50, 229, 9, 248, 47, 141, 214, 155, 11, 21, 60, 92, 187, 158, 174, 143,
-    202, 231, 238, 126, 18, 108, 79, 214, 139, 122, 209, 158, 72, 56, 145, 126, 246, 85, 168, 30, 39, 46, 77, 250, 233,
-    38, 56, 14, 96, 231, 67, 108, 40, 191, 232, 60, 86, 97, 97, 24, 213, 108, 41, 25, 63, 210, 166, 40, 51, 85, 161,
-    141, 213, 190, 192, 100, 31, 161, 165, 98, 235, 145, 20, 49, 31, 236, 97, 199, 93, 44, 22, 68, 220, 111, 216, 177,
-    210, 191, 94, 202, 96, 17, 224, 95, 115, 75, 221, 223, 18, 22, 127, 135, 27, 146, 117, 70, 176, 163, 50, 16, 213,
-    90, 235, 61, 37, 101, 152, 162, 219, 82, 159, 175, 26, 106, 251, 164, 78, 158, 48, 48, 147, 99, 63, 12, 148, 71,
-    117, 65, 110, 167, 44, 15, 78, 10, 140, 128, 138, 184, 17, 224, 0, 20, 211, 64, 71, 61, 53, 203, 227, 188, 93, 218,
-    96, 20, 85, 197, 86, 52, 27, 16, 240, 120, 169, 145, 47, 186, 160, 139, 148, 175, 210, 48, 154, 246, 244, 94, 24,
-    220, 205, 107, 14, 186, 63, 170, 254, 196, 145, 146, 110, 36, 78, 171, 9, 34, 198, 55, 250, 62, 164, 80, 42, 158,
-    69, 14, 36, 83, 159, 24, 128, 43, 150, 49, 53, 88, 140, 174, 87, 134, 213, 217, 61, 214, 104, 147, 190, 38, 61, 116,
-    239, 160, 4, 49, 130, 194, 90, 249, 136, 162, 134, 36, 7, 222, 101, 138, 93, 216, 4, 138, 49, 119, 28, 174, 151,
-    207, 16, 190, 144, 39, 173, 162, 173, 112, 35, 97, 201, 149, 114, 243, 26, 201, 51, 88, 51, 175, 20, 162, 139, 87,
-    99, 153, 179, 238, 173, 96, 234, 171, 217, 145, 252, 128, 248, 189, 102, 228, 133, 94, 108, 85, 185, 213, 148, 146,
-    72, 157, 64, 39, 141, 253, 61, 61, 152, 95, 175, 108, 74, 92, 234, 14, 217, 141, 134, 208, 197, 130, 29, 111, 32,
-    198, 202, 207, 204, 159, 48, 243, 140, 255, 145, 187, 171, 239, 15, 131, 187, 153, 126, 49, 30, 22, 105, 23, 14, 23,
-    141, 185, 75, 15, 202, 183, 231, 129, 85, 201, 104, 47, 242, 120, 235, 73, 202, 118, 156, 154, 84, 153, 61, 229,
-    228, 48, 133, 18, 85, 230, 97, 87, 129, 44, 108, 226, 182, 144, 30, 70, 131, 188, 125, 62, 89, 250, 14, 82, 41, 217,
-    214, 90, 178, 152, 63, 170, 238, 24, 188, 6, 215, 187, 132, 236, 156, 230, 118, 2, 47, 19, 237, 176, 6, 209, 65,
-    229, 35, 145, 38, 17, 245, 149, 74, 224, 34, 112, 31, 197, 72, 154, 96, 114, 209, 226, 138, 101, 144, 115, 134, 105,
-    36, 154, 237, 161, 186, 83, 73, 24, 167, 104, 114, 207, 208, 178, 228, 147, 119, 93, 158, 70, 161, 129, 39, 161,
-    217, 220, 111, 166, 57, 131, 239, 254, 121, 98, 132, 19, 122, 119, 35, 81, 20, 7, 184, 124, 225, 136, 103, 164, 164,
-    32, 64, 9, 183, 78, 144, 111, 241, 217, 187, 176, 54, 127, 168, 45, 93, 1, 237, 144, 193, 180, 219, 114, 7, 124, 0,
-    60, 197, 150, 230, 146, 96, 48, 112, 135, 178, 238, 135, 115, 195, 15, 148, 156, 19, 102, 90, 138, 82, 152, 174,
-    197, 89, 83, 31, 242, 218, 247, 81, 250, 248, 134, 143, 38, 245, 62, 80, 58, 165, 215, 74, 240, 217, 141, 157, 253,
-    187, 187, 3, 220, 21, 64, 104, 246, 170, 195, 121, 150, 1, 7, 14, 139, 114, 64, 108, 15, 15, 86, 233, 148, 177, 151,
-    192, 197, 49, 223, 117, 201, 33, 101, 138, 237, 176, 182, 43, 252, 122, 130, 225, 29, 68, 165, 28, 153, 227, 176,
-    68, 144, 92, 31, 3, 144, 48, 200, 34, 56, 194, 241, 114, 49, 84, 121, 194, 148, 129, 109, 204, 109, 54, 55, 61, 154,
-    113, 249, 143, 68, 101, 243, 189, 51, 109, 76, 200, 241, 19, 236, 169, 213, 73, 91, 152, 61, 242, 159, 122, 239, 97,
-    134, 3, 69, 145, 14, 228, 65, 177, 209, 75, 167, 22, 39, 203, 106, 230, 207, 106, 111, 79, 138, 240, 209, 1, 196,
-    91, 180, 16, 146, 203, 17, 153, 17, 168, 135, 238, 138, 170, 160, 88, 72, 165, 47, 31, 87, 90, 233, 152, 58, 207,
-    28, 195, 64, 126, 172, 14, 173, 15, 54, 79, 142, 159, 61, 237, 24, 119, 83, 223, 225, 174, 74, 88, 89, 131, 6, 95,
-    17, 197, 174, 173, 188, 147, 71, 86, 185, 165, 186, 48, 159, 227, 89, 94, 198, 113, 74, 145, 99, 137, 190, 244, 133,
-    62, 171, 246, 192, 12, 16, 34, 208, 211, 208, 136, 168, 208, 109, 54, 44, 223, 104, 127, 42, 59, 42, 35, 234, 55,
-    43, 230, 237, 191, 209, 65, 0, 127, 250, 3, 174, 71, 13, 14, 58, 148, 116, 40, 98, 170, 10, 115, 211, 244, 33, 216,
-    156, 154, 199, 14, 235, 147, 207, 168, 75, 73, 4, 168, 226, 248, 160, 133, 91, 11, 0, 198, 179, 151, 16, 45, 134,
-    120, 96, 121, 58, 111, 147, 83, 68, 11, 46, 226, 185, 234, 229, 91, 77, 113, 240, 147, 201, 156, 67, 11, 118, 46,
-    66, 41, 87, 213, 95, 153, 106, 108, 247, 105, 197, 20, 63, 59, 58, 126, 9, 86, 150, 151, 163, 222, 136, 170, 67, 35,
-    98, 26, 188, 246, 183, 99, 90, 12, 155, 194, 191, 166, 204, 40, 125, 255, 26, 162, 116, 234, 176, 178, 54, 163, 254,
-    192, 211, 191, 18, 61, 39, 126, 76, 228, 10, 80, 147, 33, 149, 218, 85, 113, 65, 184, 246, 1, 27, 9, 138, 61, 149,
-    210, 185, 152, 35, 160, 95, 196, 216, 103, 194, 13, 94, 157, 47, 207, 125, 144, 190, 93, 84, 217, 115, 32, 13, 192,
-    8, 144, 45, 192, 88, 136, 160, 228, 151, 170, 95, 220, 30, 123, 7, 74, 3, 201, 190, 105, 238, 105, 6, 164, 2, 158,
-    35, 67, 230, 72, 1, 232, 241, 156, 127, 165, 173, 37, 112, 63, 14, 128, 248, 114, 98, 113, 226, 42, 62, 165, 72,
-    113, 30, 24, 15, 23, 144, 245, 200, 24, 29, 6, 209, 251, 145, 243, 38, 83, 192, 175, 96, 250, 193, 243, 190, 164,
-    209, 43, 136, 159, 216, 25, 57, 85, 147, 93, 67, 29, 189, 40, 124, 38, 25, 133, 79, 131, 80, 122, 37, 164, 74, 123,
-    223, 147, 64, 69, 23, 108, 151, 147, 182, 29, 209, 123, 201, 177, 233, 122, 51, 143, 232, 191, 23, 89, 32, 185, 158,
-    2, 237, 66, 81, 165, 24, 43, 24, 199, 245, 246, 185, 147, 245, 52, 185, 53, 109, 161, 252, 32, 35, 154, 113, 32, 12,
-    51, 216, 216, 103, 231, 80, 235, 39, 85, 69, 203, 244, 199, 86, 92, 51, 249, 40, 206, 213, 192, 91, 144, 28, 164,
-    55, 219, 77, 222, 192, 141, 153, 124, 81, 43, 201, 248, 178, 200, 17, 6, 149, 195, 47, 18, 251, 211, 247, 205, 247,
-    106, 132, 228, 97, 206, 158, 143, 37, 242, 242, 166, 168, 113, 235, 254, 161, 126, 208, 34, 149, 27, 254, 54, 164,
-    103, 141, 238, 50, 6, 202, 100, 180, 175, 132, 98, 7, 127, 97, 27, 49, 244, 230, 61, 20, 143, 241, 218, 171, 156,
-    254, 159, 218, 200, 181, 147, 209, 105, 205, 135, 204, 32, 40, 25, 158, 146, 131, 233, 107, 205, 39, 232, 7, 22,
-    170, 175, 48, 111, 210, 191, 242, 143, 215, 163, 57, 150, 39, 195, 73, 193, 60, 87, 71, 34, 29, 97, 247, 245, 234,
-    141, 13, 218, 63, 15, 218, 185, 65, 55, 30, 235, 120, 69, 250, 230, 85, 83, 86, 89, 163, 246, 31, 198, 56, 208, 17,
-    114, 10, 214, 1, 227, 60, 20, 198, 40, 118, 67, 21, 46, 150, 231, 170, 12, 219, 53, 173, 11, 80, 174, 178, 130, 245,
-    222, 147, 31, 163, 95, 21, 176, 164, 100, 91, 161, 20, 14, 117, 36, 159, 161, 191, 214, 118, 31, 130, 122, 131, 145,
-    8, 182, 161, 24, 230, 64, 97, 151, 30, 105, 92, 216, 28, 153, 136, 100, 102, 131, 225, 61, 88, 190, 178, 151, 143,
-    240, 245, 45, 74, 1, 196, 131, 135, 35, 4, 114, 36, 239, 89, 160, 133, 124, 80, 24, 103, 60, 66, 135, 238, 8, 153,
-    205, 168, 228, 108, 41, 90, 233, 97, 168, 63, 128, 172, 211, 253, 47, 90, 206, 147, 204, 238, 156, 123, 224, 153,
-    45, 162, 167, 48, 82, 133, 113, 2, 120, 31, 93, 180, 222, 116, 21, 64, 157, 158, 112, 36, 179, 210, 54, 28, 49, 194,
-    221, 135, 153, 5, 70, 218, 26, 151, 192, 187, 99, 164, 217, 144, 145, 199, 225, 147, 59, 58, 55, 139, 38, 83, 255,
-    6, 226, 168, 236, 176, 17, 94, 186, 48, 59, 58, 156, 163, 150, 226, 117, 188, 55, 182, 174, 66, 36, 103, 91, 41,
-    148, 174, 68, 28, 212, 113, 161, 24, 246, 114, 206, 33, 249, 73, 24, 157, 234, 174, 239, 175, 175, 66, 168, 51, 210,
-    168, 52, 205, 125, 11, 101, 111, 131, 154, 37, 207, 208, 77, 166, 142, 157, 241, 239, 196, 109, 165, 139, 51, 18,
-    82, 58, 240, 58, 77, 242, 191, 137, 92, 63, 129, 161, 135, 17, 255, 73, 125, 140, 239, 23, 199, 8, 198, 250, 25, 31,
-    145, 7, 126, 218, 64, 61, 6, 28, 38, 217, 88, 5, 0, 68, 207, 171, 29, 60, 182, 248, 20, 57, 164, 196, 228, 98, 191,
-    101, 229, 246, 52, 157, 185, 183, 202, 176, 89, 8, 7, 84, 74, 180, 12, 97, 255, 10, 218, 148, 97, 164, 91, 143, 220,
-    97, 28, 145, 76, 51, 242, 187, 230, 168, 131, 230, 162, 133, 230, 249, 193, 111, 202, 49, 21, 96, 95, 245, 82, 22,
-    12, 61, 212, 222, 18, 167, 230, 77, 127, 138, 125, 20, 159, 243, 56, 252, 39, 142, 62, 204, 190, 213, 8, 113, 30, 8,
-    197, 61, 55, 40, 106, 190, 209, 51, 179, 108, 45, 55, 197, 207, 190, 34, 14, 24, 24, 86, 35, 35, 248, 64, 13, 23,
-    18, 73, 174, 231, 122, 193, 43, 202, 10, 1, 21, 171, 81, 30, 30, 236, 117, 193, 202, 210, 250, 108, 23, 150, 178,
-    39, 216, 203, 18, 107, 32, 27, 117, 155, 220, 114, 184, 133, 183, 199, 206, 23, 180, 134, 219, 89, 53, 61, 137, 101,
-    104, 135, 119, 141, 51, 139, 136, 84, 141, 22, 131, 154, 169, 243, 240, 139, 40, 31, 99, 7, 173, 110, 86, 153, 109,
-    112, 146, 89, 50, 200, 146, 223, 167, 146, 255, 156, 236, 8, 23, 0, 119, 76, 53, 205, 111, 228, 110, 123, 224, 31,
-    224, 209, 23, 92, 191, 52, 106, 107, 183, 119, 58, 139, 190, 251, 251, 181, 110, 125, 92, 37, 242, 150, 195, 70,
-    154, 160, 14, 74, 138, 233, 95, 175, 227, 196, 206, 66, 121, 89, 48, 28, 217, 72, 0, 85, 117, 133, 197, 185, 214,
-    175, 201, 59, 84, 185, 223, 199, 44, 33, 95, 0, 167, 187, 16, 221, 114, 48, 13, 158, 198, 67, 90, 57, 20, 140, 199,
-    146, 180, 249, 20, 218, 205, 246, 69, 106, 212, 159, 62, 242, 201, 135, 130, 237, 1, 207, 183, 31, 23, 54, 128, 201,
-    109, 122, 1, 135, 164, 83, 121, 128, 147, 52, 131, 166, 152, 214, 145, 53, 87, 104, 112, 69, 18, 247, 162, 122, 191,
-    110, 210, 27, 54, 114, 169, 196, 228, 90, 80, 251, 254, 17, 54, 11, 6, 109, 96, 197, 108, 8, 150, 178, 215, 142, 47,
-    231, 91, 31, 202, 194, 234, 27, 49, 163, 224, 207, 252, 19, 222, 26, 25, 70, 43, 6, 80, 134, 68, 199, 168, 142, 244,
-    141, 62, 212, 164, 219, 25, 28, 141, 254, 112, 105, 236, 143, 241, 121, 32, 17, 148, 180, 72, 2, 175, 147, 84, 173,
-    116, 114, 97, 180, 57, 242, 2, 84, 174, 249, 93, 22, 102, 229, 51, 49, 85, 14, 58, 186, 49, 26, 86, 122, 144, 141,
-    159, 174, 197, 103, 157, 146, 148, 164, 244, 176, 16, 229, 207, 194, 238, 184, 136, 95, 251, 121, 42, 22, 189, 239,
-    96, 115, 116, 7, 53, 180, 46, 60, 137, 84, 105, 176, 61, 221, 117, 42, 111, 76, 209, 77, 118, 127, 10, 169, 237,
-    132, 49, 123, 51, 118, 206, 14, 85, 116, 173, 30, 168, 115, 46, 65, 179, 157, 205, 183, 223, 196, 154, 197, 33, 216,
-    74, 48, 48, 229, 152, 209, 107, 5, 207, 204, 254, 203, 132, 176, 79, 132, 251, 54, 19, 242, 20, 69, 209, 151, 155,
-    1, 184, 67, 14, 160, 133, 193, 110, 38, 93, 126, 0, 134, 6, 50, 122, 81, 203, 226, 131, 10, 128, 89, 42, 192, 132,
-    158, 171, 123, 191, 113, 129, 60, 148, 183, 69, 191, 231, 89, 71, 42, 252, 254, 236, 16, 71, 124, 231, 84, 148, 179,
-    237, 188, 89, 17, 143, 6, 95, 223, 4, 66, 104, 91, 20, 36, 80, 125, 0, 0, 253, 193, 195, 182, 56, 132, 80, 199, 187,
-    152, 190, 156, 2, 47, 40, 71, 100, 168, 113, 82, 188, 117, 241, 211, 182, 235, 186, 249, 207, 18, 140, 188, 157,
-    190, 76, 76, 110, 184, 126, 68, 39, 74, 187, 120, 37, 121, 210, 191, 190, 34, 250, 248, 115, 60, 47, 1, 175, 154,
-    195, 63, 43, 69, 22, 219, 95, 186, 217, 70, 85, 137, 174, 26, 33, 94, 94, 124, 5, 109, 126, 214, 238, 12, 1, 230,
-    107, 70, 65, 156, 97, 147, 29, 230, 226, 83, 244, 226, 47, 10, 62, 76, 73, 248, 182, 136, 245, 47, 238, 252, 229,
-    99, 152, 164, 160, 241, 109, 249, 126, 70, 76, 52, 112, 203, 20, 200, 220, 88, 3, 244, 183, 250, 238, 217, 84, 206,
-    165, 126, 92, 132, 113, 30, 7, 235, 164, 194, 164, 63, 189, 27, 158, 193, 159, 163, 200, 123, 221, 48, 90, 80, 230,
-    219, 119, 86, 104, 10, 160, 251, 162, 23, 213, 133, 66, 122, 233, 68, 68, 95, 0, 97, 136, 66, 88, 96, 212, 253, 122,
-    93, 235, 246, 161, 128, 68, 41, 205, 178, 244, 234, 215, 47, 38, 48, 101, 189, 248, 229, 242, 255, 117, 159, 233,
-    172, 170, 124, 166, 134, 82, 103, 227, 83, 106, 237, 190, 190, 246, 170, 84, 64, 57, 205, 141, 176, 133, 49, 1, 50,
-    49, 29, 36, 47, 103, 99, 30, 122, 113, 134, 170, 48, 134, 211, 78, 205, 81, 0, 253, 244, 6, 83, 240, 86, 96, 80,
-    178, 52, 159, 237, 181, 203, 35, 44, 28, 33, 204, 28, 238, 144, 223, 87, 225, 54, 163, 83, 115, 94, 4, 216, 201,
-    254, 26, 115, 54, 28, 155, 232, 56, 68, 68, 202, 69, 23, 190, 69, 28, 10, 236, 155, 202, 29, 87, 207, 230, 8, 183,
-    121, 239, 6, 192, 111, 207, 240, 226, 192, 122, 32, 215, 70, 67, 89, 20, 135, 38, 16, 67, 67, 228, 179, 182, 230,
-    36, 227, 198, 122, 67, 107, 183, 163, 197, 148, 9, 21, 127, 177, 55, 23, 127, 186, 3, 109, 165, 29, 142, 204, 185,
-    130, 229, 120, 239, 99, 145, 108, 177, 152, 17, 195, 254, 144, 75, 203, 209, 239, 75, 165, 218, 166, 77, 47, 140,
-    192, 15, 83, 150, 101, 130, 16, 234, 24, 255, 188, 108, 237, 179, 100, 204, 62, 148, 211, 227, 223, 77, 59, 51, 19,
-    181, 36, 44, 30, 109, 137, 242, 218, 220, 21, 44, 99, 200, 92, 204, 10, 63, 44, 82, 50, 72, 51, 222, 15, 117, 108,
-    85, 226, 121, 218, 148, 3, 147, 150, 45, 140, 251, 74, 10, 216, 49, 237, 217, 246, 224, 222, 21, 161, 180, 223, 18,
-    169, 4, 230, 16, 219, 206, 232, 76, 22, 132, 3, 217, 174, 49, 161, 0, 29, 192, 72, 122, 136, 190, 98, 236, 123, 237,
-    67, 89, 182, 145, 152, 109, 153, 38, 231, 63, 223, 244, 147, 145, 100, 78, 55, 78, 216, 145, 182, 80, 229, 147, 81,
-    157, 90, 204, 137, 75, 217, 130, 141, 91, 51, 13, 25, 231, 209, 66, 245, 200, 192, 149, 46, 21, 185, 10, 164, 41,
-    204, 200, 235, 91, 45, 81, 60, 104, 6, 116, 162, 180, 221, 233, 38, 99, 93, 20, 5, 82, 9, 173, 110, 90, 128, 59, 68,
-    83, 115, 145, 89, 150, 24, 34, 131, 169, 131, 47, 235, 90, 219, 21, 162, 232, 177, 33, 93, 196, 49, 192, 113, 147,
-    24, 75, 38, 75, 129, 162, 174, 27, 27, 203, 85, 6, 99, 67, 160, 138, 200, 97, 149, 120, 209, 162, 51, 53, 84, 110,
-    49, 171, 109, 80, 116, 68, 11, 55, 224, 46, 196, 163, 212, 70, 184, 63, 8, 181, 255, 39, 176, 19, 70, 199, 6, 219,
-    103, 31, 171, 57, 37, 218, 75, 234, 19, 176, 112, 222, 138, 48, 63, 189, 34, 50, 91, 255, 202, 66, 213, 178, 170,
-    38, 22, 58, 162, 8, 6, 248, 56, 39, 2, 157, 74, 177, 254, 202, 59, 149, 137, 31, 97, 53, 17, 132, 133, 100, 138,
-    118, 147, 94, 214, 145, 27, 101, 202, 221, 123, 221, 106, 50, 245, 165, 181, 8, 149, 201, 131, 128, 233, 41, 103,
-    183, 42, 15, 243, 60, 33, 17, 83, 57, 218, 37, 3, 135, 45, 104, 20, 188, 53, 168, 165, 227, 172, 95, 212, 38, 67,
-    72, 111, 28, 19, 76, 111, 6, 47, 66, 109, 184, 108, 60, 85, 24, 17, 190, 239, 44, 141, 86, 105, 206, 241, 250, 224,
-    59, 49, 191, 150, 115, 65, 120, 72, 199, 98, 92, 242, 72, 166, 225, 61, 46, 149, 80, 168, 4, 115, 165, 217, 134,
-    158, 153, 115, 96, 163, 248, 127, 246, 183, 134, 238, 157, 108, 122, 61, 0, 52, 251, 130, 38, 178, 156, 77, 224,
-    146, 88, 176, 214, 18, 237, 222, 12, 191, 215, 186, 87, 109, 246, 16, 40, 77, 165, 64, 248, 40, 44, 33, 207, 80, 1,
-    21, 221, 59, 55, 57, 252, 242, 36, 234, 124, 127, 82, 66, 167, 2, 95, 129, 32, 5, 1, 111, 149, 252, 80, 210, 194,
-    199, 23, 35, 68, 112, 154, 195, 26, 126, 17, 71, 153, 0, 116, 172, 48, 246, 47, 74, 175, 105, 250, 139, 230, 70, 42,
-    185, 112, 25, 227, 58, 69, 199, 249, 20, 183, 160, 187, 183, 192, 53, 213, 113, 15, 150, 129, 89, 165, 150, 23, 37,
-    229, 112, 212, 37, 133, 68, 42, 182, 95, 64, 174, 213, 140, 208, 95, 49, 106, 157, 163, 169, 66, 172, 26, 89, 64,
-    164, 156, 114, 185, 103, 53, 91, 97, 64, 207, 236, 129, 54, 177, 15, 131, 31, 170, 173, 74, 186, 154, 192, 232, 94,
-    155, 6, 196, 193, 234, 237, 206, 154, 205, 94, 137, 92, 156, 30, 3, 211, 177, 63, 188, 117, 103, 205, 74, 219, 82,
-    209, 121, 118, 27, 148, 76, 194, 198, 132, 42, 47, 81, 167, 190, 229, 191, 19, 151, 79, 52, 222, 175, 137, 177, 181,
-    134, 129, 206, 190, 121, 233, 212, 110, 85, 236, 111, 116, 87, 214, 105, 38, 178, 140, 13, 34, 169, 130, 205, 104,
-    56, 5, 56, 54, 22, 251, 176, 123, 254, 23, 197, 198, 234, 255, 253, 95, 177, 64, 33, 92, 11, 96, 214, 205, 19, 47,
-    90, 47, 126, 212, 119, 20, 220, 181, 45, 118, 23, 187, 62, 69, 230, 213, 238, 68, 213, 185, 203, 117, 125, 47, 165,
-    165, 5, 231, 53, 167, 173, 7, 122, 162, 181, 99, 249, 219, 189, 224, 204, 45, 197, 168, 233, 80, 222, 194, 213, 40,
-    73, 50, 21, 118, 9, 180, 67, 98, 110, 183, 39, 226, 137, 97, 173, 217, 152, 54, 3, 159, 58, 164, 174, 193, 140, 30,
-    48, 153, 177, 190, 165, 136, 248, 133, 226, 55, 55, 234, 223, 227, 63, 160, 223, 161, 169, 15, 113, 120, 232, 207,
-    100, 90, 94, 187, 233, 13, 7, 240, 42, 41, 204, 226, 193, 83, 254, 20, 164, 243, 175, 149, 94, 115, 188, 191, 156,
-    205, 230, 232, 179, 79, 0, 42, 144, 165, 45, 33, 188, 191, 219, 147, 250, 136, 214, 87, 41, 207, 173, 9, 196, 120,
-    228, 59, 215, 19, 104, 242, 29, 140, 186, 17, 70, 50, 184, 241, 94, 193, 222, 168, 187, 26, 13, 204, 10, 66, 46, 92,
-    2, 208, 247, 131, 245, 231, 209, 219, 89, 127, 81, 128, 31, 7, 207, 51, 12, 65, 78, 109, 107, 182, 165, 189, 133,
-    247, 70, 167, 33, 229, 235, 131, 35, 216, 251, 209, 216, 150, 251, 138, 11, 199, 155, 17, 58, 13, 100, 109, 121,
-    175, 235, 118, 114, 135, 171, 72, 8, 46, 62, 72, 80, 109, 89, 207, 160, 67, 200, 43, 147, 111, 53, 133, 250, 183,
-    35, 208, 155, 152, 41, 230, 145, 160, 235, 236, 4, 33, 146, 177, 49, 36, 231, 105, 193, 17, 36, 209, 95, 43, 94,
-    169, 188, 62, 245, 80, 215, 60, 113, 40, 3, 197, 191, 101, 70, 102, 59, 76, 122, 160, 29, 76, 188, 249, 203, 65,
-    238, 54, 118, 235, 145, 85, 168, 213, 191, 80, 29, 14, 253, 50, 170, 143, 17, 77, 136, 125, 82, 240, 13, 93, 3, 176,
-    121, 228, 220, 232, 202, 176, 160, 154, 199, 237, 150, 121, 219, 120, 216, 106, 159, 119, 62, 92, 62, 230, 214, 254,
-    167, 126, 18, 138, 169, 85, 6, 97, 238, 115, 97, 63, 105, 243, 148, 165, 100, 98, 59, 138, 79, 87, 173, 143, 160,
-    217, 198, 88, 14, 165, 220, 137, 208, 86, 22, 171, 145, 79, 241, 4, 218, 45, 178, 32, 171, 45, 241, 240, 11, 31,
-    210, 67, 118, 187, 233, 204, 95, 186, 134, 1, 57, 115, 143, 47, 23, 35, 225, 188, 44, 124, 65, 206, 92, 254, 168,
-    73, 57, 45, 108, 254, 87, 188, 139, 211, 182, 228, 196, 95, 90, 45, 240, 42, 217, 18, 252, 35, 239, 212, 19, 63,
-    120, 50, 141, 206, 5, 165, 39, 235, 3, 228, 104, 100, 172, 242, 158, 56, 79, 40, 144, 184, 252, 182, 73, 244, 141,
-    130, 171, 81, 74, 203, 120, 113, 153, 49, 42, 244, 214, 25, 167, 14, 253, 232, 116, 76, 176, 213, 92, 138, 114, 221,
-    194, 46, 250, 18, 138, 249, 145, 244, 13, 144, 79, 87, 214, 216, 90, 210, 129, 22, 232, 55, 77, 14, 192, 188, 253,
-    79, 151, 39, 59, 42, 240, 7, 74, 204, 224, 92, 150, 211, 45, 9, 114, 66, 101, 27, 92, 165, 42, 186, 235, 138, 111,
-    90, 77, 162, 157, 75, 18, 143, 225, 132, 131, 20, 88, 126, 13, 131, 186, 183, 215, 204, 241, 84, 233, 27, 213, 248,
-    138, 89, 55, 174, 71, 19, 212, 226, 246, 88, 211, 254, 219, 148, 198, 74, 86, 94, 220, 197, 177, 92, 237, 191, 220,
-    196, 152, 74, 135, 195, 159, 27, 111, 53, 140, 46, 188, 57, 230, 44, 4, 68, 186, 217, 151, 154, 179, 49, 151, 44,
-    241, 93, 0, 141, 218, 11, 142, 138, 239, 181, 156, 171, 246, 181, 5, 93, 27, 139, 170, 43, 217, 69, 124, 128, 155,
-    235, 225, 150, 129, 34, 110, 31, 226, 88, 173, 36, 129, 180, 132, 16, 126, 25, 203, 4, 163, 182, 122, 99, 209, 227,
-    186, 140, 24, 54, 8, 172, 250, 199, 188, 163, 201, 224, 116, 95, 37, 218, 207, 216, 80, 145, 87, 161, 53, 32, 160,
-    0, 157, 250, 25, 225, 195, 191, 208, 35, 174, 216, 226, 74, 137, 60, 44, 54, 21, 185, 220, 138, 98, 60, 192, 128,
-    147, 228, 56, 240, 120, 121, 173, 178, 159, 201, 197, 63, 188, 247, 197, 108, 189, 40, 63, 249, 80, 209, 67, 130,
-    48, 148, 185, 198, 220, 61, 37, 130, 219, 112, 185, 142, 163, 245, 207, 206, 68, 198, 200, 81, 245, 84, 23, 9, 226,
-    184, 98, 79, 128, 131, 176, 250, 228, 197, 19, 20, 36, 252, 189, 138, 140, 165, 37, 22, 9, 103, 36, 146, 161, 231,
-    68, 52, 111, 68, 91, 164, 101, 17, 23, 77, 21, 95, 42, 134, 119, 123, 248, 132, 48, 7, 238, 210, 4, 55, 201, 240,
-    23, 9, 108, 234, 99, 74, 96, 67, 118, 220, 47, 123, 143, 68, 67, 133, 91, 174, 62, 199, 181, 229, 33, 114, 125, 240,
-    172, 141, 92, 18, 68, 35, 226, 5, 252, 74, 255, 162, 169, 57, 29, 11, 138, 251, 16, 135, 9, 193, 218, 241, 203, 67,
-    122, 136, 58, 8, 138, 109, 98, 252, 19, 188, 150, 6, 17, 100, 1, 65, 138, 50, 51, 170, 22, 132, 8, 240, 59, 29, 70,
-    151, 63, 241, 133, 166, 111, 203, 189, 144, 82, 199, 128, 8, 60, 72, 46, 6, 206, 51, 113, 74, 16, 50, 254, 85, 11,
-    152, 145, 3, 25, 239, 242, 18, 16, 230, 142, 42, 44, 20, 115, 55, 67, 128, 25, 22, 4, 71, 0, 61, 177, 203, 215, 118,
-    86, 190, 150, 241, 137, 39, 60, 136, 83, 29, 248, 197, 215, 131, 193, 200, 127, 144, 245, 227, 29, 92, 91, 79, 22,
-    54, 31, 137, 178, 175, 249, 149, 68, 68, 20, 120, 106, 106, 80, 2, 96, 36, 220, 187, 190, 224, 249, 56, 186, 246,
-    12, 227, 215, 33, 12, 31, 227, 62, 151, 207, 148, 55, 235, 180, 149, 250, 152, 197, 233, 112, 180, 47, 40, 115, 24,
-    224, 49, 8, 21, 122, 187, 251, 220, 40, 227, 179, 151, 95, 227, 20, 238, 125, 117, 193, 2, 153, 100, 181, 15, 225,
-    156, 156, 20, 124, 58, 182, 163, 21, 173, 253, 235, 105, 143, 191, 195, 69, 109, 234, 13, 163, 29, 184, 43, 186,
-    131, 53, 160, 49, 125, 202, 84, 55, 130, 191, 3, 218, 27, 58, 0, 197, 143, 191, 8, 106, 236, 236, 62, 249, 57, 121,
-    10, 152, 151, 167, 237, 106, 187, 193, 247, 76, 128, 222, 56, 121, 191, 58, 172, 171, 234, 235, 76, 138, 226, 113,
-    221, 58, 212, 60, 115, 184, 182, 187, 50, 255, 52, 204, 115, 44, 146, 74, 74, 43, 148, 109, 194, 25, 210, 56, 234,
-    42, 245, 112, 33, 18, 1, 141, 194, 188, 57, 66, 188, 121, 2, 105, 10, 244, 99, 156, 40, 195, 167, 38, 59, 67, 19,
-    188, 162, 94, 130, 164, 53, 184, 75, 58, 6, 82, 98, 253, 116, 27, 213, 62, 252, 240, 47, 50, 224, 47, 204, 139, 48,
-    78, 82, 219, 74, 46, 35, 131, 84, 113, 211, 209, 106, 30, 43, 182, 100, 131, 89, 254, 75, 240, 11, 90, 143, 17, 118,
-    18, 177, 189, 241, 82, 125, 169, 93, 108, 53, 4, 28, 201, 244, 37, 175, 118, 88, 156, 25, 85, 35, 164, 199, 22, 152,
-    102, 252, 19, 172, 106, 5, 96, 135, 51, 27, 208, 146, 177, 21, 171, 46, 107, 81, 151, 215, 95, 153, 80, 61, 49, 60,
-    69, 171, 185, 58, 75, 92, 186, 194, 162, 227, 162, 171, 68, 155, 30, 24, 191, 2, 109, 135, 25, 126, 16, 185, 0, 245,
-    12, 6, 59, 241, 51, 188, 147, 93, 167, 163, 148, 142, 126, 212, 225, 0, 124, 77, 7, 193, 228, 140, 222, 70, 173, 80,
-    214, 79, 78, 103, 33, 207, 194, 175, 168, 58, 44, 121, 249, 108, 230, 51, 166, 1, 190, 20, 20, 197, 43, 29, 144,
-    158, 213, 87, 124, 163, 43, 225, 159, 221, 242, 47, 77, 234, 97, 248, 215, 96, 174, 230, 226, 27, 23, 97, 8, 210,
-    176, 184, 227, 207, 231, 57, 188, 43, 179, 56, 56, 5, 253, 148, 48, 158, 190, 133, 247, 118, 39, 7, 230, 135, 141,
-    198, 212, 78, 201, 61, 20, 61, 113, 73, 67, 154, 65, 55, 109, 50, 21, 85, 251, 192, 24, 0, 145, 19, 150, 246, 30,
-    16, 90, 61, 138, 86, 195, 84, 29, 249, 158, 53, 215, 138, 50, 95, 16, 221, 187, 58, 217, 148, 252, 112, 253, 216,
-    238, 24, 82, 96, 194, 136, 207, 23, 14, 172, 152, 131, 163, 197, 138, 136, 52, 9, 231, 117, 25, 93, 29, 98, 123, 97,
-    48, 28, 192, 201, 125, 41, 22, 168, 128, 187, 182, 194, 38, 231, 190, 207, 213, 189, 72, 127, 27, 16, 234, 233, 119,
-    178, 108, 33, 152, 248, 22, 34, 180, 214, 53, 100, 125, 102, 183, 199, 180, 8, 189, 227, 173, 61, 5, 225, 194, 203,
-    237, 244, 35, 85, 176, 119, 168, 143, 0, 153, 226, 197, 202, 143, 120, 48, 10, 6, 81, 176, 81, 70, 185, 136, 23,
-    227, 49, 216, 175, 163, 220, 22, 206, 13, 161, 19, 165, 244, 63, 43, 216, 63, 39, 156, 167, 123, 165, 63, 5, 221,
-    95, 98, 136, 220, 81, 43, 37, 111, 146, 52, 146, 206, 204, 74, 200, 3, 92, 139, 166, 180, 174, 194, 154, 49, 154,
-    246, 191, 88, 72, 53, 106, 96, 33, 148, 27, 104, 219, 229, 202, 73, 49, 200, 194, 218, 116, 241, 175, 7, 109, 233,
-    29, 9, 127, 21, 54, 251, 128, 96, 136, 169, 113, 216, 109, 144, 58, 68, 37, 110, 189, 41, 252, 235, 231, 244, 190,
-    184, 127, 159, 134, 104, 128, 225, 128, 113, 196, 227, 94, 120, 103, 144, 125, 246, 21, 82, 65, 3, 208, 56, 204,
-    217, 134, 45, 91, 205, 111, 188, 40, 226, 165, 121, 195, 213, 80, 243, 136, 197, 186, 95, 247, 60, 80, 118, 164,
-    188, 37, 3, 253, 22, 48, 251, 212, 115, 221, 50, 248, 255, 205, 208, 128, 125, 203, 172, 25, 231, 169, 6, 43, 42,
-    63, 29, 165, 198, 59, 200, 208, 146, 179, 210, 10, 232, 1, 164, 170, 62, 145, 135, 97, 122, 187, 40, 214, 69, 200,
-    2, 14, 17, 131, 86, 217, 27, 155, 140, 25, 163, 26, 147, 109, 144, 43, 32, 220, 239, 13, 61, 73, 117, 200, 81, 110,
-    212, 243, 210, 117, 39, 227, 39, 140, 243, 248, 137, 27, 48, 52, 97, 175, 197, 212, 230, 217, 38, 182, 8, 135, 162,
-    113, 105, 151, 150, 188, 227, 232, 52, 241, 156, 244, 78, 16, 184, 200, 154, 30, 215, 149, 135, 235, 101, 182, 19,
-    64, 90, 171, 255, 148, 195, 63, 15, 204, 95, 126, 80, 17, 80, 210, 1, 57, 22, 239, 83, 72, 159, 230, 43, 206, 230,
-    216, 246, 17, 74, 132, 139, 91, 22, 229, 164, 158, 26, 222, 167, 106, 59, 77, 142, 114, 171, 235, 156, 55, 108, 85,
-    65, 57, 183, 150, 229, 98, 37, 71, 200, 60, 162, 6, 85, 233, 75, 148, 75, 180, 78, 218, 213, 222, 176, 210, 87, 5,
-    50, 134, 8, 192, 65, 82, 144, 236, 42, 208, 242, 193, 37, 9, 230, 98, 13, 219, 98, 69, 230, 85, 64, 42, 223, 54,
-    152, 254, 13, 95, 7, 23, 198, 5, 171, 248, 23, 251, 232, 222, 199, 255, 86, 93, 91, 179, 77, 10, 198, 200, 160, 12,
-    242, 58, 53, 237, 130, 151, 0, 25, 224, 104, 70, 160, 150, 57, 89, 153, 169, 100, 247, 5, 221, 208, 122, 3, 94, 55,
-    166, 194, 145, 103, 108, 165, 88, 127, 173, 187, 59, 3, 142, 81, 88, 129, 169, 54, 101, 40, 244, 113, 7, 29, 224,
-    227, 20, 247, 56, 165, 16, 162, 145, 19, 115, 69, 213, 58, 156, 229, 196, 123, 45, 156, 68, 57, 9, 216, 137, 32, 23,
-    133, 77, 83, 221, 205, 190, 221, 205, 90, 66, 72, 64, 82, 231, 254, 202, 239, 162, 65, 72, 192, 156, 41, 169, 196,
-    2, 201, 124, 69, 253, 34, 135, 133, 231, 50, 134, 109, 131, 17, 173, 46, 51, 113, 60, 227, 2, 207, 212, 195, 246, 8,
-    50, 140, 68, 143, 141, 88, 155, 62, 234, 65, 241, 48, 5, 246, 49, 30, 201, 14, 13, 246, 37, 205, 97, 236, 172, 151,
-    136, 168, 38, 175, 164, 137, 18, 133, 168, 135, 131, 68, 100, 154, 188, 161, 123, 247, 215, 217, 84, 200, 114, 99,
-    28, 139, 113, 228, 198, 74, 28, 127, 247, 4, 94, 186, 241, 48, 135, 218, 240, 233, 22, 17, 232, 208, 177, 251, 217,
-    192, 49, 130
+    19, 219, 141, 202, 64, 93, 215, 119, 6, 179, 58, 6, 158, 160, 77, 128, 3, 92, 91, 238, 64, 214, 112, 178, 131, 77,
+    162, 85, 21, 19, 230, 89, 15, 20, 254, 38, 37, 212, 172, 182, 248, 57, 153, 247, 234, 88, 156, 147, 236, 137, 27,
+    126, 50, 87, 53, 250, 77, 37, 158, 47, 186, 88, 81, 99, 228, 218, 232, 88, 124, 60, 187, 76, 60, 16, 165, 73, 91,
+    53, 228, 56, 24, 212, 183, 189, 52, 102, 254, 65, 128, 238, 252, 228, 177, 104, 22, 103, 155, 151, 133, 197, 164,
+    41, 242, 135, 48, 41, 143, 136, 249, 131, 192, 87, 212, 70, 240, 17, 107, 72, 138, 42, 36, 160, 10, 26, 192, 2, 238,
+    223, 9, 243, 172, 162, 227, 131, 242, 210, 2, 11, 145, 169, 86, 245, 231, 83, 236, 137, 90, 252, 89, 150, 220, 134,
+    251, 20, 124, 17, 119, 23, 185, 140, 227, 44, 169, 90, 61, 74, 117, 15, 119, 18, 80, 52, 164, 253, 57, 117, 77, 148,
+    46, 115, 6, 126, 99, 103, 108, 58, 70, 70, 214, 23, 0, 56, 156, 26, 21, 12, 102, 248, 47, 66, 206, 177, 107, 132,
+    170, 228, 184, 224, 161, 245, 99, 213, 30, 202, 140, 255, 79, 107, 65, 97, 94, 4, 215, 50, 79, 0, 235, 146, 31, 118,
+    213, 238, 204, 141, 117, 110, 92, 192, 244, 9, 149, 24, 73, 35, 168, 166, 57, 144, 114, 126, 158, 23, 252, 138, 225,
+    253, 67, 40, 169, 0, 97, 247, 239, 40, 247, 111, 223, 76, 35, 141, 41, 68, 76, 192, 84, 233, 251, 215, 133, 41, 127,
+    135, 125, 89, 104, 242, 231, 185, 221, 209, 61, 131, 21, 160, 145, 148, 71, 226, 155, 67, 138, 173, 78, 23, 217, 29,
+    246, 165, 241, 221, 215, 99, 103, 127, 247, 163, 84, 156, 135, 38, 59, 39, 55, 21, 15, 241, 11, 167, 250, 197, 162,
+    118, 91, 237, 97, 164, 60, 169, 132, 203, 21, 86, 47, 130, 199, 241, 60, 61, 36, 235, 77, 17, 9, 88, 124, 194, 109,
+    182, 225, 69, 43, 5, 58, 164, 132, 217, 247, 6, 222, 139, 140, 122, 219, 27, 210, 4, 151, 125, 69, 197, 113, 198,
+    211, 170, 55, 16, 178, 111, 125, 180, 45, 9, 87, 9, 162, 79, 11, 69, 223, 169, 92, 240, 90, 218, 77, 253, 102, 25,
+    148, 73, 137, 35, 85, 93, 59, 209, 167, 127, 251, 255, 120, 77, 44, 84, 9, 26, 192, 125, 126, 200, 213, 55, 133, 18,
+    26, 109, 215, 234, 117, 56, 195, 99, 154, 115, 217, 130, 250, 177, 20, 124, 0, 24, 168, 185, 92, 133, 187, 60, 148,
+    65, 72, 59, 184, 53, 144, 155, 175, 238, 170, 218, 111, 101, 248, 141, 232, 78, 156, 101, 187, 71, 7, 113, 20, 7,
+    18, 168, 24, 177, 79, 224, 46, 230, 150, 26, 67, 71, 245, 202, 150, 54, 223, 25, 17, 52, 63, 6, 140, 3, 150, 157,
+    61, 122, 50, 180, 18, 108, 246, 151, 72, 204, 152, 168, 25, 215, 54, 116, 53, 176, 73, 92, 47, 15, 105, 44, 184,
+    207, 73, 184, 13, 181, 133, 100, 175, 35, 171, 181, 166, 193, 133, 109, 122, 34, 136, 74, 3, 175, 113, 10, 48, 73,
+    247, 193, 67, 203, 86, 242, 7, 90, 64, 28, 225, 65, 63, 107, 226, 74, 40, 61, 52, 129, 2, 56, 117, 244, 85, 246,
+    207, 118, 61, 145, 36, 147, 241, 165, 81, 98, 78, 222, 75, 59, 68, 95, 227, 96, 114, 71, 183, 9, 30, 202, 104, 152,
+    127, 73, 201, 208, 44, 60, 51, 75, 66, 48, 142, 2, 96, 25, 99, 250, 213, 91, 237, 120, 121, 64, 78, 11, 233, 184,
+    47, 83, 182, 222, 107, 111, 188, 199, 137, 112, 118, 48, 209, 162, 62, 10, 215, 143, 54, 22, 45, 78, 239, 89, 22,
+    78, 60, 32, 147, 99, 146, 229, 143, 93, 5, 20, 109, 227, 219, 92, 191, 119, 48, 107, 161, 184, 243, 39, 107, 99,
+    245, 175, 100, 98, 83, 206, 106, 164, 113, 194, 32, 247, 245, 41, 162, 131, 120, 115, 96, 78, 127, 66, 65, 2, 85,
+    43, 142, 0, 202, 204, 114, 114, 0, 154, 172, 172, 213, 190, 53, 112, 218, 251, 88, 92, 29, 94, 17, 249, 169, 215,
+    18, 252, 56, 80, 6, 89, 116, 105, 166, 72, 128, 140, 254, 65, 47, 68, 242, 79, 56, 13, 180, 217, 23, 97, 235, 53, 6,
+    17, 133, 104, 69, 159, 149, 188, 173, 123, 106, 218, 172, 13, 107, 164, 218, 250, 133, 191, 67, 3, 219, 158, 12,
+    254, 228, 170, 119, 218, 25, 25, 14, 11, 203, 137, 243, 115, 254, 197, 67, 186, 17, 125, 15, 241, 8, 137, 251, 177,
+    209, 181, 69, 79, 243, 207, 184, 237, 152, 36, 111, 99, 147, 224, 110, 133, 141, 233, 148, 52, 206, 139, 169, 165,
+    16, 137, 182, 179, 175, 124, 157, 95, 219, 56, 24, 210, 183, 105, 42, 31, 30, 123, 24, 60, 226, 103, 48, 129, 126,
+    80, 83, 133, 166, 71, 101, 59, 207, 17, 248, 159, 56, 57, 9, 50, 148, 48, 74, 78, 67, 216, 191, 245, 93, 150, 29,
+    218, 240, 255, 197, 231, 88, 46, 106, 137, 79, 137, 228, 227, 80, 195, 19, 120, 76, 253, 70, 115, 159, 70, 221, 5,
+    133, 66, 163, 186, 249, 16, 150, 177, 1, 252, 195, 8, 39, 124, 1, 107, 33, 103, 109, 81, 237, 169, 252, 222, 0, 104,
+    108, 4, 43, 61, 122, 109, 65, 114, 52, 238, 2, 76, 155, 80, 190, 128, 7, 251, 83, 217, 199, 145, 189, 242, 113, 22,
+    140, 137, 151, 169, 163, 143, 117, 161, 211, 0, 100, 43, 199, 60, 121, 218, 73, 229, 126, 253, 224, 82, 150, 14,
+    139, 233, 180, 248, 66, 168, 235, 91, 69, 176, 69, 193, 114, 237, 255, 217, 92, 17, 87, 189, 197, 94, 130, 130, 221,
+    24, 173, 145, 191, 151, 153, 109, 239, 89, 47, 83, 38, 32, 121, 207, 21, 101, 102, 73, 34, 223, 57, 5, 233, 43, 92,
+    24, 193, 100, 209, 100, 186, 181, 40, 43, 4, 140, 50, 223, 239, 13, 3, 168, 230, 151, 212, 166, 248, 23, 87, 31, 53,
+    77, 98, 85, 175, 8, 243, 40, 9, 32, 150, 66, 84, 100, 138, 215, 108, 114, 214, 210, 4, 112, 157, 146, 106, 97, 136,
+    200, 140, 188, 226, 76, 166, 136, 26, 106, 123, 202, 91, 4, 153, 209, 171, 88, 148, 233, 48, 250, 187, 103, 204, 39,
+    132, 62, 250, 16, 76, 111, 228, 54, 199, 130, 10, 21, 172, 100, 136, 115, 119, 79, 87, 144, 145, 189, 56, 110, 24,
+    109, 145, 239, 93, 159, 123, 167, 10, 197, 11, 133, 214, 16, 254, 184, 159, 157, 57, 2, 234, 139, 86, 181, 199, 1,
+    174, 116, 178, 18, 203, 84, 186, 123, 253, 61, 73, 225, 108, 107, 188, 55, 27, 124, 249, 12, 16, 27, 177, 56, 36,
+    31, 152, 44, 163, 84, 255, 168, 59, 112, 90, 80, 98, 223, 165, 252, 126, 67, 152, 167, 216, 190, 73, 210, 22, 98,
+    127, 173, 116, 104, 230, 185, 127, 172, 17, 76, 159, 227, 158, 146, 117, 181, 229, 82, 85, 164, 17, 67, 179, 194,
+    137, 104, 72, 63, 229, 62, 129, 17, 247, 78, 51, 119, 91, 48, 45, 183, 214, 108, 181, 77, 132, 139, 173, 52, 102,
+    16, 99, 59, 162, 34, 193, 207, 47, 235, 32, 33, 5, 115, 115, 119, 204, 206, 195, 27, 56, 182, 35, 133, 140, 189,
+    240, 41, 177, 0, 197, 190, 23, 58, 3, 213, 26, 215, 80, 198, 226, 196, 112, 19, 226, 161, 3, 66, 250, 153, 56, 83,
+    255, 223, 17, 83, 32, 6, 53, 173, 199, 190, 32, 144, 39, 188, 210, 174, 227, 183, 114, 129, 131, 17, 220, 113, 77,
+    205, 172, 172, 201, 86, 48, 135, 115, 181, 69, 246, 60, 110, 94, 18, 110, 81, 11, 184, 22, 68, 237, 233, 29, 0, 98,
+    220, 0, 194, 203, 95, 207, 152, 132, 72, 31, 152, 20, 152, 193, 101, 236, 83, 36, 204, 78, 218, 253, 11, 64, 134,
+    135, 233, 205, 76, 181, 80, 88, 231, 36, 51, 2, 132, 244, 172, 252, 74, 216, 218, 253, 189, 227, 149, 91, 14, 64, 8,
+    41, 176, 187, 228, 184, 66, 209, 250, 177, 149, 119, 144, 159, 166, 249, 76, 93, 214, 176, 70, 64, 195, 204, 217,
+    78, 20, 120, 118, 79, 249, 54, 157, 216, 238, 172, 98, 59, 45, 241, 147, 40, 210, 39, 174, 102, 241, 225, 196, 78,
+    169, 127, 116, 104, 180, 251, 145, 211, 129, 168, 190, 12, 186, 124, 68, 145, 93, 122, 201, 161, 222, 56, 152, 56,
+    240, 210, 226, 192, 247, 31, 124, 192, 198, 188, 24, 246, 206, 223, 234, 160, 70, 225, 213, 129, 119, 65, 164, 231,
+    111, 164, 38, 82, 227, 18, 43, 53, 86, 201, 12, 102, 39, 17, 102, 160, 172, 98, 85, 77, 236, 179, 10, 177, 102, 181,
+    73, 248, 130, 55, 68, 99, 15, 86, 11, 21, 29, 184, 251, 47, 96, 200, 180, 192, 24, 48, 158, 35, 183, 254, 31, 204,
+    165, 90, 90, 202, 127, 214, 202, 62, 20, 254, 144, 18, 82, 83, 228, 249, 67, 231, 224, 16, 148, 80, 98, 56, 95, 125,
+    228, 228, 46, 97, 250, 138, 177, 159, 28, 191, 194, 173, 49, 26, 221, 128, 89, 185, 111, 242, 87, 236, 124, 80, 77,
+    248, 74, 79, 70, 89, 191, 30, 142, 239, 208, 100, 152, 122, 38, 108, 25, 109, 138, 109, 103, 39, 86, 154, 203, 165,
+    54, 47, 62, 76, 175, 2, 168, 58, 105, 4, 156, 150, 85, 21, 134, 61, 151, 18, 0, 56, 119, 160, 228, 85, 87, 47, 52,
+    32, 176, 104, 180, 233, 84, 3, 185, 121, 16, 38, 179, 69, 156, 248, 204, 254, 89, 121, 72, 18, 50, 152, 229, 3, 89,
+    185, 127, 50, 68, 98, 116, 63, 201, 118, 228, 28, 72, 73, 145, 75, 63, 219, 242, 63, 244, 17, 137, 244, 152, 47,
+    176, 166, 26, 189, 104, 72, 245, 43, 131, 169, 126, 198, 33, 218, 110, 43, 47, 180, 7, 96, 68, 37, 35, 240, 245, 6,
+    15, 120, 88, 168, 171, 72, 232, 16, 8, 20, 194, 155, 65, 49, 179, 132, 148, 217, 100, 50, 203, 251, 36, 23, 95, 14,
+    223, 165, 245, 93, 189, 245, 231, 52, 191, 16, 232, 234, 123, 244, 11, 3, 91, 0, 228, 201, 109, 12, 11, 92, 237,
+    224, 79, 147, 24, 125, 109, 5, 210, 82, 90, 36, 84, 148, 172, 36, 43, 96, 22, 211, 11, 154, 22, 143, 108, 17, 239,
+    17, 37, 38, 59, 108, 98, 83, 88, 144, 147, 158, 247, 147, 203, 149, 77, 172, 43, 238, 203, 33, 125, 29, 148, 227,
+    63, 42, 151, 30, 38, 224, 205, 45, 2, 125, 161, 166, 4, 250, 236, 176, 198, 9, 194, 152, 185, 158, 190, 52, 189,
+    163, 90, 163, 123, 6, 198, 69, 53, 167, 19, 107, 234, 195, 224, 185, 187, 97, 124, 165, 193, 233, 240, 107, 238,
+    142, 38, 234, 193, 201, 192, 35, 21, 186, 41, 8, 120, 199, 240, 139, 176, 223, 208, 215, 16, 10, 99, 5, 121, 15, 19,
+    5, 125, 167, 60, 190, 233, 10, 225, 241, 180, 126, 103, 198, 149, 74, 105, 18, 14, 63, 237, 248, 29, 229, 83, 238,
+    73, 2, 91, 163, 178, 41, 160, 128, 140, 223, 233, 194, 130, 79, 184, 249, 19, 252, 62, 189, 169, 242, 143, 194, 204,
+    142, 249, 196, 94, 238, 7, 211, 173, 152, 243, 118, 246, 135, 76, 81, 18, 25, 166, 51, 187, 65, 252, 217, 151, 93,
+    32, 236, 10, 195, 44, 164, 22, 30, 223, 111, 51, 120, 244, 39, 205, 145, 200, 122, 37, 65, 197, 89, 163, 227, 234,
+    69, 141, 183, 36, 68, 216, 19, 142, 131, 146, 32, 85, 124, 232, 115, 131, 106, 109, 184, 36, 97, 217, 16, 150, 250,
+    41, 22, 251, 111, 186, 35, 10, 246, 141, 179, 81, 208, 210, 245, 102, 204, 136, 209, 42, 50, 144, 36, 197, 163, 22,
+    176, 53, 218, 109, 71, 49, 152, 133, 159, 75, 188, 1, 210, 158, 121, 72, 208, 106, 28, 122, 151, 231, 110, 35, 146,
+    138, 101, 86, 55, 204, 28, 234, 178, 127, 222, 125, 182, 14, 146, 182, 21, 2, 116, 10, 193, 106, 38, 144, 205, 203,
+    110, 138, 200, 22, 0, 111, 244, 159, 253, 154, 162, 20, 216, 166, 208, 22, 121, 232, 220, 196, 196, 253, 127, 16,
+    19, 77, 9, 43, 145, 133, 49, 118, 85, 143, 15, 18, 208, 208, 130, 167, 123, 148, 64, 12, 0, 173, 88, 139, 122, 127,
+    168, 195, 48, 209, 17, 22, 185, 104, 203, 201, 82, 239, 228, 167, 225, 200, 164, 221, 107, 60, 49, 136, 103, 22,
+    147, 17, 115, 245, 39, 100, 34, 92, 241, 8, 39, 227, 158, 51, 115, 4, 43, 86, 3, 66, 246, 17, 52, 54, 76, 132, 170,
+    56, 155, 14, 36, 140, 126, 223, 218, 71, 199, 216, 239, 147, 139, 218, 105, 22, 117, 67, 16, 1, 0, 185, 75, 158,
+    229, 219, 37, 167, 71, 86, 17, 239, 51, 52, 105, 32, 60, 251, 129, 220, 222, 22, 248, 164, 151, 119, 63, 207, 40,
+    91, 14, 9, 102, 203, 125, 195, 189, 53, 114, 229, 24, 7, 237, 83, 150, 55, 226, 90, 246, 2, 148, 110, 58, 165, 149,
+    108, 242, 205, 185, 171, 6, 193, 115, 44, 245, 102, 50, 44, 49, 183, 206, 93, 147, 159, 39, 177, 1, 155, 62, 50,
+    177, 104, 193, 46, 247, 223, 182, 218, 146, 221, 246, 79, 182, 92, 99, 40, 141, 134, 30, 10, 253, 6, 75, 86, 25, 19,
+    20, 100, 114, 12, 105, 97, 39, 209, 197, 119, 19, 80, 20, 197, 97, 18, 228, 255, 160, 102, 33, 183, 8, 97, 59, 87,
+    129, 113, 229, 87, 102, 92, 73, 113, 5, 246, 37, 106, 170, 49, 70, 43, 10, 55, 56, 34, 33, 3, 76, 67, 21, 2, 47,
+    207, 92, 61, 255, 166, 65, 127, 71, 72, 192, 85, 179, 114, 89, 98, 45, 117, 96, 37, 198, 186, 251, 218, 17, 150, 99,
+    222, 116, 110, 165, 80, 172, 70, 31, 116, 110, 217, 72, 5, 112, 72, 250, 93, 150, 210, 189, 112, 107, 72, 71, 225,
+    15, 255, 140, 117, 17, 224, 189, 61, 145, 129, 231, 43, 253, 237, 247, 168, 63, 86, 62, 107, 203, 180, 24, 142, 222,
+    151, 201, 29, 205, 233, 96, 15, 137, 160, 210, 94, 138, 213, 167, 239, 19, 32, 3, 218, 81, 50, 162, 148, 218, 87,
+    23, 58, 147, 187, 137, 171, 10, 51, 35, 180, 125, 88, 60, 128, 237, 80, 43, 3, 121, 162, 230, 97, 244, 6, 40, 70,
+    149, 147, 105, 45, 195, 107, 130, 107, 56, 18, 96, 102, 247, 190, 106, 194, 63, 181, 14, 34, 101, 172, 43, 245, 221,
+    102, 155, 235, 130, 119, 66, 13, 68, 38, 55, 200, 138, 229, 186, 194, 128, 52, 166, 202, 207, 60, 6, 62, 219, 23,
+    114, 203, 93, 136, 161, 127, 13, 98, 75, 186, 224, 93, 161, 172, 68, 215, 254, 43, 239, 51, 72, 83, 13, 167, 72,
+    174, 178, 180, 85, 84, 1, 171, 44, 189, 232, 149, 163, 245, 187, 158, 153, 60, 70, 246, 179, 28, 130, 24, 150, 211,
+    124, 153, 147, 48, 107, 66, 63, 250, 72, 28, 216, 125, 167, 228, 133, 234, 125, 117, 169, 223, 3, 32, 96, 48, 18,
+    13, 246, 92, 25, 76, 138, 7, 235, 114, 141, 94, 255, 54, 237, 84, 107, 115, 9, 14, 223, 42, 126, 83, 194, 216, 15,
+    172, 5, 250, 249, 199, 254, 83, 66, 165, 133, 145, 14, 73, 28, 237, 75, 215, 112, 201, 124, 46, 148, 11, 200, 27,
+    80, 217, 8, 196, 15, 127, 192, 170, 116, 96, 227, 108, 74, 182, 176, 154, 201, 6, 240, 183, 253, 154, 221, 15, 0,
+    159, 39, 7, 227, 237, 21, 199, 109, 0, 90, 215, 188, 254, 3, 56, 51, 104, 164, 30, 11, 158, 234, 110, 210, 182, 107,
+    89, 3, 239, 4, 96, 132, 111, 136, 106, 128, 37, 203, 187, 105, 171, 176, 79, 206, 190, 81, 0, 49, 50, 128, 15, 106,
+    208, 230, 134, 181, 141, 31, 231, 200, 216, 245, 235, 101, 222, 75, 217, 125, 97, 166, 4, 243, 13, 69, 77, 196, 167,
+    165, 184, 243, 253, 82, 20, 216, 176, 151, 115, 54, 167, 193, 131, 230, 192, 146, 104, 198, 148, 223, 64, 55, 95,
+    83, 104, 175, 40, 87, 242, 88, 176, 159, 200, 32, 234, 173, 196, 89, 189, 19, 8, 236, 92, 255, 127, 229, 47, 108,
+    60, 14, 111, 199, 221, 131, 21, 126, 11, 226, 238, 183, 147, 120, 35, 244, 57, 54, 23, 38, 37, 211, 24, 250, 60, 29,
+    88, 225, 67, 180, 21, 89, 143, 196, 111, 57, 181, 208, 105, 13, 88, 184, 160, 170, 53, 221, 60, 165, 213, 49, 72,
+    176, 95, 135, 193, 139, 55, 116, 49, 17, 81, 58, 143, 34, 182, 199, 235, 63, 230, 46, 89, 235, 133, 137, 37, 78, 20,
+    38, 240, 135, 206, 112, 87, 189, 8, 113, 97, 83, 221, 59, 161, 16, 247, 61, 255, 97, 57, 213, 245, 242, 28, 213,
+    189, 194, 139, 165, 76, 21, 20, 213, 116, 195, 205, 212, 199, 15, 28, 109, 81, 77, 16, 185, 23, 57, 68, 227, 148,
+    75, 82, 173, 180, 236, 244, 217, 213, 140, 191, 38, 215, 119, 143, 250, 245, 63, 47, 235, 244, 202, 37, 247, 202,
+    30, 247, 242, 87, 80, 47, 247, 217, 107, 74, 254, 181, 8, 88, 247, 242, 73, 0, 23, 77, 107, 32, 101, 222, 211, 200,
+    197, 130, 82, 5, 252, 169, 3, 175, 69, 137, 27, 246, 6, 194, 13, 127, 3, 148, 79, 179, 12, 33, 124, 4, 232, 76, 92,
+    82, 248, 57, 168, 3, 29, 14, 56, 39, 91, 189, 31, 43, 233, 207, 200, 194, 35, 88, 132, 196, 192, 41, 30, 196, 178,
+    226, 252, 43, 149, 37, 230, 133, 1, 118, 218, 222, 122, 111, 75, 18, 23, 195, 118, 141, 2, 150, 51, 164, 37, 33,
+    245, 187, 101, 156, 65, 156, 79, 232, 143, 209, 68, 240, 146, 154, 46, 90, 187, 203, 246, 90, 119, 184, 75, 78, 244,
+    120, 72, 130, 220, 45, 42, 1, 151, 8, 254, 244, 211, 135, 74, 211, 0, 35, 17, 83, 204, 82, 171, 243, 2, 113, 113,
+    92, 121, 5, 51, 155, 187, 77, 7, 90, 41, 124, 72, 166, 14, 194, 35, 207, 17, 230, 235, 234, 29, 144, 96, 104, 27,
+    155, 216, 137, 173, 108, 7, 66, 71, 9, 139, 220, 105, 208, 115, 131, 168, 46, 96, 85, 63, 87, 0, 213, 184, 94, 169,
+    200, 43, 198, 21, 1, 96, 78, 173, 73, 44, 76, 139, 91, 51, 213, 127, 111, 230, 178, 114, 230, 202, 49, 239, 34, 152,
+    104, 198, 88, 246, 216, 197, 165, 154, 225, 245, 192, 223, 156, 113, 172, 204, 135, 31, 183, 173, 136, 5, 107, 196,
+    97, 85, 148, 20, 229, 10, 11, 138, 163, 52, 132, 115, 79, 163, 214, 60, 165, 7, 221, 76, 209, 78, 10, 101, 130, 241,
+    73, 176, 24, 199, 230, 193, 249, 112, 10, 202, 34, 177, 58, 149, 27, 250, 189, 225, 154, 50, 20, 156, 136, 125, 122,
+    9, 225, 90, 52, 67, 225, 38, 27, 216, 59, 59, 174, 107, 63, 109, 131, 246, 210, 121, 9, 169, 43, 4, 179, 252, 119,
+    130, 120, 44, 2, 203, 219, 228, 16, 16, 214, 212, 66, 119, 70, 185, 233, 77, 143, 112, 137, 26, 5, 115, 249, 134,
+    54, 101, 114, 13, 64, 24, 125, 12, 2, 248, 102, 97, 28, 45, 47, 157, 250, 28, 196, 111, 36, 59, 94, 38, 101, 60,
+    242, 171, 51, 157, 117, 128, 193, 187, 96, 27, 38, 11, 88, 180, 14, 28, 11, 194, 126, 155, 142, 119, 154, 170, 218,
+    200, 237, 6, 156, 178, 176, 222, 195, 51, 96, 142, 28, 153, 210, 235, 106, 3, 33, 127, 136, 246, 217, 49, 248, 102,
+    59, 205, 191, 243, 35, 13, 79, 179, 155, 175, 63, 92, 199, 198, 226, 30, 200, 155, 157, 88, 13, 84, 7, 26, 237, 14,
+    35, 126, 145, 97, 222, 81, 196, 26, 32, 125, 141, 30, 39, 130, 80, 37, 195, 8, 36, 92, 216, 1, 91, 229, 48, 203, 78,
+    61, 73, 7, 233, 19, 11, 147, 37, 198, 149, 117, 79, 81, 206, 210, 116, 119, 219, 237, 3, 252, 215, 236, 205, 49,
+    254, 131, 155, 205, 85, 56, 192, 222, 245, 41, 184, 215, 214, 197, 247, 126, 121, 10, 230, 197, 144, 161, 243, 14,
+    146, 159, 14, 231, 101, 245, 117, 10, 143, 230, 233, 191, 216, 114, 38, 105, 5, 245, 203, 247, 75, 117, 217, 168,
+    136, 4, 181, 8, 54, 188, 72, 113, 134, 73, 113, 156, 67, 101, 34, 238, 235, 100, 86, 162, 146, 29, 240, 249, 152,
+    193, 155, 113, 135, 153, 192, 195, 225, 131, 242, 91, 178, 30, 34, 87, 106, 142, 94, 212, 98, 149, 14, 165, 57, 127,
+    219, 186, 99, 58, 155, 119, 221, 147, 171, 111, 237, 140, 230, 67, 250, 216, 175, 114, 88, 144, 16, 155, 53, 112,
+    233, 36, 185, 148, 102, 25, 202, 140, 31, 244, 56, 158, 9, 178, 152, 133, 99, 24, 251, 78, 6, 9, 35, 125, 140, 199,
+    75, 181, 217, 121, 139, 14, 16, 60, 231, 0, 15, 112, 48, 100, 139, 112, 94, 167, 211, 205, 255, 44, 90, 113, 42,
+    200, 121, 180, 220, 18, 249, 115, 226, 53, 234, 87, 243, 187, 167, 180, 165, 180, 124, 94, 72, 107, 84, 101, 126,
+    217, 126, 127, 118, 145, 180, 40, 13, 183, 12, 249, 137, 26, 246, 59, 156, 151, 55, 199, 101, 89, 4, 142, 211, 46,
+    42, 56, 253, 15, 182, 7, 242, 24, 225, 200, 174, 231, 84, 95, 108, 139, 149, 160, 231, 65, 140, 77, 243, 253, 39,
+    189, 13, 229, 43, 196, 208, 177, 102, 79, 93, 163, 60, 139, 133, 48, 154, 116, 24, 59, 147, 93, 114, 107, 252, 113,
+    131, 248, 117, 72, 237, 143, 85, 55, 242, 83, 160, 36, 89, 22, 77, 65, 56, 128, 172, 84, 17, 120, 173, 72, 202, 172,
+    177, 228, 232, 146, 139, 160, 223, 165, 165, 9, 200, 168, 212, 223, 159, 38, 9, 37, 126, 222, 222, 113, 216, 226,
+    247, 139, 26, 239, 123, 145, 228, 71, 121, 217, 126, 149, 219, 147, 42, 255, 152, 220, 106, 173, 213, 5, 149, 218,
+    88, 109, 123, 190, 166, 47, 134, 88, 155, 32, 109, 33, 172, 74, 69, 13, 168, 104, 128, 224, 160, 194, 193, 236, 95,
+    206, 229, 248, 238, 28, 46, 58, 242, 215, 145, 209, 99, 38, 164, 99, 210, 168, 120, 90, 95, 119, 114, 61, 170, 174,
+    193, 58, 186, 0, 113, 14, 58, 77, 186, 32, 126, 243, 72, 189, 178, 215, 196, 32, 50, 228, 19, 160, 98, 145, 18, 64,
+    170, 35, 69, 62, 51, 18, 118, 101, 104, 81, 115, 249, 64, 136, 102, 193, 114, 93, 54, 72, 56, 0, 203, 94, 239, 194,
+    129, 210, 255, 179, 169, 225, 2, 105, 131, 71, 146, 63, 204, 1, 175, 8, 245, 37, 58, 251, 156, 50, 133, 13, 59, 210,
+    170, 131, 235, 49, 100, 113, 5, 7, 59, 177, 243, 130, 129, 239, 0, 95, 91, 94, 199, 134, 222, 51, 64, 61, 133, 223,
+    81, 149, 126, 26, 27, 239, 175, 55, 58, 244, 21, 78, 11, 78, 239, 255, 197, 241, 30, 18, 71, 148, 230, 234, 39, 59,
+    89, 88, 68, 23, 70, 52, 13, 168, 122, 240, 252, 11, 225, 162, 251, 195, 33, 251, 202, 33, 28, 252, 247, 68, 78, 173,
+    200, 111, 51, 167, 188, 62, 12, 37, 145, 107, 178, 83, 112, 31, 169, 36, 240, 185, 52, 221, 98, 1, 125, 78, 1, 18,
+    213, 183, 76, 239, 31, 121, 213, 148, 207, 85, 54, 193, 163, 194, 105, 151, 189, 185, 74, 177, 40, 188, 170, 128,
+    123, 216, 20, 96, 71, 115, 34, 160, 245, 12, 51, 40, 192, 90, 226, 11, 3, 240, 190, 106, 32, 83, 14, 83, 209, 150,
+    112, 177, 198, 229, 167, 4, 198, 49, 9, 127, 190, 38, 182, 174, 137, 96, 236, 42, 79, 246, 124, 226, 153, 252, 3,
+    22, 188, 62, 175, 3, 210, 149, 240, 161, 110, 89, 129, 68, 137, 43, 95, 139, 81, 82, 122, 191, 135, 132, 200, 161,
+    56, 127, 141, 112, 81, 209, 176, 248, 51, 253, 192, 168, 17, 138, 46, 220, 23, 159, 5, 203, 125, 168, 111, 46, 57,
+    142, 170, 227, 90, 58, 241, 200, 143, 178, 172, 69, 129, 6, 218, 225, 33, 97, 101, 119, 230, 149, 111, 0, 6, 85,
+    246, 41, 154, 191, 215, 82, 189, 230, 54, 220, 54, 175, 232, 31, 53, 208, 13, 227, 77, 164, 101, 0, 47, 27, 80, 96,
+    13, 214, 166, 60, 134, 154, 28, 199, 35, 164, 132, 57, 97, 0, 169, 91, 227, 52, 160, 128, 158, 226, 214, 3, 97, 42,
+    64, 35, 222, 69, 152, 20, 99, 89, 47, 2, 253, 14, 95, 27, 108, 211, 232, 170, 168, 139, 64, 154, 182, 221, 246, 123,
+    115, 118, 29, 70, 239, 120, 59, 163, 217, 249, 31, 192, 176, 54, 85, 42, 142, 217, 171, 43, 30, 246, 27, 97, 82, 3,
+    21, 214, 181, 107, 59, 96, 196, 64, 150, 196, 40, 80, 194, 145, 120, 249, 219, 30, 15, 204, 52, 255, 17, 238, 78,
+    206, 229, 31, 207, 79, 181, 38, 10, 43, 95, 230, 107, 248, 38, 114, 141, 236, 32, 152, 130, 79, 122, 21, 92, 247, 4,
+    159, 88, 59, 114, 68, 163, 99, 10, 184, 241, 20, 39, 161, 74, 182, 98, 98, 58, 137, 232, 227, 131, 187, 125, 248,
+    195, 162, 251, 220, 55, 44, 214, 35, 114, 242, 151, 175, 30, 208, 82, 29, 25, 2, 95, 3, 67, 86, 47, 0, 122, 248, 57,
+    207, 87, 81, 73, 208, 107, 210, 48, 25, 147, 155, 42, 63, 96, 193, 127, 11, 177, 238, 177, 18, 218, 76, 91, 157, 12,
+    15, 155, 66, 253, 224, 24, 213, 145, 34, 42, 213, 26, 88, 56, 239, 132, 149, 171, 61, 247, 62, 74, 52, 115, 45, 219,
+    10, 98, 239, 28, 90, 10, 179, 66, 7, 169, 145, 150, 242, 243, 119, 243, 248, 248, 192, 136, 5, 96, 198, 116, 70,
+    194, 33, 147, 218, 49, 105, 239, 93, 127, 206, 75, 154, 128, 165, 210, 239, 197, 101, 170, 132, 63, 182, 12, 96,
+    142, 178, 108, 147, 250, 247, 250, 52, 243, 5, 235, 37, 67, 147, 251, 18, 39, 165, 114, 130, 116, 139, 20, 42, 212,
+    239, 158, 118, 146, 254, 177, 29, 60, 55, 152, 98, 50, 125, 49, 196, 1, 236, 65, 252, 171, 163, 134, 187, 238, 18,
+    65, 83, 215, 150, 172, 246, 248, 222, 138, 155, 191, 160, 191, 140, 51, 16, 95, 188, 40, 72, 207, 129, 255, 94, 46,
+    176, 211, 83, 30, 252, 74, 155, 44, 143, 136, 56, 253, 164, 169, 149, 243, 148, 211, 26, 178, 1, 201, 201, 251, 5,
+    74, 237, 5, 241, 89, 57, 119, 250, 250, 231, 20, 90, 57, 177, 158, 12, 50, 90, 161, 213, 228, 189, 203, 178, 37,
+    179, 35, 87, 45, 98, 16, 250, 206, 162, 121, 55, 168, 90, 88, 127, 151, 126, 129, 85, 186, 46, 109, 44, 185, 145,
+    20, 84, 126, 43, 34, 67, 214, 218, 206, 116, 241, 226, 233, 43, 112, 223, 164, 239, 203, 238, 233, 176, 174, 6, 26,
+    220, 52, 109, 120, 186, 36, 201, 251, 95, 202, 162, 249, 117, 227, 166, 210, 170, 164, 165, 83, 249, 130, 45, 226,
+    78, 70, 207, 101, 73, 146, 90, 9, 132, 143, 36, 214, 199, 27, 170, 240, 207, 140, 10, 162, 0, 132, 234, 106, 0, 2,
+    160, 195, 104, 134, 88, 62, 26, 85, 65, 23, 192, 238, 209, 37, 159, 222, 221, 63, 102, 143, 222, 86, 245, 251, 192,
+    122, 243, 224, 28, 142, 243, 4, 97, 230, 109, 240, 198, 10, 145, 248, 197, 217, 183, 78, 227, 20, 180, 64, 179, 7,
+    110, 201, 205, 254, 2, 132, 73, 162, 56, 147, 44, 8, 112, 38, 202, 166, 138, 202, 179, 54, 30, 5, 152, 16, 184, 89,
+    41, 163, 33, 155, 39, 199, 234, 146, 151, 110, 5, 11, 26, 62, 139, 182, 101, 214, 30, 223, 4, 208, 164, 178, 206,
+    149, 251, 238, 27, 52, 81, 79, 51, 3, 241, 109, 2, 148, 165, 78, 115, 22, 172, 75, 96, 30, 117, 33, 14, 162, 24,
+    122, 140, 89, 58, 50, 49, 250, 103, 115, 128, 81, 210, 78, 158, 204, 51, 190, 182, 133, 190, 78, 8, 108, 122, 154,
+    116, 211, 240, 196, 133, 160, 58, 54, 112, 22, 150, 24, 11, 201, 105, 184, 207, 172, 40, 110, 174, 145, 235, 127,
+    96, 102, 81, 149, 17, 5, 161, 123, 186, 137, 129, 33, 119, 152, 97, 191, 12, 12, 155, 134, 219, 39, 49, 166, 245,
+    44, 96, 225, 104, 64, 199, 65, 199, 249, 106, 48, 57, 54, 73, 66, 85, 169, 253, 212, 14, 24, 76, 190, 181, 111, 56,
+    196, 114, 88, 97, 108, 57, 202, 148, 122, 253, 129, 107, 94, 141, 49, 87, 199, 195, 73, 173, 198, 94, 50, 57, 123,
+    16, 228, 231, 166, 99, 145, 158, 55, 117, 46, 65, 36, 13, 85, 211, 228, 56, 192, 142, 161, 212, 70, 65, 7, 165, 119,
+    136, 162, 214, 165, 21, 209, 112, 18, 79, 207, 166, 29, 177, 101, 171, 243, 235, 113, 161, 228, 3, 177, 63, 165, 71,
+    205, 248, 165, 27, 105, 1, 21, 201, 2, 27, 23, 160, 215, 197, 110, 220, 152, 208, 185, 5, 83, 253, 32, 245, 16, 200,
+    124, 137, 126, 205, 192, 77, 114, 166, 100, 133, 98, 194, 43, 36, 80, 57, 243, 171, 227, 5, 184, 28, 149, 150, 213,
+    91, 85, 228, 162, 30, 168, 210, 61, 182, 159, 20, 68, 128, 149, 208, 85, 174, 226, 211, 79, 29, 127, 44, 155, 184,
+    92, 28, 115, 225, 163, 178, 34, 165, 136, 131, 137, 61, 181, 13, 38, 142, 231, 167, 158, 55, 188, 87, 231, 173, 212,
+    12, 246, 145, 251, 3, 221, 190, 157, 200, 151, 193, 194, 237, 244, 87, 45, 13, 176, 8, 43, 176, 93, 236, 15, 146,
+    169, 112, 50, 148, 143, 53, 217, 196, 249, 124, 35, 247, 127, 167, 206, 132, 100, 105, 103, 247, 54, 17, 19, 186,
+    232, 9, 96, 49, 193, 70, 131, 204, 232, 94, 114, 96, 153, 87, 207, 221, 183, 41, 154, 77, 171, 148, 84, 236, 243,
+    245, 9, 91, 48, 205, 233, 185, 136, 253, 202, 164, 240, 208, 73, 165, 43, 198, 63, 165, 16, 168, 186, 116, 219, 46,
+    147, 40, 89, 21, 61, 72, 217, 243, 1, 177, 9, 131, 17, 193, 95, 149, 195, 48, 192, 254, 222, 176, 176, 134, 241,
+    180, 172, 176, 81, 116, 80, 168, 132, 27, 178, 91, 2, 236, 249, 253, 12, 125, 152, 201, 75, 50, 218, 51, 195, 188,
+    130, 82, 25, 126, 39, 67, 243, 82, 2, 182, 44, 31, 17, 143, 120, 160, 5, 240, 28, 29, 60, 196, 115, 25, 243, 66,
+    134, 167, 139, 23, 91, 174, 104, 56, 112, 6, 176, 57, 157, 14, 146, 31, 54, 175, 228, 226, 204, 57, 83, 145, 120,
+    63, 115, 90, 17, 225, 5, 194, 231, 94, 39, 193, 206, 32, 3, 138, 197, 53, 159, 47, 208, 73, 216, 187, 6, 98, 90,
+    127, 129, 124, 183, 171, 90, 167, 69, 155, 56, 202, 1, 251, 21, 83, 166, 208, 254, 150, 218, 98, 26, 200, 55, 133,
+    111, 34, 24, 89, 200, 57, 218, 190, 116, 158, 239, 186, 247, 118, 127, 94, 60, 53, 165, 52, 29, 33, 42, 216, 81,
+    208, 132, 117, 52, 224, 191, 238, 188, 238, 192, 49, 235, 99, 181, 157, 26, 222, 168, 77, 132, 8, 253, 88, 155, 96,
+    219, 23, 134, 171, 104, 31, 218, 23, 33, 38, 228, 82, 137, 29, 34, 25, 138, 236, 133, 48, 150, 228, 59, 164, 127,
+    16, 140, 60, 190, 155, 80, 185, 43, 49, 28, 249, 139, 114, 69, 235, 62, 241, 15, 54, 10, 100, 16, 43, 211, 16, 249,
+    189, 235, 255, 247, 115, 63, 128, 5, 62, 39, 32, 45, 60, 187, 210, 16, 251, 232, 30, 245, 114, 190, 60, 209, 19, 83,
+    8, 28, 216, 233, 198, 186, 130, 121, 186, 206, 185, 112, 85, 118, 89, 159, 14, 167, 86, 185, 66, 24, 201, 8, 238,
+    149, 169, 219, 46, 173, 36, 223, 73, 188, 222, 116, 107, 218, 99, 153, 102, 158, 209, 81, 25, 172, 159, 38, 205, 8,
+    218, 252, 13, 59, 148, 117, 200, 68, 204, 44, 44, 108, 135, 138, 225, 195, 122, 155, 246, 204, 237, 200, 46, 252,
+    90, 135, 23, 35, 74, 92, 130, 81, 138, 187, 93, 2, 243, 87, 254, 105, 23, 23, 209, 181, 92, 87, 178, 212, 112, 130,
+    2, 78, 242, 76, 166, 89, 123, 72, 32, 141, 204, 51, 70, 87, 117, 92, 246, 84, 155, 30, 247, 182, 238, 81, 161, 66,
+    159, 121, 116, 158, 175, 107, 138, 120, 143, 16, 127, 195, 95, 221, 13, 92, 218, 52, 243, 126, 147, 43, 41, 153,
+    251, 26, 47, 72, 207, 101, 247, 196, 252, 67, 244, 81, 125, 177, 137, 194, 5, 169, 112, 139, 142, 179, 105, 94, 131,
+    81, 156, 13, 171, 63, 8, 216, 223, 151, 26, 49, 46, 185, 44, 35, 4, 74, 217, 133, 66, 211, 203, 147, 77, 97, 244,
+    211, 149, 127, 178, 3, 184, 219, 17, 0, 226, 36, 143, 60, 72, 17, 150, 5, 88, 184, 182, 224, 242, 237, 240, 179, 43,
+    248, 177, 30, 205, 48, 243, 152, 115, 83, 28, 53, 177, 36, 91, 180, 156, 33, 203, 113, 112, 75, 122, 30, 166, 178,
+    194, 136, 76, 29, 188, 37, 151, 125, 112, 125, 81, 64, 148, 93, 142, 58, 192, 121, 12, 61, 175, 243, 218, 145, 203,
+    208, 13, 157, 8, 37, 79, 73, 230, 64, 147, 213, 61, 18, 196, 213, 92, 162, 89, 58, 238, 104, 138, 67, 249, 231, 77,
+    172, 242, 89, 160, 144, 239, 205, 169, 46, 146, 240, 22, 185, 97, 211, 103, 58, 234, 152, 149, 136, 219, 31, 170,
+    132, 206, 248, 225, 96, 206, 146, 76, 197, 82, 106, 45, 210, 26, 83, 225, 199, 58, 171, 186, 127, 167, 143, 157,
+    211, 115, 89, 187, 209, 88, 15, 174, 150, 234, 49, 80, 23, 146, 64, 19, 216, 35, 120, 100, 89, 11, 15, 21, 185, 143,
+    97, 92, 181, 185, 65, 204, 29, 248, 205, 250, 148, 170, 41, 63, 242, 247, 201, 222, 72, 173, 238, 3, 155, 121, 199,
+    110, 120, 78, 32, 78, 164, 130, 243, 200, 82, 103, 253, 148, 66, 65, 55, 0, 190, 197, 199, 184, 55, 192, 209, 247,
+    50, 5, 47, 46, 26, 37, 13, 51, 72, 62, 107, 65, 163, 233, 140, 73, 112, 122, 36, 203, 152, 151, 141, 142, 101, 127,
+    31, 64, 107, 4, 109, 21, 178, 160, 226, 50, 3, 176, 48, 174, 74, 69, 97, 234, 237, 91, 240, 63, 203, 146, 149, 223,
+    93, 135, 179, 220, 183, 238, 107, 97, 134, 17, 32, 105, 235, 102, 193, 214, 223, 217, 145, 187, 12, 51, 57, 176,
+    223, 62, 4, 146, 34, 3, 23, 181, 227, 6, 184, 224, 115, 22, 108, 22, 252, 151, 20, 85, 111, 90, 27, 49, 220, 72,
+    152, 187, 255, 145, 53, 241, 228, 111, 107, 209, 34, 177, 247, 16, 53, 124, 121, 190, 31, 84, 215, 76, 209, 203, 61,
+    180, 81, 108, 209, 171, 162, 0, 190, 41, 36, 86, 216, 92, 138, 100, 117, 230, 144, 144, 42, 248, 241, 244, 105, 66,
+    50, 17, 16, 243, 55, 159, 44, 125, 179, 250, 190, 32, 233, 197, 92, 174, 11, 170, 242, 164, 20, 157, 178, 217, 51,
+    100, 105, 249, 0, 138, 19, 60, 5, 170, 111, 61, 180, 183, 82, 75, 96, 173, 34, 23, 213, 28, 252, 144, 148, 233, 79,
+    41, 163, 173, 237, 210, 36, 38, 76, 89, 195, 158, 254, 61, 155, 22, 211, 149, 137, 75, 39, 143, 111, 106, 125, 84,
+    200, 195, 38, 52, 112, 187, 102, 194, 128, 69, 119, 41, 252, 124, 36, 62, 77, 74, 201, 81, 139, 89, 222, 76, 146,
+    247, 207, 86, 183, 211, 23, 160, 243, 255, 199, 115, 134, 162, 184, 2, 169, 96, 40, 130, 57, 47, 5, 235, 50, 245,
+    209, 243, 37, 71, 39, 162, 234, 61, 197, 117, 143, 131, 183, 144, 10, 63, 199, 109, 222, 114, 50, 59, 85, 193, 99,
+    155, 63, 55, 122, 113, 146, 139, 194, 155, 145, 243, 230, 143, 40, 104, 196, 144, 63, 245, 180, 16, 129, 213, 102,
+    83, 164, 231, 158, 94, 44, 141, 142, 132, 50, 33, 15, 60, 114, 205, 119, 56, 31, 241, 140, 12, 237, 220, 201, 140,
+    49, 53, 207, 117, 24, 49, 217, 37, 199, 94, 0, 164, 58, 170, 12, 150, 22, 28, 193, 42, 210, 145, 168, 183, 148, 118,
+    3, 75, 220, 149, 193, 222, 194, 183, 30, 112, 86, 240, 47, 90, 85, 184, 41, 83, 208, 202, 76, 225, 246, 110, 50, 80,
+    224, 174, 204, 39, 119, 13, 57, 183, 90, 194, 66, 100, 247, 156, 240, 239, 248, 76, 139, 142, 49, 195, 119, 144,
+    140, 2, 59, 203, 135, 158, 93, 235, 114, 0, 100, 38, 170, 232, 123, 218, 243, 97, 0, 97, 239, 203, 22, 163, 173,
+    220, 171, 146, 128, 112, 90, 137, 105, 239, 135, 28, 38, 186, 82, 44, 6, 86, 37, 145, 87, 13, 67, 211, 59, 218, 239,
+    120, 4, 203, 56, 196, 169, 164, 41, 185, 26, 180, 98, 130, 112, 49, 180, 98, 28, 226, 215, 145, 107, 124, 171, 176,
+    150, 118, 22, 11, 246, 161, 123, 19, 185, 241, 124, 33, 14, 204, 230, 66, 42, 91, 11, 28, 184, 173, 154, 123, 141,
+    61, 11, 145, 91, 209, 183, 172, 39, 180, 148, 195, 249, 69, 101, 247, 109, 90, 130, 219, 125, 170, 157, 252, 225,
+    119, 205, 192, 111, 224, 39, 132, 211, 54, 217, 88, 156, 11, 52, 58, 55, 42, 220, 15, 183, 184, 232, 74, 198, 72,
+    128, 205, 85, 132, 205, 164, 238, 123, 75, 187, 188, 215, 87, 152, 74, 151, 244, 214, 0, 121, 62, 168, 58, 172, 26,
+    122, 137, 50, 23, 1, 83, 94, 241, 137, 169, 112, 193, 70, 186, 64, 5, 234, 54, 190, 205, 97, 159, 102, 64, 107, 69,
+    242, 207, 205, 102, 43, 227, 61, 56, 255, 119, 33, 99, 82, 72, 30, 210, 79, 184, 20, 129, 122, 95, 120, 142, 213, 8,
+    212, 222, 58, 142, 151, 36, 106, 77, 238, 14, 103, 110, 170, 168, 163, 19, 163, 160, 147, 153, 2, 156, 15, 149, 181,
+    148, 35, 127, 95, 225, 198, 243, 156, 251, 214, 110, 82, 163, 142, 177, 16, 208, 69, 126, 192, 242, 11, 128, 4, 9,
+    42, 99, 207, 144, 247, 6, 223, 129, 121, 152, 88, 250, 120, 154, 53, 197, 196, 175, 129, 126, 112, 106, 217, 25,
+    183, 177, 208, 176, 166, 234, 115, 145, 105, 100, 186, 105, 83, 118, 201, 103, 43, 127, 122, 49, 95, 3, 133, 255,
+    135, 93, 179, 13, 96, 229, 56, 112, 170, 126, 208, 228, 54, 1, 103, 237, 17, 182, 70, 8, 230, 250, 79, 29, 49, 51,
+    17, 179, 167, 65, 89, 71, 24, 56, 25, 123, 67, 244, 42, 182, 49, 96, 117, 248, 25, 87, 158, 66, 96, 91, 90, 46, 233,
+    209, 10, 58, 121, 46, 1, 230, 56, 132, 208, 65, 137, 107, 12, 209, 140, 180, 78, 89, 131, 101, 84, 83, 227, 245, 48,
+    35, 186, 213, 246, 241, 106, 72, 110, 9, 180, 108, 184, 46, 221, 176, 122, 105, 226, 114, 166, 0, 36, 221, 172, 220,
+    49, 222, 91, 182, 201, 158, 199, 143, 234, 159, 94, 236, 250, 183, 120, 59, 56, 203, 120, 149, 242, 236, 26, 82,
+    116, 0, 20, 141, 228, 68, 210, 18, 6, 190, 181, 9, 158, 69, 154, 237, 72, 128, 201, 178, 134, 32, 151, 223, 111,
+    172, 114, 202, 40, 244, 107, 222, 142, 127, 131, 227, 207, 247, 243, 69, 107, 208, 134, 70, 136, 144, 180, 153, 42,
+    212, 143, 240, 198, 208, 193, 54, 151, 227, 106, 32, 146, 73, 35, 14, 116, 220, 197, 252, 38, 35, 14, 113, 48, 17,
+    214, 31, 222, 138, 132, 147, 13, 49, 74, 25, 190, 30, 195, 115, 238, 60, 153, 224, 27, 198, 96, 82, 51, 83, 46, 59,
+    182, 145, 255, 209, 164, 120, 244, 151, 217, 11, 166, 179, 198, 243, 124, 27, 109, 58, 152, 183, 14, 24, 69, 52,
+    152, 148, 197, 125, 33, 102, 228, 14, 241, 127, 20, 148, 163, 40, 30, 28, 241, 172, 162, 6, 53, 184, 135, 148, 178,
+    3, 120, 144, 185, 249, 218, 74, 64, 129, 245, 200, 33, 235, 111, 199, 251, 181, 252, 154, 88, 223, 196, 164, 180,
+    79, 179, 166, 108, 177, 193, 33, 223, 157, 199, 109, 180, 181, 3, 170, 112, 124, 32, 68, 230, 199, 76, 154, 118,
+    121, 9, 92, 11, 140, 255, 225, 152, 177, 110, 12, 61, 14, 227, 89, 77, 188, 142, 180, 5, 85, 25, 109, 152, 45, 191,
+    103, 63, 53, 87, 28, 25, 70, 11, 36, 42, 153, 112, 124, 175, 177, 42, 134, 137, 11, 134, 44, 43, 66, 162, 199, 126,
+    44, 110, 49, 209, 179, 201, 72, 200, 22, 188, 53, 33, 78, 203, 61, 49, 51, 179, 7, 168, 184, 83, 145, 75, 212, 109,
+    72, 193, 138, 198, 235, 124, 212, 15, 5, 99, 167, 190, 134, 140, 17, 215, 98, 87, 205, 24, 232, 44, 205, 12, 183,
+    173, 223, 237, 227, 104, 194, 224, 5, 211, 30, 47, 45, 212, 218, 190, 72, 182, 153, 9, 122, 97, 183, 52, 72, 185,
+    220, 86, 131, 21, 141, 24, 56, 29, 170, 136, 177, 95, 77, 183, 250, 152, 212, 170, 206, 82, 249, 161, 104, 255, 116,
+    239, 7, 4, 223, 178, 118, 56, 59, 197, 84, 225, 211, 254, 223, 240, 49, 19, 250, 213, 42, 214, 197, 16, 24, 5, 58,
+    247, 53, 205, 38, 227, 76, 249, 218, 168, 57, 211, 95, 132, 22, 226, 102, 144, 239, 131, 82, 130, 188, 145, 71, 126,
+    15, 129, 93, 151, 61, 233, 15, 190, 95, 224, 250, 50, 107, 143, 46, 137, 147, 205, 192, 23, 188, 89, 8, 175, 23,
+    135, 95, 72, 48, 86, 81, 67, 242, 248, 192, 168, 155, 195, 86, 179, 209, 248, 221, 150, 24, 73, 12, 70, 97, 2, 36,
+    201, 152, 216, 111, 97, 177, 146, 115, 192, 252, 211, 153, 109, 50, 220, 153, 80, 137, 112, 52, 37, 35, 94, 69, 238,
+    21, 252, 225, 137, 205, 99, 209, 138, 40, 94, 254, 171, 96, 69, 154, 182, 3, 120, 179, 75, 117, 8, 80, 191, 87, 4,
+    50, 43, 102, 19, 160, 165, 114, 48, 197, 214, 4, 240, 176, 179, 2, 194, 209, 22, 75, 135, 136, 216, 49, 115, 244,
+    184, 20, 93, 200, 5, 145, 148, 129, 242, 67, 121, 24, 73, 192, 44, 119, 23, 23, 206, 150, 230, 197, 159, 75, 23,
+    235, 24, 92, 181, 71, 67, 163, 93, 34, 204, 8, 37, 122, 114, 148, 169, 237, 108, 147, 188, 115, 239, 138, 199, 49,
+    21, 20, 166, 38, 171, 149, 98, 79, 221, 82, 149, 15, 211, 193, 168, 224, 221, 89, 113, 154, 132, 83, 125, 60, 143,
+    253, 160, 98, 123, 50, 188, 75, 163, 158, 55, 152, 20, 222, 202, 235, 185, 65, 253, 109, 95, 176, 196, 169, 244, 36,
+    118, 136, 92, 53, 13, 135, 242, 15, 220, 216, 221, 24, 63, 135, 155, 189, 74, 10, 237, 138, 156, 243, 165, 67, 77,
+    103, 135, 4, 28, 190, 231, 135, 52, 23, 228, 49, 226, 51, 81, 155, 137, 90, 146, 237, 88, 92, 132, 58, 19, 173, 3,
+    246, 8, 158, 28, 88, 183, 197, 170, 190, 250, 205, 235, 80, 74, 248, 210, 126, 154, 87, 98, 192, 12, 49, 200, 251,
+    235, 90, 211, 97, 147, 56, 104, 171, 53, 189, 157, 210, 72, 7, 157, 29, 180, 79, 102, 174, 53, 57, 170, 212, 199,
+    189, 111, 226, 174, 188, 237, 101, 28, 176, 95, 53, 152, 122, 216, 78, 241, 130, 19, 64, 46, 132, 41, 46, 23, 204,
+    134, 19, 200, 252, 66, 7, 151, 79, 15, 160, 1, 234, 226, 213, 98, 246, 242, 48, 160, 21, 171, 28, 200, 131, 157, 46,
+    155, 183, 85, 2, 109, 7, 217, 248, 171, 210, 247, 253, 55, 185, 16, 181, 55, 137, 61, 168, 15, 231, 175, 169, 136,
+    181, 101, 170, 82, 20, 7, 83, 206, 85, 155, 79, 186, 19, 22, 5, 31, 198, 102, 53, 201, 40, 207, 58, 85, 193, 151,
+    240, 37, 197, 166, 225, 137, 132, 148, 230, 184, 189, 56, 223, 119, 2, 131, 12, 195, 246, 132, 24, 130, 51, 122,
+    207, 14, 195, 232, 74, 164, 8, 252, 246, 184, 101, 243, 98, 255, 115, 81, 94, 83, 212, 238, 33, 150, 110, 47, 6,
+    110, 37, 72, 82, 138, 192, 70, 14, 174, 146, 18, 11, 184, 99, 88, 155, 118, 12, 255, 164, 226, 23, 252, 224, 220,
+    20, 226, 182, 13, 16, 63, 254, 142, 115, 231, 177, 155, 120, 18, 114, 126, 194, 219, 186, 30, 226, 82, 91, 166, 200,
+    53, 226, 140, 198, 109, 75, 65, 240, 54, 235, 199, 151, 41, 194, 222, 205, 237, 63, 77, 13, 68, 107, 41, 131, 239,
+    177, 127, 244, 151, 184, 214, 35, 222, 13, 231, 168, 122, 26, 91, 147, 230, 108, 194, 68, 205, 234, 237, 169, 254,
+    61, 43, 212, 247, 236, 173, 202, 239, 19, 32, 228, 217, 168, 28, 224, 75, 164, 67, 129, 192, 74, 1, 92, 3, 4, 148,
+    210, 194, 212, 252, 192, 69, 117, 106, 42, 114, 83, 78, 181, 29, 150, 101, 107, 177, 167, 29, 210, 18, 237, 226,
+    161, 54, 94, 7, 207, 67, 241, 242, 149, 85, 1, 192, 115, 18, 179, 141, 229, 150, 193, 173, 75, 203, 132, 148, 54,
+    186, 96, 25, 59, 176, 96, 122, 115, 248, 107, 145, 17, 106, 16, 97, 95, 15, 81, 14, 71, 198, 34, 69, 151, 48, 138,
+    158, 231, 221, 153, 183, 85, 116, 29, 36, 132, 233, 1, 123, 89, 238, 47, 17, 51, 20, 112, 205, 210, 201, 156, 69,
+    10, 49, 65, 88, 128, 36, 39, 46, 57, 145, 185, 137, 156, 102, 128, 131, 222, 227, 122, 71, 13, 214, 173, 68, 198,
+    136, 25, 185, 110, 16, 251, 120, 170, 108, 227, 134, 146, 51, 197, 24, 27, 201, 167, 241, 66, 124, 182, 190, 88,
+    193, 86, 56, 6, 248, 236, 25, 131, 111, 25, 190, 38, 209, 151, 63, 154, 76, 146, 199, 242, 232, 239, 2, 128, 236,
+    92, 33, 0, 207, 252, 99, 80, 132, 30, 218, 226, 62, 204, 179, 97, 173, 55, 147, 97, 176, 221, 155, 106, 99, 93, 35,
+    12, 201, 131, 35, 140, 33, 245, 91, 162, 203, 124, 14, 4, 194, 64, 201, 164, 39, 61, 236, 135, 131, 200, 98, 186,
+    197, 130, 101, 243, 155, 55, 96, 41, 64, 158, 47, 1, 61, 224, 9, 197, 92, 186, 68, 141, 169, 169, 0, 73, 97, 17,
+    180, 223, 141, 78, 90, 125, 88, 141, 179, 232, 173, 130, 115, 117, 8, 188, 233, 186, 152, 50, 144, 17, 159, 127,
+    130, 179, 6, 118, 49, 239, 154, 211, 137, 15, 154, 81, 38, 68, 223, 53, 76, 87, 171, 94, 52, 114, 100, 53, 3, 204,
+    118, 93, 61, 180, 82, 143, 152, 36, 107, 112, 108, 250, 129, 202, 103, 23, 133, 170, 127, 204, 204, 30, 94, 130, 23,
+    157, 55, 39, 181, 253, 3, 47, 158, 112, 207, 40, 162, 165, 37, 87, 18, 98, 145, 161, 69, 212, 103, 105, 5, 96, 157,
+    4, 21, 159, 183, 158, 125, 144, 146, 28, 27, 184, 51, 140, 201, 36, 94, 102, 213, 125, 79, 133, 255, 52, 156, 194,
+    167, 157, 190, 97, 8, 83, 148, 54, 159, 208, 188, 22, 94, 96, 77, 171, 109, 80, 27, 37, 74, 101, 240, 144, 133, 213,
+    246, 82, 242, 209, 76, 249, 79, 166, 71, 242, 211, 238, 158, 142, 232, 174, 201, 214, 231, 91, 145, 23, 38, 135, 78,
+    125, 152, 24, 113, 206, 184, 49, 148, 117, 75, 159, 21, 112, 21, 8, 77, 128, 65, 238, 135, 219, 245, 95, 147, 73,
+    164, 79, 22, 177, 102, 181, 38, 32, 18, 21, 182, 178, 35, 48, 0, 209, 109, 186, 150, 44, 241, 122, 252, 113, 34, 11,
+    233, 244, 182, 213, 220, 20, 161, 41, 221, 164, 245, 12, 252, 32, 71, 231, 162, 132, 135, 246, 125, 1, 236, 71, 137,
+    191, 116, 250, 255, 93, 7, 87, 249, 169, 218, 186, 189, 66, 161, 171, 180, 167, 113, 88, 3, 32, 146, 3, 207, 46,
+    147, 165, 255, 64, 9, 125, 219, 133, 60, 84, 145, 188, 151, 12, 45, 240, 111, 103, 155, 63, 138, 255, 7, 182, 239,
+    62, 57, 169, 13, 127, 63, 221, 187, 240, 4, 255, 147, 100, 80, 124, 57, 254, 24, 129, 7, 136, 59, 104, 34, 39, 7, 0,
+    7, 78, 123, 161, 142, 249, 107, 67, 61, 214, 183, 94, 60, 61, 187, 237, 213, 72, 128, 166, 100, 18, 192, 66, 110,
+    81, 228, 82, 101, 170, 66, 201, 220, 208, 17, 187, 190, 217, 44, 255, 88, 160, 254, 237, 128, 109, 222, 224, 168,
+    236, 122, 151, 188, 234, 177, 137, 179, 252, 245, 191, 130, 236, 59, 196, 250, 181, 145, 130, 78, 200, 76, 99, 178,
+    247, 136, 210, 144, 22, 175, 40, 212, 35, 7, 75, 21, 26, 161, 187, 188, 128, 249, 20, 3, 51, 52, 55, 84, 146, 248,
+    236, 118, 121, 19, 157, 62, 83, 151, 117, 250, 16, 128, 245, 158, 241, 214, 27, 168, 247, 10, 241, 39, 39, 93, 72,
+    204, 166, 241, 65, 140, 4, 20, 100, 13, 158, 60, 169, 231, 39, 222, 200, 112, 168, 157, 123, 177, 115, 44, 65, 12,
+    97, 53, 206, 96, 16, 109, 102, 46, 58, 161, 247, 191, 254, 112, 178, 51, 42, 38, 175, 38, 58, 93, 201, 155, 1, 94,
+    19, 201, 253, 157, 248, 146, 74, 107, 155, 97, 195, 92, 60, 164, 219, 200, 149, 44, 160, 111, 36, 72, 124, 109, 104,
+    20, 40, 170, 53, 27, 47, 38, 4, 190, 55, 74, 125, 24, 169, 249, 232, 23, 75, 57, 26, 19, 62, 51, 49, 217, 192, 173,
+    111, 236, 116, 138, 85, 195, 152, 89, 25, 121, 147, 91, 154, 201, 37, 136, 29, 200, 82, 38, 118, 155, 141, 22, 219,
+    182, 35, 81, 106, 41, 135, 214, 226, 155, 161, 11, 57, 240, 152, 132, 104, 61, 171, 5, 87, 14, 140, 133, 181, 34,
+    32, 76, 115, 28, 234, 199, 118, 88, 195, 109, 163, 54, 254, 246, 235, 255, 123, 242, 110, 52, 185, 127, 10, 150, 55,
+    82, 193, 98, 125, 24, 95, 227, 77, 253, 139, 244, 242, 233, 89, 121, 220, 4, 51, 78, 78, 97, 74, 175, 55, 149, 8,
+    210, 182, 57, 146, 62, 116, 1, 201, 31, 152, 221, 188, 22, 255, 88, 90, 7, 75, 125, 71, 97, 209, 110, 169, 30, 66,
+    152, 197, 35, 211, 109, 151, 16, 109, 78, 76, 125, 5, 74, 69, 13, 245, 12, 211, 180, 1, 170, 124, 164, 221, 242, 7,
+    145, 31, 48, 64, 65, 214, 72, 241, 84, 74, 45, 16, 232, 179, 61, 200, 43, 1, 186, 53, 91, 222, 38, 50, 2, 33, 89,
+    211, 38, 251, 242, 201, 199, 166, 144, 59, 255, 204, 130, 240, 87, 129, 94, 236, 78, 230, 183, 125, 117, 176, 172,
+    173, 231, 231, 111, 44, 215, 112, 87, 177, 44, 111, 150, 130, 202, 182, 50, 145, 56, 75, 199, 157, 167, 117, 152,
+    245, 123, 25, 209, 80, 149, 168, 112, 182, 198, 55, 4, 175, 48, 227, 96, 170, 61, 214, 30, 187, 134, 68, 201, 80,
+    204, 225, 36, 118, 171, 51, 166, 224, 57, 48, 44, 86, 91, 221, 112, 104, 21, 128, 207, 34, 3, 216, 171, 10, 191,
+    166, 37, 50, 243, 39, 146, 105, 3, 53, 230, 20, 19, 60, 73, 44, 242, 131, 64, 161, 145, 57, 238, 103, 82, 207, 231,
+    71, 113, 255, 181, 104, 52, 97, 128, 164, 147, 101, 168, 119, 196, 40, 187, 28, 192, 134, 63, 201, 31, 153, 244, 9,
+    56, 121, 84, 81, 88, 18, 228, 74, 212, 198, 32, 72, 76, 152, 168, 238, 106, 31, 92, 139, 79, 120, 36, 190, 2, 127,
+    63, 186, 246, 246, 222, 34, 81, 86, 12, 119, 40, 44, 83, 26, 135, 115, 103, 77, 42, 243, 58, 198, 87, 69, 213, 213,
+    191, 243, 108, 194, 169, 171, 32, 159, 181, 186, 173, 184, 155, 244, 21, 22, 66, 4, 158, 178, 107, 243, 145, 13,
+    109, 185, 213, 117, 99, 241, 41, 187, 14, 108, 210, 171, 2, 118, 173, 255, 88, 38, 227, 251, 123, 20, 186, 177, 199,
+    182, 225, 16, 118, 66, 123, 122, 244, 79, 198, 157, 134, 254, 73, 123, 165, 9, 237, 239, 28, 123, 119, 98, 205, 235,
+    17, 53, 197, 237, 179, 2, 164, 62, 146, 155, 24, 222, 101, 161, 165, 67, 168, 139, 95, 218, 89, 78, 173, 84, 3, 104,
+    234, 114, 85, 28, 132, 171, 26, 78, 156, 159, 36, 13, 117, 148, 90, 50, 166, 240, 178, 79, 248, 46, 14, 94, 140,
+    153, 171, 196, 92, 9, 140, 71, 84, 212, 217, 102, 204, 78, 224, 14, 21, 233, 128, 37, 193, 60, 16, 225, 126, 211,
+    93, 84, 164, 118, 230, 229, 25, 241, 151, 84, 39, 96, 34, 142, 153, 35, 204, 120, 127, 186, 146, 220, 66, 63, 206,
+    1, 206, 232, 9, 133, 60, 223, 43, 159, 13, 172, 172, 219, 122, 221, 254, 73, 111, 244, 55, 136, 228, 48, 5, 110,
+    189, 98, 34, 248, 97, 86, 171, 29, 19, 55, 113, 227, 75, 89, 207, 119, 42, 142, 203, 239, 12, 44, 179, 93, 74, 94,
+    180, 193, 162, 198, 207, 16, 42, 107, 54, 79, 51, 154, 106, 201, 75, 157, 150, 34, 49, 96, 194, 234, 126, 58, 121,
+    201, 220, 35, 142, 170, 180, 214, 99, 4, 79, 87, 222, 191, 133, 121, 150, 157, 117, 196, 109, 117, 158, 68, 54, 141,
+    50, 119, 182, 137, 252, 112, 198, 247, 228, 126, 15, 215, 127, 145, 25, 30, 251, 247, 29, 86, 48, 176, 188, 111,
+    102, 89, 253, 235, 56, 128, 205, 114, 43, 1, 253, 97, 230, 88, 47, 120, 87, 80, 87, 179, 13, 206, 62, 36, 19, 55,
+    157, 226, 24, 47, 231, 106, 222, 58, 42, 232, 87, 242, 153, 36, 130, 4, 198, 86, 164, 47, 226, 146, 211, 179, 106,
+    6, 19, 17, 139, 215, 204, 107, 60, 171, 21, 73, 102, 127, 176, 245, 1, 12, 38, 10, 30, 14, 134, 104, 227, 154, 202,
+    156, 220, 209, 133, 6, 192, 248, 35, 76, 98, 133, 214, 111, 35, 66, 128, 66, 3, 131, 20, 98, 89, 44, 27, 35, 76, 61,
+    50, 58, 48, 181, 214, 34, 92, 36, 191, 216, 4, 50, 193, 238, 221, 147, 86, 28, 105, 172, 135, 15, 237, 102, 103,
+    180, 39, 201, 180, 19, 28, 48, 46, 5, 57, 16, 187, 113, 64, 47, 19, 172, 145, 240, 184, 149, 120, 244, 167, 152,
+    122, 220, 93, 227, 217, 32, 142, 243, 224, 156, 164, 204, 247, 95, 202, 160, 250, 175, 74, 207, 115, 45, 230, 246,
+    250, 182, 197, 10, 237, 97, 219, 103, 4, 232, 20, 225, 92, 191, 125, 91, 190, 114, 206, 50, 93, 159, 136, 44, 115,
+    240, 58, 80, 243, 241, 182, 230, 164, 203, 78, 58, 70, 103, 158, 52, 174, 121, 115, 35, 154, 23, 120, 76, 22, 182,
+    243, 208, 74, 51, 69, 181, 238, 93, 13, 85, 168, 240, 154, 197, 182, 115, 250, 15, 87, 166, 155, 92, 199, 215, 229,
+    129, 79, 197, 167, 155, 151, 174, 117, 130, 67, 135, 85, 99, 110, 92, 245, 3, 3, 6, 29, 187, 118, 25, 226, 90, 124,
+    2, 80, 242, 101, 186, 13, 40, 181, 176, 147, 58, 184, 243, 208, 229, 154, 55, 215, 200, 189, 158, 124, 207, 99, 119,
+    63, 45, 225, 167, 255, 200, 226, 130, 114, 99, 131, 73, 74, 167, 9, 105, 96, 234, 245, 21, 135, 62, 7, 149, 178, 93,
+    184, 9, 2, 160, 51, 232, 202, 186, 7, 2, 196, 200, 192, 220, 66, 181, 43, 156, 173, 195, 5, 181, 184, 40, 15, 45,
+    210, 56, 5, 220, 30, 116, 43, 45, 56, 20, 111, 117, 253, 249, 92, 134, 81, 125, 23, 240, 234, 108, 8, 107, 201, 154,
+    249, 143, 16, 243, 251, 157, 147, 228, 96, 19, 202, 180, 210, 83, 40, 18, 71, 78, 65, 205, 29, 192, 87, 52, 222, 75,
+    144, 253, 17, 33, 79, 51, 151, 89, 244, 222, 167, 213, 160, 198, 217, 62, 252, 81, 47, 196, 219, 90, 43, 88, 155,
+    230, 204, 180, 187, 202, 16, 185, 52, 255, 239, 238, 26, 9, 133, 198, 100, 245, 24, 200, 0, 200, 5, 193, 37, 106,
+    155, 106, 255, 125, 246, 143, 38, 39, 152, 103, 77, 16, 183, 19, 174, 181, 14, 120, 67, 251, 156, 220, 37, 127, 145,
+    198, 47, 10, 103, 161, 72, 64, 80, 106, 79, 187, 215, 93, 134, 168, 121, 166, 80, 10, 169, 181, 26, 25, 206, 86, 27,
+    192, 35, 105, 222, 251, 21, 179, 24, 193, 101, 85, 125, 32, 163, 65, 237, 78, 48, 113, 51, 22, 105, 223, 31, 75,
+    143, 158, 186, 204, 243, 187, 113, 170, 126, 83, 87, 54, 85, 132, 175, 104, 68, 217, 139, 90, 232, 3, 48, 36, 15,
+    153, 5, 223, 59, 151, 151, 38, 207, 80, 159, 146, 8, 44, 113, 88, 193, 28, 181, 24, 103, 255, 237, 108, 145, 181,
+    215, 17, 70, 24, 123, 232, 206, 124, 254, 56, 241, 242, 210, 159, 154, 227, 212, 178, 128, 165, 206, 118, 78, 70,
+    84, 46, 214, 162, 241, 73, 73, 107, 159, 69, 220, 216, 254, 170, 14, 191, 209, 242, 191, 210, 251, 58, 168, 52, 228,
+    103, 16, 168, 237, 234, 9, 211, 101, 97, 226, 134, 38, 167, 120, 40, 18, 137, 158, 229, 80, 13, 177, 95, 194, 83,
+    229, 184, 181, 161, 42, 176, 83, 154, 180, 155, 22, 21, 159, 40, 152, 136, 248, 67, 243, 153, 216, 238, 184, 210,
+    183, 94, 70, 125, 178, 220, 233, 11, 152, 171, 105, 241, 69, 177, 27, 159, 142, 43, 77, 250, 93, 185, 35, 171, 175,
+    246, 29, 19, 234, 190, 58, 14, 192, 29, 7, 167, 107, 223, 37, 167, 35, 116, 211, 42, 148, 148, 73, 205, 185, 65,
+    232, 214, 243, 160, 97, 135, 155, 112, 73, 127, 106, 205, 79, 90, 242, 255, 3, 174, 60, 187, 21, 224, 100, 12, 105,
+    245, 217, 184, 91, 193, 143, 202, 211, 67, 7, 53, 215, 158, 43, 164, 93, 105, 34, 57, 248, 21, 33, 150, 139, 102,
+    200, 173, 223, 1, 177, 174, 167, 124, 3, 255, 106, 149, 185, 122, 92, 206, 168, 128, 31, 121, 144, 6, 201, 21, 160,
+    249, 140, 216, 190, 51, 50, 144, 143, 58, 91, 18, 194, 215, 183, 238, 187, 70, 179, 27, 161, 0, 16, 152, 1, 96, 208,
+    227, 225, 224, 8, 245, 112, 24, 149, 92, 155, 19, 191, 84, 126, 174, 11, 117, 173, 108, 59, 174, 101, 223, 109, 85,
+    239, 248, 110, 14, 127, 1, 142, 85, 231, 157, 153, 208, 162, 22, 223, 195, 188, 34, 185, 128, 191, 158, 55, 155,
+    244, 208, 99, 90, 18, 18, 102, 142, 110, 151, 229, 244, 135, 29, 84, 96, 55, 39, 234, 0, 148, 172, 32, 238, 197, 70,
+    190, 178, 58, 85, 251, 34, 182, 150, 46, 196, 127, 63, 57, 115, 151, 53, 213, 41, 39, 155, 65, 154, 38, 43, 221, 11,
+    206, 179, 73, 76, 135, 252, 130, 192, 7, 4, 124, 8, 1, 185, 39, 2, 220, 136, 36, 132, 8, 215, 153, 127, 127, 79, 14,
+    232, 16, 139, 222, 90, 217, 88, 123, 185, 60, 255, 238, 132, 220, 225, 30, 72, 168, 29, 155, 215, 129, 146, 133,
+    137, 5, 61, 197, 186, 48, 46, 249, 94, 150, 11, 43, 94, 204, 120, 68, 162, 178, 107, 205, 181, 207, 157, 129, 251,
+    166, 154, 128, 209, 183, 137, 30, 164, 170, 159, 191, 136, 229, 1, 103, 95, 167, 45, 23, 6, 251, 29, 99, 153, 81,
+    122, 247, 60, 146, 27, 169, 231, 116, 15, 178, 187, 42, 117, 177, 15, 110, 127, 225, 41, 30, 143, 71, 140, 80, 169,
+    144, 49, 168, 56, 135, 142, 28, 21, 158, 237, 184, 38, 110, 173, 50, 254, 113, 183, 220, 51, 195, 63, 6, 115, 53,
+    31, 194, 105, 117, 89, 154, 242, 142, 85, 190, 124, 36, 101, 34, 31, 96, 180, 8, 90, 114, 65, 53, 196, 106, 4, 188,
+    148, 175, 204, 63, 197, 43, 155, 160, 45, 70, 128, 221, 230, 192, 81, 62, 117, 78, 168, 42, 20, 33, 204, 225, 28,
+    130, 5, 196, 151, 10, 169, 81, 122, 77, 52, 150, 146, 52, 149, 91, 37, 250, 192, 54, 142, 115, 32, 77, 229, 128,
+    155, 69, 227, 176, 92, 159, 108, 182, 67, 171, 150, 7, 149, 111, 88, 43, 212, 11, 73, 151, 133, 47, 125, 77, 207,
+    250, 50, 189, 201, 216, 56, 163, 158, 80, 211, 50, 3, 0, 118, 7, 179, 205, 38, 157, 198, 192, 163, 27, 86, 35, 161,
+    29, 237, 222, 31, 23, 63, 64, 115, 9, 213, 68, 161, 225, 0, 96, 66, 109, 76, 61, 141, 138, 100, 28, 78, 234, 82, 66,
+    101, 143, 182, 104, 137, 206, 216, 242, 35, 153, 185, 193, 207, 168, 108, 67, 119, 6, 131, 58, 238, 174, 102, 106,
+    4, 11, 53, 179, 6, 218, 65, 68, 108, 141, 86, 14, 100, 58, 40, 211, 172, 103, 251, 47, 90, 64, 20, 156, 224, 174,
+    203, 24, 62, 142, 21, 52, 213, 151, 30, 80, 27, 196, 59, 75, 59, 13, 185, 7, 70, 197, 234, 215, 188, 213, 223, 187,
+    114, 45, 17, 83, 225, 153, 70, 232, 147, 26, 233, 199, 71, 35, 136, 254, 223, 6, 195, 167, 29, 58, 164, 202, 227,
+    77, 132, 124, 184, 154, 4, 40, 250, 61, 233, 146, 28, 51, 158, 31, 184, 110, 73, 132, 151, 17, 137, 13, 251, 3, 62,
+    38, 155, 251, 134, 9, 240, 237, 194, 63, 253, 81, 62, 154, 131, 117, 132, 59, 81, 100, 154, 142, 147, 191, 79, 208,
+    13, 1, 166, 150, 249, 68, 18, 253, 219, 251, 168, 150, 125, 7, 97, 34, 161, 233, 200, 145, 182, 165, 238, 53, 157,
+    68, 135, 22, 232, 103, 246, 36, 246, 151, 168, 140, 184, 92, 3, 125, 212, 136, 53, 89, 56, 56, 147, 175, 226, 154,
+    241, 32, 94, 47, 94, 142, 33, 157, 22, 69, 181, 177, 252, 178, 236, 125, 164, 174, 231, 125, 198, 21, 159, 116, 37,
+    207, 100, 139, 57, 73, 207, 190, 72, 3, 176, 242, 246, 136, 24, 8, 238, 91, 146, 248, 143, 246, 60, 244, 181, 121,
+    118, 96, 97, 166, 4, 150, 222, 28, 158, 211, 61, 74, 25, 132, 187, 60, 70, 181, 150, 50, 116, 71, 245, 191, 209, 35,
+    169, 161, 59, 160, 26, 146, 34, 205, 7, 133, 116, 93, 85, 95, 87, 199, 136, 122, 161, 51, 30, 87, 31, 69, 210, 96,
+    175, 176, 83, 213, 196, 194, 120, 200, 80, 56, 30, 193, 166, 19, 251, 241, 193, 100, 23, 4, 117, 107, 248, 147, 215,
+    129, 178, 194, 179, 51, 89, 219, 251, 28, 25, 66, 71, 47, 33, 170, 10, 74, 70, 206, 25, 181, 219, 113, 242, 239,
+    222, 181, 77, 122, 170, 87, 254, 142, 32, 135, 148, 117, 218, 140, 55, 2, 7, 74, 105, 210, 98, 41, 125, 208, 240,
+    163, 93, 36, 162, 73, 138, 59, 64, 103, 176, 215, 226, 54, 251, 28, 9, 200, 58, 102, 83, 174, 241, 225, 230, 83, 92,
+    162, 46, 158, 118, 31, 203, 153, 60, 163, 111, 83, 228, 56, 31, 199, 1, 189, 113, 216, 3, 122, 14, 234, 187, 91, 40,
+    251, 255, 30, 185, 118, 251, 232, 207, 15, 84, 211, 51, 152, 128, 247, 223, 242, 16, 65, 57, 110, 223, 89, 110, 255,
+    124, 229, 101, 81, 93, 228, 59, 33, 45, 10, 216, 253, 195, 41, 44, 191, 93, 245, 188, 35, 146, 158, 232, 46, 91, 68,
+    203, 206, 110, 188, 241, 203, 206, 85, 141, 123, 167, 174, 133, 190, 183, 209, 241, 74, 31, 93, 203, 48, 189, 166,
+    109, 11, 59, 74, 149, 102, 23, 150, 250, 73, 134, 69, 253, 236, 220, 30, 207, 197, 147, 18, 25, 163, 61, 18, 19, 17,
+    44, 245, 92, 189, 211, 101, 77, 153, 32, 40, 233, 9, 17, 101, 246, 187, 162, 209, 195, 111, 174, 65, 106, 179, 129,
+    249, 206, 57, 151, 170, 97, 181, 143, 247, 111, 240, 108, 52, 227, 233, 252, 31, 176, 108, 208, 169, 215, 179, 55,
+    7, 203, 163, 195, 202, 84, 126, 158, 28, 74, 193, 6, 81, 245, 213, 30, 132, 226, 225, 111, 180, 164, 72, 29, 45,
+    177, 25, 110, 222, 175, 235, 33, 6, 0, 50, 72, 251, 29, 57, 191, 61, 6, 249, 187, 144, 83, 134, 202, 21, 254, 30,
+    67, 181, 156, 134, 11, 11, 150, 22, 179, 34, 118, 47, 196, 161, 237, 4, 221, 226, 119, 145, 97, 150, 127, 168, 115,
+    162, 68, 111, 40, 54, 185, 236, 200, 10, 69, 114, 9, 146, 74, 239, 135, 236, 222, 218, 88, 36, 160, 123, 16, 22,
+    205, 85, 251, 118, 40, 89, 134, 173, 225, 28, 29, 197, 204, 196, 36, 166, 75, 231, 92, 33, 127, 1, 117, 26, 67, 132,
+    9, 174, 48, 202, 40, 104, 178, 90, 248, 4, 108, 181, 117, 112, 194, 230, 39, 54, 127, 191, 185, 18, 173, 251, 102,
+    6, 169, 66, 119, 111, 99, 18, 219, 142, 251, 206, 238, 0, 252, 139, 144, 164, 154, 179, 231, 88, 156, 200, 178, 212,
+    111, 54, 172, 24, 154, 160, 188, 242, 219, 176, 243, 11, 54, 59, 84, 121, 13, 44, 119, 135, 73, 86, 142, 86, 37,
+    204, 42, 101, 63, 243, 125, 8, 228, 143, 44, 143, 71, 5, 107, 163, 166, 9, 182, 171, 204, 233, 186, 91, 61, 99, 79,
+    5, 58, 75, 123, 128, 157, 150, 214, 129, 129, 9, 100, 82, 71, 131, 206, 54, 181, 211, 168, 105, 80, 115, 213, 181,
+    30, 16, 213, 48, 196, 199, 68, 34, 96, 94, 217, 126, 88, 105, 42, 200, 67, 43, 111, 74, 93, 121, 74, 119, 224, 243,
+    217, 27, 144, 243, 21, 57, 147, 128, 96, 118, 207, 193, 100, 243, 239, 142, 68, 137, 81, 160, 244, 81, 191, 113,
+    115, 4, 35, 45, 84, 2, 190, 25, 196, 107, 248, 197, 40, 206, 64, 189, 127, 46, 120, 251, 159, 86, 80, 166, 7, 21,
+    103, 108, 125, 176, 119, 170, 204, 65, 215, 156, 168, 251, 235, 210, 45, 103, 79, 156, 209, 90, 140, 106, 170, 147,
+    92, 99, 203, 98, 42, 206, 187, 163, 195, 11, 236, 85, 131, 255, 226, 96, 14, 248, 36, 150, 2, 73, 157, 232, 248, 38,
+    212, 221, 126, 168, 19, 112, 209, 9, 224, 61, 164, 189, 51, 187, 122, 217, 148, 169, 170, 49, 147, 17, 63, 252, 87,
+    65, 24, 91, 229, 233, 206, 104, 161, 183, 227, 25, 119, 110, 97, 205, 85, 252, 201, 101, 45, 205, 137, 225, 7, 29,
+    108, 21, 129, 115, 139, 109, 19, 249, 240, 20, 204, 15, 85, 250, 209, 76, 128, 180, 125, 160, 88, 88, 159, 242, 160,
+    63, 131, 140, 55, 205, 157, 153, 77, 28, 88, 134, 113, 129, 110, 104, 252, 230, 60, 37, 0, 7, 246, 73, 114, 206,
+    183, 41, 167, 251, 254, 58, 63, 96, 212, 2, 220, 232, 249, 134, 52, 157, 32, 234, 222, 129, 77, 151, 238, 7, 145, 1,
+    53, 152, 186, 49, 96, 90, 207, 150, 145, 92, 202, 47, 154, 169, 165, 67, 226, 181, 210, 96, 129, 225, 70, 126, 255,
+    77, 9, 113, 215, 168, 156, 111, 251, 87, 163, 23, 245, 191, 37, 4, 224, 59, 2, 18, 116, 59, 76, 79, 230, 27, 228, 9,
+    97, 111, 108, 152, 54, 75, 53, 186, 128, 201, 254, 187, 122, 13, 53, 246, 217, 153, 36, 129, 185, 3, 51, 84, 140,
+    112, 101, 143, 96, 126, 107, 54, 88, 97, 37, 104, 60, 17, 6, 72, 233, 47, 184, 117, 32, 6, 52, 112, 173, 99, 18, 30,
+    160, 204, 12, 223, 230, 21, 83, 157, 20, 56, 196, 129, 128, 44, 244, 79, 241, 70, 113, 59, 35, 51, 147, 202, 26,
+    160, 225, 43, 140, 41, 224, 176, 181, 45, 254, 31, 14, 170, 234, 220, 222, 219, 210, 80, 128, 164, 39, 60, 24, 93,
+    73, 164, 74, 150, 63, 150, 207, 155, 128, 95, 212, 115, 120, 71, 61, 210, 218, 92, 60, 140, 224, 210, 140, 20, 50,
+    65, 148, 93, 141, 250, 187, 213, 64, 241, 111, 50, 238, 106, 45, 124, 236, 193, 34, 146, 128, 120, 98, 96, 52, 236,
+    53, 91, 20, 86, 75, 134, 184, 33, 142, 176, 145, 101, 194, 68, 171, 211, 202, 231, 138, 92, 82, 105, 25, 15, 38,
+    133, 119, 210, 145, 81, 232, 150, 166, 76, 103, 154, 38, 44, 87, 105, 142, 189, 216, 182, 6, 132, 149, 80, 193, 135,
+    40, 20, 91, 20, 214, 9, 125, 79, 108, 108, 142, 129, 47, 213, 143, 157, 176, 213, 215, 54, 247, 2, 167, 214, 172,
+    191, 43, 136, 185, 24, 118, 6, 73, 152, 223, 76, 145, 13, 8, 53, 183, 58, 211, 80, 51, 14, 255, 22, 255, 76, 195,
+    216, 206, 227, 86, 204, 61, 113, 26, 253, 64, 13, 34, 108, 191, 158, 34, 26, 141, 6, 29, 64, 141, 19, 32, 219, 25,
+    254, 163, 116, 180, 156, 67, 204, 178, 126, 235, 154, 105, 117, 65, 131, 111, 127, 242, 113, 104, 119, 248, 19, 181,
+    103, 20, 222, 201, 174, 217, 40, 42, 120, 34, 51, 58, 70, 115, 99, 47, 253, 47, 3, 92, 176, 222, 16, 97, 199, 76,
+    94, 20, 54, 141, 41, 177, 128, 103, 93, 113, 90, 137, 111, 152, 69, 167, 140, 71, 40, 200, 5, 89, 0, 0, 93, 90, 179,
+    151, 190, 195, 196, 6, 107, 89, 241, 199, 100, 92, 212, 31, 247, 9, 66, 162, 222, 225, 175, 240, 8, 184, 199, 50,
+    168, 31, 179, 197, 37, 103, 51, 144, 220, 172, 128, 120, 79, 141, 94, 29, 137, 98, 148, 11, 156, 50, 95, 49, 165,
+    228, 82, 105, 134, 191, 51, 195, 74, 181, 245, 155, 3, 50, 158, 28, 112, 8, 25, 224, 225, 112, 6, 84, 216, 26, 246,
+    147, 189, 163, 55, 217, 70, 201, 163, 59, 48, 87, 117, 115, 234, 142, 121, 28, 247, 89, 213, 115, 208, 206, 59, 82,
+    181, 198, 193, 197, 251, 162, 163, 245, 7, 182, 40, 11, 113, 40, 25, 180, 93, 85, 178, 65, 45, 112, 227, 19, 223,
+    98, 31, 32, 73, 206, 208, 27, 82, 186, 181, 154, 11, 153, 167, 82, 65, 171, 210, 10, 234, 229, 201, 108, 243, 171,
+    195, 155, 132, 254, 187, 182, 203, 242, 206, 51, 35, 157, 62, 207, 65, 24, 222, 48, 225, 83, 122, 104, 168, 226,
+    120, 221, 165, 148, 150, 58, 96, 103, 175, 121, 104, 224, 156, 78, 185, 1, 79, 192, 241, 122, 13, 242, 98, 47, 237,
+    95, 77, 24, 114, 249, 136, 74, 241, 35, 66, 121, 19, 91, 209, 63, 227, 204, 186, 250, 207, 186, 1, 9, 17, 174, 181,
+    145, 99, 16, 232, 245, 95, 158, 156, 174, 141, 151, 215, 177, 248, 160, 198, 25, 244, 51, 115, 22, 149, 97, 35, 115,
+    67, 13, 114, 162, 189, 113, 195, 180, 114, 59, 232, 155, 42, 67, 160, 51, 182, 183, 178, 102, 199, 56, 59, 173, 238,
+    139, 185, 237, 74, 38, 13, 38, 22, 102, 53, 29, 158, 54, 208, 158, 162, 72, 65, 124, 190, 166, 231, 238, 158, 235,
+    112, 135, 210, 50, 242, 234, 44, 107, 32, 189, 151, 136, 41, 35, 207, 168, 180, 145, 204, 189, 223, 31, 25, 57, 101,
+    248, 95, 91, 227, 194, 25, 209, 65, 83, 77, 243, 77, 40, 144, 145, 174, 17, 8, 184, 154, 240, 250, 227, 209, 205,
+    70, 251, 167, 59, 167, 108, 248, 195, 57, 66, 69, 245, 189, 199, 67, 249, 11, 131, 138, 85, 77, 207, 134, 177, 128,
+    68, 9, 76, 112, 90, 32, 227, 243, 68, 33, 218, 86, 17, 73, 155, 239, 167, 151, 87, 58, 209, 225, 149, 156, 5, 227,
+    102, 166, 239, 160, 112, 251, 240, 230, 15, 27, 52, 219, 243, 206, 187, 16, 252, 146, 151, 44, 139, 236, 199, 99,
+    253, 100, 243, 68, 198, 162, 44, 157, 52, 81, 255, 90, 83, 26, 79, 190, 210, 207, 38, 174, 48, 198, 127, 123, 175,
+    106, 204, 162, 237, 210, 218, 33, 163, 245, 111, 74, 66, 253, 54, 68, 2, 83, 176, 194, 156, 40, 254, 21, 1, 212, 57,
+    162, 31, 100, 22, 232, 178, 69, 251, 228, 170, 199, 65, 216, 202, 122, 53, 12, 168, 79, 229, 186, 207, 167, 188,
+    148, 152, 99, 230, 173, 90, 11, 36, 190, 206, 157, 249, 252, 72, 20, 24, 183, 41, 67, 158, 43, 58, 218, 78, 226, 59,
+    153, 73, 91, 32, 98, 128, 79, 231, 21, 145, 86, 234, 50, 194, 4, 58, 148, 29, 136, 49, 130, 77, 28, 34, 99, 18, 102,
+    46, 19, 216, 14, 252, 17, 131, 1, 54, 18, 167, 171, 215, 69, 53, 243, 129, 135, 141, 153, 42, 204, 147, 215, 113, 5,
+    38, 35, 7, 59, 206, 114, 143, 61, 236, 102, 158, 254, 194, 229, 244, 156, 137, 224, 201, 133, 15, 39, 28, 229, 43,
+    65, 156, 252, 11, 237, 219, 254, 215, 101, 62, 166, 228, 245, 146, 143, 194, 97, 20, 251, 224, 115, 190, 148, 219,
+    88, 254, 167, 30, 134, 137, 184, 165, 98, 112, 93, 33, 105, 223, 228, 24, 66, 1, 100, 92, 101, 0, 20, 179, 200, 141,
+    255, 221, 170, 23, 244, 121, 81, 205, 10, 75, 217, 29, 4, 28, 179, 149, 186, 60, 244, 161, 111, 116, 253, 221, 139,
+    35, 57, 176, 15, 101, 195, 44, 96, 11, 175, 238, 142, 30, 247, 78, 180, 206, 193, 205, 165, 26, 169, 223, 51, 108,
+    22, 110, 100, 141, 29, 104, 255, 163, 106, 15, 21, 166, 234, 236, 223, 184, 72, 85, 96, 199, 109, 8, 180, 65, 188,
+    155, 218, 80, 84, 117, 251, 194, 63, 159, 126, 58, 241, 51, 174, 137, 170, 217, 136, 229, 6, 147, 246, 212, 81, 92,
+    101, 248, 61, 124, 166, 129, 9, 46, 79, 134, 131, 242, 145, 194, 205, 2, 214, 69, 71, 190, 209, 234, 191, 168, 211,
+    212, 227, 153, 61, 121, 43, 195, 158, 106, 37, 147, 160, 3, 197, 174, 222, 158, 167, 212, 105, 144, 222, 226, 118,
+    73, 55, 15, 107, 184, 87, 184, 120, 111, 73, 172, 238, 113, 28, 41, 244, 224, 184, 88, 201, 254, 138, 88, 205, 215,
+    4, 169, 96, 199, 125, 246, 242, 106, 40, 129, 62, 60, 29, 74, 196, 214, 131, 182, 235, 52, 152, 22, 52, 192, 144,
+    145, 156, 128, 170, 48, 26, 252, 177, 153, 28, 41, 13, 153, 181, 186, 35, 149, 110, 253, 195, 157, 104, 220, 68,
+    102, 224, 61, 72, 220, 4, 104, 105, 217, 21, 153, 179, 196, 200, 152, 84, 43, 76, 118, 246, 132, 61, 178, 11, 26,
+    117, 131, 1, 82, 72, 254, 235, 221, 181, 74, 170, 205, 137, 90, 255, 18, 80, 172, 191, 21, 0, 165, 114, 43, 228, 45,
+    243, 25, 13, 69, 232, 219, 0, 175, 160, 195, 217, 5, 236, 191, 249, 176, 215, 114, 31, 188, 41, 61, 149, 115, 43, 9,
+    21, 103, 67, 212, 64, 28, 143, 21, 101, 28, 116, 105, 174, 121, 68, 92, 41, 120, 226, 128, 76, 28, 240, 106, 151,
+    211, 43, 7, 231, 100, 100, 115, 123, 102, 175, 134, 157, 88, 122, 101, 170, 69, 47, 149, 186, 208, 21, 115, 130,
+    119, 60, 118, 199, 140, 202, 196, 182, 147, 167, 127, 57, 166, 246, 138, 22, 212, 177, 152, 210, 172, 49, 237, 65,
+    104, 210, 162, 190, 110, 162, 55, 124, 173, 90, 228, 76, 46, 168, 23, 186, 154, 143, 106, 1, 233, 20, 217, 230, 156,
+    174, 237, 139, 30, 105, 216, 45, 237, 104, 147, 83, 4, 12, 100, 162, 154, 3, 143, 172, 23, 72, 100, 227, 204, 67,
+    161, 200, 19, 29, 5, 213, 138, 140, 130, 243, 21, 113, 48, 83, 50, 104, 68, 74, 22, 89, 245, 9, 87, 211, 111, 75,
+    26, 127, 240, 138, 190, 62, 11, 33, 164, 151, 0, 20, 237, 193, 209, 112, 85, 150, 107, 21, 177, 15, 146, 140, 252,
+    129, 227, 247, 72, 167, 5, 89, 84, 172, 183, 156, 87, 102, 69, 106, 16, 71, 223, 47, 175, 201, 152, 26, 148, 91,
+    113, 175, 213, 17, 171, 134, 94, 10, 114, 42, 97, 98, 67, 194, 152, 69, 76, 30, 50, 60, 73, 80, 235, 67, 48, 140,
+    80, 99, 251, 108, 62, 216, 190, 157, 11, 172, 115, 110, 243, 65, 246, 133, 173, 2, 1, 37, 23, 244, 169, 20, 57, 93,
+    89, 211, 16, 154, 17, 204, 19, 183, 69, 38, 176, 201, 206, 21, 108, 17, 176, 215, 12, 2, 25, 173, 107, 32, 233, 52,
+    200, 179, 86, 62, 227, 200, 172, 145, 52, 139, 169, 24, 37, 213, 122, 169, 107, 48, 30, 60, 136, 127, 143, 34, 165,
+    178, 189, 136, 255, 79, 192, 67, 101, 96, 209, 23, 76, 164, 230, 28, 248, 89, 105, 87, 134, 29, 183, 11, 138, 74,
+    178, 123, 67, 105, 109, 80, 101, 233, 137, 52, 180, 224, 29, 49, 92, 122, 76, 230, 129, 5, 204, 28, 28, 205, 63, 98,
+    10, 117, 96, 74, 69, 252, 90, 72, 35, 238, 196, 65, 130, 226, 218, 164, 183, 233, 197, 209, 147, 157, 220, 45, 46,
+    168, 132, 121, 34, 150, 251, 2, 232, 61, 169, 72, 196, 69, 153, 19, 124, 51, 57, 133, 49, 195, 88, 159, 145, 249,
+    126, 78, 219, 245, 178, 137, 95, 237, 237, 64, 205, 163, 28, 158, 252, 183, 120, 139, 181, 255, 67, 162, 114, 163,
+    84, 117, 88, 167, 55, 217, 135, 126, 184, 55, 251, 142, 50, 60, 27, 101, 11, 155, 82, 219, 24, 233, 243, 161, 78,
+    94, 116, 79, 159, 163, 161, 189, 179, 150, 219, 255, 233, 226, 245, 26, 193, 172, 255, 224, 29, 89, 103, 0, 115, 14,
+    237, 183, 94, 238, 204, 81, 103, 102, 67, 91, 215, 102, 81, 47, 181, 0, 207, 130, 117, 253, 63, 241, 159, 39, 116,
+    202, 194, 176, 255, 123, 196, 254, 226, 2, 233, 50, 32, 218, 23, 112, 218, 38, 147, 78, 168, 5, 23, 199, 148, 148,
+    161, 159, 20, 70, 251, 30, 21, 226, 73, 234, 89, 111, 107, 123, 167, 205, 229, 132, 95, 101, 247, 124, 35, 54, 85,
+    160, 1, 64, 57, 107, 98, 33, 158, 103, 121, 167, 169, 145, 118, 159, 143, 81, 131, 218, 68, 75, 196, 82, 45, 108,
+    18, 15, 119, 107, 116, 78, 213, 200, 199, 91, 106, 221, 81, 27, 38, 158, 105, 121, 211, 112, 175, 14, 158, 228, 83,
+    158, 108, 86, 32, 27, 54, 126, 87, 5, 108, 125, 190, 108, 137, 67, 207, 42, 10, 154, 222, 106, 132, 186, 55, 103,
+    206, 5, 205, 24, 101, 82, 174, 148, 120, 31, 6, 36, 173, 20, 5, 222, 44, 107, 82, 210, 19, 196, 246, 191, 111, 169,
+    102, 31, 18, 143, 99, 75, 235, 245, 115, 75, 19, 195, 125, 15, 243, 53, 197, 113, 124, 40, 57, 29, 112, 112, 21, 34,
+    239, 106, 241, 234, 230, 8, 174, 71, 3, 120, 237, 202, 53, 63, 71, 122, 136, 50, 92, 124, 47, 9, 139, 131, 105, 24,
+    37, 97, 218, 54, 216, 109, 217, 62, 88, 149, 190, 165, 91, 171, 120, 113, 134, 42, 244, 192, 239, 148, 77, 201, 104,
+    119, 89, 239, 243, 38, 96, 234, 125, 148, 39, 193, 83, 16, 7, 40, 68, 79, 152, 61, 50, 37, 202, 39, 4, 119, 149, 29,
+    247, 155, 92, 115, 18, 247, 88, 220, 10, 150, 10, 120, 16, 212, 154, 41, 139, 243, 222, 253, 229, 237, 45, 13, 100,
+    158, 238, 149, 188, 213, 73, 223, 19, 237, 7, 24, 171, 12, 215, 19, 42, 26, 36, 147, 56, 219, 158, 61, 62, 50, 232,
+    81, 146, 163, 93, 18, 210, 121, 56, 247, 9, 245, 47, 134, 46, 150, 171, 160, 199, 30, 39, 233, 149, 29, 204, 131,
+    195, 250, 35, 226, 83, 206, 158, 58, 122, 236, 228, 99, 138, 91, 184, 142, 98, 248, 253, 71, 216, 189, 29, 243, 170,
+    118, 213, 69, 112, 253, 53, 58, 70, 219, 90, 176, 54, 130, 14, 171, 142, 145, 178, 114, 144, 26, 246, 18, 95, 234,
+    194, 255, 182, 100, 0, 169, 222, 180, 42, 59, 61, 203, 75, 207, 192, 15, 76, 216, 199, 33, 102, 139, 175, 67, 236,
+    72, 243, 81, 173, 168, 42, 40, 141, 173, 82, 249, 218, 146, 22, 136, 123, 164, 174, 3, 111, 213, 4, 28, 33, 240,
+    169, 233, 187, 75, 34, 22, 120, 110, 165, 250, 89, 6, 53, 121, 74, 172, 147, 247, 241, 66, 119, 7, 54, 145, 95, 171,
+    228, 97, 97, 155, 177, 172, 183, 1, 84, 161, 76, 46, 212, 253, 4, 68, 27, 234, 120, 167, 223, 133, 98, 205, 245,
+    104, 146, 69, 33, 152, 36, 198, 152, 1, 237, 239, 89, 222, 133, 47, 73, 10, 50, 69, 204, 233, 248, 6, 32, 91, 81,
+    242, 132, 201, 159, 92, 23, 232, 14, 1, 204, 190, 215, 183, 94, 148, 141, 123, 164, 219, 54, 110, 8, 196, 25, 215,
+    194, 247, 8, 153, 176, 93, 64, 82, 177, 100, 161, 100, 4, 254, 23, 121, 162, 77, 199, 3, 124, 50, 192, 229, 199,
+    100, 133, 168, 199, 91, 245, 53, 174, 207, 153, 207, 53, 55, 252, 121, 12, 166, 99, 190, 124, 197, 224, 205, 175,
+    111, 211, 31, 249, 89, 204, 82, 114, 210, 176, 182, 126, 31, 7, 136, 196, 83, 246, 10, 13, 171, 130, 10, 94, 228,
+    247, 173, 94, 56, 55, 113, 11, 35, 123, 200, 241, 174, 74, 236, 196, 12, 15, 219, 52, 205, 219, 106, 49, 227, 45,
+    82, 126, 34, 88, 179, 236, 60, 58, 67, 70, 147, 184, 64, 106, 142, 149, 187, 176, 200, 90, 100, 45, 143, 32, 3, 30,
+    219, 133, 253, 48, 137, 47, 183, 20, 151, 216, 33, 214, 120, 147, 253, 18, 193, 30, 90, 194, 132, 100, 146, 76, 226,
+    234, 46, 237, 82, 193, 169, 150, 77, 86, 236, 191, 237, 208, 253, 81, 31, 15, 151, 64, 19, 94, 172, 177, 43, 157,
+    88, 26, 168, 12, 78, 176, 97, 243, 65, 229, 161, 55, 144, 236, 96, 190, 7, 38, 24, 167, 97, 181, 14, 114, 81, 47,
+    215, 185, 209, 45, 173, 101, 146, 66, 95, 106, 9, 240, 6, 232, 203, 59, 164, 180, 234, 60, 212, 95, 43, 128, 119,
+    227, 210, 30, 194, 127, 124, 34, 21, 38, 135, 19, 143, 234, 201, 68, 95, 207, 254, 113, 173, 80, 182, 201, 50, 131,
+    122, 169, 186, 33, 194, 53, 126, 218, 181, 98, 155, 119, 104, 72, 149, 125, 6, 106, 128, 71, 185, 32, 49, 247, 246,
+    52, 184, 147, 163, 27, 31, 105, 25, 232, 136, 154, 50, 177, 145, 94, 166, 126, 98, 220, 151, 94, 42, 185, 159, 239,
+    103, 43, 155, 237, 159, 227, 249, 0, 191, 230, 40, 176, 136, 168, 159, 112, 41, 13, 187, 173, 190, 219, 236, 146,
+    133, 177, 110, 130, 197, 18, 214, 92, 53, 201, 13, 128, 223, 61, 78, 155, 55, 221, 90, 223, 18, 180, 57, 110, 78,
+    147, 3, 249, 69, 126, 154, 176, 185, 165, 255, 177, 202, 120, 162, 124, 226, 105, 99, 183, 9, 9, 63, 36, 57, 244,
+    55, 130, 209, 0, 75, 86, 202, 135, 52, 228, 70, 249, 89, 181, 84, 183, 191, 194, 56, 145, 141, 36, 50, 34, 93, 230,
+    61, 139, 83, 203, 164, 39, 63, 124, 171, 158, 155, 46, 147, 41, 40, 242, 191, 23, 120, 94, 190, 41, 49, 232, 160,
+    92, 195, 8, 243, 63, 39, 220, 229, 234, 182, 247, 195, 28, 248, 47, 135, 155, 162, 146, 129, 147, 215, 79, 51, 52,
+    173, 219, 56, 95, 206, 25, 221, 143, 225, 205, 182, 45, 18, 251, 94, 231, 100, 110, 226, 205, 221, 123, 82, 77, 16,
+    111, 94, 64, 116, 178, 195, 38, 189, 22, 73, 66, 179, 196, 97, 218, 1, 240, 223, 34, 240, 70, 146, 192, 185, 219,
+    104, 49, 223, 155, 207, 125, 86, 139, 243, 49, 117, 64, 100, 211, 182, 11, 126, 150, 110, 229, 129, 37, 137, 61, 92,
+    30, 84, 85, 18, 251, 14, 36, 2, 197, 30, 126, 52, 132, 188, 108, 204, 8, 89, 48, 189, 34, 126, 20, 219, 237, 74,
+    191, 156, 142, 3, 86, 105, 22, 18, 186, 201, 49, 200, 248, 168, 155, 186, 68, 12, 181, 95, 112, 24, 190, 28, 236,
+    199, 18, 185, 242, 88, 183, 62, 124, 225, 65, 11, 134, 98, 124, 166, 62, 75, 179, 93, 126, 37, 247, 125, 50, 89, 97,
+    173, 150, 132, 44, 26, 255, 208, 111, 181, 85, 254, 243, 96, 34, 167, 210, 170, 6, 9, 136, 249, 96, 42, 165, 77,
+    176, 92, 50, 225, 201, 127, 206, 173, 253, 77, 6, 211, 227, 108, 102, 185, 175, 148, 85, 16, 97, 24, 164, 207, 199,
+    152, 123, 76, 74, 156, 71, 134, 205, 193, 90, 254, 161, 72, 72, 133, 103, 129, 135, 187, 58, 59, 254, 105, 30, 120,
+    230, 131, 114, 122, 93, 102, 80, 63, 3, 45, 122, 138, 163, 168, 142, 77, 28, 210, 108, 76, 33, 243, 49, 166, 6, 32,
+    51, 51, 130, 235, 145, 176, 24, 209, 222, 129, 248, 238, 62, 47, 118, 132, 63, 95, 150, 221, 87, 243, 106, 45, 228,
+    64, 78, 196, 206, 158, 120, 85, 254, 37, 127, 33, 124, 59, 243, 132, 119, 161, 118, 114, 110, 0, 226, 201, 62, 251,
+    93, 9, 181, 142, 46, 48, 183, 62, 187, 222, 249, 189, 36, 19, 155, 88, 143, 142, 131, 101, 237, 230, 113, 54, 111,
+    157, 163, 128, 148, 199, 188, 164, 17, 13, 208, 197, 55, 164, 17, 230, 129, 2, 152, 166, 69, 102, 12, 89, 103, 57,
+    107, 50, 130, 65, 222, 95, 125, 16, 239, 172, 172, 161, 198, 178, 106, 235, 36, 33, 149, 3, 29, 28, 196, 240, 4,
+    207, 196, 250, 92, 32, 166, 229, 227, 7, 197, 115, 55, 196, 247, 7, 94, 177, 81, 41, 189, 85, 18, 221, 7, 30, 234,
+    168, 78, 133, 107, 255, 25, 79, 146, 188, 69, 78, 239, 23, 137, 29, 125, 245, 237, 182, 196, 16, 86, 136, 168, 154,
+    254, 78, 134, 244, 143, 204, 98, 254, 189, 205, 202, 36, 251, 51, 167, 33, 85, 28, 53, 135, 4, 243, 100, 163, 14,
+    217, 146, 190, 32, 107, 46, 90, 197, 189, 137, 233, 29, 43, 156, 116, 229, 37, 94, 59, 10, 127, 57, 107, 242, 122,
+    234, 107, 116, 66, 128, 88, 76, 133, 175, 218, 58, 163, 193, 240, 14, 115, 175, 8, 102, 95, 180, 8, 120, 236, 178,
+    209, 214, 25, 83, 222, 150, 236, 186, 253, 93, 110, 19, 111, 63, 60, 22, 10, 227, 36, 47, 96, 223, 132, 242, 96, 85,
+    1, 3, 88, 238, 194, 174, 140, 10, 197, 45, 50, 89, 205, 149, 201, 188, 69, 214, 206, 5, 178, 88, 27, 243, 71, 229,
+    131, 193, 141, 123, 216, 127, 45, 209, 187, 131, 173, 31, 37, 39, 107, 113, 122, 204, 15, 46, 23, 243, 53, 196, 249,
+    47, 153, 89, 101, 66, 110, 245, 156, 116, 237, 253, 59, 54, 116, 51, 250, 146, 151, 41, 85, 21, 228, 103, 8, 85,
+    125, 17, 111, 121, 84, 183, 152, 137, 232, 102, 140, 21, 85, 144, 222, 77, 223, 241, 79, 27, 101, 49, 47, 58, 162,
+    102, 191, 236, 73, 103, 222, 92, 107, 196, 196, 124, 238, 116, 11, 48, 204, 219, 26, 33, 168, 2, 13, 24, 115, 174,
+    153, 196, 234, 202, 214, 145, 157, 203, 69, 94, 224, 108, 56, 203, 154, 232, 182, 121, 169, 243, 206, 9, 121, 20,
+    250, 176, 158, 228, 11, 109, 11, 161, 124, 22, 68, 103, 215, 107, 108, 212, 253, 149, 97, 248, 255, 38, 61, 192, 43,
+    23, 17, 133, 125, 69, 161, 221, 58, 89, 142, 73, 59, 151, 247, 182, 9, 59, 97, 151, 249, 223, 68, 7, 10, 232, 242,
+    92, 132, 167, 24, 212, 126, 117, 132, 151, 172, 45, 189, 175, 13, 181, 58, 204, 253, 110, 60, 251, 2, 60, 207, 151,
+    79, 135, 30, 107, 90, 127, 163, 234, 18, 49, 70, 35, 63, 146, 203, 31, 154, 122, 137, 92, 20, 186, 237, 130, 113,
+    22, 43, 253, 230, 255, 59, 135, 60, 114, 17, 152, 88, 38, 177, 115, 114, 84, 214, 247, 11, 190, 111, 210, 162, 153,
+    192, 235, 15, 44, 154, 170, 31, 27, 154, 183, 243, 59, 57, 250, 255, 232, 51, 191, 109, 34, 182, 211, 16, 103, 188,
+    204, 191, 143, 100, 185, 91, 18, 58, 168, 100, 196, 250, 129, 112, 248, 210, 217, 12, 181, 172, 74, 83, 0, 232, 249,
+    98, 196, 58, 229, 158, 113, 47, 222, 21, 221, 13, 23, 191, 109, 73, 140, 103, 232, 165, 104, 99, 208, 248, 69, 163,
+    33, 206, 137, 125, 239, 81, 122, 12, 68, 61, 248, 230, 53, 27, 76, 76, 111, 209, 226, 223, 107, 214, 250, 102, 16,
+    122, 255, 169, 92, 44, 181, 49, 135, 148, 124, 55, 181, 8, 67, 43, 177, 77, 117, 57, 154, 225, 102, 124, 134, 7, 19,
+    6, 9, 4, 134, 98, 192, 229, 196, 227, 112, 128, 230, 17, 26, 182, 170, 160, 33, 75, 188, 245, 11, 41, 87, 45, 83,
+    159, 17, 30, 146, 45, 190, 111, 137, 8, 159, 115, 112, 22, 186, 184, 125, 46, 93, 106, 130, 225, 190, 7, 127, 253,
+    80, 42, 214, 226, 76, 86, 215, 211, 190, 27, 242, 135, 236, 170, 102, 142, 122, 216, 186, 70, 108, 57, 17, 39, 110,
+    49, 88, 40, 236, 216, 199, 196, 235, 111, 27, 52, 54, 118, 57, 11, 124, 213, 111, 201, 53, 162, 112, 61, 70, 253,
+    200, 49, 171, 74, 244, 129, 166, 17, 131, 53, 51, 43, 88, 139, 183, 238, 75, 245, 14, 58, 99, 248, 26, 112, 73, 101,
+    24, 214, 101, 190, 190, 198, 55, 179, 101, 136, 151, 31, 165, 34, 43, 25, 21, 48, 45, 247, 212, 130, 181, 217, 52,
+    38, 244, 22, 91, 190, 108, 247, 88, 7, 94, 182, 231, 10, 236, 24, 30, 88, 24, 228, 229, 118, 150, 160, 90, 34, 52,
+    178, 104, 221, 211, 53, 129, 232, 118, 94, 209, 111, 115, 101, 72, 38, 15, 173, 170, 99, 129, 51, 173, 152, 113,
+    165, 38, 206, 93, 29, 115, 131, 207, 14, 96, 58, 81, 209, 53, 195, 151, 190, 65, 162, 248, 161, 191, 184, 95, 64,
+    59, 172, 227, 162, 158, 233, 13, 185, 25, 154, 205, 232, 126, 24, 39, 130, 109, 238, 197, 69, 148, 151, 195, 139,
+    35, 227, 148, 56, 121, 34, 142, 223, 4, 119, 104, 92, 135, 65, 101, 132, 102, 78, 14, 186, 237, 218, 236, 238, 140,
+    22, 167, 205, 62, 193, 79, 171, 92, 102, 129, 232, 24, 121, 243, 72, 43, 151, 195, 166, 159, 61, 92, 66, 87, 148,
+    224, 126, 145, 120, 231, 18, 2, 140, 190, 221, 55, 130, 64, 237, 206, 143, 206, 28, 77, 68, 47, 111, 8, 104, 23,
+    161, 213, 213, 132, 97, 111, 110, 31, 251, 208, 20, 7, 99, 66, 17, 214, 173, 138, 93, 12, 189, 50, 34, 252, 140, 72,
+    11, 214, 144, 238, 196, 246, 36, 192, 231, 93, 232, 125, 149, 96, 134, 131, 241, 3, 117, 215, 52, 1, 234, 220, 177,
+    206, 139, 82, 32, 236, 157, 58, 85, 163, 95, 162, 116, 131, 227, 177, 175, 7, 37, 250, 238, 101, 215, 113, 50, 205,
+    150, 202, 204, 179, 239, 7, 2, 206, 75, 46, 219, 52, 148, 45, 235, 106, 183, 5, 49, 174, 141, 193, 161, 100, 161,
+    16, 112, 188, 2, 48, 195, 196, 32, 180, 49, 14, 48, 197, 20, 98, 24, 185, 25, 42, 225, 148, 9, 29, 213, 73, 197, 7,
+    125, 149, 88, 130, 170, 120, 211, 211, 0, 41, 183, 245, 33, 111, 98, 18, 54, 76, 37, 114, 226, 199, 83, 229, 135,
+    102, 127, 38, 130, 50, 200, 56, 121, 0, 221, 139, 216, 8, 112, 195, 227, 21, 97, 142, 55, 98, 6, 113, 17, 72, 81,
+    90, 112, 103, 185, 111, 195, 23, 232, 47, 84, 162, 173, 105, 125, 34, 60, 104, 79, 33, 202, 40, 104, 157, 90, 113,
+    49, 237, 233, 134, 251, 108, 47, 87, 23, 136, 249, 162, 9, 11, 146, 84, 3, 184, 28, 154, 11, 193, 230, 18, 158, 141,
+    210, 238, 24, 61, 252, 8, 66, 105, 252, 60, 13, 117, 238, 25, 32, 24, 223, 22, 23, 136, 58, 231, 135, 15, 191, 26,
+    85, 94, 189, 214, 116, 101, 48, 251, 77, 91, 17, 210, 120, 167, 127, 111, 152, 94, 152, 151, 25, 32, 220, 44, 157,
+    17, 160, 101, 175, 252, 74, 7, 118, 108, 159, 193, 74, 74, 7, 12, 106, 224, 88, 12, 108, 193, 255, 98, 85, 234, 139,
+    16, 199, 126, 108, 59, 42, 163, 170, 48, 189, 189, 171, 138, 241, 187, 15, 27, 4, 68, 129, 136, 227, 124, 36, 82,
+    118, 83, 199, 122, 128, 170, 158, 29, 107, 179, 186, 22, 7, 173, 1, 111, 208, 2, 202, 6, 200, 11, 183, 90, 98, 179,
+    72, 15, 83, 180, 28, 198, 84, 102, 23, 168, 146, 93, 135, 232, 220, 229, 104, 92, 183, 147, 31, 114, 111, 27, 194,
+    186, 30, 72, 183, 75, 216, 8, 47, 234, 180, 144, 124, 125, 62, 214, 33, 105, 61, 30, 187, 108, 250, 189, 39, 121,
+    132, 46, 221, 130, 204, 77, 177, 176, 91, 36, 245, 173, 110, 143, 166, 15, 221, 170, 141, 190, 80, 4, 49, 122, 121,
+    233, 72, 211, 34, 239, 102, 4, 59, 125, 8, 251, 126, 215, 246, 244, 105, 152, 153, 66, 239, 91, 45, 101, 55, 210,
+    150, 228, 172, 16, 112, 238, 205, 111, 129, 2, 15, 159, 236, 62, 231, 74, 203, 16, 36, 164, 169, 161, 194, 248, 142,
+    162, 255, 242, 251, 71, 157, 164, 28, 122, 70, 157, 192, 135, 100, 19, 90, 108, 43, 100, 174, 68, 33, 99, 250, 63,
+    84, 24, 14, 120, 119, 106, 213, 179, 73, 122, 3, 77, 90, 235, 217, 210, 201, 199, 75, 134, 70, 37, 67, 51, 177, 211,
+    169, 147, 244, 37, 161, 173, 4, 223, 44, 175, 81, 69, 74, 148, 127, 57, 171, 3, 24, 209, 145, 172, 48, 178, 180,
+    238, 143, 209, 136, 144, 90, 50, 217, 174, 40, 188, 0, 141, 182, 228, 127, 53, 61, 108, 201, 147, 58, 24, 72, 223,
+    228, 149, 227, 184, 86, 1, 202, 143, 136, 88, 65, 200, 187, 38, 95, 85, 155, 154, 37, 204, 86, 122, 79, 43, 185,
+    179, 27, 151, 31, 80, 61, 176, 223, 132, 97, 183, 213, 127, 79, 18, 25, 169, 120, 220, 214, 100, 163, 80, 178, 201,
+    138, 213, 170, 100, 125, 99, 69, 249, 49, 43, 66, 172, 180, 205, 60, 17, 5, 35, 32, 17, 189, 239, 188, 218, 60, 113,
+    160, 165, 139, 39, 109, 158, 34, 7, 179, 14, 76, 148, 180, 66, 88, 225, 8, 25, 253, 62, 221, 118, 218, 43, 249, 239,
+    233, 205, 207, 109, 63, 94, 252, 220, 239, 65, 22, 230, 117, 146, 82, 35, 26, 19, 193, 50, 83, 46, 148, 64, 233, 51,
+    66, 223, 252, 240, 183, 254, 76, 183, 154, 228, 162, 6, 79, 26, 160, 186, 176, 93, 196, 203, 38, 13, 192, 198, 243,
+    162, 213, 201, 77, 49, 33, 250, 61, 177, 158, 176, 238, 195, 230, 86, 205, 215, 207, 59, 99, 212, 49, 171, 202, 17,
+    222, 99, 49, 233, 108, 224, 69, 254, 72, 198, 206, 197, 166, 203, 219, 103, 138, 113, 41, 27, 108, 34, 14, 162, 152,
+    156, 72, 67, 61, 71, 137, 94, 120, 79, 45, 174, 156, 113, 162, 100, 1, 176, 94, 61, 165, 173, 230, 128, 186, 22, 74,
+    189, 14, 143, 217, 124, 149, 78, 84, 94, 146, 199, 67, 236, 234, 38, 66, 58, 63, 190, 169, 80, 221, 233, 120, 136,
+    136, 211, 189, 210, 212, 247, 136, 215, 184, 206, 173, 90, 216, 164, 91, 85, 192, 225, 163, 168, 188, 234, 132, 63,
+    195, 91, 158, 21, 177, 255, 197, 244, 185, 1, 221, 156, 229, 209, 234, 122, 239, 85, 150, 135, 44, 4, 134, 179, 162,
+    4, 155, 142, 56, 225, 17, 250, 19, 74, 180, 91, 140, 190, 158, 91, 91, 232, 22, 129, 165, 124, 84, 156, 127, 173,
+    101, 207, 214, 180, 215, 139, 180, 124, 226, 106, 19, 37, 175, 231, 58, 233, 183, 208, 1, 151, 86, 75, 116, 118,
+    208, 90, 226, 161, 110, 159, 103, 169, 155, 162, 12, 3, 204, 111, 10, 12, 165, 98, 251, 244, 182, 252, 92, 227, 247,
+    207, 234, 16, 177, 51, 190, 127, 21, 201, 218, 62, 29, 17, 39, 61, 154, 53, 225, 14, 212, 14, 186, 19, 213, 62, 36,
+    198, 28, 231, 221, 33, 50, 49, 73, 10, 195, 56, 102, 250, 252, 24, 57, 64, 114, 38, 116, 60, 170, 47, 52, 214, 117,
+    180, 220, 216, 39, 159, 251, 134, 34, 9, 36, 126, 92, 101, 218, 150, 185, 96, 46, 76, 98, 189, 158, 178, 86, 12, 13,
+    218, 247, 95, 119, 78, 255, 15, 130, 56, 120, 90, 254, 2, 197, 78, 160, 92, 199, 220, 131, 229, 232, 158, 209, 78,
+    172, 82, 4, 191, 225, 200, 36, 124, 22, 160, 107, 220, 37, 16, 169, 150, 101, 106, 22, 129, 130, 145, 204, 113, 211,
+    120, 19, 114, 104, 209, 121, 133, 225, 241, 240, 30, 250, 254, 226, 31, 119, 153, 148, 10, 130, 140, 100, 165, 244,
+    252, 128, 243, 91, 171, 109, 225, 178, 184, 251, 172, 200, 238, 223, 144, 41, 159, 212, 49, 111, 182, 239, 186, 175,
+    177, 190, 203, 215, 67, 35, 67, 140, 211, 61, 15, 156, 136, 25, 95, 236, 165, 126, 207, 4, 160, 100, 18, 62, 52,
+    174, 3, 198, 245, 204, 33, 43, 90, 118, 120, 251, 240, 117, 31, 38, 97, 12, 144, 48, 158, 222, 55, 3, 161, 51, 58,
+    245, 132, 41, 81, 47, 137, 160, 133, 142, 14, 8, 151, 62, 173, 32, 111, 222, 142, 173, 41, 193, 168, 231, 56, 159,
+    236, 105, 171, 14, 67, 80, 134, 126, 38, 198, 252, 187, 232, 131, 238, 232, 169, 191, 222, 198, 170, 122, 225, 224,
+    80, 153, 61, 21, 18, 85, 135, 83, 213, 134, 137, 94, 220, 141, 148, 135, 113, 193, 87, 173, 65, 181, 69, 204, 22,
+    216, 21, 90, 186, 31, 153, 162, 140, 39, 165, 246, 32, 130, 168, 10, 159, 204, 101, 152, 135, 110, 223, 232, 27,
+    157, 218, 210, 96, 236, 197, 94, 81, 29, 12, 233, 238, 136, 222, 63, 115, 181, 242, 223, 202, 87, 201, 185, 229,
+    211, 230, 3, 247, 224, 199, 240, 170, 48, 107, 186, 193, 188, 229, 111, 135, 149, 248, 75, 243, 131, 241, 176, 57,
+    28, 166, 209, 2, 136, 62, 68, 57, 249, 148, 5, 179, 103, 160, 72, 227, 28, 16, 61, 123, 81, 191, 51, 40, 143, 241,
+    58, 254, 82, 215, 80, 208, 136, 14, 217, 203, 131, 212, 255, 196, 61, 200, 162, 233, 206, 231, 30, 226, 92, 193,
+    189, 66, 65, 246, 62, 235, 144, 49, 63, 71, 72, 24, 19, 248, 175, 50, 151, 135, 83, 138, 89, 238, 2, 161, 16, 192,
+    100, 90, 132, 179, 54, 149, 181, 236, 71, 29, 150, 46, 125, 161, 5, 216, 145, 124, 25, 77, 213, 40, 218, 0, 199,
+    233, 90, 1, 178, 26, 110, 99, 250, 186, 68, 86, 89, 104, 226, 36, 66, 86, 141, 184, 130, 206, 117, 90, 69, 63, 167,
+    134, 202, 6, 182, 78, 108, 22, 114, 150, 233, 92, 32, 38, 168, 176, 226, 190, 38, 35, 26, 218, 224, 82, 199, 78, 77,
+    122, 238, 74, 123, 205, 60, 108, 108, 91, 206, 39, 1, 220, 227, 241, 208, 176, 116, 160, 99, 205, 249, 195, 135, 67,
+    188, 27, 137, 125, 6, 90, 245, 30, 208, 211, 169, 7, 40, 217, 211, 224, 55, 144, 112, 44, 50, 44, 169, 230, 84, 83,
+    249, 129, 240, 230, 254, 205, 115, 71, 177, 229, 17, 117, 239, 130, 90, 111, 102, 121, 216, 173, 119, 32, 185, 238,
+    151, 186, 9, 225, 216, 95, 195, 70, 204, 102, 9, 167, 40, 184, 223, 138, 252, 210, 86, 242, 214, 5, 82, 93, 182, 51,
+    29, 210, 68, 43, 132, 212, 42, 225, 187, 129, 247, 226, 72, 247, 4, 196, 119, 11, 255, 220, 213, 45, 217, 12, 53,
+    26, 246, 233, 217, 204, 80, 189, 178, 148, 196, 52, 97, 92, 38, 254, 131, 228, 45, 141, 9, 187, 183, 164, 228, 195,
+    222, 242, 180, 88, 97, 57, 148, 99, 211, 227, 190, 170, 227, 33, 198, 109, 235, 204, 113, 131, 91, 83, 201, 79, 57,
+    126, 241, 50, 250, 146, 18, 255, 205, 10, 138, 98, 227, 218, 223, 57, 117, 5, 89, 46, 241, 157, 63, 12, 2, 48, 165,
+    244, 182, 163, 38, 110, 229, 183, 100, 198, 123, 158, 242, 218, 93, 114, 174, 117, 9, 136, 175, 142, 159, 130, 56,
+    194, 198, 178, 75, 110, 153, 101, 135, 121, 108, 56, 0, 65, 219, 91, 251, 112, 9, 45, 9, 51, 183, 206, 149, 234, 76,
+    191, 122, 21, 87, 85, 94, 252, 32, 17, 191, 22, 221, 237, 151, 215, 49, 162, 30, 79, 127, 198, 33, 131, 235, 237,
+    184, 243, 65, 177, 115, 175, 90, 154, 54, 251, 41, 180, 175, 199, 146, 81, 253, 12, 29, 227, 182, 4, 30, 156, 67,
+    113, 59, 130, 7, 96, 148, 45, 116, 101, 181, 13, 56, 188, 27, 22, 107, 196, 69, 127, 94, 147, 76, 184, 149, 168,
+    187, 38, 130, 184, 40, 19, 93, 17, 30, 111, 53, 82, 6, 115, 96, 27, 94, 245, 214, 160, 54, 201, 56, 229, 71, 29,
+    159, 59, 141, 135, 51, 246, 122, 164, 53, 99, 150, 198, 88, 24, 82, 14, 193, 107, 169, 229, 158, 21, 169, 41, 216,
+    163, 56, 181, 71, 150, 111, 34, 6, 207, 159, 113, 182, 189, 235, 45, 161, 170, 141, 33, 249, 148, 74, 74, 56, 91,
+    27, 251, 14, 224, 19, 49, 46, 50, 150, 61, 71, 148, 66, 42, 161, 114, 65, 177, 56, 167, 92, 128, 14, 148, 179, 230,
+    60, 186, 137, 96, 198, 150, 21, 195, 163, 51, 33, 59, 253, 192, 72, 119, 87, 31, 242, 151, 128, 238, 26, 111, 102,
+    92, 157, 51, 153, 245, 72, 68, 41, 202, 228, 100, 113, 45, 244, 205, 252, 14, 35, 95, 182, 225, 233, 67, 199, 33,
+    183, 117, 241, 40, 138, 90, 234, 61, 203, 252, 138, 51, 4, 30, 102, 76, 53, 240, 126, 78, 164, 62, 42, 138, 94, 102,
+    79, 233, 35, 188, 196, 247, 63, 170, 111, 225, 219, 23, 242, 85, 60, 27, 92, 209, 144, 215, 197, 118, 17, 20, 217,
+    165, 23, 213, 228, 75, 217, 145, 244, 166, 116, 129, 0, 140, 53, 197, 202, 94, 16, 25, 146, 108, 215, 76, 168, 75,
+    86, 119, 143, 99, 60, 234, 178, 240, 239, 28, 36, 97, 89, 13, 208, 67, 66, 126, 241, 153, 142, 2, 4, 13, 68, 159,
+    49, 150, 46, 194, 127, 242, 249, 216, 101, 20, 58, 230, 220, 192, 221, 236, 111, 247, 97, 51, 72, 117, 3, 9, 183,
+    156, 171, 199, 127, 106, 174, 176, 232, 170, 149, 19, 29, 103, 247, 132, 82, 69, 212, 194, 101, 170, 235, 72, 230,
+    214, 251, 186, 2, 211, 80, 42, 194, 144, 130, 3, 191, 198, 196, 140, 80, 202, 211, 183, 128, 233, 204, 24, 76, 119,
+    60, 5, 228, 158, 51, 90, 100, 46, 207, 189, 146, 197, 121, 239, 108, 116, 230, 141, 222, 145, 165, 157, 10, 79, 21,
+    82, 164, 121, 35, 61, 167, 60, 172, 134, 38, 18, 54, 66, 232, 56, 72, 93, 126, 206, 184, 125, 79, 160, 152, 119, 67,
+    170, 74, 132, 161, 76, 204, 227, 165, 117, 26, 213, 12, 172, 58, 252, 159, 10, 195, 76, 41, 46, 164, 224, 162, 70,
+    106, 11, 52, 246, 34, 175, 84, 152, 161, 66, 29, 215, 25, 70, 159, 71, 232, 18, 91, 166, 153, 193, 194, 60, 143,
+    179, 193, 4, 21, 52, 141, 137, 14, 227, 221, 48, 212, 231, 201, 59, 177, 115, 58, 11, 45, 173, 244, 193, 253, 249,
+    55, 212, 24, 250, 28, 53, 155, 12, 236, 109, 120, 32, 138, 162, 204, 228, 124, 19, 183, 240, 31, 190, 188, 145, 150,
+    164, 29, 79, 16, 54, 192, 52, 134, 205, 89, 88, 196, 73, 112, 226, 250, 233, 176, 174, 178, 177, 215, 81, 72, 38,
+    47, 24, 70, 114, 125, 26, 94, 64, 147, 92, 220, 173, 43, 189, 43, 0, 34, 30, 213, 188, 41, 139, 155, 220, 36, 223,
+    110, 38, 21, 139, 95, 167, 89, 23, 142, 193, 145, 193, 228, 46, 177, 158, 134, 222, 155, 204, 116, 66, 225, 51, 107,
+    97, 10, 134, 148, 35, 107, 183, 99, 67, 190, 120, 80, 125, 51, 44, 68, 131, 93, 73, 7, 122, 82, 2, 126, 202, 106,
+    135, 159, 175, 101, 142, 46, 222, 22, 215, 236, 184, 17, 73, 146, 175, 237, 199, 244, 100, 109, 127, 130, 30, 149,
+    115, 46, 113, 147, 189, 33, 246, 139, 65, 86, 49, 83, 48, 109, 87, 11, 206, 84, 142, 247, 186, 68, 246, 111, 23, 83,
+    80, 87, 248, 230, 139, 243, 124, 99, 230, 23, 61, 72, 47, 150, 112, 165, 200, 25, 102, 187, 242, 232, 11, 121, 65,
+    147, 254, 247, 203, 67, 25, 121, 76, 146, 230, 35, 124, 29, 101, 113, 59, 113, 129, 32, 25, 172, 169, 234, 185, 249,
+    93, 28, 151, 3, 246, 152, 204, 175, 20, 209, 44, 119, 200, 126, 185, 66, 146, 0, 15, 70, 54, 215, 133, 92, 251, 155,
+    108, 115, 119, 74, 42, 96, 25, 216, 182, 7, 1, 58, 238, 45, 125, 164, 93, 191, 22, 190, 207, 182, 106, 206, 14, 189,
+    53, 179, 206, 47, 166, 148, 191, 11, 89, 161, 226, 125, 84, 112, 74, 198, 15, 111, 105, 156, 181, 57, 49, 174, 21,
+    89, 222, 178, 132, 239, 66, 233, 63, 35, 115, 173, 27, 238, 90, 13, 10, 88, 77, 158, 80, 8, 146, 168, 233, 21, 39,
+    190, 203, 58, 95, 18, 176, 111, 78, 86, 43, 67, 180, 80, 165, 32, 241, 79, 88, 138, 75, 185, 24, 199, 148, 135, 28,
+    33, 34, 161, 30, 99, 126, 254, 65, 222, 76, 19, 235, 78, 202, 220, 213, 138, 150, 37, 93, 120, 63, 95, 8, 249, 246,
+    193, 227, 249, 40, 217, 21, 129, 97, 99, 129, 104, 153, 175, 78, 102, 68, 198, 160, 32, 63, 51, 247, 109, 227, 96,
+    104, 244, 241, 3, 254, 122, 147, 186, 85, 52, 191, 218, 88, 9, 140, 180, 108, 120, 192, 172, 193, 110, 37, 178, 59,
+    85, 216, 62, 87, 214, 111, 28, 32, 211, 145, 70, 94, 196, 251, 183, 163, 115, 207, 79, 129, 45, 219, 117, 43, 252,
+    13, 155, 53, 252, 91, 67, 253, 225, 3, 150, 71, 26, 83, 83, 64, 86, 244, 97, 109, 10, 219, 154, 28, 135, 79, 23, 63,
+    173, 134, 197, 137, 165, 102, 90, 8, 251, 27, 153, 217, 38, 26, 96, 0, 171, 137, 115, 151, 244, 173, 209, 92, 191,
+    142, 182, 223, 73, 155, 195, 248, 27, 7, 243, 105, 190, 252, 185, 253, 14, 88, 173, 26, 237, 181, 127, 183, 134, 27,
+    249, 245, 193, 75, 120, 68, 229, 99, 240, 119, 226, 32, 40, 235, 194, 209, 216, 126, 92, 204, 209, 77, 160, 90, 25,
+    104, 212, 64, 161, 41, 246, 35, 247, 79, 46, 51, 242, 198, 133, 202, 25, 93, 151, 158, 248, 153, 210, 232, 67, 144,
+    26, 181, 165, 4, 150, 139, 125, 53, 255, 224, 230, 229, 7, 84, 82, 91, 18, 161, 177, 70, 80, 66, 216, 80, 234, 147,
+    59, 188, 10, 226, 142, 42, 64, 2, 118, 215, 37, 59, 56, 171, 119, 234, 26, 246, 166, 140, 248, 146, 183, 63, 16, 61,
+    173, 104, 42, 229, 205, 251, 36, 223, 238, 66, 28, 177, 236, 82, 136, 190, 83, 32, 19, 197, 104, 140, 16, 51, 177,
+    226, 127, 89, 80, 60, 97, 71, 49, 12, 244, 186, 114, 14, 90, 93, 67, 238, 86, 11, 34, 205, 189, 123, 226, 250, 218,
+    46, 148, 228, 73, 144, 219, 214, 64, 74, 246, 185, 55, 140, 7, 20, 189, 223, 111, 50, 200, 85, 54, 25, 116, 177, 33,
+    236, 56, 115, 207, 251, 231, 50, 219, 158, 101, 241, 117, 32, 50, 11, 11, 30, 73, 193, 33, 111, 22, 231, 209, 85,
+    48, 238, 161, 132, 199, 86, 49, 77, 185, 92, 16, 138, 11, 243, 132, 86, 208, 214, 247, 33, 75, 103, 138, 108, 50,
+    154, 119, 145, 111, 24, 31, 155, 224, 154, 184, 104, 31, 175, 2, 197, 112, 128, 45, 4, 26, 150, 151, 151, 171, 191,
+    23, 8, 159, 31, 197, 171, 244, 115, 105, 244, 22, 141, 64, 40, 6, 173, 60, 72, 142, 107, 178, 136, 153, 75, 7, 43,
+    188, 58, 217, 98, 31, 142, 118, 14, 89, 159, 3, 37, 216, 17, 245, 40, 165, 36, 52, 50, 59, 135, 17, 151, 208, 187,
+    202, 184, 109, 21, 134, 11, 145, 27, 81, 16, 41, 254, 174, 180, 0, 208, 3, 164, 52, 221, 17, 54, 97, 138, 46, 191,
+    234, 170, 108, 157, 170, 189, 141, 243, 137, 126, 168, 161, 17, 219, 10, 21, 81, 11, 220, 160, 72, 203, 79, 247,
+    162, 215, 101, 166, 55, 114, 181, 250, 221, 208, 178, 245, 33, 115, 17, 79, 178, 195, 118, 246, 153, 54, 46, 245,
+    191, 72, 208, 46, 82, 57, 32, 65, 251, 140, 112, 51, 62, 222, 62, 158, 62, 194, 83, 183, 1, 27, 147, 217, 59, 13,
+    47, 62, 39, 68, 10, 117, 43, 27, 63, 68, 137, 237, 172, 75, 155, 29, 239, 65, 123, 14, 120, 189, 182, 70, 190, 71,
+    15, 2, 48, 179, 184, 156, 17, 151, 106, 1, 30, 99, 242, 58, 206, 211, 50, 191, 166, 25, 39, 238, 97, 207, 175, 159,
+    238, 82, 221, 255, 245, 19, 110, 177, 182, 54, 111, 146, 202, 16, 17, 133, 83, 251, 72, 88, 245, 16, 85, 190, 91,
+    193, 116, 157, 123, 69, 68, 237, 253, 192, 88, 167, 70, 10, 148, 216, 16, 152, 214, 201, 253, 167, 83, 111, 169,
+    176, 16, 128, 210, 154, 41, 249, 174, 222, 204, 37, 147, 190, 143, 15, 97, 170, 24, 86, 42, 120, 205, 16, 118, 221,
+    195, 7, 95, 93, 224, 199, 124, 198, 86, 26, 175, 197, 126, 245, 100, 156, 206, 92, 73, 202, 9, 242, 86, 182, 29, 30,
+    168, 159, 98, 77, 169, 195, 92, 51, 200, 135, 122, 62, 216, 216, 251, 60, 109, 58, 132, 215, 216, 147, 125, 209,
+    172, 198, 100, 33, 26, 53, 159, 98, 128, 161, 196, 225, 213, 206, 43, 156, 80, 223, 109, 100, 18, 5, 130, 178, 219,
+    159, 163, 150, 136, 18, 17, 123, 107, 149, 234, 235, 55, 110, 239, 127, 38, 198, 215, 95, 61, 91, 151, 83, 82, 241,
+    161, 127, 113, 63, 48, 143, 38, 35, 206, 32, 8, 101, 5, 22, 124, 173, 6, 231, 171, 200, 223, 40, 244, 195, 83, 137,
+    63, 249, 93, 136, 66, 152, 24, 182, 89, 178, 24, 221, 150, 182, 67, 39, 207, 69, 214, 126, 150, 177, 176, 24, 98,
+    108, 54, 1, 191, 4, 186, 162, 88, 218, 132, 192, 185, 44, 184, 55, 105, 194, 255, 128, 131, 2, 157, 100, 105, 58,
+    26, 219, 119, 188, 62, 38, 131, 68, 122, 1, 253, 237, 100, 79, 109, 92, 200, 8, 120, 187, 189, 239, 175, 137, 137,
+    98, 224, 6, 145, 7, 98, 144, 84, 164, 46, 90, 56, 49, 58, 153, 3, 254, 53, 52, 213, 113, 212, 188, 18, 95, 94, 228,
+    205, 179, 180, 141, 88, 84, 196, 182, 205, 16, 215, 94, 61, 14, 80, 49, 187, 95, 217, 210, 218, 10, 219, 73, 29, 89,
+    113, 99, 165, 100, 154, 88, 84, 91, 8, 214, 184, 173, 119, 142, 181, 234, 175, 149, 121, 78, 222, 215, 16, 175, 95,
+    22, 15, 182, 211, 44, 119, 230, 236, 124, 88, 150, 225, 196, 106, 198, 145, 196, 30, 206, 211, 243, 145, 40, 219,
+    143, 134, 252, 29, 100, 199, 137, 184, 139, 180, 238, 98, 89, 115, 220, 126, 216, 172, 233, 147, 208, 247, 186, 62,
+    222, 14, 155, 220, 110, 44, 144, 60, 132, 92, 234, 238, 238, 248, 243, 41, 78, 231, 103, 225, 208, 134, 166, 175,
+    180, 128, 26, 106, 127, 46, 85, 88, 8, 157, 7, 222, 10, 140, 80, 136, 157, 200, 45, 164, 176, 144, 1, 165, 86, 17,
+    248, 229, 223, 121, 161, 119, 128, 81, 16, 204, 178, 12, 125, 55, 75, 213, 98, 189, 126, 204, 54, 92, 195, 59, 143,
+    252, 89, 147, 158, 230, 254, 189, 0, 44, 96, 28, 56, 117, 111, 211, 226, 184, 173, 22, 43, 135, 47, 79, 242, 6, 44,
+    68, 176, 46, 18, 100, 184, 75, 161, 151, 150, 198, 51, 247, 204, 80, 100, 238, 53, 24, 134, 126, 161, 39, 73, 224,
+    231, 97, 184, 202, 125, 0, 123, 234, 153, 120, 11, 172, 147, 128, 195, 119, 122, 238, 199, 33, 211, 141, 216, 169,
+    125, 80, 120, 151, 133, 100, 253, 184, 161, 34, 213, 199, 85, 113, 96, 79, 74, 194, 129, 185, 204, 10, 74, 224, 3,
+    48, 217, 128, 147, 171, 237, 122, 212, 75, 145, 84, 128, 183, 150, 67, 127, 156, 94, 172, 228, 200, 12, 150, 154,
+    148, 55, 40, 179, 177, 79, 81, 64, 16, 197, 75, 245, 232, 22, 50, 198, 42, 221, 213, 126, 41, 251, 134, 43, 144, 74,
+    161, 60, 255, 0, 198, 98, 48, 93, 25, 59, 116, 88, 244, 106, 24, 143, 5, 185, 197, 77, 253, 48, 92, 247, 14, 175,
+    224, 95, 40, 131, 121, 224, 39, 33, 244, 162, 145, 250, 109, 1, 21, 228, 163, 249, 70, 245, 179, 77, 55, 81, 207,
+    239, 82, 15, 90, 253, 0, 11, 105, 144, 56, 171, 115, 202, 239, 198, 121, 221, 153, 6, 129, 151, 12, 225, 107, 226,
+    51, 185, 7, 67, 158, 238, 242, 105, 227, 29, 25, 73, 182, 122, 213, 131, 220, 77, 159, 165, 145, 164, 248, 88, 217,
+    145, 195, 35, 172, 55, 181, 232, 64, 148, 79, 218, 0, 58, 20, 253, 121, 69, 191, 97, 152, 192, 204, 116, 242, 203,
+    130, 220, 208, 26, 196, 132, 28, 237, 51, 250, 221, 108, 110, 5, 91, 135, 11, 115, 173, 141, 137, 171, 89, 224, 58,
+    75, 169, 174, 122, 203, 198, 119, 236, 252, 210, 228, 36, 191, 59, 16, 155, 212, 38, 231, 245, 72, 253, 10, 83, 170,
+    77, 182, 16, 171, 7, 111, 38, 213, 199, 6, 110, 211, 78, 100, 144, 45, 21, 3, 74, 99, 76, 102, 33, 27, 38, 143, 208,
+    23, 83, 126, 206, 184, 90, 162, 1, 104, 92, 213, 39, 127, 238, 109, 146, 110, 232, 125, 174, 251, 216, 111, 158,
+    162, 198, 183, 177, 249, 210, 67, 50, 182, 238, 59, 75, 33, 145, 9, 196, 3, 31, 205, 169, 64, 248, 50, 153, 73, 109,
+    107, 148, 228, 132, 183, 83, 6, 47, 91, 252, 192, 1, 223, 205, 97, 222, 212, 64, 94, 61, 219, 168, 108, 176, 152,
+    201, 234, 243, 111, 108, 227, 30, 177, 98, 199, 253, 9, 91, 62, 86, 0, 67, 182, 13, 30, 249, 70, 168, 123, 110, 91,
+    120, 128, 119, 15, 83, 174, 144, 250, 22, 42, 186, 13, 13, 104, 103, 244, 25, 239, 134, 207, 70, 22, 88, 236, 157,
+    27, 207, 19, 204, 194, 226, 201, 239, 77, 192, 104, 249, 188, 86, 141, 158, 17, 37, 129, 226, 187, 41, 86, 225, 0,
+    119, 217, 246, 84, 242, 114, 34, 244, 232, 20, 224, 44, 211, 234, 240, 43, 89, 252, 15, 203, 104, 248, 156, 119, 78,
+    239, 198, 237, 218, 27, 117, 189, 174, 108, 192, 126, 149, 155, 94, 125, 248, 173, 122, 107, 183, 77, 192, 237, 189,
+    48, 75, 92, 226, 242, 15, 165, 175, 128, 32, 60, 226, 130, 198, 16, 185, 15, 172, 252, 191, 56, 57, 117, 95, 236,
+    137, 87, 132, 85, 176, 106, 28, 96, 55, 218, 253, 194, 83, 195, 55, 246, 62, 32, 39, 151, 46, 156, 159, 96, 226,
+    181, 185, 178, 246, 6, 52, 115, 31, 254, 22, 97, 112, 85, 252, 219, 177, 81, 252, 253, 162, 122, 20, 74, 239, 18,
+    105, 42, 158, 156, 246, 198, 130, 147, 141, 88, 114, 226, 21, 57, 249, 202, 225, 137, 159, 244, 158, 85, 9, 246,
+    227, 35, 101, 33, 236, 39, 219, 219, 255, 237, 112, 109, 45, 65, 61, 109, 164, 126, 103, 2, 120, 106, 157, 29, 117,
+    162, 49, 155, 196, 35, 202, 186, 238, 138, 184, 216, 245, 226, 255, 19, 19, 116, 236, 106, 98, 147, 76, 183, 128,
+    251, 130, 58, 19, 130, 33, 125, 28, 6, 245, 201, 113, 82, 224, 22, 35, 177, 250, 3, 10, 53, 144, 126, 72, 95, 118,
+    251, 181, 130, 190, 198, 248, 232, 39, 244, 222, 53, 57, 100, 57, 49, 57, 246, 81, 181, 3, 123, 155, 184, 61, 173,
+    15, 188, 116, 167, 121, 63, 76, 56, 88, 149, 52, 203, 154, 91, 174, 184, 190, 104, 246, 241, 46, 76, 13, 147, 92,
+    116, 83, 163, 17, 142, 184, 80, 74, 164, 237, 95, 162, 182, 220, 13, 247, 39, 92, 43, 164, 46, 39, 67, 6, 149, 130,
+    245, 90, 248, 43, 115, 61, 10, 65, 182, 96, 160, 110, 244, 193, 71, 7, 31, 41, 46, 6, 160, 115, 61, 252, 106, 207,
+    192, 81, 124, 209, 153, 51, 75, 207, 150, 24, 219, 207, 227, 6, 53, 232, 206, 98, 85, 142, 99, 178, 116, 200, 61,
+    117, 1, 130, 139, 165, 173, 253, 167, 59, 198, 72, 146, 58, 53, 78, 236, 51, 40, 244, 45, 35, 220, 116, 37, 86, 82,
+    118, 180, 224, 66, 32, 129, 174, 125, 192, 218, 219, 163, 10, 98, 136, 104, 53, 83, 109, 202, 242, 164, 239, 72, 98,
+    7, 71, 9, 227, 61, 40, 174, 128, 4, 98, 90, 35, 40, 123, 195, 5, 95, 154, 217, 14, 178, 211, 98, 64, 142, 126, 242,
+    14, 157, 20, 208, 23, 125, 182, 236, 121, 185, 172, 32, 153, 211, 190, 75, 56, 228, 135, 173, 53, 23, 187, 49, 40,
+    89, 104, 254, 188, 73, 160, 52, 134, 138, 188, 245, 35, 230, 4, 162, 61, 50, 130, 3, 230, 186, 29, 98, 146, 51, 28,
+    4, 128, 133, 122, 251, 214, 176, 97, 77, 190, 157, 169, 150, 123, 162, 252, 129, 56, 206, 234, 223, 90, 107, 37,
+    157, 230, 89, 141, 3, 92, 64, 184, 53, 116, 188, 86, 141, 113, 85, 241, 85, 39, 92, 58, 235, 82, 45, 191, 24, 29,
+    104, 170, 25, 210, 137, 26, 43, 178, 115, 141, 62, 222, 226, 10, 26, 108, 105, 246, 228, 60, 213, 219, 43, 43, 156,
+    173, 214, 208, 229, 75, 62, 137, 83, 48, 88, 212, 38, 187, 116, 103, 252, 21, 119, 112, 35, 245, 155, 158, 59, 0,
+    39, 33, 93, 175, 145, 243, 147, 214, 214, 84, 225, 211, 122, 27, 124, 6, 92, 191, 130, 91, 197, 111, 48, 67, 50,
+    182, 191, 66, 188, 203, 183, 104, 225, 151, 230, 178, 145, 221, 241, 166, 172, 69, 99, 45, 63, 24, 49, 149, 129, 30,
+    255, 240, 30, 139, 174, 246, 106, 251, 120, 78, 189, 144, 127, 80, 96, 127, 134, 218, 7, 127, 185, 52, 219, 221, 65,
+    216, 186, 99, 82, 47, 93, 153, 248, 62, 154, 241, 144, 122, 132, 162, 103, 19, 80, 168, 67, 134, 126, 85, 188, 130,
+    248, 51, 254, 250, 70, 183, 166, 98, 175, 15, 111, 215, 36, 204, 135, 137, 187, 6, 139, 25, 195, 190, 44, 236, 32,
+    192, 59, 159, 38, 180, 23, 181, 104, 52, 69, 144, 124, 246, 136, 50, 54, 224, 124, 29, 31, 13, 137, 161, 179, 160,
+    56, 143, 200, 0, 81, 216, 54, 254, 115, 26, 175, 231, 240, 1, 1, 76, 108, 38, 142, 4, 239, 26, 21, 150, 104, 117,
+    197, 134, 1, 207, 75, 255, 88, 63, 96, 185, 172, 84, 196, 210, 6, 191, 186, 18, 39, 253, 172, 130, 216, 131, 66, 37,
+    39, 217, 112, 38, 58, 7, 18, 157, 203, 140, 48, 125, 219, 30, 94, 8, 183, 80, 13, 79, 175, 118, 207, 215, 193, 221,
+    168, 27, 41, 5, 75, 2, 108, 1, 246, 25, 144, 28, 155, 131, 62, 7, 162, 240, 163, 53, 11, 34, 230, 229, 178, 89, 236,
+    10, 211, 65, 143, 27, 57, 134, 182, 29, 143, 90, 191, 185, 42, 75, 109, 43, 244, 136, 45, 214, 209, 81, 254, 164,
+    36, 236, 109, 248, 93, 156, 5, 227, 238, 1, 164, 73, 80, 223, 26, 33, 22, 237, 56, 51, 199, 21, 133, 27, 219, 44,
+    78, 167, 44, 70, 86, 153, 75, 59, 224, 43, 148, 224, 39, 105, 165, 230, 248, 8, 73, 248, 38, 214, 71, 153, 190, 45,
+    153, 254, 28, 53, 95, 105, 190, 63, 154, 250, 49, 67, 64, 96, 196, 129, 164, 1, 161, 117, 129, 172, 207, 56, 119,
+    127, 123, 162, 149, 59, 180, 108, 229, 205, 76, 29, 98, 20, 183, 28, 186, 101, 173, 108, 184, 5, 19, 132, 243, 57,
+    9, 237, 113, 164, 140, 35, 251, 244, 42, 0, 176, 120, 33, 162, 25, 24, 199, 92, 10, 226, 190, 153, 155, 193, 9, 175,
+    76, 65, 26, 189, 77, 203, 99, 189, 92, 0, 16, 192, 77, 18, 54, 168, 202, 114, 47, 246, 144, 185, 212, 133, 91, 110,
+    85, 150, 122, 162, 166, 248, 138, 183, 241, 142, 121, 201, 24, 136, 146, 142, 166, 38, 165, 54, 97, 249, 223, 51,
+    187, 207, 205, 28, 251, 56, 6, 154, 157, 231, 201, 231, 8, 250, 218, 144, 71, 245, 105, 41, 20, 60, 214, 163, 118,
+    87, 50, 190, 253, 175, 19, 192, 184, 119, 33, 220, 226, 238, 89, 35, 30, 152, 45, 213, 82, 153, 82, 129, 77, 8, 118,
+    80, 90, 149, 102, 156, 56, 127, 200, 152, 236, 199, 104, 228, 68, 44, 123, 122, 70, 175, 82, 99, 128, 19, 255, 151,
+    78, 167, 17, 217, 176, 117, 17, 134, 190, 187, 34, 91, 75, 29, 74, 253, 146, 109, 202, 135, 79, 173, 58, 71, 74,
+    228, 101, 240, 36, 80, 237, 61, 45, 23, 36, 61, 185, 90, 62, 177, 2, 238, 47, 173, 118, 86, 251, 53, 176, 76, 127,
+    101, 58, 174, 104, 37, 28, 191, 161, 19, 14, 228, 184, 12, 185, 241, 18, 97, 129, 59, 174, 41, 195, 136, 91, 171,
+    133, 79, 133, 238, 106, 224, 55, 122, 108, 244, 77, 184, 247, 58, 224, 67, 209, 158, 223, 233, 19, 24, 73, 12, 188,
+    60, 80, 20, 198, 26, 219, 1, 115, 199, 191, 83, 74, 122, 211, 117, 46, 233, 50, 130, 252, 35, 80, 199, 107, 46, 65,
+    159, 238, 179, 36, 229, 167, 131, 168, 208, 214, 46, 202, 101, 154, 62, 145, 226, 61, 67, 203, 61, 240, 146, 126,
+    20, 13, 212, 134, 185, 21, 81, 109, 122, 213, 45, 201, 103, 116, 137, 161, 89, 182, 207, 211, 90, 131, 252, 207,
+    255, 113, 83, 89, 60, 196, 222, 252, 50, 15, 229, 38, 2, 207, 192, 108, 107, 85, 158, 141, 101, 184, 247, 148, 17,
+    179, 178, 44, 192, 13, 241, 165, 83, 42, 189, 19, 248, 159, 190, 101, 2, 194, 66, 132, 126, 68, 19, 42, 199, 148,
+    187, 173, 167, 133, 49, 172, 25, 142, 174, 250, 181, 179, 91, 58, 4, 56, 164, 106, 228, 23, 118, 24, 53, 18, 93,
+    185, 88, 133, 62, 216, 48, 73, 9, 197, 122, 27, 212, 8, 5, 167, 192, 84, 74, 178, 25, 81, 148, 163, 244, 248, 254,
+    21, 14, 228, 131, 145, 185, 156, 229, 218, 219, 83, 4, 3, 66, 184, 158, 37, 66, 179, 11, 240, 30, 95, 19, 137, 226,
+    1, 120, 221, 228, 77, 103, 42, 182, 186, 72, 119, 77, 19, 159, 31, 84, 118, 171, 123, 152, 180, 59, 240, 108, 193,
+    156, 93, 150, 128, 96, 69, 137, 33, 26, 107, 92, 105, 12, 158, 107, 95, 70, 129, 145, 185, 195, 58, 38, 59, 235,
+    124, 248, 62, 70, 117, 235, 164, 67, 106, 66, 96, 19, 127, 209, 36, 217, 169, 135, 4, 102, 42, 69, 139, 183, 182,
+    41, 245, 2, 141, 22, 156, 87, 177, 153, 60, 156, 224, 41, 205, 154, 87, 2, 253, 129, 66, 6, 13, 15, 140, 165, 62,
+    51, 114, 253, 185, 188, 141, 188, 67, 44, 37, 21, 68, 110, 39, 180, 194, 254, 27, 188, 180, 186, 125, 41, 4, 143,
+    217, 26, 97, 215, 154, 112, 214, 49, 43, 159, 15, 1, 95, 19, 19, 108, 222, 171, 86, 195, 155, 231, 22, 65, 81, 13,
+    89, 233, 58, 170, 227, 90, 172, 169, 162, 216, 229, 98, 139, 225, 136, 161, 217, 238, 128, 249, 205, 211, 159, 176,
+    17, 43, 89, 52, 57, 225, 203, 110, 195, 64, 10, 38, 27, 83, 139, 108, 35, 207, 27, 185, 196, 38, 40, 85, 157, 82,
+    86, 41, 188, 182, 128, 20, 75, 235, 102, 148, 254, 23, 67, 207, 85, 222, 31, 137, 116, 12, 179, 124, 28, 169, 242,
+    223, 108, 234, 73, 161, 199, 212, 14, 54, 255, 115, 19, 32, 96, 161, 202, 135, 60, 150, 106, 132, 202, 86, 59, 143,
+    120, 20, 228, 164, 228, 175, 225, 160, 87, 55, 246, 16, 78, 237, 244, 19, 95, 38, 167, 128, 58, 8, 168, 15, 28, 232,
+    147, 185, 84, 19, 102, 61, 214, 238, 211, 32, 182, 216, 227, 58, 109, 141, 240, 242, 159, 59, 171, 210, 191, 55,
+    213, 36, 24, 221, 199, 137, 176, 108, 171, 224, 211, 184, 206, 76, 172, 153, 115, 203, 170, 16, 135, 207, 192, 152,
+    8, 8, 129, 75, 159, 0, 126, 230, 18, 144, 53, 110, 25, 255, 249, 104, 130, 184, 12, 57, 145, 118, 58, 108, 58, 28,
+    16, 24, 188, 222, 21, 3, 4, 128, 191, 173, 149, 82, 141, 231, 169, 37, 188, 85, 123, 84, 165, 67, 49, 248, 185, 138,
+    180, 195, 121, 168, 200, 44, 134, 214, 149, 30, 158, 164, 131, 199, 78, 83, 141, 60, 238, 160, 19, 3, 71, 226, 91,
+    145, 156, 102, 111, 125, 10, 218, 191, 33, 216, 242, 54, 63, 210, 79, 160, 154, 27, 89, 63, 143, 17, 64, 239, 114,
+    195, 80, 197, 208, 61, 80, 15, 103, 155, 69, 66, 13, 135, 114, 3, 137, 88, 155, 135, 101, 12, 108, 140, 231, 23, 77,
+    0, 136, 32, 86, 15, 99, 195, 112, 193, 239, 165, 40, 159, 221, 179, 38, 109, 227, 25, 78, 99, 47, 63, 35, 29, 121,
+    133, 79, 186, 198, 27, 32, 112, 171, 233, 228, 17, 103, 48, 44, 129, 157, 211, 33, 185, 30, 136, 118, 159, 6, 10,
+    94, 161, 234, 131, 54, 164, 163, 239, 16, 232, 202, 137, 232, 99, 164, 99, 59, 14, 240, 79, 206, 240, 128, 4, 129,
+    35, 122, 53, 139, 59, 59, 4, 233, 72, 2, 114, 118, 245, 105, 127, 16, 146, 213, 158, 178, 204, 200, 20, 14, 197,
+    255, 154, 204, 213, 182, 11, 151, 115, 155, 101, 54, 200, 87, 140, 135, 21, 126, 10, 184, 116, 39, 225, 230, 46,
+    199, 205, 138, 43, 212, 136, 24, 220, 94, 58, 13, 220, 188, 255, 17, 167, 152, 211, 38, 135, 76, 225, 244, 249, 73,
+    31, 114, 236, 254, 254, 197, 203, 107, 49, 214, 216, 70, 11, 195, 241, 63, 136, 158, 66, 135, 119, 95, 190, 177,
+    211, 82, 96, 135, 189, 163, 233, 124, 193, 98, 188, 193, 113, 220, 112, 241, 50, 154, 169, 99, 17, 193, 107, 149,
+    237, 146, 55, 125, 246, 231, 193, 130, 224, 59, 5, 244, 233, 148, 151, 139, 233, 193, 248, 92, 80, 53, 16, 170, 239,
+    4, 185, 177, 38, 67, 240, 135, 141, 140, 27, 56, 69, 219, 110, 72, 136, 102, 95, 141, 63, 241, 26, 32, 119, 250, 77,
+    172, 253, 119, 216, 161, 67, 252, 221, 204, 134, 119, 194, 110, 122, 240, 199, 129, 169, 191, 123, 200, 184, 169,
+    177, 91, 149, 43, 216, 197, 7, 200, 160, 253, 213, 158, 210, 85, 241, 111, 209, 209, 210, 133, 250, 87, 178, 189,
+    146, 74, 48, 165, 138, 228, 22, 41, 124, 110, 237, 232, 10, 145, 195, 38, 54, 142, 127, 231, 92, 137, 65, 220, 170,
+    47, 208, 150, 125, 217, 11, 152, 201, 218, 51, 249, 144, 129, 79, 229, 211, 111, 77, 22, 228, 11, 17, 74, 32, 0,
+    119, 120, 105, 222, 137, 229, 65, 78, 250, 67, 113, 226, 240, 210, 8, 129, 196, 63, 226, 233, 204, 171, 50, 133, 8,
+    31, 43, 144, 253, 118, 111, 112, 198, 205, 146, 100, 239, 68, 130, 7, 220, 199, 184, 195, 181, 9, 55, 143, 237, 136,
+    164, 7, 243, 17, 223, 164, 122, 74, 77, 23, 92, 162, 26, 60, 192, 252, 109, 116, 87, 91, 175, 148, 191, 42, 103, 17,
+    38, 246, 114, 46, 102, 202, 188, 78, 188, 233, 222, 130, 247, 28, 22, 99, 7, 5, 238, 35, 80, 44, 243, 43, 24, 242,
+    89, 232, 69, 172, 120, 49, 20, 92, 246, 198, 89, 160, 43, 215, 26, 202, 126, 60, 241, 51, 136, 184, 157, 186, 124,
+    5, 40, 87, 241, 62, 218, 104, 246, 71, 95, 226, 48, 180, 200, 109, 112, 254, 161, 152, 252, 53, 104, 21, 86, 169,
+    67, 141, 250, 74, 25, 123, 232, 139, 235, 212, 39, 242, 115, 127, 62, 145, 228, 175, 245, 68, 74, 182, 20, 223, 36,
+    85, 43, 223, 188, 43, 203, 110, 79, 34, 185, 8, 22, 159, 79, 170, 96, 109, 126, 187, 8, 217, 62, 99, 178, 67, 210,
+    253, 226, 192, 173, 8, 175, 51, 208, 94, 183, 21, 220, 210, 116, 113, 240, 100, 46, 182, 70, 199, 216, 90, 237, 242,
+    200, 136, 11, 154, 27, 168, 218, 95, 110, 254, 219, 51, 204, 160, 89, 69, 138, 166, 134, 175, 222, 13, 173, 130,
+    220, 108, 106, 132, 41, 86, 132, 3, 129, 109, 135, 30, 49, 97, 18, 55, 201, 62, 98, 49, 167, 97, 248, 182, 87, 196,
+    142, 117, 59, 149, 253, 198, 203, 168, 186, 89, 155, 250, 222, 4, 155, 209, 176, 33, 94, 94, 183, 43, 152, 203, 241,
+    116, 175, 198, 121, 106, 184, 99, 27, 251, 183, 11, 134, 8, 146, 184, 162, 192, 57, 25, 27, 251, 125, 237, 33, 15,
+    249, 253, 138, 111, 59, 116, 145, 171, 192, 169, 221, 143, 40, 207, 11, 32, 142, 100, 73, 237, 180, 30, 166, 234,
+    34, 28, 184, 161, 215, 167, 240, 150, 28, 37, 171, 176, 53, 28, 185, 85, 91, 73, 101, 188, 59, 41, 227, 30, 82, 33,
+    208, 174, 252, 162, 174, 171, 23, 57, 100, 210, 87, 163, 17, 188, 107, 178, 139, 148, 4, 9, 110, 239, 69, 253, 26,
+    11, 96, 85, 240, 12, 115, 15, 83, 218, 14, 224, 175, 217, 181, 209, 0, 16, 167, 115, 188, 15, 7, 169, 204, 40, 153,
+    72, 246, 211, 18, 44, 122, 95, 106, 108, 13, 216, 35, 88, 209, 164, 161, 244, 181, 31, 84, 90, 59, 11, 143, 249, 7,
+    195, 58, 217, 197, 76, 191, 238, 123, 60, 82, 67, 20, 28, 95, 155, 13, 77, 123, 222, 99, 64, 105, 48, 130, 158, 203,
+    77, 107, 244, 232, 92, 41, 34, 2, 218, 90, 42, 104, 217, 9, 24, 23, 125, 54, 252, 138, 238, 53, 162, 11, 224, 121,
+    183, 83, 113, 255, 51, 155, 49, 45, 192, 3, 60, 206, 47, 193, 185, 216, 240, 67, 225, 190, 81, 247, 220, 245, 106,
+    195, 252, 43, 88, 213, 196, 157, 246, 255, 166, 255, 204, 190, 183, 108, 68, 28, 174, 84, 175, 108, 33, 40, 135,
+    207, 139, 230, 200, 177, 75, 19, 221, 115, 134, 100, 172, 113, 89, 83, 39, 146, 175, 159, 165, 49, 16, 42, 64, 77,
+    237, 113, 189, 150, 99, 139, 77, 235, 18, 217, 79, 176, 69, 235, 11, 254, 211, 100, 33, 225, 1, 42, 116, 83, 37, 26,
+    128, 111, 18, 59, 110, 192, 225, 81, 207, 29, 182, 176, 246, 117, 6, 89, 199, 100, 212, 158, 116, 177, 129, 140, 86,
+    85, 163, 61, 32, 198, 26, 117, 102, 69, 145, 182, 128, 67, 138, 246, 76, 22, 91, 13, 90, 20, 226, 210, 168, 83, 171,
+    44, 180, 195, 235, 182, 90, 5, 208, 19, 77, 227, 148, 10, 218, 44, 201, 160, 75, 151, 38, 103, 163, 54, 72, 109,
+    128, 109, 247, 216, 222, 133, 22, 139, 97, 157, 42, 46, 64, 167, 76, 160, 197, 81, 161, 236, 163, 220, 224, 130, 72,
+    189, 204, 161, 64, 195, 37, 111, 18, 91, 70, 173, 148, 53, 148, 229, 172, 148, 231, 156, 248, 80, 228, 215, 229,
+    196, 240, 234, 146, 96, 151, 7, 56, 228, 249, 41, 123, 13, 115, 22, 130, 63, 138, 93, 82, 4, 192, 237, 176, 129,
+    236, 35, 82, 88, 12, 123, 128, 102, 120, 149, 166, 112, 153, 74, 194, 135, 122, 143, 113, 243, 228, 236, 13, 178,
+    120, 31, 97, 238, 159, 244, 57, 46, 189, 51, 99, 224, 40, 161, 84, 67, 156, 234, 236, 140, 173, 0, 59, 157, 34, 206,
+    27, 14, 252, 196, 20, 84, 93, 210, 227, 187, 111, 239, 31, 190, 63, 53, 11, 165, 56, 67, 121, 228, 218, 198, 58,
+    107, 47, 190, 167, 211, 193, 18, 140, 228, 225, 20, 116, 95, 229, 254, 181, 31, 170, 72, 79, 230, 174, 46, 225, 203,
+    192, 212, 35, 121, 25, 167, 238, 121, 214, 54, 172, 242, 120, 108, 175, 28, 65, 251, 255, 25, 30, 39, 79, 119, 30,
+    198, 58, 153, 225, 252, 174, 3, 240, 157, 29, 51, 104, 122, 81, 34, 184, 150, 144, 117, 92, 52, 100, 60, 189, 214,
+    173, 209, 93, 92, 151, 225, 151, 53, 181, 46, 230, 165, 73, 84, 31, 158, 136, 209, 188, 8, 4, 169, 221, 185, 27, 87,
+    50, 200, 61, 202, 16, 6, 6, 233, 177, 148, 127, 235, 232, 67, 241, 56, 12, 171, 176, 184, 120, 174, 37, 158, 189,
+    170, 70, 119, 121, 12, 36, 246, 174, 95, 1, 121, 59, 128, 205, 83, 153, 11, 149, 49, 147, 239, 108, 23, 253, 143, 2,
+    93, 209, 34, 234, 221, 96, 58, 87, 85, 170, 42, 203, 48, 87, 119, 199, 144, 104, 220, 26, 17, 3, 101, 248, 105, 100,
+    119, 11, 212, 64, 189, 159, 135, 187, 97, 165, 16, 36, 21, 172, 108, 73, 47, 237, 192, 75, 62, 187, 76, 243, 115,
+    249, 197, 175, 219, 243, 84, 163, 130, 98, 18, 28, 170, 227, 77, 96, 220, 205, 140, 103, 57, 66, 45, 211, 171, 66,
+    86, 14, 84, 60, 234, 12, 148, 117, 127, 143, 224, 39, 163, 213, 119, 233, 26, 174, 133, 72, 61, 175, 112, 246, 74,
+    1, 242, 54, 183, 162, 177, 107, 28, 122, 19, 89, 198, 62, 197, 18, 224, 220, 240, 174, 164, 108, 209, 163, 202, 106,
+    153, 104, 94, 115, 87, 210, 85, 106, 183, 237, 121, 224, 19, 56, 20, 66, 228, 19, 196, 72, 86, 93, 216, 227, 107,
+    93, 54, 253, 50, 110, 100, 202, 58, 161, 10, 172, 114, 105, 186, 106, 203, 253, 169, 194, 122, 72, 250, 128, 53,
+    224, 233, 195, 88, 149, 38, 135, 182, 89, 117, 47, 189, 154, 186, 25, 179, 90, 192, 164, 114, 68, 12, 141, 237, 4,
+    97, 86, 215, 196, 30, 181, 51, 95, 92, 119, 241, 154, 43, 120, 126, 186, 179, 169, 248, 188, 72, 55, 207, 38, 129,
+    165, 223, 71, 83, 26, 216, 163, 208, 78, 140, 237, 127, 30, 138, 83, 213, 221, 255, 76, 121, 20, 64, 59, 210, 207,
+    70, 167, 58, 199, 188, 0, 32, 131, 80, 90, 38, 25, 27, 184, 216, 248, 234, 209, 198, 1, 178, 183, 68, 163, 149, 128,
+    235, 163, 223, 182, 13, 249, 248, 216, 9, 219, 141, 69, 210, 111, 179, 233, 119, 194, 206, 3, 81, 11, 130, 79, 15,
+    68, 31, 56, 76, 24, 148, 85, 159, 204, 232, 122, 63, 77, 224, 62, 150, 237, 93, 252, 243, 204, 221, 55, 28, 75, 251,
+    11, 175, 116, 156, 183, 139, 203, 197, 212, 233, 27, 59, 187, 86, 183, 73, 220, 37, 87, 226, 110, 7, 214, 171, 209,
+    42, 62, 147, 146, 124, 221, 59, 200, 86, 249, 129, 247, 183, 148, 50, 186, 218, 94, 244, 155, 5, 45, 70, 104, 18,
+    109, 23, 195, 129, 63, 29, 25, 223, 105, 223, 243, 113, 226, 152, 9, 85, 217, 234, 212, 250, 244, 231, 103, 215,
+    219, 139, 183, 249, 166, 73, 34, 121, 139, 170, 196, 234, 228, 11, 175, 110, 205, 235, 213, 130, 199, 129, 200, 153,
+    88, 147, 203, 186, 241, 47, 75, 56, 91, 179, 147, 10, 24, 38, 1, 127, 104, 114, 218, 6, 89, 170, 48, 35, 181, 70,
+    167, 190, 155, 29, 236, 245, 215, 236, 135, 246, 83, 111, 139, 154, 91, 224, 147, 227, 73, 253, 248, 242, 213, 252,
+    172, 188, 60, 123, 15, 118, 136, 165, 217, 129, 66, 139, 177, 199, 78, 100, 209, 77, 204, 123, 106, 152, 243, 172,
+    146, 99, 30, 68, 151, 164, 80, 124, 50, 91, 137, 206, 180, 6, 120, 200, 141, 52, 22, 119, 146, 111, 46, 109, 0, 248,
+    107, 145, 177, 58, 26, 248, 95, 158, 7, 188, 191, 234, 160, 83, 113, 10, 107, 92, 11, 113, 64, 227, 55, 109, 8, 33,
+    154, 147, 14, 82, 58, 242, 204, 96, 47, 236, 203, 55, 182, 61, 139, 168, 81, 204, 168, 118, 11, 224, 190, 136, 209,
+    254, 124, 81, 127, 164, 45, 68, 162, 37, 39, 227, 246, 120, 78, 114, 24, 88, 37, 122, 121, 113, 167, 134, 181, 18,
+    94, 26, 192, 15, 213, 99, 114, 237, 110, 39, 2, 123, 108, 249, 242, 187, 126, 92, 207, 69, 142, 95, 163, 142, 228,
+    52, 121, 142, 150, 52, 124, 63, 116, 19, 10, 197, 38, 242, 6, 239, 140, 79, 147, 111, 138, 173, 179, 156, 158, 72,
+    244, 7, 232, 104, 218, 7, 180, 89, 132, 135, 71, 8, 143, 234, 183, 188, 183, 187, 161, 150, 7, 107, 4, 151, 203,
+    104, 18, 213, 207, 214, 90, 130, 8, 83, 210, 173, 105, 172, 254, 126, 23, 135, 25, 157, 81, 146, 160, 41, 111, 57,
+    154, 57, 228, 179, 128, 252, 15, 112, 52, 97, 38, 30, 230, 160, 71, 208, 145, 94, 92, 144, 150, 79, 11, 113, 50, 8,
+    240, 70, 26, 189, 8, 244, 163, 31, 45, 94, 217, 109, 244, 54, 57, 223, 153, 126, 178, 110, 197, 116, 128, 52, 109,
+    120, 12, 213, 202, 135, 61, 130, 107, 65, 238, 244, 247, 69, 96, 165, 155, 226, 95, 150, 47, 154, 109, 177, 112,
+    180, 131, 162, 4, 109, 98, 252, 78, 33, 91, 111, 234, 135, 250, 110, 61, 144, 98, 185, 171, 113, 130, 30, 229, 193,
+    196, 144, 98, 180, 62, 177, 34, 128, 62, 195, 128, 172, 178, 16, 4, 171, 224, 43, 152, 185, 123, 1, 184, 78, 218,
+    39, 0, 115, 59, 30, 20, 148, 185, 160, 100, 253, 56, 145, 209, 217, 109, 141, 149, 154, 190, 199, 224, 15, 144, 204,
+    253, 22, 200, 24, 78, 196, 76, 226, 226, 114, 18, 123, 115, 0, 241, 29, 76, 139, 53, 98, 205, 225, 48, 224, 153,
+    204, 237, 36, 34, 178, 221, 43, 242, 66, 79, 48, 46, 194, 163, 241, 155, 140, 45, 162, 144, 104, 193, 23, 205, 146,
+    240, 189, 53, 210, 73, 44, 190, 189, 165, 108, 192, 139, 73, 36, 113, 114, 6, 149, 192, 162, 103, 70, 230, 7, 20,
+    99, 160, 18, 170, 41, 51, 213, 206, 188, 209, 193, 178, 199, 253, 43, 94, 72, 166, 41, 190, 221, 151, 78, 238, 156,
+    144, 211, 105, 239, 151, 127, 204, 82, 194, 164, 140, 159, 221, 227, 168, 229, 56, 52, 89, 42, 220, 49, 101, 72,
+    155, 74, 220, 126, 72, 171, 12, 49, 37, 45, 168, 136, 141, 171, 221, 118, 60, 32, 80, 149, 170, 185, 94, 82, 229,
+    187, 21, 100, 71, 132, 104, 0, 144, 62, 77, 136, 92, 155, 176, 71, 253, 12, 68, 125, 139, 224, 221, 119, 28, 199,
+    148, 114, 153, 72, 4, 178, 130, 72, 108, 81, 114, 77, 188, 88, 48, 225, 172, 137, 216, 24, 61, 111, 254, 64, 157,
+    86, 157, 127, 97, 190, 204, 202, 29, 125, 243, 251, 182, 101, 210, 127, 14, 23, 65, 114, 7, 34, 211, 175, 167, 79,
+    13, 202, 134, 101, 223, 103, 250, 111, 188, 187, 228, 231, 95, 147, 61, 242, 176, 115, 148, 41, 198, 97, 161, 42,
+    211, 235, 167, 156, 170, 54, 174, 78, 153, 220, 8, 148, 164, 100, 216, 14, 227, 242, 88, 163, 49, 229, 191, 36, 86,
+    221, 123, 100, 53, 185, 40, 180, 242, 134, 53, 52, 191, 187, 152, 0, 108, 154, 106, 100, 51, 147, 196, 209, 87, 173,
+    146, 200, 247, 75, 222, 53, 123, 199, 5, 255, 223, 165, 19, 191, 227, 223, 162, 170, 219, 96, 156, 148, 144, 57, 54,
+    186, 90, 156, 156, 60, 158, 91, 193, 33, 76, 226, 15, 205, 73, 168, 236, 98, 182, 181, 45, 75, 184, 36, 116, 204,
+    21, 50, 150, 79, 31, 1, 105, 230, 242, 197, 243, 130, 227, 187, 198, 46, 30, 44, 154, 6, 206, 165, 33, 21, 134, 77,
+    24, 74, 155, 111, 225, 247, 94, 251, 43, 129, 133, 23, 154, 88, 36, 226, 173, 110, 222, 64, 147, 137, 162, 19, 94,
+    24, 7, 194, 241, 222, 163, 117, 216, 135, 21, 180, 94, 56, 72, 130, 220, 175, 23, 173, 234, 237, 175, 166, 108, 199,
+    30, 31, 152, 100, 116, 210, 196, 224, 11, 84, 95, 38, 66, 59, 152, 251, 23, 248, 120, 22, 210, 208, 127, 159, 18,
+    79, 231, 233, 128, 129, 38, 37, 80, 170, 123, 0, 170, 84, 21, 27, 202, 142, 31, 33, 156, 140, 68, 171, 173, 59, 55,
+    221, 90, 54, 205, 97, 118, 133, 226, 222, 31, 125, 182, 250, 19, 102, 4, 222, 51, 240, 102, 101, 254, 131, 134, 155,
+    87, 1, 19, 89, 80, 104, 126, 89, 233, 82, 40, 85, 216, 46, 2, 248, 17, 49, 230, 41, 7, 199, 55, 196, 61, 19, 8, 104,
+    10, 25, 36, 155, 14, 150, 46, 166, 211, 14, 119, 68, 36, 209, 215, 20, 155, 179, 248, 200, 217, 144, 83, 62, 239,
+    119, 95, 139, 161, 32, 144, 133, 184, 102, 199, 204, 173, 17, 35, 133, 76, 123, 69, 172, 212, 4, 32, 210, 158, 201,
+    82, 20, 117, 200, 81, 149, 162, 142, 133, 26, 239, 71, 233, 13, 184, 76, 152, 194, 188, 143, 1, 170, 8, 156, 5, 152,
+    68, 124, 241, 167, 92, 202, 211, 140, 89, 30, 94, 160, 115, 51, 206, 20, 104, 224, 152, 238, 242, 53, 111, 195, 255,
+    172, 219, 32, 26, 1, 242, 13, 85, 192, 148, 70, 208, 80, 9, 20, 67, 190, 108, 64, 60, 104, 142, 124, 247, 160, 249,
+    13, 68, 43, 189, 11, 194, 38, 246, 253, 7, 60, 182, 18, 74, 168, 77, 153, 7, 52, 186, 225, 203, 182, 50, 231, 205,
+    153, 17, 180, 249, 39, 134, 193, 137, 185, 221, 218, 34, 225, 249, 198, 237, 254, 10, 47, 237, 251, 231, 223, 144,
+    184, 89, 176, 19, 150, 72, 0, 80, 5, 218, 157, 215, 96, 32, 11, 165, 242, 87, 83, 199, 244, 163, 158, 143, 202, 15,
+    88, 110, 195, 10, 30, 20, 108, 252, 8, 119, 141, 105, 196, 156, 113, 206, 255, 118, 108, 47, 97, 152, 39, 240, 166,
+    23, 118, 239, 159, 16, 71, 113, 39, 143, 167, 117, 42, 35, 239, 237, 100, 148, 103, 135, 135, 73, 3, 74, 122, 146,
+    250, 229, 28, 223, 156, 108, 193, 128, 229, 86, 32, 231, 170, 116, 226, 43, 223, 115, 81, 9, 187, 36, 231, 88, 90,
+    252, 223, 179, 79, 113, 222, 214, 7, 140, 129, 94, 29, 117, 127, 141, 26, 50, 84, 194, 207, 37, 56, 172, 163, 129,
+    227, 201, 142, 134, 119, 215, 198, 195, 180, 89, 125, 54, 182, 119, 217, 52, 152, 128, 252, 34, 23, 119, 44, 131,
+    189, 113, 153, 221, 186, 95, 180, 139, 118, 223, 51, 170, 210, 196, 126, 221, 26, 105, 65, 119, 3, 42, 72, 95, 155,
+    8, 91, 186, 220, 111, 152, 69, 56, 181, 204, 127, 121, 147, 150, 134, 146, 34, 209, 174, 81, 167, 126, 89, 230, 4,
+    96, 87, 183, 4, 130, 40, 213, 138, 209, 203, 15, 242, 1, 8, 106, 226, 136, 12, 105, 17, 61, 177, 1, 165, 159, 207,
+    145, 3, 119, 115, 204, 251, 92, 127, 199, 150, 43, 229, 72, 208, 72, 7, 114, 220, 10, 243, 158, 225, 5, 184, 201,
+    90, 215, 122, 202, 73, 249, 111, 49, 32, 152, 232, 99, 154, 168, 202, 181, 142, 64, 89, 84, 97, 111, 178, 175, 234,
+    7, 210, 133, 1, 9, 247, 70, 50, 70, 80, 153, 102, 193, 116, 180, 154, 137, 141, 152, 240, 139, 206, 31, 99, 21, 51,
+    231, 171, 81, 44, 171, 236, 13, 104, 77, 105, 123, 209, 94, 58, 108, 244, 26, 210, 123, 193, 184, 249, 191, 186,
+    130, 147, 3, 118, 76, 87, 253, 159, 236, 127, 87, 214, 160, 162, 209, 59, 100, 182, 111, 58, 138, 55, 56, 24, 172,
+    58, 42, 51, 114, 8, 110, 8, 175, 9, 67, 199, 212, 85, 163, 83, 179, 68, 9, 79, 94, 100, 88, 202, 22, 17, 21, 107,
+    188, 241, 94, 160, 17, 42, 217, 78, 106, 205, 83, 82, 225, 109, 159, 131, 217, 214, 135, 62, 73, 48, 11, 73, 242,
+    249, 48, 164, 2, 60, 45, 178, 129, 159, 23, 219, 5, 153, 64, 72, 150, 188, 182, 57, 22, 157, 123, 19, 44, 246, 154,
+    208, 251, 214, 73, 81, 255, 36, 158, 185, 155, 86, 218, 91, 159, 171, 2, 146, 43, 252, 235, 182, 128, 138, 66, 155,
+    244, 35, 209, 226, 202, 48, 117, 229, 102, 3, 46, 240, 251, 158, 99, 49, 67, 235, 106, 78, 171, 179, 91, 62, 24, 12,
+    243, 110, 35, 12, 49, 71, 137, 154, 30, 230, 57, 161, 12, 116, 186, 176, 147, 146, 73, 147, 170, 135, 21, 215, 195,
+    187, 152, 104, 254, 122, 193, 214, 255, 48, 169, 56, 215, 188, 153, 177, 100, 211, 242, 151, 131, 130, 212, 149, 64,
+    39, 109, 188, 153, 34, 178, 79, 187, 131, 68, 37, 140, 247, 208, 6, 164, 199, 63, 48, 132, 253, 23, 193, 208, 106,
+    35, 57, 214, 125, 234, 60, 125, 234, 177, 46, 149, 33, 89, 160, 60, 187, 45, 15, 94, 195, 147, 159, 50, 209, 253,
+    74, 127, 107, 48, 234, 81, 63, 230, 242, 101, 91, 247, 245, 186, 161, 10, 22, 74, 250, 82, 201, 95, 42, 101, 133,
+    199, 213, 134, 93, 96, 134, 207, 252, 66, 179, 95, 247, 91, 83, 179, 253, 220, 91, 59, 101, 184, 85, 190, 240, 230,
+    2, 138, 130, 184, 27, 179, 183, 117, 9, 120, 133, 197, 190, 0, 174, 93, 49, 78, 241, 114, 86, 65, 67, 28, 7, 86,
+    207, 60, 147, 78, 180, 118, 33, 108, 43, 214, 119, 0, 44, 88, 5, 203, 211, 99, 218, 83, 131, 72, 68, 52, 231, 11,
+    222, 241, 12, 230, 129, 2, 4, 67, 60, 56, 6, 6, 233, 170, 183, 88, 107, 86, 148, 239, 5, 102, 100, 184, 93, 202,
+    184, 18, 38, 94, 188, 52, 205, 64, 96, 51, 84, 198, 173, 121, 197, 126, 89, 174, 127, 161, 38, 71, 48, 253, 201, 36,
+    215, 45, 181, 98, 253, 106, 164, 86, 43, 95, 7, 155, 60, 61, 152, 186, 118, 82, 155, 46, 22, 229, 234, 208, 188, 23,
+    219, 223, 28, 225, 245, 50, 49, 215, 101, 109, 110, 251, 253, 50, 203, 206, 235, 170, 153, 147, 21, 48, 136, 40, 71,
+    117, 146, 153, 244, 146, 147, 174, 248, 190, 214, 169, 44, 129, 105, 104, 115, 36, 143, 225, 84, 164, 195, 181, 216,
+    133, 56, 9, 113, 160, 216, 197, 74, 243, 165, 56, 168, 189, 12, 204, 114, 143, 37, 124, 200, 220, 113, 125, 230, 23,
+    15, 254, 212, 57, 105, 84, 50, 49, 39, 243, 122, 111, 196, 71, 20, 13, 210, 251, 210, 139, 198, 139, 115, 64, 46,
+    68, 87, 130, 217, 177, 30, 81, 242, 5, 48, 203, 10, 236, 167, 67, 12, 164, 107, 137, 73, 144, 212, 10, 43, 232, 12,
+    215, 55, 20, 69, 183, 251, 87, 162, 78, 224, 141, 2, 25, 160, 245, 219, 238, 22, 155, 4, 59, 213, 229, 214, 170, 93,
+    100, 147, 66, 134, 1, 140, 227, 233, 43, 67, 182, 126, 189, 136, 106, 100, 169, 17, 218, 121, 36, 60, 237, 150, 100,
+    161, 17, 244, 143, 36, 218, 229, 182, 184, 67, 45, 76, 174, 64, 63, 107, 196, 1, 97, 92, 89, 105, 243, 190, 192,
+    154, 169, 50, 42, 7, 25, 188, 92, 19, 38, 181, 190, 133, 255, 48, 35, 181, 129, 44, 197, 26, 237, 95, 48, 95, 14,
+    213, 109, 133, 152, 81, 73, 30, 234, 62, 56, 119, 47, 188, 207, 53, 155, 125, 34, 149, 2, 83, 155, 95, 49, 33, 99,
+    51, 52, 167, 103, 86, 243, 46, 196, 20, 187, 248, 224, 39, 48, 52, 108, 119, 107, 5, 46, 10, 163, 2, 59, 42, 17, 50,
+    29, 6, 14, 231, 99, 123, 151, 103, 15, 226, 33, 87, 127, 177, 225, 41, 47, 186, 205, 226, 56, 67, 110, 169, 14, 56,
+    121, 158, 44, 102, 125, 104, 201, 79, 207, 107, 111, 181, 50, 39, 114, 204, 168, 116, 128, 156, 14, 223, 58, 108,
+    26, 77, 209, 220, 183, 123, 130, 201, 43, 246, 230, 135, 55, 113, 74, 25, 94, 249, 70, 187, 107, 182, 182, 255, 214,
+    47, 91, 127, 220, 227, 239, 2, 209, 81, 115, 144, 111, 100, 147, 43, 185, 250, 247, 46, 232, 155, 78, 254, 226, 158,
+    204, 93, 29, 43, 167, 22, 210, 154, 129, 5, 66, 146, 231, 249, 205, 168, 59, 179, 169, 132, 22, 193, 146, 67, 218,
+    82, 84, 31, 163, 163, 171, 230, 243, 224, 13, 121, 56, 6, 156, 237, 190, 222, 62, 119, 194, 249, 16, 207, 132, 136,
+    185, 250, 92, 178, 51, 209, 212, 58, 91, 15, 49, 227, 199, 196, 121, 104, 125, 38, 84, 6, 153, 140, 255, 219, 115,
+    79, 254, 95, 184, 117, 147, 18, 135, 9, 89, 55, 151, 65, 98, 140, 143, 253, 223, 147, 75, 131, 5, 7, 134, 34, 71, 8,
+    52, 135, 142, 176, 179, 145, 227, 136, 225, 177, 190, 113, 38, 147, 253, 94, 179, 114, 57, 63, 205, 109, 100, 24,
+    144, 165, 73, 38, 120, 200, 132, 44, 175, 243, 252, 220, 7, 109, 199, 206, 114, 94, 224, 138, 166, 218, 111, 123,
+    214, 158, 90, 97, 215, 85, 189, 47, 251, 153, 222, 50, 4, 26, 90, 248, 208, 235, 253, 236, 249, 192, 122, 31, 43,
+    17, 162, 193, 79, 198, 204, 1, 58, 137, 16, 181, 95, 189, 73, 110, 103, 21, 214, 173, 98, 85, 67, 82, 227, 19, 120,
+    20, 160, 168, 121, 58, 83, 111, 18, 135, 51, 43, 1, 114, 145, 142, 9, 57, 81, 161, 141, 211, 134, 243, 97, 58, 163,
+    143, 41, 189, 212, 116, 4, 21, 249, 104, 140, 9, 105, 22, 29, 149, 35, 232, 231, 147, 254, 0, 131, 50, 51, 232, 66,
+    116, 8, 133, 147, 85, 27, 113, 132, 10, 194, 32, 10, 225, 234, 32, 16, 247, 10, 243, 17, 60, 127, 158, 245, 154, 82,
+    206, 130, 5, 124, 184, 185, 65, 206, 48, 49, 153, 45, 110, 85, 198, 4, 76, 67, 117, 236, 126, 9, 70, 77, 216, 137,
+    131, 244, 57, 211, 52, 19, 154, 91, 70, 51, 125, 254, 253, 176, 14, 155, 101, 11, 85, 194, 75, 51, 86, 20, 237, 101,
+    224, 152, 40, 184, 240, 141, 144, 167, 137, 117, 233, 231, 249, 27, 113, 247, 228, 51, 93, 172, 34, 164, 242, 138,
+    149, 211, 102, 107, 94, 238, 108, 68, 231, 99, 183, 34, 163, 84, 102, 143, 94, 79, 56, 26, 143, 25, 137, 53, 150,
+    36, 57, 12, 133, 254, 75, 139, 206, 219, 60, 138, 104, 140, 138, 71, 4, 60, 249, 233, 28, 61, 133, 194, 27, 249,
+    205, 180, 195, 29, 74, 134, 66, 129, 74, 153, 55, 185, 12, 5, 2, 169, 156, 240, 89, 172, 148, 2, 171, 227, 168, 97,
+    0, 34, 206, 201, 62, 190, 58, 219, 96, 12, 63, 184, 91, 179, 139, 66, 107, 222, 242, 163, 249, 43, 205, 164, 138,
+    139, 215, 144, 224, 189, 55, 170, 214, 77, 52, 11, 252, 134, 134, 215, 29, 217, 21, 46, 194, 181, 102, 114, 179, 83,
+    173, 123, 17, 70, 190, 68, 240, 148, 229, 203, 192, 151, 82, 127, 38, 223, 211, 212, 223, 191, 58, 178, 131, 242,
+    140, 255, 250, 170, 85, 196, 195, 216, 109, 42, 89, 12, 45, 62, 69, 44, 175, 155, 62, 90, 254, 247, 171, 131, 125,
+    197, 99, 39, 243, 52, 235, 82, 141, 108, 210, 148, 27, 191, 61, 241, 165, 42, 143, 70, 0, 189, 55, 70, 128, 121, 96,
+    241, 186, 214, 80, 124, 135, 187, 121, 123, 15, 175, 14, 19, 22, 198, 207, 64, 170, 204, 45, 147, 251, 28, 215, 23,
+    198, 252, 136, 161, 219, 223, 96, 0, 51, 17, 165, 245, 87, 199, 92, 227, 44, 199, 99, 94, 185, 237, 9, 190, 107, 51,
+    53, 200, 94, 188, 79, 126, 217, 165, 146, 127, 146, 34, 192, 25, 114, 197, 172, 254, 254, 9, 64, 93, 233, 116, 21,
+    239, 208, 189, 237, 212, 41, 95, 144, 43, 226, 189, 17, 177, 200, 207, 114, 181, 37, 184, 233, 254, 60, 11, 205, 75,
+    90, 74, 33, 82, 20, 7, 155, 63, 230, 223, 59, 244, 233, 6, 85, 78, 162, 3, 216, 111, 222, 147, 141, 243, 12, 73,
+    252, 45, 90, 78, 177, 223, 144, 141, 202, 111, 19, 51, 90, 50, 214, 151, 246, 132, 6, 4, 47, 215, 252, 203, 155, 69,
+    208, 31, 139, 141, 14, 48, 73, 138, 64, 220, 202, 212, 87, 87, 74, 246, 207, 167, 15, 173, 168, 196, 151, 42, 166,
+    105, 115, 41, 165, 213, 91, 161, 195, 229, 232, 141, 170, 189, 24, 205, 14, 86, 81, 227, 175, 230, 123, 193, 1, 7,
+    14, 139, 110, 88, 111, 2, 99, 13, 164, 211, 230, 196, 142, 128, 58, 218, 101, 212, 55, 126, 235, 189, 245, 162, 102,
+    190, 109, 197, 225, 29, 68, 165, 28, 153, 227, 176, 100, 150, 84, 57, 35, 141, 60, 204, 32, 36, 249, 250, 117, 58,
+    110, 110, 218, 189, 138, 92, 205, 117, 113, 127, 63, 148, 21, 190, 168, 70, 112, 233, 239, 125, 36, 120, 132, 158,
+    110, 156, 222, 180, 123, 25, 204, 109, 217, 150, 111, 174, 96, 130, 18, 22, 222, 85, 188, 83, 254, 224, 67, 225, 4,
+    59, 221, 123, 228, 154, 44, 59, 73, 151, 240, 140, 94, 135, 11, 134, 7, 158, 211, 84, 201, 66, 230, 194, 158, 153,
+    175, 186, 86, 95, 161, 11, 23, 84, 127, 162, 193, 81, 133, 28, 149, 124, 98, 252, 27, 253, 90, 114, 24, 143, 132,
+    114, 238, 92, 123, 7, 149, 222, 188, 24, 66, 93, 149, 30, 83, 49, 195, 227, 169, 240, 205, 71, 0, 188, 167, 234, 44,
+    178, 250, 93, 93, 206, 103, 79, 150, 42, 136, 178, 237, 147, 9, 188, 183, 202, 5, 20, 54, 210, 140, 153, 208, 137,
+    149, 119, 38, 126, 218, 121, 121, 36, 49, 54, 33, 164, 127, 104, 205, 163, 147, 210, 85, 54, 111, 168, 17, 175, 84,
+    21, 51, 33, 142, 51, 29, 100, 162, 79, 124, 245, 215, 17, 148, 156, 154, 130, 126, 222, 183, 132, 230, 34, 91, 76,
+    128, 133, 203, 148, 201, 123, 17, 1, 215, 166, 134, 29, 111, 153, 117, 101, 120, 38, 111, 141, 73, 8, 3, 103, 243,
+    189, 168, 253, 86, 76, 125, 189, 147, 221, 208, 16, 47, 84, 26, 69, 106, 72, 156, 65, 156, 36, 120, 163, 115, 192,
+    2, 122, 119, 127, 23, 10, 14, 146, 144, 181, 155, 141, 250, 71, 32, 43, 13, 181, 231, 254, 109, 68, 92, 133, 206,
+    173, 178, 221, 50, 102, 226, 22, 239, 121, 237, 161, 178, 43, 175, 172, 236, 224, 140, 47, 48, 57, 107, 68, 232, 17,
+    79, 218, 54, 221, 216, 84, 60, 69, 177, 231, 72, 26, 15, 139, 36, 148, 223, 252, 154, 111, 172, 89, 207, 216, 99,
+    194, 27, 87, 145, 109, 222, 53, 135, 251, 77, 83, 194, 107, 32, 27, 206, 93, 213, 97, 142, 48, 133, 186, 225, 176,
+    191, 18, 205, 84, 36, 7, 21, 71, 147, 235, 53, 175, 126, 91, 251, 27, 148, 110, 21, 248, 25, 111, 224, 242, 217, 59,
+    243, 228, 96, 72, 46, 75, 134, 218, 55, 108, 113, 253, 35, 23, 178, 9, 100, 27, 9, 3, 21, 200, 189, 143, 108, 17, 4,
+    207, 182, 217, 170, 93, 3, 232, 155, 68, 221, 138, 205, 230, 237, 156, 1, 195, 219, 149, 76, 119, 105, 129, 12, 17,
+    115, 167, 103, 93, 97, 69, 196, 9, 219, 29, 111, 40, 177, 7, 60, 153, 199, 64, 69, 23, 53, 230, 190, 184, 0, 209,
+    123, 201, 177, 233, 99, 39, 142, 217, 174, 22, 113, 17, 171, 153, 107, 164, 27, 81, 221, 89, 110, 63, 156, 191, 179,
+    192, 139, 152, 81, 139, 15, 32, 225, 254, 46, 68, 221, 73, 36, 12, 59, 213, 152, 39, 162, 60, 206, 47, 82, 18, 150,
+    246, 184, 10, 25, 116, 205, 9, 202, 223, 220, 11, 211, 121, 177, 116, 240, 82, 243, 193, 215, 151, 102, 83, 27, 222,
+    254, 180, 199, 84, 86, 195, 238, 37, 26, 184, 156, 187, 155, 193, 38, 223, 166, 118, 137, 169, 202, 48, 230, 247,
+    186, 179, 33, 165, 254, 246, 36, 223, 46, 197, 92, 223, 33, 244, 111, 134, 231, 46, 59, 221, 102, 239, 225, 155, 96,
+    36, 127, 112, 29, 120, 247, 228, 35, 89, 199, 168, 161, 164, 204, 201, 144, 197, 219, 181, 146, 128, 115, 132, 186,
+    220, 9, 108, 92, 156, 182, 141, 252, 102, 217, 9, 234, 64, 12, 227, 254, 87, 126, 214, 174, 231, 136, 201, 146, 127,
+    213, 101, 193, 71, 169, 127, 106, 78, 1, 25, 46, 168, 247, 242, 228, 89, 135, 75, 83, 136, 238, 86, 123, 114, 235,
+    120, 69, 163, 151, 120, 93, 75, 89, 163, 246, 31, 198, 46, 205, 10, 103, 14, 242, 22, 214, 46, 29, 227, 57, 89, 8,
+    88, 73, 208, 218, 241, 80, 158, 53, 195, 74, 21, 168, 249, 214, 161, 182, 131, 106, 220, 54, 21, 187, 233, 54, 16,
+    132, 19, 4, 113, 31, 146, 184, 169, 214, 118, 31, 219, 49, 161, 156, 41, 167, 161, 57, 243, 17, 48, 149, 84, 40, 18,
+    239, 28, 151, 199, 54, 45, 183, 240, 36, 82, 190, 244, 222, 224, 188, 154, 118, 25, 17, 198, 163, 178, 33, 74, 58,
+    26, 237, 73, 153, 190, 107, 31, 27, 123, 62, 119, 155, 180, 77, 155, 255, 167, 231, 60, 63, 13, 177, 44, 227, 27,
+    129, 229, 193, 238, 52, 79, 238, 151, 196, 139, 217, 81, 167, 208, 45, 201, 181, 1, 2, 147, 54, 76, 44, 84, 81, 188,
+    145, 126, 88, 30, 157, 245, 96, 13, 225, 214, 56, 26, 56, 135, 231, 142, 149, 20, 68, 151, 83, 217, 202, 244, 115,
+    162, 156, 161, 147, 210, 254, 159, 48, 42, 79, 194, 14, 114, 187, 27, 168, 225, 236, 240, 60, 79, 233, 58, 58, 115,
+    159, 178, 139, 161, 59, 234, 101, 243, 172, 67, 27, 64, 24, 59, 142, 226, 92, 84, 217, 48, 167, 15, 179, 104, 223,
+    60, 173, 26, 25, 154, 228, 175, 245, 181, 254, 83, 191, 124, 214, 183, 113, 220, 32, 76, 105, 59, 201, 183, 100,
+    251, 252, 74, 231, 161, 180, 135, 245, 148, 63, 228, 210, 42, 6, 76, 44, 228, 68, 24, 252, 251, 231, 70, 112, 170,
+    226, 208, 84, 239, 69, 109, 153, 159, 87, 181, 81, 158, 185, 11, 64, 216, 8, 53, 250, 70, 21, 13, 95, 126, 149, 31,
+    49, 80, 13, 156, 236, 39, 41, 135, 226, 87, 76, 227, 243, 148, 90, 150, 65, 217, 185, 12, 147, 181, 181, 172, 129,
+    94, 14, 1, 26, 4, 231, 117, 121, 136, 34, 177, 242, 89, 238, 26, 216, 244, 112, 88, 202, 25, 43, 244, 189, 161, 239,
+    143, 189, 162, 146, 224, 240, 208, 127, 132, 127, 23, 120, 47, 243, 73, 21, 8, 52, 157, 174, 81, 143, 200, 88, 99,
+    198, 53, 71, 242, 201, 99, 182, 98, 215, 38, 163, 207, 149, 93, 62, 41, 8, 190, 116, 123, 26, 100, 187, 203, 112,
+    140, 125, 100, 89, 134, 241, 184, 111, 68, 93, 24, 4, 116, 66, 199, 95, 20, 14, 0, 84, 191, 222, 117, 202, 37, 193,
+    18, 65, 85, 238, 23, 104, 75, 188, 50, 167, 149, 129, 187, 124, 17, 137, 170, 108, 155, 133, 18, 7, 97, 75, 89, 148,
+    223, 124, 177, 174, 165, 138, 216, 64, 254, 214, 150, 91, 51, 120, 156, 111, 116, 211, 85, 140, 55, 228, 167, 111,
+    255, 0, 130, 131, 176, 241, 230, 192, 112, 80, 51, 99, 224, 126, 71, 132, 119, 115, 162, 89, 46, 214, 220, 132, 254,
+    224, 218, 145, 250, 3, 89, 0, 44, 25, 57, 139, 56, 249, 104, 122, 175, 0, 161, 206, 28, 79, 187, 102, 127, 57, 161,
+    113, 47, 149, 165, 169, 255, 167, 58, 93, 43, 114, 248, 149, 194, 22, 146, 188, 71, 74, 139, 245, 87, 244, 166, 128,
+    206, 47, 65, 93, 45, 51, 219, 9, 31, 69, 57, 203, 140, 229, 139, 182, 219, 93, 10, 229, 134, 214, 125, 61, 31, 83,
+    185, 185, 41, 213, 113, 49, 64, 211, 198, 12, 120, 58, 1, 217, 244, 143, 188, 250, 16, 192, 208, 180, 92, 103, 201,
+    131, 103, 196, 211, 143, 140, 237, 68, 204, 250, 19, 91, 113, 179, 201, 105, 112, 3, 249, 211, 69, 123, 140, 132,
+    45, 246, 244, 164, 142, 217, 57, 49, 33, 54, 6, 47, 250, 165, 97, 211, 53, 159, 5, 54, 12, 236, 144, 177, 25, 10,
+    188, 234, 24, 33, 72, 68, 101, 41, 152, 59, 10, 250, 128, 217, 132, 125, 184, 89, 7, 184, 169, 233, 58, 48, 180,
+    243, 203, 247, 38, 204, 5, 112, 15, 114, 6, 40, 199, 1, 224, 243, 196, 177, 244, 38, 166, 207, 234, 84, 46, 205,
+    252, 126, 13, 171, 191, 241, 126, 37, 4, 133, 250, 23, 108, 181, 220, 117, 234, 40, 51, 54, 181, 42, 160, 77, 55,
+    227, 164, 3, 79, 116, 174, 44, 116, 25, 69, 29, 160, 27, 4, 82, 58, 198, 200, 217, 220, 155, 46, 201, 183, 133, 178,
+    199, 163, 21, 222, 222, 210, 163, 250, 138, 71, 143, 34, 31, 29, 254, 183, 44, 52, 97, 75, 41, 160, 42, 110, 202, 6,
+    63, 198, 58, 192, 110, 107, 64, 103, 228, 86, 55, 123, 1, 171, 135, 229, 95, 39, 122, 76, 251, 70, 121, 65, 141, 37,
+    237, 67, 50, 14, 239, 220, 155, 154, 216, 222, 149, 222, 60, 209, 30, 48, 44, 171, 222, 130, 56, 70, 254, 212, 233,
+    202, 198, 247, 90, 128, 183, 121, 50, 130, 53, 94, 148, 192, 160, 36, 135, 67, 14, 188, 141, 223, 114, 99, 81, 59,
+    70, 138, 18, 54, 112, 80, 130, 166, 202, 16, 207, 13, 54, 205, 193, 204, 171, 101, 168, 120, 200, 48, 147, 227, 28,
+    254, 185, 85, 79, 37, 224, 228, 165, 19, 93, 49, 131, 51, 176, 137, 224, 254, 7, 68, 204, 71, 84, 215, 31, 11, 102,
+    65, 20, 125, 31, 43, 69, 66, 182, 239, 223, 171, 45, 192, 98, 210, 170, 154, 190, 158, 79, 102, 31, 9, 20, 139, 88,
+    45, 140, 69, 204, 234, 128, 218, 141, 212, 178, 18, 253, 176, 159, 212, 101, 94, 117, 158, 81, 72, 47, 13, 163, 98,
+    52, 125, 221, 186, 178, 38, 253, 254, 114, 61, 47, 1, 175, 154, 195, 63, 43, 69, 22, 219, 95, 186, 217, 68, 121,
+    191, 157, 59, 40, 92, 70, 72, 44, 25, 38, 149, 160, 64, 70, 214, 40, 13, 18, 156, 15, 210, 33, 183, 146, 32, 135,
+    155, 80, 107, 89, 62, 88, 191, 141, 197, 160, 97, 222, 234, 161, 56, 205, 179, 246, 198, 42, 165, 63, 72, 2, 4, 55,
+    151, 85, 201, 194, 89, 68, 179, 187, 174, 190, 255, 82, 220, 249, 59, 92, 237, 50, 83, 39, 252, 239, 142, 229, 105,
+    136, 57, 150, 219, 181, 178, 212, 9, 144, 124, 51, 97, 230, 137, 62, 84, 112, 126, 251, 233, 168, 90, 131, 135, 76,
+    56, 164, 125, 73, 15, 69, 32, 200, 120, 92, 92, 220, 241, 125, 19, 180, 152, 226, 159, 72, 120, 182, 254, 186, 245,
+    197, 12, 36, 76, 54, 242, 187, 183, 169, 254, 126, 141, 232, 178, 166, 104, 240, 195, 29, 43, 133, 12, 57, 172, 133,
+    177, 166, 170, 79, 90, 50, 195, 151, 194, 238, 39, 79, 62, 50, 8, 97, 41, 52, 117, 75, 126, 105, 140, 248, 2, 246,
+    132, 23, 159, 1, 17, 251, 250, 17, 23, 189, 94, 108, 75, 168, 109, 201, 233, 169, 220, 106, 51, 23, 100, 209, 90,
+    163, 129, 218, 93, 179, 12, 194, 116, 33, 76, 2, 202, 203, 254, 26, 32, 121, 27, 221, 143, 10, 116, 24, 193, 3, 86,
+    131, 85, 3, 14, 236, 137, 131, 7, 65, 195, 165, 28, 180, 125, 173, 44, 245, 114, 223, 252, 180, 135, 64, 50, 205,
+    65, 99, 22, 91, 206, 36, 8, 33, 4, 184, 230, 225, 132, 111, 166, 146, 56, 28, 125, 183, 131, 197, 138, 41, 52, 69,
+    209, 88, 126, 17, 184, 51, 77, 143, 43, 252, 227, 240, 209, 162, 94, 250, 70, 144, 67, 151, 145, 29, 195, 232, 144,
+    80, 170, 128, 176, 9, 191, 217, 181, 47, 112, 247, 179, 61, 83, 133, 40, 207, 87, 140, 71, 185, 255, 93, 228, 165,
+    98, 137, 66, 219, 218, 162, 254, 122, 56, 33, 9, 172, 34, 109, 65, 12, 131, 250, 209, 193, 29, 52, 33, 156, 92, 164,
+    79, 109, 29, 93, 49, 72, 94, 138, 13, 20, 110, 106, 165, 84, 252, 209, 27, 159, 237, 45, 137, 247, 87, 1, 194, 52,
+    253, 158, 139, 206, 151, 65, 247, 142, 210, 26, 170, 67, 232, 10, 217, 174, 202, 87, 17, 149, 23, 221, 233, 77, 224,
+    78, 19, 200, 68, 52, 197, 234, 41, 215, 108, 191, 123, 87, 172, 147, 254, 106, 144, 40, 254, 113, 135, 167, 147,
+    253, 37, 71, 124, 107, 223, 155, 178, 107, 232, 138, 22, 133, 64, 220, 214, 1, 150, 210, 189, 93, 12, 15, 25, 182,
+    142, 12, 163, 206, 219, 157, 31, 16, 164, 77, 216, 104, 130, 199, 235, 81, 108, 15, 117, 58, 38, 100, 189, 191, 221,
+    233, 38, 99, 124, 11, 2, 66, 5, 164, 43, 12, 196, 126, 70, 117, 96, 134, 67, 146, 20, 58, 198, 147, 135, 33, 230,
+    22, 136, 68, 245, 233, 244, 55, 71, 131, 2, 220, 102, 208, 9, 112, 54, 25, 160, 135, 132, 94, 24, 235, 104, 65, 125,
+    79, 177, 140, 146, 97, 149, 120, 209, 174, 55, 53, 95, 82, 57, 182, 124, 27, 33, 10, 27, 59, 240, 59, 189, 248, 140,
+    23, 227, 44, 20, 245, 179, 124, 224, 56, 84, 197, 22, 139, 62, 90, 250, 73, 35, 208, 24, 251, 21, 161, 6, 218, 138,
+    7, 112, 190, 2, 46, 82, 226, 205, 78, 220, 209, 234, 111, 83, 0, 174, 10, 27, 174, 46, 39, 42, 207, 120, 129, 222,
+    142, 15, 220, 205, 124, 73, 57, 16, 139, 157, 109, 144, 113, 152, 74, 214, 190, 81, 72, 220, 155, 105, 205, 114, 50,
+    190, 241, 242, 92, 142, 207, 198, 148, 171, 41, 48, 157, 38, 11, 229, 114, 42, 4, 60, 53, 129, 107, 70, 143, 33, 7,
+    19, 246, 102, 251, 222, 168, 136, 22, 219, 98, 72, 90, 126, 75, 41, 17, 48, 67, 121, 101, 103, 185, 123, 121, 22,
+    76, 85, 188, 204, 42, 150, 65, 102, 221, 241, 138, 227, 50, 18, 187, 153, 56, 2, 42, 74, 187, 126, 2, 240, 68, 188,
+    177, 112, 35, 136, 31, 180, 67, 45, 227, 148, 162, 146, 138, 116, 98, 164, 184, 58, 215, 163, 159, 171, 208, 48,
+    122, 114, 21, 43, 241, 131, 58, 245, 200, 118, 232, 138, 55, 184, 217, 35, 237, 194, 88, 191, 212, 255, 6, 46, 187,
+    87, 76, 73, 166, 83, 230, 40, 63, 52, 210, 86, 0, 89, 148, 53, 55, 66, 180, 181, 2, 171, 123, 101, 105, 70, 234, 16,
+    20, 213, 100, 89, 79, 120, 200, 171, 13, 142, 210, 131, 24, 106, 23, 110, 214, 249, 91, 99, 21, 17, 203, 0, 33, 129,
+    57, 248, 122, 74, 134, 38, 252, 128, 241, 123, 58, 173, 119, 76, 222, 41, 69, 232, 218, 60, 254, 166, 167, 182, 218,
+    61, 212, 68, 64, 210, 178, 88, 174, 159, 21, 111, 164, 62, 243, 33, 194, 64, 97, 226, 27, 116, 251, 177, 132, 221,
+    78, 51, 104, 193, 241, 238, 99, 172, 7, 66, 21, 166, 158, 99, 241, 20, 35, 91, 124, 69, 205, 171, 149, 123, 189, 67,
+    196, 58, 185, 167, 93, 253, 171, 231, 135, 82, 250, 116, 200, 140, 239, 224, 219, 134, 138, 19, 203, 94, 227, 122,
+    66, 130, 157, 20, 187, 121, 119, 131, 4, 136, 66, 223, 111, 59, 10, 230, 26, 147, 144, 193, 59, 119, 83, 230, 188,
+    155, 163, 82, 210, 79, 93, 157, 226, 171, 157, 196, 239, 201, 141, 156, 123, 238, 199, 124, 82, 171, 19, 53, 25,
+    201, 109, 56, 227, 130, 23, 32, 166, 217, 239, 68, 73, 29, 69, 56, 81, 169, 129, 109, 241, 12, 213, 136, 178, 172,
+    253, 51, 240, 73, 106, 121, 12, 106, 210, 246, 30, 54, 29, 55, 100, 214, 101, 94, 129, 177, 122, 108, 125, 244, 110,
+    117, 224, 232, 251, 82, 152, 246, 153, 52, 72, 28, 168, 183, 13, 231, 57, 152, 162, 10, 93, 151, 173, 37, 177, 146,
+    241, 211, 151, 113, 128, 168, 151, 21, 143, 199, 203, 46, 88, 50, 94, 53, 71, 180, 47, 35, 62, 159, 34, 228, 197,
+    112, 139, 221, 213, 50, 69, 193, 115, 242, 181, 199, 145, 44, 52, 216, 179, 175, 175, 137, 226, 152, 167, 59, 99,
+    167, 187, 244, 41, 176, 194, 189, 171, 24, 125, 100, 161, 205, 51, 31, 17, 135, 239, 6, 66, 236, 40, 44, 209, 171,
+    220, 80, 179, 5, 162, 226, 252, 233, 55, 116, 244, 165, 135, 140, 231, 253, 162, 85, 73, 34, 158, 233, 48, 55, 238,
+    250, 149, 218, 225, 198, 203, 75, 63, 207, 176, 14, 138, 125, 248, 111, 221, 6, 102, 226, 103, 212, 243, 74, 11, 50,
+    165, 184, 82, 148, 215, 228, 249, 27, 5, 204, 72, 9, 106, 8, 67, 211, 241, 219, 253, 228, 192, 150, 3, 37, 1, 205,
+    81, 66, 232, 102, 7, 72, 66, 88, 100, 175, 175, 188, 135, 229, 3, 210, 100, 155, 138, 191, 19, 245, 220, 184, 228,
+    183, 214, 190, 45, 230, 212, 45, 120, 78, 35, 9, 56, 179, 246, 76, 51, 133, 168, 74, 95, 107, 102, 31, 16, 33, 71,
+    223, 249, 26, 137, 118, 208, 44, 45, 210, 198, 246, 39, 219, 153, 209, 102, 169, 166, 201, 217, 221, 24, 33, 148,
+    165, 22, 0, 191, 48, 141, 78, 42, 209, 39, 106, 27, 146, 255, 119, 189, 69, 148, 3, 93, 89, 27, 184, 160, 115, 84,
+    19, 110, 18, 43, 236, 64, 1, 178, 247, 209, 26, 183, 90, 83, 227, 146, 22, 231, 153, 233, 61, 81, 75, 251, 44, 190,
+    147, 62, 4, 216, 48, 115, 231, 47, 72, 21, 176, 111, 228, 220, 236, 217, 190, 165, 217, 137, 168, 157, 58, 240, 86,
+    211, 118, 207, 58, 114, 92, 70, 191, 132, 223, 224, 50, 127, 199, 175, 95, 75, 80, 224, 127, 99, 89, 90, 244, 135,
+    185, 105, 116, 36, 205, 59, 22, 187, 200, 198, 134, 128, 27, 9, 160, 219, 234, 134, 26, 13, 174, 162, 90, 189, 30,
+    216, 35, 193, 97, 128, 56, 231, 177, 67, 86, 128, 103, 109, 189, 241, 143, 17, 255, 244, 41, 51, 24, 158, 36, 64,
+    106, 237, 190, 42, 76, 98, 139, 19, 165, 241, 75, 46, 49, 102, 178, 1, 248, 206, 209, 166, 213, 135, 0, 27, 63, 253,
+    44, 252, 22, 245, 102, 160, 143, 71, 117, 55, 50, 141, 206, 26, 173, 49, 215, 70, 251, 97, 54, 172, 215, 158, 107,
+    46, 69, 227, 186, 203, 187, 91, 243, 154, 153, 251, 74, 77, 132, 81, 21, 251, 40, 35, 158, 147, 34, 182, 20, 245,
+    243, 109, 64, 176, 144, 25, 204, 39, 218, 207, 107, 156, 38, 220, 189, 212, 238, 7, 146, 89, 76, 153, 219, 27, 148,
+    200, 22, 165, 3, 93, 21, 192, 185, 208, 22, 144, 43, 36, 100, 234, 85, 116, 158, 223, 111, 174, 172, 6, 50, 93, 97,
+    83, 41, 111, 152, 16, 247, 216, 134, 46, 26, 106, 182, 154, 3, 17, 171, 223, 193, 233, 121, 43, 105, 26, 159, 162,
+    164, 167, 148, 177, 5, 218, 86, 152, 230, 138, 45, 118, 242, 20, 9, 219, 250, 228, 47, 142, 170, 158, 142, 172, 5,
+    95, 31, 247, 246, 185, 74, 160, 240, 142, 133, 176, 98, 155, 237, 157, 27, 87, 35, 135, 28, 255, 102, 178, 94, 49,
+    81, 181, 136, 153, 128, 177, 62, 212, 15, 231, 29, 79, 202, 163, 5, 233, 205, 211, 181, 157, 165, 239, 229, 74, 24,
+    25, 138, 170, 44, 194, 89, 96, 132, 141, 233, 158, 211, 215, 20, 117, 24, 235, 76, 250, 120, 131, 186, 244, 87, 73,
+    18, 209, 26, 175, 163, 125, 111, 218, 227, 186, 140, 24, 54, 8, 172, 250, 199, 188, 163, 201, 224, 116, 95, 37, 218,
+    207, 216, 80, 145, 87, 161, 53, 32, 160, 0, 157, 172, 5, 161, 144, 248, 254, 108, 225, 138, 193, 4, 210, 123, 125,
+    68, 93, 240, 209, 201, 68, 60, 226, 132, 158, 203, 14, 236, 46, 33, 228, 254, 172, 146, 143, 122, 234, 191, 144, 43,
+    167, 116, 106, 168, 106, 200, 73, 208, 121, 150, 161, 176, 159, 31, 62, 138, 207, 125, 168, 165, 146, 249, 198, 167,
+    27, 159, 200, 25, 176, 20, 54, 23, 212, 178, 50, 22, 197, 242, 167, 231, 237, 200, 82, 93, 69, 178, 130, 140, 144,
+    161, 33, 26, 17, 32, 70, 211, 238, 198, 3, 125, 44, 20, 95, 189, 97, 63, 29, 77, 98, 22, 111, 226, 87, 100, 229,
+    179, 63, 83, 231, 156, 68, 55, 153, 209, 1, 21, 122, 234, 105, 95, 103, 10, 109, 221, 45, 53, 199, 3, 38, 144, 74,
+    179, 100, 193, 170, 233, 40, 111, 114, 253, 236, 236, 94, 20, 87, 109, 246, 5, 230, 30, 163, 240, 181, 45, 13, 11,
+    151, 244, 22, 140, 77, 242, 211, 249, 200, 84, 57, 205, 29, 26, 131, 48, 39, 220, 87, 245, 144, 85, 7, 33, 20, 21,
+    144, 53, 58, 237, 19, 146, 5, 233, 52, 78, 64, 217, 126, 227, 153, 244, 32, 216, 237, 210, 95, 220, 197, 74, 32, 72,
+    23, 7, 215, 96, 61, 70, 21, 119, 243, 6, 70, 221, 144, 25, 19, 191, 244, 3, 1, 178, 148, 44, 42, 80, 119, 43, 10,
+    194, 11, 17, 19, 66, 78, 42, 181, 159, 221, 51, 88, 176, 146, 184, 165, 56, 120, 231, 83, 93, 250, 153, 150, 135,
+    203, 234, 100, 192, 232, 231, 31, 73, 26, 29, 52, 35, 25, 143, 165, 244, 176, 137, 84, 28, 20, 98, 127, 47, 29, 6,
+    45, 38, 219, 174, 227, 169, 185, 41, 162, 165, 16, 160, 196, 53, 10, 87, 170, 50, 214, 207, 158, 62, 174, 251, 154,
+    170, 187, 202, 225, 127, 176, 63, 2, 115, 6, 234, 86, 71, 88, 61, 252, 147, 149, 54, 234, 132, 214, 80, 227, 22,
+    179, 47, 39, 136, 93, 192, 63, 255, 22, 190, 218, 193, 91, 51, 44, 228, 152, 0, 165, 177, 231, 113, 131, 189, 165,
+    104, 110, 236, 2, 171, 19, 167, 45, 253, 235, 112, 224, 109, 61, 139, 5, 96, 244, 235, 83, 134, 18, 127, 79, 208,
+    204, 157, 57, 102, 237, 170, 109, 183, 124, 14, 85, 221, 243, 131, 189, 59, 143, 134, 163, 33, 178, 140, 15, 62,
+    241, 111, 233, 221, 167, 172, 29, 250, 189, 34, 233, 109, 225, 58, 120, 253, 151, 191, 42, 169, 113, 130, 54, 13,
+    213, 21, 5, 124, 164, 124, 206, 87, 230, 40, 238, 124, 176, 62, 100, 36, 78, 212, 142, 255, 29, 78, 161, 113, 79,
+    70, 75, 181, 47, 187, 40, 135, 155, 127, 119, 21, 36, 251, 254, 31, 140, 234, 5, 174, 15, 97, 83, 69, 52, 155, 43,
+    93, 132, 54, 188, 164, 47, 91, 163, 38, 221, 130, 97, 17, 15, 213, 58, 126, 12, 153, 84, 98, 197, 163, 49, 82, 27,
+    241, 79, 196, 7, 187, 8, 192, 33, 79, 158, 71, 37, 92, 244, 248, 187, 7, 122, 178, 82, 108, 106, 4, 28, 201, 241,
+    39, 178, 111, 92, 220, 79, 16, 79, 149, 216, 26, 204, 61, 168, 84, 152, 110, 11, 94, 133, 12, 86, 142, 209, 246, 19,
+    183, 45, 97, 6, 223, 148, 24, 186, 91, 54, 52, 106, 0, 228, 245, 13, 70, 126, 178, 199, 164, 230, 169, 130, 7, 218,
+    91, 24, 193, 71, 60, 145, 24, 114, 38, 189, 88, 172, 37, 65, 111, 156, 120, 141, 132, 27, 171, 247, 222, 175, 59,
+    198, 230, 22, 124, 73, 26, 199, 229, 131, 144, 92, 253, 19, 251, 77, 7, 100, 47, 159, 241, 165, 230, 29, 58, 111,
+    208, 120, 231, 36, 147, 19, 237, 92, 89, 157, 123, 82, 150, 149, 128, 64, 57, 179, 48, 236, 205, 204, 247, 35, 80,
+    190, 123, 165, 215, 64, 180, 250, 244, 27, 73, 36, 9, 213, 188, 246, 240, 135, 235, 106, 250, 50, 236, 46, 109, 24,
+    253, 142, 36, 210, 180, 206, 167, 117, 45, 0, 163, 179, 198, 136, 205, 79, 208, 61, 20, 55, 109, 4, 82, 207, 81, 55,
+    47, 55, 19, 6, 251, 139, 78, 88, 216, 95, 185, 183, 12, 22, 112, 124, 148, 71, 147, 15, 83, 175, 194, 39, 135, 221,
+    99, 7, 87, 132, 169, 21, 213, 156, 187, 26, 255, 144, 167, 6, 88, 107, 243, 199, 209, 1, 8, 171, 153, 133, 189, 134,
+    222, 203, 10, 94, 229, 84, 13, 68, 88, 47, 39, 97, 127, 52, 204, 222, 95, 49, 75, 224, 190, 174, 189, 174, 44, 234,
+    255, 150, 135, 191, 119, 112, 87, 22, 224, 166, 40, 178, 56, 96, 218, 184, 95, 99, 145, 199, 47, 104, 97, 124, 233,
+    145, 241, 71, 241, 137, 246, 110, 79, 226, 194, 222, 225, 187, 108, 24, 163, 50, 236, 204, 89, 207, 181, 220, 151,
+    211, 107, 123, 94, 21, 83, 152, 95, 89, 252, 203, 13, 167, 122, 229, 188, 165, 218, 21, 221, 13, 220, 6, 180, 239,
+    37, 127, 230, 63, 32, 202, 226, 53, 224, 73, 25, 150, 12, 59, 144, 178, 107, 100, 7, 40, 198, 113, 194, 226, 193,
+    16, 162, 74, 18, 170, 141, 163, 142, 200, 173, 32, 202, 231, 246, 22, 72, 93, 47, 36, 22, 128, 27, 105, 205, 229,
+    202, 73, 120, 223, 176, 147, 50, 178, 158, 14, 106, 168, 85, 64, 123, 19, 42, 241, 147, 110, 146, 171, 0, 246, 99,
+    152, 54, 11, 106, 35, 191, 10, 250, 240, 248, 251, 173, 253, 67, 155, 132, 68, 145, 240, 130, 59, 139, 179, 42, 96,
+    55, 147, 54, 160, 80, 30, 66, 1, 218, 116, 157, 144, 210, 123, 100, 194, 122, 247, 52, 172, 233, 103, 175, 250, 92,
+    251, 207, 221, 160, 93, 186, 7, 84, 124, 133, 180, 47, 50, 203, 18, 45, 197, 197, 80, 154, 109, 250, 241, 187, 147,
+    168, 109, 221, 237, 81, 174, 239, 67, 110, 101, 115, 123, 250, 149, 122, 254, 220, 150, 162, 201, 8, 239, 77, 251,
+    249, 60, 181, 128, 57, 103, 190, 56, 155, 1, 222, 0, 25, 20, 130, 65, 156, 5, 222, 143, 17, 179, 23, 147, 100, 137,
+    60, 114, 209, 174, 25, 116, 77, 127, 193, 81, 34, 199, 248, 199, 117, 32, 228, 39, 150, 233, 236, 143, 7, 58, 117,
+    102, 163, 222, 206, 175, 214, 35, 251, 0, 174, 174, 28, 14, 144, 215, 147, 199, 153, 32, 243, 235, 246, 60, 45, 187,
+    215, 155, 51, 150, 187, 161, 138, 127, 217, 82, 2, 11, 241, 169, 215, 210, 43, 25, 222, 101, 55, 30, 15, 0, 253, 12,
+    118, 95, 237, 75, 47, 237, 254, 98, 247, 207, 219, 247, 102, 21, 193, 239, 106, 0, 227, 146, 144, 28, 219, 228, 40,
+    120, 10, 248, 63, 236, 186, 238, 127, 37, 96, 23, 23, 188, 159, 160, 113, 42, 79, 202, 92, 237, 67, 96, 229, 86,
+    156, 28, 234, 13, 157, 182, 226, 184, 203, 66, 2, 56, 193, 57, 151, 11, 20, 215, 206, 109, 142, 180, 140, 5, 1, 244,
+    99, 27, 204, 35, 125, 234, 38, 7, 26, 206, 57, 151, 236, 18, 9, 88, 21, 222, 117, 162, 191, 53, 251, 250, 220, 218,
+    250, 76, 24, 65, 187, 103, 89, 138, 248, 164, 18, 182, 127, 55, 252, 143, 132, 10, 3, 172, 53, 79, 249, 152, 75, 30,
+    184, 164, 100, 247, 51, 202, 132, 65, 26, 68, 57, 235, 150, 194, 49, 50, 240, 31, 79, 198, 203, 76, 114, 193, 30,
+    10, 179, 216, 69, 103, 38, 132, 33, 42, 14, 227, 226, 22, 135, 22, 191, 62, 181, 132, 80, 38, 71, 219, 78, 199, 210,
+    241, 12, 55, 236, 20, 52, 0, 222, 137, 103, 73, 135, 67, 37, 158, 252, 186, 216, 237, 67, 65, 96, 68, 77, 162, 144,
+    159, 168, 231, 73, 83, 146, 247, 108, 229, 216, 31, 216, 95, 86, 232, 55, 180, 129, 179, 22, 203, 38, 196, 86, 155,
+    105, 108, 50, 108, 206, 23, 217, 200, 203, 186, 6, 40, 142, 53, 171, 147, 77, 173, 41, 247, 88, 253, 48, 22, 181,
+    113, 18, 203, 36, 7, 244, 72, 219, 96, 253, 174, 203, 218, 229, 10, 158, 149, 223, 87, 202, 228, 247, 131, 78, 99,
+    151, 169, 230, 53, 217, 147, 213, 7, 143, 68, 61, 85, 144, 101, 244, 150, 9, 16, 44, 188, 47, 84, 163, 248, 124,
+    131, 210, 236, 244, 20, 21, 174, 157, 145, 146, 255, 146, 76, 139, 19, 252, 66, 77, 90, 132, 227, 53, 77, 19, 1, 4,
+    75, 80, 54, 236, 77, 44, 102, 234, 51, 90, 64, 249, 208, 197, 94, 178, 195, 101, 192, 236, 46, 135, 214, 72, 67,
+    129, 75, 165, 18, 97, 155, 184, 246, 239, 91, 14, 213, 10, 99, 95, 62, 247, 156, 152, 95, 216, 39, 5, 252, 105, 122,
+    147, 163, 238, 198, 189, 132, 183, 179, 29, 46, 190, 207, 254, 151, 244, 135, 22, 96, 187, 111, 52, 119, 23, 170,
+    214, 49, 32, 135, 166, 113, 111, 84, 152, 29, 7, 214, 203, 54, 26, 118, 125, 18, 169, 18, 161, 106, 84, 242, 156,
+    140, 132, 112, 101, 98, 243, 111, 52, 85, 72, 241, 66, 106, 10, 66, 63, 197, 54, 106, 188, 1, 64, 30, 152, 193, 36,
+    211, 162, 72, 176, 112, 25, 190, 55, 86, 150, 211, 230, 45, 142, 158, 41, 55, 225, 200, 73, 227, 123, 112, 159, 128,
+    253, 165, 60, 157, 50, 151, 221, 148, 239, 91, 72, 227, 44, 255, 168, 9, 106, 148, 113, 17, 53, 34, 97, 11, 100, 9,
+    189, 172, 85, 3, 159, 158, 116, 230, 134, 155, 195, 188, 15, 99, 31, 165, 21, 130, 39, 244, 201, 94, 4, 168, 189,
+    241, 185, 124, 147, 178, 181, 252, 56, 9, 87, 10, 135, 196, 221, 255, 216, 118, 110, 169, 170, 187, 122, 6, 117,
+    176, 99, 122, 141, 241, 129, 39, 93, 214, 65, 134, 81, 5, 49, 44, 230, 45, 240, 157, 236, 194, 126, 145, 21, 137,
+    114, 100, 198, 165, 25, 140, 29, 177, 28, 42, 205, 92, 132, 124, 249, 186, 74, 72, 52, 70, 98, 217, 217, 25, 117,
+    227, 200, 82, 104, 35, 216, 93, 220, 160, 56, 91, 20, 240, 33, 123, 127, 255, 147, 141, 91, 222, 13, 17, 77, 164,
+    220, 207, 27, 164, 115, 10, 160, 34, 127, 152, 85, 167, 114, 242, 217, 162, 65, 178, 59, 145, 86, 184, 122, 26, 93,
+    251, 217, 131, 5, 144, 103, 92, 247, 89, 18, 13, 251, 231, 239, 212, 205, 76, 184, 202, 248, 171, 84, 1, 162, 159,
+    149, 210, 238, 19, 114, 202, 193, 125, 43, 149, 26, 48, 126, 202, 88, 236, 108, 117, 225, 19, 50, 217, 115, 92, 101,
+    24, 95, 48, 94, 62, 160, 15, 30, 166, 99, 193, 190, 237, 64, 95, 93, 44, 97, 236, 40, 236, 190, 116, 58, 188, 33,
+    41, 99, 152, 220, 77, 57, 230, 214, 36, 166, 17, 57, 98, 221, 136, 88, 131, 235, 206, 241, 75, 15, 247, 89, 253,
+    189, 63, 45, 74, 125, 131, 22, 188, 233, 139, 249, 206, 245, 201, 159, 50, 125, 253, 209, 24, 37, 236, 52, 45, 203,
+    241, 63, 212, 36, 124, 228, 6, 58, 48, 203, 206, 183, 227, 181, 196, 200, 238, 181, 207, 172, 228, 249, 64, 11, 60,
+    122, 231, 128, 248, 107, 116, 102, 148, 87, 133, 118, 113, 51, 50, 157, 82, 31, 120, 158, 116, 214, 210, 228, 50,
+    40, 235, 32, 222, 179, 204, 158, 198, 134, 37, 166, 79, 208, 136, 24, 76, 187, 52, 130, 189, 76, 166, 213, 162, 82,
+    235, 79, 75, 151, 235, 27, 37, 2, 51, 197, 23, 42, 121, 7, 66, 149, 113, 148, 201, 165, 190, 57, 1, 116, 86, 24,
+    121, 34, 237, 149, 167, 23, 118, 106, 27, 12, 253, 213, 2, 2, 3, 100, 142, 92, 195, 64, 49, 198, 171, 68, 78, 234,
+    184, 146, 219, 100, 93, 122, 222, 181, 101, 87, 43, 91, 76, 147, 109, 83, 62, 191, 140, 61, 16, 106, 243, 29, 76,
+    114, 138, 28, 95, 142, 253, 30, 76, 157, 84, 250, 238, 211, 85, 4, 240, 189, 61, 39, 165, 58, 164, 188, 72, 3, 41,
+    243, 106, 182, 205, 150, 110, 33, 166, 159, 181, 58, 88, 41, 2, 30, 113, 248, 255, 26, 191, 25, 204, 164, 91, 27,
+    32, 168, 6, 124, 178, 77, 143, 148, 72, 127, 127, 142, 151, 190, 66, 72, 174, 143, 207, 3, 226, 211, 24, 222, 172,
+    82, 145, 180, 220, 249, 213, 47, 197, 32, 119, 80, 28, 158, 243, 67, 6, 134, 89, 47, 182, 123, 123, 143, 102, 113,
+    2, 23, 34, 157, 40, 82, 88, 212, 229, 5, 51, 23, 139, 101, 240, 68, 91, 147, 149, 144, 133, 19, 227, 247, 205, 123,
+    89, 55, 71, 250, 220, 4, 104, 145, 124, 13, 113, 47, 251, 40, 135, 103, 126, 173, 37, 225, 184, 155, 94, 66, 13, 90,
+    23, 213, 209, 55, 45, 217, 7, 186, 140, 204, 182, 197, 140, 139, 9, 114, 165, 249, 127, 140, 236, 166, 90, 105, 10,
+    203, 100, 18, 27, 43, 13, 66, 131, 115, 89, 53, 18, 110, 62, 179, 34, 205, 229, 157, 184, 117, 174, 75, 214, 206,
+    179, 255, 162, 194, 93, 229, 35, 227, 234, 26, 162, 101, 92, 25, 30, 140, 78, 246, 247, 125, 58, 166, 218, 114, 147,
+    54, 211, 29, 57, 50, 194, 214, 6, 78, 16, 34, 45, 55, 54, 93, 105, 147, 128, 90, 100, 41, 0, 217, 76, 62, 111, 123,
+    133, 184, 171, 70, 30, 211, 234, 48, 52, 127, 248, 89, 1, 153, 52, 102, 66, 170, 202, 59, 201, 27, 65, 206, 244, 57,
+    245, 228, 37, 53, 200, 244, 156, 237, 176, 179, 225, 218, 241, 152, 74, 121, 188, 228, 213, 156, 188, 121, 25, 49,
+    250, 44, 214, 223, 115, 26, 24, 156, 67, 37, 145, 203, 244, 205, 102, 225, 200, 124, 34, 214, 156, 184, 104, 44,
+    244, 249, 145, 171, 250, 84, 120, 28, 49, 211, 161, 156, 55, 223, 42, 156, 104, 160, 3, 164, 34, 223, 227, 193, 156,
+    127, 198, 164, 184, 123, 240, 106, 89, 216, 27, 224, 96, 122, 33, 22, 254, 171, 105, 90, 239, 9, 144, 232, 82, 213,
+    79, 193, 51, 240, 16, 195, 156, 254, 221, 74, 53, 118, 183, 252, 226, 159, 12, 107, 37, 35, 212, 191, 84, 116, 191,
+    246, 74, 213, 171, 56, 166, 73, 69, 165, 33, 143, 47, 104, 193, 28, 43, 231, 61, 99, 129, 55, 77, 158, 78, 122, 52,
+    36, 168, 215, 26, 219, 56, 187, 255, 89, 53, 164, 50, 245, 146, 165, 83, 210, 162, 68, 199, 47, 54, 43, 237, 85, 35,
+    46, 71, 31, 56, 85, 175, 175, 53, 188, 188, 55, 35, 69, 223, 37, 234, 42, 29, 20, 225, 53, 116, 133, 252, 184, 39,
+    161, 130, 179, 22, 61, 204, 100, 78, 88, 214, 240, 172, 34, 142, 99, 234, 28, 200, 204, 55, 213, 3, 60, 98, 172,
+    239, 251, 255, 61, 138, 216, 224, 156, 117, 248, 44, 118, 50, 142, 66, 157, 72, 236, 140, 167, 67, 98, 215, 109, 52,
+    244, 217, 6, 177, 219, 114, 253, 13, 160, 179, 98, 115, 68, 59, 172, 127, 155, 125, 127, 238, 99, 219, 126, 92, 132,
+    55, 137, 138, 236, 54, 158, 75, 144, 54, 161, 202, 100, 60, 255, 231, 20, 207, 194, 242, 192, 54, 225, 238, 171, 2,
+    67, 138, 8, 114, 200, 47, 67, 27, 140, 22, 244, 255, 27, 6, 247, 169, 92, 43, 94, 162, 197, 140, 130, 252, 159, 237,
+    245, 222, 162, 236, 80, 154, 72, 73, 28, 175, 41, 216, 97, 249, 138, 57, 214, 120, 39, 82, 243, 56, 247, 75, 54,
+    212, 30, 160, 75, 218, 182, 64, 35, 239, 255, 209
 };  // g_palJsonData[]
 
 } // Pal
@@ -0,0 +1,334 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/gpuMemory.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/codeHeap.h"
+#include "core/hw/gfxip/gfxDevice.h"
+#include "palDbgPrint.h"
+#include "palHashMapImpl.h"
+#include "palMemCopy.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// The code heap only ever contains a few thousand unique sections, so a modest bucket count is plenty.
+constexpr uint32 CodeHeapNumBuckets = 256;
+
+// Every entry starts on a GPU memory alignment boundary, matching the alignment used for private pipeline memory.
+constexpr gpusize CodeHeapMinAlignment = 256;
+
+// =====================================================================================================================
+void CodeHeapRefs::Add(
+    CodeHeapEntry* pEntry)
+{
+    PAL_ASSERT(IsFull() == false);
+    m_pEntries[m_numEntries++] = pEntry;
+}
+
+// =====================================================================================================================
+// Transfers ownership of every reference in this set to pDst, which must be empty.
+void CodeHeapRefs::MoveTo(
+    CodeHeapRefs* pDst)
+{
+    PAL_ASSERT(pDst->m_numEntries == 0);
+
+    for (uint32 i = 0; i < m_numEntries; ++i)
+    {
+        pDst->m_pEntries[i] = m_pEntries[i];
+    }
+
+    pDst->m_numEntries = m_numEntries;
+    m_numEntries       = 0;
+}
+
+// =====================================================================================================================
+// Releases every reference in this set back to the device's code heap.
+void CodeHeapRefs::Release(
+    Device* pDevice)
+{
+    if (m_numEntries > 0)
+    {
+        CodeHeap*const pCodeHeap = pDevice->GetGfxDevice()->GetCodeHeap();
+
+        for (uint32 i = 0; i < m_numEntries; ++i)
+        {
+            pCodeHeap->Release(m_pEntries[i]);
+        }
+
+        m_numEntries = 0;
+    }
+}
+
+// =====================================================================================================================
+CodeHeap::CodeHeap(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entries(CodeHeapNumBuckets, pDevice->GetPlatform()),
+    m_initialized(false)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+CodeHeap::~CodeHeap()
+{
+    // Every pipeline and shader library must have been destroyed before the device, so nothing may remain.
+    PAL_ASSERT(m_entries.GetNumEntries() == 0);
+
+    if (m_stats.numHits > 0)
+    {
+        PAL_DPINFO("Pipeline code heap reused %llu code sections, saving %llu bytes of GPU memory.",
+                   m_stats.numHits,
+                   m_stats.savedBytes);
+    }
+}
+
+// =====================================================================================================================
+// Initializes the code heap. This is safe to call again if the device is finalized more than once.
+Result CodeHeap::Init()
+{
+    Result result = Result::Success;
+
+    if (m_initialized == false)
+    {
+        result = m_lock.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_entries.Init();
+        }
+
+        m_initialized = (result == Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Looks for an uploaded entry holding the given code. If identical code has already been uploaded to the same heap it
+// is referenced and returned; otherwise the code is uploaded into newly sub-allocated GPU memory. Success is returned
+// with a null entry if the code can't be shared right now, in which case the caller keeps it in its private allocation.
+Result CodeHeap::Acquire(
+    const void*     pCode,
+    gpusize         size,
+    gpusize         alignment,
+    GpuHeap         heap,
+    CodeHeapEntry** ppEntry)
+{
+    PAL_ASSERT(m_initialized && (pCode != nullptr) && (size > 0) && (ppEntry != nullptr));
+
+    alignment = Max(alignment, CodeHeapMinAlignment);
+
+    MetroHash::Hash key = {};
+    MetroHash128    hasher;
+    hasher.Update(static_cast<const uint8*>(pCode), size);
+    hasher.Update(size);
+    hasher.Update(alignment);
+    hasher.Update(heap);
+    hasher.Finalize(key.bytes);
+
+    *ppEntry = nullptr;
+
+    CodeHeapEntry* pNewEntry = nullptr;
+
+    m_lock.Lock();
+
+    bool            existed  = false;
+    CodeHeapEntry** ppMapped = nullptr;
+    Result          result   = m_entries.FindAllocate(key, &existed, &ppMapped);
+
+    if ((result == Result::Success) && existed)
+    {
+        CodeHeapEntry*const pEntry = *ppMapped;
+
+        // A matching hash doesn't prove the code is identical, and code another thread is still uploading can't be
+        // used yet. In either case the caller keeps its own copy rather than waiting.
+        if (pEntry->uploaded                          &&
+            (pEntry->size == size)                    &&
+            (memcmp(pEntry->pCode, pCode, static_cast<size_t>(size)) == 0))
+        {
+            pEntry->refCount++;
+
+            m_stats.numHits++;
+            m_stats.savedBytes += size;
+
+            *ppEntry = pEntry;
+        }
+    }
+    else if (result == Result::Success)
+    {
+        pNewEntry = static_cast<CodeHeapEntry*>(PAL_MALLOC(sizeof(CodeHeapEntry) + static_cast<size_t>(size),
+                                                           m_pDevice->GetPlatform(),
+                                                           AllocInternal));
+
+        if (pNewEntry == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+            m_entries.Erase(key);
+        }
+        else
+        {
+            memset(pNewEntry, 0, sizeof(*pNewEntry));
+            pNewEntry->key      = key;
+            pNewEntry->size     = size;
+            pNewEntry->pCode    = VoidPtrInc(pNewEntry, sizeof(CodeHeapEntry));
+            pNewEntry->refCount = 1;
+
+            memcpy(VoidPtrInc(pNewEntry, sizeof(CodeHeapEntry)), pCode, static_cast<size_t>(size));
+
+            // Publish the entry before dropping the lock so that nobody else starts uploading the same code.
+            *ppMapped = pNewEntry;
+        }
+    }
+
+    m_lock.Unlock();
+
+    if (pNewEntry != nullptr)
+    {
+        // Allocating, mapping and copying can take a while, so it is done without holding the lock.
+        result = Upload(alignment, heap, pNewEntry);
+
+        MutexAuto lock(&m_lock);
+
+        if (result == Result::Success)
+        {
+            pNewEntry->uploaded = true;
+
+            m_stats.numEntries++;
+            m_stats.residentBytes += size;
+
+            *ppEntry = pNewEntry;
+        }
+        else
+        {
+            m_entries.Erase(key);
+            PAL_FREE(pNewEntry, m_pDevice->GetPlatform());
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates GPU memory for a new entry and copies its code into it.
+Result CodeHeap::Upload(
+    gpusize        alignment,
+    GpuHeap        heap,
+    CodeHeapEntry* pEntry)
+{
+    // The SQ may prefetch instructions past the end of a shader, so each entry is padded by the prefetch distance.
+    GpuMemoryCreateInfo createInfo = { };
+    createInfo.size      = Pow2Align(pEntry->size, ShaderICacheLineSize) +
+                           m_pDevice->ChipProperties().gfxip.shaderPrefetchBytes;
+    createInfo.alignment = alignment;
+    createInfo.vaRange   = VaRange::DescriptorTable;
+    createInfo.heaps[0]  = heap;
+    createInfo.heaps[1]  = GpuHeapGartUswc;
+    createInfo.heapCount = 2;
+    createInfo.priority  = GpuMemPriority::High;
+
+    GpuMemoryInternalCreateInfo internalInfo = { };
+    internalInfo.flags.alwaysResident = 1;
+    internalInfo.pPagingFence         = &pEntry->pagingFenceVal;
+
+    Result result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo,
+                                                        internalInfo,
+                                                        false,
+                                                        &pEntry->pGpuMemory,
+                                                        &pEntry->offset);
+
+    if (result == Result::Success)
+    {
+        pEntry->gpuVirtAddr = pEntry->pGpuMemory->Desc().gpuVirtAddr + pEntry->offset;
+
+        void* pMappedPtr = nullptr;
+        result = pEntry->pGpuMemory->Map(&pMappedPtr);
+
+        if (result == Result::Success)
+        {
+            // The CPU never reads the code back so stream it past the caches.
+            StreamingMemCopy(VoidPtrInc(pMappedPtr, static_cast<size_t>(pEntry->offset)),
+                             pEntry->pCode,
+                             static_cast<size_t>(pEntry->size));
+
+            result = pEntry->pGpuMemory->Unmap();
+        }
+
+        if (result != Result::Success)
+        {
+            m_pDevice->MemMgr()->FreeGpuMem(pEntry->pGpuMemory, pEntry->offset);
+            pEntry->pGpuMemory = nullptr;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Drops one reference to an entry, freeing its GPU memory once nothing references it anymore.
+void CodeHeap::Release(
+    CodeHeapEntry* pEntry)
+{
+    bool freeEntry = false;
+
+    {
+        MutexAuto lock(&m_lock);
+
+        PAL_ASSERT(pEntry->uploaded && (pEntry->refCount > 0));
+
+        if (--pEntry->refCount == 0)
+        {
+            m_entries.Erase(pEntry->key);
+
+            m_stats.numEntries--;
+            m_stats.residentBytes -= pEntry->size;
+
+            freeEntry = true;
+        }
+    }
+
+    if (freeEntry)
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(pEntry->pGpuMemory, pEntry->offset);
+        PAL_FREE(pEntry, m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+void CodeHeap::GetStats(
+    CodeHeapStats* pStats
+    ) const
+{
+    MutexAuto lock(&m_lock);
+
+    *pStats = m_stats;
+}
+
+} // Pal
@@ -0,0 +1,135 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class CodeHeap;
+class Device;
+class GpuMemory;
+class Platform;
+
+// =====================================================================================================================
+// One piece of pipeline code which lives in the code heap. Entries are shared by every pipeline or shader library
+// whose code is byte-identical and are freed once the last reference is released.
+struct CodeHeapEntry
+{
+    Util::MetroHash::Hash key;             // Hash of the code bytes, their alignment and the heap they live in.
+    gpusize               size;            // Size of the code, in bytes.
+    GpuMemory*            pGpuMemory;      // GPU memory (sub-)allocation holding the code.
+    gpusize               offset;          // Offset of the code within pGpuMemory.
+    gpusize               gpuVirtAddr;     // GPU virtual address of the code.
+    uint64                pagingFenceVal;  // Paging fence which must be waited on before the code can be used.
+    const void*           pCode;           // CPU copy of the code, used to confirm that a hash match is a real match.
+    uint32                refCount;        // Number of pipelines and shader libraries referencing this entry.
+    bool                  uploaded;        // False while the thread which created the entry is still uploading it.
+};
+
+// Running totals describing how effective code deduplication has been.
+struct CodeHeapStats
+{
+    uint32  numEntries;     // Number of unique code blocks currently in the heap.
+    gpusize residentBytes;  // Bytes of code currently uploaded to the heap.
+    uint64  numHits;        // Number of requests which were satisfied by an existing entry.
+    gpusize savedBytes;     // Bytes of code which were not uploaded because an identical entry was reused.
+};
+
+// =====================================================================================================================
+// The set of code heap entries referenced by a single pipeline or shader library. A pipeline only has a handful of
+// executable sections so this is a small fixed-size array.
+class CodeHeapRefs
+{
+public:
+    static constexpr uint32 MaxEntries = 4;
+
+    CodeHeapRefs() : m_numEntries(0) { }
+    ~CodeHeapRefs() { PAL_ASSERT(m_numEntries == 0); } // If this fires, the owner forgot to call Release()!
+
+    bool   IsFull()     const { return (m_numEntries == MaxEntries); }
+    uint32 NumEntries() const { return m_numEntries; }
+
+    const CodeHeapEntry& At(uint32 index) const { return *m_pEntries[index]; }
+
+    void Add(CodeHeapEntry* pEntry);
+    void MoveTo(CodeHeapRefs* pDst);
+    void Release(Device* pDevice);
+
+private:
+    CodeHeapEntry* m_pEntries[MaxEntries];
+    uint32         m_numEntries;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(CodeHeapRefs);
+};
+
+// =====================================================================================================================
+// Device-level, content-addressed heap of pipeline code. Identical executable ELF sections are uploaded to the GPU once
+// and reference counted, which saves both GPU memory and upload time for applications which create many permutations
+// of the same shaders. Code is sub-allocated from the internal memory manager's pools, so small sections from many
+// pipelines are packed into a few large GPU allocations.
+class CodeHeap
+{
+public:
+    explicit CodeHeap(Device* pDevice);
+    ~CodeHeap();
+
+    Result Init();
+
+    Result Acquire(
+        const void*     pCode,
+        gpusize         size,
+        gpusize         alignment,
+        GpuHeap         heap,
+        CodeHeapEntry** ppEntry);
+
+    void Release(CodeHeapEntry* pEntry);
+
+    void GetStats(CodeHeapStats* pStats) const;
+
+private:
+    Result Upload(
+        gpusize        alignment,
+        GpuHeap        heap,
+        CodeHeapEntry* pEntry);
+
+    typedef Util::HashMap<Util::MetroHash::Hash, CodeHeapEntry*, Platform, Util::JenkinsHashFunc> EntryMap;
+
+    Device*const        m_pDevice;
+    mutable Util::Mutex m_lock;      // Serializes access to the entry map and statistics; never held while uploading.
+    EntryMap            m_entries;
+    CodeHeapStats       m_stats;
+    bool                m_initialized;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CodeHeap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CodeHeap);
+};
+
+} // Pal
@@ -1526,7 +1526,8 @@ void Device::DescribeBarrierStart(
     PAL_ALERT_MSG((GetPlatform()->IsDevDriverProfilingEnabled() && (reason == Developer::BarrierReasonInvalid)),
                   "Invalid barrier reason codes are not allowed!");
 
-    data.reason = reason;
+    data.reason         = reason;
+    data.numMergedCalls = pCmdBuf->TakeMergedBarrierCallCount();
 
     m_pParent->DeveloperCb(Developer::CallbackType::BarrierBegin, &data);
 }
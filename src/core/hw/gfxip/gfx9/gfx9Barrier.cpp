@@ -1598,8 +1598,9 @@ void Device::DescribeBarrierStart(
     PAL_ALERT_MSG((GetPlatform()->IsDevDriverProfilingEnabled() && (reason == Developer::BarrierReasonInvalid)),
                   "Invalid barrier reason codes are not allowed!");
 
-    barrierData.reason = reason;
-    barrierData.type   = type;
+    barrierData.reason         = reason;
+    barrierData.type           = type;
+    barrierData.numMergedCalls = pCmdBuf->TakeMergedBarrierCallCount();
 
     m_pParent->DeveloperCb(Developer::CallbackType::BarrierBegin, &barrierData);
 }
@@ -85,6 +85,12 @@ CmdStream::CmdStream(
 {
 }
 
+// =====================================================================================================================
+CmdStream::~CmdStream()
+{
+    PAL_SAFE_DELETE(m_pPm4Optimizer, m_device.GetPlatform());
+}
+
 // =====================================================================================================================
 Result CmdStream::Begin(
     CmdStreamBeginFlags     flags,
@@ -98,7 +104,7 @@ Result CmdStream::Begin(
     }
     else
     {
-        // We can't enable PM4 optimization without an allocator because we need to dynamically allocate a Pm4Optimizer.
+        // PM4 optimization is only supported while building with a temporary allocator (i.e., for command buffers).
         flags.optimizeCommands &= (pMemAllocator != nullptr);
 
         // We may want to modify prefetchCommands based on this setting.
@@ -130,13 +136,24 @@ Result CmdStream::Begin(
 
     if ((result == Result::Success) && (m_flags.optimizeCommands == 1))
     {
-        // Allocate a temporary PM4 optimizer to use during command building.
-        m_pPm4Optimizer = PAL_NEW(Pm4Optimizer, m_pMemAllocator, AllocInternal)(static_cast<const Device&>(m_device));
+        // The PM4 optimizer is allocated the first time it's needed and kept for the lifetime of this stream. Resetting
+        // it is a constant time operation so this is much cheaper than building a new optimizer every time we begin.
+        // Its register shadow state takes 6 bytes per tracked register (about 9.6KB), which is less than the 12.8KB the
+        // optimizer used to borrow from the command allocator's linear allocator on every Begin().
+        if (m_pPm4Optimizer == nullptr)
+        {
+            m_pPm4Optimizer = PAL_NEW(Pm4Optimizer, m_device.GetPlatform(), AllocInternal)(
+                                  static_cast<const Device&>(m_device));
+        }
 
         if (m_pPm4Optimizer == nullptr)
         {
             result = Result::ErrorOutOfMemory;
         }
+        else
+        {
+            m_pPm4Optimizer->Reset();
+        }
     }
 
     return result;
@@ -154,16 +171,6 @@ void CmdStream::Reset(
     GfxCmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
 
-// =====================================================================================================================
-void CmdStream::CleanupTempObjects()
-{
-    // Clean up the temporary PM4 optimizer object.
-    if (m_pMemAllocator != nullptr)
-    {
-        PAL_SAFE_DELETE(m_pPm4Optimizer, m_pMemAllocator);
-    }
-}
-
 // =====================================================================================================================
 // Builds a PM4 packet to modify the given register unless the PM4 optimizer indicates that it is redundant.
 // Returns a pointer to the next unused DWORD in pCmdSpace.
@@ -335,9 +342,8 @@ uint32* CmdStream::WriteSetOneContextReg(
         const size_t totalDwords = m_cmdUtil.BuildSetOneContextReg(regAddr, pCmdSpace);
 
         pCmdSpace[CmdUtil::ContextRegSizeDwords] = regData;
-        pCmdSpace += totalDwords;
+        pCmdSpace = Pm4OptEnabled ? m_pPm4Optimizer->CoalesceSetRegPacket(pCmdSpace) : (pCmdSpace + totalDwords);
         m_contextRollDetected = true;
-
     }
 
     return pCmdSpace;
@@ -407,7 +413,7 @@ uint32* CmdStream::WriteSetOneShReg(
         const size_t totalDwords = m_cmdUtil.BuildSetOneShReg(regAddr, shaderType, pCmdSpace);
 
         pCmdSpace[CmdUtil::ShRegSizeDwords] = regData;
-        pCmdSpace += totalDwords;
+        pCmdSpace = Pm4OptEnabled ? m_pPm4Optimizer->CoalesceSetRegPacket(pCmdSpace) : (pCmdSpace + totalDwords);
     }
 
     return pCmdSpace;
@@ -595,6 +601,55 @@ uint32* CmdStream::WriteUserDataEntriesToSgprs<true, ShaderCompute>(
     const UserDataEntries& entries,
     uint32* pCmdSpace);
 
+// =====================================================================================================================
+// Writes one user-data entry to the user-SGPR a graphics or compute shader stage maps it to and records the written
+// value as a command buffer template patch location. Nothing is written if the stage doesn't map the entry to a SGPR.
+template <Pm4ShaderType shaderType>
+uint32* CmdStream::WritePatchableUserDataEntry(
+    const UserDataEntryMap& entryMap,
+    uint32                  entry,
+    uint32                  value,
+    uint32                  slotId,
+    uint32*                 pCmdSpace)
+{
+    // The PM4 optimizer must not be allowed to drop a register write which is going to be patched.
+    PAL_ASSERT(m_flags.optimizeCommands == 0);
+
+    for (uint16 sgpr = 0; sgpr < entryMap.userSgprCount; ++sgpr)
+    {
+        if (entryMap.mappedEntry[sgpr] == entry)
+        {
+            const size_t totalDwords = m_cmdUtil.BuildSetOneShReg((entryMap.firstUserSgprRegAddr + sgpr),
+                                                                  shaderType,
+                                                                  pCmdSpace);
+
+            pCmdSpace[CmdUtil::ShRegSizeDwords] = value;
+            AddPatchLocation(slotId, (pCmdSpace + CmdUtil::ShRegSizeDwords), 1, 0);
+
+            pCmdSpace += totalDwords;
+            break;
+        }
+    }
+
+    return pCmdSpace;
+}
+
+// Instantiate template for linker.
+template
+uint32* CmdStream::WritePatchableUserDataEntry<ShaderGraphics>(
+    const UserDataEntryMap& entryMap,
+    uint32                  entry,
+    uint32                  value,
+    uint32                  slotId,
+    uint32*                 pCmdSpace);
+template
+uint32* CmdStream::WritePatchableUserDataEntry<ShaderCompute>(
+    const UserDataEntryMap& entryMap,
+    uint32                  entry,
+    uint32                  value,
+    uint32                  slotId,
+    uint32*                 pCmdSpace);
+
 // =====================================================================================================================
 // Helper function for writing the user-SGPR's mapped to user-data entries for a graphics or compute shader stage.
 template <bool IgnoreDirtyFlags, Pm4ShaderType shaderType, bool Pm4OptEnabled>
@@ -960,6 +1015,12 @@ void CmdStream::PatchCondIndirectBuffer(
 // =====================================================================================================================
 void CmdStream::BeginCurrentChunk()
 {
+    // SET packets can't be merged across chunk boundaries.
+    if (m_flags.optimizeCommands == 1)
+    {
+        m_pPm4Optimizer->BreakSetRegPacketChain();
+    }
+
     // Allocate a preamble with enough space for a DMA_DATA packet. We will patch it to DMA the stream contents into
     // the gfxL2 to improve command fetch performance.
     if (m_flags.prefetchCommands)
@@ -1088,7 +1149,7 @@ uint32* CmdStream::WriteClearState(
 {
     pCmdSpace += m_cmdUtil.BuildClearState(clearMode, pCmdSpace);
 
-    if ((clearMode == cmd__pfp_clear_state__pop_state) && (m_pPm4Optimizer != nullptr))
+    if ((clearMode == cmd__pfp_clear_state__pop_state) && (m_flags.optimizeCommands == 1))
     {
         // We just destroyed all the state, reset the pm4 optimizer
         m_pPm4Optimizer->Reset();
@@ -1151,7 +1212,7 @@ void CmdStream::IssueHotRegisterReport(
     GfxCmdBuffer* pCmdBuf
     ) const
 {
-    if (m_pPm4Optimizer != nullptr)
+    if (m_flags.optimizeCommands == 1)
     {
         m_pPm4Optimizer->IssueHotRegisterReport(pCmdBuf);
     }
@@ -52,7 +52,7 @@ public:
         SubEngineType  subEngineType,
         CmdStreamUsage cmdStreamUsage,
         bool           isNested);
-    virtual ~CmdStream() {}
+    virtual ~CmdStream();
 
     virtual Result Begin(CmdStreamBeginFlags flags, Util::VirtualLinearAllocator* pMemAllocator) override;
     virtual void   Reset(CmdAllocator* pNewAllocator, bool returnGpuMemory) override;
@@ -130,6 +130,14 @@ public:
         const UserDataEntries&  entries,
         uint32*                 pCmdSpace);
 
+    template <Pm4ShaderType shaderType>
+    uint32* WritePatchableUserDataEntry(
+        const UserDataEntryMap& entryMap,
+        uint32                  entry,
+        uint32                  value,
+        uint32                  slotId,
+        uint32*                 pCmdSpace);
+
     template <bool Pm4OptEnabled>
     uint32* WriteSetBase(
         gpusize                         address,
@@ -186,12 +194,11 @@ protected:
         uint32       ibSizeDwords) const override;
 
 private:
-    virtual void CleanupTempObjects() override;
     virtual void BeginCurrentChunk() override;
     virtual void EndCurrentChunk(bool atEndOfStream) override;
 
     const CmdUtil& m_cmdUtil;
-    Pm4Optimizer*  m_pPm4Optimizer;       // This will only be created if optimization is enabled for this stream.
+    Pm4Optimizer*  m_pPm4Optimizer;       // Created the first time optimization is enabled for this stream.
     uint32*        m_pChunkPreamble;      // If non-null, the current chunk preamble was allocated here.
     bool           m_contextRollDetected; // This will only be set if a context roll has been detected since the
                                           // last draw.
@@ -318,6 +318,15 @@ public:
     static constexpr uint32 WriteDataSizeDwords       = PM4_ME_WRITE_DATA_SIZEDW__CORE;
     static constexpr uint32 WriteNonSampleEventDwords = (sizeof(PM4_ME_NON_SAMPLE_EVENT_WRITE) / sizeof(uint32));
 
+    // DWORD offsets of the draw and dispatch arguments which command buffer templates can patch.
+    static constexpr uint32 DrawIndexAutoCountOffset    = offsetof(PM4_PFP_DRAW_INDEX_AUTO, ordinal2) / sizeof(uint32);
+    static constexpr uint32 DrawIndex2BaseOffset        = offsetof(PM4_PFP_DRAW_INDEX_2, ordinal3) / sizeof(uint32);
+    static constexpr uint32 DrawIndex2CountOffset       = offsetof(PM4_PFP_DRAW_INDEX_2, ordinal5) / sizeof(uint32);
+    static constexpr uint32 DrawIndexOffset2CountOffset =
+        offsetof(PM4_PFP_DRAW_INDEX_OFFSET_2, ordinal4) / sizeof(uint32);
+    static constexpr uint32 DispatchDirectDimsOffset    = offsetof(PM4_MEC_DISPATCH_DIRECT, ordinal2) / sizeof(uint32);
+    static constexpr uint32 NumInstancesCountOffset     = offsetof(PM4_PFP_NUM_INSTANCES, ordinal2) / sizeof(uint32);
+
     // The INDIRECT_BUFFER and COND_INDIRECT_BUFFER packet have a hard-coded IB size of 20 bits.
     static constexpr uint32 MaxIndirectBufferSizeDwords = (1 << 20) - 1;
 
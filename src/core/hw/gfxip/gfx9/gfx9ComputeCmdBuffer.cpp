@@ -141,13 +141,16 @@ void ComputeCmdBuffer::CmdBarrier(
 {
     CmdBuffer::CmdBarrier(barrierInfo);
 
-    // Barriers do not honor predication.
-    const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
-    m_gfxCmdBufState.flags.packetPredicate = 0;
+    if (DeferBarrier(barrierInfo) == false)
+    {
+        // Barriers do not honor predication.
+        const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    m_device.Barrier(this, &m_cmdStream, barrierInfo);
+        m_device.Barrier(this, &m_cmdStream, barrierInfo);
 
-    m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+    }
 }
 
 // =====================================================================================================================
@@ -155,6 +158,8 @@ void ComputeCmdBuffer::CmdRelease(
     const AcquireReleaseInfo& releaseInfo,
     const IGpuEvent*          pGpuEvent)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     CmdBuffer::CmdRelease(releaseInfo, pGpuEvent);
 
     // Barriers do not honor predication.
@@ -176,6 +181,8 @@ void ComputeCmdBuffer::CmdAcquire(
     uint32                    gpuEventCount,
     const IGpuEvent*const*    ppGpuEvents)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     CmdBuffer::CmdAcquire(acquireInfo, gpuEventCount, ppGpuEvents);
 
     // Barriers do not honor predication.
@@ -197,17 +204,20 @@ void ComputeCmdBuffer::CmdReleaseThenAcquire(
 {
     CmdBuffer::CmdReleaseThenAcquire(barrierInfo);
 
-    // Barriers do not honor predication.
-    const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
-    m_gfxCmdBufState.flags.packetPredicate = 0;
+    if (DeferReleaseThenAcquire(barrierInfo) == false)
+    {
+        // Barriers do not honor predication.
+        const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    // Mark these as traditional barriers in RGP
-    m_device.DescribeBarrierStart(this, barrierInfo.reason, Developer::BarrierType::Full);
-    Developer::BarrierOperations barrierOps = {};
-    m_device.BarrierReleaseThenAcquire(this, &m_cmdStream, barrierInfo, &barrierOps);
-    m_device.DescribeBarrierEnd(this, &barrierOps);
+        // Mark these as traditional barriers in RGP
+        m_device.DescribeBarrierStart(this, barrierInfo.reason, Developer::BarrierType::Full);
+        Developer::BarrierOperations barrierOps = {};
+        m_device.BarrierReleaseThenAcquire(this, &m_cmdStream, barrierInfo, &barrierOps);
+        m_device.DescribeBarrierEnd(this, &barrierOps);
 
-    m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+    }
 }
 
 // =====================================================================================================================
@@ -222,6 +232,8 @@ void PAL_STDCALL ComputeCmdBuffer::CmdDispatch(
 {
     auto* pThis = static_cast<ComputeCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     if (issueSqttMarkerEvent)
     {
         pThis->m_device.DescribeDispatch(pThis, Developer::DrawDispatchType::CmdDispatch, 0, 0, 0, x, y, z);
@@ -231,11 +243,30 @@ void PAL_STDCALL ComputeCmdBuffer::CmdDispatch(
 
     pCmdSpace = pThis->ValidateDispatch(0uLL, x, y, z, pCmdSpace);
 
+    if (pThis->m_pSignatureCs->numWorkGroupsRegAddr != UserDataNotMapped)
+    {
+        pThis->RejectDispatchSizePatchSlots();
+    }
+
+    if (pThis->HasPendingPatchSlots())
+    {
+        pCmdSpace = pThis->WritePatchableUserData(pCmdSpace);
+    }
+
     if (pThis->m_gfxCmdBufState.flags.packetPredicate != 0)
     {
         pCmdSpace += pThis->m_cmdUtil.BuildCondExec(pThis->m_predGpuAddr, CmdUtil::DispatchDirectSize, pCmdSpace);
     }
 
+    if (pThis->HasPendingPatchSlots())
+    {
+        pThis->RecordPatchLocations(CmdPatchSlotType::DispatchSize,
+                                    &pThis->m_cmdStream,
+                                    (pCmdSpace + CmdUtil::DispatchDirectDimsOffset),
+                                    3,
+                                    0);
+    }
+
     pCmdSpace += pThis->m_cmdUtil.BuildDispatchDirect<false, true>(x, y, z,
                                                                    PredDisable,
                                                                    pThis->m_pSignatureCs->flags.isWave32,
@@ -249,6 +280,7 @@ void PAL_STDCALL ComputeCmdBuffer::CmdDispatch(
     }
 
     pThis->m_cmdStream.CommitCommands(pCmdSpace);
+    pThis->ClearPendingPatchSlots();
 }
 
 // =====================================================================================================================
@@ -261,6 +293,9 @@ void PAL_STDCALL ComputeCmdBuffer::CmdDispatchIndirect(
     gpusize           offset)
 {
     auto* pThis = static_cast<ComputeCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     if (issueSqttMarkerEvent)
     {
@@ -308,6 +343,9 @@ void PAL_STDCALL ComputeCmdBuffer::CmdDispatchOffset(
     uint32      zDim)
 {
     auto* pThis = static_cast<ComputeCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     if (issueSqttMarkerEvent)
     {
@@ -375,6 +413,8 @@ void ComputeCmdBuffer::CmdCopyMemory(
     uint32                  regionCount,
     const MemoryCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdCopyMemory(this,
                                          static_cast<const GpuMemory&>(srcGpuMemory),
                                          static_cast<const GpuMemory&>(dstGpuMemory),
@@ -389,6 +429,8 @@ void ComputeCmdBuffer::CmdUpdateMemory(
     gpusize           dataSize,
     const uint32*     pData)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pData != nullptr);
     m_device.RsrcProcMgr().CmdUpdateMemory(this,
                                            static_cast<const GpuMemory&>(dstGpuMemory),
@@ -403,6 +445,8 @@ void ComputeCmdBuffer::CmdUpdateBusAddressableMemoryMarker(
     gpusize           offset,
     uint32            value)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&dstGpuMemory);
     WriteDataInfo    writeData  = {};
 
@@ -423,6 +467,8 @@ void ComputeCmdBuffer::CmdMemoryAtomic(
     uint64            srcData,
     AtomicOp          atomicOp)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
     pCmdSpace += m_cmdUtil.BuildAtomicMem(atomicOp, dstGpuMemory.Desc().gpuVirtAddr + dstOffset, srcData, pCmdSpace);
     m_cmdStream.CommitCommands(pCmdSpace);
@@ -436,6 +482,8 @@ void ComputeCmdBuffer::CmdWriteTimestamp(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const gpusize address   = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
     uint32*       pCmdSpace = m_cmdStream.ReserveCommands();
 
@@ -475,6 +523,8 @@ void ComputeCmdBuffer::CmdWriteImmediate(
     ImmediateDataWidth dataSize,
     gpusize            address)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
 
     if (pipePoint == HwPipeTop)
@@ -781,6 +831,8 @@ void ComputeCmdBuffer::CmdBeginQuery(
     uint32            slot,
     QueryControlFlags flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).Begin(this, &m_cmdStream, queryType, slot, flags);
 }
 
@@ -790,6 +842,8 @@ void ComputeCmdBuffer::CmdEndQuery(
     QueryType         queryType,
     uint32            slot)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).End(this, &m_cmdStream, queryType, slot);
 }
 
@@ -799,6 +853,8 @@ void ComputeCmdBuffer::CmdResetQueryPool(
     uint32            startQuery,
     uint32            queryCount)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).Reset(this, &m_cmdStream, startQuery, queryCount);
 }
 
@@ -810,6 +866,8 @@ void ComputeCmdBuffer::CmdIf(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Nested command buffers don't support control flow yet.
     PAL_ASSERT(IsNested() == false);
 
@@ -819,6 +877,8 @@ void ComputeCmdBuffer::CmdIf(
 // =====================================================================================================================
 void ComputeCmdBuffer::CmdElse()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Nested command buffers don't support control flow yet.
     PAL_ASSERT(IsNested() == false);
 
@@ -828,6 +888,8 @@ void ComputeCmdBuffer::CmdElse()
 // =====================================================================================================================
 void ComputeCmdBuffer::CmdEndIf()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Nested command buffers don't support control flow yet.
     PAL_ASSERT(IsNested() == false);
 
@@ -842,6 +904,8 @@ void ComputeCmdBuffer::CmdWhile(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Nested command buffers don't support control flow yet.
     PAL_ASSERT(IsNested() == false);
 
@@ -851,6 +915,8 @@ void ComputeCmdBuffer::CmdWhile(
 // =====================================================================================================================
 void ComputeCmdBuffer::CmdEndWhile()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Nested command buffers don't support control flow yet.
     PAL_ASSERT(IsNested() == false);
 
@@ -863,6 +929,8 @@ void ComputeCmdBuffer::CmdCopyRegisterToMemory(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
 
     DmaDataInfo dmaData = {};
@@ -886,6 +954,8 @@ void ComputeCmdBuffer::CmdWaitRegisterValue(
     uint32      mask,
     CompareFunc compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
 
     pCmdSpace += m_cmdUtil.BuildWaitRegMem(EngineTypeCompute,
@@ -908,6 +978,8 @@ void ComputeCmdBuffer::CmdWaitMemoryValue(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
 
     pCmdSpace += m_cmdUtil.BuildWaitRegMem(EngineTypeCompute,
@@ -929,6 +1001,8 @@ void ComputeCmdBuffer::CmdWaitBusAddressableMemoryMarker(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&gpuMemory);
 
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
@@ -1153,6 +1227,8 @@ void ComputeCmdBuffer::WriteEventCmd(
     HwPipePoint           pipePoint,
     uint32                data)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_cmdStream.ReserveCommands();
 
     if ((pipePoint >= HwPipePostBlt) && (m_gfxCmdBufState.flags.cpBltActive))
@@ -1241,6 +1317,8 @@ void ComputeCmdBuffer::CmdSetPredication(
     bool                waitResults,
     bool                accumulateData)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // This emulation doesn't work for QueryPool based predication, fortuanately DX12 just has Boolean type
     // predication. TODO: emulation for Zpass and Streamout predication if they are really used on compute.
     PAL_ASSERT(pQueryPool == nullptr);
@@ -1291,6 +1369,8 @@ void ComputeCmdBuffer::CmdExecuteIndirectCmds(
     uint32                       maximumCount,
     gpusize                      countGpuAddr)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // It is only safe to generate indirect commands on a one-time-submit or exclusive-submit command buffer because
     // there is a potential race condition on the memory used to receive the generated commands.
     PAL_ASSERT(IsOneTimeSubmit() || IsExclusiveSubmit());
@@ -1430,45 +1510,113 @@ void ComputeCmdBuffer::CmdExecuteNestedCmdBuffers(
     uint32            cmdBufferCount,
     ICmdBuffer*const* ppCmdBuffers)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     for (uint32 buf = 0; buf < cmdBufferCount; ++buf)
     {
         auto*const pCallee = static_cast<Gfx9::ComputeCmdBuffer*>(ppCmdBuffers[buf]);
         PAL_ASSERT(pCallee != nullptr);
 
-        if (pCallee->m_inheritedPredication && (m_predGpuAddr != 0))
-        {
-            PAL_ASSERT(pCallee->m_predGpuAddr != 0);
+        CallNestedCmdBuffer(pCallee, false, 0, nullptr);
+    }
+}
+
+// =====================================================================================================================
+// Instantiates a command buffer template. This behaves like CmdExecuteNestedCmdBuffers() except that the template's
+// commands are always copied inline so that its patch slots can be overwritten in this command buffer's copy.
+void ComputeCmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    BarrierDeferralBlock deferralBlock(this);
 
-            uint32 *pCmdSpace = m_cmdStream.ReserveCommands();
+    auto*const pTemplate = static_cast<Gfx9::ComputeCmdBuffer*>(pTemplateCmdBuffer);
+    PAL_ASSERT((pTemplate != nullptr) && pTemplate->IsNested());
+    PAL_ASSERT((patchCount == 0) || (pPatches != nullptr));
 
-            pCmdSpace += m_cmdUtil.BuildCopyDataCompute(dst_sel__mec_copy_data__tc_l2,
-                                                        pCallee->m_predGpuAddr,
-                                                        src_sel__mec_copy_data__tc_l2,
-                                                        m_predGpuAddr,
-                                                        count_sel__mec_copy_data__32_bits_of_data,
-                                                        wr_confirm__mec_copy_data__wait_for_confirmation,
-                                                        pCmdSpace);
+    CallNestedCmdBuffer(pTemplate, true, patchCount, pPatches);
+}
 
-            m_cmdStream.CommitCommands(pCmdSpace);
-        }
+// =====================================================================================================================
+// Executes one nested command buffer, or instantiates it as a template with the given patch values.
+void ComputeCmdBuffer::CallNestedCmdBuffer(
+    ComputeCmdBuffer*    pCallee,
+    bool                 isTemplate,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    if (pCallee->m_inheritedPredication && (m_predGpuAddr != 0))
+    {
+        PAL_ASSERT(pCallee->m_predGpuAddr != 0);
+
+        uint32 *pCmdSpace = m_cmdStream.ReserveCommands();
+
+        pCmdSpace += m_cmdUtil.BuildCopyDataCompute(dst_sel__mec_copy_data__tc_l2,
+                                                    pCallee->m_predGpuAddr,
+                                                    src_sel__mec_copy_data__tc_l2,
+                                                    m_predGpuAddr,
+                                                    count_sel__mec_copy_data__32_bits_of_data,
+                                                    wr_confirm__mec_copy_data__wait_for_confirmation,
+                                                    pCmdSpace);
+
+        m_cmdStream.CommitCommands(pCmdSpace);
+    }
+
+    // Track the most recent OS paging fence value across all nested command buffers called from this one.
+    m_lastPagingFence = Max(m_lastPagingFence, pCallee->LastPagingFence());
 
-        // Track the most recent OS paging fence value across all nested command buffers called from this one.
-        m_lastPagingFence = Max(m_lastPagingFence, pCallee->LastPagingFence());
+    // Track the lastest fence token across all nested command buffers called from this one.
+    m_maxUploadFenceToken = Max(m_maxUploadFenceToken, pCallee->GetMaxUploadFenceToken());
 
-        // Track the lastest fence token across all nested command buffers called from this one.
-        m_maxUploadFenceToken = Max(m_maxUploadFenceToken, pCallee->GetMaxUploadFenceToken());
+    // All user-data entries have been uploaded into the GPU memory the callee expects to receive them in, so we
+    // can safely "call" the nested command buffer's command stream.
+    m_cmdStream.TrackNestedEmbeddedData(pCallee->m_embeddedData.chunkList);
+    m_cmdStream.TrackNestedEmbeddedData(pCallee->m_gpuScratchMem.chunkList);
+    m_cmdStream.TrackNestedCommands(pCallee->m_cmdStream);
 
-        // All user-data entries have been uploaded into the GPU memory the callee expects to receive them in, so we
-        // can safely "call" the nested command buffer's command stream.
-        m_cmdStream.TrackNestedEmbeddedData(pCallee->m_embeddedData.chunkList);
-        m_cmdStream.TrackNestedEmbeddedData(pCallee->m_gpuScratchMem.chunkList);
-        m_cmdStream.TrackNestedCommands(pCallee->m_cmdStream);
+    if (isTemplate)
+    {
+        m_cmdStream.CallTemplate(pCallee->m_cmdStream, patchCount, pPatches);
+    }
+    else
+    {
         m_cmdStream.Call(pCallee->m_cmdStream, pCallee->IsExclusiveSubmit(), false);
+    }
+
+    // Callee command buffers are also able to leak any changes they made to bound user-data entries and any other
+    // state back to the caller.
+    LeakNestedCmdBufferState(*pCallee);
+}
+
+// =====================================================================================================================
+// Rewrites the user-SGPRs of every user-data entry with a pending UserData patch slot so that each value lives in a
+// packet which can be patched. Returns the next unused DWORD in pCmdSpace.
+uint32* ComputeCmdBuffer::WritePatchableUserData(
+    uint32* pCmdSpace)
+{
+    for (uint32 idx = 0; idx < NumPendingPatchSlots(); ++idx)
+    {
+        const CmdPatchSlotInfo& slot = PendingPatchSlot(idx);
 
-        // Callee command buffers are also able to leak any changes they made to bound user-data entries and any other
-        // state back to the caller.
-        LeakNestedCmdBufferState(*pCallee);
+        if (slot.type == CmdPatchSlotType::UserData)
+        {
+            PAL_ASSERT((slot.bindPoint == PipelineBindPoint::Compute) && (slot.userDataEntry < MaxUserDataEntries));
+            const uint32*const pPrevCmdSpace = pCmdSpace;
+
+            pCmdSpace = m_cmdStream.WritePatchableUserDataEntry<ShaderCompute>(
+                                m_pSignatureCs->stage,
+                                slot.userDataEntry,
+                                m_computeState.csUserDataEntries.entries[slot.userDataEntry],
+                                slot.slotId,
+                                pCmdSpace);
+
+            // Spilled user-data entries live in embedded data which templates can't patch.
+            PAL_ALERT(pCmdSpace == pPrevCmdSpace);
+        }
     }
+
+    return pCmdSpace;
 }
 
 // =====================================================================================================================
@@ -1562,6 +1710,8 @@ void ComputeCmdBuffer::CpCopyMemory(
     gpusize srcAddr,
     gpusize numBytes)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(numBytes < (1ull << 32));
 
     DmaDataInfo dmaDataInfo = {};
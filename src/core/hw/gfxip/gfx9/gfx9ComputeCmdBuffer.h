@@ -155,6 +155,10 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override;
     virtual void CmdExecuteIndirectCmds(
         const IIndirectCmdGenerator& generator,
         const IGpuMemory&            gpuMemory,
@@ -259,6 +263,14 @@ private:
     void LeakNestedCmdBufferState(
         const ComputeCmdBuffer& cmdBuffer);
 
+    void CallNestedCmdBuffer(
+        ComputeCmdBuffer*    pCallee,
+        bool                 isTemplate,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches);
+
+    uint32* WritePatchableUserData(uint32* pCmdSpace);
+
     bool DisablePartialPreempt() const
     {
         return static_cast<const ComputePipeline*>(m_computeState.pipelineState.pPipeline)->DisablePartialPreempt();
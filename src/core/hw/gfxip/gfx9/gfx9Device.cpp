@@ -60,6 +60,7 @@
 #include "core/hw/gfxip/gfx9/gfx10DmaCmdBuffer.h"
 #include "palAssert.h"
 #include "palAutoBuffer.h"
+#include "palCpuProfiler.h"
 #include "palDequeImpl.h"
 
 #include "palFormatInfo.h"
@@ -182,6 +183,7 @@ Device::Device(
               GetFrameCountRegister(pDevice)),
     m_cmdUtil(*this),
     m_queueContextUpdateCounter(0),
+    m_metaEqCache(pDevice->GetPlatform()),
     // The default value of MSAA rate is 1xMSAA.
     m_msaaRate(1),
     m_presentResolution({ 0,0 }),
@@ -232,6 +234,9 @@ Result Device::Cleanup()
         m_dummyZpassDoneMem.Update(nullptr, 0);
     }
 
+    // The cached meta-equations depend on settings which may change before this device is used again.
+    m_metaEqCache.Reset();
+
     if (result == Result::Success)
     {
         result = GfxDevice::Cleanup();
@@ -266,6 +271,11 @@ Result Device::EarlyInit()
 
     Result result = m_ringSizesLock.Init();
 
+    if (result == Result::Success)
+    {
+        result = m_metaEqCache.Init();
+    }
+
     if (result == Result::Success)
     {
         result = m_pRsrcProcMgr->EarlyInit();
@@ -391,6 +401,7 @@ Result Device::Finalize()
 
     if (result == Result::Success)
     {
+        StartupPhase phase(m_pParent->GetPlatform(), "RpmPipelines", m_pParent->GetDeviceIndex());
         result = m_pRsrcProcMgr->LateInit();
     }
 
@@ -835,6 +846,8 @@ Result Device::CreateComputePipeline(
     bool                             isInternal,
     IPipeline**                      ppPipeline)
 {
+    PAL_CPU_ZONE("Gfx9::CreateComputePipeline");
+
     auto* pPipeline = PAL_PLACEMENT_NEW(pPlacementAddr) ComputePipeline(this, isInternal);
 
     Result result = pPipeline->Init(createInfo);
@@ -917,6 +930,8 @@ Result Device::CreateGraphicsPipeline(
     bool                                      isInternal,
     IPipeline**                               ppPipeline)
 {
+    PAL_CPU_ZONE("Gfx9::CreateGraphicsPipeline");
+
     PAL_ASSERT(createInfo.pPipelineBinary != nullptr);
     PAL_ASSERT(pPlacementAddr != nullptr);
     AbiReader abiReader(GetPlatform(), createInfo.pPipelineBinary);
@@ -364,6 +364,9 @@ public:
     void   GetLargestRingSizes(ShaderRingItemSizes* pRingSizesNeeded);
     uint32 QueueContextUpdateCounter() const { return m_queueContextUpdateCounter; }
 
+    // Mask-rams are only given const access to the device, but still need to populate the meta-equation cache.
+    MetaEqCache* GetMetaEqCache() const { return &m_metaEqCache; }
+
     virtual Result SetSamplePatternPalette(const SamplePatternPalette& palette) override;
     void GetSamplePatternPalette(SamplePatternPalette* pSamplePatternPalette);
 
@@ -745,6 +748,9 @@ private:
     // will check its watermark against the one owned by the device and update accordingly.
     volatile uint32               m_queueContextUpdateCounter;
 
+    // Meta-equations shared between the mask-rams of all images created on this device.
+    mutable MetaEqCache           m_metaEqCache;
+
     // Tracks the sample pattern palette for sample pos shader ring. Access to this object must be
     // serialized using m_samplePatternLock.
     volatile SamplePatternPalette m_samplePatternPalette;
@@ -747,16 +747,6 @@ void Gfx9MaskRam::CalcMetaEquationGfx9()
                           compFragLog2 + i);
         }
 
-        // Ok, we always calculate the meta-equation to be 32-bits long, but that's enough to address 4Gnibbles.
-        // Trim this down to be no bigger than log2(mask-ram-size)
-        FinalizeMetaEquation(TotalSize());
-
-        // After meta equation calculation is done extract meta equation parameter information
-        m_meta.GenerateMetaEqParamConst(m_image, maxFragsLog2, m_firstUploadBit, &m_metaEqParam);
-
-        // For some reason, the number of samples addressed by the equation sometimes differs from the number of
-        // samples associated with the data-surface.  Still seems to work...
-        PAL_ALERT (m_effectiveSamples != (1u << numSamplesLog2));
     }
 }
 
@@ -1269,21 +1259,98 @@ bool Gfx9MaskRam::SupportFastColorClear(
 //
 //          metaOffset |= (b << n)
 //      }
+//
+// Building the equation from scratch is expensive, so equations are shared through the device's meta-equation cache
+// between all mask-rams which have the same key.
 void Gfx9MaskRam::CalcMetaEquation()
 {
-    const Pal::Image*  pParent   = m_image.Parent();
     const Pal::Device& palDevice = *(m_pGfxDevice->Parent());
 
+    if (IsGfx9(palDevice) || IsGfx10(palDevice))
+    {
+        MetaEqCacheKey key = {};
+        BuildMetaEqCacheKey(&key);
+
+        MetaEqCache*const pMetaEqCache = m_pGfxDevice->GetMetaEqCache();
+
+        if (pMetaEqCache->Find(key, &m_meta) == false)
+        {
+            if (IsGfx9(palDevice))
+            {
+                CalcMetaEquationGfx9();
+            }
+            else
+            {
+                CalcMetaEquationGfx10();
+            }
+
+            pMetaEqCache->Insert(key, m_meta);
+        }
+    }
+
     if (IsGfx9(palDevice))
     {
-        CalcMetaEquationGfx9();
+        // Ok, we always calculate the meta-equation to be 32-bits long, but that's enough to address 4Gnibbles.
+        // Trim this down to be no bigger than log2(mask-ram-size)
+        FinalizeMetaEquation(TotalSize());
+
+        // After meta equation calculation is done extract meta equation parameter information
+        m_meta.GenerateMetaEqParamConst(m_image, m_pGfxDevice->GetMaxFragsLog2(), m_firstUploadBit, &m_metaEqParam);
+
+        // For some reason, the number of samples addressed by the equation sometimes differs from the number of
+        // samples associated with the data-surface.  Still seems to work...
+        PAL_ALERT (m_effectiveSamples != (1u << GetNumSamplesLog2()));
     }
     else if (IsGfx10(palDevice))
     {
-        CalcMetaEquationGfx10();
+        FinalizeMetaEquation(palDevice.GetAddrMgr()->GetBlockSize(GetSwizzleMode()));
     }
 }
 
+// =====================================================================================================================
+// Gathers everything CalcMetaEquationGfx9 and CalcMetaEquationGfx10 depend on, other than the device itself.  Anything
+// new those functions start looking at must be added here, or mask-rams will be handed each other's equations.
+void Gfx9MaskRam::BuildMetaEqCacheKey(
+    MetaEqCacheKey* pKey
+    ) const
+{
+    const ImageCreateInfo& createInfo = m_image.Parent()->GetImageCreateInfo();
+
+    Gfx9MaskRamBlockSize compBlkSizeLog2 = {};
+    CalcCompBlkSizeLog2(&compBlkSizeLog2);
+
+    Gfx9MaskRamBlockSize metaBlkSizeLog2 = {};
+    CalcMetaBlkSizeLog2(&metaBlkSizeLog2);
+
+    pKey->swizzleMode          = GetSwizzleMode();
+    pKey->bppLog2              = GetBytesPerPixelLog2();
+    pKey->numSamplesLog2       = GetNumSamplesLog2();
+    pKey->metaFlags            = GetMetaFlags().value;
+    pKey->metaDataWordSizeLog2 = m_metaDataWordSizeLog2;
+    pKey->metaCachelineSize    = GetMetaCachelineSize();
+    pKey->compBlkSizeLog2[0]   = compBlkSizeLog2.width;
+    pKey->compBlkSizeLog2[1]   = compBlkSizeLog2.height;
+    pKey->compBlkSizeLog2[2]   = compBlkSizeLog2.depth;
+    pKey->metaBlkSizeLog2[0]   = metaBlkSizeLog2.width;
+    pKey->metaBlkSizeLog2[1]   = metaBlkSizeLog2.height;
+    pKey->metaBlkSizeLog2[2]   = metaBlkSizeLog2.depth;
+
+    if (IsGfx10(*m_pGfxDevice->Parent()))
+    {
+        Gfx9MaskRamBlockSize metaBlockExtent = {};
+        pKey->metaBlockSize      = GetMetaBlockSize(&metaBlockExtent);
+        pKey->metaBlockExtent[0] = metaBlockExtent.width;
+        pKey->metaBlockExtent[1] = metaBlockExtent.height;
+        pKey->metaBlockExtent[2] = metaBlockExtent.depth;
+    }
+
+    pKey->flags.isColor        = IsColor();
+    pKey->flags.isDepth        = IsDepth();
+    pKey->flags.isThick        = IsThick();
+    pKey->flags.hasMips        = (createInfo.mipLevels > 1);
+    pKey->flags.isDepthStencil = createInfo.usageFlags.depthStencil;
+}
+
 // =====================================================================================================================
 void Gfx9MaskRam::AddMetaPipeBits(
     MetaDataAddrEquation* pPipe,
@@ -2200,7 +2267,6 @@ void Gfx9MaskRam::CalcMetaEquationGfx10()
 {
     Gfx9MaskRamBlockSize   metaBlockSizeLog2 = {};
 
-    const Pal::Device*     pPalDevice            = m_pGfxDevice->Parent();
     const AddrSwizzleMode  swizzleMode           = GetSwizzleMode();
     const uint32           blockSizeLog2         = GetMetaBlockSize(&metaBlockSizeLog2);
     const uint32           bppLog2               = GetBytesPerPixelLog2();
@@ -2540,7 +2606,6 @@ void Gfx9MaskRam::CalcMetaEquationGfx10()
     // The equation is currently 32-bits long, but on GFX10, the equation is an offset into one meta-block
     // (unlike on GFX9 where the equation is an offset into the entire mask-ram), so trim this down to the
     // the log2 of one meta-block.
-    FinalizeMetaEquation(pPalDevice->GetAddrMgr()->GetBlockSize(swizzleMode));
 }
 
 //=============== Implementation for Gfx9Htile: ========================================================================
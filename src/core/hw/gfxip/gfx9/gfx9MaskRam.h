@@ -243,6 +243,7 @@ private:
     void   CalcRbEquation(MetaDataAddrEquation* pRb, uint32  numSesLog2, uint32  numRbsPerSeLog2);
     void   MergePipeAndRbEq(MetaDataAddrEquation* pRb, MetaDataAddrEquation* pPipe);
     uint32 RemoveSmallRbBits(MetaDataAddrEquation* pRb);
+    void   BuildMetaEqCacheKey(MetaEqCacheKey* pKey) const;
 
     uint32 GetRbAppendedBit(uint32  bitPos) const;
     void   SetRbAppendedBit(uint32  bitPos, uint32  bitVal);
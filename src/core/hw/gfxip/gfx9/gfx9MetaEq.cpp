@@ -30,6 +30,8 @@
 #include "core/hw/gfxip/gfx9/gfx9Image.h"
 #include "core/hw/gfxip/gfx9/gfx9MetaEq.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
+#include "core/platform.h"
+#include "palHashMapImpl.h"
 
 using namespace Util;
 
@@ -1120,5 +1122,98 @@ void MetaDataAddrEquation::Rotate(
     }
 }
 
+//=============== Implementation for MetaEqCache: ======================================================================
+
+// Only a few dozen unique equations show up in practice.
+constexpr uint32 MetaEqCacheNumBuckets = 64;
+
+// =====================================================================================================================
+MetaEqCache::MetaEqCache(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_equations(MetaEqCacheNumBuckets, pPlatform)
+{
+}
+
+// =====================================================================================================================
+MetaEqCache::~MetaEqCache()
+{
+    // Iterating is safe even if Init() was never called, but locking isn't.
+    for (auto iter = m_equations.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_DELETE(iter.Get()->value, m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+Result MetaEqCache::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_equations.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Drops every cached equation.  Equations depend on the device's settings, so this must be called whenever they may
+// change.
+void MetaEqCache::Reset()
+{
+    MutexAuto lock(&m_lock);
+
+    for (auto iter = m_equations.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_DELETE(iter.Get()->value, m_pPlatform);
+    }
+
+    m_equations.Reset();
+}
+
+// =====================================================================================================================
+// Copies the cached equation for the given key into pEquation.  Returns false if there is none.
+bool MetaEqCache::Find(
+    const MetaEqCacheKey& key,
+    MetaDataAddrEquation* pEquation)
+{
+    MutexAuto lock(&m_lock);
+
+    MetaDataAddrEquation*const*const ppEquation = m_equations.FindKey(key);
+
+    if (ppEquation != nullptr)
+    {
+        *pEquation = **ppEquation;
+    }
+
+    return (ppEquation != nullptr);
+}
+
+// =====================================================================================================================
+// Adds a copy of the given equation to the cache.  Failing to do so is harmless; the next mask-ram with the same key
+// will simply have to build the equation itself.
+void MetaEqCache::Insert(
+    const MetaEqCacheKey&       key,
+    const MetaDataAddrEquation& equation)
+{
+    MutexAuto lock(&m_lock);
+
+    bool                   existed    = false;
+    MetaDataAddrEquation** ppEquation = nullptr;
+
+    if ((m_equations.FindAllocate(key, &existed, &ppEquation) == Result::Success) && (existed == false))
+    {
+        *ppEquation = PAL_NEW(MetaDataAddrEquation, m_pPlatform, AllocInternal)(equation);
+
+        if (*ppEquation == nullptr)
+        {
+            m_equations.Erase(key);
+        }
+    }
+}
+
 } // Gfx9
 } // Pal
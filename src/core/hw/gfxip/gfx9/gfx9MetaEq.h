@@ -26,10 +26,14 @@
 #pragma once
 
 #include "pal.h"
+#include "palHashMap.h"
+#include "palMutex.h"
 
 namespace Pal
 {
 
+class Platform;
+
 namespace Gfx9
 {
 class Device;
@@ -256,5 +260,63 @@ private:
     uint32  m_equation[MaxNumMetaDataAddrBits][MetaDataAddrCompNumTypes];
 };
 
+// =====================================================================================================================
+// Every property of a mask-ram which its meta-equation depends on.  Mask-rams on the same device with identical keys
+// build identical equations, up to the final trimming of the equation to the size of the mask-ram.
+struct MetaEqCacheKey
+{
+    uint32  swizzleMode;           // Swizzle mode of the surface the mask-ram describes.
+    uint32  bppLog2;               // Log2 of the bytes per pixel of that surface.
+    uint32  numSamplesLog2;        // Log2 of the number of samples the mask-ram addresses.
+    uint32  metaFlags;             // ADDR2_META_FLAGS of the mask-ram.
+    uint32  metaDataWordSizeLog2;  // Log2 of the size of one mask-ram element, in nibbles.
+    uint32  metaCachelineSize;     // Log2 of the mask-ram's cacheline size.
+    uint32  compBlkSizeLog2[3];    // Log2 of the compressed block width, height and depth.
+    uint32  metaBlkSizeLog2[3];    // Log2 of the meta-block width, height and depth.
+    uint32  metaBlockSize;         // Log2 of the meta-block size in bytes (GFX10 only).
+    uint32  metaBlockExtent[3];    // Log2 of the meta-block width, height and depth in pixels (GFX10 only).
+    union
+    {
+        struct
+        {
+            uint32  isColor        :  1; // The mask-ram is DCC.
+            uint32  isDepth        :  1; // The mask-ram is hTile.
+            uint32  isThick        :  1; // The surface uses a thick (3D) swizzle mode.
+            uint32  hasMips        :  1; // The image has more than one mip level.
+            uint32  isDepthStencil :  1; // The image is a depth/stencil target.
+            uint32  reserved       : 27;
+        };
+        uint32  u32All;
+    } flags;
+};
+
+// =====================================================================================================================
+// Device-level cache of meta-equations.  Building an equation from scratch takes hundreds of bit manipulations, but
+// most applications create many images which share the handful of properties the equation depends on.  The cache
+// holds each unique equation as it was before being trimmed to the size of a particular mask-ram.  Mask-rams copy the
+// equation out of the cache, so entries don't need to outlive them and can be dropped at any time.
+class MetaEqCache
+{
+public:
+    explicit MetaEqCache(Platform* pPlatform);
+    ~MetaEqCache();
+
+    Result Init();
+    void   Reset();
+
+    bool Find(const MetaEqCacheKey& key, MetaDataAddrEquation* pEquation);
+    void Insert(const MetaEqCacheKey& key, const MetaDataAddrEquation& equation);
+
+private:
+    typedef Util::HashMap<MetaEqCacheKey, MetaDataAddrEquation*, Platform, Util::JenkinsHashFunc> EquationMap;
+
+    Platform*const  m_pPlatform;
+    Util::Mutex     m_lock;       // Serializes access to the equation map.
+    EquationMap     m_equations;
+
+    PAL_DISALLOW_DEFAULT_CTOR(MetaEqCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(MetaEqCache);
+};
+
 } // Gfx9
 } // Pal
@@ -29,6 +29,13 @@
 #include "core/hw/gfxip/gfx9/gfx9Pm4Optimizer.h"
 #include "palAutoBuffer.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define PAL_PM4_OPTIMIZER_SSE2 1
+#else
+#define PAL_PM4_OPTIMIZER_SSE2 0
+#endif
+
 using namespace Util;
 
 namespace Pal
@@ -36,14 +43,54 @@ namespace Pal
 namespace Gfx9
 {
 
+// SET_CONTEXT_REG and SET_SH_REG packets store the register offset in the low 16 bits of their second DWORD; the upper
+// bits hold packet controls (e.g., the index field) which must match for two packets to be merged.
+constexpr uint32 SetRegOffsetMask    = 0xFFFF;
+constexpr uint32 SetRegHeaderDwords  = 2;
+
+// The PM4 header count field is 14 bits wide and the maximum value is reserved for one DWORD NOPs.
+constexpr uint32 MaxSetRegPacketRegs = 0x3FFE;
+
+// =====================================================================================================================
+// Returns the must-write flags of the four registers starting at regOffset, packed into the low four bits.
+template <size_t RegisterCount>
+static uint32 GetMustWriteBits(
+    const RegGroupState<RegisterCount>& regState,
+    uint32                              regOffset)
+{
+    const uint32 index = (regOffset >> 5);
+    const uint64 bits  = (static_cast<uint64>(regState.mustWrite[index + 1]) << 32) | regState.mustWrite[index];
+
+    return (static_cast<uint32>(bits >> (regOffset & 31)) & 0xF);
+}
+
+// =====================================================================================================================
+// Returns true if any register in the given range must always be written.
+template <size_t RegisterCount>
+static bool AnyMustWrite(
+    const RegGroupState<RegisterCount>& regState,
+    uint32                              regOffset,
+    uint32                              numRegs)
+{
+    bool anySet = false;
+
+    for (uint32 i = 0; (i < numRegs) && (anySet == false); i += 4)
+    {
+        const uint32 regsLeft = Min(numRegs - i, 4u);
+        anySet = ((GetMustWriteBits(regState, regOffset + i) & ((1u << regsLeft) - 1)) != 0);
+    }
+
+    return anySet;
+}
+
 // =====================================================================================================================
 // Checks the current register state versus the next written value.  Determines whether a new SET command is necessary,
 // and updates the register state. Returns true if the given register value must be written to HW.
 template <size_t RegisterCount>
-static bool UpdateRegState(
+bool Pm4Optimizer::UpdateRegState(
     uint32                        newRegVal,
     uint32                        regOffset,
-    RegGroupState<RegisterCount>* pCurRegState) // [in,out] Current state of register being set, will be updated.
+    RegGroupState<RegisterCount>* pRegState) // [in,out] Current state of register being set, will be updated.
 {
     bool mustKeep = false;
 
@@ -51,48 +98,124 @@ static bool UpdateRegState(
     // - The new value is different than the old value.
     // - The previous state is invalid.
     // - We must always write this register.
-    if ((pCurRegState->state[regOffset].value           != newRegVal) ||
-        (pCurRegState->state[regOffset].flags.valid     == 0)         ||
-        (pCurRegState->state[regOffset].flags.mustWrite == 1))
+    if ((pRegState->value[regOffset] != newRegVal) ||
+        (pRegState->epoch[regOffset] != m_epoch)   ||
+        WideBitfieldIsSet(pRegState->mustWrite, regOffset))
     {
 #if PAL_BUILD_PM4_INSTRUMENTOR
-        pCurRegState->keptSets[regOffset]++;
+        pRegState->keptSets[regOffset]++;
 #endif
 
-        pCurRegState->state[regOffset].flags.valid = 1;
-        pCurRegState->state[regOffset].value       = newRegVal;
+        pRegState->value[regOffset] = newRegVal;
+        pRegState->epoch[regOffset] = m_epoch;
 
         mustKeep = true;
     }
 
 #if PAL_BUILD_PM4_INSTRUMENTOR
-    pCurRegState->totalSets[regOffset]++;
+    pRegState->totalSets[regOffset]++;
 #endif
 
     return mustKeep;
 }
 
+// =====================================================================================================================
+// Runs UpdateRegState() over a sequence of consecutive registers. Returns the number of registers which must be written
+// and sets the corresponding bits in pKeepRegMask for the first 32 registers of the sequence.
+template <size_t RegisterCount>
+uint32 Pm4Optimizer::UpdateRegStateRun(
+    const uint32*                 pNewRegVals,
+    uint32                        regOffset,
+    uint32                        numRegs,
+    RegGroupState<RegisterCount>* pRegState,
+    uint32*                       pKeepRegMask)
+{
+    PAL_ASSERT((regOffset + numRegs) <= RegisterCount);
+
+    uint32 keepRegCount = 0;
+    uint32 keepRegMask  = 0;
+    uint32 i            = 0;
+
+#if PAL_PM4_OPTIMIZER_SSE2 && (PAL_BUILD_PM4_INSTRUMENTOR == 0)
+    // Compare four registers at a time. A register can be skipped if its value is unchanged, it was written in this
+    // epoch and it isn't a must-write register. Every register in the group is valid once we're done.
+    // The four 16-bit epochs are compared in the low half of a register and then widened to match the 32-bit values.
+    const __m128i curEpoch = _mm_set1_epi16(static_cast<int16>(m_epoch));
+
+    for (; (i + 4) <= numRegs; i += 4)
+    {
+        __m128i*const pValues = reinterpret_cast<__m128i*>(&pRegState->value[regOffset + i]);
+        __m128i*const pEpochs = reinterpret_cast<__m128i*>(&pRegState->epoch[regOffset + i]);
+
+        const __m128i newVals   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pNewRegVals + i));
+        const __m128i epochSame = _mm_cmpeq_epi16(curEpoch, _mm_loadl_epi64(pEpochs));
+        const __m128i same      = _mm_and_si128(_mm_cmpeq_epi32(newVals, _mm_loadu_si128(pValues)),
+                                                _mm_unpacklo_epi16(epochSame, epochSame));
+        const uint32  keep    = ((~static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(same)))) & 0xF) |
+                                GetMustWriteBits(*pRegState, regOffset + i);
+
+        _mm_storeu_si128(pValues, newVals);
+        _mm_storel_epi64(pEpochs, curEpoch);
+
+        keepRegCount += CountSetBits(keep);
+
+        if (i < 32)
+        {
+            keepRegMask |= (keep << i);
+        }
+    }
+#endif
+
+    for (; i < numRegs; ++i)
+    {
+        if (UpdateRegState(pNewRegVals[i], (regOffset + i), pRegState))
+        {
+            keepRegCount++;
+
+            if (i < 32)
+            {
+                keepRegMask |= (1u << i);
+            }
+        }
+    }
+
+    *pKeepRegMask = keepRegMask;
+
+    return keepRegCount;
+}
+
+// =====================================================================================================================
+// Marks the given range of registers as invalid so that the next write to each of them will be kept.
+template <size_t RegisterCount>
+void Pm4Optimizer::InvalidateRegs(
+    uint32                        startRegOffset,
+    uint32                        numRegs,
+    RegGroupState<RegisterCount>* pRegState)
+{
+    PAL_ASSERT((startRegOffset + numRegs) <= RegisterCount);
+
+    for (uint32 reg = startRegOffset; reg < (startRegOffset + numRegs); ++reg)
+    {
+        pRegState->epoch[reg] = InvalidEpoch;
+    }
+}
+
 // =====================================================================================================================
 Pm4Optimizer::Pm4Optimizer(
     const Device& device)
     :
     m_device(device),
     m_cmdUtil(device.CmdUtil()),
-    m_waTcCompatZRange(device.WaTcCompatZRange())
+    m_waTcCompatZRange(device.WaTcCompatZRange()),
 #if PAL_ENABLE_PRINTS_ASSERTS
-    , m_dstContainsSrc(false)
+    m_dstContainsSrc(false),
 #endif
+    m_epoch(InvalidEpoch),
+    m_pLastSetPacket(nullptr),
+    m_pLastSetEnd(nullptr)
 {
-    Reset();
-}
-
-// =====================================================================================================================
-// Resets the optimizer so that it's ready to begin optimizing a new command stream. Each time this is called we have
-// to reset all mustWrite flags which is a bit wasteful but we'd rather not add two more big arrays to this class.
-void Pm4Optimizer::Reset()
-{
-    // Reset the context register state.
     memset(&m_cntxRegs, 0, sizeof(m_cntxRegs));
+    memset(&m_shRegs,   0, sizeof(m_shRegs));
 
     // Mark the "vector" context registers as mustWrite. There are some PA registers that require setting the entire
     // vector if any register in the vector needs to change. According to the PA and SC hardware team, these registers
@@ -101,21 +224,21 @@ void Pm4Optimizer::Reset()
     constexpr uint32 VportEnd   = mmPA_CL_VPORT_ZOFFSET_15 - CONTEXT_SPACE_START;
     for (uint32 regOffset = VportStart; regOffset <= VportEnd; ++regOffset)
     {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
+        WideBitfieldSetBit(m_cntxRegs.mustWrite, regOffset);
     }
 
     constexpr uint32 VportScissorStart = mmPA_SC_VPORT_SCISSOR_0_TL - CONTEXT_SPACE_START;
     constexpr uint32 VportScissorEnd   = mmPA_SC_VPORT_ZMAX_15      - CONTEXT_SPACE_START;
     for (uint32 regOffset = VportScissorStart; regOffset <= VportScissorEnd; ++regOffset)
     {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
+        WideBitfieldSetBit(m_cntxRegs.mustWrite, regOffset);
     }
 
     constexpr uint32 GuardbandStart = mmPA_CL_GB_VERT_CLIP_ADJ - CONTEXT_SPACE_START;
     constexpr uint32 GuardbandEnd   = mmPA_CL_GB_HORZ_DISC_ADJ - CONTEXT_SPACE_START;
     for (uint32 regOffset = GuardbandStart; regOffset <= GuardbandEnd; ++regOffset)
     {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
+        WideBitfieldSetBit(m_cntxRegs.mustWrite, regOffset);
     }
 
     // This workaround on gfx9 adds some writes to DB_Z_INFO which are preceded by a COND_EXEC. Make sure we don't
@@ -124,11 +247,35 @@ void Pm4Optimizer::Reset()
     {
         constexpr uint32 dbZInfoIdx = Gfx09::mmDB_Z_INFO - CONTEXT_SPACE_START;
 
-        m_cntxRegs.state[dbZInfoIdx].flags.mustWrite = 1;
+        WideBitfieldSetBit(m_cntxRegs.mustWrite, dbZInfoIdx);
     }
 
-    // Reset the SH register state.
-    memset(&m_shRegs, 0, sizeof(m_shRegs));
+    Reset();
+}
+
+// =====================================================================================================================
+// Resets the optimizer so that it's ready to begin optimizing a new command stream. Rather than clearing the register
+// shadow state we advance the epoch, which invalidates every register in constant time.
+void Pm4Optimizer::Reset()
+{
+    m_epoch++;
+
+    // If the epoch wrapped around, registers written many epochs ago could look valid again. Clear all of the epochs
+    // the slow way; this happens once every 65535 resets.
+    if (m_epoch == InvalidEpoch)
+    {
+        memset(&m_cntxRegs.epoch[0], 0, sizeof(m_cntxRegs.epoch));
+        memset(&m_shRegs.epoch[0],   0, sizeof(m_shRegs.epoch));
+
+        m_epoch = InvalidEpoch + 1;
+    }
+
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    memset(&m_cntxRegs.totalSets[0], 0, sizeof(m_cntxRegs.totalSets));
+    memset(&m_cntxRegs.keptSets[0],  0, sizeof(m_cntxRegs.keptSets));
+    memset(&m_shRegs.totalSets[0],   0, sizeof(m_shRegs.totalSets));
+    memset(&m_shRegs.keptSets[0],    0, sizeof(m_shRegs.keptSets));
+#endif
 
     // Reset the SET_BASE address state
     memset(&m_setBaseStateGfx, 0, sizeof(m_setBaseStateGfx));
@@ -136,6 +283,8 @@ void Pm4Optimizer::Reset()
 
     // Always start with no context rolls
     m_contextRollDetected = false;
+
+    BreakSetRegPacketChain();
 }
 
 // =====================================================================================================================
@@ -182,10 +331,10 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
     // regState value to compute newRegVal. If we tried to do it anyway, the fact that our regMask will have some bits
     // disabled means that we would be setting regState's value to something partially invalid which may cause us to
     // skip needed packets in the future.
-    if (m_cntxRegs.state[regOffset].flags.valid != 0)
+    if (IsRegValid(m_cntxRegs, regOffset))
     {
         // Computed according to the formula stated in the definition of CmdUtil::BuildContextRegRmw.
-        const uint32 newRegVal = (m_cntxRegs.state[regOffset].value & ~regMask) | (regData & regMask);
+        const uint32 newRegVal = (m_cntxRegs.value[regOffset] & ~regMask) | (regData & regMask);
 
         mustKeep = UpdateRegState(newRegVal, regOffset, &m_cntxRegs);
     }
@@ -285,14 +434,11 @@ uint32* Pm4Optimizer::WriteOptimizedSetShShRegOffset(
 {
     // Since this is an indirect write, we do not know the exact SH register data. Invalidate SH register so that
     // the next SH register write will not be skipped inadvertently
-    m_shRegs.state[setShRegOffset.ordinal2.bitfields.reg_offset].flags.valid = 0;
-
     // If the index value is set to 0, this packet actually operates on two sequential SH registers so we need to
     // invalidate the following register as well.
-    if (setShRegOffset.ordinal2.bitfields.index == 0)
-    {
-        m_shRegs.state[setShRegOffset.ordinal2.bitfields.reg_offset + 1].flags.valid = 0;
-    }
+    InvalidateRegs(setShRegOffset.ordinal2.bitfields.reg_offset,
+                   ((setShRegOffset.ordinal2.bitfields.index == 0) ? 2 : 1),
+                   &m_shRegs);
 
     // memcpy packet into command space
     memcpy(pCmdSpace, &setShRegOffset, packetSize << 2);
@@ -321,27 +467,20 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     // We assume that no more than 32 registers are being set. Currently the driver only sets more than 32 registers in
     // the viewport state object. Luckily, those registers are vector regisers so we can't optimize them anyway. If we
     // ever encounter a set command with more than 32 registers that has redundant values the assert below will trigger.
-    uint32 keepRegCount = 0;
-    uint32 keepRegMask  = 0;
-    for (uint32 i = 0; i < numRegs; i++)
-    {
-        if (UpdateRegState(pRegData[i], (regOffset + i), pRegState))
-        {
-            keepRegCount++;
-            keepRegMask |= 1 << i;
-        }
-    }
+    uint32       keepRegMask  = 0;
+    const uint32 keepRegCount = UpdateRegStateRun(pRegData, regOffset, numRegs, pRegState, &keepRegMask);
 
     PAL_ASSERT((keepRegCount == numRegs) || (numRegs <= 32));
 
     if ((keepRegCount == numRegs) || (numRegs > 32))
     {
         // No register writes can be skipped: emit all registers.
-        memcpy(pDstCmd, &setData, setDataSize * sizeof(uint32));
-        pDstCmd += setDataSize;
+        uint32*const pPacket = pDstCmd;
+
+        memcpy(pPacket, &setData, setDataSize * sizeof(uint32));
+        memmove(pPacket + setDataSize, pRegData, numRegs * sizeof(uint32));
 
-        memmove(pDstCmd, pRegData, numRegs * sizeof(uint32));
-        pDstCmd += numRegs;
+        pDstCmd = CoalesceSetRegPacket(pPacket);
     }
     else if (keepRegCount > 0)
     {
@@ -375,11 +514,12 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
                 setData.ordinal1.header.count         = clauseRegCount;
                 setData.ordinal2.bitfields.reg_offset = regOffset + clauseStartIdx;
 
-                memcpy(pDstCmd, &setData, setDataSize * sizeof(uint32));
-                pDstCmd += setDataSize;
+                uint32*const pPacket = pDstCmd;
 
-                memmove(pDstCmd, pRegData + clauseStartIdx, clauseRegCount * sizeof(uint32));
-                pDstCmd += clauseRegCount;
+                memcpy(pPacket, &setData, setDataSize * sizeof(uint32));
+                memmove(pPacket + setDataSize, pRegData + clauseStartIdx, clauseRegCount * sizeof(uint32));
+
+                pDstCmd = CoalesceSetRegPacket(pPacket);
 
 #if PAL_ENABLE_PRINTS_ASSERTS
                 // If we're reading and writing to the same buffer we can't write past the end of this clause's data.
@@ -421,11 +561,7 @@ void Pm4Optimizer::HandlePm4LoadReg(
     while (pRegisterGroup != pNextHeader)
     {
         const uint32& startRegOffset = pRegisterGroup[0];
-        const uint32  endRegOffset   = (startRegOffset + pRegisterGroup[1] - 1);
-        for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
-        {
-            pRegState->state[reg].flags.valid = 0;
-        }
+        InvalidateRegs(startRegOffset, pRegisterGroup[1], pRegState);
 
         pRegisterGroup += 2;
     }
@@ -451,11 +587,7 @@ void Pm4Optimizer::HandlePm4LoadRegIndex(
     {
         const uint32 startRegOffset = *static_cast<const uint16*>(pRegisterGroup);
         const uint32 numRegs        = *static_cast<const uint32*>(VoidPtrInc(pRegisterGroup, sizeof(uint32)));
-        const uint32 endRegOffset   = (startRegOffset + numRegs - 1);
-        for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
-        {
-            pRegState->state[reg].flags.valid = 0;
-        }
+        InvalidateRegs(startRegOffset, numRegs, pRegState);
 
         pRegisterGroup = VoidPtrInc(pRegisterGroup, sizeof(uint32) * 2);
     }
@@ -478,14 +610,11 @@ void Pm4Optimizer::HandlePm4SetShRegOffset(
     const PM4_PFP_SET_SH_REG_OFFSET& setShRegOffset)
 {
     // Invalidate the register the packet is operating on.
-    m_shRegs.state[setShRegOffset.ordinal2.bitfields.reg_offset].flags.valid = 0;
-
     // If the index value is set to 0, this packet actually operates on two sequential SH registers so we need to
     // invalidate the following register as well.
-    if (setShRegOffset.ordinal2.bitfields.index == 0)
-    {
-        m_shRegs.state[setShRegOffset.ordinal2.bitfields.reg_offset + 1].flags.valid = 0;
-    }
+    InvalidateRegs(setShRegOffset.ordinal2.bitfields.reg_offset,
+                   ((setShRegOffset.ordinal2.bitfields.index == 0) ? 2 : 1),
+                   &m_shRegs);
 }
 
 // =====================================================================================================================
@@ -494,13 +623,74 @@ void Pm4Optimizer::HandlePm4SetShRegOffset(
 void Pm4Optimizer::HandlePm4SetContextRegIndirect(
     const PM4_PFP_SET_CONTEXT_REG& setData)
 {
-    const uint32 startRegOffset = static_cast<uint32>(setData.ordinal2.bitfields.reg_offset);
-    const uint32  endRegOffset  = (startRegOffset + (setData.ordinal1.header.count - 1));
+    InvalidateRegs(static_cast<uint32>(setData.ordinal2.bitfields.reg_offset),
+                   setData.ordinal1.header.count,
+                   &m_cntxRegs);
+}
+
+// =====================================================================================================================
+// Called on a SET_CONTEXT_REG, SET_SH_REG or SET_SH_REG_INDEX packet which was just written at pPacket. If the packet
+// is a plain SET_CONTEXT_REG or SET_SH_REG which directly follows the previous SET packet and continues its register
+// range, the two are merged into one packet by dropping this packet's header. Returns a pointer to the next free DWORD
+// after the (possibly merged) packet.
+uint32* Pm4Optimizer::CoalesceSetRegPacket(
+    uint32* pPacket)
+{
+    PM4_PFP_TYPE_3_HEADER header;
+    header.u32All = pPacket[0];
+
+    const uint32 numRegs   = header.count;
+    const uint32 regOffset = (pPacket[1] & SetRegOffsetMask);
+    uint32*      pNextCmd  = pPacket + SetRegHeaderDwords + numRegs;
 
-    for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
+    PAL_ASSERT((header.opcode == IT_SET_CONTEXT_REG) ||
+               (header.opcode == IT_SET_SH_REG)      ||
+               (header.opcode == IT_SET_SH_REG_INDEX));
+
+    // Only plain SET packets are merged. The index variants ask the CP to adjust specific registers (e.g., to apply the
+    // KMD's CU mask) so they are left exactly as they were written. Registers which must always be written may be
+    // guarded by a COND_EXEC which skips a fixed number of DWORDs, so their packets can't be merged either.
+    const bool canMerge = (header.opcode == IT_SET_SH_REG) ||
+                          ((header.opcode == IT_SET_CONTEXT_REG) &&
+                           (AnyMustWrite(m_cntxRegs, regOffset, numRegs) == false));
+
+    bool merged = false;
+
+    if (canMerge && (m_pLastSetPacket != nullptr) && (m_pLastSetEnd == pPacket))
+    {
+        PM4_PFP_TYPE_3_HEADER lastHeader;
+        lastHeader.u32All = m_pLastSetPacket[0];
+
+        const uint32 lastNumRegs   = lastHeader.count;
+        const uint32 lastRegOffset = (m_pLastSetPacket[1] & SetRegOffsetMask);
+
+        // Both packets must be identical apart from their register ranges, which must be contiguous.
+        PM4_PFP_TYPE_3_HEADER cmpHeader = header;
+        cmpHeader.count = lastNumRegs;
+
+        if ((cmpHeader.u32All == lastHeader.u32All)                                         &&
+            ((pPacket[1] & ~SetRegOffsetMask) == (m_pLastSetPacket[1] & ~SetRegOffsetMask)) &&
+            ((lastRegOffset + lastNumRegs) == regOffset)                                    &&
+            ((lastNumRegs + numRegs) <= MaxSetRegPacketRegs))
+        {
+            memmove(pPacket, pPacket + SetRegHeaderDwords, numRegs * sizeof(uint32));
+
+            lastHeader.count    = lastNumRegs + numRegs;
+            m_pLastSetPacket[0] = lastHeader.u32All;
+
+            pNextCmd      = pPacket + numRegs;
+            m_pLastSetEnd = pNextCmd;
+            merged        = true;
+        }
+    }
+
+    if (merged == false)
     {
-        m_cntxRegs.state[reg].flags.valid = 0;
+        m_pLastSetPacket = canMerge ? pPacket  : nullptr;
+        m_pLastSetEnd    = canMerge ? pNextCmd : nullptr;
     }
+
+    return pNextCmd;
 }
 
 // =====================================================================================================================
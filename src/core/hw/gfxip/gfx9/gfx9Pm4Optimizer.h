@@ -37,25 +37,20 @@ namespace Gfx9
 
 class Device;
 
-// Structure used during PM4 optimization to track the current value of a single register.
-struct RegState
-{
-    struct
-    {
-        uint32 valid     :  1;  // This register has been set in this stream, value is valid.
-        uint32 mustWrite :  1;  // All writes to this register must be preserved (can't optimize them out).
-        uint32 reserved  : 30;
-    } flags;
-
-    uint32 value;
-};
-
 // Structure used during PM4 optimization and instrumentation to track the current value of registers as well as the
-// number of times the register was written (via a SET packet) or ignored due to optimization.
+// number of times the register was written (via a SET packet) or ignored due to optimization. The register values and
+// their validity are kept in separate arrays so that runs of consecutive registers can be compared several at a time.
+// A register's value is only valid if its epoch matches the optimizer's current epoch; this lets us invalidate every
+// register in O(1) time by advancing the epoch. Epochs are 16 bits wide so the shadow state is 6 bytes per register,
+// which is smaller than the 8 bytes per register a separate valid flag would take.
 template <size_t RegisterCount>
 struct RegGroupState
 {
-    RegState  state[RegisterCount];     // State of each register in the group.
+    uint32    value[RegisterCount];     // Last value written to each register.
+    uint16    epoch[RegisterCount];     // Epoch in which each register's value was written.
+    uint32    mustWrite[(RegisterCount / 32) + 2]; // Bitfield of registers whose writes must always be preserved. It
+                                                   // is padded by one extra DWORD so that it can be read 64 bits at a
+                                                   // time without bounds checks.
 #if PAL_BUILD_PM4_INSTRUMENTOR
     uint32    totalSets[RegisterCount]; // Number of writes to each register using SET packets.
     uint32    keptSets[RegisterCount];  // Number of writes to each register using SET packets which were not ignored
@@ -79,7 +74,8 @@ using CntxRegState = RegGroupState<CntxRegUsedRangeSize>;
 
 // =====================================================================================================================
 // Utility class which provides routines to optimize PM4 command streams. Currently it only optimizes SH register writes
-// and context register writes.
+// and context register writes. Redundant register writes are removed and SET packets which land back-to-back in the
+// command stream and target consecutive registers are merged into a single packet.
 class Pm4Optimizer
 {
 public:
@@ -87,7 +83,7 @@ public:
 
     void Reset();
 
-    void SetShRegInvalid(uint32 regAddr) { m_shRegs.state[regAddr - PERSISTENT_SPACE_START].flags.valid = 0; }
+    void SetShRegInvalid(uint32 regAddr) { m_shRegs.epoch[regAddr - PERSISTENT_SPACE_START] = InvalidEpoch; }
 
     bool MustKeepSetContextReg(uint32 regAddr, uint32 regData);
     bool MustKeepSetShReg(uint32 regAddr, uint32 regData);
@@ -111,6 +107,14 @@ public:
         size_t                          packetSize,
         uint32*                         pCmdSpace);
 
+    // Takes a SET_CONTEXT_REG or SET_SH_REG packet which was just written at pPacket and merges it into the previous
+    // SET packet if the two are adjacent in the command stream and write consecutive registers. Returns a pointer to
+    // the next unused DWORD after the (possibly merged) packet. SET_SH_REG_INDEX packets are accepted but never merged.
+    uint32* CoalesceSetRegPacket(uint32* pPacket);
+
+    // Must be called whenever the command stream moves to a new chunk; packets can't be merged across chunks.
+    void BreakSetRegPacketChain() { m_pLastSetPacket = nullptr; m_pLastSetEnd = nullptr; }
+
     // These functions take a fully built LOAD_DATA header(s) and will update the state of the optimizer state
     // based on the packet's contents.
     void HandleLoadShRegs(const PM4_ME_LOAD_SH_REG& loadData)
@@ -124,6 +128,27 @@ public:
 #endif
 
 private:
+    // Register epochs are never this value, so it marks a register as invalid in every epoch.
+    static constexpr uint16 InvalidEpoch = 0;
+
+    template <size_t RegisterCount>
+    bool UpdateRegState(uint32 newRegVal, uint32 regOffset, RegGroupState<RegisterCount>* pRegState);
+
+    template <size_t RegisterCount>
+    uint32 UpdateRegStateRun(
+        const uint32*                 pNewRegVals,
+        uint32                        regOffset,
+        uint32                        numRegs,
+        RegGroupState<RegisterCount>* pRegState,
+        uint32*                       pKeepRegMask);
+
+    template <size_t RegisterCount>
+    bool IsRegValid(const RegGroupState<RegisterCount>& regState, uint32 regOffset) const
+        { return (regState.epoch[regOffset] == m_epoch); }
+
+    template <size_t RegisterCount>
+    void InvalidateRegs(uint32 startRegOffset, uint32 numRegs, RegGroupState<RegisterCount>* pRegState);
+
     template <typename SetDataPacket, size_t RegisterCount>
     uint32* OptimizePm4SetReg(
         SetDataPacket                 setData,
@@ -161,6 +186,11 @@ private:
     // Shadow register state for context and SH registers.
     CntxRegState  m_cntxRegs;
     ShRegState    m_shRegs;
+    uint16        m_epoch;  // Registers are only valid if they were written in this epoch.
+
+    // The last SET packet written through the optimizer and the DWORD just past its end, used to merge SET packets.
+    uint32*       m_pLastSetPacket;
+    const uint32* m_pLastSetEnd;
 
     // Base addresses set for SET_BASE
     SetBaseState  m_setBaseStateGfx[MaxSetBaseIndex + 1];
@@ -161,6 +161,7 @@ Result ComputeQueueContext::Init()
 
     if (result == Result::Success)
     {
+        StartupPhase phase(m_pDevice->Parent()->GetPlatform(), "ShaderRings", m_pDevice->Parent()->GetDeviceIndex());
         result = m_ringSet.Init();
     }
 
@@ -610,11 +611,17 @@ UniversalQueueContext::~UniversalQueueContext()
 // Initializes this QueueContext by creating its internal command streams and rebuilding the command streams' contents.
 Result UniversalQueueContext::Init()
 {
-    Result result = m_ringSet.Init();
+    Result result = Result::Success;
 
-    if (result == Result::Success)
     {
-        result = m_tmzRingSet.Init();
+        StartupPhase phase(m_pDevice->Parent()->GetPlatform(), "ShaderRings", m_pDevice->Parent()->GetDeviceIndex());
+
+        result = m_ringSet.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_tmzRingSet.Init();
+        }
     }
 
     if (result == Result::Success)
@@ -42,6 +42,7 @@
 #include "core/g_palPlatformSettings.h"
 #include "core/settingsLoader.h"
 #include "marker_payload.h"
+#include "palCpuProfiler.h"
 #include "palMath.h"
 #include "palIntervalTreeImpl.h"
 #include "palVectorImpl.h"
@@ -1307,15 +1308,20 @@ void UniversalCmdBuffer::CmdSetStencilRefMasks(
 void UniversalCmdBuffer::CmdBarrier(
     const BarrierInfo& barrierInfo)
 {
+    PAL_CMD_BUFFER_ZONE("Gfx9::CmdBarrier");
+
     CmdBuffer::CmdBarrier(barrierInfo);
 
-    // Barriers do not honor predication.
-    const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
-    m_gfxCmdBufState.flags.packetPredicate = 0;
+    if (DeferBarrier(barrierInfo) == false)
+    {
+        // Barriers do not honor predication.
+        const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    m_device.Barrier(this, &m_deCmdStream, barrierInfo);
+        m_device.Barrier(this, &m_deCmdStream, barrierInfo);
 
-    m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+    }
 
 }
 
@@ -1324,6 +1330,8 @@ void UniversalCmdBuffer::CmdRelease(
     const AcquireReleaseInfo& releaseInfo,
     const IGpuEvent*          pGpuEvent)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     CmdBuffer::CmdRelease(releaseInfo, pGpuEvent);
 
     // Barriers do not honor predication.
@@ -1346,6 +1354,8 @@ void UniversalCmdBuffer::CmdAcquire(
     uint32                    gpuEventCount,
     const IGpuEvent*const*    ppGpuEvents)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     CmdBuffer::CmdAcquire(acquireInfo, gpuEventCount, ppGpuEvents);
 
     // Barriers do not honor predication.
@@ -1367,17 +1377,20 @@ void UniversalCmdBuffer::CmdReleaseThenAcquire(
 {
     CmdBuffer::CmdReleaseThenAcquire(barrierInfo);
 
-    // Barriers do not honor predication.
-    const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
-    m_gfxCmdBufState.flags.packetPredicate = 0;
+    if (DeferReleaseThenAcquire(barrierInfo) == false)
+    {
+        // Barriers do not honor predication.
+        const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    // Mark these as traditional barriers in RGP
-    m_device.DescribeBarrierStart(this, barrierInfo.reason, Developer::BarrierType::Full);
-    Developer::BarrierOperations barrierOps = {};
-    m_device.BarrierReleaseThenAcquire(this, &m_deCmdStream, barrierInfo, &barrierOps);
-    m_device.DescribeBarrierEnd(this, &barrierOps);
+        // Mark these as traditional barriers in RGP
+        m_device.DescribeBarrierStart(this, barrierInfo.reason, Developer::BarrierType::Full);
+        Developer::BarrierOperations barrierOps = {};
+        m_device.BarrierReleaseThenAcquire(this, &m_deCmdStream, barrierInfo, &barrierOps);
+        m_device.DescribeBarrierEnd(this, &barrierOps);
 
-    m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+    }
 
 }
 
@@ -1412,6 +1425,8 @@ void UniversalCmdBuffer::CmdSetVertexBuffers(
 void UniversalCmdBuffer::CmdBindTargets(
     const BindTargetParams& params)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     constexpr uint32 AllColorTargetSlotMask = 255; // Mask of all color-target slots.
 
     bool colorTargetsChanged = false;
@@ -1990,6 +2005,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDraw(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     ValidateDrawInfo drawInfo;
     drawInfo.vtxIdxCount   = vertexCount;
     drawInfo.instanceCount = instanceCount;
@@ -2011,6 +2028,11 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDraw(
 
     pDeCmdSpace = pThis->WaitOnCeCounter(pDeCmdSpace);
 
+    if (pThis->HasPendingPatchSlots())
+    {
+        pDeCmdSpace = pThis->WritePatchableDrawState(instanceCount, pDeCmdSpace);
+    }
+
     if (ViewInstancingEnable)
     {
         const auto*const pPipeline          =
@@ -2028,6 +2050,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDraw(
             if (TestAnyFlagSet(mask, 1))
             {
                 pDeCmdSpace  = pThis->BuildWriteViewId(viewInstancingDesc.viewId[i], pDeCmdSpace);
+                pThis->RecordDrawIndexAutoPatches(pDeCmdSpace);
                 pDeCmdSpace += CmdUtil::BuildDrawIndexAuto(vertexCount,
                                                            false,
                                                            pThis->PacketPredicate(),
@@ -2037,6 +2060,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDraw(
     }
     else
     {
+        pThis->RecordDrawIndexAutoPatches(pDeCmdSpace);
         pDeCmdSpace += CmdUtil::BuildDrawIndexAuto(vertexCount, false, pThis->PacketPredicate(), pDeCmdSpace);
     }
 
@@ -2052,6 +2076,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDraw(
     pDeCmdSpace = pThis->IncrementDeCounter(pDeCmdSpace);
 
     pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
+    pThis->ClearPendingPatchSlots();
 
     // On Gfx9, the WD (Work distributor - breaks down draw commands into work groups which are sent to IA
     // units) has changed to having independent DMA and DRAW logic. As a result, DRAW_INDEX_AUTO commands have
@@ -2076,6 +2101,9 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawOpaque(
     uint32      instanceCount)
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     ValidateDrawInfo drawInfo;
     drawInfo.vtxIdxCount   = 0;
@@ -2184,6 +2212,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     // The "validIndexCount" (set later in the code) will eventually be used to program the max_size
     // field in the draw packet, which is used to clamp how much of the index buffer can be read.
     //
@@ -2217,6 +2247,11 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
 
     pDeCmdSpace = pThis->WaitOnCeCounter(pDeCmdSpace);
 
+    if (pThis->HasPendingPatchSlots())
+    {
+        pDeCmdSpace = pThis->WritePatchableDrawState(instanceCount, pDeCmdSpace);
+    }
+
     if (ViewInstancingEnable)
     {
         const Pal::PipelineState* pPipelineState     = pThis->PipelineState(PipelineBindPoint::Graphics);
@@ -2239,6 +2274,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
                 {
                     // If IB state is not bound, nested command buffers must use DRAW_INDEX_OFFSET_2 so that
                     // we can inherit th IB base and size from direct command buffer
+                    pThis->RecordDrawIndexOffset2Patches(pDeCmdSpace);
                     pDeCmdSpace += CmdUtil::BuildDrawIndexOffset2(indexCount,
                                                                   validIndexCount,
                                                                   firstIndex,
@@ -2252,6 +2288,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
                     const uint32  indexSize   = 1 << static_cast<uint32>(pThis->m_graphicsState.iaState.indexType);
                     const gpusize gpuVirtAddr = pThis->m_graphicsState.iaState.indexAddr + (indexSize * firstIndex);
 
+                    pThis->RecordDrawIndex2Patches(pDeCmdSpace, (indexSize * firstIndex));
                     pDeCmdSpace += CmdUtil::BuildDrawIndex2(indexCount,
                                                             validIndexCount,
                                                             gpuVirtAddr,
@@ -2267,6 +2304,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
         {
             // If IB state is not bound, nested command buffers must use DRAW_INDEX_OFFSET_2 so that
             // we can inherit th IB base and size from direct command buffer
+            pThis->RecordDrawIndexOffset2Patches(pDeCmdSpace);
             pDeCmdSpace += CmdUtil::BuildDrawIndexOffset2(indexCount,
                                                           validIndexCount,
                                                           firstIndex,
@@ -2280,6 +2318,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
             const uint32  indexSize   = 1 << static_cast<uint32>(pThis->m_graphicsState.iaState.indexType);
             const gpusize gpuVirtAddr = pThis->m_graphicsState.iaState.indexAddr + (indexSize * firstIndex);
 
+            pThis->RecordDrawIndex2Patches(pDeCmdSpace, (indexSize * firstIndex));
             pDeCmdSpace += CmdUtil::BuildDrawIndex2(indexCount,
                                                     validIndexCount,
                                                     gpuVirtAddr,
@@ -2300,7 +2339,207 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
     pDeCmdSpace  = pThis->IncrementDeCounter(pDeCmdSpace);
 
     pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
+    pThis->ClearPendingPatchSlots();
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+// Issues a batch of non-indexed draws which share all state except for a per-draw user-data delta. Only the first draw
+// goes through full draw-time validation; the rest only revalidate their user-data and draw arguments.
+template <bool IssueSqttMarkerEvent,
+          bool HasUavExport,
+          bool ViewInstancingEnable,
+          bool DescribeDrawDispatch>
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawMulti(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
+
+    PAL_ASSERT((drawCount == 0) || (pDraws != nullptr));
+
+    if (ViewInstancingEnable || DescribeDrawDispatch || pThis->m_cachedSettings.disableWdLoadBalancing)
+    {
+        // View instancing expands every draw into one packet per view, DescribeDraw must be reported per draw and
+        // IA_MULTI_VGT_PARAM depends on the draw arguments when WD load balancing is disabled. None of these can share
+        // validation across the batch, so just issue the draws one at a time.
+        Pal::UniversalCmdBuffer::CmdDrawMulti(pCmdBuffer, drawCount, pDraws);
+    }
+    else
+    {
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            const MultiDrawInfo& draw = pDraws[i];
+
+            if (draw.entryCount != 0)
+            {
+                pThis->CmdSetUserData(PipelineBindPoint::Graphics,
+                                      draw.firstEntry,
+                                      draw.entryCount,
+                                      draw.pEntryValues);
+            }
+
+            ValidateDrawInfo drawInfo;
+            drawInfo.vtxIdxCount   = draw.vertexCount;
+            drawInfo.instanceCount = draw.instanceCount;
+            drawInfo.firstVertex   = draw.firstVertex;
+            drawInfo.firstInstance = draw.firstInstance;
+            drawInfo.firstIndex    = 0;
+            drawInfo.useOpaque     = false;
+
+            uint32* pDeCmdSpace = nullptr;
+
+            if (i == 0)
+            {
+                pThis->ValidateDraw<false, false>(drawInfo);
+
+                pDeCmdSpace = pThis->m_deCmdStream.ReserveCommands();
+            }
+            else
+            {
+                pDeCmdSpace = pThis->m_deCmdStream.ReserveCommands();
+                pDeCmdSpace = pThis->ValidateBatchedDraw(drawInfo, pDeCmdSpace);
+            }
+
+            pDeCmdSpace  = pThis->WaitOnCeCounter(pDeCmdSpace);
+            pDeCmdSpace += CmdUtil::BuildDrawIndexAuto(draw.vertexCount, false, pThis->PacketPredicate(), pDeCmdSpace);
+
+            if (IssueSqttMarkerEvent)
+            {
+                pDeCmdSpace += CmdUtil::BuildNonSampleEventWrite(THREAD_TRACE_MARKER, EngineTypeUniversal, pDeCmdSpace);
+            }
+            if (HasUavExport)
+            {
+                pDeCmdSpace += CmdUtil::BuildNonSampleEventWrite(PS_PARTIAL_FLUSH, EngineTypeUniversal, pDeCmdSpace);
+            }
+
+            pDeCmdSpace = pThis->IncrementDeCounter(pDeCmdSpace);
+
+            pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
+        }
+
+        // See CmdDraw(): DRAW_INDEX_AUTO clobbers VGT_INDEX_TYPE so it must be rewritten before the next indexed draw.
+        pThis->m_drawTimeHwState.dirty.indexedIndexType = 1;
+    }
+}
+
+// =====================================================================================================================
+// Issues a batch of indexed draws which share all state except for a per-draw user-data delta. Only the first draw goes
+// through full draw-time validation; the rest only revalidate their user-data and draw arguments.
+template <bool IssueSqttMarkerEvent,
+          bool HasUavExport,
+          bool ViewInstancingEnable,
+          bool DescribeDrawDispatch>
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
+
+    PAL_ASSERT((drawCount == 0) || (pDraws != nullptr));
+
+    if (ViewInstancingEnable                          ||
+        DescribeDrawDispatch                          ||
+        pThis->m_cachedSettings.disableWdLoadBalancing ||
+        pThis->m_cachedSettings.prefetchIndexBufferForNgg)
+    {
+        // In addition to the non-indexed cases (see CmdDrawMulti()), the NGG index buffer prefetch depends on each
+        // draw's index range so it also requires full validation of every draw.
+        Pal::UniversalCmdBuffer::CmdDrawIndexedMulti(pCmdBuffer, drawCount, pDraws);
+    }
+    else
+    {
+        const bool useIndexOffset = (pThis->IsNested() && (pThis->m_graphicsState.iaState.indexAddr == 0));
+
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            const MultiDrawIndexedInfo& draw = pDraws[i];
+
+            if (draw.entryCount != 0)
+            {
+                pThis->CmdSetUserData(PipelineBindPoint::Graphics,
+                                      draw.firstEntry,
+                                      draw.entryCount,
+                                      draw.pEntryValues);
+            }
+
+            // See CmdDrawIndexed() for why firstIndex must be clamped.
+            uint32 firstIndex = draw.firstIndex;
+            pThis->m_workaroundState.HandleFirstIndexSmallerThanIndexCount(&firstIndex,
+                                                                           pThis->m_graphicsState.iaState.indexCount);
+
+            PAL_ASSERT(firstIndex <= pThis->m_graphicsState.iaState.indexCount);
+
+            ValidateDrawInfo drawInfo;
+            drawInfo.vtxIdxCount   = draw.indexCount;
+            drawInfo.instanceCount = draw.instanceCount;
+            drawInfo.firstVertex   = draw.vertexOffset;
+            drawInfo.firstInstance = draw.firstInstance;
+            drawInfo.firstIndex    = firstIndex;
+            drawInfo.useOpaque     = false;
+
+            uint32* pDeCmdSpace = nullptr;
+
+            if (i == 0)
+            {
+                pThis->ValidateDraw<true, false>(drawInfo);
+
+                pDeCmdSpace = pThis->m_deCmdStream.ReserveCommands();
+            }
+            else
+            {
+                pDeCmdSpace = pThis->m_deCmdStream.ReserveCommands();
+                pDeCmdSpace = pThis->ValidateBatchedDraw(drawInfo, pDeCmdSpace);
+            }
+
+            const uint32 validIndexCount = pThis->m_graphicsState.iaState.indexCount - firstIndex;
+
+            pDeCmdSpace = pThis->WaitOnCeCounter(pDeCmdSpace);
+
+            if (useIndexOffset)
+            {
+                pDeCmdSpace += CmdUtil::BuildDrawIndexOffset2(draw.indexCount,
+                                                              validIndexCount,
+                                                              firstIndex,
+                                                              pThis->PacketPredicate(),
+                                                              pDeCmdSpace);
+            }
+            else
+            {
+                const uint32  indexSize   = 1 << static_cast<uint32>(pThis->m_graphicsState.iaState.indexType);
+                const gpusize gpuVirtAddr = pThis->m_graphicsState.iaState.indexAddr + (indexSize * firstIndex);
+
+                pDeCmdSpace += CmdUtil::BuildDrawIndex2(draw.indexCount,
+                                                        validIndexCount,
+                                                        gpuVirtAddr,
+                                                        pThis->PacketPredicate(),
+                                                        pDeCmdSpace);
+            }
+
+            if (IssueSqttMarkerEvent)
+            {
+                pDeCmdSpace += CmdUtil::BuildNonSampleEventWrite(THREAD_TRACE_MARKER, EngineTypeUniversal, pDeCmdSpace);
+            }
+            if (HasUavExport)
+            {
+                pDeCmdSpace += CmdUtil::BuildNonSampleEventWrite(PS_PARTIAL_FLUSH, EngineTypeUniversal, pDeCmdSpace);
+            }
+
+            pDeCmdSpace = pThis->IncrementDeCounter(pDeCmdSpace);
+
+            pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
+        }
+    }
 }
+#endif
 
 // =====================================================================================================================
 // Issues an indirect non-indexed draw command. We must discard the draw if vertexCount or instanceCount are zero.
@@ -2315,6 +2554,9 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndirectMulti(
     gpusize           countGpuAddr)
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     PAL_ASSERT(IsPow2Aligned(offset, sizeof(uint32)) && IsPow2Aligned(countGpuAddr, sizeof(uint32)));
     PAL_ASSERT((countGpuAddr != 0) ||
@@ -2424,6 +2666,9 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedIndirectMulti(
     gpusize           countGpuAddr)
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     PAL_ASSERT(IsPow2Aligned(offset, sizeof(uint32)) && IsPow2Aligned(countGpuAddr, sizeof(uint32)));
     PAL_ASSERT((countGpuAddr != 0) ||
@@ -2532,6 +2777,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatch(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     if (DescribeDrawDispatch)
     {
         pThis->m_device.DescribeDispatch(pThis, Developer::DrawDispatchType::CmdDispatch, 0, 0, 0, x, y, z);
@@ -2539,9 +2786,20 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatch(
 
     pThis->ValidateDispatch(&pThis->m_computeState, &pThis->m_deCmdStream, 0uLL, x, y, z);
 
+    if (pThis->m_pSignatureCs->numWorkGroupsRegAddr != UserDataNotMapped)
+    {
+        pThis->RejectDispatchSizePatchSlots();
+    }
+
     uint32* pDeCmdSpace = pThis->m_deCmdStream.ReserveCommands();
     pDeCmdSpace  = pThis->WaitOnCeCounter(pDeCmdSpace);
 
+    if (pThis->HasPendingPatchSlots())
+    {
+        pDeCmdSpace = pThis->WritePatchableUserData(PipelineBindPoint::Compute, pDeCmdSpace);
+        pThis->RecordDispatchDirectPatches(pDeCmdSpace);
+    }
+
     pDeCmdSpace += pThis->m_cmdUtil.BuildDispatchDirect<false, true>(x, y, z,
                                                                      pThis->PacketPredicate(),
                                                                      pThis->m_pSignatureCs->flags.isWave32,
@@ -2557,6 +2815,7 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatch(
     pDeCmdSpace = pThis->IncrementDeCounter(pDeCmdSpace);
 
     pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
+    pThis->ClearPendingPatchSlots();
 }
 
 // =====================================================================================================================
@@ -2569,6 +2828,9 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatchIndirect(
     gpusize           offset)
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     if (DescribeDrawDispatch)
     {
@@ -2619,6 +2881,9 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatchOffset(
     uint32      zDim)
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+    pThis->RejectPendingPatchSlots();
+
+    pThis->FlushDeferredBarriers();
 
     if (DescribeDrawDispatch)
     {
@@ -2666,6 +2931,8 @@ void UniversalCmdBuffer::CmdCloneImageData(
     const IImage& srcImage,
     const IImage& dstImage)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdCloneImageData(this, GetGfx9Image(srcImage), GetGfx9Image(dstImage));
 }
 
@@ -2676,6 +2943,8 @@ void UniversalCmdBuffer::CmdCopyMemory(
     uint32                  regionCount,
     const MemoryCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdCopyMemory(this,
                                          static_cast<const GpuMemory&>(srcGpuMemory),
                                          static_cast<const GpuMemory&>(dstGpuMemory),
@@ -2690,6 +2959,8 @@ void UniversalCmdBuffer::CmdUpdateMemory(
     gpusize           dataSize,
     const uint32*     pData)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pData != nullptr);
     m_device.RsrcProcMgr().CmdUpdateMemory(this,
                                            static_cast<const GpuMemory&>(dstGpuMemory),
@@ -2704,6 +2975,8 @@ void UniversalCmdBuffer::CmdUpdateBusAddressableMemoryMarker(
     gpusize           offset,
     uint32            value)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&dstGpuMemory);
     WriteDataInfo    writeData  = {};
 
@@ -2725,6 +2998,8 @@ void UniversalCmdBuffer::CmdMemoryAtomic(
     uint64            srcData,
     AtomicOp          atomicOp)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const gpusize address = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -2740,6 +3015,8 @@ void UniversalCmdBuffer::CmdWriteTimestamp(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const gpusize address = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -2781,6 +3058,8 @@ void UniversalCmdBuffer::CmdWriteImmediate(
     ImmediateDataWidth dataSize,
     gpusize            address)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     if (pipePoint == HwPipeTop)
@@ -3387,6 +3666,8 @@ void UniversalCmdBuffer::WriteEventCmd(
     HwPipePoint           pipePoint,
     uint32                data)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const EngineType  engineType = GetEngineType();
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -3985,6 +4266,8 @@ template <bool Indexed, bool Indirect>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)      // Draw info
 {
+    PAL_CPU_ZONE("Gfx9::ValidateDraw");
+
     if (m_deCmdStream.Pm4OptimizerEnabled())
     {
         ValidateDraw<Indexed, Indirect, true>(drawInfo);
@@ -5817,46 +6100,182 @@ uint32* UniversalCmdBuffer::ValidateDrawTimeHwState(
     }
     else
     {
-        const uint16 vertexOffsetRegAddr = GetVertexOffsetRegAddr();
-        // Write the vertex offset user data register.
-        if (((m_drawTimeHwState.vertexOffset != drawInfo.firstVertex) ||
-            (m_drawTimeHwState.valid.vertexOffset == 0)) &&
-            (vertexOffsetRegAddr != UserDataNotMapped))
-        {
-            m_drawTimeHwState.vertexOffset       = drawInfo.firstVertex;
-            m_drawTimeHwState.valid.vertexOffset = 1;
+        pDeCmdSpace = ValidateDirectDrawArgs<Pm4OptImmediate>(drawInfo, pDeCmdSpace);
+    }
 
-            pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderGraphics, Pm4OptImmediate>(vertexOffsetRegAddr,
-                                                                                          drawInfo.firstVertex,
-                                                                                          pDeCmdSpace);
-        }
+    return pDeCmdSpace;
+}
 
-        // Write the instance offset user data register.
-        if (((m_drawTimeHwState.instanceOffset != drawInfo.firstInstance) ||
-            (m_drawTimeHwState.valid.instanceOffset == 0)) &&
-            (vertexOffsetRegAddr != UserDataNotMapped))
-        {
-            m_drawTimeHwState.instanceOffset       = drawInfo.firstInstance;
-            m_drawTimeHwState.valid.instanceOffset = 1;
+// =====================================================================================================================
+// Writes the vertex offset, instance offset and instance count of a direct draw if they differ from the values last
+// written. Returns the next unused DWORD in pDeCmdSpace.
+template <bool Pm4OptImmediate>
+uint32* UniversalCmdBuffer::ValidateDirectDrawArgs(
+    const ValidateDrawInfo& drawInfo,     // Draw info
+    uint32*                 pDeCmdSpace)  // Write new draw-engine commands here.
+{
+    const uint16 vertexOffsetRegAddr = GetVertexOffsetRegAddr();
+    // Write the vertex offset user data register.
+    if (((m_drawTimeHwState.vertexOffset != drawInfo.firstVertex) ||
+        (m_drawTimeHwState.valid.vertexOffset == 0)) &&
+        (vertexOffsetRegAddr != UserDataNotMapped))
+    {
+        m_drawTimeHwState.vertexOffset       = drawInfo.firstVertex;
+        m_drawTimeHwState.valid.vertexOffset = 1;
 
-            pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderGraphics, Pm4OptImmediate>(vertexOffsetRegAddr + 1,
-                                                                                          drawInfo.firstInstance,
-                                                                                          pDeCmdSpace);
-        }
+        pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderGraphics, Pm4OptImmediate>(vertexOffsetRegAddr,
+                                                                                      drawInfo.firstVertex,
+                                                                                      pDeCmdSpace);
+    }
+
+    // Write the instance offset user data register.
+    if (((m_drawTimeHwState.instanceOffset != drawInfo.firstInstance) ||
+        (m_drawTimeHwState.valid.instanceOffset == 0)) &&
+        (vertexOffsetRegAddr != UserDataNotMapped))
+    {
+        m_drawTimeHwState.instanceOffset       = drawInfo.firstInstance;
+        m_drawTimeHwState.valid.instanceOffset = 1;
+
+        pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderGraphics, Pm4OptImmediate>(vertexOffsetRegAddr + 1,
+                                                                                      drawInfo.firstInstance,
+                                                                                      pDeCmdSpace);
+    }
+
+    // Write the NUM_INSTANCES packet.
+    if ((m_drawTimeHwState.numInstances != drawInfo.instanceCount) || (m_drawTimeHwState.valid.numInstances == 0))
+    {
+        m_drawTimeHwState.numInstances       = drawInfo.instanceCount;
+        m_drawTimeHwState.valid.numInstances = 1;
+
+        pDeCmdSpace += CmdUtil::BuildNumInstances(drawInfo.instanceCount, pDeCmdSpace);
+    }
 
-        // Write the NUM_INSTANCES packet.
-        if ((m_drawTimeHwState.numInstances != drawInfo.instanceCount) || (m_drawTimeHwState.valid.numInstances == 0))
+    return pDeCmdSpace;
+}
+
+// =====================================================================================================================
+// Writes the draw state which pending command buffer template patch slots need in packets of their own: the patchable
+// graphics user-data entries and, if the instance count is patchable, NUM_INSTANCES. Returns the next unused DWORD in
+// pDeCmdSpace.
+uint32* UniversalCmdBuffer::WritePatchableDrawState(
+    uint32  instanceCount,
+    uint32* pDeCmdSpace)
+{
+    pDeCmdSpace = WritePatchableUserData(PipelineBindPoint::Graphics, pDeCmdSpace);
+
+    if (HasPendingPatchSlot(CmdPatchSlotType::InstanceCount))
+    {
+        // ValidateDraw skips NUM_INSTANCES when it is redundant, so write it again where it can be patched.
+        RecordPatchLocations(CmdPatchSlotType::InstanceCount,
+                             &m_deCmdStream,
+                             (pDeCmdSpace + CmdUtil::NumInstancesCountOffset),
+                             1,
+                             0);
+        pDeCmdSpace += CmdUtil::BuildNumInstances(instanceCount, pDeCmdSpace);
+
+        // The patched value can differ from the recorded one, so the next draw must write NUM_INSTANCES itself.
+        m_drawTimeHwState.valid.numInstances = 0;
+    }
+
+    return pDeCmdSpace;
+}
+
+// =====================================================================================================================
+// Rewrites the user-SGPRs of every user-data entry with a pending UserData patch slot for the given bind point so that
+// each value lives in a packet which can be patched. Returns the next unused DWORD in pDeCmdSpace.
+uint32* UniversalCmdBuffer::WritePatchableUserData(
+    PipelineBindPoint bindPoint,
+    uint32*           pDeCmdSpace)
+{
+    for (uint32 idx = 0; idx < NumPendingPatchSlots(); ++idx)
+    {
+        const CmdPatchSlotInfo& slot = PendingPatchSlot(idx);
+
+        if ((slot.type == CmdPatchSlotType::UserData) && (slot.bindPoint == bindPoint))
         {
-            m_drawTimeHwState.numInstances       = drawInfo.instanceCount;
-            m_drawTimeHwState.valid.numInstances = 1;
+            PAL_ASSERT(slot.userDataEntry < MaxUserDataEntries);
+            const uint32*const pPrevCmdSpace = pDeCmdSpace;
+
+            if (bindPoint == PipelineBindPoint::Graphics)
+            {
+                const uint32 value = m_graphicsState.gfxUserDataEntries.entries[slot.userDataEntry];
 
-            pDeCmdSpace += CmdUtil::BuildNumInstances(drawInfo.instanceCount, pDeCmdSpace);
+                for (uint32 stage = 0; stage < NumHwShaderStagesGfx; ++stage)
+                {
+                    pDeCmdSpace = m_deCmdStream.WritePatchableUserDataEntry<ShaderGraphics>(
+                                        m_pSignatureGfx->stage[stage],
+                                        slot.userDataEntry,
+                                        value,
+                                        slot.slotId,
+                                        pDeCmdSpace);
+                }
+            }
+            else
+            {
+                pDeCmdSpace = m_deCmdStream.WritePatchableUserDataEntry<ShaderCompute>(
+                                    m_pSignatureCs->stage,
+                                    slot.userDataEntry,
+                                    m_computeState.csUserDataEntries.entries[slot.userDataEntry],
+                                    slot.slotId,
+                                    pDeCmdSpace);
+            }
+
+            // Spilled user-data entries live in embedded data which templates can't patch.
+            PAL_ALERT(pDeCmdSpace == pPrevCmdSpace);
         }
     }
 
     return pDeCmdSpace;
 }
 
+// =====================================================================================================================
+// Performs the reduced draw-time validation needed by every draw after the first in a CmdDrawMulti() or
+// CmdDrawIndexedMulti() batch. Returns the next unused DWORD in pDeCmdSpace. Wrapper to determine if immediate mode
+// pm4 optimization is enabled before calling the real ValidateBatchedDraw() function.
+uint32* UniversalCmdBuffer::ValidateBatchedDraw(
+    const ValidateDrawInfo& drawInfo,     // Draw info
+    uint32*                 pDeCmdSpace)  // Write new draw-engine commands here.
+{
+    return m_deCmdStream.Pm4OptimizerEnabled() ? ValidateBatchedDraw<true>(drawInfo, pDeCmdSpace)
+                                               : ValidateBatchedDraw<false>(drawInfo, pDeCmdSpace);
+}
+
+// =====================================================================================================================
+// The first draw of a batch went through the full ValidateDraw() path, which cleared all dirty state. The only things
+// which can change between the draws of a batch are the user-data entries and the draw arguments themselves, so those
+// are all we revalidate here. Returns the next unused DWORD in pDeCmdSpace.
+template <bool Pm4OptImmediate>
+uint32* UniversalCmdBuffer::ValidateBatchedDraw(
+    const ValidateDrawInfo& drawInfo,     // Draw info
+    uint32*                 pDeCmdSpace)  // Write new draw-engine commands here.
+{
+    PAL_ASSERT((m_graphicsState.dirtyFlags.u32All == 0) && (m_graphicsState.pipelineState.dirtyFlags.u32All == 0));
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    m_pipelineStateValid = true;
+#endif
+
+    pDeCmdSpace = (this->*m_pfnValidateUserDataGfx)(nullptr, pDeCmdSpace);
+    pDeCmdSpace = ValidateDirectDrawArgs<Pm4OptImmediate>(drawInfo, pDeCmdSpace);
+    pDeCmdSpace = m_workaroundState.PreDraw<false, false, Pm4OptImmediate>(m_graphicsState,
+                                                                           &m_deCmdStream,
+                                                                           this,
+                                                                           pDeCmdSpace);
+
+    if (IsNggEnabled() && (m_pSignatureGfx->nggCullingDataAddr != UserDataNotMapped))
+    {
+        pDeCmdSpace = UpdateNggCullingDataBufferWithCpu(pDeCmdSpace);
+    }
+
+    m_deCmdStream.ResetDrawTimeState();
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    m_pipelineStateValid = false;
+#endif
+
+    return pDeCmdSpace;
+}
+
 // =====================================================================================================================
 // Performs dispatch-time dirty state validation.
 void UniversalCmdBuffer::ValidateDispatch(
@@ -6045,6 +6464,8 @@ void UniversalCmdBuffer::RemoveQuery(
 void UniversalCmdBuffer::CmdLoadBufferFilledSizes(
     const gpusize (&gpuVirtAddr)[MaxStreamOutTargets])
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     for (uint32 idx = 0; idx < MaxStreamOutTargets; ++idx)
@@ -6068,6 +6489,8 @@ void UniversalCmdBuffer::CmdLoadBufferFilledSizes(
 void UniversalCmdBuffer::CmdSaveBufferFilledSizes(
     const gpusize (&gpuVirtAddr)[MaxStreamOutTargets])
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     // The VGT's internal stream output state needs to be flushed before writing the buffer filled size counters
@@ -6095,6 +6518,8 @@ void UniversalCmdBuffer::CmdSetBufferFilledSize(
     uint32  bufferId,
     uint32  offset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
     PAL_ASSERT(bufferId < MaxStreamOutTargets);
 
@@ -6115,6 +6540,8 @@ void UniversalCmdBuffer::CmdBeginQuery(
     uint32            slot,
     QueryControlFlags flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).Begin(this, &m_deCmdStream, queryType, slot, flags);
 }
 
@@ -6124,6 +6551,8 @@ void UniversalCmdBuffer::CmdEndQuery(
     QueryType         queryType,
     uint32            slot)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).End(this, &m_deCmdStream, queryType, slot);
 }
 
@@ -6138,6 +6567,8 @@ void UniversalCmdBuffer::CmdResolveQuery(
     gpusize           dstOffset,
     gpusize           dstStride)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Resolving a query is not supposed to honor predication.
     const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
     m_gfxCmdBufState.flags.packetPredicate = 0;
@@ -6161,6 +6592,8 @@ void UniversalCmdBuffer::CmdResetQueryPool(
     uint32            startQuery,
     uint32            queryCount)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     static_cast<const QueryPool&>(queryPool).Reset(this, &m_deCmdStream, startQuery, queryCount);
 }
 
@@ -6606,6 +7039,8 @@ void UniversalCmdBuffer::CmdLoadCeRam(
     uint32            ramOffset,        // CE RAM offset, must be 32-byte aligned
     uint32            dwordSize)        // Number of DWORDs to load, must be a multiple of 8
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     pCeCmdSpace += CmdUtil::BuildLoadConstRam(srcGpuMemory.Desc().gpuVirtAddr + memOffset,
                                               ramOffset,
@@ -6624,6 +7059,8 @@ void UniversalCmdBuffer::CmdDumpCeRam(
     uint32            currRingPos,
     uint32            ringSize)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     HandleCeRinging(&m_state, currRingPos, 1, ringSize);
 
@@ -6652,6 +7089,8 @@ void UniversalCmdBuffer::CmdWriteCeRam(
     uint32      ramOffset,      // CE RAM byte offset, must be 4-byte aligned
     uint32      dwordSize)      // Number of DWORDs to write from pSrcData
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     pCeCmdSpace += CmdUtil::BuildWriteConstRam(pSrcData, ramOffset, dwordSize, pCeCmdSpace);
     m_ceCmdStream.CommitCommands(pCeCmdSpace);
@@ -6665,6 +7104,8 @@ void UniversalCmdBuffer::CmdIf(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -6674,6 +7115,8 @@ void UniversalCmdBuffer::CmdIf(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdElse()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -6683,6 +7126,8 @@ void UniversalCmdBuffer::CmdElse()
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdEndIf()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -6697,6 +7142,8 @@ void UniversalCmdBuffer::CmdWhile(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -6706,6 +7153,8 @@ void UniversalCmdBuffer::CmdWhile(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdEndWhile()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -6790,6 +7239,8 @@ void UniversalCmdBuffer::CmdWaitRegisterValue(
     uint32      mask,
     CompareFunc compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     pCmdSpace += CmdUtil::BuildWaitRegMem(EngineTypeUniversal,
@@ -6812,6 +7263,8 @@ void UniversalCmdBuffer::CmdWaitMemoryValue(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     pCmdSpace += CmdUtil::BuildWaitRegMem(EngineTypeUniversal,
@@ -6833,6 +7286,8 @@ void UniversalCmdBuffer::CmdWaitBusAddressableMemoryMarker(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&gpuMemory);
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
@@ -6855,6 +7310,8 @@ void UniversalCmdBuffer::CmdUpdateHiSPretests(
     uint32             firstMip,
     uint32             numMips)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     Image* pGfx9Image = static_cast<Image*>(static_cast<const Pal::Image*>(pImage)->GetGfxImage());
 
     if (pGfx9Image->HasHiSPretestsMetaData())
@@ -6921,6 +7378,8 @@ void UniversalCmdBuffer::CmdSetPredication(
     bool                waitResults,
     bool                accumulateData)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT((pQueryPool == nullptr) || (pGpuMemory == nullptr));
     PAL_ASSERT(
         (predType != PredicateType::Boolean32) ||
@@ -6966,6 +7425,8 @@ void UniversalCmdBuffer::CmdCopyRegisterToMemory(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     DmaDataInfo dmaData = {};
@@ -6990,6 +7451,8 @@ void UniversalCmdBuffer::CmdExecuteIndirectCmds(
     uint32                       maximumCount,
     gpusize                      countGpuAddr)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // It is only safe to generate indirect commands on a one-time-submit or exclusive-submit command buffer because
     // there is a potential race condition on the memory used to receive the generated commands.
     PAL_ASSERT(IsOneTimeSubmit() || IsExclusiveSubmit());
@@ -7298,6 +7761,10 @@ void UniversalCmdBuffer::LeakNestedCmdBufferState(
         m_funcTable.pfnCmdDraw                      = cmdBuffer.m_funcTable.pfnCmdDraw;
         m_funcTable.pfnCmdDrawOpaque                = cmdBuffer.m_funcTable.pfnCmdDrawOpaque;
         m_funcTable.pfnCmdDrawIndexed               = cmdBuffer.m_funcTable.pfnCmdDrawIndexed;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+        m_funcTable.pfnCmdDrawMulti                 = cmdBuffer.m_funcTable.pfnCmdDrawMulti;
+        m_funcTable.pfnCmdDrawIndexedMulti          = cmdBuffer.m_funcTable.pfnCmdDrawIndexedMulti;
+#endif
         m_funcTable.pfnCmdDrawIndirectMulti         = cmdBuffer.m_funcTable.pfnCmdDrawIndirectMulti;
         m_funcTable.pfnCmdDrawIndexedIndirectMulti  = cmdBuffer.m_funcTable.pfnCmdDrawIndexedIndirectMulti;
 
@@ -7522,14 +7989,15 @@ void UniversalCmdBuffer::CmdSetClipRects(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdXdmaWaitFlipPending()
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     // Note that we only have an auto-generated version of this register for Vega 12 but it should exist on all ASICs.
     CmdWaitRegisterValue(Vg12::mmXDMA_SLV_FLIP_PENDING, 0, 0x00000001, CompareFunc::Equal);
 }
 
 // =====================================================================================================================
-void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
-    uint32            cmdBufferCount,
-    ICmdBuffer*const* ppCmdBuffers)
+// Validates the caller's state which a nested command buffer is about to inherit.
+void UniversalCmdBuffer::ValidateNestedCmdBufferCall()
 {
     // Need to validate some state as it is valid for root CmdBuf to set state, not issue a draw and expect
     // that state to inherit into the nested CmdBuf. It might be safest to just ValidateDraw here eventually.
@@ -7558,6 +8026,16 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         }
     }
     m_deCmdStream.CommitCommands(pDeCmdSpace);
+}
+
+// =====================================================================================================================
+void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
+    uint32            cmdBufferCount,
+    ICmdBuffer*const* ppCmdBuffers)
+{
+    BarrierDeferralBlock deferralBlock(this);
+
+    ValidateNestedCmdBufferCall();
 
     for (uint32 buf = 0; buf < cmdBufferCount; ++buf)
     {
@@ -7593,6 +8071,37 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
     }
 }
 
+// =====================================================================================================================
+// Instantiates a command buffer template. This behaves like CmdExecuteNestedCmdBuffers() except that the template's DE
+// commands are always copied inline so that its patch slots can be overwritten in this command buffer's copy.
+void UniversalCmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    BarrierDeferralBlock deferralBlock(this);
+
+    auto*const pTemplate = static_cast<Gfx9::UniversalCmdBuffer*>(pTemplateCmdBuffer);
+    PAL_ASSERT((pTemplate != nullptr) && pTemplate->IsNested());
+    PAL_ASSERT((patchCount == 0) || (pPatches != nullptr));
+
+    ValidateNestedCmdBufferCall();
+
+    m_lastPagingFence     = Max(m_lastPagingFence, pTemplate->LastPagingFence());
+    m_maxUploadFenceToken = Max(m_maxUploadFenceToken, pTemplate->GetMaxUploadFenceToken());
+
+    m_deCmdStream.TrackNestedEmbeddedData(pTemplate->m_embeddedData.chunkList);
+    m_deCmdStream.TrackNestedEmbeddedData(pTemplate->m_gpuScratchMem.chunkList);
+    m_deCmdStream.TrackNestedCommands(pTemplate->m_deCmdStream);
+    m_ceCmdStream.TrackNestedCommands(pTemplate->m_ceCmdStream);
+
+    // Templates never patch CE commands, so those can be called the usual way.
+    m_deCmdStream.CallTemplate(pTemplate->m_deCmdStream, patchCount, pPatches);
+    m_ceCmdStream.Call(pTemplate->m_ceCmdStream, false, false);
+
+    LeakNestedCmdBufferState(*pTemplate);
+}
+
 // =====================================================================================================================
 void UniversalCmdBuffer::AddPerPresentCommands(
     gpusize frameCountGpuAddr,
@@ -7768,6 +8277,12 @@ void UniversalCmdBuffer::SwitchDrawFunctionsInternal(
         = CmdDrawIndexed<IssueSqtt, HasUavExport, ViewInstancing, DescribeDrawDispatch>;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti
         = CmdDrawIndexedIndirectMulti<IssueSqtt, ViewInstancing, DescribeDrawDispatch>;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti
+        = CmdDrawMulti<IssueSqtt, HasUavExport, ViewInstancing, DescribeDrawDispatch>;
+    m_funcTable.pfnCmdDrawIndexedMulti
+        = CmdDrawIndexedMulti<IssueSqtt, HasUavExport, ViewInstancing, DescribeDrawDispatch>;
+#endif
 }
 
 // =====================================================================================================================
@@ -7844,6 +8359,8 @@ void UniversalCmdBuffer::CpCopyMemory(
     gpusize srcAddr,
     gpusize numBytes)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(numBytes < (1ull << 32));
 
     DmaDataInfo dmaDataInfo = {};
@@ -499,6 +499,11 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
 
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override;
+
     virtual void CmdCommentString(const char* pComment) override;
     virtual void CmdNop(
         const void* pPayload,
@@ -617,6 +622,77 @@ protected:
         const ValidateDrawInfo&       drawInfo,
         uint32*                       pDeCmdSpace);
 
+    template <bool Pm4OptImmediate>
+    uint32* ValidateDirectDrawArgs(
+        const ValidateDrawInfo& drawInfo,
+        uint32*                 pDeCmdSpace);
+
+    uint32* ValidateBatchedDraw(
+        const ValidateDrawInfo& drawInfo,
+        uint32*                 pDeCmdSpace);
+
+    template <bool Pm4OptImmediate>
+    uint32* ValidateBatchedDraw(
+        const ValidateDrawInfo& drawInfo,
+        uint32*                 pDeCmdSpace);
+
+    // Command buffer template support: writes the state which pending patch slots need in their own packets and records
+    // the patchable arguments of a direct draw or dispatch packet which is about to be written at pPacket.
+    uint32* WritePatchableDrawState(uint32 instanceCount, uint32* pDeCmdSpace);
+    uint32* WritePatchableUserData(PipelineBindPoint bindPoint, uint32* pDeCmdSpace);
+
+    void RecordDrawIndexAutoPatches(const uint32* pPacket)
+    {
+        if (HasPendingPatchSlots())
+        {
+            RecordPatchLocations(CmdPatchSlotType::VertexCount,
+                                 &m_deCmdStream,
+                                 (pPacket + CmdUtil::DrawIndexAutoCountOffset),
+                                 1,
+                                 0);
+        }
+    }
+
+    void RecordDrawIndex2Patches(const uint32* pPacket, gpusize indexOffset)
+    {
+        if (HasPendingPatchSlots())
+        {
+            RecordPatchLocations(CmdPatchSlotType::VertexCount,
+                                 &m_deCmdStream,
+                                 (pPacket + CmdUtil::DrawIndex2CountOffset),
+                                 1,
+                                 0);
+            RecordPatchLocations(CmdPatchSlotType::IndexBufferAddress,
+                                 &m_deCmdStream,
+                                 (pPacket + CmdUtil::DrawIndex2BaseOffset),
+                                 2,
+                                 indexOffset);
+        }
+    }
+
+    void RecordDrawIndexOffset2Patches(const uint32* pPacket)
+    {
+        if (HasPendingPatchSlots())
+        {
+            // DRAW_INDEX_OFFSET_2 inherits the caller's index buffer so there's no index buffer address to patch.
+            PAL_ASSERT(HasPendingPatchSlot(CmdPatchSlotType::IndexBufferAddress) == false);
+            RecordPatchLocations(CmdPatchSlotType::VertexCount,
+                                 &m_deCmdStream,
+                                 (pPacket + CmdUtil::DrawIndexOffset2CountOffset),
+                                 1,
+                                 0);
+        }
+    }
+
+    void RecordDispatchDirectPatches(const uint32* pPacket)
+    {
+        RecordPatchLocations(CmdPatchSlotType::DispatchSize,
+                             &m_deCmdStream,
+                             (pPacket + CmdUtil::DispatchDirectDimsOffset),
+                             3,
+                             0);
+    }
+
     // Gets vertex offset register address
     uint16 GetVertexOffsetRegAddr() const { return m_vertexOffsetReg; }
 
@@ -666,6 +742,26 @@ private:
         uint32      firstInstance,
         uint32      instanceCount);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    template <bool IssueSqttMarkerEvent,
+              bool HasUavExport,
+              bool ViewInstancingEnable,
+              bool DescribeDrawDispatch>
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws);
+
+    template <bool IssueSqttMarkerEvent,
+              bool HasUavExport,
+              bool ViewInstancingEnable,
+              bool DescribeDrawDispatch>
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws);
+#endif
+
     template <bool IssueSqttMarkerEvent, bool ViewInstancingEnable, bool DescribeDrawDispatch>
     static void PAL_STDCALL CmdDrawIndirectMulti(
         ICmdBuffer*       pCmdBuffer,
@@ -741,6 +837,8 @@ private:
     bool HasStreamOutBeenSet() const;
 
     uint32* WaitOnCeCounter(uint32* pDeCmdSpace);
+
+    void ValidateNestedCmdBufferCall();
     uint32* IncrementDeCounter(uint32* pDeCmdSpace);
 
     Pm4Predicate PacketPredicate() const { return static_cast<Pm4Predicate>(m_gfxCmdBufState.flags.packetPredicate); }
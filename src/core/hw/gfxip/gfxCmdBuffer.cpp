@@ -67,7 +67,14 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_fceRefCountVec(device.GetPlatform()),
     m_gfxBltActiveCtr(0),
     m_csBltActiveCtr(0),
-    m_releaseActivityMap(128, device.GetPlatform())
+    m_releaseActivityMap(128, device.GetPlatform()),
+    m_deferredTransitions(device.GetPlatform()),
+    m_deferredMemBarriers(device.GetPlatform()),
+    m_deferredImgBarriers(device.GetPlatform()),
+    m_barrierDeferralBlockDepth(0),
+    m_mergedBarrierCallCount(0),
+    m_flushingDeferredBarriers(false),
+    m_numPendingPatchSlots(0)
 {
     PAL_ASSERT((createInfo.queueType == QueueTypeUniversal) || (createInfo.queueType == QueueTypeCompute));
 
@@ -83,6 +90,8 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_cmdBufPerfExptFlags.u32All  = 0;
     m_gfxCmdBufState.flags.u32All = 0;
 
+    memset(&m_deferredBarrier, 0, sizeof(m_deferredBarrier));
+
 }
 
 // =====================================================================================================================
@@ -183,6 +192,9 @@ Result GfxCmdBuffer::Begin(
 // Also ends command buffer dumping, if it is enabled.
 Result GfxCmdBuffer::End()
 {
+    // Any deferred barriers must execute before the postamble.
+    FlushDeferredBarriers();
+
     Result result = CmdBuffer::End();
 
     // NOTE: The root chunk comes from the last command stream in this command buffer because for universal command
@@ -274,6 +286,9 @@ void GfxCmdBuffer::ResetState()
     m_gfxBltActiveCtr = 0;
     m_csBltActiveCtr  = 0;
 
+    m_numPendingPatchSlots = 0;
+
+    ResetDeferredBarriers();
 }
 
 // =====================================================================================================================
@@ -565,6 +580,8 @@ void GfxCmdBuffer::CmdCopyImage(
     const Rect*            pScissorRect,
     uint32                 flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdCopyImage(this,
                                         static_cast<const Image&>(srcImage),
@@ -585,6 +602,8 @@ void GfxCmdBuffer::CmdCopyMemoryToImage(
     uint32                       regionCount,
     const MemoryImageCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdCopyMemoryToImage(this,
                                                 static_cast<const GpuMemory&>(srcGpuMemory),
@@ -603,6 +622,8 @@ void GfxCmdBuffer::CmdCopyImageToMemory(
     uint32                       regionCount,
     const MemoryImageCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdCopyImageToMemory(this,
                                                 static_cast<const Image&>(srcImage),
@@ -621,6 +642,8 @@ void GfxCmdBuffer::CmdCopyMemoryToTiledImage(
     uint32                            regionCount,
     const MemoryTiledImageCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
 
     AutoBuffer<MemoryImageCopyRegion, 8, Platform> copyRegions(regionCount, m_device.GetPlatform());
@@ -671,6 +694,8 @@ void GfxCmdBuffer::CmdCopyTiledImageToMemory(
     uint32                            regionCount,
     const MemoryTiledImageCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
 
     AutoBuffer<MemoryImageCopyRegion, 8, Platform> copyRegions(regionCount, m_device.GetPlatform());
@@ -720,6 +745,8 @@ void GfxCmdBuffer::CmdCopyTypedBuffer(
     uint32                       regionCount,
     const TypedBufferCopyRegion* pRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdCopyTypedBuffer(this,
                                               static_cast<const GpuMemory&>(srcGpuMemory),
@@ -732,6 +759,8 @@ void GfxCmdBuffer::CmdCopyTypedBuffer(
 void GfxCmdBuffer::CmdScaledCopyImage(
     const ScaledCopyInfo& copyInfo)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(copyInfo.pRegions != nullptr);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 552
     ScaledCopyInfo localInfo = copyInfo;
@@ -746,6 +775,8 @@ void GfxCmdBuffer::CmdScaledCopyImage(
 void GfxCmdBuffer::CmdGenerateMipmaps(
     const GenMipmapsInfo& genInfo)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdGenerateMipmaps(this, genInfo);
 }
 
@@ -760,6 +791,8 @@ void GfxCmdBuffer::CmdColorSpaceConversionCopy(
     TexFilter                         filter,
     const ColorSpaceConversionTable&  cscTable)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdColorSpaceConversionCopy(this,
                                                        static_cast<const Image&>(srcImage),
@@ -777,6 +810,8 @@ void GfxCmdBuffer::CmdPostProcessFrame(
     const CmdPostProcessFrameInfo& postProcessInfo,
     bool*                          pAddedGpuWork)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     bool addedGpuWork = false;
 
     if (postProcessInfo.flags.srcIsTypedBuffer == 0)
@@ -813,6 +848,8 @@ void GfxCmdBuffer::CmdPresentBlt(
     const IImage&   dstImage,
     const Offset3d& dstOffset)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     constexpr SubresId subres = { ImageAspect::Color, 0, 0, };
     const auto& srcImageInfo  = srcImage.GetImageCreateInfo();
 
@@ -863,6 +900,8 @@ void GfxCmdBuffer::CmdFillMemory(
     gpusize           fillSize,
     uint32            data)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdFillMemory(this,
                                          (IsComputeStateSaved() == false),
                                          static_cast<const GpuMemory&>(dstGpuMemory),
@@ -881,6 +920,8 @@ void GfxCmdBuffer::CmdClearColorBuffer(
     uint32            rangeCount,
     const Range*      pRanges)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdClearColorBuffer(this,
                                                gpuMemory,
                                                color,
@@ -898,6 +939,8 @@ void GfxCmdBuffer::CmdClearBoundColorTargets(
     uint32                          regionCount,
     const ClearBoundTargetRegion*   pClearRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdClearBoundColorTargets(this,
                                                      colorTargetCount,
                                                      pBoundColorTargets,
@@ -916,6 +959,8 @@ void GfxCmdBuffer::CmdClearColorImage(
     const Box*         pBoxes,
     uint32             flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRanges != nullptr);
     m_device.RsrcProcMgr().CmdClearColorImage(this,
                                               static_cast<const Image&>(image),
@@ -939,6 +984,8 @@ void GfxCmdBuffer::CmdClearBoundDepthStencilTargets(
     uint32                        regionCount,
     const ClearBoundTargetRegion* pClearRegions)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     m_device.RsrcProcMgr().CmdClearBoundDepthStencilTargets(this,
                                                             depth,
                                                             stencil,
@@ -964,6 +1011,8 @@ void GfxCmdBuffer::CmdClearDepthStencil(
     const Rect*        pRects,
     uint32             flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRanges != nullptr);
     m_device.RsrcProcMgr().CmdClearDepthStencil(this,
                                                 static_cast<const Image&>(image),
@@ -987,6 +1036,8 @@ void GfxCmdBuffer::CmdClearBufferView(
     uint32            rangeCount,
     const Range*      pRanges)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pBufferViewSrd != nullptr);
     m_device.RsrcProcMgr().CmdClearBufferView(this, gpuMemory, color, pBufferViewSrd, rangeCount, pRanges);
 }
@@ -1000,6 +1051,8 @@ void GfxCmdBuffer::CmdClearImageView(
     uint32            rectCount,
     const Rect*       pRects)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
      PAL_ASSERT(pImageViewSrd != nullptr);
      m_device.RsrcProcMgr().CmdClearImageView(this,
                                               static_cast<const Image&>(image),
@@ -1021,6 +1074,8 @@ void GfxCmdBuffer::CmdResolveImage(
     const ImageResolveRegion* pRegions,
     uint32                    flags)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CmdResolveImage(this,
                                            static_cast<const Image&>(srcImage),
@@ -1040,6 +1095,10 @@ void GfxCmdBuffer::CmdSaveComputeState(
     uint32 stateFlags)
 {
     PAL_ASSERT(IsComputeStateSaved() == false);
+
+    // Internal operations must see the effects of any deferred barriers and can't have their own barriers deferred.
+    BeginBarrierDeferralBlock();
+
     m_computeStateFlags = stateFlags;
 
     if (TestAnyFlagSet(stateFlags, ComputeStatePipelineAndUserData))
@@ -1087,6 +1146,107 @@ void GfxCmdBuffer::CmdRestoreComputeState(
     // The caller has just executed one or more CS blts.
     SetGfxCmdBufCsBltState(true);
     SetGfxCmdBufCsBltWriteCacheState(true);
+
+    EndBarrierDeferralBlock();
+}
+
+// =====================================================================================================================
+// Declares a command buffer template patch slot for the next draw or dispatch.
+void GfxCmdBuffer::CmdDeclarePatchSlot(
+    const CmdPatchSlotInfo& slotInfo)
+{
+    // Only nested command buffers can be instantiated as templates.
+    PAL_ASSERT(IsNested());
+    PAL_ASSERT(slotInfo.type < CmdPatchSlotType::Count);
+
+    if (m_numPendingPatchSlots < MaxPendingPatchSlots)
+    {
+        m_pendingPatchSlots[m_numPendingPatchSlots++] = slotInfo;
+
+        // The PM4 optimizer would skip later register writes which match the recorded value of a patched register,
+        // which is only correct as long as that value is never patched.
+        GetCmdStreamByEngine(CmdBufferEngineSupport::Compute)->DisablePm4Optimizer();
+    }
+    else
+    {
+        PAL_ALERT_ALWAYS_MSG("Too many patch slots declared for a single draw or dispatch.");
+    }
+}
+
+// =====================================================================================================================
+// Returns true if a patch slot of the given type is pending for the next draw or dispatch.
+bool GfxCmdBuffer::HasPendingPatchSlot(
+    CmdPatchSlotType type
+    ) const
+{
+    bool found = false;
+
+    for (uint32 idx = 0; (idx < m_numPendingPatchSlots) && (found == false); ++idx)
+    {
+        found = (m_pendingPatchSlots[idx].type == type);
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Discards every pending patch slot of the given type, keeping the remaining slots in declaration order.
+void GfxCmdBuffer::DropPendingPatchSlots(
+    CmdPatchSlotType type)
+{
+    uint32 numKept = 0;
+
+    for (uint32 idx = 0; idx < m_numPendingPatchSlots; ++idx)
+    {
+        if (m_pendingPatchSlots[idx].type != type)
+        {
+            m_pendingPatchSlots[numKept++] = m_pendingPatchSlots[idx];
+        }
+    }
+
+    m_numPendingPatchSlots = numKept;
+}
+
+// =====================================================================================================================
+// Patch slots only apply to the next CmdDraw, CmdDrawIndexed or CmdDispatch. Every other draw or dispatch variant
+// calls this to discard slots which were declared ahead of it so they can't leak into a later, unrelated call.
+void GfxCmdBuffer::RejectPendingPatchSlots()
+{
+    if (m_numPendingPatchSlots != 0)
+    {
+        PAL_ALERT_ALWAYS_MSG("Patch slots are only supported by CmdDraw, CmdDrawIndexed and CmdDispatch.");
+        m_numPendingPatchSlots = 0;
+    }
+}
+
+// =====================================================================================================================
+// Direct dispatches write their threadgroup counts to embedded data when the shader reads them. That embedded data is
+// shared by every instance of a template, so DispatchSize slots can't be honoured for such shaders and are discarded.
+void GfxCmdBuffer::RejectDispatchSizePatchSlots()
+{
+    if (HasPendingPatchSlot(CmdPatchSlotType::DispatchSize))
+    {
+        PAL_ALERT_ALWAYS_MSG("DispatchSize patch slots are unsupported when the shader reads its threadgroup counts.");
+        DropPendingPatchSlots(CmdPatchSlotType::DispatchSize);
+    }
+}
+
+// =====================================================================================================================
+// Records pCmdAddr as the location of a draw or dispatch argument for every pending patch slot of the given type.
+void GfxCmdBuffer::RecordPatchLocations(
+    CmdPatchSlotType type,
+    CmdStream*       pCmdStream,
+    const uint32*    pCmdAddr,
+    uint32           numDwords,
+    gpusize          addend)
+{
+    for (uint32 idx = 0; idx < m_numPendingPatchSlots; ++idx)
+    {
+        if (m_pendingPatchSlots[idx].type == type)
+        {
+            pCmdStream->AddPatchLocation(m_pendingPatchSlots[idx].slotId, pCmdAddr, numDwords, addend);
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -1304,6 +1464,8 @@ CmdStreamChunk* GfxCmdBuffer::GetNextGeneratedChunk()
 void GfxCmdBuffer::CmdBeginPerfExperiment(
     IPerfExperiment* pPerfExperiment)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const PerfExperiment*const pExperiment = static_cast<PerfExperiment*>(pPerfExperiment);
     PAL_ASSERT(pExperiment != nullptr);
     CmdStream* pCmdStream = GetCmdStreamByEngine(GetPerfExperimentEngine());
@@ -1322,6 +1484,8 @@ void GfxCmdBuffer::CmdUpdatePerfExperimentSqttTokenMask(
     IPerfExperiment*              pPerfExperiment,
     const ThreadTraceTokenConfig& sqttTokenConfig)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const PerfExperiment*const pExperiment = static_cast<PerfExperiment*>(pPerfExperiment);
     PAL_ASSERT(pExperiment != nullptr);
     CmdStream* pCmdStream = GetCmdStreamByEngine(GetPerfExperimentEngine());
@@ -1332,6 +1496,8 @@ void GfxCmdBuffer::CmdUpdatePerfExperimentSqttTokenMask(
 void GfxCmdBuffer::CmdEndPerfExperiment(
     IPerfExperiment* pPerfExperiment)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     const PerfExperiment*const pExperiment = static_cast<PerfExperiment*>(pPerfExperiment);
     PAL_ASSERT(pPerfExperiment != nullptr);
     CmdStream* pCmdStream = GetCmdStreamByEngine(GetPerfExperimentEngine());
@@ -1361,6 +1527,8 @@ void GfxCmdBuffer::CmdCopyImageToPackedPixelImage(
         const ImageCopyRegion* pRegions,
         Pal::PackedPixelType   packPixelType)
 {
+    BarrierDeferralBlock deferralBlock(this);
+
     PAL_ASSERT(pRegions != nullptr);
     m_device.RsrcProcMgr().CopyImageToPackedPixelImage(
         this,
@@ -1421,4 +1589,384 @@ uint32 GfxCmdBuffer::GetUsedSize(
     return sizeInBytes;
 }
 
+// =====================================================================================================================
+// Returns true if barriers issued right now may be deferred.
+bool GfxCmdBuffer::CanDeferBarriers() const
+{
+    return ((m_buildFlags.deferBarriers != 0)  &&
+            (m_barrierDeferralBlockDepth == 0) &&
+            (m_flushingDeferredBarriers == false));
+}
+
+// =====================================================================================================================
+// Discards all deferred barrier state.
+void GfxCmdBuffer::ResetDeferredBarriers()
+{
+    memset(&m_deferredBarrier, 0, sizeof(m_deferredBarrier));
+
+    m_deferredTransitions.Clear();
+    m_deferredMemBarriers.Clear();
+    m_deferredImgBarriers.Clear();
+
+    m_barrierDeferralBlockDepth = 0;
+    m_mergedBarrierCallCount    = 0;
+    m_flushingDeferredBarriers  = false;
+}
+
+// =====================================================================================================================
+static bool IsSameLayout(
+    ImageLayout lhs,
+    ImageLayout rhs)
+{
+    return (lhs.usages == rhs.usages) && (lhs.engines == rhs.engines);
+}
+
+// =====================================================================================================================
+// Decides if a later image transition can be merged with an earlier deferred transition on the same image. This is only
+// true if both cover exactly the same subresources and the later transition either starts from the layout the earlier
+// one ends in or is a duplicate of it.  Transitions on different, potentially overlapping, subresources of the same
+// image are never merged.
+static bool CanMergeImageTransition(
+    const SubresRange& pendingRange,
+    ImageLayout        pendingOldLayout,
+    ImageLayout        pendingNewLayout,
+    const SubresRange& range,
+    ImageLayout        oldLayout,
+    ImageLayout        newLayout)
+{
+    return (memcmp(&pendingRange, &range, sizeof(SubresRange)) == 0) &&
+           (IsSameLayout(pendingNewLayout, oldLayout) ||
+            (IsSameLayout(pendingOldLayout, oldLayout) && IsSameLayout(pendingNewLayout, newLayout)));
+}
+
+// =====================================================================================================================
+// Tries to defer a CmdBarrier() call so it can be merged with its neighbors. Returns true if the barrier was deferred,
+// otherwise the caller must execute it immediately.  Barriers which involve GPU events, range-checked targets or custom
+// sample patterns are never deferred since they reference client memory which may not outlive this call.
+bool GfxCmdBuffer::DeferBarrier(
+    const BarrierInfo& barrierInfo)
+{
+    bool defer = CanDeferBarriers()                              &&
+                 (barrierInfo.flags.u32All == 0)                 &&
+                 (barrierInfo.gpuEventWaitCount == 0)            &&
+                 (barrierInfo.rangeCheckedTargetWaitCount == 0)  &&
+                 (barrierInfo.pSplitBarrierGpuEvent == nullptr);
+
+    bool canMerge = (m_deferredBarrier.type == DeferredBarrierType::Barrier);
+
+    for (uint32 i = 0; defer && (i < barrierInfo.transitionCount); ++i)
+    {
+        const auto& imageInfo = barrierInfo.pTransitions[i].imageInfo;
+
+        defer = (imageInfo.pQuadSamplePattern == nullptr);
+
+        for (uint32 j = 0; canMerge && (imageInfo.pImage != nullptr) && (j < m_deferredTransitions.NumElements()); ++j)
+        {
+            const auto& pendingInfo = m_deferredTransitions.At(j).imageInfo;
+
+            if (pendingInfo.pImage == imageInfo.pImage)
+            {
+                canMerge = CanMergeImageTransition(pendingInfo.subresRange,
+                                                   pendingInfo.oldLayout,
+                                                   pendingInfo.newLayout,
+                                                   imageInfo.subresRange,
+                                                   imageInfo.oldLayout,
+                                                   imageInfo.newLayout);
+            }
+        }
+    }
+
+    if (defer)
+    {
+        if (canMerge == false)
+        {
+            FlushDeferredBarriers();
+        }
+
+        // Make sure that we won't run out of memory part way through merging this barrier.
+        if (m_deferredTransitions.Reserve(m_deferredTransitions.NumElements() + barrierInfo.transitionCount) !=
+            Result::Success)
+        {
+            FlushDeferredBarriers();
+            defer = false;
+        }
+    }
+
+    if (defer)
+    {
+        DeferredBarrierState*const pState = &m_deferredBarrier;
+
+        if (pState->type == DeferredBarrierType::None)
+        {
+            pState->type      = DeferredBarrierType::Barrier;
+            pState->reason    = barrierInfo.reason;
+            pState->waitPoint = barrierInfo.waitPoint;
+        }
+        else
+        {
+            // Waiting at the earlier point satisfies both barriers.
+            pState->waitPoint = Min(pState->waitPoint, barrierInfo.waitPoint);
+        }
+
+        pState->count++;
+        pState->srcCacheMask |= barrierInfo.globalSrcCacheMask;
+        pState->dstCacheMask |= barrierInfo.globalDstCacheMask;
+
+        for (uint32 i = 0; i < barrierInfo.pipePointWaitCount; ++i)
+        {
+            pState->pipePointMask |= (1u << barrierInfo.pPipePoints[i]);
+        }
+
+        // Only transitions from previous calls are candidates for merging.
+        const uint32 numPending = m_deferredTransitions.NumElements();
+
+        for (uint32 i = 0; i < barrierInfo.transitionCount; ++i)
+        {
+            const BarrierTransition& transition = barrierInfo.pTransitions[i];
+            BarrierTransition*       pMergeInto = nullptr;
+
+            for (uint32 j = 0; (pMergeInto == nullptr) && (j < numPending); ++j)
+            {
+                BarrierTransition*const pPending = &m_deferredTransitions.At(j);
+
+                // Memory-only transitions are all folded into one. Image transitions were checked above.
+                if ((pPending->imageInfo.pImage == transition.imageInfo.pImage) &&
+                    ((transition.imageInfo.pImage == nullptr) ||
+                     (memcmp(&pPending->imageInfo.subresRange,
+                             &transition.imageInfo.subresRange,
+                             sizeof(SubresRange)) == 0)))
+                {
+                    pMergeInto = pPending;
+                }
+            }
+
+            if (pMergeInto != nullptr)
+            {
+                pMergeInto->srcCacheMask |= transition.srcCacheMask;
+                pMergeInto->dstCacheMask |= transition.dstCacheMask;
+
+                if (transition.imageInfo.pImage != nullptr)
+                {
+                    pMergeInto->imageInfo.newLayout = transition.imageInfo.newLayout;
+                }
+            }
+            else
+            {
+                const Result result = m_deferredTransitions.PushBack(transition);
+                PAL_ASSERT(result == Result::Success);
+            }
+        }
+    }
+    else
+    {
+        // The caller is about to execute this barrier right away, so anything deferred before it must execute first.
+        FlushDeferredBarriers();
+    }
+
+    return defer;
+}
+
+// =====================================================================================================================
+// Tries to defer a CmdReleaseThenAcquire() call so it can be merged with its neighbors. Returns true if the barrier
+// was deferred, otherwise the caller must execute it immediately.
+bool GfxCmdBuffer::DeferReleaseThenAcquire(
+    const AcquireReleaseInfo& barrierInfo)
+{
+    bool defer    = CanDeferBarriers();
+    bool canMerge = (m_deferredBarrier.type == DeferredBarrierType::ReleaseThenAcquire);
+
+    for (uint32 i = 0; defer && (i < barrierInfo.imageBarrierCount); ++i)
+    {
+        const ImgBarrier& imgBarrier = barrierInfo.pImageBarriers[i];
+
+        defer = (imgBarrier.pQuadSamplePattern == nullptr);
+
+        for (uint32 j = 0; canMerge && (j < m_deferredImgBarriers.NumElements()); ++j)
+        {
+            const ImgBarrier& pending = m_deferredImgBarriers.At(j);
+
+            if (pending.pImage == imgBarrier.pImage)
+            {
+                canMerge = (memcmp(&pending.box, &imgBarrier.box, sizeof(Box)) == 0) &&
+                           CanMergeImageTransition(pending.subresRange,
+                                                   pending.oldLayout,
+                                                   pending.newLayout,
+                                                   imgBarrier.subresRange,
+                                                   imgBarrier.oldLayout,
+                                                   imgBarrier.newLayout);
+            }
+        }
+    }
+
+    if (defer)
+    {
+        if (canMerge == false)
+        {
+            FlushDeferredBarriers();
+        }
+
+        // Make sure that we won't run out of memory part way through merging this barrier.
+        if ((m_deferredMemBarriers.Reserve(m_deferredMemBarriers.NumElements() + barrierInfo.memoryBarrierCount) !=
+             Result::Success) ||
+            (m_deferredImgBarriers.Reserve(m_deferredImgBarriers.NumElements() + barrierInfo.imageBarrierCount) !=
+             Result::Success))
+        {
+            FlushDeferredBarriers();
+            defer = false;
+        }
+    }
+
+    if (defer)
+    {
+        DeferredBarrierState*const pState = &m_deferredBarrier;
+
+        if (pState->type == DeferredBarrierType::None)
+        {
+            pState->type   = DeferredBarrierType::ReleaseThenAcquire;
+            pState->reason = barrierInfo.reason;
+        }
+
+        pState->count++;
+        pState->srcStageMask |= barrierInfo.srcStageMask;
+        pState->dstStageMask |= barrierInfo.dstStageMask;
+        pState->srcCacheMask |= barrierInfo.srcGlobalAccessMask;
+        pState->dstCacheMask |= barrierInfo.dstGlobalAccessMask;
+
+        // Only barriers from previous calls are candidates for merging.
+        const uint32 numPendingMem = m_deferredMemBarriers.NumElements();
+        const uint32 numPendingImg = m_deferredImgBarriers.NumElements();
+
+        for (uint32 i = 0; i < barrierInfo.memoryBarrierCount; ++i)
+        {
+            const MemBarrier& memBarrier = barrierInfo.pMemoryBarriers[i];
+            MemBarrier*       pMergeInto = nullptr;
+
+            for (uint32 j = 0; (pMergeInto == nullptr) && (j < numPendingMem); ++j)
+            {
+                MemBarrier*const pPending = &m_deferredMemBarriers.At(j);
+
+                if ((pPending->flags.u32All == memBarrier.flags.u32All) &&
+                    (memcmp(&pPending->memory, &memBarrier.memory, sizeof(GpuMemSubAllocInfo)) == 0))
+                {
+                    pMergeInto = pPending;
+                }
+            }
+
+            if (pMergeInto != nullptr)
+            {
+                pMergeInto->srcAccessMask |= memBarrier.srcAccessMask;
+                pMergeInto->dstAccessMask |= memBarrier.dstAccessMask;
+            }
+            else
+            {
+                const Result result = m_deferredMemBarriers.PushBack(memBarrier);
+                PAL_ASSERT(result == Result::Success);
+            }
+        }
+
+        for (uint32 i = 0; i < barrierInfo.imageBarrierCount; ++i)
+        {
+            const ImgBarrier& imgBarrier = barrierInfo.pImageBarriers[i];
+            ImgBarrier*       pMergeInto = nullptr;
+
+            for (uint32 j = 0; (pMergeInto == nullptr) && (j < numPendingImg); ++j)
+            {
+                ImgBarrier*const pPending = &m_deferredImgBarriers.At(j);
+
+                if ((pPending->pImage == imgBarrier.pImage) &&
+                    (memcmp(&pPending->subresRange, &imgBarrier.subresRange, sizeof(SubresRange)) == 0))
+                {
+                    pMergeInto = pPending;
+                }
+            }
+
+            if (pMergeInto != nullptr)
+            {
+                pMergeInto->srcAccessMask |= imgBarrier.srcAccessMask;
+                pMergeInto->dstAccessMask |= imgBarrier.dstAccessMask;
+                pMergeInto->newLayout      = imgBarrier.newLayout;
+            }
+            else
+            {
+                const Result result = m_deferredImgBarriers.PushBack(imgBarrier);
+                PAL_ASSERT(result == Result::Success);
+            }
+        }
+    }
+    else
+    {
+        // The caller is about to execute this barrier right away, so anything deferred before it must execute first.
+        FlushDeferredBarriers();
+    }
+
+    return defer;
+}
+
+// =====================================================================================================================
+// Executes all deferred barrier calls as a single barrier.
+void GfxCmdBuffer::FlushDeferredBarriersInternal()
+{
+    const DeferredBarrierState state = m_deferredBarrier;
+
+    // Clear the deferred state first: the barrier's own BLTs will flush again and any barriers they issue must not be
+    // deferred.
+    m_deferredBarrier.type     = DeferredBarrierType::None;
+    m_mergedBarrierCallCount   = state.count;
+    m_flushingDeferredBarriers = true;
+
+    if (state.type == DeferredBarrierType::Barrier)
+    {
+        static_assert(HwPipeBottom < 8, "HwPipePoint values no longer fit in pipePointMask.");
+
+        HwPipePoint pipePoints[8] = {};
+        uint32      numPipePoints = 0;
+
+        for (uint32 point = 0; point < ArrayLen(pipePoints); ++point)
+        {
+            if (TestAnyFlagSet(state.pipePointMask, 1u << point))
+            {
+                pipePoints[numPipePoints++] = static_cast<HwPipePoint>(point);
+            }
+        }
+
+        BarrierInfo barrierInfo = {};
+        barrierInfo.waitPoint          = state.waitPoint;
+        barrierInfo.pipePointWaitCount = numPipePoints;
+        barrierInfo.pPipePoints        = &pipePoints[0];
+        barrierInfo.transitionCount    = m_deferredTransitions.NumElements();
+        barrierInfo.pTransitions       = m_deferredTransitions.Data();
+        barrierInfo.globalSrcCacheMask = state.srcCacheMask;
+        barrierInfo.globalDstCacheMask = state.dstCacheMask;
+        barrierInfo.reason             = state.reason;
+
+        CmdBarrier(barrierInfo);
+    }
+    else
+    {
+        PAL_ASSERT(state.type == DeferredBarrierType::ReleaseThenAcquire);
+
+        AcquireReleaseInfo barrierInfo = {};
+        barrierInfo.srcStageMask        = state.srcStageMask;
+        barrierInfo.dstStageMask        = state.dstStageMask;
+        barrierInfo.srcGlobalAccessMask = state.srcCacheMask;
+        barrierInfo.dstGlobalAccessMask = state.dstCacheMask;
+        barrierInfo.memoryBarrierCount  = m_deferredMemBarriers.NumElements();
+        barrierInfo.pMemoryBarriers     = m_deferredMemBarriers.Data();
+        barrierInfo.imageBarrierCount   = m_deferredImgBarriers.NumElements();
+        barrierInfo.pImageBarriers      = m_deferredImgBarriers.Data();
+        barrierInfo.reason              = state.reason;
+
+        CmdReleaseThenAcquire(barrierInfo);
+    }
+
+    memset(&m_deferredBarrier, 0, sizeof(m_deferredBarrier));
+
+    m_deferredTransitions.Clear();
+    m_deferredMemBarriers.Clear();
+    m_deferredImgBarriers.Clear();
+
+    m_mergedBarrierCallCount   = 0;
+    m_flushingDeferredBarriers = false;
+}
+
 } // Pal
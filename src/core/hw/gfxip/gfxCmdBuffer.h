@@ -33,6 +33,7 @@
 #include "palDeque.h"
 #include "palHashMap.h"
 #include "palQueryPool.h"
+#include "palVector.h"
 
 namespace Pal
 {
@@ -188,6 +189,29 @@ struct ChunkOutput
 
 typedef Util::HashMap<const IGpuEvent*, ReleaseActivityInfo, Platform> ReleaseActivityMap;
 
+// Identifies which kind of barrier call has been deferred by a command buffer built with the deferBarriers flag.
+enum class DeferredBarrierType : uint32
+{
+    None = 0,           // Nothing is deferred.
+    Barrier,            // One or more merged CmdBarrier() calls.
+    ReleaseThenAcquire, // One or more merged CmdReleaseThenAcquire() calls.
+};
+
+// The merged state of all deferred barrier calls, not counting the transitions and memory/image barriers which are
+// stored in vectors next to this.
+struct DeferredBarrierState
+{
+    DeferredBarrierType type;
+    uint32              count;         // Number of client barrier calls merged so far.
+    uint32              reason;        // Reason code of the first merged call.
+    HwPipePoint         waitPoint;     // Earliest wait point of all merged CmdBarrier() calls.
+    uint32              pipePointMask; // Mask of (1 << HwPipePoint) for every pipe point to wait on.
+    uint32              srcStageMask;  // Merged srcStageMask of all CmdReleaseThenAcquire() calls.
+    uint32              dstStageMask;  // Merged dstStageMask of all CmdReleaseThenAcquire() calls.
+    uint32              srcCacheMask;  // Merged global source cache/access mask.
+    uint32              dstCacheMask;  // Merged global destination cache/access mask.
+};
+
 // =====================================================================================================================
 // Abstract class for executing basic hardware-specific functionality common to GFXIP universal and compute command
 // buffers.
@@ -368,6 +392,8 @@ public:
     virtual void CmdSaveComputeState(uint32 stateFlags) override;
     virtual void CmdRestoreComputeState(uint32 stateFlags) override;
 
+    virtual void CmdDeclarePatchSlot(const CmdPatchSlotInfo& slotInfo) override;
+
     virtual bool IsQueryAllowed(QueryPoolType queryPoolType) const = 0;
     virtual void AddQuery(QueryPoolType queryPoolType, QueryControlFlags flags) = 0;
     virtual void RemoveQuery(QueryPoolType queryPoolType) = 0;
@@ -456,6 +482,15 @@ public:
 
     UploadFenceToken GetMaxUploadFenceToken() const { return m_maxUploadFenceToken; }
 
+    // Returns the number of client barrier calls merged into the barrier which is starting to execute.  This is only
+    // meaningful when called once at the start of each barrier.
+    uint32 TakeMergedBarrierCallCount()
+    {
+        const uint32 count = Util::Max(m_mergedBarrierCallCount, 1u);
+        m_mergedBarrierCallCount = 0;
+        return count;
+    }
+
 protected:
     GfxCmdBuffer(
         const GfxDevice&           device,
@@ -536,6 +571,50 @@ protected:
 
     virtual bool SupportsExecutionMarker() override { return true; }
 
+    bool DeferBarrier(const BarrierInfo& barrierInfo);
+    bool DeferReleaseThenAcquire(const AcquireReleaseInfo& barrierInfo);
+
+    // Executes any deferred barriers.  Must be called before any work is written which the barriers might apply to.
+    void FlushDeferredBarriers()
+    {
+        if (m_deferredBarrier.type != DeferredBarrierType::None)
+        {
+            FlushDeferredBarriersInternal();
+        }
+    }
+
+    // Flushes any deferred barriers and prevents new ones from being deferred until the matching call to
+    // EndBarrierDeferralBlock.  Used around internal operations which may issue their own barriers.
+    void BeginBarrierDeferralBlock()
+    {
+        FlushDeferredBarriers();
+        m_barrierDeferralBlockDepth++;
+    }
+
+    void EndBarrierDeferralBlock()
+    {
+        PAL_ASSERT(m_barrierDeferralBlockDepth > 0);
+        m_barrierDeferralBlockDepth--;
+    }
+
+    // Command buffer template support: the patch slots declared for the next draw or dispatch. The draw or dispatch
+    // records the locations of its patchable arguments and then discards the pending slots.
+    bool HasPendingPatchSlots() const { return (m_numPendingPatchSlots != 0); }
+    bool HasPendingPatchSlot(CmdPatchSlotType type) const;
+    uint32 NumPendingPatchSlots() const { return m_numPendingPatchSlots; }
+    const CmdPatchSlotInfo& PendingPatchSlot(uint32 idx) const { return m_pendingPatchSlots[idx]; }
+    void ClearPendingPatchSlots() { m_numPendingPatchSlots = 0; }
+    void DropPendingPatchSlots(CmdPatchSlotType type);
+    void RejectPendingPatchSlots();
+    void RejectDispatchSizePatchSlots();
+
+    void RecordPatchLocations(
+        CmdPatchSlotType type,
+        CmdStream*       pCmdStream,
+        const uint32*    pCmdAddr,
+        uint32           numDwords,
+        gpusize          addend);
+
     uint32            m_engineSupport;       // Indicates which engines are supported by the command buffer.
                                              // Populated by the GFXIP-specific layer.
     ComputeState      m_computeState;        // Currently bound compute command buffer state.
@@ -558,6 +637,12 @@ private:
     CmdBufferEngineSupport GetPerfExperimentEngine() const;
     void ResetFastClearReferenceCounts();
 
+    bool CanDeferBarriers() const;
+    void FlushDeferredBarriersInternal();
+    void ResetDeferredBarriers();
+
+    friend class BarrierDeferralBlock;
+
     const GfxDevice&  m_device;
 
     // False if DeactivateQuery() has been called on a particular query type, true otherwise.
@@ -582,10 +667,44 @@ private:
     PerfExperimentFlags m_cmdBufPerfExptFlags; // Flags that indicate which Performance Experiments are ongoing in
                                                // this CmdBuffer.
 
+    // Barriers deferred by the deferBarriers build flag.
+    DeferredBarrierState                         m_deferredBarrier;
+    Util::Vector<BarrierTransition, 8, Platform> m_deferredTransitions;
+    Util::Vector<MemBarrier, 8, Platform>        m_deferredMemBarriers;
+    Util::Vector<ImgBarrier, 8, Platform>        m_deferredImgBarriers;
+
+    uint32 m_barrierDeferralBlockDepth; // Number of active BeginBarrierDeferralBlock calls.
+    uint32 m_mergedBarrierCallCount;    // Number of calls merged into the barrier currently being flushed.
+    bool   m_flushingDeferredBarriers;  // True while the deferred barriers are being executed.
+
+    // Patch slots declared by CmdDeclarePatchSlot which apply to the next draw or dispatch.
+    static constexpr uint32 MaxPendingPatchSlots = 8;
+    CmdPatchSlotInfo m_pendingPatchSlots[MaxPendingPatchSlots];
+    uint32           m_numPendingPatchSlots;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdBuffer);
 };
 
+// =====================================================================================================================
+// Flushes any barriers deferred on a GfxCmdBuffer and keeps new barriers from being deferred until it goes out of scope.
+// Each command which does GPU work creates one of these before anything else. That way the deferred barriers execute
+// before the work, and any barriers the command issues internally execute immediately.
+class BarrierDeferralBlock
+{
+public:
+    explicit BarrierDeferralBlock(GfxCmdBuffer* pCmdBuffer) : m_pCmdBuffer(pCmdBuffer)
+        { m_pCmdBuffer->BeginBarrierDeferralBlock(); }
+
+    ~BarrierDeferralBlock() { m_pCmdBuffer->EndBarrierDeferralBlock(); }
+
+private:
+    GfxCmdBuffer*const m_pCmdBuffer;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BarrierDeferralBlock);
+    PAL_DISALLOW_DEFAULT_CTOR(BarrierDeferralBlock);
+};
+
 // =====================================================================================================================
 // Helper function for resetting a user-data table which is managed using embdedded data or CE RAM at the beginning of
 // a command buffer.
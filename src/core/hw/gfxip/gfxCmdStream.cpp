@@ -527,6 +527,45 @@ void GfxCmdStream::Call(
     }
 }
 
+// =====================================================================================================================
+// "Calls" the command stream of a command buffer template. Templates are always copied inline, like a Call() without
+// IB2 or exclusive-submit chaining, so that each instance receives its own copy of the commands in which the template's
+// patch locations are overwritten with the given patch values.
+// Note: It is expected that the caller will also call TrackNestedCommands().
+void GfxCmdStream::CallTemplate(
+    const CmdStream&     templateStream,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    const auto& gfxStream = static_cast<const GfxCmdStream&>(templateStream);
+
+    if (templateStream.IsEmpty() == false)
+    {
+        PAL_ASSERT((gfxStream.m_chainIbSpaceInDwords == m_chainIbSpaceInDwords) ||
+                   (gfxStream.m_chainIbSpaceInDwords == 0));
+        PAL_ASSERT(m_pCmdAllocator->ChunkSize(CommandDataAlloc) >= templateStream.GetFirstChunk()->Size());
+        PAL_ASSERT(IsPreemptionEnabled() == templateStream.IsPreemptionEnabled());
+
+        // Commands which depend on their own GPU address can't be copied without also patching those addresses.
+        PAL_ASSERT(templateStream.IsAddressDependent() == false);
+
+        uint32 chunkIdx = 0;
+        for (auto chunkIter = templateStream.GetFwdIterator(); chunkIter.IsValid(); chunkIter.Next(), ++chunkIdx)
+        {
+            const auto*const pChunk = chunkIter.Get();
+            const uint32 sizeInDwords = (pChunk->CmdDwordsToExecute() - gfxStream.m_chainIbSpaceInDwords);
+
+            uint32*const pCmdSpace = AllocCommandSpace(sizeInDwords);
+            memcpy(pCmdSpace, pChunk->CpuAddr(), (sizeof(uint32) * sizeInDwords));
+
+            if (patchCount > 0)
+            {
+                templateStream.ApplyPatches(chunkIdx, pCmdSpace, sizeInDwords, patchCount, pPatches);
+            }
+        }
+    }
+}
+
 // =====================================================================================================================
 // Uses command buffer chaining to "execute" a series of GPU-generated command chunks. All chunks starting at the given
 // iterator until the end of whichever list it belongs to are chained together. Additionally, the final chunk chains
@@ -90,6 +90,8 @@ public:
 
     virtual void Call(const CmdStream& targetStream, bool exclusiveSubmit, bool allowIb2Launch) override;
 
+    void CallTemplate(const CmdStream& templateStream, uint32 patchCount, const CmdPatchValue* pPatches);
+
     void ExecuteGeneratedCommands(ChunkRefList::Iter chunkIter);
 
     uint32 PrepareChunkForCmdGeneration(
@@ -49,6 +49,7 @@ GfxDevice::GfxDevice(
     :
     m_pParent(pDevice),
     m_pRsrcProcMgr(pRsrcProcMgr),
+    m_codeHeap(pDevice),
     m_frameCountGpuMem(),
     m_frameCntReg(frameCountRegOffset),
     m_useFixedLateAllocVsLimit(false),
@@ -187,7 +188,8 @@ void GfxDevice::FinalizeChipProperties(
 // Peforms extra initialization which needs to be done after the parent Device is finalized.
 Result GfxDevice::Finalize()
 {
-    Result result = Result::Success;
+    // The code heap must be ready before any pipelines, including RPM's, are created.
+    Result result = m_codeHeap.Init();
 
 #if DEBUG
     if (result == Result::Success)
@@ -29,6 +29,7 @@
 #include "palMetroHash.h"
 #include "palSettingsLoader.h"
 #include "core/cmdStream.h"
+#include "core/hw/gfxip/codeHeap.h"
 #include "core/platform.h"
 #include "palHashMap.h"
 #include "palSysMemory.h"
@@ -512,6 +513,8 @@ public:
 
     const RsrcProcMgr& RsrcProcMgr() const { return *m_pRsrcProcMgr; }
 
+    CodeHeap* GetCodeHeap() { return &m_codeHeap; }
+
     virtual Result SetSamplePatternPalette(const SamplePatternPalette& palette) = 0;
 
     virtual uint32 GetValidFormatFeatureFlags(
@@ -682,6 +685,7 @@ protected:
     Device*const       m_pParent;
     Pal::RsrcProcMgr*  m_pRsrcProcMgr;
     FlglRegSeq         m_flglRegSeq[FlglRegSeqMax]; // Holder for FLGL sync register sequences
+    CodeHeap           m_codeHeap;                  // Deduplicated code shared between pipelines.
 
 #if DEBUG
     // Sometimes it is useful to temporarily hang the GPU during debugging to dump command buffers, etc.  This piece of
@@ -31,6 +31,7 @@
 #include "core/hw/gfxip/pipeline.h"
 #include "palFile.h"
 #include "palEventDefs.h"
+#include "palMemCopy.h"
 #include "palSysUtil.h"
 
 #include "core/devDriverUtil.h"
@@ -92,6 +93,8 @@ Pipeline::~Pipeline()
         m_gpuMem.Update(nullptr, 0);
     }
 
+    m_sharedCode.Release(m_pDevice);
+
     if (m_perfDataMem.IsBound())
     {
         m_pDevice->MemMgr()->FreeGpuMem(m_perfDataMem.Memory(), m_perfDataMem.Offset());
@@ -210,6 +213,7 @@ Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
         m_pagingFenceVal = pUploader->PagingFenceVal();
         m_gpuMemSize     = pUploader->GpuMemSize();
         m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
+        pUploader->TransferSharedCode(&m_sharedCode);
     }
 
     return result;
@@ -245,6 +249,8 @@ void Pipeline::ExtractPipelineInfo(
 
 // =====================================================================================================================
 // Query this pipeline's Bound GPU Memory.
+// The pipeline's private allocation is always reported first, followed by any code it shares through the device's code
+// heap.
 Result Pipeline::QueryAllocationInfo(
     size_t*                   pNumEntries,
     GpuMemSubAllocInfo* const pGpuMemList
@@ -254,16 +260,34 @@ Result Pipeline::QueryAllocationInfo(
 
     if (pNumEntries != nullptr)
     {
-        (*pNumEntries) = 1;
+        const size_t numAllocations = 1 + m_sharedCode.NumEntries();
 
-        if (pGpuMemList != nullptr)
+        if (pGpuMemList == nullptr)
+        {
+            (*pNumEntries) = numAllocations;
+            result         = Result::Success;
+        }
+        else if ((*pNumEntries) != numAllocations)
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
         {
             pGpuMemList[0].offset     = m_gpuMem.Offset();
             pGpuMemList[0].pGpuMemory = m_gpuMem.Memory();
             pGpuMemList[0].size       = m_gpuMemSize;
-        }
 
-        result = Result::Success;
+            for (uint32 i = 0; i < m_sharedCode.NumEntries(); i++)
+            {
+                const CodeHeapEntry& entry = m_sharedCode.At(i);
+
+                pGpuMemList[i + 1].offset     = entry.offset;
+                pGpuMemList[i + 1].pGpuMemory = entry.pGpuMemory;
+                pGpuMemList[i + 1].size       = entry.size;
+            }
+
+            result = Result::Success;
+        }
     }
 
     return result;
@@ -646,6 +670,9 @@ PipelineUploader::PipelineUploader(
 PipelineUploader::~PipelineUploader()
 {
     PAL_ASSERT(m_pMappedPtr == nullptr); // If this fires, the caller forgot to call End()!
+
+    // Only non-empty if the upload failed before the pipeline could take ownership of the shared code.
+    m_sharedCode.Release(m_pDevice);
 }
 
 // =====================================================================================================================
@@ -748,6 +775,77 @@ GpuHeap PipelineUploader::SelectUploadHeap(
     return m_pipelineHeapType;
 }
 
+// =====================================================================================================================
+// Returns true if the pipeline's code can be placed in the device's shared code heap. Shader code reaches the rest of
+// its code object (e.g., .rodata and .data) through s_getpc_b64 plus a fixed offset, so the code can only be moved away
+// from the pipeline's private allocation if nothing else is loaded: the code object must load exactly one section, it
+// must be executable and no loaded section may be the target of a relocation.
+bool PipelineUploader::CanShareCode() const
+{
+    const ElfReader::Reader& elfReader = m_abiReader.GetElfReader();
+
+    uint32 numLoadedSections = 0;
+    bool   canShare          = (m_sharedCode.IsFull() == false);
+
+    for (ElfReader::SectionId i = 0; canShare && (i < elfReader.GetNumSections()); i++)
+    {
+        const auto& section = elfReader.GetSection(i);
+        const auto  type    = elfReader.GetSectionType(i);
+
+        if (section.sh_flags & Elf::ShfAlloc)
+        {
+            numLoadedSections++;
+
+            canShare = (numLoadedSections == 1)                        &&
+                       ((section.sh_flags & Elf::ShfExecInstr) != 0) &&
+                       (section.sh_size > 0);
+        }
+        else if ((type == Elf::SectionHeaderType::Rel) || (type == Elf::SectionHeaderType::Rela))
+        {
+            // A relocated section depends on where the pipeline is placed in GPU memory.
+            canShare = (section.sh_info >= elfReader.GetNumSections()) ||
+                       ((elfReader.GetSection(section.sh_info).sh_flags & Elf::ShfAlloc) == 0);
+        }
+    }
+
+    return canShare && (numLoadedSections == 1);
+}
+
+// =====================================================================================================================
+// Places a section in the device's shared code heap, reusing an identical copy if one has already been uploaded. On
+// success, pShared reports whether the section was actually shared; if it wasn't, the caller must place the section in
+// the pipeline's private allocation.
+Result PipelineUploader::UploadSharedSection(
+    ElfReader::SectionId sectionId,
+    bool*                pShared)
+{
+    const ElfReader::Reader& elfReader = m_abiReader.GetElfReader();
+    const auto&              section   = elfReader.GetSection(sectionId);
+    const void*const         pData     = elfReader.GetSectionData(sectionId);
+
+    CodeHeapEntry* pEntry = nullptr;
+    Result result = m_pDevice->GetGfxDevice()->GetCodeHeap()->Acquire(pData,
+                                                                       section.sh_size,
+                                                                       section.sh_addralign,
+                                                                       m_pipelineHeapType,
+                                                                       &pEntry);
+
+    *pShared = (pEntry != nullptr);
+
+    if ((result == Result::Success) && (pEntry != nullptr))
+    {
+        m_sharedCode.Add(pEntry);
+
+        // Shared sections are never relocated or patched, so they don't need any CPU-mapped chunks.
+        if (m_memoryMap.AddSection(sectionId, pEntry->gpuVirtAddr, pData) == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Allocates GPU memory for the current pipeline.  Also, maps the memory for CPU access and uploads the pipeline code
 // and data.  The GPU virtual addresses for the code, data, and register segments are also computed.  The caller is
@@ -759,15 +857,39 @@ Result PipelineUploader::Begin(
     const PalSettings& settings = m_pDevice->Settings();
     Result result = Result::Success;
 
+    SelectUploadHeap(heap);
+
+    // Code in the invisible heap is uploaded through the DMA ring, so it can't be shared with other pipelines. Code is
+    // also kept private while developer-mode profiling is possible: RGP locates a pipeline's code through the single
+    // base address recorded in its code object load event.
+    const bool shareCode = settings.enablePipelineCodeDedup                                    &&
+                           (ShouldUploadUsingDma() == false)                                   &&
+                           (m_pDevice->GetPlatform()->IsDevDriverProfilingEnabled() == false) &&
+                           CanShareCode();
+
     SectionAddressCalculator addressCalculator(m_pDevice->GetPlatform());
 
+    bool privateCode = false;
+
     const ElfReader::Reader& elfReader = m_abiReader.GetElfReader();
     for (ElfReader::SectionId i = 0; i < elfReader.GetNumSections(); i++)
     {
         const auto& section = elfReader.GetSection(i);
         if (section.sh_flags & Elf::ShfAlloc)
         {
-            result = addressCalculator.AddSection(elfReader, i);
+            bool shared = false;
+
+            if (shareCode)
+            {
+                result = UploadSharedSection(i, &shared);
+            }
+
+            if ((result == Result::Success) && (shared == false))
+            {
+                privateCode |= ((section.sh_flags & Elf::ShfExecInstr) != 0);
+                result = addressCalculator.AddSection(elfReader, i);
+            }
+
             if (result != Result::Success)
             {
                 break;
@@ -794,13 +916,15 @@ Result PipelineUploader::Begin(
         const gpusize minSafeSize = Pow2Align(m_prefetchSize, ShaderICacheLineSize) +
                                     m_pDevice->ChipProperties().gfxip.shaderPrefetchBytes;
 
-        m_gpuMemSize = Max(m_gpuMemSize, minSafeSize);
+        // If every section was placed in the shared code heap the pipeline still keeps a small private allocation, so
+        // that it always has GPU memory to report and bind.
+        m_gpuMemSize = Max(m_gpuMemSize, Max(minSafeSize, static_cast<gpusize>(ShaderICacheLineSize)));
 
         GpuMemoryCreateInfo createInfo = { };
         createInfo.size      = m_gpuMemSize;
         createInfo.alignment = GpuMemByteAlign;
         createInfo.vaRange   = VaRange::DescriptorTable;
-        createInfo.heaps[0]  = SelectUploadHeap(heap);
+        createInfo.heaps[0]  = m_pipelineHeapType;
         createInfo.heaps[1]  = GpuHeapGartUswc;
         createInfo.heapCount = 2;
         createInfo.priority  = GpuMemPriority::High;
@@ -829,6 +953,12 @@ Result PipelineUploader::Begin(
     {
         m_prefetchGpuVirtAddr = (m_pGpuMemory->Desc().gpuVirtAddr + m_baseOffset);
 
+        // The shared code must be paged in before the pipeline can be used, just like the private allocation.
+        for (uint32 i = 0; i < m_sharedCode.NumEntries(); i++)
+        {
+            m_pagingFenceVal = Max(m_pagingFenceVal, m_sharedCode.At(i).pagingFenceVal);
+        }
+
         if (totalRegisters > 0)
         {
             PAL_ASSERT(pMappedPtr != nullptr);
@@ -858,6 +988,13 @@ Result PipelineUploader::Begin(
             m_pShRegWritePtrStart  = m_pShRegWritePtr;
 #endif
         }
+
+        // Prefetching is meant to warm the instruction cache, so point it at the shader code if that was shared.
+        if ((privateCode == false) && (m_sharedCode.NumEntries() == 1))
+        {
+            m_prefetchGpuVirtAddr = m_sharedCode.At(0).gpuVirtAddr;
+            m_prefetchSize        = m_sharedCode.At(0).size;
+        }
     }
 
     return result;
@@ -966,8 +1103,8 @@ Result PipelineUploader::UploadUsingCpu(
                 break;
             }
 
-            // Copy onto GPU
-            memcpy(pMappedPtr, pSectionData, static_cast<size_t>(sectionSize));
+            // Copy onto GPU. The CPU never reads the mapped pipeline memory back so stream it past the caches.
+            StreamingMemCopy(pMappedPtr, pSectionData, static_cast<size_t>(sectionSize));
 
             if (dataSectionId == section.sectionId)
             {
@@ -30,6 +30,7 @@
 #include "core/device.h"
 #include "core/gpuMemory.h"
 #include "core/dmaUploadRing.h"
+#include "core/hw/gfxip/codeHeap.h"
 #include "palElfPackager.h"
 #include "palElfReader.h"
 #include "palLib.h"
@@ -196,6 +197,7 @@ protected:
 
     BoundGpuMemory  m_gpuMem;
     gpusize         m_gpuMemSize;
+    CodeHeapRefs    m_sharedCode;       // Code sections which live in the device's shared code heap.
 
     void*   m_pPipelineBinary;      // Buffer containing the pipeline binary data (Pipeline ELF ABI).
     size_t  m_pipelineBinaryLen;    // Size of the pipeline binary data, in bytes.
@@ -385,6 +387,9 @@ public:
 
     uint64 PagingFenceVal() const { return m_pagingFenceVal; }
 
+    // Hands the references to any code sections placed in the shared code heap over to the pipeline or library.
+    void TransferSharedCode(CodeHeapRefs* pDst) { m_sharedCode.MoveTo(pDst); }
+
     gpusize CtxRegGpuVirtAddr() const { return m_ctxRegGpuVirtAddr; }
     gpusize ShRegGpuVirtAddr() const { return m_shRegGpuVirtAddr; }
 
@@ -433,6 +438,9 @@ private:
 
     GpuHeap SelectUploadHeap(GpuHeap heap);
 
+    bool CanShareCode() const;
+    Result UploadSharedSection(Util::ElfReader::SectionId sectionId, bool* pShared);
+
     bool ShouldUploadUsingDma() const { return (m_pipelineHeapType == GpuHeap::GpuHeapInvisible); }
 
     Result UploadUsingCpu(const SectionAddressCalculator& addressCalc, void** ppMappedPtr);
@@ -449,6 +457,8 @@ private:
     gpusize     m_prefetchSize;
 
     SectionMemoryMap m_memoryMap;
+    CodeHeapRefs     m_sharedCode;  // Sections placed in the shared code heap instead of m_pGpuMemory.
+
     gpusize  m_ctxRegGpuVirtAddr;
     gpusize  m_shRegGpuVirtAddr;
 
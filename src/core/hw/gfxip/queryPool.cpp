@@ -27,6 +27,7 @@
 #include "core/eventDefs.h"
 #include "core/hw/gfxip/gfxCmdBuffer.h"
 #include "core/hw/gfxip/queryPool.h"
+#include "palMemCopy.h"
 
 using namespace Util;
 
@@ -283,7 +284,10 @@ Result QueryPool::DoReset(
                 const size_t timestampOffset = static_cast<size_t>(m_timestampStartOffset);
                 void* const  pTimestampData  = VoidPtrInc(pGpuData, timestampOffset + timestampSize * startQuery);
 
-                memset(pTimestampData, 0, timestampSize * queryCount);
+                // Query memory is usually write-combined so stream the zeroes rather than pulling it into the cache.
+                StreamingMemFill32(static_cast<uint32*>(pTimestampData),
+                                   0,
+                                   (timestampSize * queryCount) / sizeof(uint32));
             }
 
             if (pMappedCpuAddr == nullptr)
@@ -42,6 +42,7 @@
 #include "core/hw/gfxip/rpm/rpmUtil.h"
 #include "core/hw/gfxip/rpm/gfx6/gfx6RsrcProcMgr.h"
 #include "palAutoBuffer.h"
+#include "palMemCopy.h"
 
 #include <float.h>
 
@@ -538,7 +539,8 @@ void RsrcProcMgr::CmdUpdateMemory(
                                                                 embeddedDataAlign,
                                                                 &dmaDataInfo.srcAddr);
 
-        memcpy(pBufStart, pRemainingSrcData, dmaDataInfo.numBytes);
+        // Embedded data lives in command chunk memory which is normally write-combined, so use streaming stores.
+        StreamingMemCopy(pBufStart, pRemainingSrcData, dmaDataInfo.numBytes);
 
         // Write the DMA_DATA packet to the command stream.
         uint32* pCmdSpace = pStream->ReserveCommands();
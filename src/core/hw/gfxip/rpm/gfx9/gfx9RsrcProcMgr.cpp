@@ -45,6 +45,7 @@
 #include "core/hw/gfxip/rpm/rpmUtil.h"
 #include "palAutoBuffer.h"
 #include "palDepthStencilView.h"
+#include "palMemCopy.h"
 
 #include <float.h>
 
@@ -494,7 +495,8 @@ void RsrcProcMgr::CmdUpdateMemory(
                                                                 EmbeddedDataAlign,
                                                                 &dmaDataInfo.srcAddr);
 
-        memcpy(pBufStart, pRemainingSrcData, dmaDataInfo.numBytes);
+        // Embedded data lives in command chunk memory which is normally write-combined, so use streaming stores.
+        StreamingMemCopy(pBufStart, pRemainingSrcData, dmaDataInfo.numBytes);
 
         // Write the DMA_DATA packet to the command stream.
         uint32* pCmdSpace = pStream->ReserveCommands();
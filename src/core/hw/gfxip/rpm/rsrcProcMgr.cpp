@@ -270,6 +270,17 @@ void RsrcProcMgr::CopyMemoryCs(
     // Save current command buffer state.
     pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
+    // Each copy section needs a destination and source buffer view. Rather than allocating and binding a tiny table for
+    // every section we write the views for a whole batch of sections into one embedded data table and only rebind user
+    // data entry 0 to each section's slice of it.
+    const uint32 srdTableDwords   = SrdDwordAlignment() * NumGpuMemory;
+    const uint32 maxBatchSections = Max(pCmdBuffer->GetEmbeddedDataLimit() / srdTableDwords, 1u);
+
+    uint32*                pSrdTable         = nullptr;
+    gpusize                srdTableAddr      = 0;
+    uint32                 batchSectionsLeft = 0;
+    const ComputePipeline* pBoundPipeline    = nullptr;
+
     // Now begin processing the list of copy regions.
     for (uint32 idx = 0; idx < regionCount; ++idx)
     {
@@ -278,21 +289,43 @@ void RsrcProcMgr::CopyMemoryCs(
             pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
         }
 
-        const gpusize srcOffset  = pRegions[idx].srcOffset;
-        const gpusize dstOffset  = pRegions[idx].dstOffset;
-        const gpusize copySize   = pRegions[idx].copySize;
+        const gpusize srcOffset = pRegions[idx].srcOffset;
+        const gpusize dstOffset = pRegions[idx].dstOffset;
+        gpusize       copySize  = pRegions[idx].copySize;
 
-        for(gpusize copyOffset = 0; copyOffset < copySize; copyOffset += CopySizeLimit)
+        // Streaming uploads often arrive as long runs of regions which continue exactly where the previous one ended.
+        // There are no barriers between our dispatches so we can fold such runs into a single region. The P2P
+        // workaround needs to see each of its chunks so we leave those regions alone.
+        if (p2pBltInfoRequired == false)
+        {
+            while (((idx + 1) < regionCount)                                   &&
+                   (pRegions[idx + 1].srcOffset == (srcOffset + copySize)) &&
+                   (pRegions[idx + 1].dstOffset == (dstOffset + copySize)))
+            {
+                ++idx;
+                copySize += pRegions[idx].copySize;
+            }
+        }
+
+        for (gpusize copyOffset = 0; copyOffset < copySize; copyOffset += CopySizeLimit)
         {
             const uint32 copySectionSize = static_cast<uint32>(Min(CopySizeLimit, copySize - copyOffset));
 
-            // Create an embedded user-data table and bind it to user data. We need buffer views for the source and
-            // destination.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       SrdDwordAlignment() * NumGpuMemory,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
+            if (batchSectionsLeft == 0)
+            {
+                // Size the next batch for the rest of this region plus one section for each remaining region.
+                const gpusize sectionsLeft = RoundUpQuotient(copySize - copyOffset, CopySizeLimit) +
+                                             (regionCount - idx - 1);
+
+                batchSectionsLeft = static_cast<uint32>(Min<gpusize>(sectionsLeft, maxBatchSections));
+                pSrdTable         = pCmdBuffer->CmdAllocateEmbeddedData(srdTableDwords * batchSectionsLeft,
+                                                                        SrdDwordAlignment(),
+                                                                        &srdTableAddr);
+                PAL_ASSERT(pSrdTable != nullptr);
+            }
+
+            const uint32 srdTableAddrLo = LowPart(srdTableAddr);
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 1, &srdTableAddrLo);
 
             // Populate the table with raw buffer views, by convention the destination is placed before the source.
             BufferViewInfo rawBufferView = {};
@@ -301,13 +334,16 @@ void RsrcProcMgr::CopyMemoryCs(
                                             dstOffset + copyOffset,
                                             copySectionSize);
             m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
-            pSrdTable += SrdDwordAlignment();
 
             RpmUtil::BuildRawBufferViewInfo(&rawBufferView,
                                             srcGpuMemory,
                                             srcOffset + copyOffset,
                                             copySectionSize);
-            m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+            m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable + SrdDwordAlignment());
+
+            pSrdTable    += srdTableDwords;
+            srdTableAddr += srdTableDwords * sizeof(uint32);
+            batchSectionsLeft--;
 
             const uint32 regionUserData[3] = { 0, 0, copySectionSize };
             pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, regionUserData);
@@ -332,8 +368,13 @@ void RsrcProcMgr::CopyMemoryCs(
                 numThreadGroups = RpmUtil::MinThreadGroups(copySectionSize, pPipeline->ThreadsPerGroup());
             }
 
-            // Bind pipeline and dispatch.
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, InternalApiPsoHash, });
+            // Bind pipeline (only if it changed since the last section) and dispatch.
+            if (pPipeline != pBoundPipeline)
+            {
+                pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, InternalApiPsoHash, });
+                pBoundPipeline = pPipeline;
+            }
+
             pCmdBuffer->CmdDispatch(numThreadGroups, 1, 1);
         }
     }
@@ -214,6 +214,7 @@ Result ShaderLibrary::PerformRelocationsAndUploadToGpuMemory(
         m_pagingFenceVal = pUploader->PagingFenceVal();
         m_gpuMemSize     = pUploader->GpuMemSize();
         m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
+        pUploader->TransferSharedCode(&m_sharedCode);
     }
 
     return result;
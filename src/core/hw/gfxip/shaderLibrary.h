@@ -99,6 +99,7 @@ protected:
     virtual ~ShaderLibrary()
     {
         PAL_SAFE_FREE(m_pCodeObjectBinary, m_pDevice->GetPlatform());
+        m_sharedCode.Release(m_pDevice);
     }
 
     virtual Result HwlInit(
@@ -126,6 +127,7 @@ protected:
 
     BoundGpuMemory  m_gpuMem;
     gpusize         m_gpuMemSize;
+    CodeHeapRefs    m_sharedCode;           // Code sections which live in the device's shared code heap.
     uint32          m_maxStackSizeInBytes;
 
     UploadFenceToken  m_uploadFenceToken;
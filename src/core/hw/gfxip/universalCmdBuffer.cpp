@@ -71,6 +71,13 @@ UniversalCmdBuffer::UniversalCmdBuffer(
 
     SwitchCmdSetUserDataFunc(PipelineBindPoint::Compute,  &GfxCmdBuffer::CmdSetUserDataCs);
     SwitchCmdSetUserDataFunc(PipelineBindPoint::Graphics, &CmdSetUserDataGfx<true>);
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    // Hardware layers which can validate a batch of draws more efficiently than one draw at a time will overwrite
+    // these function pointers.
+    m_funcTable.pfnCmdDrawMulti        = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti = CmdDrawIndexedMulti;
+#endif
 }
 
 // =====================================================================================================================
@@ -556,6 +563,9 @@ void UniversalCmdBuffer::PushGraphicsState()
     m_graphicsStateIsPushed = true;
 #endif
 
+    // Any barriers the client deferred must execute before RPM's internal work.
+    BeginBarrierDeferralBlock();
+
     m_graphicsRestoreState = m_graphicsState;
     memset(&m_graphicsState.gfxUserDataEntries.touched[0], 0, sizeof(m_graphicsState.gfxUserDataEntries.touched));
 
@@ -602,6 +612,8 @@ void UniversalCmdBuffer::PopGraphicsState()
         // Inform the performance experiment that we've finished some internal operations.
         m_pCurrentExperiment->EndInternalOps(m_pDeCmdStream);
     }
+
+    EndBarrierDeferralBlock();
 }
 
 // =====================================================================================================================
@@ -818,4 +830,62 @@ uint32 UniversalCmdBuffer::GetUsedSize(
     return sizeInBytes;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+// Generic implementation of CmdDrawMulti: issues each draw in the batch through the regular CmdSetUserData and CmdDraw
+// paths, so every draw goes through full draw-time validation.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawMulti(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    PAL_ASSERT((drawCount == 0) || (pDraws != nullptr));
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const MultiDrawInfo& draw = pDraws[i];
+
+        if (draw.entryCount != 0)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics,
+                                       draw.firstEntry,
+                                       draw.entryCount,
+                                       draw.pEntryValues);
+        }
+
+        pCmdBuffer->CmdDraw(draw.firstVertex, draw.vertexCount, draw.firstInstance, draw.instanceCount);
+    }
+}
+
+// =====================================================================================================================
+// Generic implementation of CmdDrawIndexedMulti: issues each draw in the batch through the regular CmdSetUserData and
+// CmdDrawIndexed paths, so every draw goes through full draw-time validation.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    PAL_ASSERT((drawCount == 0) || (pDraws != nullptr));
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const MultiDrawIndexedInfo& draw = pDraws[i];
+
+        if (draw.entryCount != 0)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics,
+                                       draw.firstEntry,
+                                       draw.entryCount,
+                                       draw.pEntryValues);
+        }
+
+        pCmdBuffer->CmdDrawIndexed(draw.firstIndex,
+                                   draw.indexCount,
+                                   draw.vertexOffset,
+                                   draw.firstInstance,
+                                   draw.instanceCount);
+    }
+}
+#endif
+
 } // Pal
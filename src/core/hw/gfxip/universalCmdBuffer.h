@@ -307,6 +307,17 @@ protected:
 
     bool FilterSetUserDataGfx(UserDataArgs* pUserDataArgs);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws);
+#endif
+
     virtual void SetGraphicsState(const GraphicsState& newGraphicsState);
 
     GraphicsState  m_graphicsState;        // Currently bound graphics command buffer state.
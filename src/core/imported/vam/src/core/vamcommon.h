@@ -44,12 +44,12 @@ struct VAM_ALLOCATION
     VAM_VA_SIZE             size;       // allocation's actual size
 };
 
-struct VamChunk : public VamObject, public VamLink<VamChunk>, public VamTreeNode<VamChunk>
+struct VamChunk : public VamObject, public VamLink<VamChunk>, public VamTreeNode<VamChunk, VAM_VA_SIZE>
 {
     VamChunk(VAM_CLIENT_HANDLE hClient)
     :   VamObject(hClient),
         VamLink<VamChunk>(),
-        VamTreeNode<VamChunk>()
+        VamTreeNode<VamChunk, VAM_VA_SIZE>()
     {
         m_addr = 0;
         m_size = 0;
@@ -57,6 +57,7 @@ struct VamChunk : public VamObject, public VamLink<VamChunk>, public VamTreeNode
     ~VamChunk() {}
 
     VAM_VA_SIZE& value() { return m_addr; }
+    VAM_VA_SIZE  size() const { return m_size; }
 
     VAM_VIRTUAL_ADDRESS     m_addr;
     VAM_VA_SIZE             m_size;
@@ -38,8 +38,6 @@ VAM_RETURNCODE VamVARange::AllocateVASpace(
     VAM_ALLOCATION&     allocation)
 {
     VAM_RETURNCODE  ret = VAM_OUTOFMEMORY;
-    VAM_VA_SIZE     remainder, adjustment;
-    VamChunk*       pExtraChunk;
 
     if (!sizeInBytes)
     {
@@ -47,93 +45,154 @@ VAM_RETURNCODE VamVARange::AllocateVASpace(
         return VAM_INVALIDPARAMETERS;
     }
 
-    // Iterate through all chunks, looking for first one that's big enough
-    for (ChunkList::Iterator chunk( chunkList() );
-         chunk != NULL;
-         chunk++ )
+    if (m_treeEnabled)
     {
-        if (sizeInBytes <= chunk->m_size)
+        // Visit the chunks that are big enough in address order, as the list walk below does, but skip over every
+        // chunk that is too small in logarithmic time.
+        VamChunk*   pChunk     = chunkTree().findFirstFit(sizeInBytes);
+        UINT        probeCount = 0;
+
+        while ((pChunk != NULL) && !CarveChunk(pChunk, sizeInBytes, alignment, allocation, ret))
         {
-            // This chunk is a possible candidate, provided
-            // that the alignment requirement is met.
-            remainder = chunk->m_addr % alignment;
-            if (remainder == 0)
+            if (++probeCount == MaxAlignmentProbes)
             {
-                // Both size and alignment are OK at the start of the chunk.
-                // Adjust the chunk's parameters and exit with success.
-                allocation.address = chunk->m_addr;
-                allocation.size    = sizeInBytes;
-                chunk->m_addr     += sizeInBytes;
-                chunk->m_size     -= sizeInBytes;
-                if (!chunk->m_size)
-                {
-                    // The allocation has the exact size as the chunk.
-                    chunkList().remove(chunk);
+                // Too many chunks in a row are big enough but can't satisfy the alignment. Take the lowest chunk
+                // which is big enough to satisfy any alignment instead, so the search stays logarithmic.
+                VamChunk* pFitChunk = chunkTree().findFirstFit(sizeInBytes + alignment - 1);
 
-                    if (m_treeEnabled)
-                    {
-                        chunkTree().remove(chunk);
-                    }
-                    FreeChunk(chunk);
+                if (pFitChunk != NULL)
+                {
+                    const bool carved = CarveChunk(pFitChunk, sizeInBytes, alignment, allocation, ret);
+                    VAM_ASSERT(carved);
+                    break;
                 }
-                ret = VAM_OK;
+            }
+
+            pChunk = chunkTree().findNextFit(pChunk, sizeInBytes);
+        }
+    }
+    else
+    {
+        // Iterate through all chunks, looking for first one that's big enough
+        for (ChunkList::Iterator chunk( chunkList() );
+             chunk != NULL;
+             chunk++ )
+        {
+            if (CarveChunk(chunk, sizeInBytes, alignment, allocation, ret))
+            {
                 break;
             }
-            else
+        }
+    }
+
+    if (ret == VAM_OK)
+    {
+        decFreeSize(allocation.size);
+
+        // Alignment padding splits chunks, so allocations alone can fragment the range.
+        EnableTreeIfFragmented();
+    }
+
+    return ret;
+}
+
+bool VamVARange::CarveChunk(
+    VamChunk*           pChunk,
+    VAM_VA_SIZE         sizeInBytes,
+    VAM_VA_SIZE         alignment,
+    VAM_ALLOCATION&     allocation,
+    VAM_RETURNCODE&     ret)
+{
+    bool            suitable = false;
+    VAM_VA_SIZE     remainder, adjustment;
+    VamChunk*       pExtraChunk;
+
+    if (sizeInBytes <= pChunk->m_size)
+    {
+        // This chunk is a possible candidate, provided
+        // that the alignment requirement is met.
+        remainder = pChunk->m_addr % alignment;
+        if (remainder == 0)
+        {
+            // Both size and alignment are OK at the start of the chunk.
+            // Adjust the chunk's parameters and exit with success.
+            allocation.address = pChunk->m_addr;
+            allocation.size    = sizeInBytes;
+            pChunk->m_addr    += sizeInBytes;
+            pChunk->m_size    -= sizeInBytes;
+            if (!pChunk->m_size)
+            {
+                // The allocation has the exact size as the chunk.
+                chunkList().remove(pChunk);
+
+                if (m_treeEnabled)
+                {
+                    chunkTree().remove(pChunk);
+                }
+                FreeChunk(pChunk);
+            }
+            else if (m_treeEnabled)
             {
-                // See if the chunk's size is large enough to achieve the req'd alignment
-                adjustment = alignment - remainder;
-                if ((sizeInBytes + adjustment) <= chunk->m_size)
+                chunkTree().update(pChunk);
+            }
+            ret      = VAM_OK;
+            suitable = true;
+        }
+        else
+        {
+            // See if the chunk's size is large enough to achieve the req'd alignment
+            adjustment = alignment - remainder;
+            if ((sizeInBytes + adjustment) <= pChunk->m_size)
+            {
+                // If the aligned allocation is smaller than the remainder of the chunk,
+                // we'll need to create a new chunk to the right of the allocation.
+                if ((sizeInBytes + adjustment) < pChunk->m_size)
                 {
-                    // If the aligned allocation is smaller than the remainder of the chunk,
-                    // we'll need to create a new chunk to the right of the allocation.
-                    if ((sizeInBytes + adjustment) < chunk->m_size)
+                    // Split what remains of the chunk. We need to create
+                    // an extra chunk to reflect the remaining free space.
+                    pExtraChunk = AllocChunk();
+                    if (pExtraChunk != NULL)
                     {
-                        // Split what remains of the chunk. We need to create
-                        // an extra chunk to reflect the remaining free space.
-                        pExtraChunk = AllocChunk();
-                        if (pExtraChunk != NULL)
+                        // Reflect the extra chunk's properties and add it to the list
+                        pExtraChunk->m_addr = pChunk->m_addr + adjustment + sizeInBytes;
+                        pExtraChunk->m_size = pChunk->m_size - (adjustment + sizeInBytes);
+                        chunkList().insertAfter(pChunk, pExtraChunk);
+
+                        // Adjust the existing chunk to the left of the allocation.
+                        // Note that its starting address remains unaltered.
+                        pChunk->m_size      = adjustment;
+
+                        if (m_treeEnabled)
                         {
-                            // Reflect the extra chunk's properties and add it to the list
-                            pExtraChunk->m_addr = chunk->m_addr + adjustment + sizeInBytes;
-                            pExtraChunk->m_size = chunk->m_size - (adjustment + sizeInBytes);
-                            chunkList().insertAfter(chunk, pExtraChunk);
-
-                            if (m_treeEnabled)
-                            {
-                                chunkTree().insert(pExtraChunk);
-                            }
-
-                            // Adjust the existing chunk to the left of the allocation.
-                            // Note that its starting address remains unaltered.
-                            chunk->m_size       = adjustment;
-
-                            allocation.address  = chunk->m_addr + adjustment;
-                            allocation.size     = sizeInBytes;
-                            ret = VAM_OK;
+                            chunkTree().update(pChunk);
+                            chunkTree().insert(pExtraChunk);
                         }
+
+                        allocation.address  = pChunk->m_addr + adjustment;
+                        allocation.size     = sizeInBytes;
+                        ret = VAM_OK;
                     }
-                    else
+                }
+                else
+                {
+                    // Allocation fits completely in the rest of the existing chunk.
+                    // Adjust the chunk's size only, since its address will remain as is.
+                    allocation.address = pChunk->m_addr + adjustment;
+                    allocation.size    = sizeInBytes;
+                    pChunk->m_size     = adjustment;
+
+                    if (m_treeEnabled)
                     {
-                        // Allocation fits completely in the rest of the existing chunk.
-                        // Adjust the chunk's size only, since its address will remain as is.
-                        allocation.address = chunk->m_addr + adjustment;
-                        allocation.size    = sizeInBytes;
-                        chunk->m_size      = adjustment;
-                        ret = VAM_OK;
+                        chunkTree().update(pChunk);
                     }
-                    break;
+                    ret = VAM_OK;
                 }
+                suitable = true;
             }
         }
     }
 
-    if (ret == VAM_OK)
-    {
-        decFreeSize(allocation.size);
-    }
-
-    return ret;
+    return suitable;
 }
 
 VAM_RETURNCODE VamVARange::AllocateVASpaceWithAddress(
@@ -204,6 +263,10 @@ VAM_RETURNCODE VamVARange::AllocateVASpaceWithAddress(
                     }
                     FreeChunk(chunk);
                 }
+                else if (m_treeEnabled)
+                {
+                    chunkTree().update(chunk);
+                }
                 ret = VAM_OK;
                 break;
             }
@@ -223,15 +286,16 @@ VAM_RETURNCODE VamVARange::AllocateVASpaceWithAddress(
                         pExtraChunk->m_size = chunk->m_size - (offsetVA + adjustedSize);
                         chunkList().insertAfter(chunk, pExtraChunk);
 
+                        // Adjust the existing chunk to the left of the allocation.
+                        // Note that its starting address remains unaltered.
+                        chunk->m_size       = offsetVA;
+
                         if (m_treeEnabled)
                         {
+                            chunkTree().update(chunk);
                             chunkTree().insert(pExtraChunk);
                         }
 
-                        // Adjust the existing chunk to the left of the allocation.
-                        // Note that its starting address remains unaltered.
-                        chunk->m_size       = offsetVA;
-
                         allocation.address  = startVA;
                         allocation.size     = adjustedSize;
                         ret = VAM_OK;
@@ -248,6 +312,11 @@ VAM_RETURNCODE VamVARange::AllocateVASpaceWithAddress(
                     allocation.address = startVA;
                     allocation.size    = adjustedSize;
                     chunk->m_size      = offsetVA;
+
+                    if (m_treeEnabled)
+                    {
+                        chunkTree().update(chunk);
+                    }
                     ret = VAM_OK;
                 }
                 break;
@@ -258,6 +327,7 @@ VAM_RETURNCODE VamVARange::AllocateVASpaceWithAddress(
     if (ret == VAM_OK)
     {
         decFreeSize(allocation.size);
+        EnableTreeIfFragmented();
     }
     else
     {
@@ -284,24 +354,27 @@ VAM_RETURNCODE VamVARange::FreeVASpace(
     {
         ret = FreeVASpaceWithTreeDisabled(virtualAddress, actualSize);
 
-        const unsigned int threshold = 256;
+        EnableTreeIfFragmented();
+    }
+
+    return ret;
+}
 
-        // When number of chunks in the list is greater than our threshold,
-        // build chunk tree to optimzie VA free performance.
-        if (chunkList().numObjects() >= threshold)
+// When number of chunks in the list reaches our threshold, build the chunk tree to make allocation and free
+// logarithmic. The tree is kept from then on.
+void VamVARange::EnableTreeIfFragmented(void)
+{
+    if (!m_treeEnabled && (chunkList().numObjects() >= TreeThreshold))
+    {
+        for (ChunkList::Iterator chunk(chunkList());
+             chunk != NULL;
+             chunk++)
         {
-            for (ChunkList::Iterator chunk(chunkList());
-                 chunk != NULL;
-                 chunk++)
-            {
-                chunkTree().insert(chunk);
-            }
-
-            m_treeEnabled = true;
+            chunkTree().insert(chunk);
         }
-    }
 
-    return ret;
+        m_treeEnabled = true;
+    }
 }
 
 VAM_RETURNCODE VamVARange::FreeVASpaceWithTreeDisabled(
@@ -493,7 +566,11 @@ VAM_RETURNCODE VamVARange::FreeVASpaceWithTreeEnabled(
     adjustedVA   = ROUND_DOWN(virtualAddress, (long long) alignmentGranularity());
     adjustedSize = ROUND_UP(actualSize, (long long) alignmentGranularity());
 
-    chunkTree().findContainingNodes(adjustedVA, &pChunkL, &pChunkR);
+    // The tree is empty while the whole range is allocated, in which case there's nothing to coalesce with.
+    if (chunkTree().numObjects() > 0)
+    {
+        chunkTree().findContainingNodes(adjustedVA, &pChunkL, &pChunkR);
+    }
 
     if (pChunkL && IsVASpaceInsideChunk(adjustedVA, adjustedSize, pChunkL))
     {
@@ -519,11 +596,14 @@ VAM_RETURNCODE VamVARange::FreeVASpaceWithTreeEnabled(
                 FreeChunk(pChunkR);
             }
         }
+
+        chunkTree().update(pChunkL);
     }
     else if (pChunkR && (adjustedVA + adjustedSize == pChunkR->m_addr))
     {
         pChunkR->m_addr -= adjustedSize;
         pChunkR->m_size += adjustedSize;
+        chunkTree().update(pChunkR);
     }
     else
     {
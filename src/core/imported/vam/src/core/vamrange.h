@@ -132,6 +132,20 @@ public:
         VAM_ALLOCATION&         allocation,
         bool                    beyondBaseVA = false);
 private:
+    // Number of big enough but misaligned chunks AllocateVASpace will try in address order before it settles for the
+    // lowest chunk which fits any alignment.
+    static const UINT MaxAlignmentProbes = 16;
+
+    // Number of free chunks at which the range starts indexing them with the chunk tree.
+    static const UINT TreeThreshold = 256;
+
+    bool CarveChunk(
+        VamChunk*               pChunk,
+        VAM_VA_SIZE             sizeInBytes,
+        VAM_VA_SIZE             alignment,
+        VAM_ALLOCATION&         allocation,
+        VAM_RETURNCODE&         ret);
+
     VAM_RETURNCODE FreeVASpaceWithTreeEnabled(
         VAM_VIRTUAL_ADDRESS     virtualAddress,
         VAM_VA_SIZE             actualSize);
@@ -140,6 +154,8 @@ private:
         VAM_VIRTUAL_ADDRESS     virtualAddress,
         VAM_VA_SIZE             actualSize);
 
+    void EnableTreeIfFragmented(void);
+
 private:
     VAM_VIRTUAL_ADDRESS     m_addr;                 // Starting address of VA range to be managed
     VAM_VA_SIZE             m_size;                 // Size of VA range to be managed
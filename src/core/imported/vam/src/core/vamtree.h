@@ -40,8 +40,9 @@ enum VamNodeColor
     Red
 };
 
-/// Describes a node in a tree.
-template< class C > struct VamTreeNode
+/// Describes a node in a tree.  S is the type of the size each node reports through C::size(); every node tracks the
+/// largest size in its subtree so that the tree can find nodes of a given minimum size in logarithmic time.
+template< class C, typename S > struct VamTreeNode
 {
 private:
     /** Pointer to the left child object in the tree.*/
@@ -55,6 +56,9 @@ private:
 
     /** Color of the node.*/
     VamNodeColor m_color;
+
+    /** Largest size of any node in the subtree rooted at this node.*/
+    S            m_maxSize;
 public:
     /** Constructor */
     VamTreeNode(void)
@@ -63,6 +67,7 @@ public:
         m_pRightChild = NULL;
         m_pParent = NULL;
         m_color = VamNodeColor::Black;
+        m_maxSize = 0;
     };
 
     /** Returns the left child in the tree.*/
@@ -80,6 +85,10 @@ public:
     /** Returns node color.*/
     VamNodeColor& color(void)
     { return m_color; };
+
+    /** Returns the largest size in the subtree rooted at this node.*/
+    S& maxSize(void)
+    { return m_maxSize; };
 };
 
 template< class C, typename T > class VamTree
@@ -128,6 +137,42 @@ public:
         }
     }
 
+    /// Returns the node with the lowest value whose size is at least minSize, or NULL if there is none.
+    C* findFirstFit(T minSize) const
+    {
+        return findFirstFitInSubtree(m_pRoot, minSize);
+    }
+
+    /// Returns the node with the lowest value above pNode's whose size is at least minSize, or NULL if there is none.
+    C* findNextFit(C* pNode, T minSize) const
+    {
+        C* pFound = findFirstFitInSubtree(pNode->rightChild(), minSize);
+
+        // Climb until we arrive at an ancestor from its left subtree; the ancestor and its right subtree are the next
+        // candidates in value order.  Only the first subtree which is known to contain a fit is descended into.
+        while ((pFound == nullptr) && (pNode->parent() != getNull()))
+        {
+            C* pParent = pNode->parent();
+
+            if (pNode == pParent->leftChild())
+            {
+                pFound = (pParent->size() >= minSize) ? pParent
+                                                      : findFirstFitInSubtree(pParent->rightChild(), minSize);
+            }
+
+            pNode = pParent;
+        }
+
+        return pFound;
+    }
+
+    /// Must be called after the size of pNode has changed.  Changing a node's value is only allowed if it doesn't
+    /// change the node's position in value order.
+    void update(C* pNode)
+    {
+        updateMaxSizeToRoot(pNode);
+    }
+
     /// Inserts the specified value into the red-black tree.
     void insert(C* pNode)
     {
@@ -135,6 +180,7 @@ public:
         pNode->rightChild() = getNull();
         pNode->parent() = getNull();
         pNode->color() = VamNodeColor::Red;
+        pNode->maxSize() = pNode->size();
 
         // Inserts the new node into the tree as a binary search tree.
         C* pX = m_pRoot;
@@ -171,6 +217,8 @@ public:
             pNode->parent() = pY;
         }
 
+        updateMaxSizeToRoot(pY);
+
         // Fix possible violation of property 3.
         insertFixup(pNode);
 
@@ -210,6 +258,10 @@ public:
                 }
             }
 
+            // The path from the removed position up contains every node whose subtree changed, including the node
+            // that was swapped into pNode's old position above.
+            updateMaxSizeToRoot(pTemp->parent());
+
             if (pNode->color() == VamNodeColor::Black)
             {
                 removeFixup(pTemp);
@@ -223,6 +275,63 @@ private:
     /// Returns a pointer to the null (leaf) node - null node's parent info might be change in deletion.
     C* getNull() const { return const_cast<C*>(&m_null); }
 
+    /// Returns the node with the lowest value in the subtree rooted at pX whose size is at least minSize.
+    C* findFirstFitInSubtree(C* pX, T minSize) const
+    {
+        C* pFound = nullptr;
+
+        // The null node's maximum size is always zero, so an empty subtree never fits.
+        if (pX->maxSize() >= minSize)
+        {
+            while (pFound == nullptr)
+            {
+                if (pX->leftChild()->maxSize() >= minSize)
+                {
+                    pX = pX->leftChild();
+                }
+                else if (pX->size() >= minSize)
+                {
+                    pFound = pX;
+                }
+                else
+                {
+                    // By elimination, the fit must be in the right subtree.
+                    pX = pX->rightChild();
+                }
+            }
+        }
+
+        return pFound;
+    }
+
+    /// Recomputes the maximum subtree size of pNode from its own size and those of its children.
+    void updateMaxSize(C* pNode)
+    {
+        T maxSize = pNode->size();
+
+        if (pNode->leftChild()->maxSize() > maxSize)
+        {
+            maxSize = pNode->leftChild()->maxSize();
+        }
+
+        if (pNode->rightChild()->maxSize() > maxSize)
+        {
+            maxSize = pNode->rightChild()->maxSize();
+        }
+
+        pNode->maxSize() = maxSize;
+    }
+
+    /// Recomputes the maximum subtree size of pNode and all of its ancestors.
+    void updateMaxSizeToRoot(C* pNode)
+    {
+        while (pNode != getNull())
+        {
+            updateMaxSize(pNode);
+            pNode = pNode->parent();
+        }
+    }
+
     C* Prev(C* pNode) const
     {
         C* pPrev = pNode;
@@ -494,6 +603,10 @@ private:
         {
             pC->parent() = pA;
         }
+
+        // A is now B's child, so it must be updated first.
+        updateMaxSize(pA);
+        updateMaxSize(pB);
     }
     void RightRotate(C* pA)
     {
@@ -534,6 +647,10 @@ private:
         {
             pC->parent() = pA;
         }
+
+        // A is now B's child, so it must be updated first.
+        updateMaxSize(pA);
+        updateMaxSize(pB);
     }
     void SwapNodeTopology(C* pA, C* pB)
     {
@@ -933,6 +933,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDraw                      = CmdDraw;
     m_funcTable.pfnCmdDrawOpaque                = CmdDrawOpaque;
     m_funcTable.pfnCmdDrawIndexed               = CmdDrawIndexed;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti                 = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti          = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDrawIndirectMulti         = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti  = CmdDrawIndexedIndirectMulti;
     m_funcTable.pfnCmdDispatch                  = CmdDispatch;
@@ -3137,6 +3141,83 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexed(
     pThis->HandleDrawDispatch(Developer::DrawDispatchType::CmdDrawIndexed);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+// The single-step and draw info features of this layer operate on individual draws, so batched draws are split back
+// into their component CmdSetUserData() and CmdDraw() calls, which are then logged normally.
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    if (pThis->m_annotations.logCmdDraws)
+    {
+        pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawMulti));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(pThis->Allocator(), false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "Draw Count     = 0x%08x", drawCount);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const MultiDrawInfo& draw = pDraws[i];
+
+        if (draw.entryCount != 0)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, draw.firstEntry, draw.entryCount, draw.pEntryValues);
+        }
+
+        pCmdBuffer->CmdDraw(draw.firstVertex, draw.vertexCount, draw.firstInstance, draw.instanceCount);
+    }
+}
+
+// =====================================================================================================================
+// See CmdDrawMulti() for why the batch is split into individual draws.
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    if (pThis->m_annotations.logCmdDraws)
+    {
+        pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawIndexedMulti));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(pThis->Allocator(), false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "Draw Count     = 0x%08x", drawCount);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const MultiDrawIndexedInfo& draw = pDraws[i];
+
+        if (draw.entryCount != 0)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, draw.firstEntry, draw.entryCount, draw.pEntryValues);
+        }
+
+        pCmdBuffer->CmdDrawIndexed(draw.firstIndex,
+                                   draw.indexCount,
+                                   draw.vertexOffset,
+                                   draw.firstInstance,
+                                   draw.instanceCount);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDrawIndirectMulti(
     ICmdBuffer*       pCmdBuffer,
@@ -4798,6 +4879,45 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     PAL_SAFE_DELETE_ARRAY(ppNextCmdBuffers, &allocator);
 }
 
+// =====================================================================================================================
+void CmdBuffer::CmdDeclarePatchSlot(
+    const CmdPatchSlotInfo& slotInfo)
+{
+    if (m_annotations.logMiscellaneous)
+    {
+        GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDeclarePatchSlot));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(&m_allocator, false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "slotId = %u, type = %u, userDataEntry = %u",
+                 slotInfo.slotId, static_cast<uint32>(slotInfo.type), slotInfo.userDataEntry);
+        GetNextLayer()->CmdCommentString(pString);
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    GetNextLayer()->CmdDeclarePatchSlot(slotInfo);
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    if (m_annotations.logMiscellaneous)
+    {
+        GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdExecuteTemplate));
+
+        // TODO: Add comment string.
+    }
+
+    GetNextLayer()->CmdExecuteTemplate(static_cast<CmdBuffer*>(pTemplateCmdBuffer)->GetNextLayer(),
+                                       patchCount,
+                                       pPatches);
+}
+
 // =====================================================================================================================
 void CmdBuffer::CmdExecuteIndirectCmds(
     const IIndirectCmdGenerator& generator,
@@ -416,6 +416,12 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) override;
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override;
     virtual void CmdExecuteIndirectCmds(
         const IIndirectCmdGenerator& generator,
         const IGpuMemory&            gpuMemory,
@@ -552,6 +558,16 @@ private:
         int32       vertexOffset,
         uint32      firstInstance,
         uint32      instanceCount);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws);
+#endif
     static void PAL_STDCALL CmdDrawIndirectMulti(
         ICmdBuffer*       pCmdBuffer,
         const IGpuMemory& gpuMemory,
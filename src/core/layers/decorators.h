@@ -283,6 +283,15 @@ public:
         PlatformProperties* pProperties) override
         { return m_pNextLayer->GetProperties(pProperties); }
 
+    virtual Result GetStartupPhases(
+        uint32*           pPhaseCount,
+        StartupPhaseInfo* pPhases) const override
+        { return m_pNextLayer->GetStartupPhases(pPhaseCount, pPhases); }
+
+    virtual Result DumpStartupPhases(
+        const char* pFilePath) const override
+        { return m_pNextLayer->DumpStartupPhases(pFilePath); }
+
     // Part of the IDestroyable public interface.
     virtual void Destroy() override
     {
@@ -1268,6 +1277,10 @@ public:
         m_funcTable.pfnCmdDraw                      = CmdDrawDecorator;
         m_funcTable.pfnCmdDrawOpaque                = CmdDrawOpaqueDecorator;
         m_funcTable.pfnCmdDrawIndexed               = CmdDrawIndexedDecorator;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+        m_funcTable.pfnCmdDrawMulti                 = CmdDrawMultiDecorator;
+        m_funcTable.pfnCmdDrawIndexedMulti          = CmdDrawIndexedMultiDecorator;
+#endif
         m_funcTable.pfnCmdDrawIndirectMulti         = CmdDrawIndirectMultiDecorator;
         m_funcTable.pfnCmdDrawIndexedIndirectMulti  = CmdDrawIndexedIndirectMultiDecorator;
         m_funcTable.pfnCmdDispatch                  = CmdDispatchDecorator;
@@ -1917,6 +1930,16 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
 
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) override
+        { m_pNextLayer->CmdDeclarePatchSlot(slotInfo); }
+
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override
+        { m_pNextLayer->CmdExecuteTemplate(NextCmdBuffer(pTemplateCmdBuffer), patchCount, pPatches); }
+
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override
         { m_pNextLayer->CmdSaveComputeState(stateFlags); }
@@ -2062,6 +2085,26 @@ private:
         pNextLayer->CmdDrawIndexed(firstIndex, indexCount, vertexOffset, firstInstance, instanceCount);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    static void PAL_STDCALL CmdDrawMultiDecorator(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws)
+    {
+        ICmdBuffer* pNextLayer = static_cast<CmdBufferFwdDecorator*>(pCmdBuffer)->m_pNextLayer;
+        pNextLayer->CmdDrawMulti(drawCount, pDraws);
+    }
+
+    static void PAL_STDCALL CmdDrawIndexedMultiDecorator(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws)
+    {
+        ICmdBuffer* pNextLayer = static_cast<CmdBufferFwdDecorator*>(pCmdBuffer)->m_pNextLayer;
+        pNextLayer->CmdDrawIndexedMulti(drawCount, pDraws);
+    }
+#endif
+
     static void PAL_STDCALL CmdDrawIndirectMultiDecorator(
         ICmdBuffer*       pCmdBuffer,
         const IGpuMemory& gpuMemory,
@@ -2845,6 +2888,11 @@ public:
     virtual Result QueryKernelContextInfo(KernelContextInfo* pKernelContextInfo) const override
         { return m_pNextLayer->QueryKernelContextInfo(pKernelContextInfo); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626
+    virtual Result QuerySubmitStats(QueueSubmitStats* pStats) override
+        { return m_pNextLayer->QuerySubmitStats(pStats); }
+#endif
+
 protected:
     IQueue*                      m_pNextLayer;
     const DeviceDecorator*const  m_pDevice;
@@ -71,6 +71,8 @@ enum class CmdBufCallId : uint32
     CmdDrawIndexed,
     CmdDrawIndirectMulti,
     CmdDrawIndexedIndirectMulti,
+    CmdDrawMulti,
+    CmdDrawIndexedMulti,
     CmdDispatch,
     CmdDispatchIndirect,
     CmdDispatchOffset,
@@ -145,6 +147,8 @@ enum class CmdBufCallId : uint32
     CmdUpdateHiSPretests,
     CmdSetClipRects,
     CmdPostProcessFrame,
+    CmdDeclarePatchSlot,
+    CmdExecuteTemplate,
     Count
 };
 
@@ -187,6 +191,8 @@ static const char* CmdBufCallIdStrings[] =
     "CmdDrawIndexed()",
     "CmdDrawIndirectMulti()",
     "CmdDrawIndexedIndirectMulti()",
+    "CmdDrawMulti()",
+    "CmdDrawIndexedMulti()",
     "CmdDispatch()",
     "CmdDispatchIndirect()",
     "CmdDispatchOffset()",
@@ -261,6 +267,8 @@ static const char* CmdBufCallIdStrings[] =
     "CmdUpdateHiSPretests()",
     "CmdSetClipRects()",
     "CmdPostProcessFrame()",
+    "CmdDeclarePatchSlot()",
+    "CmdExecuteTemplate()",
 };
 
 static_assert(Util::ArrayLen(CmdBufCallIdStrings) == static_cast<uint32>(CmdBufCallId::Count),
@@ -70,6 +70,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDraw                      = CmdDraw;
     m_funcTable.pfnCmdDrawOpaque                = CmdDrawOpaque;
     m_funcTable.pfnCmdDrawIndexed               = CmdDrawIndexed;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti                 = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti          = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDrawIndirectMulti         = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti  = CmdDrawIndexedIndirectMulti;
     m_funcTable.pfnCmdDispatch                  = CmdDispatch;
@@ -1288,6 +1292,102 @@ void CmdBuffer::ReplayCmdDrawIndexed(
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    pThis->InsertToken(CmdBufCallId::CmdDrawMulti);
+    pThis->InsertTokenArray(pDraws, drawCount);
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        pThis->InsertTokenArray(pDraws[i].pEntryValues, pDraws[i].entryCount);
+    }
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdDrawMulti(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    MultiDrawInfo* pDraws    = nullptr;
+    const uint32   drawCount = ReadTokenArray(&pDraws);
+
+    uint32 vertexCount   = 0;
+    uint32 instanceCount = 0;
+
+    // The recorded user-data pointers refer to client memory, so point them at our copies in the token stream instead.
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        ReadTokenArray(&pDraws[i].pEntryValues);
+
+        vertexCount   += pDraws[i].vertexCount;
+        instanceCount  = Max(instanceCount, pDraws[i].instanceCount);
+    }
+
+    LogItem logItem = { };
+    logItem.cmdBufCall.flags.draw         = 1;
+    logItem.cmdBufCall.draw.vertexCount   = vertexCount;
+    logItem.cmdBufCall.draw.instanceCount = instanceCount;
+
+    LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDrawMulti);
+    pTgtCmdBuffer->CmdDrawMulti(drawCount, pDraws);
+    LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    pThis->InsertToken(CmdBufCallId::CmdDrawIndexedMulti);
+    pThis->InsertTokenArray(pDraws, drawCount);
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        pThis->InsertTokenArray(pDraws[i].pEntryValues, pDraws[i].entryCount);
+    }
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdDrawIndexedMulti(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    MultiDrawIndexedInfo* pDraws    = nullptr;
+    const uint32          drawCount = ReadTokenArray(&pDraws);
+
+    uint32 indexCount    = 0;
+    uint32 instanceCount = 0;
+
+    // The recorded user-data pointers refer to client memory, so point them at our copies in the token stream instead.
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        ReadTokenArray(&pDraws[i].pEntryValues);
+
+        indexCount    += pDraws[i].indexCount;
+        instanceCount  = Max(instanceCount, pDraws[i].instanceCount);
+    }
+
+    LogItem logItem = { };
+    logItem.cmdBufCall.flags.draw         = 1;
+    logItem.cmdBufCall.draw.vertexCount   = indexCount;
+    logItem.cmdBufCall.draw.instanceCount = instanceCount;
+
+    LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDrawIndexedMulti);
+    pTgtCmdBuffer->CmdDrawIndexedMulti(drawCount, pDraws);
+    LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDrawIndirectMulti(
     ICmdBuffer*       pCmdBuffer,
@@ -2881,6 +2981,58 @@ void CmdBuffer::ReplayCmdExecuteNestedCmdBuffers(
     }
 }
 
+// =====================================================================================================================
+void CmdBuffer::CmdDeclarePatchSlot(
+    const CmdPatchSlotInfo& slotInfo)
+{
+    InsertToken(CmdBufCallId::CmdDeclarePatchSlot);
+    InsertToken(slotInfo);
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdDeclarePatchSlot(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    pTgtCmdBuffer->CmdDeclarePatchSlot(ReadTokenVal<CmdPatchSlotInfo>());
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    InsertToken(CmdBufCallId::CmdExecuteTemplate);
+    InsertToken(pTemplateCmdBuffer);
+    InsertTokenArray(pPatches, patchCount);
+}
+
+// =====================================================================================================================
+// Templates are replayed like any other nested command buffer; the patch values are passed through unchanged because
+// the slot IDs declared in the template are replayed verbatim into the queue-owned target command buffer.
+void CmdBuffer::ReplayCmdExecuteTemplate(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    if (m_pDevice->LoggingEnabled(GpuProfilerGranularityDraw))
+    {
+        LogItem logItem = { };
+        logItem.type              = CmdBufferCall;
+        logItem.frameId           = m_curLogFrame;
+        logItem.cmdBufCall.callId = CmdBufCallId::CmdExecuteTemplate;
+        pQueue->AddLogItem(logItem);
+    }
+
+    auto*const           pTemplateCmdBuffer = static_cast<CmdBuffer*>(ReadTokenVal<ICmdBuffer*>());
+    const CmdPatchValue* pPatches           = nullptr;
+    const uint32         patchCount         = ReadTokenArray(&pPatches);
+    auto*const           pTemplateTgtCmdBuf = pQueue->AcquireNestedCmdBuf(pTgtCmdBuffer->GetSubQueueIdx());
+
+    pTemplateCmdBuffer->Replay(pQueue, pTemplateTgtCmdBuf, m_curLogFrame);
+    pTgtCmdBuffer->CmdExecuteTemplate(pTemplateTgtCmdBuf, patchCount, pPatches);
+}
+
 // =====================================================================================================================
 void CmdBuffer::CmdExecuteIndirectCmds(
     const IIndirectCmdGenerator& generator,
@@ -3477,6 +3629,13 @@ Result CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdDrawIndexed,
         &CmdBuffer::ReplayCmdDrawIndirectMulti,
         &CmdBuffer::ReplayCmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+        &CmdBuffer::ReplayCmdDrawMulti,
+        &CmdBuffer::ReplayCmdDrawIndexedMulti,
+#else
+        nullptr,
+        nullptr,
+#endif
         &CmdBuffer::ReplayCmdDispatch,
         &CmdBuffer::ReplayCmdDispatchIndirect,
         &CmdBuffer::ReplayCmdDispatchOffset,
@@ -3551,6 +3710,8 @@ Result CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdUpdateHiSPretests,
         &CmdBuffer::ReplayCmdSetClipRects,
         &CmdBuffer::ReplayCmdPostProcessFrame,
+        &CmdBuffer::ReplayCmdDeclarePatchSlot,
+        &CmdBuffer::ReplayCmdExecuteTemplate,
     };
 
     static_assert(ArrayLen(ReplayFuncTbl) == static_cast<size_t>(CmdBufCallId::Count),
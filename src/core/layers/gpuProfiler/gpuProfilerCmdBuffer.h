@@ -382,6 +382,12 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) override;
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override;
     virtual void CmdExecuteIndirectCmds(
         const IIndirectCmdGenerator& generator,
         const IGpuMemory&            gpuMemory,
@@ -508,6 +514,16 @@ private:
         int32       vertexOffset,
         uint32      firstInstance,
         uint32      instanceCount);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws);
+#endif
     static void PAL_STDCALL CmdDrawIndirectMulti(
         ICmdBuffer*       pCmdBuffer,
         const IGpuMemory& gpuMemory,
@@ -633,6 +649,10 @@ private:
     void ReplayCmdDrawIndexed(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndexedIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    void ReplayCmdDrawMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+    void ReplayCmdDrawIndexedMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#endif
     void ReplayCmdDispatch(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchIndirect(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchOffset(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
@@ -678,6 +698,8 @@ private:
     void ReplayCmdWriteCeRam(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDumpCeRam(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdExecuteNestedCmdBuffers(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+    void ReplayCmdDeclarePatchSlot(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+    void ReplayCmdExecuteTemplate(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdExecuteIndirectCmds(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdIf(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdElse(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
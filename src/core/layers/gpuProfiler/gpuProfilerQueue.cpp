@@ -1129,6 +1129,8 @@ void Queue::AddLogItem(
         case CmdBufCallId::CmdDrawIndexed:
         case CmdBufCallId::CmdDrawIndirectMulti:
         case CmdBufCallId::CmdDrawIndexedIndirectMulti:
+        case CmdBufCallId::CmdDrawMulti:
+        case CmdBufCallId::CmdDrawIndexedMulti:
         case CmdBufCallId::CmdDispatch:
         case CmdBufCallId::CmdDispatchIndirect:
         case CmdBufCallId::CmdDispatchOffset:
@@ -57,6 +57,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDraw                      = CmdDraw;
     m_funcTable.pfnCmdDrawOpaque                = CmdDrawOpaque;
     m_funcTable.pfnCmdDrawIndexed               = CmdDrawIndexed;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti                 = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti          = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDrawIndirectMulti         = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti  = CmdDrawIndexedIndirectMulti;
     m_funcTable.pfnCmdDispatch                  = CmdDispatch;
@@ -2762,6 +2766,76 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     }
 }
 
+// =====================================================================================================================
+void CmdBuffer::CmdDeclarePatchSlot(
+    const CmdPatchSlotInfo& slotInfo)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDeclarePatchSlot;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    m_pNextLayer->CmdDeclarePatchSlot(slotInfo);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndBeginMap("slotInfo", false);
+        pLogContext->KeyAndValue("slotId", slotInfo.slotId);
+        pLogContext->KeyAndValue("type", static_cast<uint32>(slotInfo.type));
+        pLogContext->KeyAndEnum("bindPoint", slotInfo.bindPoint);
+        pLogContext->KeyAndValue("userDataEntry", slotInfo.userDataEntry);
+        pLogContext->EndMap();
+        pLogContext->EndInput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdExecuteTemplate;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    m_pNextLayer->CmdExecuteTemplate(NextCmdBuffer(pTemplateCmdBuffer), patchCount, pPatches);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndObject("templateCmdBuffer", pTemplateCmdBuffer);
+        pLogContext->KeyAndBeginList("patches", false);
+
+        for (uint32 idx = 0; idx < patchCount; ++idx)
+        {
+            // The patch value is a union; log its raw dwords since its interpretation depends on the slot type.
+            pLogContext->BeginMap(false);
+            pLogContext->KeyAndValue("slotId", pPatches[idx].slotId);
+            pLogContext->KeyAndBeginList("dwords", true);
+
+            for (uint32 dword = 0; dword < 3; ++dword)
+            {
+                pLogContext->Value(pPatches[idx].dispatchSize[dword]);
+            }
+
+            pLogContext->EndList();
+            pLogContext->EndMap();
+        }
+
+        pLogContext->EndList();
+        pLogContext->EndInput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+
 // =====================================================================================================================
 void CmdBuffer::CmdSaveComputeState(
     uint32 stateFlags)
@@ -3177,6 +3251,74 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexed(
     }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    auto*const pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDrawMulti;
+    funcInfo.objectId     = pThis->m_objectId;
+    funcInfo.preCallTime  = pThis->m_pPlatform->GetTime();
+    pThis->m_pNextLayer->CmdDrawMulti(drawCount, pDraws);
+    funcInfo.postCallTime = pThis->m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndBeginList("draws", false);
+
+        for (uint32 idx = 0; idx < drawCount; ++idx)
+        {
+            pLogContext->Struct(pDraws[idx]);
+        }
+
+        pLogContext->EndList();
+        pLogContext->EndInput();
+
+        pThis->m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    auto*const pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDrawIndexedMulti;
+    funcInfo.objectId     = pThis->m_objectId;
+    funcInfo.preCallTime  = pThis->m_pPlatform->GetTime();
+    pThis->m_pNextLayer->CmdDrawIndexedMulti(drawCount, pDraws);
+    funcInfo.postCallTime = pThis->m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndBeginList("draws", false);
+
+        for (uint32 idx = 0; idx < drawCount; ++idx)
+        {
+            pLogContext->Struct(pDraws[idx]);
+        }
+
+        pLogContext->EndList();
+        pLogContext->EndInput();
+
+        pThis->m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDrawIndirectMulti(
     ICmdBuffer*       pCmdBuffer,
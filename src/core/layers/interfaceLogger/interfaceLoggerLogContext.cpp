@@ -48,6 +48,7 @@
 #include "core/layers/interfaceLogger/interfaceLoggerQueueSemaphore.h"
 #include "core/layers/interfaceLogger/interfaceLoggerScreen.h"
 #include "core/layers/interfaceLogger/interfaceLoggerSwapChain.h"
+#include "palDequeImpl.h"
 
 using namespace Util;
 
@@ -135,6 +136,8 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferCmdDrawIndexed,                                   InterfaceObject::CmdBuffer,            "CmdDrawIndexed"                          },
     { InterfaceFunc::CmdBufferCmdDrawIndirectMulti,                             InterfaceObject::CmdBuffer,            "CmdDrawIndirectMulti"                    },
     { InterfaceFunc::CmdBufferCmdDrawIndexedIndirectMulti,                      InterfaceObject::CmdBuffer,            "CmdDrawIndexedIndirectMulti"             },
+    { InterfaceFunc::CmdBufferCmdDrawMulti,                                     InterfaceObject::CmdBuffer,            "CmdDrawMulti"                            },
+    { InterfaceFunc::CmdBufferCmdDrawIndexedMulti,                              InterfaceObject::CmdBuffer,            "CmdDrawIndexedMulti"                     },
     { InterfaceFunc::CmdBufferCmdDispatch,                                      InterfaceObject::CmdBuffer,            "CmdDispatch"                             },
     { InterfaceFunc::CmdBufferCmdDispatchIndirect,                              InterfaceObject::CmdBuffer,            "CmdDispatchIndirect"                     },
     { InterfaceFunc::CmdBufferCmdDispatchOffset,                                InterfaceObject::CmdBuffer,            "CmdDispatchOffset"                       },
@@ -193,6 +196,8 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferCmdWriteCeRam,                                    InterfaceObject::CmdBuffer,            "CmdWriteCeRam"                           },
     { InterfaceFunc::CmdBufferCmdAllocateEmbeddedData,                          InterfaceObject::CmdBuffer,            "CmdAllocateEmbeddedData"                 },
     { InterfaceFunc::CmdBufferCmdExecuteNestedCmdBuffers,                       InterfaceObject::CmdBuffer,            "CmdExecuteNestedCmdBuffers"              },
+    { InterfaceFunc::CmdBufferCmdDeclarePatchSlot,                              InterfaceObject::CmdBuffer,            "CmdDeclarePatchSlot"                     },
+    { InterfaceFunc::CmdBufferCmdExecuteTemplate,                               InterfaceObject::CmdBuffer,            "CmdExecuteTemplate"                      },
     { InterfaceFunc::CmdBufferCmdSaveComputeState,                              InterfaceObject::CmdBuffer,            "CmdSaveComputeState"                     },
     { InterfaceFunc::CmdBufferCmdRestoreComputeState,                           InterfaceObject::CmdBuffer,            "CmdRestoreComputeState"                  },
     { InterfaceFunc::CmdBufferCmdExecuteIndirectCmds,                           InterfaceObject::CmdBuffer,            "CmdExecuteIndirectCmds"                  },
@@ -337,6 +342,108 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
 static_assert(ArrayLen(FuncFormattingTable) == static_cast<size_t>(InterfaceFunc::Count),
               "The FuncFormattingTable must be updated.");
 
+// =====================================================================================================================
+static void LogFlusherThreadCallback(
+    void* pParameter)
+{
+    static_cast<LogFlusher*>(pParameter)->Run();
+}
+
+// =====================================================================================================================
+LogFlusher::LogFlusher(
+    Platform* pPlatform)
+    :
+    m_queue(pPlatform),
+    m_exit(false)
+{
+}
+
+// =====================================================================================================================
+LogFlusher::~LogFlusher()
+{
+    Stop();
+}
+
+// =====================================================================================================================
+Result LogFlusher::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_notify.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_thread.Begin(&LogFlusherThreadCallback, this);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Terminates the flusher thread after it has written everything queued so far. All streams must have stopped logging.
+void LogFlusher::Stop()
+{
+    if (m_thread.IsCreated())
+    {
+        PAL_ASSERT(m_thread.IsNotCurrentThread());
+
+        m_exit = true;
+        m_notify.Post();
+        m_thread.Join();
+    }
+}
+
+// =====================================================================================================================
+Result LogFlusher::Enqueue(
+    LogStream* pStream)
+{
+    MutexAuto lock(&m_lock);
+
+    const Result result = m_queue.PushBack(pStream);
+
+    if (result == Result::Success)
+    {
+        m_notify.Post();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Executes the flusher thread.
+void LogFlusher::Run()
+{
+    bool done = false;
+
+    while (done == false)
+    {
+        const Result waitResult = m_notify.Wait(UINT32_MAX);
+        PAL_ASSERT(IsErrorResult(waitResult) == false);
+
+        LogStream* pStream = nullptr;
+
+        m_lock.Lock();
+        if (m_queue.NumElements() > 0)
+        {
+            m_queue.PopFront(&pStream);
+        }
+        m_lock.Unlock();
+
+        if (pStream != nullptr)
+        {
+            pStream->WritePending();
+        }
+        else
+        {
+            // Every Enqueue posts the semaphore once, so an empty queue means this wakeup came from Stop().
+            done = m_exit;
+        }
+    }
+}
+
 // =====================================================================================================================
 LogStream::LogStream(
     Platform* pPlatform)
@@ -344,7 +451,11 @@ LogStream::LogStream(
     m_pPlatform(pPlatform),
     m_pBuffer(nullptr),
     m_bufferSize(0),
-    m_bufferUsed(0)
+    m_bufferUsed(0),
+    m_pPendingBuffer(nullptr),
+    m_pendingSize(0),
+    m_pendingUsed(0),
+    m_pendingBusy(false)
 {
 }
 
@@ -358,7 +469,10 @@ LogStream::~LogStream()
         PAL_ASSERT(result == Result::Success);
     }
 
+    WaitForPending();
+
     PAL_SAFE_FREE(m_pBuffer, m_pPlatform);
+    PAL_SAFE_FREE(m_pPendingBuffer, m_pPlatform);
 }
 
 // =====================================================================================================================
@@ -387,6 +501,9 @@ Result LogStream::WriteFile()
     }
     else if (m_bufferUsed > 0)
     {
+        // The pending buffer holds older text so it must reach the file first.
+        WaitForPending();
+
         result       = m_file.Write(m_pBuffer, m_bufferUsed * sizeof(char));
         m_bufferUsed = 0;
 
@@ -400,6 +517,83 @@ Result LogStream::WriteFile()
     return result;
 }
 
+// =====================================================================================================================
+// Applies the platform's flush policy at the end of a log entry. Does nothing until the log file has been opened.
+void LogStream::EndEntry()
+{
+    if (m_file.IsOpen())
+    {
+        const InterfaceLoggerFlushPolicy policy = m_pPlatform->FlushPolicy();
+
+        if ((policy == InterfaceLoggerFlushEveryCall) || (m_bufferUsed >= m_pPlatform->FlushThreshold()))
+        {
+            if ((policy == InterfaceLoggerFlushBackground) && m_pPlatform->Flusher()->IsRunning())
+            {
+                SubmitPending();
+            }
+            else
+            {
+                const Result result = WriteFile();
+                PAL_ASSERT(result == Result::Success);
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Hands the buffered text to the LogFlusher and continues logging into the previous pending buffer.
+void LogStream::SubmitPending()
+{
+    // We can't reuse the pending buffer until the flusher is done with it.
+    WaitForPending();
+
+    char*const   pFullBuffer = m_pBuffer;
+    const uint32 fullSize    = m_bufferSize;
+
+    m_pBuffer        = m_pPendingBuffer;
+    m_bufferSize     = m_pendingSize;
+    m_pPendingBuffer = pFullBuffer;
+    m_pendingSize    = fullSize;
+    m_pendingUsed    = m_bufferUsed;
+    m_bufferUsed     = 0;
+
+    m_pendingBusy.store(true, std::memory_order_relaxed);
+
+    if (m_pPlatform->Flusher()->Enqueue(this) != Result::Success)
+    {
+        // We couldn't queue the write so do it ourselves.
+        WritePending();
+    }
+}
+
+// =====================================================================================================================
+// Writes the pending buffer to the file and returns it to the logging thread.
+void LogStream::WritePending()
+{
+    Result result = m_file.Write(m_pPendingBuffer, m_pendingUsed * sizeof(char));
+
+    if (result == Result::Success)
+    {
+        result = m_file.Flush();
+    }
+
+    PAL_ASSERT(result == Result::Success);
+
+    m_pendingUsed = 0;
+    m_pendingBusy.store(false, std::memory_order_release);
+}
+
+// =====================================================================================================================
+// Blocks until the LogFlusher has finished writing the pending buffer. This is normally already the case because the
+// flusher had a whole buffer's worth of logging to catch up.
+void LogStream::WaitForPending() const
+{
+    while (m_pendingBusy.load(std::memory_order_acquire))
+    {
+        YieldThread();
+    }
+}
+
 // =====================================================================================================================
 void LogStream::WriteString(
     const char* pString,
@@ -485,12 +679,8 @@ void LogContext::EndFunc()
 {
     EndMap();
 
-    // Flush our buffered JSON text to our log file if it's already been opened.
-    if (m_stream.IsFileOpen())
-    {
-        const Result result = m_stream.WriteFile();
-        PAL_ASSERT(result == Result::Success);
-    }
+    // Flush our buffered JSON text to our log file as the platform's flush policy requires.
+    m_stream.EndEntry();
 }
 
 // =====================================================================================================================
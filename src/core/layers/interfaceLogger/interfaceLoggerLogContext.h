@@ -27,9 +27,16 @@
 
 #if PAL_BUILD_INTERFACE_LOGGER
 
+#include "core/g_palPlatformSettings.h"
 #include "core/layers/decorators.h"
+#include "palDeque.h"
 #include "palFile.h"
 #include "palJsonWriter.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+
+#include <atomic>
 
 namespace Pal
 {
@@ -110,6 +117,8 @@ enum class InterfaceFunc : uint32
     CmdBufferCmdDrawIndexed,
     CmdBufferCmdDrawIndirectMulti,
     CmdBufferCmdDrawIndexedIndirectMulti,
+    CmdBufferCmdDrawMulti,
+    CmdBufferCmdDrawIndexedMulti,
     CmdBufferCmdDispatch,
     CmdBufferCmdDispatchIndirect,
     CmdBufferCmdDispatchOffset,
@@ -168,6 +177,8 @@ enum class InterfaceFunc : uint32
     CmdBufferCmdWriteCeRam,
     CmdBufferCmdAllocateEmbeddedData,
     CmdBufferCmdExecuteNestedCmdBuffers,
+    CmdBufferCmdDeclarePatchSlot,
+    CmdBufferCmdExecuteTemplate,
     CmdBufferCmdSaveComputeState,
     CmdBufferCmdRestoreComputeState,
     CmdBufferCmdExecuteIndirectCmds,
@@ -319,9 +330,44 @@ struct BeginFuncInfo
     uint64        postCallTime; // The tick immediately after calling down to the next layer.
 };
 
+class LogStream;
+
+// =====================================================================================================================
+// Background thread which writes full log buffers to their files for InterfaceLoggerFlushBackground. A single flusher
+// serves every log file, so logging threads only wait on file I/O if they outrun the disk.
+class LogFlusher
+{
+public:
+    explicit LogFlusher(Platform* pPlatform);
+    ~LogFlusher();
+
+    Result Init();
+    void Stop();
+
+    bool IsRunning() const { return m_thread.IsCreated(); }
+
+    // Queues a stream whose pending buffer must be written. If this fails the caller must write the buffer itself.
+    Result Enqueue(LogStream* pStream);
+
+    void Run();
+
+private:
+    Util::Thread                      m_thread;
+    Util::Mutex                       m_lock;   // Protects m_queue.
+    Util::Semaphore                   m_notify; // Posted once per queued stream and once by Stop().
+    Util::Deque<LogStream*, Platform> m_queue;  // Streams whose pending buffers are waiting to be written.
+    volatile bool                     m_exit;   // Tells the flusher thread to exit once m_queue is empty.
+
+    PAL_DISALLOW_DEFAULT_CTOR(LogFlusher);
+    PAL_DISALLOW_COPY_AND_ASSIGN(LogFlusher);
+};
+
 // =====================================================================================================================
 // JSON stream that records the text stream using a staging buffer and a log file. WriteFile must be called explicitly
 // to flush all buffered text. Note that this makes it possible to generate JSON text before OpenFile has been called.
+//
+// EndEntry applies the platform's flush policy. Under InterfaceLoggerFlushBackground a full buffer is swapped with a
+// second "pending" buffer which the LogFlusher writes while logging continues in the first.
 class LogStream : public Util::JsonStream
 {
 public:
@@ -331,6 +377,12 @@ public:
     Result OpenFile(const char* pFilePath);
     Result WriteFile();
 
+    // Must be called after each complete log entry; writes out buffered text as the flush policy requires.
+    void EndEntry();
+
+    // Writes the pending buffer to the file. Called by the LogFlusher.
+    void WritePending();
+
     // Returns true if the log file has already been opened.
     bool IsFileOpen() const { return m_file.IsOpen(); }
 
@@ -339,12 +391,18 @@ public:
 
 private:
     void VerifyUnusedSpace(uint32 size);
-
-    Platform*const m_pPlatform;
-    Util::File     m_file;       // The text stream is being written here.
-    char*          m_pBuffer;    // Buffered text data that needs to be written to the file.
-    uint32         m_bufferSize; // The size of the buffer in characters.
-    uint32         m_bufferUsed; // How many characters of the buffer are in use.
+    void SubmitPending();
+    void WaitForPending() const;
+
+    Platform*const    m_pPlatform;
+    Util::File        m_file;           // The text stream is being written here.
+    char*             m_pBuffer;        // Buffered text data that needs to be written to the file.
+    uint32            m_bufferSize;     // The size of the buffer in characters.
+    uint32            m_bufferUsed;     // How many characters of the buffer are in use.
+    char*             m_pPendingBuffer; // Text handed to the LogFlusher, logged before anything in m_pBuffer.
+    uint32            m_pendingSize;    // The size of the pending buffer in characters.
+    uint32            m_pendingUsed;    // How many characters of the pending buffer are waiting to be written.
+    std::atomic<bool> m_pendingBusy;    // Set while the LogFlusher owns the pending buffer.
 
     PAL_DISALLOW_DEFAULT_CTOR(LogStream);
     PAL_DISALLOW_COPY_AND_ASSIGN(LogStream);
@@ -504,6 +562,10 @@ public:
     void Struct(const MemoryTiledImageCopyRegion& value);
     void Struct(const MsaaQuadSamplePattern& value);
     void Struct(const MsaaStateCreateInfo& value);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    void Struct(const MultiDrawIndexedInfo& value);
+    void Struct(const MultiDrawInfo& value);
+#endif
     void Struct(Offset2d value);
     void Struct(Offset3d value);
     void Struct(const PeerGpuMemoryOpenInfo& value);
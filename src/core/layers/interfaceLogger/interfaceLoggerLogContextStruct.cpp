@@ -1944,6 +1944,51 @@ void LogContext::Struct(
     EndMap();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+void LogContext::Struct(
+    const MultiDrawIndexedInfo& value)
+{
+    BeginMap(false);
+    KeyAndValue("firstIndex", value.firstIndex);
+    KeyAndValue("indexCount", value.indexCount);
+    KeyAndValue("vertexOffset", value.vertexOffset);
+    KeyAndValue("firstInstance", value.firstInstance);
+    KeyAndValue("instanceCount", value.instanceCount);
+    KeyAndValue("firstEntry", value.firstEntry);
+    KeyAndBeginList("entryValues", false);
+
+    for (uint32 idx = 0; idx < value.entryCount; ++idx)
+    {
+        Value(value.pEntryValues[idx]);
+    }
+
+    EndList();
+    EndMap();
+}
+
+// =====================================================================================================================
+void LogContext::Struct(
+    const MultiDrawInfo& value)
+{
+    BeginMap(false);
+    KeyAndValue("firstVertex", value.firstVertex);
+    KeyAndValue("vertexCount", value.vertexCount);
+    KeyAndValue("firstInstance", value.firstInstance);
+    KeyAndValue("instanceCount", value.instanceCount);
+    KeyAndValue("firstEntry", value.firstEntry);
+    KeyAndBeginList("entryValues", false);
+
+    for (uint32 idx = 0; idx < value.entryCount; ++idx)
+    {
+        Value(value.pEntryValues[idx]);
+    }
+
+    EndList();
+    EndMap();
+}
+#endif
+
 // =====================================================================================================================
 void LogContext::Struct(
     Offset2d value)
@@ -94,6 +94,8 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferCmdDrawIndexed,                       (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDrawIndirectMulti,                 (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDrawIndexedIndirectMulti,          (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdDrawMulti,                         (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdDrawIndexedMulti,                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDispatch,                          (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDispatchIndirect,                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDispatchOffset,                    (CmdBuild)            },
@@ -152,6 +154,8 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferCmdWriteCeRam,                        (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdAllocateEmbeddedData,              (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdExecuteNestedCmdBuffers,           (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdDeclarePatchSlot,                  (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdExecuteTemplate,                   (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdSaveComputeState,                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdRestoreComputeState,               (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdExecuteIndirectCmds,               (CmdBuild)            },
@@ -309,7 +313,10 @@ Platform::Platform(
     m_nextThreadId(0),
     m_objectId(0),
     m_activePreset(0),
-    m_threadDataVec(this)
+    m_threadDataVec(this),
+    m_flushPolicy(InterfaceLoggerFlushEveryCall),
+    m_flushThreshold(0),
+    m_flusher(this)
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
     for (uint32 idx = 0; idx < static_cast<uint32>(InterfaceFunc::Count); ++idx)
@@ -360,6 +367,9 @@ Platform::~Platform()
 
     PAL_SAFE_DELETE(m_pMainLog, this);
 
+    // Every log has written its remaining text so the flusher has nothing left to do once its queue drains.
+    m_flusher.Stop();
+
     // If someone manages to call a logging function after destruction this might protect us a bit.
     m_flags.threadKeyCreated  = 0;
     m_flags.multithreaded     = 0;
@@ -477,6 +487,16 @@ Result Platform::CommitLoggingSettings()
         m_loggingPresets[0] = settings.interfaceLoggerConfig.basePreset;
         m_loggingPresets[1] = settings.interfaceLoggerConfig.elevatedPreset;
 
+        // Pick the flush policy before any log file is opened. If we can't start the flusher thread we can still
+        // avoid flushing on every call.
+        m_flushPolicy    = settings.interfaceLoggerConfig.flushPolicy;
+        m_flushThreshold = settings.interfaceLoggerConfig.flushThreshold;
+
+        if ((m_flushPolicy == InterfaceLoggerFlushBackground) && (m_flusher.Init() != Result::Success))
+        {
+            m_flushPolicy = InterfaceLoggerFlushWhenFull;
+        }
+
         // Try to create the root log directory.
         result = CreateLogDir(settings.interfaceLoggerConfig.logDirectory);
 
@@ -99,6 +99,11 @@ public:
     // Returns the current clock time in ticks relative to the starting time.
     uint64 GetTime() const;
 
+    // Controls when LogStreams write their buffered text to their files.
+    InterfaceLoggerFlushPolicy FlushPolicy() const { return m_flushPolicy; }
+    uint32 FlushThreshold() const { return m_flushThreshold; }
+    LogFlusher* Flusher() { return &m_flusher; }
+
     // LogBeginFunc must be called to begin logging an interface function call. It will determine if this function
     // should be logged at the current time. If so, an appropriate LogContext will be found and its BeginFunc function
     // will be called before the context is returned using ppContext. This function will return true if this call should
@@ -162,6 +167,9 @@ private:
     uint32                   m_loggingPresets[2]; // Masks of logging levels that the user can select for logging.
     Util::ThreadLocalKey     m_threadKey;         // Used to look up thread specific data (e.g., thread logs).
     ThreadDataVector         m_threadDataVec;     // A list of all thread-local data so they can be deleted on exit.
+    InterfaceLoggerFlushPolicy m_flushPolicy;     // When LogStreams write out their buffers.
+    uint32                   m_flushThreshold;    // Buffered characters which trigger a write for deferred policies.
+    LogFlusher               m_flusher;           // Writes full buffers for InterfaceLoggerFlushBackground.
 
     // Tracks the next ID to be issued for all objects.
     volatile uint32          m_nextObjectIds[static_cast<uint32>(InterfaceObject::Count)];
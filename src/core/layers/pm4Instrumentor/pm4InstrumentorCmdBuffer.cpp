@@ -55,6 +55,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDraw                     = CmdDrawDecorator;
     m_funcTable.pfnCmdDrawOpaque               = CmdDrawOpaqueDecorator;
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexedDecorator;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMultiDecorator;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMultiDecorator;
+#endif
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMultiDecorator;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMultiDecorator;
     m_funcTable.pfnCmdDispatch                 = CmdDispatchDecorator;
@@ -332,6 +336,36 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedDecorator(
     pThis->PostDrawCall(CmdBufCallId::CmdDrawIndexed);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMultiDecorator(
+    ICmdBuffer*          pCmdBuffer,
+    uint32               drawCount,
+    const MultiDrawInfo* pDraws)
+{
+    CmdBuffer*const  pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+    ICmdBuffer*const pNext = pThis->GetNextLayer();
+
+    pThis->PreDrawCall();
+    pNext->CmdDrawMulti(drawCount, pDraws);
+    pThis->PostDrawCall(CmdBufCallId::CmdDrawMulti);
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMultiDecorator(
+    ICmdBuffer*                 pCmdBuffer,
+    uint32                      drawCount,
+    const MultiDrawIndexedInfo* pDraws)
+{
+    CmdBuffer*const  pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+    ICmdBuffer*const pNext = pThis->GetNextLayer();
+
+    pThis->PreDrawCall();
+    pNext->CmdDrawIndexedMulti(drawCount, pDraws);
+    pThis->PostDrawCall(CmdBufCallId::CmdDrawIndexedMulti);
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDrawIndirectMultiDecorator(
     ICmdBuffer*       pCmdBuffer,
@@ -1378,6 +1412,26 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     PostCall(CmdBufCallId::CmdExecuteNestedCmdBuffers);
 }
 
+// =====================================================================================================================
+void CmdBuffer::CmdDeclarePatchSlot(
+    const CmdPatchSlotInfo& slotInfo)
+{
+    PreCall();
+    CmdBufferFwdDecorator::CmdDeclarePatchSlot(slotInfo);
+    PostCall(CmdBufCallId::CmdDeclarePatchSlot);
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdExecuteTemplate(
+    ICmdBuffer*          pTemplateCmdBuffer,
+    uint32               patchCount,
+    const CmdPatchValue* pPatches)
+{
+    PreCall();
+    CmdBufferFwdDecorator::CmdExecuteTemplate(pTemplateCmdBuffer, patchCount, pPatches);
+    PostCall(CmdBufCallId::CmdExecuteTemplate);
+}
+
 // =====================================================================================================================
 void CmdBuffer::CmdSaveComputeState(
     uint32 stateFlags)
@@ -407,6 +407,14 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
 
+    virtual void CmdDeclarePatchSlot(
+        const CmdPatchSlotInfo& slotInfo) override;
+
+    virtual void CmdExecuteTemplate(
+        ICmdBuffer*          pTemplateCmdBuffer,
+        uint32               patchCount,
+        const CmdPatchValue* pPatches) override;
+
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override;
     virtual void CmdRestoreComputeState(
@@ -507,6 +515,16 @@ private:
         int32       vertexOffset,
         uint32      firstInstance,
         uint32      instanceCount);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 625
+    static void PAL_STDCALL CmdDrawMultiDecorator(
+        ICmdBuffer*          pCmdBuffer,
+        uint32               drawCount,
+        const MultiDrawInfo* pDraws);
+    static void PAL_STDCALL CmdDrawIndexedMultiDecorator(
+        ICmdBuffer*                 pCmdBuffer,
+        uint32                      drawCount,
+        const MultiDrawIndexedInfo* pDraws);
+#endif
     static void PAL_STDCALL CmdDrawIndirectMultiDecorator(
         ICmdBuffer*       pCmdBuffer,
         const IGpuMemory& gpuMemory,
@@ -25,6 +25,7 @@
 
 #include "core/g_palSettings.h"
 #include "core/os/amdgpu/amdgpuDevice.h"
+#include "core/os/amdgpu/amdgpuFenceCompletionTracker.h"
 #include "core/os/amdgpu/amdgpuImage.h"
 #include "core/os/amdgpu/amdgpuQueue.h"
 #include "core/os/amdgpu/amdgpuSwapChain.h"
@@ -107,7 +108,6 @@ static PAL_INLINE Result CheckResult(
 constexpr gpusize _4GB = (1ull << 32u);
 constexpr uint32 GpuPageSize = 4096;
 
-constexpr char UserDefaultConfigFileSubPath[] = "/.config";
 constexpr char UserDefaultCacheFileSubPath[]  = "/.cache";
 constexpr char UserDefaultDebugFilePath[]     = "/var/tmp";
 
@@ -161,7 +161,6 @@ static Result OpenAndInitializeDrmDevice(
 // =====================================================================================================================
 Result Device::Create(
     Platform*               pPlatform,
-    const char*             pSettingsPath,
     const char*             pBusId,
     const char*             pPrimaryNode,
     const char*             pRenderNode,
@@ -222,7 +221,6 @@ Result Device::Create(
 
             DeviceConstructorParams constructorParams = {
                 .pPlatform             = pPlatform,
-                .pSettingsPath         = pSettingsPath,
                 .pBusId                = pBusId,
                 .pRenderNode           = pRenderNode,
                 .pPrimaryNode          = pPrimaryNode,
@@ -395,18 +393,14 @@ Device::Device(
     m_drmMajorVer(constructorParams.drmMajorVer),
     m_drmMinorVer(constructorParams.drmMinorVer),
     m_useDedicatedVmid(false),
-    m_pSettingsPath(constructorParams.pSettingsPath),
     m_pSvmMgr(nullptr),
     m_mapAllocator(),
     m_reservedVaMap(32, &m_mapAllocator),
     m_globalRefMap(MemoryRefMapElements, constructorParams.pPlatform),
     m_semType(SemaphoreType::Legacy),
     m_fenceType(FenceType::Legacy),
-#if defined(PAL_DEBUG_PRINTS)
+    m_pFenceTracker(nullptr),
     m_drmProcs(constructorParams.pPlatform->GetDrmLoader().GetProcsTableProxy())
-#else
-    m_drmProcs(constructorParams.pPlatform->GetDrmLoader().GetProcsTable())
-#endif
 {
     Util::Strncpy(m_busId, constructorParams.pBusId, MaxBusIdStringLen);
     Util::Strncpy(m_renderNodeName, constructorParams.pRenderNode, MaxNodeNameLen);
@@ -475,6 +469,9 @@ Result Device::Cleanup()
         result = Pal::Device::Cleanup();
     }
 
+    // This must come after the base cleanup, which destroys the internal queues whose timestamps may still be tracked.
+    PAL_SAFE_DELETE(m_pFenceTracker, m_pPlatform);
+
     PAL_SAFE_DELETE(m_pSvmMgr, m_pPlatform);
 
     // Note: Pal::Device::Cleanup() uses m_memoryProperties.vaRanges to find VAM sections for memory release.
@@ -592,6 +589,23 @@ Result Device::OsLateInit()
         m_featureState.requirePrtReserveVaWa = 1;
     }
 
+    // The tracker blocks on many fences at once, which needs amdgpu_cs_wait_fences.
+    if ((result == Result::Success) &&
+        Settings().enableFenceCompletionThread &&
+        m_drmProcs.pfnAmdgpuCsWaitFencesisValid())
+    {
+        m_pFenceTracker = PAL_NEW(FenceCompletionTracker, m_pPlatform, AllocInternal)(m_pPlatform, m_drmProcs);
+
+        if (m_pFenceTracker == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = m_pFenceTracker->Init();
+        }
+    }
+
     return result;
 }
 
@@ -633,46 +647,6 @@ Result Device::EarlyInit(
     // Init paths
     InitOutputPaths();
 
-    if (result == Result::Success)
-    {
-        // Step 1: try default(as well as global) path
-        result = m_settingsMgr.Init(m_pSettingsPath);
-
-        // Step 2: if no global setting found, try XDG_CONFIG_HOME and user specific path
-        if (result == Result::ErrorUnavailable)
-        {
-            const char* pXdgConfigPath = getenv("XDG_CONFIG_HOME");
-            if (pXdgConfigPath != nullptr)
-            {
-                result = m_settingsMgr.Init(pXdgConfigPath);
-            }
-            else
-            {
-                // XDG_CONFIG_HOME is not set, fall back to $HOME
-                char userDefaultConfigFilePath[MaxPathStrLen];
-
-                const char* pPath = getenv("HOME");
-                if (pPath != nullptr)
-                {
-                    Snprintf(userDefaultConfigFilePath, sizeof(userDefaultConfigFilePath), "%s%s",
-                             pPath, UserDefaultConfigFileSubPath);
-                    result = m_settingsMgr.Init(userDefaultConfigFilePath);
-                }
-                else
-                {
-                    result = Result::ErrorUnavailable;
-                }
-            }
-        }
-
-        if (result == Result::ErrorUnavailable)
-        {
-            // Unavailable means that the file was not found, which is an acceptable failure.
-            PAL_ALERT_ALWAYS();
-            result = Result::Success;
-        }
-    }
-
     if (result == Result::Success)
     {
         result = InitGpuProperties();
@@ -41,6 +41,7 @@ namespace Pal
 namespace Amdgpu
 {
 
+class  FenceCompletionTracker;
 class  Image;
 class  WindowSystem;
 struct HdrOutputMetadata;
@@ -76,7 +77,6 @@ struct ExternalSharedInfo
 struct DeviceConstructorParams
 {
     Platform*                   pPlatform;
-    const char*                 pSettingsPath;
     const char*                 pBusId;
     const char*                 pRenderNode;
     const char*                 pPrimaryNode;
@@ -102,7 +102,6 @@ class Device : public Pal::Device
 public:
     static Result Create(
         Platform*               pPlatform,
-        const char*             pSettingsPath,
         const char*             pBusId,
         const char*             pPrimaryNode,
         const char*             pRenderNode,
@@ -714,6 +713,8 @@ public:
     SemaphoreType GetSemaphoreType() const { return m_semType; }
     FenceType     GetFenceType()     const { return m_fenceType; }
 
+    FenceCompletionTracker* GetFenceCompletionTracker() const { return m_pFenceTracker; }
+
     Result SyncObjImportSyncFile(
         int                     syncFileFd,
         amdgpu_syncobj_handle   syncObj) const;
@@ -899,8 +900,6 @@ private:
     bool  m_useDedicatedVmid;         // Indicate if use per-process VMID.
     bool  m_supportExternalSemaphore; // Indicate if external semaphore is supported.
 
-    const char*  m_pSettingsPath;
-
     SvmMgr* m_pSvmMgr;
 
     struct ReservedVaRangeInfo
@@ -942,6 +941,9 @@ private:
     SemaphoreType m_semType;
     FenceType     m_fenceType;
 
+    // Optional background thread which retires submission context timestamps; see enableFenceCompletionThread.
+    FenceCompletionTracker* m_pFenceTracker;
+
     // state flags for real sync object support status.
     // double check syncobj's implementation: with paritial or full features in libdrm.so and drm.ko.
     union
@@ -972,11 +974,9 @@ private:
         uint32 flags;
     } m_featureState;
 
-#if defined(PAL_DEBUG_PRINTS)
+    // libdrm calls go through the proxy in every build so that DrmTracer can be enabled by a setting. When tracing is
+    // off this costs one branch per call.
     const DrmLoaderFuncsProxy& m_drmProcs;
-#else
-    const DrmLoaderFuncs& m_drmProcs;
-#endif
 
     PAL_DISALLOW_DEFAULT_CTOR(Device);
     PAL_DISALLOW_COPY_AND_ASSIGN(Device);
@@ -0,0 +1,706 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/os/amdgpu/amdgpuDrmTracer.h"
+#include "core/os/amdgpu/amdgpuPlatform.h"
+#include "palInlineFuncs.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+#include <errno.h>
+#include <string.h>
+
+using namespace Util;
+
+namespace Pal
+{
+namespace Amdgpu
+{
+
+// Captured values larger than this are recorded as empty so a single call can never overflow a thread buffer.
+constexpr uint32 MaxCapturedValueSize = DrmTracer::ThreadBufferSize / 4;
+
+DrmReplayer* DrmReplayer::s_pActiveReplayer = nullptr;
+
+// =====================================================================================================================
+DrmTracer::DrmTracer()
+    :
+    m_pPlatform(nullptr),
+    m_ppEntryPointNames(nullptr),
+    m_numEntryPoints(0),
+    m_nsPerTick(0.0),
+    m_threadKey(),
+    m_threadKeyCreated(false),
+    m_pThreadBuffers(nullptr),
+    m_numThreadBuffers(0),
+    m_sequence(0)
+{
+    m_logPath[0] = '\0';
+    memset(const_cast<uint32*>(&m_histograms[0][0]), 0, sizeof(m_histograms));
+}
+
+// =====================================================================================================================
+DrmTracer::~DrmTracer()
+{
+    while (m_pThreadBuffers != nullptr)
+    {
+        ThreadBuffer* pBuffer = m_pThreadBuffers;
+        m_pThreadBuffers      = pBuffer->pNext;
+
+        WriteChunk(pBuffer, pBuffer->used);
+        PAL_DELETE(pBuffer, m_pPlatform);
+    }
+
+    if (m_traceFile.IsOpen())
+    {
+        m_traceFile.Close();
+    }
+
+    if (IsEnabled() && (m_logPath[0] != '\0'))
+    {
+        WriteLatencySummary();
+    }
+
+    if (m_threadKeyCreated)
+    {
+        DeleteThreadLocalKey(m_threadKey);
+    }
+}
+
+// =====================================================================================================================
+// Enables tracing. Latency histograms are always collected once this succeeds; per-call records are only written if a
+// log path is given.
+Result DrmTracer::Init(
+    Platform*          pPlatform,
+    const char*        pLogPath,
+    uint32             numEntryPoints,
+    const char*const*  ppEntryPointNames)
+{
+    PAL_ASSERT(numEntryPoints <= MaxEntryPoints);
+
+    Result result = m_lock.Init();
+
+    if ((result == Result::Success) && (pLogPath != nullptr))
+    {
+        result             = CreateThreadLocalKey(&m_threadKey);
+        m_threadKeyCreated = (result == Result::Success);
+    }
+
+    if ((result == Result::Success) && (pLogPath != nullptr))
+    {
+        Strncpy(m_logPath, pLogPath, sizeof(m_logPath));
+
+        char fileName[sizeof(m_logPath) + 32];
+        Snprintf(fileName, sizeof(fileName), "%s/DrmLoaderTrace.bin", pLogPath);
+
+        result = m_traceFile.Open(fileName, FileAccessWrite | FileAccessBinary);
+
+        if (result == Result::Success)
+        {
+            DrmTraceFileHeader header = {};
+            header.magic          = DrmTraceMagic;
+            header.version        = DrmTraceVersion;
+            header.numEntryPoints = numEntryPoints;
+            header.ticksPerSecond = GetPerfFrequency();
+
+            result = m_traceFile.Write(&header, sizeof(header));
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        m_pPlatform         = pPlatform;
+        m_ppEntryPointNames = ppEntryPointNames;
+        m_numEntryPoints    = numEntryPoints;
+        m_nsPerTick         = 1000000000.0 / static_cast<double>(GetPerfFrequency());
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns the calling thread's trace buffer, creating it on the thread's first traced call. Returns null if per-call
+// records are not being written.
+DrmTracer::ThreadBuffer* DrmTracer::GetThreadBuffer() const
+{
+    ThreadBuffer* pBuffer = nullptr;
+
+    if (m_threadKeyCreated && m_traceFile.IsOpen())
+    {
+        pBuffer = static_cast<ThreadBuffer*>(GetThreadLocalValue(m_threadKey));
+
+        if (pBuffer == nullptr)
+        {
+            pBuffer = PAL_NEW(ThreadBuffer, m_pPlatform, AllocInternal);
+
+            if (pBuffer != nullptr)
+            {
+                pBuffer->used = 0;
+
+                MutexAuto lock(&m_lock);
+                pBuffer->threadIndex = m_numThreadBuffers++;
+                pBuffer->pNext       = m_pThreadBuffers;
+                m_pThreadBuffers     = pBuffer;
+
+                SetThreadLocalValue(m_threadKey, pBuffer);
+            }
+        }
+    }
+
+    return pBuffer;
+}
+
+// =====================================================================================================================
+// Appends the first "size" bytes of a thread buffer to the trace file as one chunk.
+void DrmTracer::WriteChunk(
+    ThreadBuffer* pBuffer,
+    uint32        size
+    ) const
+{
+    if (size > 0)
+    {
+        DrmTraceChunkHeader header = {};
+        header.threadIndex = pBuffer->threadIndex;
+        header.chunkSize   = size;
+
+        MutexAuto lock(&m_lock);
+        m_traceFile.Write(&header, sizeof(header));
+        m_traceFile.Write(&pBuffer->data[0], size);
+    }
+}
+
+// =====================================================================================================================
+void DrmTracer::RecordLatency(
+    uint32 entryPoint,
+    int64  elapsedTicks
+    ) const
+{
+    const uint64 elapsedNs = static_cast<uint64>(static_cast<double>(Max(elapsedTicks, int64(0))) * m_nsPerTick);
+    const uint32 bucket    = Min(Log2(elapsedNs), NumLatencyBuckets - 1);
+
+    AtomicIncrement(&m_histograms[entryPoint][bucket]);
+}
+
+// =====================================================================================================================
+// Writes one CSV row per entry point that was called at least once.
+void DrmTracer::WriteLatencySummary() const
+{
+    char fileName[sizeof(m_logPath) + 32];
+    Snprintf(fileName, sizeof(fileName), "%s/DrmLoaderLatency.csv", m_logPath);
+
+    File file;
+    if (file.Open(fileName, FileAccessWrite) == Result::Success)
+    {
+        file.Printf("# Column N counts the calls which took between 2^N and 2^(N+1) nanoseconds.\n");
+        file.Printf("entryPoint,calls");
+
+        for (uint32 bucket = 0; bucket < NumLatencyBuckets; ++bucket)
+        {
+            file.Printf(",%u", bucket);
+        }
+
+        file.Printf("\n");
+
+        for (uint32 entryPoint = 0; entryPoint < m_numEntryPoints; ++entryPoint)
+        {
+            uint64 calls = 0;
+
+            for (uint32 bucket = 0; bucket < NumLatencyBuckets; ++bucket)
+            {
+                calls += m_histograms[entryPoint][bucket];
+            }
+
+            if (calls > 0)
+            {
+                file.Printf("%s,%llu", m_ppEntryPointNames[entryPoint], static_cast<unsigned long long>(calls));
+
+                for (uint32 bucket = 0; bucket < NumLatencyBuckets; ++bucket)
+                {
+                    file.Printf(",%u", m_histograms[entryPoint][bucket]);
+                }
+
+                file.Printf("\n");
+            }
+        }
+
+        file.Close();
+    }
+}
+
+// =====================================================================================================================
+DrmTraceCall::DrmTraceCall(
+    const DrmTracer* pTracer,
+    uint32           entryPoint)
+    :
+    m_pTracer(pTracer),
+    m_pBuffer(nullptr),
+    m_entryPoint(entryPoint),
+    m_recordOffset(0),
+    m_payloadSize(0),
+    m_beginTicks(0),
+    m_endTicks(0),
+    m_result(0),
+    m_sequence(0)
+{
+    if (pTracer->IsEnabled())
+    {
+        m_pBuffer = pTracer->GetThreadBuffer();
+
+        if (m_pBuffer != nullptr)
+        {
+            if ((m_pBuffer->used + sizeof(DrmTraceRecord)) > DrmTracer::ThreadBufferSize)
+            {
+                pTracer->WriteChunk(m_pBuffer, m_pBuffer->used);
+                m_pBuffer->used = 0;
+            }
+
+            m_recordOffset = m_pBuffer->used;
+        }
+
+        m_beginTicks = GetPerfCpuTime();
+    }
+}
+
+// =====================================================================================================================
+// Appends a captured value to the payload of the record being built. Null pointers are captured as empty values so
+// the replayer sees the same number of values for every call.
+void DrmTraceCall::CaptureOut(
+    const void* pData,
+    size_t      size)
+{
+    if (m_pBuffer != nullptr)
+    {
+        uint32 capturedSize = ((pData != nullptr) && (size <= MaxCapturedValueSize)) ? static_cast<uint32>(size) : 0;
+        uint32 recordEnd    = m_recordOffset + sizeof(DrmTraceRecord) + m_payloadSize;
+
+        if ((recordEnd + sizeof(uint32) + capturedSize + sizeof(uint64)) > DrmTracer::ThreadBufferSize)
+        {
+            // Write out the complete records ahead of this one and move the partial record to the front.
+            uint8* pData8 = reinterpret_cast<uint8*>(&m_pBuffer->data[0]);
+
+            m_pTracer->WriteChunk(m_pBuffer, m_recordOffset);
+            memmove(pData8, pData8 + m_recordOffset, recordEnd - m_recordOffset);
+
+            recordEnd     -= m_recordOffset;
+            m_recordOffset = 0;
+
+            if ((recordEnd + sizeof(uint32) + capturedSize + sizeof(uint64)) > DrmTracer::ThreadBufferSize)
+            {
+                capturedSize = 0;
+            }
+        }
+
+        if ((recordEnd + sizeof(uint32) + sizeof(uint64)) <= DrmTracer::ThreadBufferSize)
+        {
+            uint8* pDst = reinterpret_cast<uint8*>(&m_pBuffer->data[0]) + recordEnd;
+
+            memcpy(pDst, &capturedSize, sizeof(capturedSize));
+            if (capturedSize > 0)
+            {
+                memcpy(pDst + sizeof(capturedSize), pData, capturedSize);
+            }
+
+            m_payloadSize += sizeof(capturedSize) + capturedSize;
+        }
+        else
+        {
+            // The payload captured so far fills the whole buffer; drop this call's record rather than corrupt it.
+            m_pBuffer = nullptr;
+        }
+    }
+}
+
+// =====================================================================================================================
+void DrmTraceCall::CaptureString(
+    const char* pString)
+{
+    CaptureOut(pString, (pString != nullptr) ? (strlen(pString) + 1) : 0);
+}
+
+// =====================================================================================================================
+// Stops timing the call and updates the entry point's latency histogram.
+void DrmTraceCall::End(
+    int64 result)
+{
+    if (m_pTracer->IsEnabled())
+    {
+        m_endTicks = GetPerfCpuTime();
+        m_result   = result;
+        m_sequence = AtomicIncrement64(&m_pTracer->m_sequence) - 1;
+
+        m_pTracer->RecordLatency(m_entryPoint, m_endTicks - m_beginTicks);
+    }
+}
+
+// =====================================================================================================================
+// Commits the record and its captured out-parameters to the thread's buffer.
+DrmTraceCall::~DrmTraceCall()
+{
+    if (m_pBuffer != nullptr)
+    {
+        uint8*       pData8       = reinterpret_cast<uint8*>(&m_pBuffer->data[0]);
+        const uint32 payloadStart = m_recordOffset + sizeof(DrmTraceRecord);
+        const uint32 payloadSize  = Pow2Align(m_payloadSize, static_cast<uint32>(sizeof(uint64)));
+
+        memset(pData8 + payloadStart + m_payloadSize, 0, payloadSize - m_payloadSize);
+
+        DrmTraceRecord record = {};
+        record.entryPoint  = m_entryPoint;
+        record.payloadSize = payloadSize;
+        record.sequence    = m_sequence;
+        record.beginTicks  = m_beginTicks;
+        record.endTicks    = m_endTicks;
+        record.result      = m_result;
+
+        memcpy(pData8 + m_recordOffset, &record, sizeof(record));
+        m_pBuffer->used = payloadStart + payloadSize;
+    }
+}
+
+// =====================================================================================================================
+// Steps through the records of a trace, one chunk at a time. Returns null at the end of the trace or at the first
+// malformed record.
+static const DrmTraceRecord* NextTraceRecord(
+    const uint8* pData,
+    size_t       dataSize,
+    size_t*      pOffset,
+    size_t*      pChunkEnd)
+{
+    const DrmTraceRecord* pRecord = nullptr;
+
+    if ((*pOffset == *pChunkEnd) && ((*pOffset + sizeof(DrmTraceChunkHeader)) <= dataSize))
+    {
+        DrmTraceChunkHeader header = {};
+        memcpy(&header, pData + *pOffset, sizeof(header));
+
+        *pOffset  += sizeof(header);
+        *pChunkEnd = Min(*pOffset + header.chunkSize, dataSize);
+    }
+
+    if ((*pOffset + sizeof(DrmTraceRecord)) <= *pChunkEnd)
+    {
+        pRecord = reinterpret_cast<const DrmTraceRecord*>(pData + *pOffset);
+
+        const size_t next = *pOffset + sizeof(DrmTraceRecord) + pRecord->payloadSize;
+
+        if (next <= *pChunkEnd)
+        {
+            *pOffset = next;
+        }
+        else
+        {
+            pRecord = nullptr;
+        }
+    }
+
+    return pRecord;
+}
+
+// =====================================================================================================================
+DrmReplayer::DrmReplayer()
+    :
+    m_pPlatform(nullptr),
+    m_pTraceData(nullptr),
+    m_ppRecords(nullptr)
+{
+    memset(&m_firstRecord[0], 0, sizeof(m_firstRecord));
+    memset(&m_numRecords[0],  0, sizeof(m_numRecords));
+    memset(&m_nextRecord[0],  0, sizeof(m_nextRecord));
+}
+
+// =====================================================================================================================
+DrmReplayer::~DrmReplayer()
+{
+    if (s_pActiveReplayer == this)
+    {
+        s_pActiveReplayer = nullptr;
+    }
+
+    if (m_pPlatform != nullptr)
+    {
+        PAL_SAFE_FREE(m_ppRecords, m_pPlatform);
+        PAL_SAFE_FREE(m_pTraceData, m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+// Loads a trace written by DrmTracer and indexes its records by entry point, in the order the calls were issued.
+Result DrmReplayer::Init(
+    Platform*   pPlatform,
+    const char* pTraceFile,
+    uint32      numEntryPoints)
+{
+    Result result = Result::Success;
+
+    if ((s_pActiveReplayer != nullptr) || (numEntryPoints > DrmTracer::MaxEntryPoints))
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else
+    {
+        m_pPlatform = pPlatform;
+        result      = m_lock.Init();
+    }
+
+    const size_t dataSize = File::GetFileSize(pTraceFile);
+
+    if ((result == Result::Success) &&
+        ((dataSize == static_cast<size_t>(-1)) || (dataSize < sizeof(DrmTraceFileHeader))))
+    {
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        m_pTraceData = PAL_MALLOC(dataSize, m_pPlatform, AllocInternal);
+
+        if (m_pTraceData == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        File   file;
+        size_t bytesRead = 0;
+
+        result = file.Open(pTraceFile, FileAccessRead | FileAccessBinary);
+
+        if (result == Result::Success)
+        {
+            result = file.Read(m_pTraceData, dataSize, &bytesRead);
+            file.Close();
+        }
+
+        if ((result == Result::Success) && (bytesRead != dataSize))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+    }
+
+    const uint8* pData = static_cast<const uint8*>(m_pTraceData);
+
+    if (result == Result::Success)
+    {
+        const DrmTraceFileHeader* pHeader = reinterpret_cast<const DrmTraceFileHeader*>(pData);
+
+        if ((pHeader->magic != DrmTraceMagic)     ||
+            (pHeader->version != DrmTraceVersion) ||
+            (pHeader->numEntryPoints != numEntryPoints))
+        {
+            result = Result::ErrorIncompatibleLibrary;
+        }
+    }
+
+    uint32 numRecords  = 0;
+    uint64 maxSequence = 0;
+
+    if (result == Result::Success)
+    {
+        size_t offset   = sizeof(DrmTraceFileHeader);
+        size_t chunkEnd = offset;
+
+        for (const DrmTraceRecord* pRecord = NextTraceRecord(pData, dataSize, &offset, &chunkEnd);
+             pRecord != nullptr;
+             pRecord = NextTraceRecord(pData, dataSize, &offset, &chunkEnd))
+        {
+            if (pRecord->entryPoint < numEntryPoints)
+            {
+                m_numRecords[pRecord->entryPoint]++;
+                maxSequence = Max(maxSequence, pRecord->sequence);
+                numRecords++;
+            }
+        }
+    }
+
+    const DrmTraceRecord** ppBySequence = nullptr;
+
+    if ((result == Result::Success) && (numRecords > 0))
+    {
+        // Records arrive in per-thread chunks, so place them by their global sequence number before grouping them.
+        m_ppRecords  = static_cast<const DrmTraceRecord**>(
+                            PAL_MALLOC(sizeof(DrmTraceRecord*) * numRecords, m_pPlatform, AllocInternal));
+        ppBySequence = static_cast<const DrmTraceRecord**>(
+                            PAL_CALLOC(sizeof(DrmTraceRecord*) * (maxSequence + 1), m_pPlatform, AllocInternal));
+
+        if ((m_ppRecords == nullptr) || (ppBySequence == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if ((result == Result::Success) && (numRecords > 0))
+    {
+        size_t offset   = sizeof(DrmTraceFileHeader);
+        size_t chunkEnd = offset;
+
+        for (const DrmTraceRecord* pRecord = NextTraceRecord(pData, dataSize, &offset, &chunkEnd);
+             pRecord != nullptr;
+             pRecord = NextTraceRecord(pData, dataSize, &offset, &chunkEnd))
+        {
+            if (pRecord->entryPoint < numEntryPoints)
+            {
+                ppBySequence[pRecord->sequence] = pRecord;
+            }
+        }
+
+        for (uint32 entryPoint = 1; entryPoint < numEntryPoints; ++entryPoint)
+        {
+            m_firstRecord[entryPoint] = m_firstRecord[entryPoint - 1] + m_numRecords[entryPoint - 1];
+        }
+
+        for (uint64 sequence = 0; sequence <= maxSequence; ++sequence)
+        {
+            const DrmTraceRecord* pRecord = ppBySequence[sequence];
+
+            if (pRecord != nullptr)
+            {
+                const uint32 entryPoint = pRecord->entryPoint;
+                m_ppRecords[m_firstRecord[entryPoint] + m_nextRecord[entryPoint]++] = pRecord;
+            }
+        }
+
+        memset(&m_nextRecord[0], 0, sizeof(m_nextRecord));
+    }
+
+    PAL_SAFE_FREE(ppBySequence, m_pPlatform);
+
+    if (result == Result::Success)
+    {
+        s_pActiveReplayer = this;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns the next unplayed record for the given entry point, or null once they have all been played.
+const DrmTraceRecord* DrmReplayer::NextRecord(
+    uint32 entryPoint)
+{
+    const DrmTraceRecord* pRecord = nullptr;
+
+    MutexAuto lock(&m_lock);
+
+    if (m_nextRecord[entryPoint] < m_numRecords[entryPoint])
+    {
+        pRecord = m_ppRecords[m_firstRecord[entryPoint] + m_nextRecord[entryPoint]++];
+    }
+
+    return pRecord;
+}
+
+// =====================================================================================================================
+DrmReplayCall::DrmReplayCall(
+    uint32 entryPoint)
+    :
+    m_pRecord(nullptr),
+    m_payloadOffset(0),
+    m_result(-ENODATA)
+{
+    DrmReplayer* pReplayer = DrmReplayer::ActiveReplayer();
+    PAL_ASSERT(pReplayer != nullptr);
+
+    m_pRecord = pReplayer->NextRecord(entryPoint);
+
+    if (m_pRecord != nullptr)
+    {
+        m_result = m_pRecord->result;
+    }
+    else
+    {
+        PAL_ALERT_ALWAYS_MSG("The trace has no more calls to libdrm entry point %u.", entryPoint);
+    }
+}
+
+// =====================================================================================================================
+// Returns the next captured value of the record being replayed, or null if it was captured as empty or is missing.
+const void* DrmReplayCall::NextPayload(
+    uint32* pSize)
+{
+    const void* pPayload = nullptr;
+
+    *pSize = 0;
+
+    if ((m_pRecord != nullptr) && ((m_payloadOffset + sizeof(uint32)) <= m_pRecord->payloadSize))
+    {
+        const uint8* pData = reinterpret_cast<const uint8*>(m_pRecord + 1) + m_payloadOffset;
+        uint32       size  = 0;
+
+        memcpy(&size, pData, sizeof(size));
+
+        if ((m_payloadOffset + sizeof(uint32) + size) <= m_pRecord->payloadSize)
+        {
+            m_payloadOffset += sizeof(uint32) + size;
+
+            if (size > 0)
+            {
+                pPayload = pData + sizeof(uint32);
+                *pSize   = size;
+            }
+        }
+    }
+
+    return pPayload;
+}
+
+// =====================================================================================================================
+void DrmReplayCall::RestoreOut(
+    void*  pData,
+    size_t size)
+{
+    uint32      capturedSize = 0;
+    const void* pCaptured    = NextPayload(&capturedSize);
+
+    if ((pData != nullptr) && (pCaptured != nullptr) && (capturedSize == size))
+    {
+        memcpy(pData, pCaptured, size);
+    }
+}
+
+// =====================================================================================================================
+// The replayed call fails instead of returning the recorded result, since the caller would go on to use out-parameters
+// which the trace doesn't contain.
+int32 DrmReplayCall::Unsupported(
+    const char* pEntryPointName)
+{
+    PAL_ALERT_ALWAYS_MSG("%s cannot be replayed from a libdrm trace.", pEntryPointName);
+
+    return -ENOTSUP;
+}
+
+// =====================================================================================================================
+// Returns a recorded string. The string lives in the replayer's copy of the trace, which outlives every replayed call.
+char* DrmReplayCall::RestoreString()
+{
+    uint32      size     = 0;
+    const void* pString  = NextPayload(&size);
+
+    return const_cast<char*>(static_cast<const char*>(pString));
+}
+
+} // Amdgpu
+} // Pal
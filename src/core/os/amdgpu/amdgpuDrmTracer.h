@@ -0,0 +1,236 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palFile.h"
+#include "palMutex.h"
+#include "palThread.h"
+
+namespace Pal
+{
+namespace Amdgpu
+{
+
+class Platform;
+
+// Layout of the binary trace file written by DrmTracer:
+//
+//   DrmTraceFileHeader
+//   DrmTraceChunkHeader, followed by chunkSize bytes of records  (repeated)
+//
+// Each chunk is the contents of one thread's trace buffer. A record is a DrmTraceRecord followed by payloadSize bytes
+// of captured out-parameters; each captured value is a uint32 byte count followed by the bytes themselves (a count of
+// zero means the pointer was null or the value was too large to capture). Records start on 8-byte boundaries.
+constexpr uint32 DrmTraceMagic   = 0x54524450; // 'PDRT'
+constexpr uint32 DrmTraceVersion = 1;
+
+struct DrmTraceFileHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint32 numEntryPoints;
+    uint32 reserved;
+    int64  ticksPerSecond;
+};
+
+struct DrmTraceChunkHeader
+{
+    uint32 threadIndex;
+    uint32 chunkSize;
+};
+
+struct DrmTraceRecord
+{
+    uint32 entryPoint;
+    uint32 payloadSize;
+    uint64 sequence;    // Global call order across all threads.
+    int64  beginTicks;
+    int64  endTicks;
+    int64  result;      // The return value, or whether a pointer was returned for pointer-returning entry points.
+};
+
+// =====================================================================================================================
+// Low-overhead tracer for the libdrm entry points called through DrmLoaderFuncsProxy. Every call is counted in a log2
+// latency histogram per entry point. When a log path is given, each call is also appended as a binary record to a
+// buffer owned by the calling thread; full buffers are written to DrmLoaderTrace.bin, so the only shared state touched
+// on the hot path is one atomic counter and one histogram bucket. The histograms are written to DrmLoaderLatency.csv
+// when the tracer is destroyed.
+class DrmTracer
+{
+public:
+    static constexpr uint32 MaxEntryPoints    = 128;
+    static constexpr uint32 NumLatencyBuckets = 32;        // Bucket N counts calls which took [2^N, 2^(N+1)) ns.
+    static constexpr uint32 ThreadBufferSize  = 64 * 1024;
+
+    DrmTracer();
+    ~DrmTracer();
+
+    Result Init(
+        Platform*          pPlatform,
+        const char*        pLogPath,
+        uint32             numEntryPoints,
+        const char*const*  ppEntryPointNames);
+
+    bool IsEnabled() const { return (m_pPlatform != nullptr); }
+
+    uint32 GetLatencyCount(uint32 entryPoint, uint32 bucket) const { return m_histograms[entryPoint][bucket]; }
+
+private:
+    friend class DrmTraceCall;
+
+    struct ThreadBuffer
+    {
+        ThreadBuffer* pNext;
+        uint32        threadIndex;
+        uint32        used;
+        uint64        data[ThreadBufferSize / sizeof(uint64)];
+    };
+
+    ThreadBuffer* GetThreadBuffer() const;
+    void WriteChunk(ThreadBuffer* pBuffer, uint32 size) const;
+    void RecordLatency(uint32 entryPoint, int64 elapsedTicks) const;
+    void WriteLatencySummary() const;
+
+    Platform*                 m_pPlatform;
+    const char*const*         m_ppEntryPointNames;
+    uint32                    m_numEntryPoints;
+    double                    m_nsPerTick;
+    char                      m_logPath[256];
+
+    mutable Util::Mutex       m_lock;           // Protects the trace file and the thread buffer list.
+    mutable Util::File        m_traceFile;
+    Util::ThreadLocalKey      m_threadKey;
+    bool                      m_threadKeyCreated;
+    mutable ThreadBuffer*     m_pThreadBuffers;
+    mutable uint32            m_numThreadBuffers;
+    mutable volatile uint64   m_sequence;
+    mutable volatile uint32   m_histograms[MaxEntryPoints][NumLatencyBuckets];
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(DrmTracer);
+};
+
+// =====================================================================================================================
+// Traces a single call through the proxy: construct it right before calling into libdrm and call End() with the result
+// as soon as the call returns, so that only the call itself is timed. Out-parameters are captured after End() and the
+// record is committed when the object goes out of scope.
+class DrmTraceCall
+{
+public:
+    DrmTraceCall(const DrmTracer* pTracer, uint32 entryPoint);
+    ~DrmTraceCall();
+
+    void End(int64 result);
+
+    template <typename T>
+    void CaptureOut(const T* pValue) { CaptureOut(pValue, (pValue != nullptr) ? sizeof(T) : 0); }
+    void CaptureOut(const void* pData, size_t size);
+    void CaptureString(const char* pString);
+
+private:
+    const DrmTracer*         m_pTracer;
+    DrmTracer::ThreadBuffer* m_pBuffer;
+    uint32                   m_entryPoint;
+    uint32                   m_recordOffset;
+    uint32                   m_payloadSize;
+    int64                    m_beginTicks;
+    int64                    m_endTicks;
+    int64                    m_result;
+    uint64                   m_sequence;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(DrmTraceCall);
+};
+
+// =====================================================================================================================
+// Serves the results recorded by DrmTracer back to the generated replay stubs installed by DrmLoader::InitReplay. Each
+// entry point replays its own records in the order they were originally issued, so a deterministic caller receives the
+// same return values and out-parameters it saw while recording. Only one replayer may be active per process because
+// the stubs are plain function pointers.
+class DrmReplayer
+{
+public:
+    DrmReplayer();
+    ~DrmReplayer();
+
+    Result Init(
+        Platform*   pPlatform,
+        const char* pTraceFile,
+        uint32      numEntryPoints);
+
+    bool IsActive() const { return (s_pActiveReplayer == this); }
+
+    static DrmReplayer* ActiveReplayer() { return s_pActiveReplayer; }
+
+private:
+    friend class DrmReplayCall;
+
+    const DrmTraceRecord* NextRecord(uint32 entryPoint);
+
+    Platform*              m_pPlatform;
+    void*                  m_pTraceData;
+    const DrmTraceRecord** m_ppRecords;     // Every record, grouped by entry point and in call order within a group.
+    uint32                 m_firstRecord[DrmTracer::MaxEntryPoints];
+    uint32                 m_numRecords[DrmTracer::MaxEntryPoints];
+    uint32                 m_nextRecord[DrmTracer::MaxEntryPoints];
+    Util::Mutex            m_lock;
+
+    static DrmReplayer*    s_pActiveReplayer;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(DrmReplayer);
+};
+
+// =====================================================================================================================
+// Replays a single call: restores the out-parameters in the same order the tracer captured them and returns the
+// recorded result.
+class DrmReplayCall
+{
+public:
+    explicit DrmReplayCall(uint32 entryPoint);
+    ~DrmReplayCall() { }
+
+    template <typename T>
+    void RestoreOut(T* pValue) { RestoreOut(pValue, sizeof(T)); }
+    void RestoreOut(void* pData, size_t size);
+    char* RestoreString();
+
+    template <typename T>
+    T ReturnValue() const { return static_cast<T>(m_result); }
+
+    // Fails a call whose results the trace can't reproduce, such as objects allocated by libdrm or CPU mappings.
+    int32 Unsupported(const char* pEntryPointName);
+
+private:
+    const void* NextPayload(uint32* pSize);
+
+    const DrmTraceRecord* m_pRecord;
+    uint32                m_payloadOffset;
+    int64                 m_result;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(DrmReplayCall);
+};
+
+} // Amdgpu
+} // Pal
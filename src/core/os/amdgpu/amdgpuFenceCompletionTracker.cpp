@@ -0,0 +1,407 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/queue.h"
+#include "core/os/amdgpu/amdgpuFenceCompletionTracker.h"
+#include "core/os/amdgpu/g_drmLoader.h"
+#include "palDequeImpl.h"
+#include "palVectorImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace Amdgpu
+{
+
+// Each timeline queues up its outstanding timestamps in blocks of this size.
+static constexpr size_t PendingTimestampsPerBlock = 64;
+
+// How long the tracker thread blocks in the kernel before it checks for new timelines and for Stop(), in nanoseconds.
+static constexpr uint64 FenceWaitTimeout = 2000000;
+
+// =====================================================================================================================
+FenceTimeline::FenceTimeline(
+    IPlatform*              pPlatform,
+    FenceCompletionTracker* pTracker,
+    Pal::SubmissionContext* pOwner)
+    :
+    m_pTracker(pTracker),
+    m_pOwner(pOwner),
+    m_lastRetired(0),
+    m_pending(pPlatform, PendingTimestampsPerBlock),
+    m_isTracked(false)
+{
+    memset(&m_fence, 0, sizeof(m_fence));
+}
+
+// =====================================================================================================================
+void FenceTimeline::Init(
+    amdgpu_context_handle hContext,
+    uint32                ipType,
+    uint32                ring)
+{
+    m_fence.context     = hContext;
+    m_fence.ip_type     = ipType;
+    m_fence.ip_instance = 0;
+    m_fence.ring        = ring;
+}
+
+// =====================================================================================================================
+void FenceTimeline::Track(
+    uint64 timestamp)
+{
+    if (m_pTracker != nullptr)
+    {
+        const Result result = m_pTracker->TrackTimestamp(this, timestamp);
+        PAL_ALERT(result != Result::Success);
+    }
+}
+
+// =====================================================================================================================
+void FenceTimeline::TakeOwnerReference()
+{
+    if (m_pOwner != nullptr)
+    {
+        m_pOwner->TakeReference();
+    }
+}
+
+// =====================================================================================================================
+void FenceTimeline::ReleaseOwnerReference()
+{
+    if (m_pOwner != nullptr)
+    {
+        // This may be the last reference, in which case the owner and this timeline are destroyed here.
+        m_pOwner->ReleaseReference();
+    }
+}
+
+// =====================================================================================================================
+static void FenceCompletionThreadCallback(
+    void* pParameter)
+{
+    static_cast<FenceCompletionTracker*>(pParameter)->Run();
+}
+
+// =====================================================================================================================
+FenceCompletionTracker::FenceCompletionTracker(
+    IPlatform*                 pPlatform,
+    const DrmLoaderFuncsProxy& drmProcs)
+    :
+    m_pPlatform(pPlatform),
+    m_drmProcs(drmProcs),
+    m_exit(false),
+    m_idle(false),
+    m_timelines(pPlatform),
+    m_waitFences(pPlatform),
+    m_waitTimelines(pPlatform)
+{
+}
+
+// =====================================================================================================================
+FenceCompletionTracker::~FenceCompletionTracker()
+{
+    Stop();
+}
+
+// =====================================================================================================================
+Result FenceCompletionTracker::Init()
+{
+    PAL_ASSERT(m_drmProcs.pfnAmdgpuCsWaitFencesisValid());
+
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_notify.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_thread.Begin(&FenceCompletionThreadCallback, this);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Terminates the tracker thread and drops every timeline it still tracks. Those timelines stop handing their
+// timestamps to the tracker; the timestamps already published for them remain valid.
+void FenceCompletionTracker::Stop()
+{
+    if (m_thread.IsCreated())
+    {
+        PAL_ASSERT(m_thread.IsNotCurrentThread());
+
+        m_exit = true;
+        m_notify.Post();
+        m_thread.Join();
+    }
+
+    while (m_timelines.IsEmpty() == false)
+    {
+        FenceTimeline* pTimeline = nullptr;
+        m_timelines.PopBack(&pTimeline);
+
+        pTimeline->m_pTracker  = nullptr;
+        pTimeline->m_isTracked = false;
+        pTimeline->ReleaseOwnerReference();
+    }
+}
+
+// =====================================================================================================================
+Result FenceCompletionTracker::TrackTimestamp(
+    FenceTimeline* pTimeline,
+    uint64         timestamp)
+{
+    MutexAuto lock(&m_lock);
+
+    Result result = pTimeline->m_pending.PushBack(timestamp);
+
+    if ((result == Result::Success) && (pTimeline->m_isTracked == false))
+    {
+        result = m_timelines.PushBack(pTimeline);
+
+        if (result == Result::Success)
+        {
+            pTimeline->TakeOwnerReference();
+            pTimeline->m_isTracked = true;
+        }
+    }
+
+    if ((result == Result::Success) && m_idle)
+    {
+        m_idle = false;
+        m_notify.Post();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Executes the tracker thread.
+void FenceCompletionTracker::Run()
+{
+    while (m_exit == false)
+    {
+        const uint32 waitCount = BuildWaitList();
+
+        if (waitCount == 0)
+        {
+            // Nothing is pending; sleep until TrackTimestamp() or Stop() wakes us up.
+            const Result waitResult = m_notify.Wait(UINT32_MAX);
+            PAL_ASSERT(IsErrorResult(waitResult) == false);
+        }
+        else
+        {
+            uint32 status = 0;
+            uint32 first  = 0;
+
+            // Block until at least one of the fences completes or the timeout expires. The wait list is rebuilt every
+            // time around, so timelines which started submitting during the wait are picked up within one timeout.
+            const int32 ret = m_drmProcs.pfnAmdgpuCsWaitFences(m_waitFences.Data(),
+                                                               waitCount,
+                                                               false,
+                                                               FenceWaitTimeout,
+                                                               &status,
+                                                               &first);
+
+            // Nothing can have retired if the wait simply timed out. If the wait fails, for example because a
+            // context was lost, RetireTimestamps() drops the timelines whose contexts can't be queried so we don't
+            // spin on them.
+            if ((ret != 0) || (status != 0))
+            {
+                RetireTimestamps(waitCount);
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Fills the wait list with the oldest pending timestamp of every tracked timeline. Marks the tracker idle and returns
+// zero if there's nothing to wait on.
+uint32 FenceCompletionTracker::BuildWaitList()
+{
+    MutexAuto lock(&m_lock);
+
+    m_waitFences.Clear();
+    m_waitTimelines.Clear();
+
+    for (uint32 idx = 0; idx < m_timelines.NumElements(); ++idx)
+    {
+        FenceTimeline*const pTimeline = m_timelines.At(idx);
+
+        amdgpu_cs_fence fence = pTimeline->m_fence;
+        fence.fence = pTimeline->m_pending.Front();
+
+        // If we run out of memory just wait on fewer timelines this time around; the rest are still checked once we
+        // have room for them.
+        if ((m_waitFences.PushBack(fence) != Result::Success) ||
+            (m_waitTimelines.PushBack(pTimeline) != Result::Success))
+        {
+            break;
+        }
+    }
+
+    // The two lists can differ in length by one if the second allocation failed.
+    const uint32 waitCount = Min(m_waitFences.NumElements(), m_waitTimelines.NumElements());
+
+    m_idle = (waitCount == 0);
+
+    return waitCount;
+}
+
+// =====================================================================================================================
+// Returns Success if the given fence has retired, NotReady if it is still busy, or an error if it can't be queried.
+Result FenceCompletionTracker::QueryFence(
+    amdgpu_cs_fence* pFence
+    ) const
+{
+    uint32 expired = 0;
+    Result result  = (m_drmProcs.pfnAmdgpuCsQueryFenceStatus(pFence, 0, 0, &expired) == 0) ? Result::Success
+                                                                                            : Result::ErrorUnknown;
+
+    if ((result == Result::Success) && (expired == 0))
+    {
+        result = Result::NotReady;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes a timeline whose pending list drained from the tracked list. The caller must hold the lock and must release
+// the owner reference once it has dropped the lock.
+void FenceCompletionTracker::Untrack(
+    FenceTimeline* pTimeline)
+{
+    for (uint32 idx = 0; idx < m_timelines.NumElements(); ++idx)
+    {
+        if (m_timelines.At(idx) == pTimeline)
+        {
+            FenceTimeline* pLast = nullptr;
+            m_timelines.PopBack(&pLast);
+
+            if (pLast != pTimeline)
+            {
+                m_timelines.At(idx) = pLast;
+            }
+            break;
+        }
+    }
+
+    pTimeline->m_isTracked = false;
+}
+
+// =====================================================================================================================
+// Pops every retired timestamp off the pending lists of the timelines we waited on, publishes the newest retired
+// timestamp of each, and stops tracking timelines which have nothing left pending.
+void FenceCompletionTracker::RetireTimestamps(
+    uint32 waitCount)
+{
+    for (uint32 idx = 0; idx < waitCount; ++idx)
+    {
+        FenceTimeline*const pTimeline = m_waitTimelines.At(idx);
+        auto*const          pPending  = &pTimeline->m_pending;
+        amdgpu_cs_fence     fence     = m_waitFences.At(idx);
+
+        // Only this thread pops timestamps, so the ones read here stay pending until we pop them and we never need to
+        // hold the lock while calling into the kernel. If the newest timestamp has retired so has everything before it,
+        // which saves a query per older submission.
+        m_lock.Lock();
+        const uint64 newest = pPending->Back();
+        m_lock.Unlock();
+
+        fence.fence = newest;
+
+        uint64       retired = 0;
+        const Result status  = QueryFence(&fence);
+
+        m_lock.Lock();
+
+        if (status == Result::NotReady)
+        {
+            // Walk forward from the oldest timestamp until we find one which is still busy. We already know that the
+            // newest one is.
+            while (true)
+            {
+                fence.fence = pPending->Front();
+                m_lock.Unlock();
+
+                const bool popFront = (fence.fence != newest) && (QueryFence(&fence) == Result::Success);
+
+                m_lock.Lock();
+
+                if (popFront == false)
+                {
+                    break;
+                }
+
+                pPending->PopFront(&retired);
+            }
+        }
+        else
+        {
+            // Either everything we know of retired or the context can't be queried any more, typically because it was
+            // lost. Its timestamps would never retire in the latter case, so drop them instead of waiting on them
+            // forever; status checks on them keep falling back to the kernel.
+            uint64 timestamp = 0;
+            do
+            {
+                pPending->PopFront(&timestamp);
+            } while (timestamp != newest);
+
+            if (status == Result::Success)
+            {
+                retired = newest;
+            }
+        }
+
+        bool releaseOwner = false;
+
+        if (pPending->NumElements() == 0)
+        {
+            // TrackTimestamp() adds this timeline again on its next submission.
+            Untrack(pTimeline);
+            releaseOwner = true;
+        }
+
+        m_lock.Unlock();
+
+        if (retired != 0)
+        {
+            AtomicExchange64(&pTimeline->m_lastRetired, retired);
+        }
+
+        if (releaseOwner)
+        {
+            pTimeline->ReleaseOwnerReference();
+        }
+    }
+}
+
+} // Amdgpu
+} // Pal
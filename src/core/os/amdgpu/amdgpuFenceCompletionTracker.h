@@ -0,0 +1,156 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/os/amdgpu/amdgpuHeaders.h"
+#include "palDeque.h"
+#include "palMutex.h"
+#include "palPlatform.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+#include "palVector.h"
+
+namespace Pal
+{
+
+class SubmissionContext;
+
+namespace Amdgpu
+{
+
+class DrmLoaderFuncsProxy;
+class FenceCompletionTracker;
+
+// =====================================================================================================================
+// The completion tracking state of one amdgpu command submission context's timeline. The FenceCompletionTracker waits
+// on every timestamp handed to Track() and publishes the newest retired one, which HasRetired() checks with a single
+// load.
+class FenceTimeline
+{
+public:
+    // The tracker keeps pOwner alive while this timeline has pending timestamps. It may be null if the owner's lifetime
+    // is managed elsewhere.
+    FenceTimeline(IPlatform* pPlatform, FenceCompletionTracker* pTracker, Pal::SubmissionContext* pOwner);
+
+    // Must be called once the amdgpu context exists, before the first call to Track().
+    void Init(amdgpu_context_handle hContext, uint32 ipType, uint32 ring);
+
+    // Hands a newly submitted timestamp to the tracker, if there is one. This must be called once per submission, in
+    // submission order. Losing a timestamp is harmless: the newer ones retire it when they retire themselves.
+    void Track(uint64 timestamp);
+
+    // Returns true if the tracker has already seen the given timestamp retire. This never calls into the kernel, so a
+    // false result is only a hint.
+    bool HasRetired(uint64 timestamp) const { return (timestamp <= m_lastRetired); }
+
+private:
+    friend class FenceCompletionTracker;
+
+    void TakeOwnerReference();
+    void ReleaseOwnerReference();
+
+    FenceCompletionTracker*      m_pTracker;    // Reset to null if the tracker stops before this timeline.
+    Pal::SubmissionContext*const m_pOwner;
+    amdgpu_cs_fence              m_fence;       // Identifies this timeline; the fence member is filled in per wait.
+    volatile uint64              m_lastRetired;
+
+    // Owned by the tracker and only accessed while holding its lock.
+    Util::Deque<uint64, IPlatform> m_pending;   // Submitted timestamps which have not yet been retired.
+    bool                           m_isTracked; // If the tracker holds a reference on the owner.
+
+    PAL_DISALLOW_DEFAULT_CTOR(FenceTimeline);
+    PAL_DISALLOW_COPY_AND_ASSIGN(FenceTimeline);
+};
+
+// =====================================================================================================================
+// Retires submission context timestamps on a background thread so that timestamp status queries don't need to call
+// into the kernel.
+//
+// Every successful submission hands its timestamp to TrackTimestamp(), which appends it to its timeline's list of
+// pending timestamps. Since amdgpu timestamps increase monotonically per context, each of those lists is kept sorted
+// for free. The tracker thread blocks in the kernel on the oldest pending timestamp of every tracked timeline at once;
+// whenever any of them completes it pops every retired timestamp off the front of each list and publishes the newest
+// one through the timeline's last retired timestamp.
+//
+// The kernel wait can't be interrupted, so the thread only blocks for a few milliseconds at a time. Between waits it
+// checks whether it must exit and rebuilds its wait list, so Stop() never waits on the GPU for longer than that and a
+// timeline which starts submitting during a wait is picked up at the next one. Until then its status checks miss and
+// fall back to the kernel, which only costs latency.
+//
+// All kernel access goes through the given DrmLoaderFuncsProxy, so the tracker can be driven by a replayed or stubbed
+// libdrm.
+class FenceCompletionTracker
+{
+public:
+    FenceCompletionTracker(IPlatform* pPlatform, const DrmLoaderFuncsProxy& drmProcs);
+    ~FenceCompletionTracker();
+
+    Result Init();
+
+    // Adds a newly submitted timestamp to the timeline's pending list.
+    Result TrackTimestamp(FenceTimeline* pTimeline, uint64 timestamp);
+
+    // Must be declared public but meant for internal use only.
+    void Run();
+
+private:
+    void   Stop();
+    uint32 BuildWaitList();
+    void   RetireTimestamps(uint32 waitCount);
+    void   Untrack(FenceTimeline* pTimeline);
+    Result QueryFence(amdgpu_cs_fence* pFence) const;
+
+    IPlatform*const            m_pPlatform;
+    const DrmLoaderFuncsProxy& m_drmProcs;
+    Util::Thread               m_thread;
+    Util::Semaphore            m_notify;   // Posted when the tracker goes from idle to having pending timestamps.
+    Util::Mutex                m_lock;     // Protects m_timelines and the pending timestamp lists they own.
+    volatile bool              m_exit;     // Tells the tracker thread to terminate.
+    bool                       m_idle;     // The tracker thread is (about to be) asleep on m_notify.
+
+    // Timelines with pending timestamps. The tracker holds a reference on the owner of each until its list drains.
+    Util::Vector<FenceTimeline*, 8, IPlatform> m_timelines;
+
+    // Only accessed by the tracker thread: the fences it is currently waiting on and the timeline of each fence.
+    Util::Vector<amdgpu_cs_fence, 8, IPlatform> m_waitFences;
+    Util::Vector<FenceTimeline*, 8, IPlatform>  m_waitTimelines;
+
+    PAL_DISALLOW_DEFAULT_CTOR(FenceCompletionTracker);
+    PAL_DISALLOW_COPY_AND_ASSIGN(FenceCompletionTracker);
+};
+
+// Runs palBench's fence tracker scenario against a mock libdrm. Only built into PAL when PAL_BUILD_BENCH is enabled;
+// palBench declares this itself so that it doesn't need PAL's private headers.
+Result RunFenceTrackerBench(
+    IPlatform* pPlatform,
+    uint32     iterations,
+    uint32     opsPerIteration,
+    int64*     pBeginTicks,
+    int64*     pEndTicks,
+    uint64*    pOperations);
+
+} // Amdgpu
+} // Pal
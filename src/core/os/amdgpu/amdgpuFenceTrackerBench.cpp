@@ -0,0 +1,270 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+// This file is only built into PAL for palBench (PAL_BUILD_BENCH). It drives the amdgpu FenceCompletionTracker through
+// a mock libdrm so that the benchmark doesn't need any of PAL's private headers.
+
+#include "core/os/amdgpu/amdgpuFenceCompletionTracker.h"
+#include "core/os/amdgpu/g_drmLoader.h"
+#include "palInlineFuncs.h"
+#include "palSysUtil.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace Amdgpu
+{
+
+// How long the fence tracker scenario waits for a timestamp it completed to be published before it gives up.
+static constexpr int64 MaxPublishLatencySeconds = 5;
+
+// A fake amdgpu command submission context. Its "GPU" has completed every timestamp up to and including completed. A
+// lost context fails every query, like a context which was lost to a GPU reset.
+struct MockContext
+{
+    volatile uint64 completed;
+    bool            lost;
+};
+
+// =====================================================================================================================
+static MockContext* GetMockContext(
+    const amdgpu_cs_fence& fence)
+{
+    return reinterpret_cast<MockContext*>(fence.context);
+}
+
+// =====================================================================================================================
+// Mock amdgpu_cs_query_fence_status; it never blocks.
+static int32 MockQueryFenceStatus(
+    amdgpu_cs_fence* pFence,
+    uint64           timeoutInNs,
+    uint64           flags,
+    uint32*          pExpired)
+{
+    const MockContext*const pContext = GetMockContext(*pFence);
+
+    int32 ret = -ECANCELED;
+
+    if (pContext->lost == false)
+    {
+        (*pExpired) = (pFence->fence <= pContext->completed) ? 1 : 0;
+        ret         = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Mock amdgpu_cs_wait_fences for waitAll == false. It blocks until one of the fences completes or the timeout expires
+// by yielding, which is good enough to stand in for the kernel wait.
+static int32 MockWaitFences(
+    amdgpu_cs_fence* pFences,
+    uint32           fenceCount,
+    bool             waitAll,
+    uint64           timeoutInNs,
+    uint32*          pStatus,
+    uint32*          pFirst)
+{
+    PAL_ASSERT(waitAll == false);
+
+    // Timeouts long enough to overflow the tick math, like AMDGPU_TIMEOUT_INFINITE, never expire.
+    const uint64 frequency = static_cast<uint64>(GetPerfFrequency());
+    const bool   infinite  = (timeoutInNs >= (UINT64_MAX / frequency));
+    const int64  timeout   = infinite ? 0 : static_cast<int64>((timeoutInNs * frequency) / 1000000000ull);
+    const int64  deadline  = infinite ? INT64_MAX : (GetPerfCpuTime() + timeout);
+
+    int32 ret = 1;
+
+    while (ret > 0)
+    {
+        for (uint32 idx = 0; (ret > 0) && (idx < fenceCount); ++idx)
+        {
+            const MockContext*const pContext = GetMockContext(pFences[idx]);
+
+            if (pContext->lost)
+            {
+                ret = -ECANCELED;
+            }
+            else if (pFences[idx].fence <= pContext->completed)
+            {
+                (*pStatus) = 1;
+                (*pFirst)  = idx;
+                ret        = 0;
+            }
+        }
+
+        if ((ret > 0) && (GetPerfCpuTime() >= deadline))
+        {
+            (*pStatus) = 0;
+            ret        = 0;
+        }
+        else if (ret > 0)
+        {
+            YieldThread();
+        }
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Spins until the timeline reports the given timestamp as retired. Returns false if that takes unreasonably long.
+static bool WaitForRetire(
+    const FenceTimeline& timeline,
+    uint64               timestamp)
+{
+    const int64 deadline = GetPerfCpuTime() + (MaxPublishLatencySeconds * GetPerfFrequency());
+
+    while ((timeline.HasRetired(timestamp) == false) && (GetPerfCpuTime() < deadline))
+    {
+        YieldThread();
+    }
+
+    return timeline.HasRetired(timestamp);
+}
+
+// =====================================================================================================================
+// Drives a FenceCompletionTracker through a mock libdrm. Each operation submits one timestamp on each of two fake
+// contexts. The first context completes its timestamps right away, while the second lags one timestamp behind until
+// the end of each iteration, so the tracker must report the second context's newest timestamp as busy until then. A
+// third, lost context receives a timestamp per iteration which must never be reported as retired.
+//
+// A fourth context is given a timestamp which never completes before anything else is submitted. The tracker starts
+// out waiting on it alone, so it must pick up the other contexts without that wait completing, and it must still stop
+// promptly once the scenario is done.
+//
+// The loop which submits timestamps is timed between *pBeginTicks and *pEndTicks. *pOperations reports how many
+// timestamps it submitted.
+Result RunFenceTrackerBench(
+    IPlatform* pPlatform,
+    uint32     iterations,
+    uint32     opsPerIteration,
+    int64*     pBeginTicks,
+    int64*     pEndTicks,
+    uint64*    pOperations)
+{
+    DrmLoaderFuncs funcs = {};
+    funcs.pfnAmdgpuCsQueryFenceStatus = &MockQueryFenceStatus;
+    funcs.pfnAmdgpuCsWaitFences       = &MockWaitFences;
+
+    DrmLoaderFuncsProxy procs;
+    procs.SetFuncCalls(&funcs);
+
+    MockContext contexts[4] = {};
+    contexts[2].lost = true;
+
+    // The timelines must outlive the tracker, which drops them when it stops.
+    FenceTimeline fastTimeline(pPlatform, nullptr, nullptr);
+    FenceTimeline slowTimeline(pPlatform, nullptr, nullptr);
+    FenceTimeline lostTimeline(pPlatform, nullptr, nullptr);
+    FenceTimeline hungTimeline(pPlatform, nullptr, nullptr);
+
+    FenceTimeline*const pTimelines[] = { &fastTimeline, &slowTimeline, &lostTimeline, &hungTimeline };
+
+    for (uint32 idx = 0; idx < ArrayLen(pTimelines); ++idx)
+    {
+        pTimelines[idx]->Init(reinterpret_cast<amdgpu_context_handle>(&contexts[idx]), AMDGPU_HW_IP_GFX, 0);
+    }
+
+    uint64 timestamp = 0;
+    Result result    = Result::Success;
+
+    {
+        FenceCompletionTracker tracker(pPlatform, procs);
+
+        result = tracker.Init();
+
+        if (result == Result::Success)
+        {
+            result = tracker.TrackTimestamp(&hungTimeline, 1);
+        }
+
+        *pBeginTicks = GetPerfCpuTime();
+
+        for (uint32 iter = 0; (result == Result::Success) && (iter < iterations); ++iter)
+        {
+            for (uint32 op = 0; (result == Result::Success) && (op < opsPerIteration); ++op)
+            {
+                ++timestamp;
+
+                result = tracker.TrackTimestamp(&fastTimeline, timestamp);
+
+                if (result == Result::Success)
+                {
+                    result = tracker.TrackTimestamp(&slowTimeline, timestamp);
+                }
+
+                contexts[0].completed = timestamp;
+                contexts[1].completed = timestamp - 1;
+
+                if ((result == Result::Success) && slowTimeline.HasRetired(timestamp))
+                {
+                    PAL_ALERT_ALWAYS_MSG("A busy timestamp was reported as retired.");
+                    result = Result::ErrorUnknown;
+                }
+            }
+
+            if (result == Result::Success)
+            {
+                result = tracker.TrackTimestamp(&lostTimeline, timestamp);
+            }
+
+            contexts[1].completed = timestamp;
+
+            if ((result == Result::Success) &&
+                ((WaitForRetire(fastTimeline, timestamp) == false) ||
+                 (WaitForRetire(slowTimeline, timestamp) == false)))
+            {
+                PAL_ALERT_ALWAYS_MSG("A retired timestamp was never published.");
+                result = Result::ErrorUnknown;
+            }
+
+            if ((result == Result::Success) && (lostTimeline.HasRetired(1) || hungTimeline.HasRetired(1)))
+            {
+                PAL_ALERT_ALWAYS_MSG("A busy or lost timestamp was reported as retired.");
+                result = Result::ErrorUnknown;
+            }
+        }
+
+        *pEndTicks   = GetPerfCpuTime();
+        *pOperations = 2 * timestamp;
+    }
+
+    // The tracker was destroyed while it still waited on the hung context, so it must have come back from that wait on
+    // its own.
+    const int64 stopSeconds = (GetPerfCpuTime() - *pEndTicks) / GetPerfFrequency();
+
+    if ((result == Result::Success) && (stopSeconds >= MaxPublishLatencySeconds))
+    {
+        PAL_ALERT_ALWAYS_MSG("The tracker took too long to stop.");
+        result = Result::ErrorUnknown;
+    }
+
+    return result;
+}
+
+} // Amdgpu
+} // Pal
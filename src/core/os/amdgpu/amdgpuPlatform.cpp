@@ -59,6 +59,8 @@ Platform* Platform::CreateInstance(
 namespace Amdgpu
 {
 
+constexpr char UserDefaultConfigFileSubPath[] = "/.config";
+
 // =====================================================================================================================
 Platform::Platform(
     const PlatformCreateInfo&   createInfo,
@@ -112,6 +114,10 @@ Result Platform::ConnectToOsInterface()
     Util::MkDirRecursively(m_logPath);
 #endif
 
+    // Parse the settings file first, once: it holds the libdrm tracing and replay settings GetDrmLoader() needs, and
+    // every device created by ReQueryDevices() shares it.
+    const Result result = LoadSettingsFile();
+
     const DrmLoaderFuncs&  drmProcs  = GetDrmLoader().GetProcsTable();
 
     if (drmProcs.pfnAmdgpuCsCreateSemisValid()  &&
@@ -162,7 +168,54 @@ Result Platform::ConnectToOsInterface()
         m_features.supportQueueIfhKmd = 1;
     }
 
-    return Result::Success;
+    return result;
+}
+
+// =====================================================================================================================
+// Finds and parses the settings file.  The default (and global) settings path is searched first, followed by
+// XDG_CONFIG_HOME or, if that is not set, $HOME/.config.  A missing settings file is not an error.
+Result Platform::LoadSettingsFile()
+{
+    StartupPhase phase(this, "LoadSettingsFile");
+
+    // Step 1: try default(as well as global) path
+    Result result = m_settingsFileMgr.Init(GetSettingsPath());
+
+    // Step 2: if no global setting found, try XDG_CONFIG_HOME and user specific path
+    if (result == Result::ErrorUnavailable)
+    {
+        const char* pXdgConfigPath = getenv("XDG_CONFIG_HOME");
+        if (pXdgConfigPath != nullptr)
+        {
+            result = m_settingsFileMgr.Init(pXdgConfigPath);
+        }
+        else
+        {
+            // XDG_CONFIG_HOME is not set, fall back to $HOME
+            char userDefaultConfigFilePath[MaxPathStrLen];
+
+            const char* pPath = getenv("HOME");
+            if (pPath != nullptr)
+            {
+                Snprintf(userDefaultConfigFilePath, sizeof(userDefaultConfigFilePath), "%s%s",
+                         pPath, UserDefaultConfigFileSubPath);
+                result = m_settingsFileMgr.Init(userDefaultConfigFilePath);
+            }
+            else
+            {
+                result = Result::ErrorUnavailable;
+            }
+        }
+    }
+
+    if (result == Result::ErrorUnavailable)
+    {
+        // Unavailable means that the file was not found, which is an acceptable failure.
+        PAL_ALERT_ALWAYS();
+        result = Result::Success;
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -205,7 +258,6 @@ Result Platform::ReQueryDevices()
                        pDevices[i]->businfo.pci->func);
 
         result = Device::Create(this,
-                                &m_settingsPath[0],
                                 busId,
                                 pDevices[i]->nodes[DRM_NODE_PRIMARY],
                                 pDevices[i]->nodes[DRM_NODE_RENDER],
@@ -285,13 +337,45 @@ const DrmLoader& Platform::GetDrmLoader()
     Result result = Result::Success;
     if (m_drmLoader.Initialized() == false)
     {
-        result = m_drmLoader.Init(this);
-#if defined(PAL_DEBUG_PRINTS)
-        if (result == Result::Success)
+        // The platform settings are normally read through a device, which can't exist before libdrm is loaded. Read the
+        // libdrm tracing and replay settings from the settings file directly, on top of their defaults.
+        const PalPlatformSettings& defaults = PlatformSettings();
+
+        bool traceEnabled = defaults.drmTraceEnabled;
+        char traceDirectory[MaxPathStrLen];
+        char replayTraceFile[MaxPathStrLen];
+
+        Strncpy(traceDirectory, defaults.drmTraceDirectory, sizeof(traceDirectory));
+        Strncpy(replayTraceFile, defaults.drmReplayTraceFile, sizeof(replayTraceFile));
+
+        m_settingsFileMgr.GetValue(pDrmTraceEnabledStr, ValueType::Boolean, &traceEnabled);
+        m_settingsFileMgr.GetValue(pDrmTraceDirectoryStr, ValueType::Str, traceDirectory, sizeof(traceDirectory));
+        m_settingsFileMgr.GetValue(pDrmReplayTraceFileStr, ValueType::Str, replayTraceFile, sizeof(replayTraceFile));
+
+        if (replayTraceFile[0] != '\0')
         {
-            m_drmLoader.SetLogPath(m_logPath);
+            result = m_drmLoader.InitReplay(this, replayTraceFile);
+        }
+        else
+        {
+            result = m_drmLoader.Init(this);
+        }
+
+        if ((result == Result::Success) && traceEnabled)
+        {
+            Result traceResult = MkDirRecursively(traceDirectory);
+
+            if ((traceResult == Result::Success) || (traceResult == Result::AlreadyExists))
+            {
+                traceResult = m_drmLoader.InitTracer(this, traceDirectory);
+            }
+
+            // Tracing is a debugging aid; if it can't start, libdrm is still called directly without it.
+            PAL_ALERT_MSG(traceResult != Result::Success,
+                          "Failed to start the libdrm tracer in %s (error %d).",
+                          traceDirectory,
+                          static_cast<int32>(traceResult));
         }
-#endif
     }
     // if drmLoader cannot be initialized, it is a fatal error that we cannot recover from that gracefully.
     // Some dependency must not be satisfied, and the following calls to functions from external libraries
@@ -119,6 +119,8 @@ protected:
     } m_features;
 
 private:
+    Result LoadSettingsFile();
+
     PAL_DISALLOW_COPY_AND_ASSIGN(Platform);
 };
 
@@ -131,7 +131,8 @@ SubmissionContext::SubmissionContext(
     m_engineId(engineId),
     m_queuePriority(priority),
     m_lastSignaledSyncObject(0),
-    m_hContext(nullptr)
+    m_hContext(nullptr),
+    m_timeline(device.GetPlatform(), device.GetFenceCompletionTracker(), this)
 {
 }
 
@@ -150,7 +151,67 @@ SubmissionContext::~SubmissionContext()
 // =====================================================================================================================
 Result SubmissionContext::Init()
 {
-    return m_device.CreateCommandSubmissionContext(&m_hContext, m_queuePriority);
+    Result result = m_batchedFenceLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_batchedFenceCondVar.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_device.CreateCommandSubmissionContext(&m_hContext, m_queuePriority);
+    }
+
+    if (result == Result::Success)
+    {
+        m_timeline.Init(m_hContext, m_ipType, m_engineId);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Blocks until the given fence's batched-up submission has been executed and the fence knows its timestamp. The fence
+// is rechecked after every wake-up because all fences on this context share one condition variable.
+bool SubmissionContext::WaitForBatchedFence(
+    const TimestampFence& fence,
+    const timespec*       pStopTime
+    ) const
+{
+    MutexAuto lock(&m_batchedFenceLock);
+
+    bool resolved = (fence.IsBatched() == false);
+
+    while (resolved == false)
+    {
+        uint64 timeLeft = 0;
+        ComputeTimeoutLeft(pStopTime, &timeLeft);
+
+        if (timeLeft == 0)
+        {
+            break;
+        }
+
+        // Round up to whole milliseconds so that we don't spin on the remainder. Very long timeouts saturate to the
+        // condition variable's infinite wait.
+        const uint64 waitMs = Min((timeLeft / 1000000) + 1, static_cast<uint64>(UINT32_MAX));
+
+        m_batchedFenceCondVar.Wait(&m_batchedFenceLock, static_cast<uint32>(waitMs));
+
+        resolved = (fence.IsBatched() == false);
+    }
+
+    return resolved;
+}
+
+// =====================================================================================================================
+// Called after a batched-up fence has been given its timestamp. Taking the lock orders this with a waiter's check of
+// the fence so that the wake-up can't be lost.
+void SubmissionContext::NotifyBatchedFences()
+{
+    MutexAuto lock(&m_batchedFenceLock);
+    m_batchedFenceCondVar.WakeAll();
 }
 
 // =====================================================================================================================
@@ -159,15 +220,24 @@ bool SubmissionContext::IsTimestampRetired(
     uint64 timestamp
     ) const
 {
-    struct amdgpu_cs_fence queryFence = {};
+    // The fence completion tracker, if there is one, answers most queries for retired timestamps with a single load.
+    // It lags behind the GPU though, so a miss still has to ask the kernel.
+    bool retired = m_timeline.HasRetired(timestamp);
+
+    if (retired == false)
+    {
+        struct amdgpu_cs_fence queryFence = {};
 
-    queryFence.context     = m_hContext;
-    queryFence.fence       = timestamp;
-    queryFence.ring        = m_engineId;
-    queryFence.ip_instance = 0;
-    queryFence.ip_type     = m_ipType;
+        queryFence.context     = m_hContext;
+        queryFence.fence       = timestamp;
+        queryFence.ring        = m_engineId;
+        queryFence.ip_instance = 0;
+        queryFence.ip_type     = m_ipType;
 
-    return (m_device.QueryFenceStatus(&queryFence, 0) == Result::Success);
+        retired = (m_device.QueryFenceStatus(&queryFence, 0) == Result::Success);
+    }
+
+    return retired;
 }
 
 // =====================================================================================================================
@@ -1492,6 +1562,11 @@ Result Queue::SubmitIbs(
         result = pDevice->Submit(pContext->Handle(), 0, &ibsRequest, 1, pContext->LastTimestampPtr());
     }
 
+    if (result == Result::Success)
+    {
+        pContext->TrackLastTimestamp();
+    }
+
     m_numIbs = 0;
     memset(m_ibs, 0, sizeof(m_ibs));
 
@@ -26,7 +26,9 @@
 #pragma once
 
 #include "core/queue.h"
+#include "core/os/amdgpu/amdgpuFenceCompletionTracker.h"
 #include "core/os/amdgpu/amdgpuHeaders.h"
+#include "palConditionVariable.h"
 #include "palHashMap.h"
 #include "palVector.h"
 
@@ -52,6 +54,7 @@ namespace Amdgpu
 class Device;
 class GpuMemory;
 class SwapChain;
+class TimestampFence;
 
 enum class CommandListType : uint32
 {
@@ -93,6 +96,20 @@ public:
     amdgpu_syncobj_handle GetLastSignaledSyncObj() const        { return m_lastSignaledSyncObject; }
     void SetLastSignaledSyncObj(amdgpu_syncobj_handle hSyncObj) { m_lastSignaledSyncObject = hSyncObj; }
 
+    // Hands the last submitted timestamp to the device's fence completion tracker, if there is one.
+    void TrackLastTimestamp() { m_timeline.Track(LastTimestamp()); }
+
+    // Returns true if the fence completion tracker has already seen the given timestamp retire. This never calls into
+    // the kernel, so a false result is only a hint.
+    bool HasRetiredTimestamp(uint64 timestamp) const { return m_timeline.HasRetired(timestamp); }
+
+    // Blocks until a fence whose submission is still batched-up on this context's Queue has been given its real
+    // timestamp. Returns false if pStopTime passes first.
+    bool WaitForBatchedFence(const TimestampFence& fence, const timespec* pStopTime) const;
+
+    // Wakes every thread blocked in WaitForBatchedFence so that it can recheck its fence.
+    void NotifyBatchedFences();
+
 private:
     SubmissionContext(const Device& device, EngineType engineType, uint32 engineId, Pal::QueuePriority priority);
     virtual ~SubmissionContext();
@@ -106,6 +123,12 @@ private:
     amdgpu_syncobj_handle       m_lastSignaledSyncObject;
     amdgpu_context_handle       m_hContext;  // Command submission context handle.
 
+    FenceTimeline               m_timeline;  // Completion tracking state for the device's FenceCompletionTracker.
+
+    // Fence waits block on this while the Queue (or its asynchronous submission worker) still holds their submission.
+    mutable Util::Mutex             m_batchedFenceLock;
+    mutable Util::ConditionVariable m_batchedFenceCondVar;
+
     PAL_DISALLOW_DEFAULT_CTOR(SubmissionContext);
     PAL_DISALLOW_COPY_AND_ASSIGN(SubmissionContext);
 };
@@ -127,6 +127,9 @@ Result TimestampFence::AssociateWithLastTimestamp()
     // we're unrolling a batched submission or timestamp association.
     AtomicExchange64(&m_timestamp, m_pContext->LastTimestamp());
 
+    // A WaitForFences call may be blocked on this fence until its batched submission reached the OS.
+    m_pContext->NotifyBatchedFences();
+
     return Result::Success;
 }
 
@@ -178,6 +181,10 @@ Result TimestampFence::WaitForFences(
 
     uint32 count = 0;
 
+    // Waiting for batched-up submissions and waiting on the kernel share one timeout.
+    struct timespec stopTime = {};
+    ComputeTimeoutExpiration(&stopTime, timeout);
+
     if (fenceList.Capacity() >= fenceCount)
     {
         result = Result::NotReady;
@@ -219,10 +226,28 @@ Result TimestampFence::WaitForFences(
                 break;
             }
 
-            // We currently have no way to wait for a batched fence on Linux. This is OK for now because Vulkan (the
-            // only Linux client) doesn't permit the application to trigger queue batching. A solution must be found
-            // once PAL swap chain presents have been refactored because they will trigger batching internally.
-            PAL_ASSERT(pFence->IsBatched() == false);
+            // The submission may still be batched-up, either because its Queue is stalled on a Semaphore or because
+            // the asynchronous submission worker hasn't reached it yet. We can't ask the kernel about it until the
+            // Queue has executed it and given the fence a real timestamp.
+            if (pContext->WaitForBatchedFence(*pFence, &stopTime) == false)
+            {
+                result = Result::Timeout;
+                break;
+            }
+
+            // Skip fences which the fence completion tracker has already seen retire.
+            if (pContext->HasRetiredTimestamp(pFence->Timestamp()))
+            {
+                if (waitAll == true)
+                {
+                    continue;
+                }
+                else
+                {
+                    result = Result::Success;
+                    break;
+                }
+            }
 
             fenceList[count].context = pContext->Handle();
             fenceList[count].ip_type = pContext->IpType();
@@ -235,16 +260,17 @@ Result TimestampFence::WaitForFences(
 
     if (result == Result::NotReady)
     {
-        struct timespec startTime = {};
-        struct timespec stopTime = {};
-        uint64 timeoutLeft = 0;
+        // Only give the kernel what is left after waiting for batched fences. Infinite waits stay infinite.
+        uint64 timeoutLeft = timeout;
 
-        ComputeTimeoutExpiration(&startTime, 0);
-        ComputeTimeoutExpiration(&stopTime, timeout);
+        if (timeout != AMDGPU_TIMEOUT_INFINITE)
+        {
+            ComputeTimeoutLeft(&stopTime, &timeoutLeft);
+        }
 
         if (count > 0)
         {
-            result = amdgpuDevice.WaitForFences(&fenceList[0], count, waitAll, timeout);
+            result = amdgpuDevice.WaitForFences(&fenceList[0], count, waitAll, timeoutLeft);
         }
         else
         {
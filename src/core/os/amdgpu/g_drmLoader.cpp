@@ -49,14 +49,136 @@ namespace Pal
 namespace Amdgpu
 {
 // =====================================================================================================================
-#if defined(PAL_DEBUG_PRINTS)
-void DrmLoaderFuncsProxy::Init(const char* pLogPath)
-{
-    char file[128] = {0};
-    Util::Snprintf(file, sizeof(file), "%s/DrmLoaderTimeLogger.csv", pLogPath);
-    m_timeLogger.Open(file, FileAccessMode::FileAccessWrite);
-    Util::Snprintf(file, sizeof(file), "%s/DrmLoaderParamLogger.trace", pLogPath);
-    m_paramLogger.Open(file, FileAccessMode::FileAccessWrite);
+const char* DrmLoaderEntryPointNames[DrmLoaderEntryPointsCount] =
+{
+    "amdgpu_query_hw_ip_info",
+    "amdgpu_bo_va_op",
+    "amdgpu_bo_va_op_raw",
+    "amdgpu_cs_create_semaphore",
+    "amdgpu_cs_signal_semaphore",
+    "amdgpu_cs_wait_semaphore",
+    "amdgpu_cs_destroy_semaphore",
+    "amdgpu_cs_create_sem",
+    "amdgpu_cs_signal_sem",
+    "amdgpu_cs_wait_sem",
+    "amdgpu_cs_export_sem",
+    "amdgpu_cs_import_sem",
+    "amdgpu_cs_destroy_sem",
+    "amdgpu_get_marketing_name",
+    "amdgpu_va_range_free",
+    "amdgpu_va_range_query",
+    "amdgpu_va_range_alloc",
+    "amdgpu_read_mm_registers",
+    "amdgpu_device_initialize",
+    "amdgpu_device_deinitialize",
+    "amdgpu_bo_alloc",
+    "amdgpu_bo_set_metadata",
+    "amdgpu_bo_query_info",
+    "amdgpu_bo_export",
+    "amdgpu_bo_import",
+    "amdgpu_create_bo_from_user_mem",
+    "amdgpu_create_bo_from_phys_mem",
+    "amdgpu_find_bo_by_cpu_mapping",
+    "amdgpu_bo_free",
+    "amdgpu_bo_cpu_map",
+    "amdgpu_bo_cpu_unmap",
+    "amdgpu_bo_remap_secure",
+    "amdgpu_bo_wait_for_idle",
+    "amdgpu_bo_list_create",
+    "amdgpu_bo_list_destroy",
+    "amdgpu_cs_ctx_create",
+    "amdgpu_cs_ctx_free",
+    "amdgpu_cs_submit",
+    "amdgpu_cs_query_fence_status",
+    "amdgpu_cs_wait_fences",
+    "amdgpu_query_buffer_size_alignment",
+    "amdgpu_query_firmware_version",
+    "amdgpu_query_hw_ip_count",
+    "amdgpu_query_heap_info",
+    "amdgpu_query_gpu_info",
+    "amdgpu_query_sensor_info",
+    "amdgpu_query_info",
+    "amdgpu_query_private_aperture",
+    "amdgpu_query_shared_aperture",
+    "amdgpu_bo_get_phys_address",
+    "amdgpu_cs_reserved_vmid",
+    "amdgpu_cs_unreserved_vmid",
+    "amdgpu_cs_create_syncobj",
+    "amdgpu_cs_create_syncobj2",
+    "amdgpu_cs_destroy_syncobj",
+    "amdgpu_cs_export_syncobj",
+    "amdgpu_cs_import_syncobj",
+    "amdgpu_cs_submit_raw",
+    "amdgpu_cs_submit_raw2",
+    "amdgpu_cs_chunk_fence_to_dep",
+    "amdgpu_cs_chunk_fence_info_to_data",
+    "amdgpu_cs_syncobj_import_sync_file",
+    "amdgpu_cs_syncobj_import_sync_file2",
+    "amdgpu_cs_syncobj_export_sync_file",
+    "amdgpu_cs_syncobj_export_sync_file2",
+    "amdgpu_cs_syncobj_wait",
+    "amdgpu_cs_syncobj_timeline_wait",
+    "amdgpu_cs_syncobj_reset",
+    "amdgpu_cs_syncobj_signal",
+    "amdgpu_cs_syncobj_timeline_signal",
+    "amdgpu_cs_syncobj_transfer",
+    "amdgpu_cs_syncobj_query",
+    "amdgpu_cs_syncobj_query2",
+    "amdgpu_cs_ctx_create2",
+    "amdgpu_cs_ctx_create3",
+    "drmGetNodeTypeFromFd",
+    "drmGetRenderDeviceNameFromFd",
+    "drmGetDevices",
+    "drmFreeDevices",
+    "drmGetDevice2",
+    "drmFreeDevice",
+    "drmGetBusid",
+    "drmFreeBusid",
+    "drmModeGetResources",
+    "drmModeFreeResources",
+    "drmModeGetConnector",
+    "drmModeFreeConnector",
+    "drmGetCap",
+    "drmSetClientCap",
+    "drmSyncobjCreate",
+    "drmModeFreePlane",
+    "drmModeFreePlaneResources",
+    "drmModeGetPlaneResources",
+    "drmModeGetPlane",
+    "drmDropMaster",
+    "drmPrimeFDToHandle",
+    "drmModeAddFB2",
+    "drmModePageFlip",
+    "drmModeGetEncoder",
+    "drmModeFreeEncoder",
+    "drmModeSetCrtc",
+    "drmModeGetConnectorCurrent",
+    "drmModeGetCrtc",
+    "drmModeFreeCrtc",
+    "drmCrtcGetSequence",
+    "drmCrtcQueueSequence",
+    "drmHandleEvent",
+    "drmIoctl",
+    "drmModeGetProperty",
+    "drmModeFreeProperty",
+    "drmModeObjectGetProperties",
+    "drmModeFreeObjectProperties",
+    "drmModeGetPropertyBlob",
+    "drmModeFreePropertyBlob",
+    "drmModeAtomicAlloc",
+    "drmModeAtomicFree",
+    "drmModeAtomicCommit",
+    "drmModeCreatePropertyBlob",
+    "drmModeDestroyPropertyBlob",
+    "drmModeAtomicAddProperty",
+};
+
+// =====================================================================================================================
+Result DrmLoaderFuncsProxy::Init(
+    Platform*   pPlatform,
+    const char* pLogPath)
+{
+    return m_tracer.Init(pPlatform, pLogPath, DrmLoaderEntryPointsCount, &DrmLoaderEntryPointNames[0]);
 }
 
 // =====================================================================================================================
@@ -67,23 +189,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryHwIpInfo(
     struct drm_amdgpu_info_hw_ip*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryHwIpInfo);
     int32 ret = m_pFuncs->pfnAmdgpuQueryHwIpInfo(hDevice,
                                                  type,
                                                  ipInstance,
                                                  pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryHwIpInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryHwIpInfo(%p, %x, %x, %p)\n",
-        hDevice,
-        type,
-        ipInstance,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pInfo);
 
     return ret;
 }
@@ -98,27 +210,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoVaOp(
     uint32            ops
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoVaOp);
     int32 ret = m_pFuncs->pfnAmdgpuBoVaOp(hBuffer,
                                           offset,
                                           size,
                                           address,
                                           flags,
                                           ops);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoVaOp,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoVaOp(%p, %lx, %lx, %lx, %lx, %x)\n",
-        hBuffer,
-        offset,
-        size,
-        address,
-        flags,
-        ops);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -134,7 +233,7 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoVaOpRaw(
     uint32                ops
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoVaOpRaw);
     int32 ret = m_pFuncs->pfnAmdgpuBoVaOpRaw(hDevice,
                                              hBuffer,
                                              offset,
@@ -142,21 +241,7 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoVaOpRaw(
                                              address,
                                              flags,
                                              ops);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoVaOpRaw,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoVaOpRaw(%p, %p, %lx, %lx, %lx, %lx, %x)\n",
-        hDevice,
-        hBuffer,
-        offset,
-        size,
-        address,
-        flags,
-        ops);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -166,17 +251,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCreateSemaphore(
     amdgpu_semaphore_handle*  pSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCreateSemaphore);
     int32 ret = m_pFuncs->pfnAmdgpuCsCreateSemaphore(pSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCreateSemaphore,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCreateSemaphore(%p)\n",
-        pSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSemaphore);
 
     return ret;
 }
@@ -190,25 +268,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSignalSemaphore(
     amdgpu_semaphore_handle  hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSignalSemaphore);
     int32 ret = m_pFuncs->pfnAmdgpuCsSignalSemaphore(hContext,
                                                      ipType,
                                                      ipInstance,
                                                      ring,
                                                      hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSignalSemaphore,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSignalSemaphore(%p, %x, %x, %x, %p)\n",
-        hContext,
-        ipType,
-        ipInstance,
-        ring,
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -222,25 +288,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsWaitSemaphore(
     amdgpu_semaphore_handle  hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsWaitSemaphore);
     int32 ret = m_pFuncs->pfnAmdgpuCsWaitSemaphore(hConext,
                                                    ipType,
                                                    ipInstance,
                                                    ring,
                                                    hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsWaitSemaphore,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsWaitSemaphore(%p, %x, %x, %x, %p)\n",
-        hConext,
-        ipType,
-        ipInstance,
-        ring,
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -250,17 +304,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsDestroySemaphore(
     amdgpu_semaphore_handle  hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsDestroySemaphore);
     int32 ret = m_pFuncs->pfnAmdgpuCsDestroySemaphore(hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsDestroySemaphore,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsDestroySemaphore(%p)\n",
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -271,19 +317,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCreateSem(
     amdgpu_sem_handle*    pSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCreateSem);
     int32 ret = m_pFuncs->pfnAmdgpuCsCreateSem(hDevice,
                                                pSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCreateSem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCreateSem(%p, %p)\n",
-        hDevice,
-        pSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSemaphore);
 
     return ret;
 }
@@ -298,27 +336,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSignalSem(
     amdgpu_sem_handle      hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSignalSem);
     int32 ret = m_pFuncs->pfnAmdgpuCsSignalSem(hDevice,
                                                hContext,
                                                ipType,
                                                ipInstance,
                                                ring,
                                                hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSignalSem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSignalSem(%p, %p, %x, %x, %x, %x)\n",
-        hDevice,
-        hContext,
-        ipType,
-        ipInstance,
-        ring,
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -333,27 +358,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsWaitSem(
     amdgpu_sem_handle      hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsWaitSem);
     int32 ret = m_pFuncs->pfnAmdgpuCsWaitSem(hDevice,
                                              hContext,
                                              ipType,
                                              ipInstance,
                                              ring,
                                              hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsWaitSem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsWaitSem(%p, %p, %x, %x, %x, %x)\n",
-        hDevice,
-        hContext,
-        ipType,
-        ipInstance,
-        ring,
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -365,21 +377,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsExportSem(
     int32*                pSharedFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsExportSem);
     int32 ret = m_pFuncs->pfnAmdgpuCsExportSem(hDevice,
                                                hSemaphore,
                                                pSharedFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsExportSem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsExportSem(%p, %x, %p)\n",
-        hDevice,
-        hSemaphore,
-        pSharedFd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSharedFd);
 
     return ret;
 }
@@ -391,21 +394,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsImportSem(
     amdgpu_sem_handle*    pSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsImportSem);
     int32 ret = m_pFuncs->pfnAmdgpuCsImportSem(hDevice,
                                                fd,
                                                pSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsImportSem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsImportSem(%p, %x, %p)\n",
-        hDevice,
-        fd,
-        pSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSemaphore);
 
     return ret;
 }
@@ -416,19 +410,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsDestroySem(
     amdgpu_sem_handle     hSemaphore
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsDestroySem);
     int32 ret = m_pFuncs->pfnAmdgpuCsDestroySem(hDevice,
                                                 hSemaphore);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsDestroySem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsDestroySem(%p, %x)\n",
-        hDevice,
-        hSemaphore);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -438,17 +423,10 @@ const char* DrmLoaderFuncsProxy::pfnAmdgpuGetMarketingName(
     amdgpu_device_handle  hDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuGetMarketingName);
     const char* pRet = m_pFuncs->pfnAmdgpuGetMarketingName(hDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuGetMarketingName,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuGetMarketingName(%p)\n",
-        hDevice);
-    m_paramLogger.Flush();
+    call.End(pRet != nullptr);
+    call.CaptureString(pRet);
 
     return pRet;
 }
@@ -458,17 +436,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuVaRangeFree(
     amdgpu_va_handle  hVaRange
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuVaRangeFree);
     int32 ret = m_pFuncs->pfnAmdgpuVaRangeFree(hVaRange);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuVaRangeFree,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuVaRangeFree(%p)\n",
-        hVaRange);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -481,23 +451,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuVaRangeQuery(
     uint64*                   pEnd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuVaRangeQuery);
     int32 ret = m_pFuncs->pfnAmdgpuVaRangeQuery(hDevice,
                                                 type,
                                                 pStart,
                                                 pEnd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuVaRangeQuery,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuVaRangeQuery(%p, %x, %p, %p)\n",
-        hDevice,
-        type,
-        pStart,
-        pEnd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pStart);
+    call.CaptureOut(pEnd);
 
     return ret;
 }
@@ -514,7 +475,7 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuVaRangeAlloc(
     uint64                    flags
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuVaRangeAlloc);
     int32 ret = m_pFuncs->pfnAmdgpuVaRangeAlloc(hDevice,
                                                 vaRangeType,
                                                 size,
@@ -523,22 +484,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuVaRangeAlloc(
                                                 pVaAllocated,
                                                 pVaRange,
                                                 flags);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuVaRangeAlloc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuVaRangeAlloc(%p, %x, %lx, %lx, %lx, %p, %p, %lx)\n",
-        hDevice,
-        vaRangeType,
-        size,
-        vaBaseAlignment,
-        vaBaseRequired,
-        pVaAllocated,
-        pVaRange,
-        flags);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pVaAllocated);
+    call.CaptureOut(pVaRange);
 
     return ret;
 }
@@ -553,27 +501,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuReadMmRegisters(
     uint32*               pValues
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuReadMmRegisters);
     int32 ret = m_pFuncs->pfnAmdgpuReadMmRegisters(hDevice,
                                                    dwordOffset,
                                                    count,
                                                    instance,
                                                    flags,
                                                    pValues);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuReadMmRegisters,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuReadMmRegisters(%p, %x, %x, %x, %x, %p)\n",
-        hDevice,
-        dwordOffset,
-        count,
-        instance,
-        flags,
-        pValues);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pValues);
 
     return ret;
 }
@@ -586,23 +522,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuDeviceInitialize(
     amdgpu_device_handle*  pDeviceHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuDeviceInitialize);
     int32 ret = m_pFuncs->pfnAmdgpuDeviceInitialize(fd,
                                                     pMajorVersion,
                                                     pMinorVersion,
                                                     pDeviceHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuDeviceInitialize,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuDeviceInitialize(%x, %p, %p, %p)\n",
-        fd,
-        pMajorVersion,
-        pMinorVersion,
-        pDeviceHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pMajorVersion);
+    call.CaptureOut(pMinorVersion);
+    call.CaptureOut(pDeviceHandle);
 
     return ret;
 }
@@ -612,17 +540,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuDeviceDeinitialize(
     amdgpu_device_handle  hDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuDeviceDeinitialize);
     int32 ret = m_pFuncs->pfnAmdgpuDeviceDeinitialize(hDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuDeviceDeinitialize,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuDeviceDeinitialize(%p)\n",
-        hDevice);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -634,21 +554,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoAlloc(
     amdgpu_bo_handle*                pBufferHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoAlloc);
     int32 ret = m_pFuncs->pfnAmdgpuBoAlloc(hDevice,
                                            pAllocBuffer,
                                            pBufferHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoAlloc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoAlloc(%p, %p, %p)\n",
-        hDevice,
-        pAllocBuffer,
-        pBufferHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufferHandle);
 
     return ret;
 }
@@ -659,19 +570,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoSetMetadata(
     struct amdgpu_bo_metadata*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoSetMetadata);
     int32 ret = m_pFuncs->pfnAmdgpuBoSetMetadata(hBuffer,
                                                  pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoSetMetadata,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoSetMetadata(%p, %p)\n",
-        hBuffer,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -682,19 +584,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoQueryInfo(
     struct amdgpu_bo_info*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoQueryInfo);
     int32 ret = m_pFuncs->pfnAmdgpuBoQueryInfo(hBuffer,
                                                pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoQueryInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoQueryInfo(%p, %p)\n",
-        hBuffer,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pInfo);
 
     return ret;
 }
@@ -706,21 +600,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoExport(
     uint32*                     pFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoExport);
     int32 ret = m_pFuncs->pfnAmdgpuBoExport(hBuffer,
                                             type,
                                             pFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoExport,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoExport(%p, %x, %p)\n",
-        hBuffer,
-        type,
-        pFd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pFd);
 
     return ret;
 }
@@ -733,23 +618,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoImport(
     struct amdgpu_bo_import_result*  pOutput
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoImport);
     int32 ret = m_pFuncs->pfnAmdgpuBoImport(hDevice,
                                             type,
                                             fd,
                                             pOutput);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoImport,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoImport(%p, %x, %x, %p)\n",
-        hDevice,
-        type,
-        fd,
-        pOutput);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pOutput);
 
     return ret;
 }
@@ -762,23 +637,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCreateBoFromUserMem(
     amdgpu_bo_handle*     pBufferHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCreateBoFromUserMem);
     int32 ret = m_pFuncs->pfnAmdgpuCreateBoFromUserMem(hDevice,
                                                        pCpuAddress,
                                                        size,
                                                        pBufferHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCreateBoFromUserMem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCreateBoFromUserMem(%p, %p, %lx, %p)\n",
-        hDevice,
-        pCpuAddress,
-        size,
-        pBufferHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufferHandle);
 
     return ret;
 }
@@ -791,23 +656,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCreateBoFromPhysMem(
     amdgpu_bo_handle*     pBufferHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCreateBoFromPhysMem);
     int32 ret = m_pFuncs->pfnAmdgpuCreateBoFromPhysMem(hDevice,
                                                        physAddress,
                                                        size,
                                                        pBufferHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCreateBoFromPhysMem,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCreateBoFromPhysMem(%p, %lx, %lx, %p)\n",
-        hDevice,
-        physAddress,
-        size,
-        pBufferHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufferHandle);
 
     return ret;
 }
@@ -821,25 +676,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuFindBoByCpuMapping(
     uint64*               pOffsetInBuffer
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuFindBoByCpuMapping);
     int32 ret = m_pFuncs->pfnAmdgpuFindBoByCpuMapping(hDevice,
                                                       pCpuAddress,
                                                       size,
                                                       pBufferHandle,
                                                       pOffsetInBuffer);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuFindBoByCpuMapping,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuFindBoByCpuMapping(%p, %p, %lx, %p, %p)\n",
-        hDevice,
-        pCpuAddress,
-        size,
-        pBufferHandle,
-        pOffsetInBuffer);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufferHandle);
+    call.CaptureOut(pOffsetInBuffer);
 
     return ret;
 }
@@ -849,17 +694,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoFree(
     amdgpu_bo_handle  hBuffer
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoFree);
     int32 ret = m_pFuncs->pfnAmdgpuBoFree(hBuffer);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoFree,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoFree(%p)\n",
-        hBuffer);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -870,19 +707,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoCpuMap(
     void**            ppCpuAddress
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoCpuMap);
     int32 ret = m_pFuncs->pfnAmdgpuBoCpuMap(hBuffer,
                                             ppCpuAddress);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoCpuMap,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoCpuMap(%p, %p)\n",
-        hBuffer,
-        ppCpuAddress);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -892,17 +720,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoCpuUnmap(
     amdgpu_bo_handle  hBuffer
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoCpuUnmap);
     int32 ret = m_pFuncs->pfnAmdgpuBoCpuUnmap(hBuffer);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoCpuUnmap,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoCpuUnmap(%p)\n",
-        hBuffer);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -913,19 +733,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoRemapSecure(
     bool              secure_map
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoRemapSecure);
     int32 ret = m_pFuncs->pfnAmdgpuBoRemapSecure(buf_handle,
                                                  secure_map);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoRemapSecure,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoRemapSecure(%p, %x)\n",
-        buf_handle,
-        secure_map);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -937,21 +748,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoWaitForIdle(
     bool*             pBufferBusy
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoWaitForIdle);
     int32 ret = m_pFuncs->pfnAmdgpuBoWaitForIdle(hBuffer,
                                                  timeoutInNs,
                                                  pBufferBusy);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoWaitForIdle,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoWaitForIdle(%p, %lx, %p)\n",
-        hBuffer,
-        timeoutInNs,
-        pBufferBusy);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufferBusy);
 
     return ret;
 }
@@ -965,25 +767,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoListCreate(
     amdgpu_bo_list_handle*  pBoListHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoListCreate);
     int32 ret = m_pFuncs->pfnAmdgpuBoListCreate(hDevice,
                                                 numberOfResources,
                                                 pResources,
                                                 pResourcePriorities,
                                                 pBoListHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoListCreate,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoListCreate(%p, %x, %p, %p, %p)\n",
-        hDevice,
-        numberOfResources,
-        pResources,
-        pResourcePriorities,
-        pBoListHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pResources);
+    call.CaptureOut(pBoListHandle);
 
     return ret;
 }
@@ -993,17 +785,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoListDestroy(
     amdgpu_bo_list_handle  hBoList
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoListDestroy);
     int32 ret = m_pFuncs->pfnAmdgpuBoListDestroy(hBoList);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoListDestroy,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoListDestroy(%p)\n",
-        hBoList);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1014,19 +798,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCtxCreate(
     amdgpu_context_handle*  pContextHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCtxCreate);
     int32 ret = m_pFuncs->pfnAmdgpuCsCtxCreate(hDevice,
                                                pContextHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCtxCreate,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCtxCreate(%p, %p)\n",
-        hDevice,
-        pContextHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pContextHandle);
 
     return ret;
 }
@@ -1036,17 +812,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCtxFree(
     amdgpu_context_handle  hContext
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCtxFree);
     int32 ret = m_pFuncs->pfnAmdgpuCsCtxFree(hContext);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCtxFree,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCtxFree(%p)\n",
-        hContext);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1059,23 +827,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSubmit(
     uint32                     numberOfRequests
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSubmit);
     int32 ret = m_pFuncs->pfnAmdgpuCsSubmit(hContext,
                                             flags,
                                             pIbsRequest,
                                             numberOfRequests);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSubmit,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSubmit(%p, %lx, %p, %x)\n",
-        hContext,
-        flags,
-        pIbsRequest,
-        numberOfRequests);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1088,23 +845,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsQueryFenceStatus(
     uint32*                  pExpired
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsQueryFenceStatus);
     int32 ret = m_pFuncs->pfnAmdgpuCsQueryFenceStatus(pFence,
                                                       timeoutInNs,
                                                       flags,
                                                       pExpired);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsQueryFenceStatus,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsQueryFenceStatus(%p, %lx, %lx, %p)\n",
-        pFence,
-        timeoutInNs,
-        flags,
-        pExpired);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pExpired);
 
     return ret;
 }
@@ -1119,27 +866,16 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsWaitFences(
     uint32*                  pFirst
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsWaitFences);
     int32 ret = m_pFuncs->pfnAmdgpuCsWaitFences(pFences,
                                                 fenceCount,
                                                 waitAll,
                                                 timeoutInNs,
                                                 pStatus,
                                                 pFirst);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsWaitFences,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsWaitFences(%p, %x, %x, %lx, %p, %p)\n",
-        pFences,
-        fenceCount,
-        waitAll,
-        timeoutInNs,
-        pStatus,
-        pFirst);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pStatus);
+    call.CaptureOut(pFirst);
 
     return ret;
 }
@@ -1150,19 +886,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryBufferSizeAlignment(
     struct amdgpu_buffer_size_alignments*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryBufferSizeAlignment);
     int32 ret = m_pFuncs->pfnAmdgpuQueryBufferSizeAlignment(hDevice,
                                                             pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryBufferSizeAlignment,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryBufferSizeAlignment(%p, %p)\n",
-        hDevice,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pInfo);
 
     return ret;
 }
@@ -1177,27 +905,16 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryFirmwareVersion(
     uint32*               pFeature
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryFirmwareVersion);
     int32 ret = m_pFuncs->pfnAmdgpuQueryFirmwareVersion(hDevice,
                                                         fwType,
                                                         ipInstance,
                                                         index,
                                                         pVersion,
                                                         pFeature);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryFirmwareVersion,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryFirmwareVersion(%p, %x, %x, %x, %p, %p)\n",
-        hDevice,
-        fwType,
-        ipInstance,
-        index,
-        pVersion,
-        pFeature);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pVersion);
+    call.CaptureOut(pFeature);
 
     return ret;
 }
@@ -1209,21 +926,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryHwIpCount(
     uint32*               pCount
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryHwIpCount);
     int32 ret = m_pFuncs->pfnAmdgpuQueryHwIpCount(hDevice,
                                                   type,
                                                   pCount);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryHwIpCount,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryHwIpCount(%p, %x, %p)\n",
-        hDevice,
-        type,
-        pCount);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pCount);
 
     return ret;
 }
@@ -1236,23 +944,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryHeapInfo(
     struct amdgpu_heap_info*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryHeapInfo);
     int32 ret = m_pFuncs->pfnAmdgpuQueryHeapInfo(hDevice,
                                                  heap,
                                                  flags,
                                                  pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryHeapInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryHeapInfo(%p, %x, %x, %p)\n",
-        hDevice,
-        heap,
-        flags,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pInfo);
 
     return ret;
 }
@@ -1263,19 +961,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryGpuInfo(
     struct amdgpu_gpu_info*  pInfo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryGpuInfo);
     int32 ret = m_pFuncs->pfnAmdgpuQueryGpuInfo(hDevice,
                                                 pInfo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryGpuInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryGpuInfo(%p, %p)\n",
-        hDevice,
-        pInfo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pInfo);
 
     return ret;
 }
@@ -1288,23 +978,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQuerySensorInfo(
     void*                 value
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQuerySensorInfo);
     int32 ret = m_pFuncs->pfnAmdgpuQuerySensorInfo(hDevice,
                                                    sensor_type,
                                                    size,
                                                    value);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQuerySensorInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQuerySensorInfo(%p, %x, %x, %p)\n",
-        hDevice,
-        sensor_type,
-        size,
-        value);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(value, size);
 
     return ret;
 }
@@ -1317,23 +997,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryInfo(
     void*                 pValue
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryInfo);
     int32 ret = m_pFuncs->pfnAmdgpuQueryInfo(hDevice,
                                              infoId,
                                              size,
                                              pValue);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryInfo,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryInfo(%p, %x, %x, %p)\n",
-        hDevice,
-        infoId,
-        size,
-        pValue);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pValue, size);
 
     return ret;
 }
@@ -1345,21 +1015,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQueryPrivateAperture(
     uint64*               pEndVa
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQueryPrivateAperture);
     int32 ret = m_pFuncs->pfnAmdgpuQueryPrivateAperture(hDevice,
                                                         pStartVa,
                                                         pEndVa);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQueryPrivateAperture,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQueryPrivateAperture(%p, %p, %p)\n",
-        hDevice,
-        pStartVa,
-        pEndVa);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pStartVa);
+    call.CaptureOut(pEndVa);
 
     return ret;
 }
@@ -1371,21 +1033,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuQuerySharedAperture(
     uint64*               pEndVa
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuQuerySharedAperture);
     int32 ret = m_pFuncs->pfnAmdgpuQuerySharedAperture(hDevice,
                                                        pStartVa,
                                                        pEndVa);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuQuerySharedAperture,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuQuerySharedAperture(%p, %p, %p)\n",
-        hDevice,
-        pStartVa,
-        pEndVa);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pStartVa);
+    call.CaptureOut(pEndVa);
 
     return ret;
 }
@@ -1396,19 +1050,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuBoGetPhysAddress(
     uint64*           pPhysAddress
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuBoGetPhysAddress);
     int32 ret = m_pFuncs->pfnAmdgpuBoGetPhysAddress(hBuffer,
                                                     pPhysAddress);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuBoGetPhysAddress,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuBoGetPhysAddress(%p, %p)\n",
-        hBuffer,
-        pPhysAddress);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pPhysAddress);
 
     return ret;
 }
@@ -1418,17 +1064,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsReservedVmid(
     amdgpu_device_handle  hDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsReservedVmid);
     int32 ret = m_pFuncs->pfnAmdgpuCsReservedVmid(hDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsReservedVmid,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsReservedVmid(%p)\n",
-        hDevice);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1438,17 +1076,9 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsUnreservedVmid(
     amdgpu_device_handle  hDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsUnreservedVmid);
     int32 ret = m_pFuncs->pfnAmdgpuCsUnreservedVmid(hDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsUnreservedVmid,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsUnreservedVmid(%p)\n",
-        hDevice);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1459,19 +1089,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCreateSyncobj(
     uint32*               pSyncObj
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCreateSyncobj);
     int32 ret = m_pFuncs->pfnAmdgpuCsCreateSyncobj(hDevice,
                                                    pSyncObj);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCreateSyncobj,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCreateSyncobj(%p, %p)\n",
-        hDevice,
-        pSyncObj);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSyncObj);
 
     return ret;
 }
@@ -1483,21 +1105,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCreateSyncobj2(
     uint32*               pSyncObj
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCreateSyncobj2);
     int32 ret = m_pFuncs->pfnAmdgpuCsCreateSyncobj2(hDevice,
                                                     flags,
                                                     pSyncObj);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCreateSyncobj2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCreateSyncobj2(%p, %x, %p)\n",
-        hDevice,
-        flags,
-        pSyncObj);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSyncObj);
 
     return ret;
 }
@@ -1508,19 +1121,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsDestroySyncobj(
     uint32                syncObj
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsDestroySyncobj);
     int32 ret = m_pFuncs->pfnAmdgpuCsDestroySyncobj(hDevice,
                                                     syncObj);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsDestroySyncobj,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsDestroySyncobj(%p, %x)\n",
-        hDevice,
-        syncObj);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1532,21 +1136,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsExportSyncobj(
     int32*                pSharedFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsExportSyncobj);
     int32 ret = m_pFuncs->pfnAmdgpuCsExportSyncobj(hDevice,
                                                    syncObj,
                                                    pSharedFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsExportSyncobj,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsExportSyncobj(%p, %x, %p)\n",
-        hDevice,
-        syncObj,
-        pSharedFd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSharedFd);
 
     return ret;
 }
@@ -1558,21 +1153,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsImportSyncobj(
     uint32*               pSyncObj
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsImportSyncobj);
     int32 ret = m_pFuncs->pfnAmdgpuCsImportSyncobj(hDevice,
                                                    sharedFd,
                                                    pSyncObj);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsImportSyncobj,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsImportSyncobj(%p, %x, %p)\n",
-        hDevice,
-        sharedFd,
-        pSyncObj);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSyncObj);
 
     return ret;
 }
@@ -1587,27 +1173,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSubmitRaw(
     uint64*                      pSeqNo
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSubmitRaw);
     int32 ret = m_pFuncs->pfnAmdgpuCsSubmitRaw(hDevice,
                                                hContext,
                                                hBuffer,
                                                numChunks,
                                                pChunks,
                                                pSeqNo);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSubmitRaw,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSubmitRaw(%p, %p, %p, %x, %p, %p)\n",
-        hDevice,
-        hContext,
-        hBuffer,
-        numChunks,
-        pChunks,
-        pSeqNo);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSeqNo);
 
     return ret;
 }
@@ -1622,27 +1196,15 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSubmitRaw2(
     uint64_t                    *seq_no
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSubmitRaw2);
     int32 ret = m_pFuncs->pfnAmdgpuCsSubmitRaw2(dev,
                                                 context,
                                                 bo_list_handle,
                                                 num_chunks,
-                                                *chunks,
-                                                *seq_no);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSubmitRaw2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSubmitRaw2(%p, %p, %x, %x, %x, %lx)\n",
-        dev,
-        context,
-        bo_list_handle,
-        num_chunks,
-        *chunks,
-        *seq_no);
-    m_paramLogger.Flush();
+                                                chunks,
+                                                seq_no);
+    call.End(ret);
+    call.CaptureOut(seq_no);
 
     return ret;
 }
@@ -1653,19 +1215,10 @@ void DrmLoaderFuncsProxy::pfnAmdgpuCsChunkFenceToDep(
     struct drm_amdgpu_cs_chunk_dep  pDep
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsChunkFenceToDep);
     m_pFuncs->pfnAmdgpuCsChunkFenceToDep(pFence,
                                          pDep);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsChunkFenceToDep,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsChunkFenceToDep(%p, %x)\n",
-        pFence,
-        pDep);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -1674,19 +1227,11 @@ void DrmLoaderFuncsProxy::pfnAmdgpuCsChunkFenceInfoToData(
     struct drm_amdgpu_cs_chunk_data*  pData
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsChunkFenceInfoToData);
     m_pFuncs->pfnAmdgpuCsChunkFenceInfoToData(fenceInfo,
                                               pData);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsChunkFenceInfoToData,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsChunkFenceInfoToData(%x, %p)\n",
-        fenceInfo,
-        pData);
-    m_paramLogger.Flush();
+    call.End(0);
+    call.CaptureOut(pData);
 }
 
 // =====================================================================================================================
@@ -1696,21 +1241,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjImportSyncFile(
     int32                 syncFileFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjImportSyncFile(hDevice,
                                                            syncObj,
                                                            syncFileFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjImportSyncFile,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjImportSyncFile(%p, %x, %x)\n",
-        hDevice,
-        syncObj,
-        syncFileFd);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1723,23 +1258,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjImportSyncFile2(
     int32                 syncFileFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile2);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjImportSyncFile2(hDevice,
                                                             syncObj,
                                                             point,
                                                             syncFileFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjImportSyncFile2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjImportSyncFile2(%p, %x, %lx, %x)\n",
-        hDevice,
-        syncObj,
-        point,
-        syncFileFd);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1751,21 +1275,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjExportSyncFile(
     int32*                pSyncFileFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjExportSyncFile(hDevice,
                                                            syncObj,
                                                            pSyncFileFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjExportSyncFile,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjExportSyncFile(%p, %x, %p)\n",
-        hDevice,
-        syncObj,
-        pSyncFileFd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSyncFileFd);
 
     return ret;
 }
@@ -1779,25 +1294,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjExportSyncFile2(
     int32*                pSyncFileFd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile2);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjExportSyncFile2(hDevice,
                                                             syncObj,
                                                             point,
                                                             flags,
                                                             pSyncFileFd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjExportSyncFile2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjExportSyncFile2(%p, %x, %lx, %x, %p)\n",
-        hDevice,
-        syncObj,
-        point,
-        flags,
-        pSyncFileFd);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSyncFileFd);
 
     return ret;
 }
@@ -1812,27 +1316,16 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjWait(
     uint32*               pFirstSignaled
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjWait);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjWait(hDevice,
                                                  pHandles,
                                                  numHandles,
                                                  timeoutInNs,
                                                  flags,
                                                  pFirstSignaled);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjWait,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjWait(%p, %p, %x, %lx, %x, %p)\n",
-        hDevice,
-        pHandles,
-        numHandles,
-        timeoutInNs,
-        flags,
-        pFirstSignaled);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pHandles);
+    call.CaptureOut(pFirstSignaled);
 
     return ret;
 }
@@ -1848,7 +1341,7 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjTimelineWait(
     uint32*               pFirstSignaled
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjTimelineWait);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjTimelineWait(hDevice,
                                                          pHandles,
                                                          points,
@@ -1856,21 +1349,10 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjTimelineWait(
                                                          timeoutInNs,
                                                          flags,
                                                          pFirstSignaled);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjTimelineWait,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjTimelineWait(%p, %p, %p, %x, %lx, %x, %p)\n",
-        hDevice,
-        pHandles,
-        points,
-        numHandles,
-        timeoutInNs,
-        flags,
-        pFirstSignaled);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pHandles);
+    call.CaptureOut(points);
+    call.CaptureOut(pFirstSignaled);
 
     return ret;
 }
@@ -1882,21 +1364,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjReset(
     uint32                numHandles
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjReset);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjReset(hDevice,
                                                   pHandles,
                                                   numHandles);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjReset,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjReset(%p, %p, %x)\n",
-        hDevice,
-        pHandles,
-        numHandles);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1908,21 +1380,11 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjSignal(
     uint32                numHandles
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjSignal);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjSignal(hDevice,
                                                    pHandles,
                                                    numHandles);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjSignal,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjSignal(%p, %p, %x)\n",
-        hDevice,
-        pHandles,
-        numHandles);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1935,23 +1397,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjTimelineSignal(
     uint32                numHandles
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjTimelineSignal);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjTimelineSignal(hDevice,
                                                            pHandles,
                                                            points,
                                                            numHandles);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjTimelineSignal,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjTimelineSignal(%p, %p, %p, %x)\n",
-        hDevice,
-        pHandles,
-        points,
-        numHandles);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(points);
 
     return ret;
 }
@@ -1966,27 +1418,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjTransfer(
     uint32                flags
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjTransfer);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjTransfer(hDevice,
                                                      dst_handle,
                                                      dst_point,
                                                      src_handle,
                                                      src_point,
                                                      flags);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjTransfer,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjTransfer(%p, %x, %lx, %x, %lx, %x)\n",
-        hDevice,
-        dst_handle,
-        dst_point,
-        src_handle,
-        src_point,
-        flags);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -1999,23 +1438,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjQuery(
     uint32                numHandles
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjQuery);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjQuery(hDevice,
                                                   pHandles,
                                                   points,
                                                   numHandles);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjQuery,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjQuery(%p, %p, %p, %x)\n",
-        hDevice,
-        pHandles,
-        points,
-        numHandles);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(points);
 
     return ret;
 }
@@ -2029,25 +1458,14 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsSyncobjQuery2(
     uint32                flags
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsSyncobjQuery2);
     int32 ret = m_pFuncs->pfnAmdgpuCsSyncobjQuery2(hDevice,
                                                    pHandles,
                                                    points,
                                                    numHandles,
                                                    flags);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsSyncobjQuery2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsSyncobjQuery2(%p, %p, %p, %x, %x)\n",
-        hDevice,
-        pHandles,
-        points,
-        numHandles,
-        flags);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(points);
 
     return ret;
 }
@@ -2059,21 +1477,12 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCtxCreate2(
     amdgpu_context_handle*  pContextHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCtxCreate2);
     int32 ret = m_pFuncs->pfnAmdgpuCsCtxCreate2(hDevice,
                                                 priority,
                                                 pContextHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCtxCreate2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCtxCreate2(%p, %x, %p)\n",
-        hDevice,
-        priority,
-        pContextHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pContextHandle);
 
     return ret;
 }
@@ -2086,23 +1495,13 @@ int32 DrmLoaderFuncsProxy::pfnAmdgpuCsCtxCreate3(
     amdgpu_context_handle*  pContextHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointAmdgpuCsCtxCreate3);
     int32 ret = m_pFuncs->pfnAmdgpuCsCtxCreate3(hDevice,
                                                 priority,
                                                 flags,
                                                 pContextHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("AmdgpuCsCtxCreate3,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "AmdgpuCsCtxCreate3(%p, %x, %x, %p)\n",
-        hDevice,
-        priority,
-        flags,
-        pContextHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pContextHandle);
 
     return ret;
 }
@@ -2112,17 +1511,9 @@ int32 DrmLoaderFuncsProxy::pfnDrmGetNodeTypeFromFd(
     int  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetNodeTypeFromFd);
     int32 ret = m_pFuncs->pfnDrmGetNodeTypeFromFd(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetNodeTypeFromFd,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetNodeTypeFromFd(%x)\n",
-        fd);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2132,17 +1523,10 @@ char* DrmLoaderFuncsProxy::pfnDrmGetRenderDeviceNameFromFd(
     int  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetRenderDeviceNameFromFd);
     char* pRet = m_pFuncs->pfnDrmGetRenderDeviceNameFromFd(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetRenderDeviceNameFromFd,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetRenderDeviceNameFromFd(%x)\n",
-        fd);
-    m_paramLogger.Flush();
+    call.End(pRet != nullptr);
+    call.CaptureString(pRet);
 
     return pRet;
 }
@@ -2153,19 +1537,10 @@ int32 DrmLoaderFuncsProxy::pfnDrmGetDevices(
     int32          maxDevices
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetDevices);
     int32 ret = m_pFuncs->pfnDrmGetDevices(pDevices,
                                            maxDevices);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetDevices,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetDevices(%p, %x)\n",
-        pDevices,
-        maxDevices);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2176,19 +1551,10 @@ void DrmLoaderFuncsProxy::pfnDrmFreeDevices(
     int32          count
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmFreeDevices);
     m_pFuncs->pfnDrmFreeDevices(pDevices,
                                 count);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmFreeDevices,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmFreeDevices(%p, %x)\n",
-        pDevices,
-        count);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2198,21 +1564,11 @@ int32 DrmLoaderFuncsProxy::pfnDrmGetDevice2(
     drmDevicePtr*  pDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetDevice2);
     int32 ret = m_pFuncs->pfnDrmGetDevice2(fd,
                                            flags,
                                            pDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetDevice2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetDevice2(%x, %x, %p)\n",
-        fd,
-        flags,
-        pDevice);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2222,17 +1578,9 @@ void DrmLoaderFuncsProxy::pfnDrmFreeDevice(
     drmDevicePtr*  pDevice
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmFreeDevice);
     m_pFuncs->pfnDrmFreeDevice(pDevice);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmFreeDevice,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmFreeDevice(%p)\n",
-        pDevice);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2240,17 +1588,10 @@ char* DrmLoaderFuncsProxy::pfnDrmGetBusid(
     int  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetBusid);
     char* pRet = m_pFuncs->pfnDrmGetBusid(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetBusid,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetBusid(%x)\n",
-        fd);
-    m_paramLogger.Flush();
+    call.End(pRet != nullptr);
+    call.CaptureString(pRet);
 
     return pRet;
 }
@@ -2260,17 +1601,9 @@ void DrmLoaderFuncsProxy::pfnDrmFreeBusid(
     const char*  pBusId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmFreeBusid);
     m_pFuncs->pfnDrmFreeBusid(pBusId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmFreeBusid,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmFreeBusid(%p)\n",
-        pBusId);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2278,19 +1611,11 @@ drmModeResPtr DrmLoaderFuncsProxy::pfnDrmModeGetResources(
     int  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeResPtr ret = m_pFuncs->pfnDrmModeGetResources(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetResources,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetResources);
+    drmModeResPtr pRet = m_pFuncs->pfnDrmModeGetResources(fd);
+    call.End(pRet != nullptr);
 
-    m_paramLogger.Printf(
-        "DrmModeGetResources(%x)\n",
-        fd);
-    m_paramLogger.Flush();
-
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2298,17 +1623,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeResources(
     drmModeResPtr  ptr
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeResources);
     m_pFuncs->pfnDrmModeFreeResources(ptr);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeResources,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeResources(%p)\n",
-        ptr);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2317,21 +1634,12 @@ drmModeConnectorPtr DrmLoaderFuncsProxy::pfnDrmModeGetConnector(
     uint32  connectorId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeConnectorPtr ret = m_pFuncs->pfnDrmModeGetConnector(fd,
-                                                               connectorId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetConnector,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetConnector);
+    drmModeConnectorPtr pRet = m_pFuncs->pfnDrmModeGetConnector(fd,
+                                                                connectorId);
+    call.End(pRet != nullptr);
 
-    m_paramLogger.Printf(
-        "DrmModeGetConnector(%x, %x)\n",
-        fd,
-        connectorId);
-    m_paramLogger.Flush();
-
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2339,17 +1647,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeConnector(
     drmModeConnectorPtr  ptr
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeConnector);
     m_pFuncs->pfnDrmModeFreeConnector(ptr);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeConnector,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeConnector(%p)\n",
-        ptr);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2359,21 +1659,12 @@ int32 DrmLoaderFuncsProxy::pfnDrmGetCap(
     uint64*  pValue
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmGetCap);
     int32 ret = m_pFuncs->pfnDrmGetCap(fd,
                                        capability,
                                        pValue);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmGetCap,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmGetCap(%x, %lx, %p)\n",
-        fd,
-        capability,
-        pValue);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pValue);
 
     return ret;
 }
@@ -2385,21 +1676,11 @@ int32 DrmLoaderFuncsProxy::pfnDrmSetClientCap(
     uint64  value
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmSetClientCap);
     int32 ret = m_pFuncs->pfnDrmSetClientCap(fd,
                                              capability,
                                              value);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmSetClientCap,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmSetClientCap(%x, %lx, %lx)\n",
-        fd,
-        capability,
-        value);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2411,21 +1692,12 @@ int32 DrmLoaderFuncsProxy::pfnDrmSyncobjCreate(
     uint32*  pHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmSyncobjCreate);
     int32 ret = m_pFuncs->pfnDrmSyncobjCreate(fd,
                                               flags,
                                               pHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmSyncobjCreate,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmSyncobjCreate(%x, %x, %p)\n",
-        fd,
-        flags,
-        pHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pHandle);
 
     return ret;
 }
@@ -2435,17 +1707,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreePlane(
     drmModePlanePtr  pPlanePtr
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreePlane);
     m_pFuncs->pfnDrmModeFreePlane(pPlanePtr);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreePlane,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreePlane(%p)\n",
-        pPlanePtr);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2453,17 +1717,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreePlaneResources(
     drmModePlaneResPtr  pPlaneResPtr
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreePlaneResources);
     m_pFuncs->pfnDrmModeFreePlaneResources(pPlaneResPtr);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreePlaneResources,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreePlaneResources(%p)\n",
-        pPlaneResPtr);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2471,19 +1727,11 @@ drmModePlaneResPtr DrmLoaderFuncsProxy::pfnDrmModeGetPlaneResources(
     int32  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModePlaneResPtr ret = m_pFuncs->pfnDrmModeGetPlaneResources(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetPlaneResources,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeGetPlaneResources(%x)\n",
-        fd);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetPlaneResources);
+    drmModePlaneResPtr pRet = m_pFuncs->pfnDrmModeGetPlaneResources(fd);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2492,21 +1740,12 @@ drmModePlanePtr DrmLoaderFuncsProxy::pfnDrmModeGetPlane(
     uint32  planeId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModePlanePtr ret = m_pFuncs->pfnDrmModeGetPlane(fd,
-                                                       planeId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetPlane,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetPlane);
+    drmModePlanePtr pRet = m_pFuncs->pfnDrmModeGetPlane(fd,
+                                                        planeId);
+    call.End(pRet != nullptr);
 
-    m_paramLogger.Printf(
-        "DrmModeGetPlane(%x, %x)\n",
-        fd,
-        planeId);
-    m_paramLogger.Flush();
-
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2514,17 +1753,9 @@ int32 DrmLoaderFuncsProxy::pfnDrmDropMaster(
     int32  fd
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmDropMaster);
     int32 ret = m_pFuncs->pfnDrmDropMaster(fd);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmDropMaster,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmDropMaster(%x)\n",
-        fd);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2536,21 +1767,12 @@ int32 DrmLoaderFuncsProxy::pfnDrmPrimeFDToHandle(
     uint32*  pHandle
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmPrimeFDToHandle);
     int32 ret = m_pFuncs->pfnDrmPrimeFDToHandle(fd,
                                                 primeFd,
                                                 pHandle);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmPrimeFDToHandle,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmPrimeFDToHandle(%x, %x, %p)\n",
-        fd,
-        primeFd,
-        pHandle);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pHandle);
 
     return ret;
 }
@@ -2568,7 +1790,7 @@ int32 DrmLoaderFuncsProxy::pfnDrmModeAddFB2(
     uint32   flags
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeAddFB2);
     int32 ret = m_pFuncs->pfnDrmModeAddFB2(fd,
                                            width,
                                            height,
@@ -2578,23 +1800,8 @@ int32 DrmLoaderFuncsProxy::pfnDrmModeAddFB2(
                                            offsets,
                                            pBufId,
                                            flags);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeAddFB2,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeAddFB2(%x, %x, %x, %x, %x, %x, %x, %p, %x)\n",
-        fd,
-        width,
-        height,
-        pixelFormat,
-        boHandles,
-        pitches,
-        offsets,
-        pBufId,
-        flags);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pBufId);
 
     return ret;
 }
@@ -2608,25 +1815,13 @@ int32 DrmLoaderFuncsProxy::pfnDrmModePageFlip(
     void*   pUserData
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModePageFlip);
     int32 ret = m_pFuncs->pfnDrmModePageFlip(fd,
                                              crtcId,
                                              fbId,
                                              flags,
                                              pUserData);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModePageFlip,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModePageFlip(%x, %x, %x, %x, %p)\n",
-        fd,
-        crtcId,
-        fbId,
-        flags,
-        pUserData);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2637,21 +1832,12 @@ drmModeEncoderPtr DrmLoaderFuncsProxy::pfnDrmModeGetEncoder(
     uint32  encoderId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeEncoderPtr ret = m_pFuncs->pfnDrmModeGetEncoder(fd,
-                                                           encoderId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetEncoder,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeGetEncoder(%x, %x)\n",
-        fd,
-        encoderId);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetEncoder);
+    drmModeEncoderPtr pRet = m_pFuncs->pfnDrmModeGetEncoder(fd,
+                                                            encoderId);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2659,17 +1845,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeEncoder(
     drmModeEncoderPtr  pEncoder
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeEncoder);
     m_pFuncs->pfnDrmModeFreeEncoder(pEncoder);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeEncoder,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeEncoder(%p)\n",
-        pEncoder);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2684,7 +1862,7 @@ int DrmLoaderFuncsProxy::pfnDrmModeSetCrtc(
     drmModeModeInfoPtr  pMode
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeSetCrtc);
     int ret = m_pFuncs->pfnDrmModeSetCrtc(fd,
                                           crtcId,
                                           bufferId,
@@ -2693,22 +1871,8 @@ int DrmLoaderFuncsProxy::pfnDrmModeSetCrtc(
                                           pConnectors,
                                           count,
                                           pMode);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeSetCrtc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeSetCrtc(%x, %x, %x, %x, %x, %p, %x, %p)\n",
-        fd,
-        crtcId,
-        bufferId,
-        x,
-        y,
-        pConnectors,
-        count,
-        pMode);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pConnectors);
 
     return ret;
 }
@@ -2719,21 +1883,12 @@ drmModeConnectorPtr DrmLoaderFuncsProxy::pfnDrmModeGetConnectorCurrent(
     uint32  connectorId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeConnectorPtr ret = m_pFuncs->pfnDrmModeGetConnectorCurrent(fd,
-                                                                      connectorId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetConnectorCurrent,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetConnectorCurrent);
+    drmModeConnectorPtr pRet = m_pFuncs->pfnDrmModeGetConnectorCurrent(fd,
+                                                                       connectorId);
+    call.End(pRet != nullptr);
 
-    m_paramLogger.Printf(
-        "DrmModeGetConnectorCurrent(%x, %x)\n",
-        fd,
-        connectorId);
-    m_paramLogger.Flush();
-
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2742,21 +1897,12 @@ drmModeCrtcPtr DrmLoaderFuncsProxy::pfnDrmModeGetCrtc(
     uint32  crtcId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeCrtcPtr ret = m_pFuncs->pfnDrmModeGetCrtc(fd,
-                                                     crtcId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetCrtc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeGetCrtc(%x, %x)\n",
-        fd,
-        crtcId);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetCrtc);
+    drmModeCrtcPtr pRet = m_pFuncs->pfnDrmModeGetCrtc(fd,
+                                                      crtcId);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2764,17 +1910,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeCrtc(
     drmModeCrtcPtr  pCrtc
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeCrtc);
     m_pFuncs->pfnDrmModeFreeCrtc(pCrtc);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeCrtc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeCrtc(%p)\n",
-        pCrtc);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2785,23 +1923,14 @@ int32 DrmLoaderFuncsProxy::pfnDrmCrtcGetSequence(
     uint64*  pNs
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmCrtcGetSequence);
     int32 ret = m_pFuncs->pfnDrmCrtcGetSequence(fd,
                                                 crtcId,
                                                 pSequence,
                                                 pNs);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmCrtcGetSequence,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmCrtcGetSequence(%x, %x, %p, %p)\n",
-        fd,
-        crtcId,
-        pSequence,
-        pNs);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSequence);
+    call.CaptureOut(pNs);
 
     return ret;
 }
@@ -2816,27 +1945,15 @@ int32 DrmLoaderFuncsProxy::pfnDrmCrtcQueueSequence(
     uint64   userData
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmCrtcQueueSequence);
     int32 ret = m_pFuncs->pfnDrmCrtcQueueSequence(fd,
                                                   crtcId,
                                                   flags,
                                                   sequence,
                                                   pSequenceQueued,
                                                   userData);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmCrtcQueueSequence,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmCrtcQueueSequence(%x, %x, %x, %lx, %p, %lx)\n",
-        fd,
-        crtcId,
-        flags,
-        sequence,
-        pSequenceQueued,
-        userData);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(pSequenceQueued);
 
     return ret;
 }
@@ -2847,19 +1964,10 @@ int32 DrmLoaderFuncsProxy::pfnDrmHandleEvent(
     drmEventContextPtr  pEvctx
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmHandleEvent);
     int32 ret = m_pFuncs->pfnDrmHandleEvent(fd,
                                             pEvctx);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmHandleEvent,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmHandleEvent(%x, %p)\n",
-        fd,
-        pEvctx);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2871,21 +1979,11 @@ int32 DrmLoaderFuncsProxy::pfnDrmIoctl(
     void*   pArg
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmIoctl);
     int32 ret = m_pFuncs->pfnDrmIoctl(fd,
                                       request,
                                       pArg);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmIoctl,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmIoctl(%x, %x, %p)\n",
-        fd,
-        request,
-        pArg);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -2896,21 +1994,12 @@ drmModePropertyPtr DrmLoaderFuncsProxy::pfnDrmModeGetProperty(
     uint32  propertyId
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModePropertyPtr ret = m_pFuncs->pfnDrmModeGetProperty(fd,
-                                                             propertyId);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetProperty,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeGetProperty(%x, %x)\n",
-        fd,
-        propertyId);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetProperty);
+    drmModePropertyPtr pRet = m_pFuncs->pfnDrmModeGetProperty(fd,
+                                                              propertyId);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2918,17 +2007,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeProperty(
     drmModePropertyPtr  pProperty
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeProperty);
     m_pFuncs->pfnDrmModeFreeProperty(pProperty);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeProperty,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeProperty(%p)\n",
-        pProperty);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2938,23 +2019,13 @@ drmModeObjectPropertiesPtr DrmLoaderFuncsProxy::pfnDrmModeObjectGetProperties(
     uint32  object_type
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeObjectPropertiesPtr ret = m_pFuncs->pfnDrmModeObjectGetProperties(fd,
-                                                                             object_id,
-                                                                             object_type);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeObjectGetProperties,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeObjectGetProperties(%x, %x, %x)\n",
-        fd,
-        object_id,
-        object_type);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeObjectGetProperties);
+    drmModeObjectPropertiesPtr pRet = m_pFuncs->pfnDrmModeObjectGetProperties(fd,
+                                                                              object_id,
+                                                                              object_type);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -2962,17 +2033,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreeObjectProperties(
     drmModeObjectPropertiesPtr  props
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreeObjectProperties);
     m_pFuncs->pfnDrmModeFreeObjectProperties(props);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreeObjectProperties,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreeObjectProperties(%p)\n",
-        props);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -2981,21 +2044,12 @@ drmModePropertyBlobPtr DrmLoaderFuncsProxy::pfnDrmModeGetPropertyBlob(
     uint32  blob_id
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModePropertyBlobPtr ret = m_pFuncs->pfnDrmModeGetPropertyBlob(fd,
-                                                                     blob_id);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeGetPropertyBlob,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeGetPropertyBlob(%x, %x)\n",
-        fd,
-        blob_id);
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeGetPropertyBlob);
+    drmModePropertyBlobPtr pRet = m_pFuncs->pfnDrmModeGetPropertyBlob(fd,
+                                                                      blob_id);
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -3003,33 +2057,19 @@ void DrmLoaderFuncsProxy::pfnDrmModeFreePropertyBlob(
     drmModePropertyBlobPtr  ptr
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeFreePropertyBlob);
     m_pFuncs->pfnDrmModeFreePropertyBlob(ptr);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeFreePropertyBlob,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeFreePropertyBlob(%p)\n",
-        ptr);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
 drmModeAtomicReqPtr DrmLoaderFuncsProxy::pfnDrmModeAtomicAlloc(    ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
-    drmModeAtomicReqPtr ret = m_pFuncs->pfnDrmModeAtomicAlloc();
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeAtomicAlloc,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf("DrmModeAtomicAlloc()\n");
-    m_paramLogger.Flush();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeAtomicAlloc);
+    drmModeAtomicReqPtr pRet = m_pFuncs->pfnDrmModeAtomicAlloc();
+    call.End(pRet != nullptr);
 
-    return ret;
+    return pRet;
 }
 
 // =====================================================================================================================
@@ -3037,17 +2077,9 @@ void DrmLoaderFuncsProxy::pfnDrmModeAtomicFree(
     drmModeAtomicReqPtr  req
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeAtomicFree);
     m_pFuncs->pfnDrmModeAtomicFree(req);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeAtomicFree,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeAtomicFree(%p)\n",
-        req);
-    m_paramLogger.Flush();
+    call.End(0);
 }
 
 // =====================================================================================================================
@@ -3058,23 +2090,12 @@ int DrmLoaderFuncsProxy::pfnDrmModeAtomicCommit(
     void*                user_data
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeAtomicCommit);
     int ret = m_pFuncs->pfnDrmModeAtomicCommit(fd,
                                                req,
                                                flags,
                                                user_data);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeAtomicCommit,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeAtomicCommit(%x, %p, %x, %p)\n",
-        fd,
-        req,
-        flags,
-        user_data);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -3087,23 +2108,13 @@ int DrmLoaderFuncsProxy::pfnDrmModeCreatePropertyBlob(
     uint32*      id
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeCreatePropertyBlob);
     int ret = m_pFuncs->pfnDrmModeCreatePropertyBlob(fd,
                                                      data,
                                                      length,
                                                      id);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeCreatePropertyBlob,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeCreatePropertyBlob(%x, %p, %x, %p)\n",
-        fd,
-        data,
-        length,
-        id);
-    m_paramLogger.Flush();
+    call.End(ret);
+    call.CaptureOut(id);
 
     return ret;
 }
@@ -3114,19 +2125,10 @@ int DrmLoaderFuncsProxy::pfnDrmModeDestroyPropertyBlob(
     uint32  id
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeDestroyPropertyBlob);
     int ret = m_pFuncs->pfnDrmModeDestroyPropertyBlob(fd,
                                                       id);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeDestroyPropertyBlob,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeDestroyPropertyBlob(%x, %x)\n",
-        fd,
-        id);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
@@ -3139,29 +2141,16 @@ int DrmLoaderFuncsProxy::pfnDrmModeAtomicAddProperty(
     uint64               value
     ) const
 {
-    const int64 begin = Util::GetPerfCpuTime();
+    DrmTraceCall call(&m_tracer, DrmLoaderEntryPointDrmModeAtomicAddProperty);
     int ret = m_pFuncs->pfnDrmModeAtomicAddProperty(req,
                                                     object_id,
                                                     property_id,
                                                     value);
-    const int64 end = Util::GetPerfCpuTime();
-    const int64 elapse = end - begin;
-    m_timeLogger.Printf("DrmModeAtomicAddProperty,%ld,%ld,%ld\n", begin, end, elapse);
-    m_timeLogger.Flush();
-
-    m_paramLogger.Printf(
-        "DrmModeAtomicAddProperty(%p, %x, %x, %lx)\n",
-        req,
-        object_id,
-        property_id,
-        value);
-    m_paramLogger.Flush();
+    call.End(ret);
 
     return ret;
 }
 
-#endif
-
 // =====================================================================================================================
 DrmLoader::DrmLoader()
     :
@@ -3324,14 +2313,1527 @@ Result DrmLoader::Init(
         if (result == Result::Success)
         {
             m_initialized = true;
-#if defined(PAL_DEBUG_PRINTS)
             m_proxy.SetFuncCalls(&m_funcs);
-#endif
         }
     }
     return result;
 }
 
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryHwIpInfo(
+    amdgpu_device_handle           hDevice,
+    uint32                         type,
+    uint32                         ipInstance,
+    struct drm_amdgpu_info_hw_ip*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryHwIpInfo);
+    call.RestoreOut(pInfo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoVaOp(
+    amdgpu_bo_handle  hBuffer,
+    uint64            offset,
+    uint64            size,
+    uint64            address,
+    uint64            flags,
+    uint32            ops)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoVaOp);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoVaOpRaw(
+    amdgpu_device_handle  hDevice,
+    amdgpu_bo_handle      hBuffer,
+    uint64                offset,
+    uint64                size,
+    uint64                address,
+    uint64                flags,
+    uint32                ops)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoVaOpRaw);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCreateSemaphore(
+    amdgpu_semaphore_handle*  pSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCreateSemaphore);
+    call.RestoreOut(pSemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSignalSemaphore(
+    amdgpu_context_handle    hContext,
+    uint32                   ipType,
+    uint32                   ipInstance,
+    uint32                   ring,
+    amdgpu_semaphore_handle  hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSignalSemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsWaitSemaphore(
+    amdgpu_context_handle    hConext,
+    uint32                   ipType,
+    uint32                   ipInstance,
+    uint32                   ring,
+    amdgpu_semaphore_handle  hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsWaitSemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsDestroySemaphore(
+    amdgpu_semaphore_handle  hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsDestroySemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCreateSem(
+    amdgpu_device_handle  hDevice,
+    amdgpu_sem_handle*    pSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCreateSem);
+    call.RestoreOut(pSemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSignalSem(
+    amdgpu_device_handle   hDevice,
+    amdgpu_context_handle  hContext,
+    uint32                 ipType,
+    uint32                 ipInstance,
+    uint32                 ring,
+    amdgpu_sem_handle      hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSignalSem);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsWaitSem(
+    amdgpu_device_handle   hDevice,
+    amdgpu_context_handle  hContext,
+    uint32                 ipType,
+    uint32                 ipInstance,
+    uint32                 ring,
+    amdgpu_sem_handle      hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsWaitSem);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsExportSem(
+    amdgpu_device_handle  hDevice,
+    amdgpu_sem_handle     hSemaphore,
+    int32*                pSharedFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsExportSem);
+    call.RestoreOut(pSharedFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsImportSem(
+    amdgpu_device_handle  hDevice,
+    int32                 fd,
+    amdgpu_sem_handle*    pSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsImportSem);
+    call.RestoreOut(pSemaphore);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsDestroySem(
+    amdgpu_device_handle  hDevice,
+    amdgpu_sem_handle     hSemaphore)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsDestroySem);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static const char* ReplayAmdgpuGetMarketingName(
+    amdgpu_device_handle  hDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuGetMarketingName);
+
+    return call.RestoreString();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuVaRangeFree(
+    amdgpu_va_handle  hVaRange)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuVaRangeFree);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuVaRangeQuery(
+    amdgpu_device_handle      hDevice,
+    enum amdgpu_gpu_va_range  type,
+    uint64*                   pStart,
+    uint64*                   pEnd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuVaRangeQuery);
+    call.RestoreOut(pStart);
+    call.RestoreOut(pEnd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuVaRangeAlloc(
+    amdgpu_device_handle      hDevice,
+    enum amdgpu_gpu_va_range  vaRangeType,
+    uint64                    size,
+    uint64                    vaBaseAlignment,
+    uint64                    vaBaseRequired,
+    uint64*                   pVaAllocated,
+    amdgpu_va_handle*         pVaRange,
+    uint64                    flags)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuVaRangeAlloc);
+    call.RestoreOut(pVaAllocated);
+    call.RestoreOut(pVaRange);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuReadMmRegisters(
+    amdgpu_device_handle  hDevice,
+    uint32                dwordOffset,
+    uint32                count,
+    uint32                instance,
+    uint32                flags,
+    uint32*               pValues)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuReadMmRegisters);
+    call.RestoreOut(pValues);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuDeviceInitialize(
+    int                    fd,
+    uint32*                pMajorVersion,
+    uint32*                pMinorVersion,
+    amdgpu_device_handle*  pDeviceHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuDeviceInitialize);
+    call.RestoreOut(pMajorVersion);
+    call.RestoreOut(pMinorVersion);
+    call.RestoreOut(pDeviceHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuDeviceDeinitialize(
+    amdgpu_device_handle  hDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuDeviceDeinitialize);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoAlloc(
+    amdgpu_device_handle             hDevice,
+    struct amdgpu_bo_alloc_request*  pAllocBuffer,
+    amdgpu_bo_handle*                pBufferHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoAlloc);
+    call.RestoreOut(pBufferHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoSetMetadata(
+    amdgpu_bo_handle            hBuffer,
+    struct amdgpu_bo_metadata*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoSetMetadata);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoQueryInfo(
+    amdgpu_bo_handle        hBuffer,
+    struct amdgpu_bo_info*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoQueryInfo);
+    call.RestoreOut(pInfo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoExport(
+    amdgpu_bo_handle            hBuffer,
+    enum amdgpu_bo_handle_type  type,
+    uint32*                     pFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoExport);
+    call.RestoreOut(pFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoImport(
+    amdgpu_device_handle             hDevice,
+    enum amdgpu_bo_handle_type       type,
+    uint32                           fd,
+    struct amdgpu_bo_import_result*  pOutput)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoImport);
+    call.RestoreOut(pOutput);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCreateBoFromUserMem(
+    amdgpu_device_handle  hDevice,
+    void*                 pCpuAddress,
+    uint64                size,
+    amdgpu_bo_handle*     pBufferHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCreateBoFromUserMem);
+    call.RestoreOut(pBufferHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCreateBoFromPhysMem(
+    amdgpu_device_handle  hDevice,
+    uint64                physAddress,
+    uint64                size,
+    amdgpu_bo_handle*     pBufferHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCreateBoFromPhysMem);
+    call.RestoreOut(pBufferHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuFindBoByCpuMapping(
+    amdgpu_device_handle  hDevice,
+    void*                 pCpuAddress,
+    uint64                size,
+    amdgpu_bo_handle*     pBufferHandle,
+    uint64*               pOffsetInBuffer)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuFindBoByCpuMapping);
+    call.RestoreOut(pBufferHandle);
+    call.RestoreOut(pOffsetInBuffer);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoFree(
+    amdgpu_bo_handle  hBuffer)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoFree);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoCpuMap(
+    amdgpu_bo_handle  hBuffer,
+    void**            ppCpuAddress)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoCpuMap);
+
+    return call.Unsupported("amdgpu_bo_cpu_map");
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoCpuUnmap(
+    amdgpu_bo_handle  hBuffer)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoCpuUnmap);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoRemapSecure(
+    amdgpu_bo_handle  buf_handle,
+    bool              secure_map)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoRemapSecure);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoWaitForIdle(
+    amdgpu_bo_handle  hBuffer,
+    uint64            timeoutInNs,
+    bool*             pBufferBusy)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoWaitForIdle);
+    call.RestoreOut(pBufferBusy);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoListCreate(
+    amdgpu_device_handle    hDevice,
+    uint32                  numberOfResources,
+    amdgpu_bo_handle*       pResources,
+    uint8*                  pResourcePriorities,
+    amdgpu_bo_list_handle*  pBoListHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoListCreate);
+    call.RestoreOut(pResources);
+    call.RestoreOut(pBoListHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoListDestroy(
+    amdgpu_bo_list_handle  hBoList)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoListDestroy);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCtxCreate(
+    amdgpu_device_handle    hDevice,
+    amdgpu_context_handle*  pContextHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCtxCreate);
+    call.RestoreOut(pContextHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCtxFree(
+    amdgpu_context_handle  hContext)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCtxFree);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSubmit(
+    amdgpu_context_handle      hContext,
+    uint64                     flags,
+    struct amdgpu_cs_request*  pIbsRequest,
+    uint32                     numberOfRequests)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSubmit);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsQueryFenceStatus(
+    struct amdgpu_cs_fence*  pFence,
+    uint64                   timeoutInNs,
+    uint64                   flags,
+    uint32*                  pExpired)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsQueryFenceStatus);
+    call.RestoreOut(pExpired);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsWaitFences(
+    struct amdgpu_cs_fence*  pFences,
+    uint32                   fenceCount,
+    bool                     waitAll,
+    uint64                   timeoutInNs,
+    uint32*                  pStatus,
+    uint32*                  pFirst)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsWaitFences);
+    call.RestoreOut(pStatus);
+    call.RestoreOut(pFirst);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryBufferSizeAlignment(
+    amdgpu_device_handle                   hDevice,
+    struct amdgpu_buffer_size_alignments*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryBufferSizeAlignment);
+    call.RestoreOut(pInfo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryFirmwareVersion(
+    amdgpu_device_handle  hDevice,
+    uint32                fwType,
+    uint32                ipInstance,
+    uint32                index,
+    uint32*               pVersion,
+    uint32*               pFeature)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryFirmwareVersion);
+    call.RestoreOut(pVersion);
+    call.RestoreOut(pFeature);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryHwIpCount(
+    amdgpu_device_handle  hDevice,
+    uint32                type,
+    uint32*               pCount)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryHwIpCount);
+    call.RestoreOut(pCount);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryHeapInfo(
+    amdgpu_device_handle      hDevice,
+    uint32                    heap,
+    uint32                    flags,
+    struct amdgpu_heap_info*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryHeapInfo);
+    call.RestoreOut(pInfo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryGpuInfo(
+    amdgpu_device_handle     hDevice,
+    struct amdgpu_gpu_info*  pInfo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryGpuInfo);
+    call.RestoreOut(pInfo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQuerySensorInfo(
+    amdgpu_device_handle  hDevice,
+    uint32                sensor_type,
+    uint32                size,
+    void*                 value)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQuerySensorInfo);
+    call.RestoreOut(value, size);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryInfo(
+    amdgpu_device_handle  hDevice,
+    uint32                infoId,
+    uint32                size,
+    void*                 pValue)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryInfo);
+    call.RestoreOut(pValue, size);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQueryPrivateAperture(
+    amdgpu_device_handle  hDevice,
+    uint64*               pStartVa,
+    uint64*               pEndVa)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQueryPrivateAperture);
+    call.RestoreOut(pStartVa);
+    call.RestoreOut(pEndVa);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuQuerySharedAperture(
+    amdgpu_device_handle  hDevice,
+    uint64*               pStartVa,
+    uint64*               pEndVa)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuQuerySharedAperture);
+    call.RestoreOut(pStartVa);
+    call.RestoreOut(pEndVa);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuBoGetPhysAddress(
+    amdgpu_bo_handle  hBuffer,
+    uint64*           pPhysAddress)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuBoGetPhysAddress);
+    call.RestoreOut(pPhysAddress);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsReservedVmid(
+    amdgpu_device_handle  hDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsReservedVmid);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsUnreservedVmid(
+    amdgpu_device_handle  hDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsUnreservedVmid);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCreateSyncobj(
+    amdgpu_device_handle  hDevice,
+    uint32*               pSyncObj)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCreateSyncobj);
+    call.RestoreOut(pSyncObj);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCreateSyncobj2(
+    amdgpu_device_handle  hDevice,
+    uint32                flags,
+    uint32*               pSyncObj)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCreateSyncobj2);
+    call.RestoreOut(pSyncObj);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsDestroySyncobj(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsDestroySyncobj);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsExportSyncobj(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj,
+    int32*                pSharedFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsExportSyncobj);
+    call.RestoreOut(pSharedFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsImportSyncobj(
+    amdgpu_device_handle  hDevice,
+    int32                 sharedFd,
+    uint32*               pSyncObj)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsImportSyncobj);
+    call.RestoreOut(pSyncObj);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSubmitRaw(
+    amdgpu_device_handle         hDevice,
+    amdgpu_context_handle        hContext,
+    amdgpu_bo_list_handle        hBuffer,
+    int32                        numChunks,
+    struct drm_amdgpu_cs_chunk*  pChunks,
+    uint64*                      pSeqNo)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSubmitRaw);
+    call.RestoreOut(pSeqNo);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSubmitRaw2(
+    amdgpu_device_handle        dev,
+    amdgpu_context_handle       context,
+    uint32_t                    bo_list_handle,
+    int                         num_chunks,
+    struct drm_amdgpu_cs_chunk  *chunks,
+    uint64_t                    *seq_no)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSubmitRaw2);
+    call.RestoreOut(seq_no);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static void ReplayAmdgpuCsChunkFenceToDep(
+    struct amdgpu_cs_fence*         pFence,
+    struct drm_amdgpu_cs_chunk_dep  pDep)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsChunkFenceToDep);
+}
+
+// =====================================================================================================================
+static void ReplayAmdgpuCsChunkFenceInfoToData(
+    struct amdgpu_cs_fence_info       fenceInfo,
+    struct drm_amdgpu_cs_chunk_data*  pData)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsChunkFenceInfoToData);
+    call.RestoreOut(pData);
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjImportSyncFile(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj,
+    int32                 syncFileFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjImportSyncFile2(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj,
+    uint64                point,
+    int32                 syncFileFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile2);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjExportSyncFile(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj,
+    int32*                pSyncFileFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile);
+    call.RestoreOut(pSyncFileFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjExportSyncFile2(
+    amdgpu_device_handle  hDevice,
+    uint32                syncObj,
+    uint64                point,
+    uint32                flags,
+    int32*                pSyncFileFd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile2);
+    call.RestoreOut(pSyncFileFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjWait(
+    amdgpu_device_handle  hDevice,
+    uint32*               pHandles,
+    uint32                numHandles,
+    int64                 timeoutInNs,
+    uint32                flags,
+    uint32*               pFirstSignaled)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjWait);
+    call.RestoreOut(pHandles);
+    call.RestoreOut(pFirstSignaled);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjTimelineWait(
+    amdgpu_device_handle  hDevice,
+    uint32*               pHandles,
+    uint64*               points,
+    uint32                numHandles,
+    int64                 timeoutInNs,
+    uint32                flags,
+    uint32*               pFirstSignaled)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjTimelineWait);
+    call.RestoreOut(pHandles);
+    call.RestoreOut(points);
+    call.RestoreOut(pFirstSignaled);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjReset(
+    amdgpu_device_handle  hDevice,
+    const uint32*         pHandles,
+    uint32                numHandles)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjReset);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjSignal(
+    amdgpu_device_handle  hDevice,
+    const uint32*         pHandles,
+    uint32                numHandles)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjSignal);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjTimelineSignal(
+    amdgpu_device_handle  hDevice,
+    const uint32*         pHandles,
+    uint64*               points,
+    uint32                numHandles)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjTimelineSignal);
+    call.RestoreOut(points);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjTransfer(
+    amdgpu_device_handle  hDevice,
+    uint32                dst_handle,
+    uint64                dst_point,
+    uint32                src_handle,
+    uint64                src_point,
+    uint32                flags)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjTransfer);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjQuery(
+    amdgpu_device_handle  hDevice,
+    const uint32*         pHandles,
+    uint64*               points,
+    uint32                numHandles)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjQuery);
+    call.RestoreOut(points);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsSyncobjQuery2(
+    amdgpu_device_handle  hDevice,
+    const uint32*         pHandles,
+    uint64*               points,
+    uint32                numHandles,
+    uint32                flags)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsSyncobjQuery2);
+    call.RestoreOut(points);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCtxCreate2(
+    amdgpu_device_handle    hDevice,
+    uint32                  priority,
+    amdgpu_context_handle*  pContextHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCtxCreate2);
+    call.RestoreOut(pContextHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayAmdgpuCsCtxCreate3(
+    amdgpu_device_handle    hDevice,
+    uint32                  priority,
+    uint32_t                flags,
+    amdgpu_context_handle*  pContextHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointAmdgpuCsCtxCreate3);
+    call.RestoreOut(pContextHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmGetNodeTypeFromFd(
+    int  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetNodeTypeFromFd);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static char* ReplayDrmGetRenderDeviceNameFromFd(
+    int  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetRenderDeviceNameFromFd);
+
+    return call.RestoreString();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmGetDevices(
+    drmDevicePtr*  pDevices,
+    int32          maxDevices)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetDevices);
+
+    return call.Unsupported("drmGetDevices");
+}
+
+// =====================================================================================================================
+static void ReplayDrmFreeDevices(
+    drmDevicePtr*  pDevices,
+    int32          count)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmFreeDevices);
+    call.Unsupported("drmFreeDevices");
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmGetDevice2(
+    int            fd,
+    uint32_t       flags,
+    drmDevicePtr*  pDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetDevice2);
+
+    return call.Unsupported("drmGetDevice2");
+}
+
+// =====================================================================================================================
+static void ReplayDrmFreeDevice(
+    drmDevicePtr*  pDevice)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmFreeDevice);
+    call.Unsupported("drmFreeDevice");
+}
+
+// =====================================================================================================================
+static char* ReplayDrmGetBusid(
+    int  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetBusid);
+
+    return call.RestoreString();
+}
+
+// =====================================================================================================================
+static void ReplayDrmFreeBusid(
+    const char*  pBusId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmFreeBusid);
+}
+
+// =====================================================================================================================
+static drmModeResPtr ReplayDrmModeGetResources(
+    int  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetResources);
+    call.Unsupported("drmModeGetResources");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeResources(
+    drmModeResPtr  ptr)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeResources);
+}
+
+// =====================================================================================================================
+static drmModeConnectorPtr ReplayDrmModeGetConnector(
+    int     fd,
+    uint32  connectorId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetConnector);
+    call.Unsupported("drmModeGetConnector");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeConnector(
+    drmModeConnectorPtr  ptr)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeConnector);
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmGetCap(
+    int      fd,
+    uint64   capability,
+    uint64*  pValue)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmGetCap);
+    call.RestoreOut(pValue);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmSetClientCap(
+    int     fd,
+    uint64  capability,
+    uint64  value)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmSetClientCap);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmSyncobjCreate(
+    int      fd,
+    uint32   flags,
+    uint32*  pHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmSyncobjCreate);
+    call.RestoreOut(pHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreePlane(
+    drmModePlanePtr  pPlanePtr)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreePlane);
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreePlaneResources(
+    drmModePlaneResPtr  pPlaneResPtr)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreePlaneResources);
+}
+
+// =====================================================================================================================
+static drmModePlaneResPtr ReplayDrmModeGetPlaneResources(
+    int32  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetPlaneResources);
+    call.Unsupported("drmModeGetPlaneResources");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static drmModePlanePtr ReplayDrmModeGetPlane(
+    int32   fd,
+    uint32  planeId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetPlane);
+    call.Unsupported("drmModeGetPlane");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmDropMaster(
+    int32  fd)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmDropMaster);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmPrimeFDToHandle(
+    int32    fd,
+    int32    primeFd,
+    uint32*  pHandle)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmPrimeFDToHandle);
+    call.RestoreOut(pHandle);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmModeAddFB2(
+    int32    fd,
+    uint32   width,
+    uint32   height,
+    uint32   pixelFormat,
+    uint32   boHandles[4],
+    uint32   pitches[4],
+    uint32   offsets[4],
+    uint32*  pBufId,
+    uint32   flags)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeAddFB2);
+    call.RestoreOut(pBufId);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmModePageFlip(
+    int32   fd,
+    uint32  crtcId,
+    uint32  fbId,
+    uint32  flags,
+    void*   pUserData)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModePageFlip);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static drmModeEncoderPtr ReplayDrmModeGetEncoder(
+    int32   fd,
+    uint32  encoderId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetEncoder);
+    call.Unsupported("drmModeGetEncoder");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeEncoder(
+    drmModeEncoderPtr  pEncoder)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeEncoder);
+}
+
+// =====================================================================================================================
+static int ReplayDrmModeSetCrtc(
+    int32               fd,
+    uint32              crtcId,
+    uint32              bufferId,
+    uint32              x,
+    uint32              y,
+    uint32*             pConnectors,
+    int32               count,
+    drmModeModeInfoPtr  pMode)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeSetCrtc);
+    call.RestoreOut(pConnectors);
+
+    return call.ReturnValue<int>();
+}
+
+// =====================================================================================================================
+static drmModeConnectorPtr ReplayDrmModeGetConnectorCurrent(
+    int32   fd,
+    uint32  connectorId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetConnectorCurrent);
+    call.Unsupported("drmModeGetConnectorCurrent");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static drmModeCrtcPtr ReplayDrmModeGetCrtc(
+    int32   fd,
+    uint32  crtcId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetCrtc);
+    call.Unsupported("drmModeGetCrtc");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeCrtc(
+    drmModeCrtcPtr  pCrtc)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeCrtc);
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmCrtcGetSequence(
+    int32    fd,
+    uint32   crtcId,
+    uint64*  pSequence,
+    uint64*  pNs)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmCrtcGetSequence);
+    call.RestoreOut(pSequence);
+    call.RestoreOut(pNs);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmCrtcQueueSequence(
+    int32    fd,
+    uint32   crtcId,
+    uint32   flags,
+    uint64   sequence,
+    uint64*  pSequenceQueued,
+    uint64   userData)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmCrtcQueueSequence);
+    call.RestoreOut(pSequenceQueued);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmHandleEvent(
+    int32               fd,
+    drmEventContextPtr  pEvctx)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmHandleEvent);
+
+    return call.ReturnValue<int32>();
+}
+
+// =====================================================================================================================
+static int32 ReplayDrmIoctl(
+    int32   fd,
+    uint32  request,
+    void*   pArg)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmIoctl);
+
+    return call.Unsupported("drmIoctl");
+}
+
+// =====================================================================================================================
+static drmModePropertyPtr ReplayDrmModeGetProperty(
+    int32   fd,
+    uint32  propertyId)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetProperty);
+    call.Unsupported("drmModeGetProperty");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeProperty(
+    drmModePropertyPtr  pProperty)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeProperty);
+}
+
+// =====================================================================================================================
+static drmModeObjectPropertiesPtr ReplayDrmModeObjectGetProperties(
+    int     fd,
+    uint32  object_id,
+    uint32  object_type)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeObjectGetProperties);
+    call.Unsupported("drmModeObjectGetProperties");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreeObjectProperties(
+    drmModeObjectPropertiesPtr  props)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreeObjectProperties);
+}
+
+// =====================================================================================================================
+static drmModePropertyBlobPtr ReplayDrmModeGetPropertyBlob(
+    int     fd,
+    uint32  blob_id)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeGetPropertyBlob);
+    call.Unsupported("drmModeGetPropertyBlob");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeFreePropertyBlob(
+    drmModePropertyBlobPtr  ptr)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeFreePropertyBlob);
+}
+
+// =====================================================================================================================
+static drmModeAtomicReqPtr ReplayDrmModeAtomicAlloc(void)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeAtomicAlloc);
+    call.Unsupported("drmModeAtomicAlloc");
+
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void ReplayDrmModeAtomicFree(
+    drmModeAtomicReqPtr  req)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeAtomicFree);
+}
+
+// =====================================================================================================================
+static int ReplayDrmModeAtomicCommit(
+    int                  fd,
+    drmModeAtomicReqPtr  req,
+    uint32               flags,
+    void*                user_data)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeAtomicCommit);
+
+    return call.ReturnValue<int>();
+}
+
+// =====================================================================================================================
+static int ReplayDrmModeCreatePropertyBlob(
+    int          fd,
+    const void*  data,
+    size_t       length,
+    uint32*      id)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeCreatePropertyBlob);
+    call.RestoreOut(id);
+
+    return call.ReturnValue<int>();
+}
+
+// =====================================================================================================================
+static int ReplayDrmModeDestroyPropertyBlob(
+    int     fd,
+    uint32  id)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeDestroyPropertyBlob);
+
+    return call.ReturnValue<int>();
+}
+
+// =====================================================================================================================
+static int ReplayDrmModeAtomicAddProperty(
+    drmModeAtomicReqPtr  req,
+    uint32               object_id,
+    uint32               property_id,
+    uint64               value)
+{
+    DrmReplayCall call(DrmLoaderEntryPointDrmModeAtomicAddProperty);
+
+    return call.ReturnValue<int>();
+}
+
+// =====================================================================================================================
+// Replaces every entry point with a stub serving the results recorded in the given trace file, so the amdgpu
+// backend can run without the real libraries or a GPU.
+Result DrmLoader::InitReplay(
+    Platform*   pPlatform,
+    const char* pTraceFile)
+{
+    Result result = m_replayer.Init(pPlatform, pTraceFile, DrmLoaderEntryPointsCount);
+
+    if (result == Result::Success)
+    {
+        m_funcs.pfnAmdgpuQueryHwIpInfo = ReplayAmdgpuQueryHwIpInfo;
+        m_funcs.pfnAmdgpuBoVaOp = ReplayAmdgpuBoVaOp;
+        m_funcs.pfnAmdgpuBoVaOpRaw = ReplayAmdgpuBoVaOpRaw;
+        m_funcs.pfnAmdgpuCsCreateSemaphore = ReplayAmdgpuCsCreateSemaphore;
+        m_funcs.pfnAmdgpuCsSignalSemaphore = ReplayAmdgpuCsSignalSemaphore;
+        m_funcs.pfnAmdgpuCsWaitSemaphore = ReplayAmdgpuCsWaitSemaphore;
+        m_funcs.pfnAmdgpuCsDestroySemaphore = ReplayAmdgpuCsDestroySemaphore;
+        m_funcs.pfnAmdgpuCsCreateSem = ReplayAmdgpuCsCreateSem;
+        m_funcs.pfnAmdgpuCsSignalSem = ReplayAmdgpuCsSignalSem;
+        m_funcs.pfnAmdgpuCsWaitSem = ReplayAmdgpuCsWaitSem;
+        m_funcs.pfnAmdgpuCsExportSem = ReplayAmdgpuCsExportSem;
+        m_funcs.pfnAmdgpuCsImportSem = ReplayAmdgpuCsImportSem;
+        m_funcs.pfnAmdgpuCsDestroySem = ReplayAmdgpuCsDestroySem;
+        m_funcs.pfnAmdgpuGetMarketingName = ReplayAmdgpuGetMarketingName;
+        m_funcs.pfnAmdgpuVaRangeFree = ReplayAmdgpuVaRangeFree;
+        m_funcs.pfnAmdgpuVaRangeQuery = ReplayAmdgpuVaRangeQuery;
+        m_funcs.pfnAmdgpuVaRangeAlloc = ReplayAmdgpuVaRangeAlloc;
+        m_funcs.pfnAmdgpuReadMmRegisters = ReplayAmdgpuReadMmRegisters;
+        m_funcs.pfnAmdgpuDeviceInitialize = ReplayAmdgpuDeviceInitialize;
+        m_funcs.pfnAmdgpuDeviceDeinitialize = ReplayAmdgpuDeviceDeinitialize;
+        m_funcs.pfnAmdgpuBoAlloc = ReplayAmdgpuBoAlloc;
+        m_funcs.pfnAmdgpuBoSetMetadata = ReplayAmdgpuBoSetMetadata;
+        m_funcs.pfnAmdgpuBoQueryInfo = ReplayAmdgpuBoQueryInfo;
+        m_funcs.pfnAmdgpuBoExport = ReplayAmdgpuBoExport;
+        m_funcs.pfnAmdgpuBoImport = ReplayAmdgpuBoImport;
+        m_funcs.pfnAmdgpuCreateBoFromUserMem = ReplayAmdgpuCreateBoFromUserMem;
+        m_funcs.pfnAmdgpuCreateBoFromPhysMem = ReplayAmdgpuCreateBoFromPhysMem;
+        m_funcs.pfnAmdgpuFindBoByCpuMapping = ReplayAmdgpuFindBoByCpuMapping;
+        m_funcs.pfnAmdgpuBoFree = ReplayAmdgpuBoFree;
+        m_funcs.pfnAmdgpuBoCpuMap = ReplayAmdgpuBoCpuMap;
+        m_funcs.pfnAmdgpuBoCpuUnmap = ReplayAmdgpuBoCpuUnmap;
+        m_funcs.pfnAmdgpuBoRemapSecure = ReplayAmdgpuBoRemapSecure;
+        m_funcs.pfnAmdgpuBoWaitForIdle = ReplayAmdgpuBoWaitForIdle;
+        m_funcs.pfnAmdgpuBoListCreate = ReplayAmdgpuBoListCreate;
+        m_funcs.pfnAmdgpuBoListDestroy = ReplayAmdgpuBoListDestroy;
+        m_funcs.pfnAmdgpuCsCtxCreate = ReplayAmdgpuCsCtxCreate;
+        m_funcs.pfnAmdgpuCsCtxFree = ReplayAmdgpuCsCtxFree;
+        m_funcs.pfnAmdgpuCsSubmit = ReplayAmdgpuCsSubmit;
+        m_funcs.pfnAmdgpuCsQueryFenceStatus = ReplayAmdgpuCsQueryFenceStatus;
+        m_funcs.pfnAmdgpuCsWaitFences = ReplayAmdgpuCsWaitFences;
+        m_funcs.pfnAmdgpuQueryBufferSizeAlignment = ReplayAmdgpuQueryBufferSizeAlignment;
+        m_funcs.pfnAmdgpuQueryFirmwareVersion = ReplayAmdgpuQueryFirmwareVersion;
+        m_funcs.pfnAmdgpuQueryHwIpCount = ReplayAmdgpuQueryHwIpCount;
+        m_funcs.pfnAmdgpuQueryHeapInfo = ReplayAmdgpuQueryHeapInfo;
+        m_funcs.pfnAmdgpuQueryGpuInfo = ReplayAmdgpuQueryGpuInfo;
+        m_funcs.pfnAmdgpuQuerySensorInfo = ReplayAmdgpuQuerySensorInfo;
+        m_funcs.pfnAmdgpuQueryInfo = ReplayAmdgpuQueryInfo;
+        m_funcs.pfnAmdgpuQueryPrivateAperture = ReplayAmdgpuQueryPrivateAperture;
+        m_funcs.pfnAmdgpuQuerySharedAperture = ReplayAmdgpuQuerySharedAperture;
+        m_funcs.pfnAmdgpuBoGetPhysAddress = ReplayAmdgpuBoGetPhysAddress;
+        m_funcs.pfnAmdgpuCsReservedVmid = ReplayAmdgpuCsReservedVmid;
+        m_funcs.pfnAmdgpuCsUnreservedVmid = ReplayAmdgpuCsUnreservedVmid;
+        m_funcs.pfnAmdgpuCsCreateSyncobj = ReplayAmdgpuCsCreateSyncobj;
+        m_funcs.pfnAmdgpuCsCreateSyncobj2 = ReplayAmdgpuCsCreateSyncobj2;
+        m_funcs.pfnAmdgpuCsDestroySyncobj = ReplayAmdgpuCsDestroySyncobj;
+        m_funcs.pfnAmdgpuCsExportSyncobj = ReplayAmdgpuCsExportSyncobj;
+        m_funcs.pfnAmdgpuCsImportSyncobj = ReplayAmdgpuCsImportSyncobj;
+        m_funcs.pfnAmdgpuCsSubmitRaw = ReplayAmdgpuCsSubmitRaw;
+        m_funcs.pfnAmdgpuCsSubmitRaw2 = ReplayAmdgpuCsSubmitRaw2;
+        m_funcs.pfnAmdgpuCsChunkFenceToDep = ReplayAmdgpuCsChunkFenceToDep;
+        m_funcs.pfnAmdgpuCsChunkFenceInfoToData = ReplayAmdgpuCsChunkFenceInfoToData;
+        m_funcs.pfnAmdgpuCsSyncobjImportSyncFile = ReplayAmdgpuCsSyncobjImportSyncFile;
+        m_funcs.pfnAmdgpuCsSyncobjImportSyncFile2 = ReplayAmdgpuCsSyncobjImportSyncFile2;
+        m_funcs.pfnAmdgpuCsSyncobjExportSyncFile = ReplayAmdgpuCsSyncobjExportSyncFile;
+        m_funcs.pfnAmdgpuCsSyncobjExportSyncFile2 = ReplayAmdgpuCsSyncobjExportSyncFile2;
+        m_funcs.pfnAmdgpuCsSyncobjWait = ReplayAmdgpuCsSyncobjWait;
+        m_funcs.pfnAmdgpuCsSyncobjTimelineWait = ReplayAmdgpuCsSyncobjTimelineWait;
+        m_funcs.pfnAmdgpuCsSyncobjReset = ReplayAmdgpuCsSyncobjReset;
+        m_funcs.pfnAmdgpuCsSyncobjSignal = ReplayAmdgpuCsSyncobjSignal;
+        m_funcs.pfnAmdgpuCsSyncobjTimelineSignal = ReplayAmdgpuCsSyncobjTimelineSignal;
+        m_funcs.pfnAmdgpuCsSyncobjTransfer = ReplayAmdgpuCsSyncobjTransfer;
+        m_funcs.pfnAmdgpuCsSyncobjQuery = ReplayAmdgpuCsSyncobjQuery;
+        m_funcs.pfnAmdgpuCsSyncobjQuery2 = ReplayAmdgpuCsSyncobjQuery2;
+        m_funcs.pfnAmdgpuCsCtxCreate2 = ReplayAmdgpuCsCtxCreate2;
+        m_funcs.pfnAmdgpuCsCtxCreate3 = ReplayAmdgpuCsCtxCreate3;
+        m_funcs.pfnDrmGetNodeTypeFromFd = ReplayDrmGetNodeTypeFromFd;
+        m_funcs.pfnDrmGetRenderDeviceNameFromFd = ReplayDrmGetRenderDeviceNameFromFd;
+        m_funcs.pfnDrmGetDevices = ReplayDrmGetDevices;
+        m_funcs.pfnDrmFreeDevices = ReplayDrmFreeDevices;
+        m_funcs.pfnDrmGetDevice2 = ReplayDrmGetDevice2;
+        m_funcs.pfnDrmFreeDevice = ReplayDrmFreeDevice;
+        m_funcs.pfnDrmGetBusid = ReplayDrmGetBusid;
+        m_funcs.pfnDrmFreeBusid = ReplayDrmFreeBusid;
+        m_funcs.pfnDrmModeGetResources = ReplayDrmModeGetResources;
+        m_funcs.pfnDrmModeFreeResources = ReplayDrmModeFreeResources;
+        m_funcs.pfnDrmModeGetConnector = ReplayDrmModeGetConnector;
+        m_funcs.pfnDrmModeFreeConnector = ReplayDrmModeFreeConnector;
+        m_funcs.pfnDrmGetCap = ReplayDrmGetCap;
+        m_funcs.pfnDrmSetClientCap = ReplayDrmSetClientCap;
+        m_funcs.pfnDrmSyncobjCreate = ReplayDrmSyncobjCreate;
+        m_funcs.pfnDrmModeFreePlane = ReplayDrmModeFreePlane;
+        m_funcs.pfnDrmModeFreePlaneResources = ReplayDrmModeFreePlaneResources;
+        m_funcs.pfnDrmModeGetPlaneResources = ReplayDrmModeGetPlaneResources;
+        m_funcs.pfnDrmModeGetPlane = ReplayDrmModeGetPlane;
+        m_funcs.pfnDrmDropMaster = ReplayDrmDropMaster;
+        m_funcs.pfnDrmPrimeFDToHandle = ReplayDrmPrimeFDToHandle;
+        m_funcs.pfnDrmModeAddFB2 = ReplayDrmModeAddFB2;
+        m_funcs.pfnDrmModePageFlip = ReplayDrmModePageFlip;
+        m_funcs.pfnDrmModeGetEncoder = ReplayDrmModeGetEncoder;
+        m_funcs.pfnDrmModeFreeEncoder = ReplayDrmModeFreeEncoder;
+        m_funcs.pfnDrmModeSetCrtc = ReplayDrmModeSetCrtc;
+        m_funcs.pfnDrmModeGetConnectorCurrent = ReplayDrmModeGetConnectorCurrent;
+        m_funcs.pfnDrmModeGetCrtc = ReplayDrmModeGetCrtc;
+        m_funcs.pfnDrmModeFreeCrtc = ReplayDrmModeFreeCrtc;
+        m_funcs.pfnDrmCrtcGetSequence = ReplayDrmCrtcGetSequence;
+        m_funcs.pfnDrmCrtcQueueSequence = ReplayDrmCrtcQueueSequence;
+        m_funcs.pfnDrmHandleEvent = ReplayDrmHandleEvent;
+        m_funcs.pfnDrmIoctl = ReplayDrmIoctl;
+        m_funcs.pfnDrmModeGetProperty = ReplayDrmModeGetProperty;
+        m_funcs.pfnDrmModeFreeProperty = ReplayDrmModeFreeProperty;
+        m_funcs.pfnDrmModeObjectGetProperties = ReplayDrmModeObjectGetProperties;
+        m_funcs.pfnDrmModeFreeObjectProperties = ReplayDrmModeFreeObjectProperties;
+        m_funcs.pfnDrmModeGetPropertyBlob = ReplayDrmModeGetPropertyBlob;
+        m_funcs.pfnDrmModeFreePropertyBlob = ReplayDrmModeFreePropertyBlob;
+        m_funcs.pfnDrmModeAtomicAlloc = ReplayDrmModeAtomicAlloc;
+        m_funcs.pfnDrmModeAtomicFree = ReplayDrmModeAtomicFree;
+        m_funcs.pfnDrmModeAtomicCommit = ReplayDrmModeAtomicCommit;
+        m_funcs.pfnDrmModeCreatePropertyBlob = ReplayDrmModeCreatePropertyBlob;
+        m_funcs.pfnDrmModeDestroyPropertyBlob = ReplayDrmModeDestroyPropertyBlob;
+        m_funcs.pfnDrmModeAtomicAddProperty = ReplayDrmModeAtomicAddProperty;
+
+        m_initialized = true;
+        m_proxy.SetFuncCalls(&m_funcs);
+    }
+
+    return result;
+}
+
 void DrmLoader::SpecializedInit(
     Platform* pPlatform,
     char*     pDtifLibName)
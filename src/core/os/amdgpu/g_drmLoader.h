@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include "core/os/amdgpu/amdgpuDrmTracer.h"
 #include "core/os/amdgpu/amdgpuHeaders.h"
 #include "palFile.h"
 #include "palLibrary.h"
@@ -656,6 +657,136 @@ enum DrmLoaderLibraries : uint32
     DrmLoaderLibrariesCount = 2
 };
 
+// Identifies each entry point in the binary trace written by DrmTracer and read back by DrmReplayer.
+enum DrmLoaderEntryPoints : uint32
+{
+    DrmLoaderEntryPointAmdgpuQueryHwIpInfo = 0,
+    DrmLoaderEntryPointAmdgpuBoVaOp = 1,
+    DrmLoaderEntryPointAmdgpuBoVaOpRaw = 2,
+    DrmLoaderEntryPointAmdgpuCsCreateSemaphore = 3,
+    DrmLoaderEntryPointAmdgpuCsSignalSemaphore = 4,
+    DrmLoaderEntryPointAmdgpuCsWaitSemaphore = 5,
+    DrmLoaderEntryPointAmdgpuCsDestroySemaphore = 6,
+    DrmLoaderEntryPointAmdgpuCsCreateSem = 7,
+    DrmLoaderEntryPointAmdgpuCsSignalSem = 8,
+    DrmLoaderEntryPointAmdgpuCsWaitSem = 9,
+    DrmLoaderEntryPointAmdgpuCsExportSem = 10,
+    DrmLoaderEntryPointAmdgpuCsImportSem = 11,
+    DrmLoaderEntryPointAmdgpuCsDestroySem = 12,
+    DrmLoaderEntryPointAmdgpuGetMarketingName = 13,
+    DrmLoaderEntryPointAmdgpuVaRangeFree = 14,
+    DrmLoaderEntryPointAmdgpuVaRangeQuery = 15,
+    DrmLoaderEntryPointAmdgpuVaRangeAlloc = 16,
+    DrmLoaderEntryPointAmdgpuReadMmRegisters = 17,
+    DrmLoaderEntryPointAmdgpuDeviceInitialize = 18,
+    DrmLoaderEntryPointAmdgpuDeviceDeinitialize = 19,
+    DrmLoaderEntryPointAmdgpuBoAlloc = 20,
+    DrmLoaderEntryPointAmdgpuBoSetMetadata = 21,
+    DrmLoaderEntryPointAmdgpuBoQueryInfo = 22,
+    DrmLoaderEntryPointAmdgpuBoExport = 23,
+    DrmLoaderEntryPointAmdgpuBoImport = 24,
+    DrmLoaderEntryPointAmdgpuCreateBoFromUserMem = 25,
+    DrmLoaderEntryPointAmdgpuCreateBoFromPhysMem = 26,
+    DrmLoaderEntryPointAmdgpuFindBoByCpuMapping = 27,
+    DrmLoaderEntryPointAmdgpuBoFree = 28,
+    DrmLoaderEntryPointAmdgpuBoCpuMap = 29,
+    DrmLoaderEntryPointAmdgpuBoCpuUnmap = 30,
+    DrmLoaderEntryPointAmdgpuBoRemapSecure = 31,
+    DrmLoaderEntryPointAmdgpuBoWaitForIdle = 32,
+    DrmLoaderEntryPointAmdgpuBoListCreate = 33,
+    DrmLoaderEntryPointAmdgpuBoListDestroy = 34,
+    DrmLoaderEntryPointAmdgpuCsCtxCreate = 35,
+    DrmLoaderEntryPointAmdgpuCsCtxFree = 36,
+    DrmLoaderEntryPointAmdgpuCsSubmit = 37,
+    DrmLoaderEntryPointAmdgpuCsQueryFenceStatus = 38,
+    DrmLoaderEntryPointAmdgpuCsWaitFences = 39,
+    DrmLoaderEntryPointAmdgpuQueryBufferSizeAlignment = 40,
+    DrmLoaderEntryPointAmdgpuQueryFirmwareVersion = 41,
+    DrmLoaderEntryPointAmdgpuQueryHwIpCount = 42,
+    DrmLoaderEntryPointAmdgpuQueryHeapInfo = 43,
+    DrmLoaderEntryPointAmdgpuQueryGpuInfo = 44,
+    DrmLoaderEntryPointAmdgpuQuerySensorInfo = 45,
+    DrmLoaderEntryPointAmdgpuQueryInfo = 46,
+    DrmLoaderEntryPointAmdgpuQueryPrivateAperture = 47,
+    DrmLoaderEntryPointAmdgpuQuerySharedAperture = 48,
+    DrmLoaderEntryPointAmdgpuBoGetPhysAddress = 49,
+    DrmLoaderEntryPointAmdgpuCsReservedVmid = 50,
+    DrmLoaderEntryPointAmdgpuCsUnreservedVmid = 51,
+    DrmLoaderEntryPointAmdgpuCsCreateSyncobj = 52,
+    DrmLoaderEntryPointAmdgpuCsCreateSyncobj2 = 53,
+    DrmLoaderEntryPointAmdgpuCsDestroySyncobj = 54,
+    DrmLoaderEntryPointAmdgpuCsExportSyncobj = 55,
+    DrmLoaderEntryPointAmdgpuCsImportSyncobj = 56,
+    DrmLoaderEntryPointAmdgpuCsSubmitRaw = 57,
+    DrmLoaderEntryPointAmdgpuCsSubmitRaw2 = 58,
+    DrmLoaderEntryPointAmdgpuCsChunkFenceToDep = 59,
+    DrmLoaderEntryPointAmdgpuCsChunkFenceInfoToData = 60,
+    DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile = 61,
+    DrmLoaderEntryPointAmdgpuCsSyncobjImportSyncFile2 = 62,
+    DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile = 63,
+    DrmLoaderEntryPointAmdgpuCsSyncobjExportSyncFile2 = 64,
+    DrmLoaderEntryPointAmdgpuCsSyncobjWait = 65,
+    DrmLoaderEntryPointAmdgpuCsSyncobjTimelineWait = 66,
+    DrmLoaderEntryPointAmdgpuCsSyncobjReset = 67,
+    DrmLoaderEntryPointAmdgpuCsSyncobjSignal = 68,
+    DrmLoaderEntryPointAmdgpuCsSyncobjTimelineSignal = 69,
+    DrmLoaderEntryPointAmdgpuCsSyncobjTransfer = 70,
+    DrmLoaderEntryPointAmdgpuCsSyncobjQuery = 71,
+    DrmLoaderEntryPointAmdgpuCsSyncobjQuery2 = 72,
+    DrmLoaderEntryPointAmdgpuCsCtxCreate2 = 73,
+    DrmLoaderEntryPointAmdgpuCsCtxCreate3 = 74,
+    DrmLoaderEntryPointDrmGetNodeTypeFromFd = 75,
+    DrmLoaderEntryPointDrmGetRenderDeviceNameFromFd = 76,
+    DrmLoaderEntryPointDrmGetDevices = 77,
+    DrmLoaderEntryPointDrmFreeDevices = 78,
+    DrmLoaderEntryPointDrmGetDevice2 = 79,
+    DrmLoaderEntryPointDrmFreeDevice = 80,
+    DrmLoaderEntryPointDrmGetBusid = 81,
+    DrmLoaderEntryPointDrmFreeBusid = 82,
+    DrmLoaderEntryPointDrmModeGetResources = 83,
+    DrmLoaderEntryPointDrmModeFreeResources = 84,
+    DrmLoaderEntryPointDrmModeGetConnector = 85,
+    DrmLoaderEntryPointDrmModeFreeConnector = 86,
+    DrmLoaderEntryPointDrmGetCap = 87,
+    DrmLoaderEntryPointDrmSetClientCap = 88,
+    DrmLoaderEntryPointDrmSyncobjCreate = 89,
+    DrmLoaderEntryPointDrmModeFreePlane = 90,
+    DrmLoaderEntryPointDrmModeFreePlaneResources = 91,
+    DrmLoaderEntryPointDrmModeGetPlaneResources = 92,
+    DrmLoaderEntryPointDrmModeGetPlane = 93,
+    DrmLoaderEntryPointDrmDropMaster = 94,
+    DrmLoaderEntryPointDrmPrimeFDToHandle = 95,
+    DrmLoaderEntryPointDrmModeAddFB2 = 96,
+    DrmLoaderEntryPointDrmModePageFlip = 97,
+    DrmLoaderEntryPointDrmModeGetEncoder = 98,
+    DrmLoaderEntryPointDrmModeFreeEncoder = 99,
+    DrmLoaderEntryPointDrmModeSetCrtc = 100,
+    DrmLoaderEntryPointDrmModeGetConnectorCurrent = 101,
+    DrmLoaderEntryPointDrmModeGetCrtc = 102,
+    DrmLoaderEntryPointDrmModeFreeCrtc = 103,
+    DrmLoaderEntryPointDrmCrtcGetSequence = 104,
+    DrmLoaderEntryPointDrmCrtcQueueSequence = 105,
+    DrmLoaderEntryPointDrmHandleEvent = 106,
+    DrmLoaderEntryPointDrmIoctl = 107,
+    DrmLoaderEntryPointDrmModeGetProperty = 108,
+    DrmLoaderEntryPointDrmModeFreeProperty = 109,
+    DrmLoaderEntryPointDrmModeObjectGetProperties = 110,
+    DrmLoaderEntryPointDrmModeFreeObjectProperties = 111,
+    DrmLoaderEntryPointDrmModeGetPropertyBlob = 112,
+    DrmLoaderEntryPointDrmModeFreePropertyBlob = 113,
+    DrmLoaderEntryPointDrmModeAtomicAlloc = 114,
+    DrmLoaderEntryPointDrmModeAtomicFree = 115,
+    DrmLoaderEntryPointDrmModeAtomicCommit = 116,
+    DrmLoaderEntryPointDrmModeCreatePropertyBlob = 117,
+    DrmLoaderEntryPointDrmModeDestroyPropertyBlob = 118,
+    DrmLoaderEntryPointDrmModeAtomicAddProperty = 119,
+    DrmLoaderEntryPointsCount = 120
+};
+
+static_assert(DrmLoaderEntryPointsCount <= DrmTracer::MaxEntryPoints, "Too many traced entry points.");
+
+extern const char* DrmLoaderEntryPointNames[DrmLoaderEntryPointsCount];
+
 struct DrmLoaderFuncs
 {
     AmdgpuQueryHwIpInfo               pfnAmdgpuQueryHwIpInfo;
@@ -1382,7 +1513,6 @@ struct DrmLoaderFuncs
 
 // =====================================================================================================================
 // the class serves as a proxy layer to add more functionality to wrapped callbacks.
-#if defined(PAL_DEBUG_PRINTS)
 class DrmLoaderFuncsProxy
 {
 public:
@@ -1391,7 +1521,9 @@ public:
 
     void SetFuncCalls(DrmLoaderFuncs* pFuncs) { m_pFuncs = pFuncs; }
 
-    void Init(const char* pPath);
+    Result Init(Platform* pPlatform, const char* pPath);
+
+    const DrmTracer& GetTracer() const { return m_tracer; }
 
     int32 pfnAmdgpuQueryHwIpInfo(
             amdgpu_device_handle              hDevice,
@@ -2593,13 +2725,11 @@ public:
     }
 
 private:
-    Util::File  m_timeLogger;
-    Util::File  m_paramLogger;
+    DrmTracer   m_tracer;
     DrmLoaderFuncs* m_pFuncs;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(DrmLoaderFuncsProxy);
 };
-#endif
 
 class Platform;
 
@@ -2614,13 +2744,13 @@ public:
     bool   Initialized() { return m_initialized; }
 
     const DrmLoaderFuncs& GetProcsTable()const { return m_funcs; }
-#if defined(PAL_DEBUG_PRINTS)
     const DrmLoaderFuncsProxy& GetProcsTableProxy()const { return m_proxy; }
 
-    void SetLogPath(const char* pPath) { m_proxy.Init(pPath); }
-#endif
+    Result InitTracer(Platform* pPlatform, const char* pPath) { return m_proxy.Init(pPlatform, pPath); }
 
     Result Init(Platform* pPlatform);
+    Result InitReplay(Platform* pPlatform, const char* pTraceFile);
+    bool   IsReplaying() const { return m_replayer.IsActive(); }
     void   SpecializedInit(Platform* pPlatform, char*  pDtifLibName);
 
 private:
@@ -2628,9 +2758,8 @@ private:
     bool          m_initialized;
 
     DrmLoaderFuncs      m_funcs;
-#if defined(PAL_DEBUG_PRINTS)
+    DrmReplayer         m_replayer;
     DrmLoaderFuncsProxy m_proxy;
-#endif
 
     PAL_DISALLOW_COPY_AND_ASSIGN(DrmLoader);
 };
@@ -28,8 +28,11 @@
 #include "core/settingsLoader.h"
 #include "core/os/nullDevice/ndPlatform.h"
 #include "palAssert.h"
+#include "palCpuProfiler.h"
 #include "palDbgPrint.h"
+#include "palMutex.h"
 #include "palSysUtil.h"
+#include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
 
 #if PAL_BUILD_LAYERS
@@ -98,6 +101,9 @@ Platform::Platform(
     :
     Pal::IPlatform(allocCb),
     m_deviceCount(0),
+#if defined(__unix__)
+    m_settingsFileMgr(SettingsFileName, this),
+#endif
     m_pDevDriverServer(nullptr),
     m_settingsLoader(this),
     m_pRgpServer(nullptr),
@@ -132,6 +138,14 @@ Platform::Platform(
 // =====================================================================================================================
 Platform::~Platform()
 {
+    if (m_flags.cpuZonesEnabled)
+    {
+        WriteCpuZoneTrace();
+
+        Util::CpuProfiler::Disable();
+        Util::CpuProfiler::Shutdown();
+    }
+
     DestroyDevDriver();
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -346,9 +360,17 @@ Result Platform::Init()
 {
     Result result = IPlatform::Init();
 
+    if (result == Result::Success)
+    {
+        result = m_startupProfiler.Init();
+    }
+
+    // Phases can only be recorded once the startup profiler is initialized, so each one below is behind a result check.
+
     // Perform early initialization of the developer driver after the platform is available.
     if (result == Result::Success)
     {
+        StartupPhase phase(this, "EarlyInitDevDriver");
         result = EarlyInitDevDriver();
     }
 
@@ -362,17 +384,20 @@ Result Platform::Init()
 
     if (result == Result::Success)
     {
+        StartupPhase phase(this, "ConnectToOsInterface");
         result = ConnectToOsInterface();
     }
 
     if (result == Result::Success)
     {
+        StartupPhase phase(this, "EnumerateDevices");
         result = ReEnumerateDevices();
     }
 
     // Perform late initialization of the developer driver after devices have been enumerated.
     if (result == Result::Success)
     {
+        StartupPhase phase(this, "LateInitDevDriver");
         LateInitDevDriver();
     }
 
@@ -381,9 +406,46 @@ Result Platform::Init()
         result = InitProperties();
     }
 
+    // The platform settings are only final once the devices have been enumerated.
+    if ((result == Result::Success) && PlatformSettings().cpuZoneProfilingEnabled)
+    {
+        result = Util::CpuProfiler::Enable(PlatformSettings().cpuZoneMaxEventsPerThread);
+
+        m_flags.cpuZonesEnabled = (result == Result::Success);
+    }
+
     return result;
 }
 
+// =====================================================================================================================
+// Writes every CPU profiling zone recorded so far to a Chrome trace-event file in the CPU zone trace directory. The
+// profiler is shared by every platform in the process, so each platform writes its own numbered file.
+void Platform::WriteCpuZoneTrace() const
+{
+    static volatile uint32 s_traceCount = 0;
+
+    const PalPlatformSettings& settings = PlatformSettings();
+
+    Result result = Util::MkDirRecursively(settings.cpuZoneTraceDirectory);
+
+    if ((result == Result::Success) || (result == Result::AlreadyExists))
+    {
+        char filePath[MaxPathStrLen];
+        Util::Snprintf(filePath,
+                       sizeof(filePath),
+                       "%s/PalCpuZones_%u_%u.json",
+                       settings.cpuZoneTraceDirectory,
+                       Util::GetIdOfCurrentProcess(),
+                       Util::AtomicIncrement(&s_traceCount));
+
+        result = Util::CpuProfiler::WriteChromeTrace(filePath);
+    }
+
+    PAL_ALERT(result != Result::Success);
+    PAL_ALERT_MSG(Util::CpuProfiler::GetNumDroppedZones() > 0,
+                  "CPU zone buffers overflowed; raise CpuZoneMaxEventsPerThread to capture every zone.");
+}
+
 // =====================================================================================================================
 // Optionally overrides the GPU ID for a single device.  This can be initiated through the panel settings for some build
 // configurations.  This MUST BE called after EarlyInitDevDriver() !!
@@ -27,8 +27,10 @@
 
 #include "palLib.h"
 #include "palPlatform.h"
+#include "palSettingsFileMgr.h"
 #include "platformSettingsLoader.h"
 #include "core/eventProvider.h"
+#include "core/startupProfiler.h"
 #include "core/g_palSettings.h"
 #include "core/g_palPlatformSettings.h"
 #include "ver.h"
@@ -122,6 +124,15 @@ public:
     virtual Result GetProperties(
         PlatformProperties* pProperties) override;
 
+    virtual Result GetStartupPhases(
+        uint32*           pPhaseCount,
+        StartupPhaseInfo* pPhases) const override
+        { return m_startupProfiler.GetPhases(pPhaseCount, pPhases); }
+
+    virtual Result DumpStartupPhases(
+        const char* pFilePath) const override
+        { return m_startupProfiler.DumpJson(pFilePath); }
+
     Result ReEnumerateDevices();
 
     Device* GetDevice(uint32 index) const
@@ -132,6 +143,10 @@ public:
 
     uint32       GetDeviceCount()  const { return m_deviceCount; }
     const char*  GetSettingsPath() const { return &m_settingsPath[0]; }
+#if defined(__unix__)
+    // The settings file is parsed once by the OS-specific platform and shared by all devices.
+    const Util::SettingsFileMgr<Platform>& GetSettingsFileMgr() const { return m_settingsFileMgr; }
+#endif
     virtual const PalPlatformSettings& PlatformSettings() const override { return m_settingsLoader.GetSettings(); }
     PalPlatformSettings* PlatformSettingsPtr() { return m_settingsLoader.GetSettingsPtr(); }
 
@@ -166,6 +181,7 @@ public:
                             va_list         args) override;
 
     EventProvider* GetEventProvider() { return &m_eventProvider; }
+    StartupProfiler* GetStartupProfiler() { return &m_startupProfiler; }
 
     virtual void LogEvent(
         PalEvent    eventId,
@@ -213,6 +229,10 @@ protected:
     static constexpr uint32 MaxSettingsPathLength = 256;
     char m_settingsPath[MaxSettingsPathLength];
 
+#if defined(__unix__)
+    Util::SettingsFileMgr<Platform> m_settingsFileMgr;
+#endif
+
     union
     {
         struct
@@ -228,7 +248,8 @@ protected:
             uint32 supportRgpTraces             : 1; // Indicates that the client supports RGP tracing. PAL will use
                                                      // this flag and the hardware support flag to setup the
                                                      // DevDriver RgpServer.
-            uint32 reserved                     : 25; // Reserved for future use.
+            uint32 cpuZonesEnabled              : 1; // This platform holds a reference on the CPU zone profiler.
+            uint32 reserved                     : 24; // Reserved for future use.
         };
         uint32 u32All;
     } m_flags;
@@ -249,6 +270,7 @@ private:
         void*                       pPlacementAddr);
 
     void InitRuntimeSettings(Device* pDevice);
+    void WriteCpuZoneTrace() const;
 
     // Developer Driver functionality.
     // Initialization + Destruction functions
@@ -272,6 +294,7 @@ private:
     gpusize                m_maxSvmSize;
     Util::LogCallbackInfo  m_logCb;
     EventProvider          m_eventProvider;
+    StartupProfiler        m_startupProfiler;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(Platform);
 };
@@ -27,7 +27,7 @@
 #include "core/presentScheduler.h"
 #include "core/queue.h"
 #include "core/swapChain.h"
-#include "palIntrusiveListImpl.h"
+#include "palLockFreeQueueImpl.h"
 using namespace Util;
 
 namespace Pal
@@ -161,17 +161,14 @@ PresentScheduler::~PresentScheduler()
         }
     }
 
-    for (auto iter = m_idleJobList.Begin(); iter.IsValid(); )
+    // The worker thread is gone so no push can be in progress and TryPop will find every job.
+    for (PresentSchedulerJob* pJob = m_idleJobQueue.TryPop(); pJob != nullptr; pJob = m_idleJobQueue.TryPop())
     {
-        PresentSchedulerJob*const pJob = iter.Get();
-        m_idleJobList.Erase(&iter);
         pJob->DestroyInternal(m_pDevice);
     }
 
-    for (auto iter = m_activeJobList.Begin(); iter.IsValid(); )
+    for (PresentSchedulerJob* pJob = m_activeJobQueue.TryPop(); pJob != nullptr; pJob = m_activeJobQueue.TryPop())
     {
-        PresentSchedulerJob*const pJob = iter.Get();
-        m_activeJobList.Erase(&iter);
         pJob->DestroyInternal(m_pDevice);
     }
 }
@@ -183,16 +180,6 @@ Result PresentScheduler::Init(
 {
     Result result = m_idleJobMutex.Init();
 
-    if (result == Result::Success)
-    {
-        result = m_activeJobMutex.Init();
-    }
-
-    if (result == Result::Success)
-    {
-        result = m_activeJobSemaphore.Init(Semaphore::MaximumCountLimit, 0);
-    }
-
     if (result == Result::Success)
     {
         result = m_workerThreadNotify.Init(Semaphore::MaximumCountLimit, 0);
@@ -421,33 +408,27 @@ Result PresentScheduler::WaitIdle()
 Result PresentScheduler::GetIdleJob(
     PresentSchedulerJob** ppJob)
 {
-    Result    result = Result::Success;
-    MutexAuto lock(&m_idleJobMutex);
+    Result result = Result::Success;
+
+    m_idleJobMutex.Lock();
+    *ppJob = m_idleJobQueue.TryPop();
+    m_idleJobMutex.Unlock();
 
-    if (m_idleJobList.IsEmpty())
+    // A job which the worker thread is still returning may be missed here; that just costs one extra job object.
+    if (*ppJob == nullptr)
     {
         result = PresentSchedulerJob::CreateInternal(m_pDevice, ppJob);
     }
-    else
-    {
-        *ppJob = m_idleJobList.Front();
-        m_idleJobList.Erase((*ppJob)->ListNode());
-    }
 
     return result;
 }
 
 // =====================================================================================================================
-// A thread-safe helper function to add the given job to the job queue and signal the job semaphore.
+// A thread-safe helper function to add the given job to the job queue, waking the worker thread if it is asleep.
 void PresentScheduler::EnqueueJob(
     PresentSchedulerJob* pJob)
 {
-    m_activeJobMutex.Lock();
-    m_activeJobList.PushBack(pJob->ListNode());
-    m_activeJobMutex.Unlock();
-
-    // Post after we unlock the mutex to prevent the worker thread from blocking if it wakes up too quickly.
-    m_activeJobSemaphore.Post();
+    m_activeJobQueue.Push(pJob->ListNode());
 }
 
 // =====================================================================================================================
@@ -457,23 +438,16 @@ void PresentScheduler::RunWorkerThread()
     while (true)
     {
         // Sleep until we have a job to process.
-        const Result result = m_activeJobSemaphore.Wait(UINT32_MAX);
+        PresentSchedulerJob* pJob   = nullptr;
+        const Result         result = m_activeJobQueue.Pop(&pJob, UINT32_MAX);
         PAL_ASSERT(IsErrorResult(result) == false);
 
         if (result == Result::Success)
         {
-            m_activeJobMutex.Lock();
-            PresentSchedulerJob*const pJob = m_activeJobList.Front();
-            m_activeJobList.Erase(pJob->ListNode());
-
-            m_activeJobMutex.Unlock();
-
             switch (pJob->GetType())
             {
             case PresentJobType::Terminate:
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                m_idleJobQueue.Push(pJob->ListNode());
 
                 // We've been asked to kill this thread.
                 m_workerActive = false;
@@ -481,9 +455,7 @@ void PresentScheduler::RunWorkerThread()
                 break;
 
             case PresentJobType::Notify:
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                m_idleJobQueue.Push(pJob->ListNode());
 
                 m_workerThreadNotify.Post();
                 break;
@@ -504,9 +476,7 @@ void PresentScheduler::RunWorkerThread()
                     PAL_ALERT(IsErrorResult(presentResult));
                 }
 
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                m_idleJobQueue.Push(pJob->ListNode());
                 break;
 
             default:
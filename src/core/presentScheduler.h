@@ -25,7 +25,7 @@
 
 #pragma once
 
-#include "palIntrusiveList.h"
+#include "palLockFreeQueue.h"
 #include "palMutex.h"
 #include "palQueue.h"
 #include "palSemaphore.h"
@@ -51,7 +51,7 @@ enum class PresentJobType : uint32
 // the opportunity to place an instance of this class into preallocated memory.
 class PresentSchedulerJob
 {
-    typedef Util::IntrusiveListNode<PresentSchedulerJob> Node;
+    typedef Util::MpscQueueNode<PresentSchedulerJob> Node;
 
 public:
     static Result CreateInternal(Device* pDevice, PresentSchedulerJob** ppPresentSchedulerJob);
@@ -74,7 +74,7 @@ private:
     PresentSchedulerJob();
     ~PresentSchedulerJob();
 
-    Node                 m_node;            // The present scheduler maintains intrusive lists of jobs.
+    Node                 m_node;            // The present scheduler maintains intrusive queues of jobs.
 #if !defined(__unix__)
     IFence*              m_pPriorWorkFence; // Signaled when the application's work prior to this present has completed.
 #endif
@@ -90,7 +90,7 @@ private:
 // swap chain present modes require CPU-side synchronization so an internal thread may be used to hide the stalls.
 class PresentScheduler
 {
-    typedef Util::IntrusiveList<PresentSchedulerJob> JobList;
+    typedef Util::IntrusiveMpscQueue<PresentSchedulerJob> JobQueue;
 
 public:
     // Present schedulers use the Create/Destroy pattern. The Create functions are in the OS-specific classes.
@@ -136,11 +136,11 @@ private:
     // All of this state is used to store and process asynchronous presentation requests. If all presents can be inlined
     // none of it will be used and the worker thread will never be started.
 
-    JobList         m_idleJobList;        // Idle job objects which are waiting to be reused.
-    Util::Mutex     m_idleJobMutex;       // Protects access to m_idleJobList.
-    JobList         m_activeJobList;      // Passes jobs from application threads to the worker thread.
-    Util::Mutex     m_activeJobMutex;     // Protects access to m_activeJobList.
-    Util::Semaphore m_activeJobSemaphore; // Signaled when a job is added to m_activeJobList.
+    JobQueue        m_idleJobQueue;       // Idle job objects which are waiting to be reused.  Only the worker thread
+                                          // pushes to it, without locking.
+    Util::Mutex     m_idleJobMutex;       // Serializes application threads popping from m_idleJobQueue.
+    JobQueue        m_activeJobQueue;     // Passes jobs from application threads to the worker thread, which blocks
+                                          // on it while it is empty.
     Util::Semaphore m_workerThreadNotify; // Signaled when the worker thread completes a Notify job.
     Util::Thread    m_workerThread;       // The driver thread that executes presents later on.
     volatile bool   m_workerActive;       // If the driver thread has been created.
@@ -40,6 +40,7 @@
 #include "core/hw/gfxip/gfxCmdBuffer.h"
 #include "core/hw/gfxip/rpm/rsrcProcMgr.h"
 #include "core/hw/gfxip/pipeline.h"
+#include "palCpuProfiler.h"
 #include "palDequeImpl.h"
 #include "palSysUtil.h"
 #include "palAutoBuffer.h"
@@ -245,10 +246,16 @@ Queue::Queue(
     m_pWaitingSemaphore(nullptr),
     m_batchedSubmissionCount(0),
     m_batchedCmds(pDevice->GetPlatform()),
+    m_asyncSubmit(false),
+    m_asyncSubmitExit(false),
+    m_asyncReleased(false),
+    m_asyncSubmitResult(Result::Success),
     m_deviceMembershipNode(this),
     m_lastFrameCnt(0),
     m_submitIdPerFrame(0)
 {
+    memset(&m_submitStats, 0, sizeof(m_submitStats));
+
     if (m_pDevice->Settings().ifhGpuMask & (0x1 << m_pDevice->ChipProperties().gpuIndex))
     {
         m_ifhMode = m_pDevice->GetIfhMode();
@@ -269,6 +276,9 @@ Queue::~Queue()
 // queues' virtual functions.
 void Queue::Destroy()
 {
+    // The worker thread drains every batched command it can before it exits, so stop it before anything else.
+    StopAsyncSubmitThread();
+
     // NOTE: If there are still outstanding batched commands for this Queue, something has gone very wrong!
     PAL_ASSERT(m_batchedCmds.NumElements() == 0);
 
@@ -406,6 +416,11 @@ Result Queue::Init(
         result = m_batchedCmdsLock.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_submitStatsLock.Init();
+    }
+
     if (result == Result::Success)
     {
         GfxDevice*  pGfxDevice = m_pDevice->GetGfxDevice();
@@ -520,6 +535,16 @@ Result Queue::Init(
         }
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626
+    // Timer queues only execute delays, which are cheap enough to never need the asynchronous submission worker.
+    if ((result == Result::Success)                        &&
+        (m_pQueueInfos[0].createInfo.asyncSubmission != 0) &&
+        (Type() != QueueTypeTimer))
+    {
+        result = StartAsyncSubmitThread();
+    }
+#endif
+
     return result;
 }
 
@@ -559,9 +584,14 @@ Result Queue::SubmitInternal(
     const MultiSubmitInfo& submitInfo,
     bool                   postBatching)
 {
-    Result result = Result::Success;
+    PAL_CPU_ZONE("Queue::Submit");
+
+    const int64 startTime = GetPerfCpuTime();
+
+    // Report any error the asynchronous submission worker hit while executing earlier commands.
+    Result result = AsyncSubmitResult();
 
-    if (submitInfo.pPerSubQueueInfo == nullptr)
+    if ((result == Result::Success) && (submitInfo.pPerSubQueueInfo == nullptr))
     {
         PAL_ASSERT(submitInfo.perSubQueueInfoCount == 0);
         result = Result::ErrorInvalidPointer;
@@ -685,8 +715,9 @@ Result Queue::SubmitInternal(
 #endif
 
             // Either execute the submission immediately, or enqueue it for later, depending on whether or not we are
-            // stalled and/or the caller is a function after the batching logic and thus must execute immediately.
-            if (postBatching || (m_stalled == false))
+            // stalled or using the asynchronous submission worker and/or the caller is a function after the batching
+            // logic and thus must execute immediately.
+            if (postBatching || (ShouldBatchCmds() == false))
             {
                 result = OsSubmit(submitInfo, &internalSubmitInfos[0]);
             }
@@ -705,6 +736,17 @@ Result Queue::SubmitInternal(
         }
     }
 
+    // Post-batching submissions are issued internally while executing some other queue command, so skip them.
+    if ((result == Result::Success) && (postBatching == false))
+    {
+        const uint64 callerTime = static_cast<uint64>(GetPerfCpuTime() - startTime);
+
+        MutexAuto lock(&m_submitStatsLock);
+        m_submitStats.submitCount++;
+        m_submitStats.callerTimeTotal += callerTime;
+        m_submitStats.callerTimeMax    = Max(m_submitStats.callerTimeMax, callerTime);
+    }
+
     return result;
 }
 
@@ -1143,7 +1185,15 @@ Result Queue::WaitIdle()
 
     // When we get here, all batched operations (if there were any) have been processed, so wait for the OS-specific
     // Queue to become idle.
-    return OsWaitIdle();
+    result = OsWaitIdle();
+
+    if (result == Result::Success)
+    {
+        // Report any error the asynchronous submission worker hit while executing earlier commands.
+        result = AsyncSubmitResult();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -1161,7 +1211,7 @@ Result Queue::SignalQueueSemaphoreInternal(
 
     // Either signal the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (ShouldBatchCmds() == false))
     {
         // The Semaphore object is responsible for notifying any stalled Queues which may get released by this signal
         // operation.
@@ -1173,14 +1223,14 @@ Result Queue::SignalQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCmds())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::SignalSemaphore;
             cmdData.semaphore.pSemaphore = pQueueSemaphore;
             cmdData.semaphore.value      = value;
 
-            result = m_batchedCmds.PushBack(cmdData);
+            result = PushBatchedCmd(&cmdData);
         }
         else
         {
@@ -1207,7 +1257,7 @@ Result Queue::WaitQueueSemaphoreInternal(
 
     // Either wait on the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (ShouldBatchCmds() == false))
     {
         // If this Queue isn't stalled yet, we can execute the wait immediately (which, of course, could stall
         // this Queue).
@@ -1219,14 +1269,14 @@ Result Queue::WaitQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCmds())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::WaitSemaphore;
             cmdData.semaphore.pSemaphore = pQueueSemaphore;
             cmdData.semaphore.value      = value;
 
-            result = m_batchedCmds.PushBack(cmdData);
+            result = PushBatchedCmd(&cmdData);
         }
         else
         {
@@ -1266,7 +1316,7 @@ Result Queue::PresentDirectInternal(
         {
             // Either execute the present immediately, or enqueue it for later, depending on whether or not we are
             // stalled.
-            if (m_stalled == false)
+            if (ShouldBatchCmds() == false)
             {
                 result = OsPresentDirect(presentInfo);
             }
@@ -1276,13 +1326,13 @@ Result Queue::PresentDirectInternal(
                 // this path didn't take the lock beforehand, so its possible that another thread released this Queue
                 // from the stalled state before we were able to get into this method.
                 MutexAuto lock(&m_batchedCmdsLock);
-                if (m_stalled)
+                if (ShouldBatchCmds())
                 {
                     BatchedQueueCmdData cmdData = {};
                     cmdData.command             = BatchedQueueCmd::PresentDirect;
                     cmdData.presentDirect.info  = presentInfo;
 
-                    result = m_batchedCmds.PushBack(cmdData);
+                    result = PushBatchedCmd(&cmdData);
                 }
                 else
                 {
@@ -1358,7 +1408,7 @@ Result Queue::Delay(
     if (Type() == QueueTypeTimer)
     {
         // Either execute the delay immediately, or enqueue it for later, depending on whether or not we are stalled.
-        if (m_stalled == false)
+        if (ShouldBatchCmds() == false)
         {
             result = OsDelay(delay, nullptr);
         }
@@ -1368,13 +1418,13 @@ Result Queue::Delay(
             // this path didn't take the lock beforehand, so its possible that another thread released this Queue
             // from the stalled state before we were able to get into this method.
             MutexAuto lock(&m_batchedCmdsLock);
-            if (m_stalled)
+            if (ShouldBatchCmds())
             {
                 BatchedQueueCmdData cmdData = { };
                 cmdData.command    = BatchedQueueCmd::Delay;
                 cmdData.delay.time = delay;
 
-                result = m_batchedCmds.PushBack(cmdData);
+                result = PushBatchedCmd(&cmdData);
             }
             else
             {
@@ -1435,7 +1485,7 @@ Result Queue::CopyVirtualMemoryPageMappings(
     Result result = Result::ErrorUnavailable;
 
     // Either execute the delay immediately, or enqueue it for later, depending on whether or not we are stalled.
-    if (m_stalled == false)
+    if (ShouldBatchCmds() == false)
     {
         result = OsCopyVirtualMemoryPageMappings(rangeCount, pRanges, doNotWait);
     }
@@ -1445,7 +1495,7 @@ Result Queue::CopyVirtualMemoryPageMappings(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCmds())
         {
             BatchedQueueCmdData cmdData = { };
             cmdData.command    = BatchedQueueCmd::CopyVirtualMemoryPageMappings;
@@ -1467,7 +1517,7 @@ Result Queue::CopyVirtualMemoryPageMappings(
             }
             if (result != Result::ErrorOutOfMemory)
             {
-                result = m_batchedCmds.PushBack(cmdData);
+                result = PushBatchedCmd(&cmdData);
             }
         }
         else
@@ -1491,7 +1541,7 @@ Result Queue::RemapVirtualMemoryPages(
     Result result = Result::ErrorUnavailable;
 
     // Either execute the delay immediately, or enqueue it for later, depending on whether or not we are stalled.
-    if (m_stalled == false)
+    if (ShouldBatchCmds() == false)
     {
         result = OsRemapVirtualMemoryPages(rangeCount, pRanges, doNotWait, pFence);
     }
@@ -1501,7 +1551,7 @@ Result Queue::RemapVirtualMemoryPages(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCmds())
         {
             BatchedQueueCmdData cmdData = { };
             cmdData.command    = BatchedQueueCmd::RemapVirtualMemoryPages;
@@ -1523,7 +1573,7 @@ Result Queue::RemapVirtualMemoryPages(
             }
             if (result != Result::ErrorOutOfMemory)
             {
-                result = m_batchedCmds.PushBack(cmdData);
+                result = PushBatchedCmd(&cmdData);
             }
         }
         else
@@ -1551,7 +1601,7 @@ Result Queue::AssociateFenceWithLastSubmit(
         pCoreFence->AssociateWithContext(m_pSubmissionContext);
 
         // Either associate the fence timestamp immediately or later, depending on whether or not we are stalled.
-        if (m_stalled == false)
+        if (ShouldBatchCmds() == false)
         {
             result = DoAssociateFenceWithLastSubmit(pCoreFence);
         }
@@ -1562,13 +1612,13 @@ Result Queue::AssociateFenceWithLastSubmit(
             // from the stalled state before we were able to get into this method.
             MutexAuto lock(&m_batchedCmdsLock);
 
-            if (m_stalled)
+            if (ShouldBatchCmds())
             {
                 BatchedQueueCmdData cmdData = { };
                 cmdData.command               = BatchedQueueCmd::AssociateFenceWithLastSubmit;
                 cmdData.associateFence.pFence = pCoreFence;
 
-                result = m_batchedCmds.PushBack(cmdData);
+                result = PushBatchedCmd(&cmdData);
             }
             else
             {
@@ -1655,79 +1705,360 @@ Result Queue::ReleaseFromStalledState()
 {
     Result result = Result::Success;
 
-    bool stalledAgain = false; // It is possible for one of the batched-up commands to be a Semaphore wait which
-                               // may cause this Queue to become stalled once more.
+    if (m_asyncSubmit)
+    {
+        // Only the worker thread may execute batched commands, otherwise they could run out of order. Just wake it up.
+        // The worker may still be inside the Semaphore wait which stalled us, so leave it a note that the stall is
+        // already over.
+        MutexAuto lock(&m_batchedCmdsLock);
 
-    MutexAuto lock(&m_batchedCmdsLock);
+        m_stalled       = false;
+        m_asyncReleased = true;
+        m_asyncSubmitNotify.Post();
+    }
+    else
+    {
+        bool stalledAgain = false; // It is possible for one of the batched-up commands to be a Semaphore wait which
+                                   // may cause this Queue to become stalled once more.
+
+        MutexAuto lock(&m_batchedCmdsLock);
+
+        // Execute all of the batched-up commands as long as we don't become stalled again and don't encounter an
+        // error.
+        while ((m_batchedCmds.NumElements() > 0) && (stalledAgain == false) && (result == Result::Success))
+        {
+            BatchedQueueCmdData cmdData = { };
+
+            result = m_batchedCmds.PopFront(&cmdData);
+            PAL_ASSERT(result == Result::Success);
+
+            result = ExecuteBatchedCmd(&cmdData, &stalledAgain);
+        }
+
+        // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
+        // one of the batched-up commands caused this Queue to become stalled again.
+        m_stalled = stalledAgain;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Executes a single batched-up command and frees any memory it owns. If the command is a Semaphore wait, pIsStalled
+// reports whether it blocked this Queue.
+Result Queue::ExecuteBatchedCmd(
+    BatchedQueueCmdData* pCmdData,
+    volatile bool*       pIsStalled)
+{
+    Result result = Result::Success;
 
-    // Execute all of the batched-up commands as long as we don't become stalled again and don't encounter an error.
-    while ((m_batchedCmds.NumElements() > 0) && (stalledAgain == false) && (result == Result::Success))
+    switch (pCmdData->command)
     {
-        BatchedQueueCmdData cmdData = { };
+    case BatchedQueueCmd::Submit:
+    {
+        const int64 startTime = GetPerfCpuTime();
+
+        result = OsSubmit(pCmdData->submit.submitInfo, pCmdData->submit.pInternalSubmitInfo);
 
-        result = m_batchedCmds.PopFront(&cmdData);
-        PAL_ASSERT(result == Result::Success);
+        const int64  endTime      = GetPerfCpuTime();
+        const uint64 queuedTime   = static_cast<uint64>(startTime - pCmdData->enqueueTime);
+        const uint64 osSubmitTime = static_cast<uint64>(endTime - startTime);
 
-        switch (cmdData.command)
         {
-        case BatchedQueueCmd::Submit:
-            result = OsSubmit(cmdData.submit.submitInfo, cmdData.submit.pInternalSubmitInfo);
+            MutexAuto lock(&m_submitStatsLock);
+            m_submitStats.deferredSubmitCount++;
+            m_submitStats.queuedTimeTotal   += queuedTime;
+            m_submitStats.queuedTimeMax      = Max(m_submitStats.queuedTimeMax, queuedTime);
+            m_submitStats.osSubmitTimeTotal += osSubmitTime;
+            m_submitStats.osSubmitTimeMax    = Max(m_submitStats.osSubmitTimeMax, osSubmitTime);
+        }
 
-            // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
-            // in the same memory allocation which was saved in pDynamicMem for convenience.
-            PAL_SAFE_FREE(cmdData.submit.pDynamicMem, m_pDevice->GetPlatform());
+        // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
+        // in the same memory allocation which was saved in pDynamicMem for convenience.
+        PAL_SAFE_FREE(pCmdData->submit.pDynamicMem, m_pDevice->GetPlatform());
 
-            // Decrement this count to permit WaitIdle to query the status of the queue's submissions.
-            PAL_ASSERT(m_batchedSubmissionCount > 0);
-            AtomicDecrement(&m_batchedSubmissionCount);
-            break;
+        // Decrement this count to permit WaitIdle to query the status of the queue's submissions.
+        PAL_ASSERT(m_batchedSubmissionCount > 0);
+        AtomicDecrement(&m_batchedSubmissionCount);
+        break;
+    }
 
-        case BatchedQueueCmd::SignalSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Signal(this, cmdData.semaphore.value);
-            break;
+    case BatchedQueueCmd::SignalSemaphore:
+        result = static_cast<QueueSemaphore*>(pCmdData->semaphore.pSemaphore)->Signal(this, pCmdData->semaphore.value);
+        break;
 
-        case BatchedQueueCmd::WaitSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Wait(this, cmdData.semaphore.value,
-                                                                                      &stalledAgain);
-            break;
+    case BatchedQueueCmd::WaitSemaphore:
+        result = static_cast<QueueSemaphore*>(pCmdData->semaphore.pSemaphore)->Wait(this,
+                                                                                    pCmdData->semaphore.value,
+                                                                                    pIsStalled);
+        break;
 
-        case BatchedQueueCmd::PresentDirect:
-            result = OsPresentDirect(cmdData.presentDirect.info);
-            break;
+    case BatchedQueueCmd::PresentDirect:
+        result = OsPresentDirect(pCmdData->presentDirect.info);
+        break;
 
-        case BatchedQueueCmd::Delay:
-            PAL_ASSERT(Type() == QueueTypeTimer);
-            result = OsDelay(cmdData.delay.time, nullptr);
-            break;
+    case BatchedQueueCmd::Delay:
+        PAL_ASSERT(Type() == QueueTypeTimer);
+        result = OsDelay(pCmdData->delay.time, nullptr);
+        break;
 
-        case BatchedQueueCmd::RemapVirtualMemoryPages:
-            result = OsRemapVirtualMemoryPages(cmdData.remapVirtualMemoryPages.rangeCount,
-                                               cmdData.remapVirtualMemoryPages.pRanges,
-                                               cmdData.remapVirtualMemoryPages.doNotWait,
-                                               cmdData.remapVirtualMemoryPages.pFence);
-            PAL_SAFE_DELETE_ARRAY(cmdData.remapVirtualMemoryPages.pRanges, m_pDevice->GetPlatform());
-            break;
+    case BatchedQueueCmd::RemapVirtualMemoryPages:
+        result = OsRemapVirtualMemoryPages(pCmdData->remapVirtualMemoryPages.rangeCount,
+                                           pCmdData->remapVirtualMemoryPages.pRanges,
+                                           pCmdData->remapVirtualMemoryPages.doNotWait,
+                                           pCmdData->remapVirtualMemoryPages.pFence);
+        PAL_SAFE_DELETE_ARRAY(pCmdData->remapVirtualMemoryPages.pRanges, m_pDevice->GetPlatform());
+        break;
 
-        case BatchedQueueCmd::CopyVirtualMemoryPageMappings:
-            result = OsCopyVirtualMemoryPageMappings(cmdData.copyVirtualMemoryPageMappings.rangeCount,
-                                               cmdData.copyVirtualMemoryPageMappings.pRanges,
-                                               cmdData.copyVirtualMemoryPageMappings.doNotWait);
-            PAL_SAFE_DELETE_ARRAY(cmdData.copyVirtualMemoryPageMappings.pRanges, m_pDevice->GetPlatform());
-            break;
+    case BatchedQueueCmd::CopyVirtualMemoryPageMappings:
+        result = OsCopyVirtualMemoryPageMappings(pCmdData->copyVirtualMemoryPageMappings.rangeCount,
+                                                 pCmdData->copyVirtualMemoryPageMappings.pRanges,
+                                                 pCmdData->copyVirtualMemoryPageMappings.doNotWait);
+        PAL_SAFE_DELETE_ARRAY(pCmdData->copyVirtualMemoryPageMappings.pRanges, m_pDevice->GetPlatform());
+        break;
 
-        case BatchedQueueCmd::AssociateFenceWithLastSubmit:
-            result = DoAssociateFenceWithLastSubmit(cmdData.associateFence.pFence);
-            break;
+    case BatchedQueueCmd::AssociateFenceWithLastSubmit:
+        result = DoAssociateFenceWithLastSubmit(pCmdData->associateFence.pFence);
+        break;
+
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees the memory owned by a batched-up command which will never be executed.
+void Queue::DiscardBatchedCmd(
+    BatchedQueueCmdData* pCmdData)
+{
+    switch (pCmdData->command)
+    {
+    case BatchedQueueCmd::Submit:
+        PAL_SAFE_FREE(pCmdData->submit.pDynamicMem, m_pDevice->GetPlatform());
+
+        PAL_ASSERT(m_batchedSubmissionCount > 0);
+        AtomicDecrement(&m_batchedSubmissionCount);
+        break;
+
+    case BatchedQueueCmd::RemapVirtualMemoryPages:
+        PAL_SAFE_DELETE_ARRAY(pCmdData->remapVirtualMemoryPages.pRanges, m_pDevice->GetPlatform());
+        break;
 
+    case BatchedQueueCmd::CopyVirtualMemoryPageMappings:
+        PAL_SAFE_DELETE_ARRAY(pCmdData->copyVirtualMemoryPageMappings.pRanges, m_pDevice->GetPlatform());
+        break;
+
+    default:
+        break;
+    }
+}
+
+// =====================================================================================================================
+// Appends a command to the batched-up command list. When asynchronous submission is enabled this also wakes the worker
+// thread so that it can execute the command. The caller must hold m_batchedCmdsLock.
+Result Queue::PushBatchedCmd(
+    BatchedQueueCmdData* pCmdData)
+{
+    pCmdData->enqueueTime = GetPerfCpuTime();
+
+    const Result result = m_batchedCmds.PushBack(*pCmdData);
+
+    if (result == Result::Success)
+    {
+        const uint32 numPending = static_cast<uint32>(m_batchedCmds.NumElements());
+
+        {
+            MutexAuto lock(&m_submitStatsLock);
+            m_submitStats.maxPendingCmds = Max(m_submitStats.maxPendingCmds, numPending);
+        }
+
+        if (m_asyncSubmit)
+        {
+            m_asyncSubmitNotify.Post();
         }
     }
 
-    // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
-    // one of the batched-up commands caused this Queue to become stalled again.
-    m_stalled = stalledAgain;
+    return result;
+}
+
+// =====================================================================================================================
+// Callback for executing a queue's asynchronous submission worker thread.
+static void AsyncSubmitThreadCallback(
+    void* pParameter)   // Opaque pointer to a Queue object
+{
+    static_cast<Queue*>(pParameter)->RunAsyncSubmitThread();
+}
+
+// =====================================================================================================================
+// Launches the worker thread which executes this Queue's commands when asynchronous submission is enabled. From this
+// point on all batchable commands are batched-up and only the worker thread executes them.
+Result Queue::StartAsyncSubmitThread()
+{
+    Result result = m_asyncSubmitNotify.Init(Semaphore::MaximumCountLimit, 0);
+
+    if (result == Result::Success)
+    {
+        result = m_asyncSubmitThread.Begin(&AsyncSubmitThreadCallback, this);
+    }
+
+    if (result == Result::Success)
+    {
+        m_asyncSubmit = true;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Terminates the asynchronous submission worker thread, if it was started. The worker executes all commands it can
+// before it exits; any which are left because this Queue is still stalled on a Semaphore are discarded.
+void Queue::StopAsyncSubmitThread()
+{
+    if (m_asyncSubmitThread.IsCreated())
+    {
+        PAL_ASSERT(m_asyncSubmitThread.IsNotCurrentThread());
+
+        {
+            MutexAuto lock(&m_batchedCmdsLock);
+            m_asyncSubmitExit = true;
+        }
+
+        m_asyncSubmitNotify.Post();
+        m_asyncSubmitThread.Join();
+
+        MutexAuto lock(&m_batchedCmdsLock);
+
+        // The client destroyed this Queue while it was waiting on a Semaphore which was never signaled.
+        PAL_ALERT(m_batchedCmds.NumElements() > 0);
+
+        while (m_batchedCmds.NumElements() > 0)
+        {
+            BatchedQueueCmdData cmdData = { };
+
+            const Result popResult = m_batchedCmds.PopFront(&cmdData);
+            PAL_ASSERT(popResult == Result::Success);
+
+            DiscardBatchedCmd(&cmdData);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Executes the worker thread which drains this Queue's batched-up commands when asynchronous submission is enabled.
+void Queue::RunAsyncSubmitThread()
+{
+    bool exit = false;
+
+    while (exit == false)
+    {
+        // Sleep until a command is batched-up, this Queue is released from a stall, or we're told to terminate.
+        const Result waitResult = m_asyncSubmitNotify.Wait(UINT32_MAX);
+        PAL_ASSERT(IsErrorResult(waitResult) == false);
+
+        DrainAsyncCmds();
+
+        MutexAuto lock(&m_batchedCmdsLock);
+        exit = m_asyncSubmitExit;
+    }
+}
+
+// =====================================================================================================================
+// Executes batched-up commands in order until the list is empty or one of them stalls this Queue on a Semaphore. Only
+// the worker thread calls this, so the lock is held just long enough to pop each command and record whether it stalled
+// the Queue; the client threads can keep batching-up new commands while the OS executes the current one.
+void Queue::DrainAsyncCmds()
+{
+    PAL_CPU_ZONE("Queue::DrainAsyncCmds");
+
+    bool done = false;
+
+    while (done == false)
+    {
+        BatchedQueueCmdData cmdData = { };
+
+        {
+            MutexAuto lock(&m_batchedCmdsLock);
+
+            done = (m_stalled || (m_batchedCmds.NumElements() == 0));
+
+            if (done == false)
+            {
+                const Result popResult = m_batchedCmds.PopFront(&cmdData);
+                PAL_ASSERT(popResult == Result::Success);
+
+                m_asyncReleased = false;
+            }
+        }
+
+        if (done == false)
+        {
+            // A Semaphore wait reports the stall while holding the Semaphore's lock, so a Signal on another thread may
+            // release this Queue before we get to record the stall below; m_asyncReleased catches that case.
+            volatile bool stalled = false;
+            const Result  result  = ExecuteBatchedCmd(&cmdData, &stalled);
+
+            {
+                MutexAuto lock(&m_batchedCmdsLock);
+                m_stalled = (stalled && (m_asyncReleased == false));
+            }
+
+            // There's no caller to return an error to, so keep the first one for later Submit and WaitIdle calls. We
+            // keep draining so that WaitIdle can't hang on submissions left in the list.
+            if (result != Result::Success)
+            {
+                MutexAuto lock(&m_submitStatsLock);
+
+                if (m_asyncSubmitResult == Result::Success)
+                {
+                    m_asyncSubmitResult = result;
+                }
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns the first error the asynchronous submission worker hit, if any.
+Result Queue::AsyncSubmitResult()
+{
+    Result result = Result::Success;
+
+    if (m_asyncSubmit)
+    {
+        MutexAuto lock(&m_submitStatsLock);
+        result = m_asyncSubmitResult;
+    }
+
+    return result;
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626
+// =====================================================================================================================
+// Reports the submission latency statistics gathered by this Queue.
+// NOTE: Part of the public IQueue interface.
+Result Queue::QuerySubmitStats(
+    QueueSubmitStats* pStats)
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if (pStats != nullptr)
+    {
+        uint32 numPending = 0;
+        {
+            MutexAuto lock(&m_batchedCmdsLock);
+            numPending = static_cast<uint32>(m_batchedCmds.NumElements());
+        }
+
+        MutexAuto lock(&m_submitStatsLock);
+        (*pStats)           = m_submitStats;
+        pStats->pendingCmds = numPending;
+
+        result = Result::Success;
+    }
 
     return result;
 }
+#endif
 
 // =====================================================================================================================
 // Validates that the inputs to a Submit() call are legal according to the conditions defined in palQueue.h.
@@ -1865,7 +2196,7 @@ Result Queue::EnqueueSubmit(
     // didn't take the lock beforehand, so its possible that another thread released this Queue from the stalled state
     // before we were able to get into this method.
     MutexAuto lock(&m_batchedCmdsLock);
-    if (m_stalled)
+    if (ShouldBatchCmds())
     {
         BatchedQueueCmdData cmdData;
         cmdData.command                    = BatchedQueueCmd::Submit;
@@ -2023,7 +2354,7 @@ Result Queue::EnqueueSubmit(
 
         if (result == Result::Success)
         {
-            result = m_batchedCmds.PushBack(cmdData);
+            result = PushBatchedCmd(&cmdData);
 
             if (result == Result::Success)
             {
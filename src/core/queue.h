@@ -30,6 +30,8 @@
 #include "palDeque.h"
 #include "palIntrusiveList.h"
 #include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -100,7 +102,8 @@ struct InternalSubmitInfo
     IQueueSemaphore**       ppWaitSemaphores;     // Array of semaphores that have to wait after the submission.
 };
 
-// Enumerates the types of Queue commands which could be batched-up if the Queue is stalled on a Semaphore.
+// Enumerates the types of Queue commands which could be batched-up if the Queue is stalled on a Semaphore or uses
+// asynchronous submission.
 enum class BatchedQueueCmd : uint32
 {
     Submit = 0,                   // Identifies a Submit() call
@@ -117,6 +120,7 @@ enum class BatchedQueueCmd : uint32
 struct BatchedQueueCmdData
 {
     BatchedQueueCmd command;
+    int64           enqueueTime; // CPU timestamp of when the command was batched-up.
 
     union
     {
@@ -291,6 +295,11 @@ public:
     virtual Result QueryKernelContextInfo(KernelContextInfo* pKernelContextInfo) const override
         { return Result::ErrorUnavailable; }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 626
+    // NOTE: Part of the public IQueue interface.
+    virtual Result QuerySubmitStats(QueueSubmitStats* pStats) override;
+#endif
+
     // NOTE: Part of the public IDestroyable interface.
     virtual void Destroy() override;
 
@@ -322,6 +331,11 @@ public:
 
     bool IsStalled() const { return m_stalled; }
 
+    bool UsesAsyncSubmission() const { return m_asyncSubmit; }
+
+    // Must be declared public but meant for internal use only.
+    void RunAsyncSubmitThread();
+
     void IncFrameCount();
 
     static bool SupportsComputeShader(QueueType queueType)
@@ -400,6 +414,27 @@ private:
         const MultiSubmitInfo&    submitInfo,
         const InternalSubmitInfo* pInternalSubmitInfo);
 
+    // Queue commands must be batched-up instead of executed on the calling thread while this Queue is stalled on a
+    // Semaphore, and always when the asynchronous submission worker owns execution. Callers must re-check this after
+    // taking m_batchedCmdsLock.
+    bool ShouldBatchCmds() const { return (m_stalled || m_asyncSubmit); }
+
+    // Appends a command to m_batchedCmds and wakes the asynchronous submission worker. The caller must hold
+    // m_batchedCmdsLock.
+    Result PushBatchedCmd(BatchedQueueCmdData* pCmdData);
+
+    Result ExecuteBatchedCmd(
+        BatchedQueueCmdData* pCmdData,
+        volatile bool*       pIsStalled);
+
+    // Frees the memory owned by a batched-up command which will never be executed.
+    void DiscardBatchedCmd(BatchedQueueCmdData* pCmdData);
+
+    Result StartAsyncSubmitThread();
+    void   StopAsyncSubmitThread();
+    void   DrainAsyncCmds();
+    Result AsyncSubmitResult();
+
     Result WaitQueueSemaphoreNoChecks(
         IQueueSemaphore* pQueueSemaphore,
         volatile bool*   pIsStalled);
@@ -439,6 +474,22 @@ private:
     Util::Deque<BatchedQueueCmdData, Platform>  m_batchedCmds;
     Util::Mutex                                 m_batchedCmdsLock;
 
+    // When asynchronous submission is enabled every batchable command goes through m_batchedCmds and the worker thread
+    // is the only thread which executes them, which preserves their submission order. Fences of submissions which the
+    // worker hasn't executed yet are still batched; the OS layer's fence waits must block until the worker gets there.
+    // While it is enabled m_stalled and the two flags below are only accessed while holding m_batchedCmdsLock.
+    bool                m_asyncSubmit;
+    Util::Thread        m_asyncSubmitThread;
+    Util::Semaphore     m_asyncSubmitNotify;  // Posted when a command is batched-up or the Queue becomes unstalled.
+    bool                m_asyncSubmitExit;    // Tells the worker thread to terminate once it has drained its commands.
+    bool                m_asyncReleased;      // Set if the Queue was released from a stall while the worker was
+                                              // executing the Semaphore wait which caused it.
+    Result              m_asyncSubmitResult;  // First error returned by a command executed on the worker thread.
+                                              // Protected by m_submitStatsLock.
+
+    QueueSubmitStats    m_submitStats;
+    Util::Mutex         m_submitStatsLock;
+
     // Each queue must register itself with its device and engine so that they can manage their internal lists.
     Util::IntrusiveListNode<Queue>              m_deviceMembershipNode;
 
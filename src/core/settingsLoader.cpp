@@ -190,6 +190,10 @@ void SettingsLoader::ValidateSettings()
             sizeof(pPlatformSettings->eventLogDirectory),
             "%s/%s", pRootPath, subDir);
 
+        Strncpy(subDir, pPlatformSettings->cpuZoneTraceDirectory, sizeof(subDir));
+        Snprintf(pPlatformSettings->cpuZoneTraceDirectory,
+                 sizeof(pPlatformSettings->cpuZoneTraceDirectory),
+                 "%s/%s", pRootPath, subDir);
     }
 
     m_state = SettingsLoaderState::Final;
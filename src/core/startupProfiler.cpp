@@ -0,0 +1,254 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/platform.h"
+#include "core/startupProfiler.h"
+#include "palFile.h"
+#include "palJsonWriter.h"
+#include "palSysUtil.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+// A JsonStream which writes to a file through a small staging buffer.
+class StartupJsonStream : public JsonStream
+{
+public:
+    StartupJsonStream() : m_bufferUsed(0), m_result(Result::Success) { }
+    virtual ~StartupJsonStream() { }
+
+    Result Open(const char* pFilePath) { return m_file.Open(pFilePath, FileAccessWrite); }
+
+    Result Close()
+    {
+        Flush();
+        m_file.Close();
+        return m_result;
+    }
+
+    virtual void WriteString(const char* pString, uint32 length) override
+    {
+        for (uint32 i = 0; i < length; ++i)
+        {
+            WriteCharacter(pString[i]);
+        }
+    }
+
+    virtual void WriteCharacter(char character) override
+    {
+        if (m_bufferUsed == sizeof(m_buffer))
+        {
+            Flush();
+        }
+
+        m_buffer[m_bufferUsed++] = character;
+    }
+
+private:
+    void Flush()
+    {
+        if ((m_bufferUsed > 0) && (m_result == Result::Success))
+        {
+            m_result = m_file.Write(&m_buffer[0], m_bufferUsed);
+        }
+
+        m_bufferUsed = 0;
+    }
+
+    File   m_file;
+    char   m_buffer[4096];
+    uint32 m_bufferUsed;
+    Result m_result;     // The first error returned by the file, if any.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(StartupJsonStream);
+};
+
+// =====================================================================================================================
+StartupProfiler::StartupProfiler()
+    :
+    m_numPhases(0),
+    m_numDroppedPhases(0)
+{
+    memset(&m_phases[0], 0, sizeof(m_phases));
+}
+
+// =====================================================================================================================
+// Records the start of a new phase.  Returns MaxPhases if there is no room left to record it.
+uint32 StartupProfiler::BeginPhase(
+    const char* pName,
+    uint32      deviceIndex)
+{
+    MutexAuto lock(&m_lock);
+
+    uint32 phase = MaxPhases;
+
+    if (m_numPhases < MaxPhases)
+    {
+        phase = m_numPhases++;
+
+        m_phases[phase].pName       = pName;
+        m_phases[phase].deviceIndex = deviceIndex;
+        m_phases[phase].beginTime   = GetPerfCpuTime();
+        m_phases[phase].endTime     = 0;
+    }
+    else
+    {
+        m_numDroppedPhases++;
+    }
+
+    return phase;
+}
+
+// =====================================================================================================================
+void StartupProfiler::EndPhase(
+    uint32 phase)
+{
+    if (phase < MaxPhases)
+    {
+        const int64 endTime = GetPerfCpuTime();
+
+        MutexAuto lock(&m_lock);
+        m_phases[phase].endTime = endTime;
+    }
+}
+
+// =====================================================================================================================
+// Copies the recorded phases out to the caller.  If pPhases is null, only the number of phases is returned.
+Result StartupProfiler::GetPhases(
+    uint32*           pPhaseCount,
+    StartupPhaseInfo* pPhases
+    ) const
+{
+    Result result = Result::Success;
+
+    if (pPhaseCount == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
+    {
+        MutexAuto lock(&m_lock);
+
+        if (pPhases == nullptr)
+        {
+            (*pPhaseCount) = m_numPhases;
+        }
+        else
+        {
+            const uint32 count = Min(*pPhaseCount, m_numPhases);
+
+            memcpy(pPhases, &m_phases[0], count * sizeof(StartupPhaseInfo));
+
+            result         = (count < m_numPhases) ? Result::ErrorIncompleteResults : Result::Success;
+            (*pPhaseCount) = count;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes all recorded phases to a JSON file.  Times are converted to microseconds relative to the start of the first
+// phase so that the output is easy to read and to diff between runs.
+Result StartupProfiler::DumpJson(
+    const char* pFilePath
+    ) const
+{
+    Result result = Result::Success;
+
+    if (pFilePath == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
+    {
+        StartupJsonStream stream;
+        result = stream.Open(pFilePath);
+
+        if (result == Result::Success)
+        {
+            MutexAuto lock(&m_lock);
+
+            const int64 frequency = GetPerfFrequency();
+            const int64 baseTime  = (m_numPhases > 0) ? m_phases[0].beginTime : 0;
+
+            JsonWriter writer(&stream);
+            writer.BeginMap(false);
+            writer.KeyAndValue("droppedPhases", m_numDroppedPhases);
+            writer.KeyAndBeginList("phases", false);
+
+            for (uint32 i = 0; i < m_numPhases; ++i)
+            {
+                const StartupPhaseInfo& phase      = m_phases[i];
+                const int64             endTime    = (phase.endTime != 0) ? phase.endTime : phase.beginTime;
+                const uint64            startUs    = ((phase.beginTime - baseTime) * 1000000) / frequency;
+                const uint64            durationUs = ((endTime - phase.beginTime) * 1000000) / frequency;
+
+                writer.BeginMap(true);
+                writer.KeyAndValue("name", phase.pName);
+
+                if (phase.deviceIndex != StartupPhaseNoDevice)
+                {
+                    writer.KeyAndValue("device", phase.deviceIndex);
+                }
+
+                writer.KeyAndValue("startUs",    startUs);
+                writer.KeyAndValue("durationUs", durationUs);
+                writer.KeyAndValue("finished",   (phase.endTime != 0));
+                writer.EndMap();
+            }
+
+            writer.EndList();
+            writer.EndMap();
+        }
+
+        const Result closeResult = stream.Close();
+        result = (result == Result::Success) ? closeResult : result;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+StartupPhase::StartupPhase(
+    Platform*   pPlatform,
+    const char* pName,
+    uint32      deviceIndex)
+    :
+    m_pProfiler(pPlatform->GetStartupProfiler()),
+    m_phase(m_pProfiler->BeginPhase(pName, deviceIndex))
+{
+}
+
+// =====================================================================================================================
+StartupPhase::~StartupPhase()
+{
+    m_pProfiler->EndPhase(m_phase);
+}
+
+} // Pal
@@ -0,0 +1,82 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palMutex.h"
+#include "palPlatform.h"
+
+namespace Pal
+{
+
+class Platform;
+
+// =====================================================================================================================
+// Records the CPU time spent in each named phase of platform and device initialization so that slow bring-up can be
+// diagnosed in the field.  Phases are recorded in a fixed-size array in the order they begin; once it is full any
+// further phases are counted but not recorded.
+class StartupProfiler
+{
+public:
+    StartupProfiler();
+    ~StartupProfiler() { }
+
+    Result Init() { return m_lock.Init(); }
+
+    // Returns a handle which must be passed to EndPhase().  pName must point to a string which outlives the platform.
+    uint32 BeginPhase(const char* pName, uint32 deviceIndex);
+    void   EndPhase(uint32 phase);
+
+    Result GetPhases(uint32* pPhaseCount, StartupPhaseInfo* pPhases) const;
+    Result DumpJson(const char* pFilePath) const;
+
+private:
+    static constexpr uint32 MaxPhases = 128;
+
+    mutable Util::Mutex m_lock;
+    StartupPhaseInfo    m_phases[MaxPhases];
+    uint32              m_numPhases;
+    uint32              m_numDroppedPhases; // Phases which began after m_phases was full.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(StartupProfiler);
+};
+
+// =====================================================================================================================
+// Times a single startup phase for as long as it is in scope.
+class StartupPhase
+{
+public:
+    StartupPhase(Platform* pPlatform, const char* pName, uint32 deviceIndex = StartupPhaseNoDevice);
+    ~StartupPhase();
+
+private:
+    StartupProfiler*const m_pProfiler;
+    const uint32          m_phase;
+
+    PAL_DISALLOW_DEFAULT_CTOR(StartupPhase);
+    PAL_DISALLOW_COPY_AND_ASSIGN(StartupPhase);
+};
+
+} // Pal
@@ -0,0 +1,492 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palDescriptorHeap.h"
+#include "palGpuMemory.h"
+#include "palInlineFuncs.h"
+#include "palSysMemory.h"
+
+using namespace Pal;
+using namespace Util;
+
+namespace GpuUtil
+{
+
+// The free list head packs the tag into the high half and the first slot into the low half.
+static constexpr uint64 FreeHeadSlotMask = 0xFFFFFFFFull;
+static constexpr uint64 FreeHeadTagOne   = 0x100000000ull;
+
+// =====================================================================================================================
+DescriptorHeap::DescriptorHeap(
+    IPlatform* pPlatform,
+    IDevice*   pDevice)
+    :
+    m_pPlatform(pPlatform),
+    m_pDevice(pDevice),
+    m_bufferViewSize(0),
+    m_imageViewSize(0),
+    m_fmaskViewSize(0),
+    m_samplerSize(0),
+    m_numBlocks(0),
+    m_freeHead(InvalidDescriptorSlot),
+    m_deferredHead(InvalidDescriptorSlot),
+    m_numCarved(0),
+    m_numAllocated(0),
+    m_numDeferred(0)
+{
+    memset(&m_createInfo, 0, sizeof(m_createInfo));
+    memset(&m_blocks[0], 0, sizeof(m_blocks));
+}
+
+// =====================================================================================================================
+DescriptorHeap::~DescriptorHeap()
+{
+    for (uint32 idx = 0; idx < m_numBlocks; ++idx)
+    {
+        DestroyBlock(&m_blocks[idx]);
+    }
+}
+
+// =====================================================================================================================
+Result DescriptorHeap::Init(
+    const DescriptorHeapCreateInfo& createInfo)
+{
+    DeviceProperties props = {};
+    Result result = m_pDevice->GetProperties(&props);
+
+    if (result == Result::Success)
+    {
+        m_bufferViewSize = props.gfxipProperties.srdSizes.bufferView;
+        m_imageViewSize  = props.gfxipProperties.srdSizes.imageView;
+        m_fmaskViewSize  = props.gfxipProperties.srdSizes.fmaskView;
+        m_samplerSize    = props.gfxipProperties.srdSizes.sampler;
+
+        const uint32 minSrdSize = Min(Min(m_bufferViewSize, m_imageViewSize), Min(m_fmaskViewSize, m_samplerSize));
+        const uint64 numSlots   = uint64(createInfo.slotsPerBlock) * createInfo.maxBlocks;
+
+        // Every slot must start on an SRD boundary, and every slot index must be representable without colliding with
+        // InvalidDescriptorSlot.
+        if ((createInfo.slotSize == 0)                        ||
+            ((createInfo.slotSize % minSrdSize) != 0)         ||
+            (createInfo.slotsPerBlock == 0)                   ||
+            (createInfo.maxBlocks == 0)                       ||
+            (createInfo.maxBlocks > MaxBlocks)                ||
+            (numSlots >= InvalidDescriptorSlot))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        m_createInfo = createInfo;
+        result       = m_blockLock.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result DescriptorHeap::Allocate(
+    DescriptorSlot* pSlot)
+{
+    PAL_ASSERT(pSlot != nullptr);
+
+    DescriptorSlot slot   = PopFreeSlot();
+    Result         result = Result::Success;
+
+    if (slot == InvalidDescriptorSlot)
+    {
+        result = CarveSlot(&slot);
+    }
+
+    if (result == Result::Success)
+    {
+        AtomicIncrement(&m_numAllocated);
+    }
+
+    *pSlot = slot;
+
+    return result;
+}
+
+// =====================================================================================================================
+void DescriptorHeap::Free(
+    DescriptorSlot slot)
+{
+    PAL_ASSERT(slot < m_numCarved);
+
+    AtomicDecrement(&m_numAllocated);
+
+    PushFreeSlots(slot, slot);
+}
+
+// =====================================================================================================================
+void DescriptorHeap::FreeDeferred(
+    DescriptorSlot slot,
+    uint64         retireValue)
+{
+    PAL_ASSERT(slot < m_numCarved);
+
+    AtomicDecrement(&m_numAllocated);
+    AtomicIncrement(&m_numDeferred);
+
+    const Block& block = m_blocks[slot / m_createInfo.slotsPerBlock];
+    block.pRetireValues[slot % m_createInfo.slotsPerBlock] = retireValue;
+
+    PushDeferredSlots(slot, slot);
+}
+
+// =====================================================================================================================
+uint32 DescriptorHeap::RetireDeferredFrees(
+    uint64 completedValue)
+{
+    // Take the whole deferred list. Other threads can keep deferring slots onto the now empty list while we sort it.
+    DescriptorSlot slot = AtomicExchange(&m_deferredHead, InvalidDescriptorSlot);
+
+    DescriptorSlot retiredFirst = InvalidDescriptorSlot;
+    DescriptorSlot retiredLast  = InvalidDescriptorSlot;
+    DescriptorSlot pendingFirst = InvalidDescriptorSlot;
+    DescriptorSlot pendingLast  = InvalidDescriptorSlot;
+    uint32         numRetired   = 0;
+
+    while (slot != InvalidDescriptorSlot)
+    {
+        volatile uint32&     next     = NextLink(slot);
+        const DescriptorSlot nextSlot = next;
+        const Block&         block    = m_blocks[slot / m_createInfo.slotsPerBlock];
+
+        if (block.pRetireValues[slot % m_createInfo.slotsPerBlock] <= completedValue)
+        {
+            next         = retiredFirst;
+            retiredFirst = slot;
+            retiredLast  = (retiredLast == InvalidDescriptorSlot) ? slot : retiredLast;
+            numRetired++;
+        }
+        else
+        {
+            next         = pendingFirst;
+            pendingFirst = slot;
+            pendingLast  = (pendingLast == InvalidDescriptorSlot) ? slot : pendingLast;
+        }
+
+        slot = nextSlot;
+    }
+
+    if (retiredFirst != InvalidDescriptorSlot)
+    {
+        AtomicAdd(&m_numDeferred, 0u - numRetired);
+        PushFreeSlots(retiredFirst, retiredLast);
+    }
+
+    if (pendingFirst != InvalidDescriptorSlot)
+    {
+        PushDeferredSlots(pendingFirst, pendingLast);
+    }
+
+    return numRetired;
+}
+
+// =====================================================================================================================
+void* DescriptorHeap::CpuAddress(
+    DescriptorSlot slot
+    ) const
+{
+    PAL_ASSERT(slot < m_numCarved);
+
+    const Block& block = m_blocks[slot / m_createInfo.slotsPerBlock];
+
+    return VoidPtrInc(block.pCpuAddr, size_t(slot % m_createInfo.slotsPerBlock) * m_createInfo.slotSize);
+}
+
+// =====================================================================================================================
+gpusize DescriptorHeap::GpuAddress(
+    DescriptorSlot slot
+    ) const
+{
+    PAL_ASSERT(slot < m_numCarved);
+
+    const Block& block = m_blocks[slot / m_createInfo.slotsPerBlock];
+
+    return block.gpuVirtAddr + (gpusize(slot % m_createInfo.slotsPerBlock) * m_createInfo.slotSize);
+}
+
+// =====================================================================================================================
+void DescriptorHeap::QueryStats(
+    DescriptorHeapStats* pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+
+    pStats->numBlocks         = m_numBlocks;
+    pStats->numSlotsAllocated = m_numAllocated;
+    pStats->numSlotsDeferred  = m_numDeferred;
+    pStats->numSlotsCarved    = m_numCarved;
+}
+
+// =====================================================================================================================
+// Returns the address of the first of count SRDs of the given size written at the given offset into a slot.
+void* DescriptorHeap::SrdAddress(
+    DescriptorSlot slot,
+    uint32         offset,
+    uint32         count,
+    uint32         srdSize
+    ) const
+{
+    PAL_ASSERT(((offset % srdSize) == 0) && ((offset + (count * srdSize)) <= m_createInfo.slotSize));
+
+    return VoidPtrInc(CpuAddress(slot), offset);
+}
+
+// =====================================================================================================================
+// Returns the list link of a slot. Each slot is linked into at most one of the free list, the deferred list or a
+// chain which is being built to be pushed onto one of them.
+volatile uint32& DescriptorHeap::NextLink(
+    DescriptorSlot slot
+    ) const
+{
+    const Block& block = m_blocks[slot / m_createInfo.slotsPerBlock];
+
+    return block.pNext[slot % m_createInfo.slotsPerBlock];
+}
+
+// =====================================================================================================================
+// Pops one slot off the shared free list, or returns InvalidDescriptorSlot if it is empty.
+DescriptorSlot DescriptorHeap::PopFreeSlot()
+{
+    uint64         oldHead = AtomicReadRelaxed64(&m_freeHead);
+    DescriptorSlot slot    = static_cast<DescriptorSlot>(oldHead & FreeHeadSlotMask);
+
+    while (slot != InvalidDescriptorSlot)
+    {
+        // The slot may be popped and reused by another thread before our compare-and-swap, in which case this link is
+        // stale. That's harmless: the tag will have changed, so the swap fails and we retry.
+        const uint64 next    = NextLink(slot);
+        const uint64 newHead = ((oldHead & ~FreeHeadSlotMask) + FreeHeadTagOne) | next;
+        const uint64 curHead = AtomicCompareAndSwap64(&m_freeHead, oldHead, newHead);
+
+        if (curHead == oldHead)
+        {
+            break;
+        }
+
+        oldHead = curHead;
+        slot    = static_cast<DescriptorSlot>(oldHead & FreeHeadSlotMask);
+    }
+
+    return slot;
+}
+
+// =====================================================================================================================
+// Pushes a chain of slots, already linked from first to last, onto the shared free list.
+void DescriptorHeap::PushFreeSlots(
+    DescriptorSlot first,
+    DescriptorSlot last)
+{
+    volatile uint32& lastLink = NextLink(last);
+    uint64           curHead  = AtomicReadRelaxed64(&m_freeHead);
+    uint64           oldHead  = 0;
+
+    do
+    {
+        oldHead  = curHead;
+        lastLink = static_cast<uint32>(oldHead & FreeHeadSlotMask);
+        curHead  = AtomicCompareAndSwap64(&m_freeHead, oldHead, (oldHead & ~FreeHeadSlotMask) | first);
+    } while (curHead != oldHead);
+}
+
+// =====================================================================================================================
+// Pushes a chain of slots, already linked from first to last, onto the deferred list. The deferred list is only ever
+// emptied as a whole so it doesn't need a tag.
+void DescriptorHeap::PushDeferredSlots(
+    DescriptorSlot first,
+    DescriptorSlot last)
+{
+    volatile uint32& lastLink = NextLink(last);
+    DescriptorSlot   curHead  = m_deferredHead;
+    DescriptorSlot   oldHead  = InvalidDescriptorSlot;
+
+    do
+    {
+        oldHead  = curHead;
+        lastLink = oldHead;
+        curHead  = AtomicCompareAndSwap(&m_deferredHead, oldHead, first);
+    } while (curHead != oldHead);
+}
+
+// =====================================================================================================================
+// Hands out a slot which has never been allocated before, creating a new block if all existing ones are used up.
+Result DescriptorHeap::CarveSlot(
+    DescriptorSlot* pSlot)
+{
+    Result result = Result::Success;
+
+    while (true)
+    {
+        const uint32 numBlocks = m_numBlocks;
+        const uint32 slot      = m_numCarved;
+
+        if (slot < (numBlocks * m_createInfo.slotsPerBlock))
+        {
+            if (AtomicCompareAndSwap(&m_numCarved, slot, slot + 1) == slot)
+            {
+                *pSlot = slot;
+                break;
+            }
+        }
+        else
+        {
+            MutexAuto lock(&m_blockLock);
+
+            // Another thread may have created the block while we were waiting for the lock.
+            if (m_numBlocks == numBlocks)
+            {
+                result = (numBlocks < m_createInfo.maxBlocks) ? CreateBlock(numBlocks) : Result::ErrorOutOfMemory;
+
+                if (result != Result::Success)
+                {
+                    break;
+                }
+
+                // Publish the block only after it is fully initialized; the exchange is a full barrier.
+                AtomicExchange(&m_numBlocks, numBlocks + 1);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result DescriptorHeap::CreateBlock(
+    uint32 blockIdx)
+{
+    Block*const pBlock = &m_blocks[blockIdx];
+
+    DeviceProperties props = {};
+    Result result = m_pDevice->GetProperties(&props);
+
+    GpuMemoryCreateInfo createInfo = {};
+    createInfo.size      = Pow2Align(gpusize(m_createInfo.slotSize) * m_createInfo.slotsPerBlock,
+                                     props.gpuMemoryProperties.fragmentSize);
+    createInfo.alignment = props.gpuMemoryProperties.fragmentSize;
+    createInfo.vaRange   = VaRange::Default;
+    createInfo.heapCount = 1;
+    createInfo.heaps[0]  = m_createInfo.heap;
+    createInfo.priority  = GpuMemPriority::High;
+
+    // The placement memory belongs to us until the GPU memory object is created in it, after which DestroyBlock()
+    // frees it along with the object.
+    void* pMemory       = nullptr;
+    bool  ownsPlacement = false;
+
+    if (result == Result::Success)
+    {
+        pMemory       = PAL_MALLOC(m_pDevice->GetGpuMemorySize(createInfo, nullptr), m_pPlatform, AllocObject);
+        ownsPlacement = (pMemory != nullptr);
+        result        = ownsPlacement ? m_pDevice->CreateGpuMemory(createInfo, pMemory, &pBlock->pGpuMemory)
+                                      : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        ownsPlacement = false;
+
+        void* pCpuAddr = nullptr;
+        result         = pBlock->pGpuMemory->Map(&pCpuAddr);
+
+        pBlock->gpuVirtAddr = pBlock->pGpuMemory->Desc().gpuVirtAddr;
+        pBlock->pCpuAddr    = (result == Result::Success) ? pCpuAddr : nullptr;
+    }
+    else
+    {
+        pBlock->pGpuMemory = nullptr;
+    }
+
+    if ((result == Result::Success) && m_createInfo.flags.addMemoryReferences)
+    {
+        GpuMemoryRef memRef = {};
+        memRef.pGpuMemory   = pBlock->pGpuMemory;
+
+        result               = m_pDevice->AddGpuMemoryReferences(1, &memRef, nullptr, GpuMemoryRefCantTrim);
+        pBlock->isReferenced = (result == Result::Success);
+    }
+
+    if (result == Result::Success)
+    {
+        // The links are never read before they are written, so they don't need to be initialized.
+        pBlock->pNext         = static_cast<volatile uint32*>(PAL_MALLOC(sizeof(uint32) * m_createInfo.slotsPerBlock,
+                                                                         m_pPlatform,
+                                                                         AllocInternal));
+        pBlock->pRetireValues = static_cast<uint64*>(PAL_MALLOC(sizeof(uint64) * m_createInfo.slotsPerBlock,
+                                                                m_pPlatform,
+                                                                AllocInternal));
+
+        if ((pBlock->pNext == nullptr) || (pBlock->pRetireValues == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        if (ownsPlacement)
+        {
+            PAL_FREE(pMemory, m_pPlatform);
+        }
+
+        DestroyBlock(pBlock);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void DescriptorHeap::DestroyBlock(
+    Block* pBlock)
+{
+    if (pBlock->pGpuMemory != nullptr)
+    {
+        if (pBlock->pCpuAddr != nullptr)
+        {
+            pBlock->pGpuMemory->Unmap();
+        }
+
+        if (pBlock->isReferenced)
+        {
+            m_pDevice->RemoveGpuMemoryReferences(1, &pBlock->pGpuMemory, nullptr);
+        }
+
+        pBlock->pGpuMemory->Destroy();
+        PAL_FREE(pBlock->pGpuMemory, m_pPlatform);
+    }
+
+    PAL_FREE(const_cast<uint32*>(pBlock->pNext), m_pPlatform);
+    PAL_FREE(pBlock->pRetireValues, m_pPlatform);
+
+    memset(pBlock, 0, sizeof(*pBlock));
+}
+
+} // GpuUtil
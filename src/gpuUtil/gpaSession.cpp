@@ -26,6 +26,7 @@
 #include "gpaSessionPerfSample.h"
 #include "palCmdAllocator.h"
 #include "palCmdBuffer.h"
+#include "palAutoBuffer.h"
 #include "palDequeImpl.h"
 #include "palFence.h"
 #include "palGpuEvent.h"
@@ -2781,18 +2782,27 @@ Result GpaSession::AddCodeObjectLoadEvent(
     const auto& info = pPipeline->GetInfo();
 
     size_t numGpuAllocations = 0;
-    GpuMemSubAllocInfo gpuSubAlloc = { };
 
     Result result = pPipeline->QueryAllocationInfo(&numGpuAllocations, nullptr);
 
+    // The pipeline's own allocation comes first and is the base its code object is loaded at. Any further allocations
+    // hold code which PAL shares between identical pipelines; PAL doesn't share code while RGP tracing is possible.
+    Util::AutoBuffer<GpuMemSubAllocInfo, 4, IPlatform> gpuSubAllocs(numGpuAllocations, m_pPlatform);
+
+    if ((result == Result::Success) && (gpuSubAllocs.Capacity() < numGpuAllocations))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
     if (result == Result::Success)
     {
-        PAL_ASSERT(numGpuAllocations == 1);
-        result = pPipeline->QueryAllocationInfo(&numGpuAllocations, &gpuSubAlloc);
+        result = pPipeline->QueryAllocationInfo(&numGpuAllocations, &gpuSubAllocs[0]);
     }
 
     if (result == Result::Success)
     {
+        const GpuMemSubAllocInfo& gpuSubAlloc = gpuSubAllocs[0];
+
         PAL_ASSERT(gpuSubAlloc.pGpuMemory != nullptr);
         CodeObjectLoadEventRecord record = { };
         record.eventType      = eventType;
@@ -0,0 +1,304 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palResidencyManager.h"
+#include "palGpuMemory.h"
+#include "palHashMapImpl.h"
+#include "palIntrusiveListImpl.h"
+#include "palSysMemory.h"
+#include "palVectorImpl.h"
+
+using namespace Pal;
+using namespace Util;
+
+namespace GpuUtil
+{
+
+// =====================================================================================================================
+ResidencyManager::ResidencyManager(
+    IPlatform* pPlatform,
+    IDevice*   pDevice)
+    :
+    m_pPlatform(pPlatform),
+    m_pDevice(pDevice),
+    m_entries(NumBuckets, pPlatform),
+    m_submitCount(0),
+    m_newResident(pPlatform),
+    m_addRefs(pPlatform),
+    m_removeRefs(pPlatform)
+{
+    memset(&m_createInfo, 0, sizeof(m_createInfo));
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+ResidencyManager::~ResidencyManager()
+{
+    for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        Entry*const pEntry = iter.Get()->value;
+
+        if (pEntry->resident)
+        {
+            IGpuMemory* pGpuMemory = pEntry->pGpuMemory;
+            m_pDevice->RemoveGpuMemoryReferences(1, &pGpuMemory, m_createInfo.pQueue);
+        }
+
+        PAL_DELETE(pEntry, m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+Result ResidencyManager::Init(
+    const ResidencyManagerCreateInfo& createInfo)
+{
+    Result result = (createInfo.budgetPercent <= 100) ? Result::Success : Result::ErrorInvalidValue;
+
+    GpuMemoryHeapProperties heapProps[GpuHeapCount] = {};
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->GetGpuMemoryHeapProperties(heapProps);
+    }
+
+    if (result == Result::Success)
+    {
+        m_createInfo = createInfo;
+
+        const gpusize percent = (createInfo.budgetPercent != 0) ? createInfo.budgetPercent : 100;
+
+        for (uint32 heap = 0; heap < GpuHeapCount; ++heap)
+        {
+            m_stats.budgetBytes[heap] = (createInfo.budget[heap] != 0) ? createInfo.budget[heap]
+                                                                       : (heapProps[heap].heapSize * percent / 100);
+        }
+
+        result = m_lock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_entries.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Looks up the tracking entry of an allocation, creating a non-resident one if this is the first time it is seen.
+Result ResidencyManager::FindOrCreateEntry(
+    IGpuMemory* pGpuMemory,
+    Entry**     ppEntry)
+{
+    bool    existed = false;
+    Entry** ppValue = nullptr;
+    Result  result  = m_entries.FindAllocate(pGpuMemory, &existed, &ppValue);
+
+    if ((result == Result::Success) && (existed == false))
+    {
+        const GpuMemoryDesc& desc = pGpuMemory->Desc();
+
+        *ppValue = PAL_NEW(Entry, m_pPlatform, AllocInternal)(pGpuMemory, desc.size, desc.preferredHeap);
+
+        if (*ppValue == nullptr)
+        {
+            m_entries.Erase(pGpuMemory);
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    *ppEntry = (result == Result::Success) ? *ppValue : nullptr;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Unlinks a resident entry from its LRU list and queues its memory reference for removal.
+Result ResidencyManager::Evict(
+    Entry* pEntry)
+{
+    const Result result = m_removeRefs.PushBack(pEntry->pGpuMemory);
+
+    if (result == Result::Success)
+    {
+        m_lru[pEntry->heap].Erase(&pEntry->lruNode);
+        pEntry->resident = false;
+
+        m_stats.residentBytes[pEntry->heap] -= pEntry->size;
+        m_stats.numResident--;
+        m_stats.numEvicted++;
+        m_stats.evictedBytes += pEntry->size;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result ResidencyManager::PrepareSubmit(
+    uint32              gpuMemRefCount,
+    const GpuMemoryRef* pGpuMemoryRefs)
+{
+    MutexAuto lock(&m_lock);
+
+    const uint64 submit = ++m_submitCount;
+    Result       result = Result::Success;
+
+    gpusize incomingBytes[GpuHeapCount] = {};
+
+    m_newResident.Clear();
+    m_addRefs.Clear();
+    m_removeRefs.Clear();
+    memset(&m_stats.workingSetBytes[0], 0, sizeof(m_stats.workingSetBytes));
+    m_stats.numSubmits++;
+
+    // Stamp every allocation of this submit, moving the resident ones to the most recently used end of their heap's
+    // list and gathering the rest.  The stamp also filters out duplicate references.
+    for (uint32 idx = 0; (idx < gpuMemRefCount) && (result == Result::Success); ++idx)
+    {
+        IGpuMemory*const pGpuMemory = pGpuMemoryRefs[idx].pGpuMemory;
+        Entry*           pEntry     = nullptr;
+
+        if (pGpuMemory->Desc().flags.isVirtual == 0)
+        {
+            result = FindOrCreateEntry(pGpuMemory, &pEntry);
+        }
+
+        if ((pEntry != nullptr) && (pEntry->lastSubmit != submit))
+        {
+            pEntry->lastSubmit = submit;
+            m_stats.workingSetBytes[pEntry->heap] += pEntry->size;
+
+            if (pEntry->resident)
+            {
+                m_lru[pEntry->heap].Erase(&pEntry->lruNode);
+                m_lru[pEntry->heap].PushBack(&pEntry->lruNode);
+            }
+            else
+            {
+                GpuMemoryRef ref = pGpuMemoryRefs[idx];
+                ref.pGpuMemory   = pGpuMemory;
+
+                result = m_addRefs.PushBack(ref);
+
+                if (result == Result::Success)
+                {
+                    result = m_newResident.PushBack(pEntry);
+                }
+
+                incomingBytes[pEntry->heap] += pEntry->size;
+            }
+        }
+    }
+
+    // Make room in each heap by evicting from its least recently used end, stopping at the first allocation which
+    // belongs to this submit since everything after it does too.
+    for (uint32 heap = 0; (heap < GpuHeapCount) && (result == Result::Success); ++heap)
+    {
+        while ((result == Result::Success)                                                      &&
+               ((m_stats.residentBytes[heap] + incomingBytes[heap]) > m_stats.budgetBytes[heap]) &&
+               (m_lru[heap].IsEmpty() == false)                                                 &&
+               (m_lru[heap].Front()->lastSubmit != submit))
+        {
+            result = Evict(m_lru[heap].Front());
+        }
+
+        if ((m_stats.residentBytes[heap] + incomingBytes[heap]) > m_stats.budgetBytes[heap])
+        {
+            m_stats.numOverBudget++;
+        }
+    }
+
+    if (m_removeRefs.NumElements() > 0)
+    {
+        const Result removeResult = m_pDevice->RemoveGpuMemoryReferences(m_removeRefs.NumElements(),
+                                                                         m_removeRefs.Data(),
+                                                                         m_createInfo.pQueue);
+        result = (result == Result::Success) ? removeResult : result;
+    }
+
+    if ((result == Result::Success) && (m_addRefs.NumElements() > 0))
+    {
+        result = m_pDevice->AddGpuMemoryReferences(m_addRefs.NumElements(),
+                                                   m_addRefs.Data(),
+                                                   m_createInfo.pQueue,
+                                                   m_createInfo.memRefFlags);
+
+        if (result == Result::Success)
+        {
+            for (uint32 idx = 0; idx < m_newResident.NumElements(); ++idx)
+            {
+                Entry*const pEntry = m_newResident.At(idx);
+
+                pEntry->resident = true;
+                m_lru[pEntry->heap].PushBack(&pEntry->lruNode);
+
+                m_stats.residentBytes[pEntry->heap] += pEntry->size;
+                m_stats.numResident++;
+                m_stats.numMadeResident++;
+                m_stats.madeResidentBytes += pEntry->size;
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void ResidencyManager::ReleaseMemory(
+    IGpuMemory* pGpuMemory)
+{
+    MutexAuto lock(&m_lock);
+
+    Entry** ppEntry = m_entries.FindKey(pGpuMemory);
+
+    if (ppEntry != nullptr)
+    {
+        Entry*const pEntry = *ppEntry;
+
+        if (pEntry->resident)
+        {
+            m_lru[pEntry->heap].Erase(&pEntry->lruNode);
+            m_stats.residentBytes[pEntry->heap] -= pEntry->size;
+            m_stats.numResident--;
+
+            m_pDevice->RemoveGpuMemoryReferences(1, &pGpuMemory, m_createInfo.pQueue);
+        }
+
+        m_entries.Erase(pGpuMemory);
+        PAL_DELETE(pEntry, m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+void ResidencyManager::QueryStats(
+    ResidencyStats* pStats)
+{
+    MutexAuto lock(&m_lock);
+
+    *pStats            = m_stats;
+    pStats->numTracked = m_entries.GetNumEntries();
+}
+
+} // GpuUtil
@@ -23,6 +23,7 @@
  *
  **********************************************************************************************************************/
 #include "cacheLayerBase.h"
+#include "palCpuProfiler.h"
 #include "palVectorImpl.h"
 
 namespace Util
@@ -58,6 +59,8 @@ Result CacheLayerBase::Query(
     uint32          flags,
     QueryResult*    pQuery)
 {
+    PAL_CPU_ZONE("CacheLayer::Query");
+
     Result result = Result::NotFound;
 
     if ((pHashId == nullptr) ||
@@ -172,6 +175,8 @@ Result CacheLayerBase::Load(
     const QueryResult* pQuery,
     void*              pBuffer)
 {
+    PAL_CPU_ZONE("CacheLayer::Load");
+
     Result result = Result::ErrorUnknown;
 
     if ((pQuery == nullptr) ||
@@ -0,0 +1,281 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palCpuProfiler.h"
+#include "palFile.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palSysMemory.h"
+
+namespace Util
+{
+namespace CpuProfiler
+{
+
+// Each thread owns one of these. Only the owning thread writes events; it publishes them by bumping numEvents with
+// release semantics so the collector can read them concurrently without a lock.
+struct ThreadBuffer
+{
+    ThreadBuffer*        pNext;
+    uint32               threadIndex;
+    uint32               capacity;
+    std::atomic<uint32>  numEvents;
+    uint64               numDropped;
+    ZoneEvent            events[1];
+};
+
+// A thread's cached buffer is only valid for the generation it was registered in. Reset() and Shutdown() bump the
+// generation so threads register a fresh buffer on their next zone.
+struct ThreadState
+{
+    ThreadBuffer* pBuffer;
+    uint32        generation;
+};
+
+namespace Internal
+{
+std::atomic<bool> g_enabled(false);
+}
+
+static GenericAllocator     s_allocator;
+static ThreadBuffer*        s_pThreadBuffers     = nullptr; // The members below are protected by GetLock().
+static uint32               s_numClients         = 0;
+static uint32               s_numThreadBuffers   = 0;
+static uint32               s_maxEventsPerThread = 0;
+static int64                s_startTicks         = 0;
+static std::atomic<uint32>  s_generation(1);
+
+static thread_local ThreadState t_threadState = {};
+
+// =====================================================================================================================
+// Returns the lock which protects the profiler's bookkeeping. Several platforms may enable and disable the profiler
+// concurrently, so the lock is initialized exactly once on first use rather than by Enable().
+static Mutex* GetLock()
+{
+    static Mutex        s_lock;
+    static const Result s_lockResult = s_lock.Init();
+
+    PAL_ASSERT(s_lockResult == Result::Success);
+
+    return &s_lock;
+}
+
+// =====================================================================================================================
+// Returns the calling thread's event buffer, registering a new one if the thread has none for the current generation.
+static ThreadBuffer* GetThreadBuffer()
+{
+    const uint32 generation = s_generation.load(std::memory_order_acquire);
+
+    if (t_threadState.generation != generation)
+    {
+        t_threadState.pBuffer    = nullptr;
+        t_threadState.generation = generation;
+
+        MutexAuto lock(GetLock());
+
+        if (s_maxEventsPerThread > 0)
+        {
+            const size_t   size    = sizeof(ThreadBuffer) + (sizeof(ZoneEvent) * (s_maxEventsPerThread - 1));
+            ThreadBuffer*  pBuffer = static_cast<ThreadBuffer*>(PAL_MALLOC(size, &s_allocator, AllocInternal));
+
+            if (pBuffer != nullptr)
+            {
+                pBuffer->threadIndex = s_numThreadBuffers++;
+                pBuffer->capacity    = s_maxEventsPerThread;
+                pBuffer->numEvents.store(0, std::memory_order_relaxed);
+                pBuffer->numDropped  = 0;
+                pBuffer->pNext       = s_pThreadBuffers;
+                s_pThreadBuffers     = pBuffer;
+
+                t_threadState.pBuffer = pBuffer;
+            }
+        }
+    }
+
+    return t_threadState.pBuffer;
+}
+
+// =====================================================================================================================
+// Frees every thread buffer. The caller must hold the profiler lock.
+static void FreeThreadBuffers()
+{
+    while (s_pThreadBuffers != nullptr)
+    {
+        ThreadBuffer* pBuffer = s_pThreadBuffers;
+        s_pThreadBuffers      = pBuffer->pNext;
+
+        PAL_FREE(pBuffer, &s_allocator);
+    }
+
+    s_numThreadBuffers = 0;
+    s_generation.fetch_add(1, std::memory_order_release);
+}
+
+// =====================================================================================================================
+// Each caller of Enable() holds a reference on the profiler; zones are recorded until every reference is released by
+// a matching call to Disable(). The largest buffer capacity any client asked for wins.
+Result Enable(
+    uint32 maxEventsPerThread)
+{
+    MutexAuto lock(GetLock());
+
+    if (s_startTicks == 0)
+    {
+        s_startTicks = GetPerfCpuTime();
+    }
+
+    s_maxEventsPerThread = Max(Max(maxEventsPerThread, 1u), s_maxEventsPerThread);
+    s_numClients++;
+
+    Internal::g_enabled.store(true, std::memory_order_relaxed);
+
+    return Result::Success;
+}
+
+// =====================================================================================================================
+void Disable()
+{
+    MutexAuto lock(GetLock());
+
+    PAL_ASSERT(s_numClients > 0);
+
+    if ((s_numClients > 0) && (--s_numClients == 0))
+    {
+        Internal::g_enabled.store(false, std::memory_order_relaxed);
+    }
+}
+
+// =====================================================================================================================
+void RecordZone(
+    const char* pName,
+    int64       beginTicks,
+    int64       endTicks)
+{
+    ThreadBuffer* pBuffer = GetThreadBuffer();
+
+    if (pBuffer != nullptr)
+    {
+        const uint32 index = pBuffer->numEvents.load(std::memory_order_relaxed);
+
+        if (index < pBuffer->capacity)
+        {
+            ZoneEvent* pEvent  = &pBuffer->events[index];
+            pEvent->pName      = pName;
+            pEvent->beginTicks = beginTicks;
+            pEvent->endTicks   = endTicks;
+
+            pBuffer->numEvents.store(index + 1, std::memory_order_release);
+        }
+        else
+        {
+            pBuffer->numDropped++;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes complete ("X") trace events with timestamps in microseconds since the profiler was first enabled.
+Result WriteChromeTrace(
+    const char* pFilePath)
+{
+    File   file;
+    Result result = file.Open(pFilePath, FileAccessWrite);
+
+    if (result == Result::Success)
+    {
+        const double usPerTick = 1000000.0 / static_cast<double>(GetPerfFrequency());
+        const uint32 processId = GetIdOfCurrentProcess();
+        const char*  pSeparator = "";
+
+        MutexAuto lock(GetLock());
+
+        file.Printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+        for (const ThreadBuffer* pBuffer = s_pThreadBuffers; pBuffer != nullptr; pBuffer = pBuffer->pNext)
+        {
+            const uint32 numEvents = pBuffer->numEvents.load(std::memory_order_acquire);
+
+            for (uint32 idx = 0; idx < numEvents; ++idx)
+            {
+                const ZoneEvent& event = pBuffer->events[idx];
+
+                file.Printf("%s\n{\"name\":\"%s\",\"cat\":\"pal\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,"
+                            "\"ts\":%.3f,\"dur\":%.3f}",
+                            pSeparator,
+                            event.pName,
+                            processId,
+                            pBuffer->threadIndex,
+                            static_cast<double>(event.beginTicks - s_startTicks) * usPerTick,
+                            static_cast<double>(event.endTicks - event.beginTicks) * usPerTick);
+                pSeparator = ",";
+            }
+        }
+
+        file.Printf("\n]}\n");
+        file.Close();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+uint64 GetNumDroppedZones()
+{
+    uint64 numDropped = 0;
+
+    MutexAuto lock(GetLock());
+
+    for (const ThreadBuffer* pBuffer = s_pThreadBuffers; pBuffer != nullptr; pBuffer = pBuffer->pNext)
+    {
+        numDropped += pBuffer->numDropped;
+    }
+
+    return numDropped;
+}
+
+// =====================================================================================================================
+void Reset()
+{
+    MutexAuto lock(GetLock());
+
+    FreeThreadBuffers();
+}
+
+// =====================================================================================================================
+// Only the last client tears the profiler down; while another client still holds a reference this does nothing.
+void Shutdown()
+{
+    MutexAuto lock(GetLock());
+
+    if (s_numClients == 0)
+    {
+        FreeThreadBuffers();
+        s_maxEventsPerThread = 0;
+        s_startTicks         = 0;
+    }
+}
+
+} // CpuProfiler
+} // Util
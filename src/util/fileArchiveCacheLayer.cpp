@@ -36,31 +36,57 @@ namespace Util
 {
 
 // =====================================================================================================================
-// Class requires and will take ownership of fully initialzed objects for pArchiveFile, pHashProvider, and pBaseContext
+// Class requires and will take ownership of fully initialzed objects for pArchiveFile and pBaseContext
 FileArchiveCacheLayer::FileArchiveCacheLayer(
     const AllocCallbacks& callbacks,
     IArchiveFile*         pArchiveFile,
-    IHashContext*         pBaseContext,
-    void*                 pTempContextMem)
+    IHashContext*         pBaseContext)
     :
-    CacheLayerBase     { callbacks },
-    m_pArchivefile     { pArchiveFile },
-    m_pBaseContext     { pBaseContext },
-    m_pTempContextMem  { pTempContextMem },
-    m_archiveFileMutex {},
-    m_hashContextMutex {},
-    m_entryMapLock     {},
-    m_entries          { HashTableBucketCount, Allocator() }
+    CacheLayerBase      { callbacks },
+    m_pArchivefile      { pArchiveFile },
+    m_pBaseContext      { pBaseContext },
+    m_archiveFileMutex  {},
+    m_indexedEntryCount { 0 },
+    m_pEntryShards      { nullptr },
+    m_pKeyContextMem    { nullptr },
+    m_nextKeyContext    { 0 }
 {
     PAL_ASSERT(m_pArchivefile != nullptr);
     PAL_ASSERT(m_pBaseContext != nullptr);
     PAL_ASSERT(m_pBaseContext->GetOutputBufferSize() <= sizeof(EntryKey));
+
+    for (uint32 i = 0; i < KeyContextCount; ++i)
+    {
+        m_keyContexts[i].busy     = 0;
+        m_keyContexts[i].pSeed    = nullptr;
+        m_keyContexts[i].pScratch = nullptr;
+    }
 }
 
 // =====================================================================================================================
 FileArchiveCacheLayer::~FileArchiveCacheLayer()
 {
+    for (uint32 i = 0; i < KeyContextCount; ++i)
+    {
+        if (m_keyContexts[i].pSeed != nullptr)
+        {
+            m_keyContexts[i].pSeed->Destroy();
+        }
+    }
+
+    PAL_SAFE_FREE(m_pKeyContextMem, Allocator());
+
     m_pBaseContext->Destroy();
+
+    if (m_pEntryShards != nullptr)
+    {
+        for (uint32 i = 0; i < EntryShardCount; ++i)
+        {
+            m_pEntryShards[i].~EntryShard();
+        }
+
+        PAL_SAFE_FREE(m_pEntryShards, Allocator());
+    }
 }
 
 // =====================================================================================================================
@@ -76,17 +102,36 @@ Result FileArchiveCacheLayer::Init()
 
     if (result == Result::Success)
     {
-        result = m_hashContextMutex.Init();
+        m_pEntryShards = static_cast<EntryShard*>(PAL_MALLOC(sizeof(EntryShard) * EntryShardCount,
+                                                              Allocator(),
+                                                              AllocInternal));
+
+        if (m_pEntryShards != nullptr)
+        {
+            for (uint32 i = 0; i < EntryShardCount; ++i)
+            {
+                PAL_PLACEMENT_NEW(&m_pEntryShards[i]) EntryShard(Allocator());
+            }
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
+        }
     }
 
-    if (result == Result::Success)
+    for (uint32 i = 0; (i < EntryShardCount) && (result == Result::Success); ++i)
     {
-        result = m_entryMapLock.Init();
+        result = m_pEntryShards[i].lock.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_pEntryShards[i].entries.Init();
+        }
     }
 
     if (result == Result::Success)
     {
-        result = m_entries.Init();
+        result = InitKeyContexts();
     }
 
     // Collapse all results other than success
@@ -117,40 +162,35 @@ Result FileArchiveCacheLayer::QueryInternal(
     }
     else
     {
-        EntryKey     key;
-        const Entry* pEntry;
+        EntryKey key;
+        Entry    entry = {};
 
         ConvertToEntryKey(pHashId, &key);
 
-        {
-            RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
-
-            pEntry = m_entries.FindKey(key);
-        }
+        bool found = FindEntry(key, &entry);
 
-        if (pEntry == nullptr)
+        if (found == false)
         {
-            MutexAuto                     archiveFileLock { &m_archiveFileMutex };
-            RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
+            MutexAuto archiveFileLock { &m_archiveFileMutex };
 
-            const size_t oldEntryCount = m_entries.GetNumEntries();
+            const size_t oldEntryCount = m_indexedEntryCount;
             Result       refreshResult = RefreshHeaders();
 
             PAL_ALERT(IsErrorResult(refreshResult));
 
             // If the refresh picked up any new header, search again
-            if (oldEntryCount != m_entries.GetNumEntries())
+            if (oldEntryCount != m_indexedEntryCount)
             {
-                pEntry = m_entries.FindKey(key);
+                found = FindEntry(key, &entry);
             }
         }
 
-        if (pEntry != nullptr)
+        if (found)
         {
             pQuery->pLayer          = this;
             pQuery->hashId          = *pHashId;
-            pQuery->dataSize        = pEntry->dataSize;
-            pQuery->context.entryId = pEntry->ordinalId;
+            pQuery->dataSize        = entry.dataSize;
+            pQuery->context.entryId = entry.ordinalId;
 
             result = Result::Success;
         }
@@ -176,6 +216,7 @@ Result FileArchiveCacheLayer::StoreInternal(
 
     Result   result = Result::NotFound;
     EntryKey key;
+    Entry    entry  = {};
 
     if ((pHashId == nullptr) ||
         (pData == nullptr))
@@ -186,59 +227,38 @@ Result FileArchiveCacheLayer::StoreInternal(
     {
         ConvertToEntryKey(pHashId, &key);
 
+        if (FindEntry(key, &entry))
         {
-            RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
-
-            if (m_entries.FindKey(key) != nullptr)
-            {
-                result = Result::AlreadyExists;
-            }
+            result = Result::AlreadyExists;
         }
     }
 
     if (result == Result::NotFound)
     {
-        ArchiveEntryHeader header         = {};
-        const size_t       writeDataSize  = dataSize;
-        void* const        pMem           = PAL_MALLOC(writeDataSize, Allocator(), AllocInternalTemp);
+        ArchiveEntryHeader header = {};
 
-        PAL_ALERT(pMem == nullptr);
+        MutexAuto archiveFileLock { &m_archiveFileMutex };
 
-        if (pMem != nullptr)
+        // Another thread may have stored the same key since we last looked
+        if (FindEntry(key, &entry))
         {
-            result = Result::Success;
+            result = Result::AlreadyExists;
         }
         else
         {
-            result = Result::ErrorOutOfMemory;
-        }
+            header.dataSize  = static_cast<uint32>(dataSize);
+            header.metaValue = static_cast<uint32>(dataSize);
 
-        // Write the scratch buffer to the file
-        if (result == Result::Success)
-        {
-            MutexAuto archiveFileLock { &m_archiveFileMutex };
-
-            void* const pDataMem = pMem;
-            header.dataSize      = static_cast<uint32>(writeDataSize);
-            header.metaValue     = static_cast<uint32>(dataSize);
-
-            memcpy(pDataMem, pData, dataSize);
             memcpy(header.entryKey, key.value, sizeof(EntryKey));
 
-            result = m_pArchivefile->Write(&header, pMem);
+            // The archive file never holds on to pData past Write(), so it can be handed over without a scratch copy
+            result = m_pArchivefile->Write(&header, pData);
         }
 
-        // Only insert this entry into our lookup table if everything succeeded
+        // Only index the archive's new headers (including this one) if everything succeeded
         if (result == Result::Success)
         {
-            RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
-
-            result = AddHeaderToTable(header);
-        }
-
-        if (pMem != nullptr)
-        {
-            PAL_FREE(pMem, Allocator());
+            result = RefreshHeaders();
         }
     }
 
@@ -274,17 +294,14 @@ Result FileArchiveCacheLayer::LoadInternal(
 #if DEBUG
     if (result == Result::Success)
     {
-        RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
-
         EntryKey key;
+        Entry    entry = {};
         ConvertToEntryKey(&pQuery->hashId, &key);
 
-        const Entry* pEntry = m_entries.FindKey(key);
+        const bool found = FindEntry(key, &entry);
 
-        // Should be safe to have these in order, if alerts are enabled then the first will be hit,
-        // if they are disabled then neither will be.
-        PAL_ALERT(pEntry == nullptr);
-        PAL_ALERT(pEntry->ordinalId != pQuery->context.entryId);
+        PAL_ALERT(found == false);
+        PAL_ALERT(found && (entry.ordinalId != pQuery->context.entryId));
     }
 #endif
 
@@ -362,6 +379,8 @@ static size_t GetBaseContextSizeFromCreateInfo(
         Result          result = GetHashContextInfo(HashAlgorithm::Sha1, &info);
 
         PAL_ALERT(IsErrorResult(result));
+
+        contextSize = info.contextObjectSize;
     }
 
     return contextSize;
@@ -372,7 +391,7 @@ static size_t GetBaseContextSizeFromCreateInfo(
 size_t GetArchiveFileCacheLayerSize(
     const ArchiveFileCacheCreateInfo* pCreateInfo)
 {
-    return sizeof(FileArchiveCacheLayer) + (GetBaseContextSizeFromCreateInfo(pCreateInfo) * 2);
+    return sizeof(FileArchiveCacheLayer) + GetBaseContextSizeFromCreateInfo(pCreateInfo);
 }
 
 // =====================================================================================================================
@@ -386,12 +405,8 @@ Result CreateArchiveFileCacheLayer(
     PAL_ASSERT(pPlacementAddr != nullptr);
     PAL_ASSERT(ppCacheLayer != nullptr);
 
-    Result                 result          = Result::Success;
-    FileArchiveCacheLayer* pLayer          = nullptr;
-    IHashContext*          pBaseContext    = nullptr;
-    void*                  pTempContextMem = nullptr;
-    const size_t           hashContextSize = GetBaseContextSizeFromCreateInfo(pCreateInfo);
-    ArchiveFileOpenInfo    openInfo        = {};
+    Result        result       = Result::Success;
+    IHashContext* pBaseContext = nullptr;
 
     if ((pCreateInfo == nullptr) ||
         (pPlacementAddr == nullptr) ||
@@ -403,7 +418,6 @@ Result CreateArchiveFileCacheLayer(
     if (result == Result::Success)
     {
         void* pBaseContextMem = VoidPtrInc(pPlacementAddr, sizeof(FileArchiveCacheLayer));
-        pTempContextMem       = VoidPtrInc(pBaseContextMem, hashContextSize);
 
         if (pCreateInfo->pPlatformKey != nullptr)
         {
@@ -417,18 +431,17 @@ Result CreateArchiveFileCacheLayer(
 
     if (result == Result::Success)
     {
-        AllocCallbacks  callbacks = {};
+        AllocCallbacks callbacks = {};
 
         if (pCreateInfo->baseInfo.pCallbacks == nullptr)
         {
             Pal::GetDefaultAllocCb(&callbacks);
         }
 
-        pLayer = PAL_PLACEMENT_NEW(pPlacementAddr) FileArchiveCacheLayer(
+        FileArchiveCacheLayer* pLayer = PAL_PLACEMENT_NEW(pPlacementAddr) FileArchiveCacheLayer(
             (pCreateInfo->baseInfo.pCallbacks == nullptr) ? callbacks : *pCreateInfo->baseInfo.pCallbacks,
             pCreateInfo->pFile,
-            pBaseContext,
-            pTempContextMem);
+            pBaseContext);
 
         result = pLayer->Init();
 
@@ -461,19 +474,44 @@ Result FileArchiveCacheLayer::AddHeaderToTable(
 
     memcpy(key.value, header.entryKey, sizeof(header.entryKey));
 
-    return m_entries.Insert(key, {header.ordinalId, header.metaValue});
+    EntryShard* const pShard = GetShard(key);
+
+    RWLockAuto<RWLock::ReadWrite> shardLock { &pShard->lock };
+
+    return pShard->entries.Insert(key, {header.ordinalId, header.metaValue});
 }
 
 // =====================================================================================================================
-// Reload entry headers from the archive file
+// Look up an entry in its shard, copying it out while the shard's reader lock is held
+bool FileArchiveCacheLayer::FindEntry(
+    const EntryKey& key,
+    Entry*          pEntry
+    ) const
+{
+    EntryShard* const pShard = GetShard(key);
+
+    RWLockAuto<RWLock::ReadOnly> shardLock { &pShard->lock };
+
+    const Entry* const pFound = pShard->entries.FindKey(key);
+
+    if (pFound != nullptr)
+    {
+        *pEntry = *pFound;
+    }
+
+    return (pFound != nullptr);
+}
+
+// =====================================================================================================================
+// Reload entry headers from the archive file. The caller must hold m_archiveFileMutex.
 Result FileArchiveCacheLayer::RefreshHeaders()
 {
     Result       result        = Result::Success;
     const size_t newEntryCount = m_pArchivefile->GetEntryCount();
-    size_t       curEntryCount = m_entries.GetNumEntries();
 
-    while (curEntryCount < newEntryCount)
+    while (m_indexedEntryCount < newEntryCount)
     {
+        const size_t       curEntryCount = m_indexedEntryCount;
         ArchiveEntryHeader header;
         result = m_pArchivefile->GetEntryByIndex(curEntryCount, &header);
 
@@ -493,7 +531,7 @@ Result FileArchiveCacheLayer::RefreshHeaders()
             break;
         }
 
-        curEntryCount += 1;
+        m_indexedEntryCount += 1;
     }
 
     return result;
@@ -508,19 +546,109 @@ void FileArchiveCacheLayer::ConvertToEntryKey(
     PAL_ASSERT(pHashId != nullptr);
     PAL_ASSERT(pKey != nullptr);
 
-    MutexAuto hashContextLock { &m_hashContextMutex };
+    KeyContext* const pKeyContext = AcquireKeyContext();
+    Result            result      = Result::Success;
 
-    IHashContext* pContext = nullptr;
-    Result result          = m_pBaseContext->Duplicate(m_pTempContextMem, &pContext);
-    PAL_ALERT(IsErrorResult(result));
+    if (pKeyContext != nullptr)
+    {
+        result = HashEntryKey(pKeyContext->pSeed, pKeyContext->pScratch, pHashId, pKey);
 
-    result = pContext->AddData(pHashId, sizeof(Hash128));
-    PAL_ALERT(IsErrorResult(result));
+        AtomicExchange(&pKeyContext->busy, 0);
+    }
+    else
+    {
+        // Every key context is in use. Rather than wait for one, duplicate the base context onto the stack; Duplicate()
+        // only reads the source, so this is safe to do concurrently.
+        const size_t contextSize = m_pBaseContext->GetDuplicateObjectSize();
+
+        AutoBuffer<uint64, 32, ForwardAllocator> contextMem((contextSize + sizeof(uint64) - 1) / sizeof(uint64),
+                                                            Allocator());
+
+        result = ((contextMem.Capacity() * sizeof(uint64)) >= contextSize)
+                 ? HashEntryKey(m_pBaseContext, contextMem.Data(), pHashId, pKey)
+                 : Result::ErrorOutOfMemory;
+    }
 
-    result = pContext->Finish(pKey->value);
     PAL_ALERT(IsErrorResult(result));
+}
+
+// =====================================================================================================================
+// Duplicate a context that already holds the platform key (or nothing, without a platform key) into pScratch and hash
+// the id with it. The seed itself is never modified.
+Result FileArchiveCacheLayer::HashEntryKey(
+    const IHashContext* pSeed,
+    void*               pScratch,
+    const Hash128*      pHashId,
+    EntryKey*           pKey
+    ) const
+{
+    IHashContext* pContext = nullptr;
+    Result        result   = pSeed->Duplicate(pScratch, &pContext);
+
+    if (result == Result::Success)
+    {
+        result = pContext->AddData(pHashId, sizeof(Hash128));
 
-    pContext->Destroy();
+        if (result == Result::Success)
+        {
+            result = pContext->Finish(pKey->value);
+        }
+
+        pContext->Destroy();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Claim a free key context without blocking. The search starts at a different context on each call so concurrent
+// callers rarely collide. Returns null if every context is in use.
+FileArchiveCacheLayer::KeyContext* FileArchiveCacheLayer::AcquireKeyContext()
+{
+    const uint32 start       = AtomicIncrement(&m_nextKeyContext);
+    KeyContext*  pKeyContext = nullptr;
+
+    for (uint32 i = 0; (i < KeyContextCount) && (pKeyContext == nullptr); ++i)
+    {
+        KeyContext* const pCandidate = &m_keyContexts[(start + i) % KeyContextCount];
+
+        if ((pCandidate->pSeed != nullptr) && (AtomicCompareAndSwap(&pCandidate->busy, 0, 1) == 0))
+        {
+            pKeyContext = pCandidate;
+        }
+    }
+
+    return pKeyContext;
+}
+
+// =====================================================================================================================
+// Give every key context its own copy of the base context plus scratch memory for one duplicate of it. Each copy and
+// scratch area starts on its own cache line so threads hashing keys at the same time don't share lines.
+Result FileArchiveCacheLayer::InitKeyContexts()
+{
+    Result       result = Result::Success;
+    const size_t stride = Pow2Align(m_pBaseContext->GetDuplicateObjectSize(), PAL_CACHE_LINE_BYTES);
+
+    m_pKeyContextMem = PAL_MALLOC_ALIGNED(stride * 2 * KeyContextCount,
+                                          PAL_CACHE_LINE_BYTES,
+                                          Allocator(),
+                                          AllocInternal);
+
+    if (m_pKeyContextMem == nullptr)
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    for (uint32 i = 0; (i < KeyContextCount) && (result == Result::Success); ++i)
+    {
+        void* const pSeedMem = VoidPtrInc(m_pKeyContextMem, stride * 2 * i);
+
+        m_keyContexts[i].pScratch = VoidPtrInc(pSeedMem, stride);
+
+        result = m_pBaseContext->Duplicate(pSeedMem, &m_keyContexts[i].pSeed);
+    }
+
+    return result;
 }
 
 } //namespace Util
@@ -44,8 +44,7 @@ public:
     FileArchiveCacheLayer(
         const AllocCallbacks& callbacks,
         IArchiveFile*         pArchiveFile,
-        IHashContext*         pBaseContext,
-        void*                 pTemContextMem);
+        IHashContext*         pBaseContext);
     virtual ~FileArchiveCacheLayer();
 
     virtual Result Init() override;
@@ -72,6 +71,8 @@ private:
     // Constants
     static constexpr size_t        MinExpectedHeaders   = 256;
     static constexpr size_t        HashTableBucketCount = 2048;
+    static constexpr uint32        EntryShardCount      = 16;
+    static constexpr uint32        KeyContextCount      = 16;
 
     // Helper type for ArchiveEntryHeader::entryKey
     struct EntryKey
@@ -87,8 +88,38 @@ private:
     };
     using EntryMap = HashMap<EntryKey, Entry, ForwardAllocator, JenkinsHashFunc>;
 
+    // The entry table is split into shards picked by the leading key byte so lookups of different keys take different
+    // reader locks. Keys are hash digests, so they spread evenly across the shards.
+    struct EntryShard
+    {
+        explicit EntryShard(ForwardAllocator* pAllocator)
+            :
+            lock    {},
+            entries { HashTableBucketCount / EntryShardCount, pAllocator }
+            {}
+
+        RWLock   lock;
+        EntryMap entries;
+    };
+
+    // A private copy of the base context and room to duplicate it for one key. Threads claim one by swapping busy from 0
+    // to 1.
+    struct KeyContext
+    {
+        volatile uint32 busy;
+        IHashContext*   pSeed;
+        void*           pScratch;
+    };
+
     // Hashing Utility functions
-    void ConvertToEntryKey(const Hash128* pHashId, EntryKey* pKey);
+    void        ConvertToEntryKey(const Hash128* pHashId, EntryKey* pKey);
+    Result      HashEntryKey(const IHashContext* pSeed, void* pScratch, const Hash128* pHashId, EntryKey* pKey) const;
+    KeyContext* AcquireKeyContext();
+    Result      InitKeyContexts();
+
+    // Entry table helpers
+    EntryShard* GetShard(const EntryKey& key) const { return &m_pEntryShards[key.value[0] % EntryShardCount]; }
+    bool        FindEntry(const EntryKey& key, Entry* pEntry) const;
 
     // Header refresh
     Result AddHeaderToTable(const ArchiveEntryHeader& header);
@@ -97,14 +128,16 @@ private:
     // Invariants that must be passed in by ctor
     IArchiveFile* const  m_pArchivefile;
     IHashContext* const  m_pBaseContext;
-    void* const          m_pTempContextMem;
 
     Mutex                m_archiveFileMutex;
-    Mutex                m_hashContextMutex;
-    RWLock               m_entryMapLock;
 
     // Data Members
-    EntryMap m_entries;
+    size_t               m_indexedEntryCount; // Archive entries already added to the shards. Guarded by
+                                              // m_archiveFileMutex.
+    EntryShard*          m_pEntryShards;
+    void*                m_pKeyContextMem;
+    volatile uint32      m_nextKeyContext;  // Spreads concurrent key derivations across m_keyContexts.
+    KeyContext           m_keyContexts[KeyContextCount];
 };
 
 } //namespace Util
@@ -26,7 +26,7 @@
 #include "palAssert.h"
 #include "palInlineFuncs.h"
 #include "palJsonWriter.h"
-#include <cinttypes>
+#include <cmath>
 
 namespace Util
 {
@@ -55,6 +55,59 @@ enum JsonScope : uint8
     ScopeInline  = 0x8
 };
 
+// The decimal digit pairs "00" through "99", so that integers can be formatted two digits at a time.
+static constexpr char DigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Enough characters for any 64-bit integer, including its sign.
+constexpr uint32 IntegerBufferSize = 24;
+
+// Keys and strings up to this length (including their quotes) are written to the stream with a single call.
+constexpr uint32 StringBufferSize = 128;
+
+// =====================================================================================================================
+// Formats an unsigned integer into the characters immediately preceding pEnd and returns a pointer to the first one.
+static char* FormatUnsigned(
+    uint64 value,
+    char*  pEnd)
+{
+    char* pCur = pEnd;
+
+    while (value >= 100)
+    {
+        const uint32 pair = static_cast<uint32>(value % 100) * 2;
+        value /= 100;
+
+        pCur   -= 2;
+        pCur[0] = DigitPairs[pair];
+        pCur[1] = DigitPairs[pair + 1];
+    }
+
+    if (value >= 10)
+    {
+        const uint32 pair = static_cast<uint32>(value) * 2;
+
+        pCur   -= 2;
+        pCur[0] = DigitPairs[pair];
+        pCur[1] = DigitPairs[pair + 1];
+    }
+    else
+    {
+        *(--pCur) = static_cast<char>('0' + value);
+    }
+
+    return pCur;
+}
+
 // =====================================================================================================================
 JsonWriter::JsonWriter(
     JsonStream* pStream)
@@ -68,6 +121,9 @@ JsonWriter::JsonWriter(
     memset(m_scopeStack,   0,   sizeof(m_scopeStack));
     memset(m_indentBuffer, ' ', sizeof(m_indentBuffer));
 
+    // The indentation is always preceded by a newline, so both are written with one call.
+    m_indentBuffer[0] = '\n';
+
     m_scopeStack[0] = ScopeOutside;
 }
 
@@ -131,10 +187,7 @@ void JsonWriter::Key(
     }
 
     TransitionToToken(TokenKey, false);
-    m_pStream->WriteCharacter('"');
-    m_pStream->WriteString(pKey, static_cast<uint32>(strlen(pKey)));
-    m_pStream->WriteCharacter('"');
-    m_pStream->WriteCharacter(':');
+    WriteQuotedString(pKey, true);
 }
 
 // =====================================================================================================================
@@ -143,153 +196,91 @@ void JsonWriter::Value(
 {
     MaybeNextListEntry();
     TransitionToToken(TokenValue, false);
-    m_pStream->WriteCharacter('"');
-    m_pStream->WriteString(pValue, static_cast<uint32>(strlen(pValue)));
-    m_pStream->WriteCharacter('"');
+    WriteQuotedString(pValue, false);
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     uint64 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRIu64, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue(value, false);
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     uint32 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRIu32, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue(value, false);
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     uint16 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRIu16, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue(value, false);
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     uint8 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRIu8, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue(value, false);
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     int64 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRId64, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue((value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value), (value < 0));
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     int32 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRId32, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue((value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value), (value < 0));
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     int16 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRId16, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue((value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value), (value < 0));
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     int8 value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
-
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%" PRId8, value);
-
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
-
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    IntegerValue((value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value), (value < 0));
 }
 
 // =====================================================================================================================
 void JsonWriter::Value(
     float value)
 {
-    MaybeNextListEntry();
-    TransitionToToken(TokenValue, false);
+    // "%g" prints integral values of magnitude below one million exactly as integers, so those take the much faster
+    // integer path. Everything else (including negative zero, infinities and NaNs) still goes through printf so that
+    // the output doesn't change.
+    if ((value > -1000000.0f) && (value < 1000000.0f) &&
+        (value == static_cast<float>(static_cast<int32>(value))) &&
+        ((value != 0.0f) || (std::signbit(value) == false)))
+    {
+        Value(static_cast<int32>(value));
+    }
+    else
+    {
+        MaybeNextListEntry();
+        TransitionToToken(TokenValue, false);
 
-    constexpr size_t BufferSize = 32;
-    char             buffer[BufferSize];
-    const int        length = Snprintf(buffer, BufferSize, "%g", value);
+        constexpr size_t BufferSize = 32;
+        char             buffer[BufferSize];
+        const int        length = Snprintf(buffer, BufferSize, "%g", value);
 
-    PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
+        PAL_ASSERT((length >= 0) && (length <= static_cast<int>(BufferSize)));
 
-    m_pStream->WriteString(buffer, static_cast<uint32>(length));
+        m_pStream->WriteString(buffer, static_cast<uint32>(length));
+    }
 }
 
 // =====================================================================================================================
@@ -313,6 +304,65 @@ void JsonWriter::NullValue()
     m_pStream->WriteString("null", 4);
 }
 
+// =====================================================================================================================
+// Writes an integer value given its magnitude and sign.
+void JsonWriter::IntegerValue(
+    uint64 magnitude,
+    bool   negative)
+{
+    MaybeNextListEntry();
+    TransitionToToken(TokenValue, false);
+
+    char  buffer[IntegerBufferSize];
+    char* pEnd   = buffer + IntegerBufferSize;
+    char* pStart = FormatUnsigned(magnitude, pEnd);
+
+    if (negative)
+    {
+        *(--pStart) = '-';
+    }
+
+    m_pStream->WriteString(pStart, static_cast<uint32>(pEnd - pStart));
+}
+
+// =====================================================================================================================
+// Writes a string surrounded by quotes, followed by a colon if it's a key. Short strings are assembled on the stack so
+// that the stream sees one call instead of three or four.
+void JsonWriter::WriteQuotedString(
+    const char* pString,
+    bool        isKey)
+{
+    const uint32 length      = static_cast<uint32>(strlen(pString));
+    const uint32 totalLength = length + (isKey ? 3 : 2);
+
+    if (totalLength <= StringBufferSize)
+    {
+        char buffer[StringBufferSize];
+
+        buffer[0] = '"';
+        memcpy(&buffer[1], pString, length);
+        buffer[length + 1] = '"';
+
+        if (isKey)
+        {
+            buffer[length + 2] = ':';
+        }
+
+        m_pStream->WriteString(buffer, totalLength);
+    }
+    else
+    {
+        m_pStream->WriteCharacter('"');
+        m_pStream->WriteString(pString, length);
+        m_pStream->WriteCharacter('"');
+
+        if (isKey)
+        {
+            m_pStream->WriteCharacter(':');
+        }
+    }
+}
+
 // =====================================================================================================================
 // Before a token is written to a list, this must be called to make sure that a comma token is written if necessary.
 void JsonWriter::MaybeNextListEntry()
@@ -369,8 +419,8 @@ void JsonWriter::TransitionToToken(
         // scope in this transition. In that case, we should use one less indent so that the braces/brackets line up.
         const uint32 numSpaces = leavingScope ? ((m_curScope - 1) * IndentSize) : (m_curScope * IndentSize);
 
-        m_pStream->WriteCharacter('\n');
-        m_pStream->WriteString(m_indentBuffer, numSpaces);
+        // m_indentBuffer starts with a newline.
+        m_pStream->WriteString(m_indentBuffer, numSpaces + 1);
     }
 
     // Update the previous token, assuming the caller is going to write it next.
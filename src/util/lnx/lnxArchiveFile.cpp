@@ -33,6 +33,7 @@
 #include "palSysUtil.h"
 #include "palVectorImpl.h"
 
+#include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
 #include <stdio.h>
@@ -41,6 +42,7 @@
 #include <sys/file.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <time.h>
 
@@ -202,6 +204,66 @@ static Result WriteDirect(
     return result;
 }
 
+// =====================================================================================================================
+// Helper function to write a gathered list of buffers to a file in as few system calls as possible. The iovec array is
+// consumed as the write progresses.
+static Result WriteDirectV(
+    int32  fd,
+    size_t fileOffset,
+    iovec* pIov,
+    uint32 iovCount)
+{
+    PAL_ASSERT(fd > 0);
+    PAL_ASSERT(pIov != nullptr);
+
+    Result result = Result::Success;
+
+    while (result == Result::Success)
+    {
+        // Skip over any buffers which are already fully written
+        while ((iovCount > 0) && (pIov->iov_len == 0))
+        {
+            ++pIov;
+            --iovCount;
+        }
+
+        if (iovCount == 0)
+        {
+            break;
+        }
+
+        const ssize_t written = pwritev(fd, pIov, static_cast<int32>(Min<uint32>(iovCount, IOV_MAX)), fileOffset);
+
+        if (written > 0)
+        {
+            size_t remaining = static_cast<size_t>(written);
+            fileOffset      += remaining;
+
+            while (remaining > 0)
+            {
+                const size_t consumed = Min(remaining, pIov->iov_len);
+
+                pIov->iov_base = VoidPtrInc(pIov->iov_base, consumed);
+                pIov->iov_len -= consumed;
+                remaining     -= consumed;
+
+                if (pIov->iov_len == 0)
+                {
+                    ++pIov;
+                    --iovCount;
+                }
+            }
+        }
+        else if ((written == 0) || (errno != EINTR))
+        {
+            result = Result::ErrorUnknown;
+            PAL_ALERT_ALWAYS();
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 static Result CreateDir(
     const char *pPathName)
@@ -461,13 +523,32 @@ ArchiveFile::ArchiveFile(
     m_recentList        (),
     m_pages             (),
     m_pageCount         (0),
-    m_pageSize          (MinPageSize)
+    m_pageSize          (MinPageSize),
+    // Write-behind
+    m_useWriteBehind       (false),
+    m_writeBehindWindowMs  (DefaultWriteBehindWindowMs),
+    m_writeBehindBatchSize (DefaultWriteBehindBatchSize),
+    m_flushThread          (),
+    m_journalLock          (),
+    m_journalCondVar       (),
+    m_journal              (),
+    m_activeJournal        (0),
+    m_stopFlushThread      (false),
+    m_writeBehindResult    (Result::Success)
 {
 }
 
 // =====================================================================================================================
 ArchiveFile::~ArchiveFile()
 {
+    // Commit anything still queued before the file goes away
+    StopWriteBehind();
+
+    for (uint32 i = 0; i < ArrayLen(m_journal); ++i)
+    {
+        PAL_SAFE_FREE(m_journal[i].pMem, Allocator());
+    }
+
     close(m_hFile);
 }
 
@@ -495,6 +576,13 @@ Result ArchiveFile::Init(
         }
     }
 
+    if ((result == Result::Success) &&
+        m_haveWriteAccess           &&
+        pInfo->useWriteBehind)
+    {
+        result = InitWriteBehind(pInfo);
+    }
+
     return result;
 }
 
@@ -605,7 +693,16 @@ Result ArchiveFile::Read(
         if ((pHeader->ordinalId <= GetEntryCount()) &&
             ((pHeader->dataPosition + pHeader->dataSize) <= m_curFooterOffset))
         {
-            result = ReadInternal(pHeader->dataPosition, pDataBuffer, pHeader->dataSize, false);
+            // Entries which are still queued for write-behind are served straight from the journal
+            if (m_useWriteBehind &&
+                ReadJournal(pHeader->dataPosition, pDataBuffer, pHeader->dataSize))
+            {
+                result = Result::Success;
+            }
+            else
+            {
+                result = ReadInternal(pHeader->dataPosition, pDataBuffer, pHeader->dataSize, false);
+            }
         }
         else
         {
@@ -659,40 +756,37 @@ Result ArchiveFile::Write(
         pHeader->dataPosition = curOffset + sizeof(ArchiveEntryHeader);
         pHeader->dataCrc64    = Crc64(pData, pHeader->dataSize);
 
-        size_t writeSize = sizeof(ArchiveEntryHeader) + pHeader->dataSize + sizeof(ArchiveFileFooter);
-
-        void* pBuffer = PAL_MALLOC(writeSize, Allocator(), AllocInternalTemp);
-
-        if (pBuffer != nullptr)
+        if (m_useWriteBehind)
+        {
+            result = QueueWrite(*pHeader, pData);
+        }
+        else
         {
-            void* pOutData   = VoidPtrInc(pBuffer, sizeof(ArchiveEntryHeader));
-            void* pOutFooter = VoidPtrInc(pOutData, pHeader->dataSize);
-
-            memcpy(pBuffer, pHeader, sizeof(ArchiveEntryHeader));
-            memcpy(pOutData, pData, pHeader->dataSize);
-            memcpy(pOutFooter, &m_cachedFooter, sizeof(ArchiveFileFooter));
-
             // Correct the footer we're about to attempt to write
-            static_cast<ArchiveFileFooter*>(pOutFooter)->entryCount += 1;
-
-            result = WriteInternal(curOffset, pBuffer, writeSize);
+            ArchiveFileFooter footer = m_cachedFooter;
+            footer.entryCount       += 1;
+
+            // Gather the header, the caller's data and the footer into a single write without staging a copy
+            iovec iov[3]    = {};
+            iov[0].iov_base = pHeader;
+            iov[0].iov_len  = sizeof(ArchiveEntryHeader);
+            iov[1].iov_base = const_cast<void*>(pData);
+            iov[1].iov_len  = pHeader->dataSize;
+            iov[2].iov_base = &footer;
+            iov[2].iov_len  = sizeof(ArchiveFileFooter);
+
+            result = WriteInternalV(curOffset, iov, static_cast<uint32>(ArrayLen(iov)));
+        }
 
-            PAL_SAFE_FREE(pBuffer, Allocator());
-            if (result == Result::Success)
-            {
-                // Update our internal cache to reflect the result of the write
-                m_curFooterOffset = pHeader->nextBlock;
-                m_cachedFooter.entryCount += 1;
+        if (result == Result::Success)
+        {
+            // Update our internal cache to reflect the result of the write
+            m_curFooterOffset = pHeader->nextBlock;
+            m_cachedFooter.entryCount += 1;
 
-                result = m_entries.PushBack(*pHeader);
+            result = m_entries.PushBack(*pHeader);
 
-                PAL_ALERT(IsErrorResult(result));
-            }
-        }
-        else
-        {
-            PAL_ALERT_ALWAYS();
-            result = Result::ErrorOutOfMemory;
+            PAL_ALERT(IsErrorResult(result));
         }
     }
     else
@@ -731,8 +825,13 @@ Result ArchiveFile::RefreshFile(
             ArchiveFileFooter tmpFooter    = {};
             const size_t      footerOffset = static_cast<size_t>(statBuf.st_size - sizeof(tmpFooter));
 
+            // With write-behind the file on disk trails our cached footer by whatever is still queued. We hold the
+            // exclusive write lock so nobody else can have moved the footer.
+            const bool footerIsCurrent = m_useWriteBehind ? (footerOffset <= m_curFooterOffset)
+                                                          : (footerOffset == m_curFooterOffset);
+
             if (m_haveWriteAccess &&
-                (footerOffset == m_curFooterOffset) &&
+                footerIsCurrent   &&
                 (forceRefresh == false))
             {
                 result = Result::Success;
@@ -878,28 +977,257 @@ Result ArchiveFile::ReadInternal(
 
 // =====================================================================================================================
 // Select and call the appropriate write method for this file
-Result ArchiveFile::WriteInternal(
-    size_t           fileOffset,
-    const void*      pData,
-    size_t           writeSize)
+Result ArchiveFile::WriteInternalV(
+    size_t fileOffset,
+    iovec* pIov,
+    uint32 iovCount)
 {
-    PAL_ASSERT(pData != nullptr);
+    PAL_ASSERT(pIov != nullptr);
 
-    Result result = Result::ErrorUnknown;
+    // Update the cached pages if needed. This has to happen up front because the direct write consumes the iovecs. A
+    // failed write leaves m_curFooterOffset alone, so the next write overwrites the same range in both places.
+    if (m_useBufferedMemory)
+    {
+        size_t curOffset = fileOffset;
+
+        for (uint32 i = 0; i < iovCount; ++i)
+        {
+            Result bufferedResult = WriteCached(curOffset, pIov[i].iov_base, pIov[i].iov_len);
+            PAL_ALERT(IsErrorResult(bufferedResult));
+
+            curOffset += pIov[i].iov_len;
+        }
+    }
+
+    return WriteDirectV(m_hFile, fileOffset, pIov, iovCount);
+}
+
+// =====================================================================================================================
+// Sets up the write-behind journal and starts the thread which commits it to disk
+Result ArchiveFile::InitWriteBehind(
+    const ArchiveFileOpenInfo* pInfo)
+{
+    if (pInfo->writeBehindWindowMs > 0)
+    {
+        m_writeBehindWindowMs = pInfo->writeBehindWindowMs;
+    }
+
+    if (pInfo->writeBehindBatchSize > 0)
+    {
+        m_writeBehindBatchSize = pInfo->writeBehindBatchSize;
+    }
+
+    Result result = m_journalLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_journalCondVar.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_flushThread.Begin(&FlushThreadFunc, this);
+    }
 
-    result = WriteDirect(m_hFile, fileOffset, pData, writeSize);
+    if (result == Result::Success)
+    {
+        m_useWriteBehind = true;
+    }
+
+    return result;
+}
 
-    // Update the cached pages if needed
-    if ((m_useBufferedMemory) &&
-        (result == Result::Success))
+// =====================================================================================================================
+// Asks the flush thread to commit whatever is still queued and waits for it to exit
+void ArchiveFile::StopWriteBehind()
+{
+    if (m_flushThread.IsCreated())
     {
-        Result bufferedResult = WriteCached(fileOffset, pData, writeSize);
-        PAL_ALERT(IsErrorResult(bufferedResult));
+        m_journalLock.Lock();
+        m_stopFlushThread = true;
+        m_journalCondVar.WakeAll();
+        m_journalLock.Unlock();
+
+        m_flushThread.Join();
+    }
+}
+
+// =====================================================================================================================
+// Appends a header+data record to the write-behind journal. Offsets were already assigned by the caller, so the
+// record is visible through m_entries right away and lands on disk with the next batch.
+Result ArchiveFile::QueueWrite(
+    const ArchiveEntryHeader& header,
+    const void*               pData)
+{
+    const size_t recordSize   = sizeof(ArchiveEntryHeader) + header.dataSize;
+    const size_t recordOffset = header.dataPosition - sizeof(ArchiveEntryHeader);
+    const size_t maxQueued    = m_writeBehindBatchSize * MaxJournalBatches;
+
+    MutexAuto journalLock(&m_journalLock);
+
+    // Apply back-pressure if the disk can't keep up with the writers
+    while ((m_writeBehindResult == Result::Success) &&
+           (m_journal[m_activeJournal].size >= maxQueued))
+    {
+        m_journalCondVar.Wait(&m_journalLock, UINT32_MAX);
+    }
+
+    Result         result   = m_writeBehindResult;
+    JournalBuffer* pJournal = &m_journal[m_activeJournal];
+    const size_t   newSize  = pJournal->size + recordSize;
+
+    if ((result == Result::Success) &&
+        (newSize > pJournal->capacity))
+    {
+        const size_t newCapacity = Max(Pow2Pad(newSize), m_writeBehindBatchSize);
+        void* const  pMem        = PAL_MALLOC(newCapacity, Allocator(), AllocInternal);
+
+        if (pMem != nullptr)
+        {
+            if (pJournal->size > 0)
+            {
+                memcpy(pMem, pJournal->pMem, pJournal->size);
+            }
+
+            PAL_SAFE_FREE(pJournal->pMem, Allocator());
+            pJournal->pMem     = pMem;
+            pJournal->capacity = newCapacity;
+        }
+        else
+        {
+            PAL_ALERT_ALWAYS();
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const bool wasEmpty = (pJournal->size == 0);
+
+        if (wasEmpty)
+        {
+            pJournal->fileOffset = recordOffset;
+        }
+
+        // Records in a batch must be contiguous in the file
+        PAL_ASSERT((pJournal->fileOffset + pJournal->size) == recordOffset);
+
+        void* const pRecord = VoidPtrInc(pJournal->pMem, pJournal->size);
+        memcpy(pRecord, &header, sizeof(ArchiveEntryHeader));
+        memcpy(VoidPtrInc(pRecord, sizeof(ArchiveEntryHeader)), pData, header.dataSize);
+
+        pJournal->size              = newSize;
+        pJournal->footer            = m_cachedFooter;
+        pJournal->footer.entryCount = header.ordinalId + 1;
+
+        // Keep any cached pages coherent with what the file will contain once the batch lands
+        if (m_useBufferedMemory)
+        {
+            Result bufferedResult = WriteCached(recordOffset, pRecord, recordSize);
+            PAL_ALERT(IsErrorResult(bufferedResult));
+        }
+
+        // The first record opens a durability window; a full batch is committed without waiting for it to close
+        if (wasEmpty || (newSize >= m_writeBehindBatchSize))
+        {
+            m_journalCondVar.WakeAll();
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Copies a range out of the write-behind journal. Returns false if the range has already been committed to disk.
+bool ArchiveFile::ReadJournal(
+    size_t fileOffset,
+    void*  pBuffer,
+    size_t readSize)
+{
+    MutexAuto journalLock(&m_journalLock);
+
+    bool found = false;
+
+    for (uint32 i = 0; (i < ArrayLen(m_journal)) && (found == false); ++i)
+    {
+        const JournalBuffer& journal = m_journal[i];
+
+        if ((journal.size > 0)                 &&
+            (fileOffset >= journal.fileOffset) &&
+            ((fileOffset + readSize) <= (journal.fileOffset + journal.size)))
+        {
+            memcpy(pBuffer, VoidPtrInc(journal.pMem, fileOffset - journal.fileOffset), readSize);
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Body of the write-behind flush thread. Once a record is queued, other writers get until the durability window closes
+// (or a batch worth of data is queued) to join it. The whole batch plus a single footer update is then committed with
+// one gathered write while writers keep filling the other journal buffer.
+void ArchiveFile::FlushLoop()
+{
+    m_journalLock.Lock();
+
+    while (true)
+    {
+        JournalBuffer* const pJournal = &m_journal[m_activeJournal];
+
+        if ((pJournal->size == 0) ||
+            (m_writeBehindResult != Result::Success))
+        {
+            if (m_stopFlushThread)
+            {
+                break;
+            }
+
+            m_journalCondVar.Wait(&m_journalLock, UINT32_MAX);
+        }
+        else
+        {
+            if ((m_stopFlushThread == false) &&
+                (pJournal->size < m_writeBehindBatchSize))
+            {
+                m_journalCondVar.Wait(&m_journalLock, m_writeBehindWindowMs);
+            }
+
+            // The other buffer was emptied by the previous batch; hand it to the writers
+            m_activeJournal ^= 1;
+            m_journalCondVar.WakeAll();
+
+            ArchiveFileFooter footer = pJournal->footer;
+            iovec             iov[2] = {};
+            iov[0].iov_base = pJournal->pMem;
+            iov[0].iov_len  = pJournal->size;
+            iov[1].iov_base = &footer;
+            iov[1].iov_len  = sizeof(ArchiveFileFooter);
+
+            m_journalLock.Unlock();
+
+            const Result result = WriteDirectV(m_hFile, pJournal->fileOffset, iov, static_cast<uint32>(ArrayLen(iov)));
+
+            m_journalLock.Lock();
+
+            // On failure the batch stays in the journal so its entries remain readable, but nothing more is committed
+            if (result == Result::Success)
+            {
+                pJournal->size = 0;
+            }
+            else
+            {
+                m_writeBehindResult = result;
+            }
+
+            m_journalCondVar.WakeAll();
+        }
+    }
+
+    m_journalLock.Unlock();
+}
+
 // =====================================================================================================================
 // Copy data from cached memory pages
 Result ArchiveFile::ReadCached(
@@ -24,10 +24,15 @@
  **********************************************************************************************************************/
 #include "palArchiveFile.h"
 #include "palArchiveFileFmt.h"
+#include "palConditionVariable.h"
 #include "palIntrusiveList.h"
 #include "palLinearAllocator.h"
+#include "palMutex.h"
+#include "palThread.h"
 #include "palVector.h"
 
+struct iovec;
+
 namespace Util
 {
 constexpr int32 InvalidSysCall = -1; // value representing system call happens error for Linux
@@ -115,12 +120,32 @@ private:
         Node         m_node;        // Page's position in an LRU chain
     };
 
+    // =================================================================================================================
+    // Staging memory for write-behind. Holds back-to-back header+data records which land contiguously in the file.
+    struct JournalBuffer
+    {
+        void*             pMem;       // Staging memory
+        size_t            size;       // Bytes of records currently staged
+        size_t            capacity;   // Allocated size of pMem
+        size_t            fileOffset; // File offset of the first staged record
+        ArchiveFileFooter footer;     // Footer to write once the staged records have landed
+    };
+
     Result RefreshFile(bool forceRefresh);
 
     Result ReadNextEntry(const ArchiveEntryHeader* pCurheader, ArchiveEntryHeader* pNextHeader);
 
     Result ReadInternal(size_t fileOffset, void* pBuffer, size_t readSize, bool forceCacheReload);
-    Result WriteInternal(size_t fileOffset, const void* pData, size_t writeSize);
+    Result WriteInternalV(size_t fileOffset, iovec* pIov, uint32 iovCount);
+
+    // Write-behind journal
+    Result InitWriteBehind(const ArchiveFileOpenInfo* pInfo);
+    void   StopWriteBehind();
+    Result QueueWrite(const ArchiveEntryHeader& header, const void* pData);
+    bool   ReadJournal(size_t fileOffset, void* pBuffer, size_t readSize);
+    void   FlushLoop();
+
+    static void FlushThreadFunc(void* pParameter) { static_cast<ArchiveFile*>(pParameter)->FlushLoop(); }
 
     // "Cached" I/O API
     Result ReadCached(size_t fileOffset, void* pBuffer, size_t readSize, bool forceReload);
@@ -137,6 +162,11 @@ private:
     static constexpr size_t MaxPageSize  = 8 * 1024 * 1024;
     static constexpr size_t MinPageSize  = 256 * 1024;
 
+    // Write-behind defaults. Writers stall once MaxJournalBatches batches worth of data are queued behind the disk.
+    static constexpr uint32 DefaultWriteBehindWindowMs  = 50;
+    static constexpr size_t DefaultWriteBehindBatchSize = 1024 * 1024;
+    static constexpr size_t MaxJournalBatches           = 4;
+
     using EntryVector = Vector<ArchiveEntryHeader, 16, ForwardAllocator>;
 
     // Allocator
@@ -161,6 +191,18 @@ private:
     PageInfo                m_pages[MaxPageCount];
     size_t                  m_pageCount;
     size_t                  m_pageSize;
+
+    // Write-behind journal: MAY NOT BE INITIALIZED IF WRITE-BEHIND WAS NOT REQUESTED
+    bool                    m_useWriteBehind;
+    uint32                  m_writeBehindWindowMs;
+    size_t                  m_writeBehindBatchSize;
+    Thread                  m_flushThread;
+    Mutex                   m_journalLock;      // Protects the journal state below
+    ConditionVariable       m_journalCondVar;   // Signaled when records are queued or a batch has been committed
+    JournalBuffer           m_journal[2];       // Write() fills one buffer while the flush thread commits the other
+    uint32                  m_activeJournal;    // Index of the buffer Write() appends to
+    bool                    m_stopFlushThread;
+    Result                  m_writeBehindResult; // First failure hit by the flush thread. Halts further batches.
 };
 
 } //namespace Util
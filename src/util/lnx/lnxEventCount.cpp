@@ -0,0 +1,97 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palAssert.h"
+#include "palEventCount.h"
+#include "util/lnx/lnxTimeout.h"
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace Util
+{
+
+static_assert(sizeof(std::atomic<uint32>) == sizeof(int), "The futex word must be a plain 32-bit integer.");
+
+// =====================================================================================================================
+// Sleeps on the epoch futex until it no longer holds the key or the timeout expires.
+Result EventCount::Wait(
+    uint32 key,
+    uint32 milliseconds)
+{
+    constexpr uint32 Infinite = 0xFFFFFFFF;
+
+    // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC time, so EINTR retries don't extend the wait.
+    timespec timeout = { };
+    ComputeTimeoutExpiration(&timeout, uint64(milliseconds) * 1000 * 1000);
+
+    Result result = Result::Success;
+    bool   woken  = false;
+
+    while ((result == Result::Success) && (woken == false) && (m_epoch.load(std::memory_order_acquire) == key))
+    {
+        const long ret = syscall(SYS_futex,
+                                 reinterpret_cast<int*>(&m_epoch),
+                                 FUTEX_WAIT_BITSET_PRIVATE,
+                                 key,
+                                 (milliseconds == Infinite) ? nullptr : &timeout,
+                                 nullptr,
+                                 FUTEX_BITSET_MATCH_ANY);
+
+        if (ret == 0)
+        {
+            // Woken by Wake(); the caller checks its condition again anyway so we needn't check the epoch.
+            woken = true;
+        }
+        else if (errno == ETIMEDOUT)
+        {
+            result = Result::Timeout;
+        }
+        else
+        {
+            // EAGAIN means the epoch changed before we slept and EINTR means a signal arrived; the loop condition
+            // handles both.
+            PAL_ASSERT((errno == EAGAIN) || (errno == EINTR));
+        }
+    }
+
+    m_waiters.fetch_sub(1, std::memory_order_seq_cst);
+
+    return result;
+}
+
+// =====================================================================================================================
+void EventCount::Wake(
+    bool wakeAll)
+{
+    const int numToWake = wakeAll ? INT_MAX : 1;
+
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_epoch), FUTEX_WAKE_PRIVATE, numToWake, nullptr, nullptr, 0);
+}
+
+} // Util
@@ -23,6 +23,7 @@
  *
  **********************************************************************************************************************/
 
+#include "palSlabAllocator.h"
 #include "palSysMemory.h"
 #include <cstdlib>
 #include <unistd.h>
@@ -31,6 +32,7 @@
 namespace Util
 {
 
+#if PAL_BUILD_SLAB_ALLOCATOR == 0
 // =====================================================================================================================
 // Default pfnAlloc implementation used if the client doesn't specify allocation callbacks.  Memory will be allocated
 // from the standard C runtime.  Returns nullptr if the allocation fails.
@@ -57,6 +59,7 @@ static void PAL_STDCALL DefaultFreeCb(
 {
     free(pMem);
 }
+#endif
 
 // =====================================================================================================================
 // Initializes the specified allocation callback structure with the default Linux allocation callbacks.
@@ -67,8 +70,12 @@ Result OsInitDefaultAllocCallbacks(
     PAL_ASSERT(pAllocCb->pfnAlloc == nullptr);
     PAL_ASSERT(pAllocCb->pfnFree == nullptr);
 
+#if PAL_BUILD_SLAB_ALLOCATOR
+    SlabAllocator::InitAllocCallbacks(pAllocCb);
+#else
     pAllocCb->pfnAlloc = DefaultAllocCb;
     pAllocCb->pfnFree  = DefaultFreeCb;
+#endif
 
     return Result::Success;
 }
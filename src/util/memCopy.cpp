@@ -0,0 +1,434 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palInlineFuncs.h"
+#include "palMemCopy.h"
+#include "palSysUtil.h"
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PAL_STREAMING_MEM_X86 1
+#else
+#define PAL_STREAMING_MEM_X86 0
+#endif
+
+namespace Util
+{
+
+// Copies and fills smaller than this many bytes are done with normal stores. For small sizes the fence and the cost of
+// aligning the destination outweigh the benefit of bypassing the cache.
+constexpr size_t StreamingMinBytes = 1024;
+
+// Marks that the ISA has not been selected yet.
+constexpr uint32 UnknownIsa = UINT32_MAX;
+
+static std::atomic<uint32> s_streamingIsa(UnknownIsa);
+
+// =====================================================================================================================
+// Writes DWORDs with normal stores.
+static void FillTail(
+    uint32* pDst,
+    uint32  value,
+    size_t  numDwords)
+{
+    for (size_t i = 0; i < numDwords; ++i)
+    {
+        pDst[i] = value;
+    }
+}
+
+#if PAL_STREAMING_MEM_X86
+// =====================================================================================================================
+// Reads the XCR0 register, which tells us which register state the OS saves on context switches.
+static uint64 ReadXcr0()
+{
+    uint32 lo = 0;
+    uint32 hi = 0;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+
+    return ((static_cast<uint64>(hi) << 32) | lo);
+}
+
+// =====================================================================================================================
+// Copies bytes with normal stores until pDst is aligned to the vector width, updating the caller's pointers and size.
+static void AlignCopyDestination(
+    uint8**       ppDst,
+    const uint8** ppSrc,
+    size_t*       pNumBytes,
+    size_t        alignment)
+{
+    const size_t misalignment = (reinterpret_cast<uintptr_t>(*ppDst) & (alignment - 1));
+    const size_t headBytes    = (misalignment == 0) ? 0 : Min(alignment - misalignment, *pNumBytes);
+
+    memcpy(*ppDst, *ppSrc, headBytes);
+
+    *ppDst     += headBytes;
+    *ppSrc     += headBytes;
+    *pNumBytes -= headBytes;
+}
+
+// =====================================================================================================================
+// Writes DWORDs with normal stores until pDst is aligned to the vector width, updating the caller's pointer and size.
+static void AlignFillDestination(
+    uint32** ppDst,
+    uint32   value,
+    size_t*  pNumDwords,
+    size_t   alignment)
+{
+    while ((*pNumDwords > 0) && ((reinterpret_cast<uintptr_t>(*ppDst) & (alignment - 1)) != 0))
+    {
+        *(*ppDst)++ = value;
+        (*pNumDwords)--;
+    }
+}
+
+// =====================================================================================================================
+__attribute__((target("sse2")))
+static void StreamingCopySse2(
+    uint8*       pDst,
+    const uint8* pSrc,
+    size_t       numBytes)
+{
+    constexpr size_t VecBytes = sizeof(__m128i);
+
+    AlignCopyDestination(&pDst, &pSrc, &numBytes, VecBytes);
+
+    for (; numBytes >= (VecBytes * 4); numBytes -= (VecBytes * 4))
+    {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + VecBytes));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (VecBytes * 2)));
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (VecBytes * 3)));
+
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst),                    v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + VecBytes),         v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + (VecBytes * 2)),   v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + (VecBytes * 3)),   v3);
+
+        pDst += (VecBytes * 4);
+        pSrc += (VecBytes * 4);
+    }
+
+    for (; numBytes >= VecBytes; numBytes -= VecBytes)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)));
+
+        pDst += VecBytes;
+        pSrc += VecBytes;
+    }
+
+    memcpy(pDst, pSrc, numBytes);
+    _mm_sfence();
+}
+
+// =====================================================================================================================
+__attribute__((target("avx2")))
+static void StreamingCopyAvx2(
+    uint8*       pDst,
+    const uint8* pSrc,
+    size_t       numBytes)
+{
+    constexpr size_t VecBytes = sizeof(__m256i);
+
+    AlignCopyDestination(&pDst, &pSrc, &numBytes, VecBytes);
+
+    for (; numBytes >= (VecBytes * 4); numBytes -= (VecBytes * 4))
+    {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + VecBytes));
+        const __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + (VecBytes * 2)));
+        const __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + (VecBytes * 3)));
+
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst),                  v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst + VecBytes),       v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst + (VecBytes * 2)), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst + (VecBytes * 3)), v3);
+
+        pDst += (VecBytes * 4);
+        pSrc += (VecBytes * 4);
+    }
+
+    for (; numBytes >= VecBytes; numBytes -= VecBytes)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc)));
+
+        pDst += VecBytes;
+        pSrc += VecBytes;
+    }
+
+    memcpy(pDst, pSrc, numBytes);
+    _mm_sfence();
+}
+
+// =====================================================================================================================
+__attribute__((target("avx512f")))
+static void StreamingCopyAvx512(
+    uint8*       pDst,
+    const uint8* pSrc,
+    size_t       numBytes)
+{
+    constexpr size_t VecBytes = sizeof(__m512i);
+
+    AlignCopyDestination(&pDst, &pSrc, &numBytes, VecBytes);
+
+    for (; numBytes >= (VecBytes * 2); numBytes -= (VecBytes * 2))
+    {
+        const __m512i v0 = _mm512_loadu_si512(pSrc);
+        const __m512i v1 = _mm512_loadu_si512(pSrc + VecBytes);
+
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(pDst),            v0);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(pDst + VecBytes), v1);
+
+        pDst += (VecBytes * 2);
+        pSrc += (VecBytes * 2);
+    }
+
+    for (; numBytes >= VecBytes; numBytes -= VecBytes)
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(pDst), _mm512_loadu_si512(pSrc));
+
+        pDst += VecBytes;
+        pSrc += VecBytes;
+    }
+
+    memcpy(pDst, pSrc, numBytes);
+    _mm_sfence();
+}
+
+// =====================================================================================================================
+__attribute__((target("sse2")))
+static void StreamingFillSse2(
+    uint32* pDst,
+    uint32  value,
+    size_t  numDwords)
+{
+    constexpr size_t VecBytes  = sizeof(__m128i);
+    constexpr size_t VecDwords = VecBytes / sizeof(uint32);
+
+    AlignFillDestination(&pDst, value, &numDwords, VecBytes);
+
+    const __m128i vec = _mm_set1_epi32(static_cast<int32>(value));
+
+    for (; numDwords >= VecDwords; numDwords -= VecDwords)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDst), vec);
+        pDst += VecDwords;
+    }
+
+    FillTail(pDst, value, numDwords);
+    _mm_sfence();
+}
+
+// =====================================================================================================================
+__attribute__((target("avx2")))
+static void StreamingFillAvx2(
+    uint32* pDst,
+    uint32  value,
+    size_t  numDwords)
+{
+    constexpr size_t VecBytes  = sizeof(__m256i);
+    constexpr size_t VecDwords = VecBytes / sizeof(uint32);
+
+    AlignFillDestination(&pDst, value, &numDwords, VecBytes);
+
+    const __m256i vec = _mm256_set1_epi32(static_cast<int32>(value));
+
+    for (; numDwords >= VecDwords; numDwords -= VecDwords)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(pDst), vec);
+        pDst += VecDwords;
+    }
+
+    FillTail(pDst, value, numDwords);
+    _mm_sfence();
+}
+
+// =====================================================================================================================
+__attribute__((target("avx512f")))
+static void StreamingFillAvx512(
+    uint32* pDst,
+    uint32  value,
+    size_t  numDwords)
+{
+    constexpr size_t VecBytes  = sizeof(__m512i);
+    constexpr size_t VecDwords = VecBytes / sizeof(uint32);
+
+    AlignFillDestination(&pDst, value, &numDwords, VecBytes);
+
+    const __m512i vec = _mm512_set1_epi32(static_cast<int32>(value));
+
+    for (; numDwords >= VecDwords; numDwords -= VecDwords)
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(pDst), vec);
+        pDst += VecDwords;
+    }
+
+    FillTail(pDst, value, numDwords);
+    _mm_sfence();
+}
+#endif
+
+// =====================================================================================================================
+// Picks the widest instruction set that both the CPU and the OS support.
+static StreamingMemIsa DetectStreamingMemIsa()
+{
+    StreamingMemIsa isa = StreamingMemIsa::Scalar;
+
+#if PAL_STREAMING_MEM_X86
+    constexpr uint32 Leaf1EdxSse2       = (1u << 26);
+    constexpr uint32 Leaf1EcxOsXsave    = (1u << 27);
+    constexpr uint32 Leaf1EcxAvx        = (1u << 28);
+    constexpr uint32 Leaf7EbxAvx2       = (1u << 5);
+    constexpr uint32 Leaf7EbxAvx512f    = (1u << 16);
+    constexpr uint64 Xcr0YmmState       = 0x06;  // SSE and AVX state.
+    constexpr uint64 Xcr0ZmmState       = 0xE6;  // SSE, AVX, opmask and upper ZMM state.
+
+    uint32 regs[4] = {};
+    CpuId(regs, 0);
+    const uint32 maxLeaf = regs[0];
+
+    CpuId(regs, 1);
+    const uint32 leaf1Ecx = regs[2];
+    const uint32 leaf1Edx = regs[3];
+
+    if ((leaf1Edx & Leaf1EdxSse2) != 0)
+    {
+        isa = StreamingMemIsa::Sse2;
+    }
+
+    if ((maxLeaf >= 7) && ((leaf1Ecx & Leaf1EcxOsXsave) != 0) && ((leaf1Ecx & Leaf1EcxAvx) != 0))
+    {
+        const uint64 xcr0 = ReadXcr0();
+
+        CpuId(regs, 7, 0);
+        const uint32 leaf7Ebx = regs[1];
+
+        if (((xcr0 & Xcr0YmmState) == Xcr0YmmState) && ((leaf7Ebx & Leaf7EbxAvx2) != 0))
+        {
+            isa = StreamingMemIsa::Avx2;
+        }
+
+        if (((xcr0 & Xcr0ZmmState) == Xcr0ZmmState) && ((leaf7Ebx & Leaf7EbxAvx512f) != 0))
+        {
+            isa = StreamingMemIsa::Avx512;
+        }
+    }
+#endif
+
+    return isa;
+}
+
+// =====================================================================================================================
+// Returns the instruction set used by the streaming kernels, detecting it on the first call. Racing threads will all
+// detect the same value so there's no need to synchronize beyond the atomic store.
+StreamingMemIsa GetStreamingMemIsa()
+{
+    uint32 isa = s_streamingIsa.load(std::memory_order_relaxed);
+
+    if (isa == UnknownIsa)
+    {
+        isa = static_cast<uint32>(DetectStreamingMemIsa());
+        s_streamingIsa.store(isa, std::memory_order_relaxed);
+    }
+
+    return static_cast<StreamingMemIsa>(isa);
+}
+
+// =====================================================================================================================
+// Copies numBytes from pSrc to pDst using non-temporal stores if the copy is large enough to benefit from them.
+void StreamingMemCopy(
+    void*       pDst,
+    const void* pSrc,
+    size_t      numBytes)
+{
+    PAL_ASSERT((numBytes == 0) || ((pDst != nullptr) && (pSrc != nullptr)));
+    PAL_ASSERT((VoidPtrInc(pDst, numBytes) <= pSrc) || (VoidPtrInc(pSrc, numBytes) <= pDst));
+
+    const StreamingMemIsa isa = (numBytes >= StreamingMinBytes) ? GetStreamingMemIsa() : StreamingMemIsa::Scalar;
+
+#if PAL_STREAMING_MEM_X86
+    uint8*const       pDstBytes = static_cast<uint8*>(pDst);
+    const uint8*const pSrcBytes = static_cast<const uint8*>(pSrc);
+
+    switch (isa)
+    {
+    case StreamingMemIsa::Avx512:
+        StreamingCopyAvx512(pDstBytes, pSrcBytes, numBytes);
+        break;
+    case StreamingMemIsa::Avx2:
+        StreamingCopyAvx2(pDstBytes, pSrcBytes, numBytes);
+        break;
+    case StreamingMemIsa::Sse2:
+        StreamingCopySse2(pDstBytes, pSrcBytes, numBytes);
+        break;
+    default:
+        memcpy(pDst, pSrc, numBytes);
+        break;
+    }
+#else
+    PAL_ASSERT(isa == StreamingMemIsa::Scalar);
+    memcpy(pDst, pSrc, numBytes);
+#endif
+}
+
+// =====================================================================================================================
+// Writes value to numDwords DWORDs at pDst using non-temporal stores if the fill is large enough to benefit from them.
+void StreamingMemFill32(
+    uint32* pDst,
+    uint32  value,
+    size_t  numDwords)
+{
+    PAL_ASSERT((numDwords == 0) || (pDst != nullptr));
+    PAL_ASSERT(IsPow2Aligned(reinterpret_cast<uintptr_t>(pDst), sizeof(uint32)));
+
+    const StreamingMemIsa isa = ((numDwords * sizeof(uint32)) >= StreamingMinBytes) ? GetStreamingMemIsa()
+                                                                                    : StreamingMemIsa::Scalar;
+
+#if PAL_STREAMING_MEM_X86
+    switch (isa)
+    {
+    case StreamingMemIsa::Avx512:
+        StreamingFillAvx512(pDst, value, numDwords);
+        break;
+    case StreamingMemIsa::Avx2:
+        StreamingFillAvx2(pDst, value, numDwords);
+        break;
+    case StreamingMemIsa::Sse2:
+        StreamingFillSse2(pDst, value, numDwords);
+        break;
+    default:
+        FillTail(pDst, value, numDwords);
+        break;
+    }
+#else
+    PAL_ASSERT(isa == StreamingMemIsa::Scalar);
+    FillTail(pDst, value, numDwords);
+#endif
+}
+
+} // Util
@@ -0,0 +1,939 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palMutex.h"
+#include "palSlabAllocator.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Util
+{
+namespace SlabAllocator
+{
+
+// Slabs are carved out of superblocks of reserved address space. Both are aligned to their size so that the slab
+// header of any small object can be found by masking its address.
+constexpr size_t SlabSize           = 64 * 1024;
+constexpr size_t SuperblockSize     = 4 * 1024 * 1024;
+constexpr uint32 SlabsPerSuperblock = static_cast<uint32>(SuperblockSize / SlabSize);
+constexpr size_t SlabHeaderSize     = PAL_CACHE_LINE_BYTES;
+
+// Superblock addresses are kept in an insert-only, open addressed hash table so that Free() can tell slab memory apart
+// from large allocations without taking a lock. The table is never filled past half of its slots to keep the probe
+// sequences short, which caps the small object heap at 2048 superblocks (8GB of address space). Once the cap is hit,
+// small requests fall back to large allocations.
+constexpr uint32 SuperblockTableSize = 4096;
+constexpr uint32 MaxSuperblocks      = SuperblockTableSize / 2;
+
+// Small allocations are rounded up to one of these size classes. Anything larger, or anything which needs more than
+// the minimum alignment, is a large allocation.
+constexpr size_t MinAlignment       = 16;
+constexpr size_t MaxSmallSize       = 4096;
+constexpr uint32 NumSizeClasses     = 28;
+
+static constexpr uint32 SizeClassSizes[NumSizeClasses] =
+{
+      16,   32,   48,   64,   80,   96,  112,  128,
+     160,  192,  224,  256,
+     320,  384,  448,  512,
+     640,  768,  896, 1024,
+    1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096,
+};
+
+// Number of empty slabs each arena keeps committed before it starts returning their memory to the OS.
+constexpr uint32 MaxCommittedEmptySlabs = 4;
+
+// Arenas for each PAL SystemAllocType plus one shared by all client-defined types.
+constexpr uint32 NumCategories      = 5;
+constexpr uint32 ClientCategory     = NumCategories - 1;
+
+// Free objects are linked through their first bytes.
+struct FreeObject
+{
+    FreeObject* pNext;
+};
+
+// Lives at the start of every slab.
+struct Slab
+{
+    Slab*       pNext;      // Links the slab into its arena's partial, empty or decommitted list.
+    Slab*       pPrev;      // Only used by the partial lists.
+    FreeObject* pFreeList;  // Freed objects which can be reused.
+    uint32      category;
+    uint32      sizeClass;
+    uint32      numObjects; // Total number of objects which fit in the slab.
+    uint32      numCarved;  // Objects past this index have never been handed out.
+    uint32      numFree;    // Objects which are either in the free list or not carved yet.
+};
+
+static_assert(sizeof(Slab) <= SlabHeaderSize, "The slab header must fit in front of the first object.");
+
+// Per-category arena. All fields are protected by the lock.
+struct Arena
+{
+    Mutex  lock;
+    Slab*  pPartial[NumSizeClasses]; // Slabs with some, but not all, objects free.
+    Slab*  pEmpty;                   // Committed slabs with no live objects.
+    uint32 numEmpty;
+    Slab*  pDecommitted;             // Slabs whose object memory has been returned to the OS.
+    uint8* pSuperblockCursor;        // Next unused slab in this arena's current superblock.
+    uint32 slabsLeftInSuperblock;
+    int64  liveBytes;
+    uint64 peakLiveBytes;
+    uint64 numAllocs;
+    uint64 numFrees;
+    uint64 committedBytes;
+    int64  lastQueryTicks;           // CPU timestamp and allocation count of the previous QueryStats() call, used to
+    uint64 lastQueryNumAllocs;       // compute the allocation rate.
+};
+
+// A thread's cache of free objects for one size class.
+struct Magazine
+{
+    FreeObject* pHead;
+    uint32      count;
+};
+
+// Per-thread cache. The statistics counters are folded into the arenas whenever the thread takes an arena lock.
+struct ThreadCache
+{
+    Magazine magazines[NumCategories][NumSizeClasses];
+    int64    liveBytesDelta[NumCategories];
+    uint64   numAllocs[NumCategories];
+    uint64   numFrees[NumCategories];
+    bool     destroyed; // Set once the thread is exiting; later calls on this thread bypass the cache.
+
+    ~ThreadCache();
+};
+
+// The process-wide allocator state.
+class Heap
+{
+public:
+    Heap();
+
+    void* AllocSmall(ThreadCache* pCache, uint32 category, uint32 sizeClass);
+    void  FreeSmall(ThreadCache* pCache, Slab* pSlab, FreeObject* pObject);
+    void* AllocLarge(size_t size, size_t alignment, uint32 category);
+    void  FreeLarge(void* pMem);
+
+    Slab* FindSlab(const void* pMem) const;
+    void  FlushCache(ThreadCache* pCache);
+    void  Trim();
+    void  QueryStats(uint32 category, Stats* pStats);
+
+    uint32 SizeToClass(size_t size) const { return m_sizeToClass[(size + MinAlignment - 1) / MinAlignment]; }
+
+private:
+    void  Refill(ThreadCache* pCache, uint32 category, uint32 sizeClass);
+    void  ReturnObjects(uint32 category, FreeObject* pHead);
+    void  PublishStats(ThreadCache* pCache, uint32 category);
+    Slab* AcquireSlab(uint32 category, uint32 sizeClass);
+    void  ReleaseEmptySlab(uint32 category, Slab* pSlab);
+    void  DecommitSlab(uint32 category, Slab* pSlab);
+    bool  AllocSuperblock(uint32 category);
+    void  UnlinkPartial(Arena* pArena, Slab* pSlab);
+    void  LinkPartial(Arena* pArena, Slab* pSlab);
+
+    Arena                    m_arenas[NumCategories];
+    Mutex                    m_superblockLock;
+    std::atomic<uintptr_t>   m_superblocks[SuperblockTableSize];
+    uint32                   m_numSuperblocks;
+    size_t                   m_pageSize;
+    uint8                    m_sizeToClass[(MaxSmallSize / MinAlignment) + 1];
+};
+
+// Header written in front of every large allocation so that it can be freed and accounted for.
+struct LargeHeader
+{
+    size_t size;
+    uint32 category;
+    uint32 offset;  // Distance from the start of the malloc'd block to the returned pointer.
+};
+
+static_assert(sizeof(LargeHeader) <= MinAlignment, "The large allocation header must fit in the minimum alignment.");
+
+static thread_local ThreadCache t_threadCache = {};
+
+// =====================================================================================================================
+// Returns the process-wide heap, constructing it on first use. It's never destroyed because other threads may still be
+// freeing memory during process teardown.
+static Heap* GetHeap()
+{
+    alignas(Heap) static uint8 s_heapStorage[sizeof(Heap)];
+    static Heap*const          s_pHeap = new (s_heapStorage) Heap();
+
+    return s_pHeap;
+}
+
+// =====================================================================================================================
+// Maps a SystemAllocType to its arena index.
+static uint32 CategoryIndex(
+    SystemAllocType allocType)
+{
+    uint32 category = ClientCategory;
+
+    switch (allocType)
+    {
+    case AllocObject:
+        category = 0;
+        break;
+    case AllocInternal:
+        category = 1;
+        break;
+    case AllocInternalTemp:
+        category = 2;
+        break;
+    case AllocInternalShader:
+        category = 3;
+        break;
+    default:
+        break;
+    }
+
+    return category;
+}
+
+// =====================================================================================================================
+// Returns how many objects a thread moves between its magazine and the arena at once. Smaller objects are moved in
+// larger batches so that each batch is roughly the same number of bytes.
+static uint32 BatchSize(
+    uint32 sizeClass)
+{
+    return Max(4u, Min(32u, static_cast<uint32>(8192 / SizeClassSizes[sizeClass])));
+}
+
+// =====================================================================================================================
+// Hashes a superblock address into the superblock table.
+static uint32 SuperblockHash(
+    uintptr_t superblock)
+{
+    return static_cast<uint32>((superblock / SuperblockSize) * 2654435761u) % SuperblockTableSize;
+}
+
+// =====================================================================================================================
+ThreadCache::~ThreadCache()
+{
+    GetHeap()->FlushCache(this);
+    destroyed = true;
+}
+
+// =====================================================================================================================
+Heap::Heap()
+    :
+    m_numSuperblocks(0),
+    m_pageSize(VirtualPageSize())
+{
+    for (uint32 i = 0; i < NumCategories; ++i)
+    {
+        Arena*const pArena = &m_arenas[i];
+
+        memset(&pArena->pPartial[0], 0, sizeof(pArena->pPartial));
+        pArena->pEmpty                = nullptr;
+        pArena->numEmpty              = 0;
+        pArena->pDecommitted          = nullptr;
+        pArena->pSuperblockCursor     = nullptr;
+        pArena->slabsLeftInSuperblock = 0;
+        pArena->liveBytes             = 0;
+        pArena->peakLiveBytes         = 0;
+        pArena->numAllocs             = 0;
+        pArena->numFrees              = 0;
+        pArena->committedBytes        = 0;
+        pArena->lastQueryTicks        = GetPerfCpuTime();
+        pArena->lastQueryNumAllocs    = 0;
+
+        const Result result = pArena->lock.Init();
+        PAL_ASSERT(result == Result::Success);
+    }
+
+    const Result result = m_superblockLock.Init();
+    PAL_ASSERT(result == Result::Success);
+
+    for (uint32 i = 0; i < SuperblockTableSize; ++i)
+    {
+        m_superblocks[i].store(0, std::memory_order_relaxed);
+    }
+
+    // Build the size to size class lookup table, indexed by size in units of MinAlignment.
+    uint32 sizeClass = 0;
+    for (uint32 i = 0; i <= (MaxSmallSize / MinAlignment); ++i)
+    {
+        while ((i * MinAlignment) > SizeClassSizes[sizeClass])
+        {
+            sizeClass++;
+        }
+
+        m_sizeToClass[i] = static_cast<uint8>(sizeClass);
+    }
+}
+
+// =====================================================================================================================
+// Returns the slab which owns pMem, or null if pMem is not slab memory.
+Slab* Heap::FindSlab(
+    const void* pMem
+    ) const
+{
+    const uintptr_t superblock = (reinterpret_cast<uintptr_t>(pMem) & ~(SuperblockSize - 1));
+    Slab*           pSlab      = nullptr;
+
+    for (uint32 i = 0, slot = SuperblockHash(superblock);
+         i < SuperblockTableSize;
+         ++i, slot = (slot + 1) % SuperblockTableSize)
+    {
+        const uintptr_t entry = m_superblocks[slot].load(std::memory_order_acquire);
+
+        if (entry == superblock)
+        {
+            pSlab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(pMem) & ~(SlabSize - 1));
+            break;
+        }
+        else if (entry == 0)
+        {
+            break;
+        }
+    }
+
+    return pSlab;
+}
+
+// =====================================================================================================================
+// Pops an object from the thread's magazine, refilling it from the arena if it's empty.
+void* Heap::AllocSmall(
+    ThreadCache* pCache,
+    uint32       category,
+    uint32       sizeClass)
+{
+    Magazine*const pMagazine = &pCache->magazines[category][sizeClass];
+
+    if (pMagazine->pHead == nullptr)
+    {
+        Refill(pCache, category, sizeClass);
+    }
+
+    FreeObject*const pObject = pMagazine->pHead;
+
+    if (pObject != nullptr)
+    {
+        pMagazine->pHead = pObject->pNext;
+        pMagazine->count--;
+
+        pCache->numAllocs[category]++;
+        pCache->liveBytesDelta[category] += SizeClassSizes[sizeClass];
+    }
+
+    return pObject;
+}
+
+// =====================================================================================================================
+// Pushes an object onto the thread's magazine, returning half of the magazine to the arena if it grows too large.
+void Heap::FreeSmall(
+    ThreadCache* pCache,
+    Slab*        pSlab,
+    FreeObject*  pObject)
+{
+    const uint32   category  = pSlab->category;
+    const uint32   sizeClass = pSlab->sizeClass;
+    Magazine*const pMagazine = &pCache->magazines[category][sizeClass];
+
+    pObject->pNext   = pMagazine->pHead;
+    pMagazine->pHead = pObject;
+    pMagazine->count++;
+
+    pCache->numFrees[category]++;
+    pCache->liveBytesDelta[category] -= SizeClassSizes[sizeClass];
+
+    const uint32 batchSize = BatchSize(sizeClass);
+
+    if (pMagazine->count > (batchSize * 2))
+    {
+        // Detach the first batch of objects from the magazine and give them back to their slabs.
+        FreeObject* pLast = pMagazine->pHead;
+        for (uint32 i = 1; i < batchSize; ++i)
+        {
+            pLast = pLast->pNext;
+        }
+
+        FreeObject*const pHead = pMagazine->pHead;
+        pMagazine->pHead = pLast->pNext;
+        pMagazine->count -= batchSize;
+        pLast->pNext     = nullptr;
+
+        MutexAuto lock(&m_arenas[category].lock);
+        PublishStats(pCache, category);
+        ReturnObjects(category, pHead);
+    }
+}
+
+// =====================================================================================================================
+// Moves one batch of objects from the arena's slabs into the thread's magazine.
+void Heap::Refill(
+    ThreadCache* pCache,
+    uint32       category,
+    uint32       sizeClass)
+{
+    Arena*const    pArena    = &m_arenas[category];
+    Magazine*const pMagazine = &pCache->magazines[category][sizeClass];
+    const uint32   batchSize = BatchSize(sizeClass);
+    const uint32   objSize   = SizeClassSizes[sizeClass];
+
+    MutexAuto lock(&pArena->lock);
+    PublishStats(pCache, category);
+
+    while (pMagazine->count < batchSize)
+    {
+        Slab* pSlab = pArena->pPartial[sizeClass];
+
+        if (pSlab == nullptr)
+        {
+            pSlab = AcquireSlab(category, sizeClass);
+
+            if (pSlab == nullptr)
+            {
+                break;
+            }
+
+            LinkPartial(pArena, pSlab);
+        }
+
+        while ((pSlab->numFree > 0) && (pMagazine->count < batchSize))
+        {
+            FreeObject* pObject = pSlab->pFreeList;
+
+            if (pObject != nullptr)
+            {
+                pSlab->pFreeList = pObject->pNext;
+            }
+            else
+            {
+                PAL_ASSERT(pSlab->numCarved < pSlab->numObjects);
+                pObject = static_cast<FreeObject*>(VoidPtrInc(pSlab, SlabHeaderSize + (pSlab->numCarved * objSize)));
+                pSlab->numCarved++;
+            }
+
+            pObject->pNext   = pMagazine->pHead;
+            pMagazine->pHead = pObject;
+            pMagazine->count++;
+            pSlab->numFree--;
+        }
+
+        if (pSlab->numFree == 0)
+        {
+            UnlinkPartial(pArena, pSlab);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns a list of objects to their slabs. The caller must hold the arena lock.
+void Heap::ReturnObjects(
+    uint32      category,
+    FreeObject* pHead)
+{
+    Arena*const pArena = &m_arenas[category];
+
+    while (pHead != nullptr)
+    {
+        FreeObject*const pObject = pHead;
+        pHead = pHead->pNext;
+
+        Slab*const pSlab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(pObject) & ~(SlabSize - 1));
+        PAL_ASSERT(pSlab->category == category);
+
+        pObject->pNext   = pSlab->pFreeList;
+        pSlab->pFreeList = pObject;
+        pSlab->numFree++;
+
+        if (pSlab->numFree == pSlab->numObjects)
+        {
+            if (pSlab->numObjects > 1)
+            {
+                UnlinkPartial(pArena, pSlab);
+            }
+
+            ReleaseEmptySlab(category, pSlab);
+        }
+        else if (pSlab->numFree == 1)
+        {
+            // The slab was full so it wasn't in the partial list.
+            LinkPartial(pArena, pSlab);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Folds the thread's batched statistics into the arena. The caller must hold the arena lock.
+void Heap::PublishStats(
+    ThreadCache* pCache,
+    uint32       category)
+{
+    Arena*const pArena = &m_arenas[category];
+
+    pArena->liveBytes     += pCache->liveBytesDelta[category];
+    pArena->numAllocs     += pCache->numAllocs[category];
+    pArena->numFrees      += pCache->numFrees[category];
+    pArena->peakLiveBytes  = Max(pArena->peakLiveBytes, static_cast<uint64>(Max(pArena->liveBytes, int64(0))));
+
+    pCache->liveBytesDelta[category] = 0;
+    pCache->numAllocs[category]      = 0;
+    pCache->numFrees[category]       = 0;
+}
+
+// =====================================================================================================================
+// Finds a slab with no live objects and formats it for the given size class. Reuses empty slabs first, then slabs
+// whose memory was returned to the OS, and finally carves a new slab out of a superblock. The caller must hold the
+// arena lock.
+Slab* Heap::AcquireSlab(
+    uint32 category,
+    uint32 sizeClass)
+{
+    Arena*const  pArena     = &m_arenas[category];
+    const size_t headerSize = Pow2Align(SlabHeaderSize, m_pageSize);
+    Slab*        pSlab      = nullptr;
+
+    if (pArena->pEmpty != nullptr)
+    {
+        pSlab            = pArena->pEmpty;
+        pArena->pEmpty   = pSlab->pNext;
+        pArena->numEmpty--;
+    }
+    else if ((pArena->pDecommitted != nullptr) &&
+             (VirtualCommit(VoidPtrInc(pArena->pDecommitted, headerSize), SlabSize - headerSize) == Result::Success))
+    {
+        pSlab                  = pArena->pDecommitted;
+        pArena->pDecommitted   = pSlab->pNext;
+        pArena->committedBytes += SlabSize - headerSize;
+    }
+    else if ((pArena->slabsLeftInSuperblock > 0) || AllocSuperblock(category))
+    {
+        void*const pMem = pArena->pSuperblockCursor;
+
+        if (VirtualCommit(pMem, SlabSize) == Result::Success)
+        {
+            pSlab = static_cast<Slab*>(pMem);
+
+            pArena->pSuperblockCursor += SlabSize;
+            pArena->slabsLeftInSuperblock--;
+            pArena->committedBytes    += SlabSize;
+        }
+    }
+
+    if (pSlab != nullptr)
+    {
+        pSlab->pNext      = nullptr;
+        pSlab->pPrev      = nullptr;
+        pSlab->pFreeList  = nullptr;
+        pSlab->category   = category;
+        pSlab->sizeClass  = sizeClass;
+        pSlab->numObjects = static_cast<uint32>((SlabSize - SlabHeaderSize) / SizeClassSizes[sizeClass]);
+        pSlab->numCarved  = 0;
+        pSlab->numFree    = pSlab->numObjects;
+    }
+
+    return pSlab;
+}
+
+// =====================================================================================================================
+// Adds a slab with no live objects to the arena's empty list, returning its memory to the OS if the arena already has
+// enough empty slabs. The caller must hold the arena lock.
+void Heap::ReleaseEmptySlab(
+    uint32 category,
+    Slab*  pSlab)
+{
+    Arena*const pArena = &m_arenas[category];
+
+    if (pArena->numEmpty < MaxCommittedEmptySlabs)
+    {
+        pSlab->pNext   = pArena->pEmpty;
+        pArena->pEmpty = pSlab;
+        pArena->numEmpty++;
+    }
+    else
+    {
+        DecommitSlab(category, pSlab);
+    }
+}
+
+// =====================================================================================================================
+// Returns the memory behind a slab's objects to the OS. The page holding the header stays committed so that the slab
+// can stay linked into the decommitted list. The caller must hold the arena lock.
+void Heap::DecommitSlab(
+    uint32 category,
+    Slab*  pSlab)
+{
+    Arena*const  pArena     = &m_arenas[category];
+    const size_t headerSize = Pow2Align(SlabHeaderSize, m_pageSize);
+
+    if ((headerSize < SlabSize) &&
+        (VirtualDecommit(VoidPtrInc(pSlab, headerSize), SlabSize - headerSize) == Result::Success))
+    {
+        pSlab->pNext           = pArena->pDecommitted;
+        pArena->pDecommitted   = pSlab;
+        pArena->committedBytes -= SlabSize - headerSize;
+    }
+    else
+    {
+        // Keep the slab committed if we can't decommit it.
+        pSlab->pNext   = pArena->pEmpty;
+        pArena->pEmpty = pSlab;
+        pArena->numEmpty++;
+    }
+}
+
+// =====================================================================================================================
+// Reserves a new superblock for the given arena. The caller must hold the arena lock.
+bool Heap::AllocSuperblock(
+    uint32 category)
+{
+    Arena*const pArena = &m_arenas[category];
+    bool        result = false;
+
+    MutexAuto lock(&m_superblockLock);
+
+    // The OS only guarantees page alignment, so reserve twice the superblock size to be able to align the superblock to
+    // its size, then give the unaligned head and tail back right away. Only SuperblockSize bytes of address space stay
+    // reserved per superblock.
+    void* pReservation = nullptr;
+
+    if ((m_numSuperblocks < MaxSuperblocks) &&
+        (VirtualReserve(SuperblockSize * 2, &pReservation) == Result::Success))
+    {
+        const uintptr_t reservation = reinterpret_cast<uintptr_t>(pReservation);
+        const uintptr_t superblock  = Pow2Align(reservation, SuperblockSize);
+        const size_t    headSize    = static_cast<size_t>(superblock - reservation);
+        const size_t    tailSize    = SuperblockSize - headSize;
+
+        if (headSize > 0)
+        {
+            VirtualRelease(pReservation, headSize);
+        }
+
+        if (tailSize > 0)
+        {
+            VirtualRelease(reinterpret_cast<void*>(superblock + SuperblockSize), tailSize);
+        }
+
+        uint32 slot = SuperblockHash(superblock);
+        while (m_superblocks[slot].load(std::memory_order_relaxed) != 0)
+        {
+            slot = (slot + 1) % SuperblockTableSize;
+        }
+
+        m_superblocks[slot].store(superblock, std::memory_order_release);
+        m_numSuperblocks++;
+
+        pArena->pSuperblockCursor     = reinterpret_cast<uint8*>(superblock);
+        pArena->slabsLeftInSuperblock = SlabsPerSuperblock;
+
+        result = true;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void Heap::LinkPartial(
+    Arena* pArena,
+    Slab*  pSlab)
+{
+    Slab*const pHead = pArena->pPartial[pSlab->sizeClass];
+
+    pSlab->pPrev = nullptr;
+    pSlab->pNext = pHead;
+
+    if (pHead != nullptr)
+    {
+        pHead->pPrev = pSlab;
+    }
+
+    pArena->pPartial[pSlab->sizeClass] = pSlab;
+}
+
+// =====================================================================================================================
+void Heap::UnlinkPartial(
+    Arena* pArena,
+    Slab*  pSlab)
+{
+    if (pSlab->pPrev != nullptr)
+    {
+        pSlab->pPrev->pNext = pSlab->pNext;
+    }
+    else
+    {
+        PAL_ASSERT(pArena->pPartial[pSlab->sizeClass] == pSlab);
+        pArena->pPartial[pSlab->sizeClass] = pSlab->pNext;
+    }
+
+    if (pSlab->pNext != nullptr)
+    {
+        pSlab->pNext->pPrev = pSlab->pPrev;
+    }
+
+    pSlab->pNext = nullptr;
+    pSlab->pPrev = nullptr;
+}
+
+// =====================================================================================================================
+// Allocates memory which doesn't fit in any size class from the C runtime, with a header in front of it.
+void* Heap::AllocLarge(
+    size_t size,
+    size_t alignment,
+    uint32 category)
+{
+    alignment = Max(alignment, MinAlignment);
+
+    void*const pBlock = malloc(size + alignment + sizeof(LargeHeader));
+    void*      pMem   = nullptr;
+
+    if (pBlock != nullptr)
+    {
+        pMem = reinterpret_cast<void*>(Pow2Align(reinterpret_cast<uintptr_t>(pBlock) + sizeof(LargeHeader), alignment));
+
+        LargeHeader*const pHeader = static_cast<LargeHeader*>(VoidPtrDec(pMem, sizeof(LargeHeader)));
+        pHeader->size     = size;
+        pHeader->category = category;
+        pHeader->offset   = static_cast<uint32>(VoidPtrDiff(pMem, pBlock));
+
+        Arena*const pArena = &m_arenas[category];
+        MutexAuto   lock(&pArena->lock);
+
+        pArena->liveBytes    += size;
+        pArena->numAllocs++;
+        pArena->peakLiveBytes = Max(pArena->peakLiveBytes, static_cast<uint64>(Max(pArena->liveBytes, int64(0))));
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+void Heap::FreeLarge(
+    void* pMem)
+{
+    const LargeHeader*const pHeader = static_cast<const LargeHeader*>(VoidPtrDec(pMem, sizeof(LargeHeader)));
+    Arena*const             pArena  = &m_arenas[pHeader->category];
+
+    {
+        MutexAuto lock(&pArena->lock);
+
+        pArena->liveBytes -= pHeader->size;
+        pArena->numFrees++;
+    }
+
+    free(VoidPtrDec(pMem, pHeader->offset));
+}
+
+// =====================================================================================================================
+// Returns every object cached by the given thread to the arenas.
+void Heap::FlushCache(
+    ThreadCache* pCache)
+{
+    for (uint32 category = 0; category < NumCategories; ++category)
+    {
+        MutexAuto lock(&m_arenas[category].lock);
+        PublishStats(pCache, category);
+
+        for (uint32 sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+        {
+            Magazine*const pMagazine = &pCache->magazines[category][sizeClass];
+
+            ReturnObjects(category, pMagazine->pHead);
+
+            pMagazine->pHead = nullptr;
+            pMagazine->count = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns the memory of all empty slabs to the OS.
+void Heap::Trim()
+{
+    for (uint32 category = 0; category < NumCategories; ++category)
+    {
+        Arena*const pArena = &m_arenas[category];
+        MutexAuto   lock(&pArena->lock);
+
+        Slab* pSlab = pArena->pEmpty;
+        pArena->pEmpty   = nullptr;
+        pArena->numEmpty = 0;
+
+        while (pSlab != nullptr)
+        {
+            Slab*const pNext = pSlab->pNext;
+            DecommitSlab(category, pSlab);
+            pSlab = pNext;
+        }
+    }
+}
+
+// =====================================================================================================================
+void Heap::QueryStats(
+    uint32 category,
+    Stats* pStats)
+{
+    Arena*const pArena = &m_arenas[category];
+    MutexAuto   lock(&pArena->lock);
+
+    pStats->liveBytes      = static_cast<uint64>(Max(pArena->liveBytes, int64(0)));
+    pStats->peakLiveBytes  = pArena->peakLiveBytes;
+    pStats->numAllocs      = pArena->numAllocs;
+    pStats->numFrees       = pArena->numFrees;
+    pStats->committedBytes = pArena->committedBytes;
+
+    const int64 now          = GetPerfCpuTime();
+    const int64 elapsedTicks = now - pArena->lastQueryTicks;
+
+    pStats->allocsPerSecond = (elapsedTicks > 0)
+        ? (static_cast<double>(pArena->numAllocs - pArena->lastQueryNumAllocs) * GetPerfFrequency()) / elapsedTicks
+        : 0.0;
+
+    pArena->lastQueryTicks     = now;
+    pArena->lastQueryNumAllocs = pArena->numAllocs;
+}
+
+// =====================================================================================================================
+void* Alloc(
+    size_t          size,
+    size_t          alignment,
+    SystemAllocType allocType)
+{
+    PAL_ASSERT(IsPowerOfTwo(alignment));
+
+    Heap*const   pHeap    = GetHeap();
+    const uint32 category = CategoryIndex(allocType);
+    void*        pMem     = nullptr;
+
+    if ((size <= MaxSmallSize) && (alignment <= MinAlignment))
+    {
+        const uint32 sizeClass = pHeap->SizeToClass(Max(size, size_t(1)));
+        ThreadCache* pCache    = &t_threadCache;
+
+        if (pCache->destroyed)
+        {
+            // This thread is exiting; go through a temporary cache which is flushed when it goes out of scope.
+            ThreadCache tempCache = {};
+
+            pMem = pHeap->AllocSmall(&tempCache, category, sizeClass);
+        }
+        else
+        {
+            pMem = pHeap->AllocSmall(pCache, category, sizeClass);
+        }
+    }
+
+    if (pMem == nullptr)
+    {
+        // Either the request doesn't fit in a size class or the slab heap is out of superblocks or commit space; the C
+        // runtime may still be able to satisfy it.
+        pMem = pHeap->AllocLarge(size, alignment, category);
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+void Free(
+    void* pMem)
+{
+    if (pMem != nullptr)
+    {
+        Heap*const pHeap = GetHeap();
+        Slab*const pSlab = pHeap->FindSlab(pMem);
+
+        if (pSlab == nullptr)
+        {
+            pHeap->FreeLarge(pMem);
+        }
+        else if (t_threadCache.destroyed)
+        {
+            ThreadCache tempCache = {};
+
+            pHeap->FreeSmall(&tempCache, pSlab, static_cast<FreeObject*>(pMem));
+        }
+        else
+        {
+            pHeap->FreeSmall(&t_threadCache, pSlab, static_cast<FreeObject*>(pMem));
+        }
+    }
+}
+
+// =====================================================================================================================
+void FlushThreadCache()
+{
+    if (t_threadCache.destroyed == false)
+    {
+        GetHeap()->FlushCache(&t_threadCache);
+    }
+}
+
+// =====================================================================================================================
+void Trim()
+{
+    GetHeap()->Trim();
+}
+
+// =====================================================================================================================
+void QueryStats(
+    SystemAllocType allocType,
+    Stats*          pStats)
+{
+    PAL_ASSERT(pStats != nullptr);
+    GetHeap()->QueryStats(CategoryIndex(allocType), pStats);
+}
+
+// =====================================================================================================================
+static void* PAL_STDCALL SlabAllocCb(
+    void*           pClientData,
+    size_t          size,
+    size_t          alignment,
+    SystemAllocType allocType)
+{
+    return Alloc(size, alignment, allocType);
+}
+
+// =====================================================================================================================
+static void PAL_STDCALL SlabFreeCb(
+    void* pClientData,
+    void* pMem)
+{
+    Free(pMem);
+}
+
+// =====================================================================================================================
+void InitAllocCallbacks(
+    AllocCallbacks* pAllocCb)
+{
+    PAL_ASSERT(pAllocCb != nullptr);
+
+    pAllocCb->pClientData = nullptr;
+    pAllocCb->pfnAlloc    = SlabAllocCb;
+    pAllocCb->pfnFree     = SlabFreeCb;
+}
+
+} // SlabAllocator
+} // Util
@@ -32,7 +32,19 @@ def main(fileName, outputDir="./"):
     libraryDict = {"libdrm.so.2"    : "LibDrm",
                    "libdrm_amdgpu.so.1" : "LibDrmAmdgpu"}
 
-    procMgr  = proc.ProcMgr(fileName, libraryDict, 1)
+    # Struct types which libdrm fills in for the caller. DrmTracer records them so DrmReplayer can hand them back.
+    traceOutStructs = ["drm_amdgpu_info_hw_ip",
+                       "amdgpu_bo_info",
+                       "amdgpu_bo_import_result",
+                       "amdgpu_buffer_size_alignments",
+                       "amdgpu_heap_info",
+                       "amdgpu_gpu_info",
+                       "drm_amdgpu_cs_chunk_data"]
+
+    # Entry points whose in/out buffers have no known size, so a replayed call can't fill them in.
+    replayUnsupported = ["drmIoctl"]
+
+    procMgr  = proc.ProcMgr(fileName, libraryDict, 1, traceOutStructs, replayUnsupported)
 
     intro = "Modify the procAnalysis.py and drmLoader.py in the tools/generate directory OR drmLoader.proc instead"
 
@@ -42,6 +54,7 @@ def main(fileName, outputDir="./"):
     procMgr.GenerateIntro(fp, intro)
     # adding special include files or customized lines
     fp.write("#pragma once\n\n")
+    fp.write("#include \"core/os/amdgpu/amdgpuDrmTracer.h\"\n")
     fp.write("#include \"core/os/amdgpu/amdgpuHeaders.h\"\n")
     fp.write("#include \"palFile.h\"\n")
     fp.write("#include \"palLibrary.h\"\n\n")
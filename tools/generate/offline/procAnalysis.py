@@ -83,6 +83,38 @@ def GetFmtType(ftype):
     else:
         return "%x"
 
+TraceOutScalars = ['bool', 'int', 'int32', 'int64', 'uint32', 'uint64', 'uint32_t', 'uint64_t']
+
+# Returns the statement suffix which captures (or restores) the given parameter for the binary tracer, or None if the
+# parameter is not an out-parameter the tracer knows the size of.
+def GetTraceOutArgs(params, index, traceOutStructs):
+    pa        = params[index]
+    paramType = pa.GetType()
+    value     = pa.GetValue()
+    if value.startswith('*'):
+        paramType += '*'
+        value      = value[1:]
+    if (paramType.find('const') != -1) or (value.find('[') != -1) or (paramType.endswith('*') == False):
+        return None
+    baseType = paramType[:-1].strip(' ')
+    if baseType.startswith('struct '):
+        baseType = baseType[len('struct '):]
+    if baseType == 'void':
+        # Untyped buffers are only captured when the caller passes their size just before them.
+        if (index > 0) and (params[index - 1].GetValue() == 'size'):
+            return value + ", size"
+        return None
+    if (baseType in TraceOutScalars) or baseType.endswith('_handle') or (baseType in traceOutStructs):
+        return value
+    return None
+
+def IsStringType(retType):
+    return (retType == 'char*') or (retType == 'const char*')
+
+# libdrm hides some pointer types behind typedefs such as drmModeResPtr, so those count as pointers too.
+def IsPointerType(typeName):
+    return (typeName.find('*') != -1) or typeName.endswith('Ptr')
+
 class EntryPoint:
     def __init__(
     self,
@@ -171,11 +203,16 @@ class Variable:
     def GetLibrary(self):
         return self.library
 class ProcMgr:
-    def __init__(self, fileName, libraryDict, needSpecializedInit):
+    def __init__(self, fileName, libraryDict, needSpecializedInit, traceOutStructs=None, replayUnsupported=None):
         self.fileName = fileName
         self.libraryDict = libraryDict
         self.libraries = {}
         self.needSpecializedInit = needSpecializedInit
+        # When set, the proxy records calls through the binary DrmTracer instead of the text loggers and the loader
+        # gains a replay mode. The list names the struct types that are captured as out-parameters for replay.
+        self.traceOutStructs = traceOutStructs
+        # Entry points whose out-parameters the tracer can't capture, on top of the ones IsReplayUnsupported() detects.
+        self.replayUnsupported = replayUnsupported if replayUnsupported is not None else []
         self.var = []
         fp  = open(fileName)
         contents = fp.readlines()
@@ -280,11 +317,17 @@ class ProcMgr:
         fp.write("    ~" + name + "();\n\n")
         fp.write("    bool   Initialized() { return m_initialized; }\n\n")
         fp.write("    const " + name + "Funcs& GetProcsTable()const { return m_funcs; }\n")
-        fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+        self.GenerateProxyGuardBegin(fp)
         fp.write("    const " + name + "FuncsProxy& GetProcsTableProxy()const { return m_proxy; }\n")
-        fp.write("\n    void SetLogPath(const char* pPath) { m_proxy.Init(pPath); }\n")
-        fp.write("#endif\n")
+        if self.traceOutStructs is not None:
+            fp.write("\n    Result InitTracer(Platform* pPlatform, const char* pPath) { return m_proxy.Init(pPlatform, pPath); }\n")
+        else:
+            fp.write("\n    void SetLogPath(const char* pPath) { m_proxy.Init(pPath); }\n")
+        self.GenerateProxyGuardEnd(fp)
         fp.write("\n    Result Init(Platform* pPlatform);\n")
+        if self.traceOutStructs is not None:
+            fp.write("    Result InitReplay(Platform* pPlatform, const char* pTraceFile);\n")
+            fp.write("    bool   IsReplaying() const { return m_replayer.IsActive(); }\n")
         if self.needSpecializedInit:
             fp.write("    void   SpecializedInit(Platform* pPlatform, char*  pDtifLibName);\n")
         if self.var:
@@ -300,14 +343,20 @@ class ProcMgr:
         fp.write("    Util::Library m_library[" + name + "LibrariesCount];\n")
         fp.write("    bool          m_initialized;\n\n")
         fp.write("    "  + name + "Funcs      m_funcs;\n")
-        fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+        if self.traceOutStructs is not None:
+            fp.write("    DrmReplayer         m_replayer;\n")
+        self.GenerateProxyGuardBegin(fp)
         fp.write("    "  + name + "FuncsProxy m_proxy;\n")
-        fp.write("#endif\n\n")
+        self.GenerateProxyGuardEnd(fp)
+        fp.write("\n")
         fp.write("    PAL_DISALLOW_COPY_AND_ASSIGN(" + name + ");\n");
 
     def GenerateStubFunctions(self, fp, name):
         # Adding constructor for proxy
         self.GenerateCommentLine(fp)
+        if self.traceOutStructs is not None:
+            self.GenerateTracedStubFunctions(fp, name)
+            return
         fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
         fp.write("void " + name + "FuncsProxy::Init(const char* pLogPath)\n")
         fp.write("{\n")
@@ -394,6 +443,192 @@ class ProcMgr:
                 fp.write("}\n");
                 fp.write("\n")
         fp.write("#endif\n\n")
+    def GenerateCallArguments(self, fp, entry, paramIndent):
+        params = entry.GetFunctionParams()
+        indent = ''
+        argument = ''
+        for pa in params:
+            value = pa.GetValue()
+            if '[' in value:
+                value = value[:value.index('[')]
+            if value.startswith('*'):
+                value = value[1:]
+            argument += indent + value + ",\n"
+            indent = ' ' * paramIndent
+        if len(params) == 0:
+            fp.write(");\n")
+        else:
+            fp.write("%s);\n" %(argument[:-2]))
+    def GenerateParamList(self, fp, params):
+        length = 0
+        for pa in params:
+            if length < len(pa.GetType()):
+                length = len(pa.GetType())
+        dot = ""
+        for pa in params:
+            fp.write("%s\n    %s %*.s %s"  %(dot, pa.GetType(), length - len(pa.GetType()), ' ', pa.GetValue()))
+            dot = ','
+        fp.write("\n    )")
+    def GenerateEntryPointsEnum(self, fp, name):
+        fp.write("// Identifies each entry point in the binary trace written by DrmTracer and read back by DrmReplayer.\n")
+        fp.write("enum " + name + "EntryPoints : uint32\n")
+        fp.write("{\n")
+        i = 0
+        for key in self.libraries.keys():
+            for entry in self.libraries[key]:
+                fp.write("    " + name + "EntryPoint" + entry.GetFormattedName() + " = " + str(i) + ",\n")
+                i += 1
+        fp.write("    " + name + "EntryPointsCount = " + str(i) + "\n")
+        fp.write("};\n\n")
+        fp.write("static_assert(" + name + "EntryPointsCount <= DrmTracer::MaxEntryPoints, \"Too many traced entry points.\");\n\n")
+        fp.write("extern const char* " + name + "EntryPointNames[" + name + "EntryPointsCount];\n\n")
+    def GenerateEntryPointNames(self, fp, name):
+        self.GenerateCommentLine(fp)
+        fp.write("const char* " + name + "EntryPointNames[" + name + "EntryPointsCount] =\n")
+        fp.write("{\n")
+        for key in self.libraries.keys():
+            for entry in self.libraries[key]:
+                fp.write("    \"" + entry.GetFunctionName() + "\",\n")
+        fp.write("};\n\n")
+    def GenerateTracedStubFunctions(self, fp, name):
+        fp.write("Result " + name + "FuncsProxy::Init(\n")
+        fp.write("    Platform*   pPlatform,\n")
+        fp.write("    const char* pLogPath)\n")
+        fp.write("{\n")
+        fp.write("    return m_tracer.Init(pPlatform, pLogPath, " + name + "EntryPointsCount, &" + name + "EntryPointNames[0]);\n")
+        fp.write("}\n\n")
+        # each stub times the call and appends a binary record to the calling thread's trace buffer.
+        for key in self.libraries.keys():
+            for entry in self.libraries[key]:
+                self.GenerateCommentLine(fp)
+                fp.write(entry.GetFunctionRetType() + " " +name + "FuncsProxy::pfn" + entry.GetFormattedName() + "(")
+                params = entry.GetFunctionParams()
+                if len(params) == 0:
+                    fp.write("    ) const\n")
+                else:
+                    self.GenerateParamList(fp, params)
+                    fp.write(" const\n")
+                fp.write("{\n")
+                fp.write("    DrmTraceCall call(&m_tracer, " + name + "EntryPoint" + entry.GetFormattedName() + ");\n")
+                retType = entry.GetFunctionRetType()
+                paramIndent = 0
+                if retType != "void":
+                    if IsPointerType(retType):
+                        fp.write("    " + retType + " pRet = ")
+                        paramIndent += 4 + len(retType) + 8
+                    else:
+                        fp.write("    " + retType + " ret = ")
+                        paramIndent += 4 + len(retType) + 7
+                    fp.write("m_pFuncs->pfn")
+                    paramIndent += 13
+                else:
+                    fp.write("    m_pFuncs->pfn")
+                    paramIndent += 17
+                fp.write(entry.GetFormattedName() + "(")
+                paramIndent += len(entry.GetFormattedName()) + 1
+                self.GenerateCallArguments(fp, entry, paramIndent)
+                if retType == "void":
+                    fp.write("    call.End(0);\n")
+                elif IsPointerType(retType):
+                    fp.write("    call.End(pRet != nullptr);\n")
+                else:
+                    fp.write("    call.End(ret);\n")
+                for i in range(len(params)):
+                    args = GetTraceOutArgs(params, i, self.traceOutStructs)
+                    if args is not None:
+                        fp.write("    call.CaptureOut(" + args + ");\n")
+                if IsStringType(retType):
+                    fp.write("    call.CaptureString(pRet);\n")
+                if retType == "void":
+                    pass
+                elif IsPointerType(retType):
+                    fp.write("\n    return pRet;\n")
+                else:
+                    fp.write("\n    return ret;\n")
+                fp.write("}\n");
+                fp.write("\n")
+    def GenerateReplayFunctions(self, fp, name):
+        # each replay stub serves the next recorded result of its entry point instead of calling into the library.
+        for key in self.libraries.keys():
+            for entry in self.libraries[key]:
+                self.GenerateCommentLine(fp)
+                retType = entry.GetFunctionRetType()
+                fp.write("static " + retType + " Replay" + entry.GetFormattedName() + "(")
+                params = entry.GetFunctionParams()
+                if len(params) == 0:
+                    fp.write("void)\n")
+                else:
+                    length = 0
+                    for pa in params:
+                        if length < len(pa.GetType()):
+                            length = len(pa.GetType())
+                    dot = ""
+                    for pa in params:
+                        fp.write("%s\n    %s %*.s %s"  %(dot, pa.GetType(), length - len(pa.GetType()), ' ', pa.GetValue()))
+                        dot = ','
+                    fp.write(")\n")
+                fp.write("{\n")
+                fp.write("    DrmReplayCall call(" + name + "EntryPoint" + entry.GetFormattedName() + ");\n")
+                if self.IsReplayUnsupported(entry):
+                    unsupported = "call.Unsupported(\"" + entry.GetFunctionName() + "\")"
+                    if retType == "void":
+                        fp.write("    " + unsupported + ";\n")
+                    elif IsPointerType(retType):
+                        fp.write("    " + unsupported + ";\n")
+                        fp.write("\n    return nullptr;\n")
+                    else:
+                        fp.write("\n    return " + unsupported + ";\n")
+                    fp.write("}\n\n")
+                    continue
+                for i in range(len(params)):
+                    args = GetTraceOutArgs(params, i, self.traceOutStructs)
+                    if args is not None:
+                        fp.write("    call.RestoreOut(" + args + ");\n")
+                if retType == "void":
+                    pass
+                elif IsStringType(retType):
+                    fp.write("\n    return call.RestoreString();\n")
+                else:
+                    fp.write("\n    return call.ReturnValue<" + retType + ">();\n")
+                fp.write("}\n\n")
+        self.GenerateCommentLine(fp)
+        fp.write("// Replaces every entry point with a stub serving the results recorded in the given trace file, so the amdgpu\n")
+        fp.write("// backend can run without the real libraries or a GPU.\n")
+        fp.write("Result " + name + "::InitReplay(\n")
+        fp.write("    Platform*   pPlatform,\n")
+        fp.write("    const char* pTraceFile)\n")
+        fp.write("{\n")
+        fp.write("    Result result = m_replayer.Init(pPlatform, pTraceFile, " + name + "EntryPointsCount);\n\n")
+        fp.write("    if (result == Result::Success)\n")
+        fp.write("    {\n")
+        for key in self.libraries.keys():
+            for entry in self.libraries[key]:
+                fp.write("        m_funcs.pfn" + entry.GetFormattedName() + " = Replay" + entry.GetFormattedName() + ";\n")
+        fp.write("\n        m_initialized = true;\n")
+        fp.write("        m_proxy.SetFuncCalls(&m_funcs);\n")
+        fp.write("    }\n\n")
+        fp.write("    return result;\n")
+        fp.write("}\n\n")
+    # The text logging proxy is only built with PAL_DEBUG_PRINTS; the traced proxy is always built so that DrmTracer can
+    # be enabled by a setting in any build.
+    def GenerateProxyGuardBegin(self, fp):
+        if self.traceOutStructs is None:
+            fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+    def GenerateProxyGuardEnd(self, fp):
+        if self.traceOutStructs is None:
+            fp.write("#endif\n")
+    def IsReplayUnsupported(self, entry):
+        # Objects allocated by the library, CPU mappings and untyped in/out buffers can't be rebuilt from the trace.
+        retType = entry.GetFunctionRetType()
+        if IsPointerType(retType) and (IsStringType(retType) == False):
+            return True
+        for pa in entry.GetFunctionParams():
+            paramType = pa.GetType()
+            if pa.GetValue().startswith('*'):
+                paramType += '*'
+            if (paramType.find('const') == -1) and (paramType.endswith('**') or paramType.endswith('Ptr*')):
+                return True
+        return entry.GetFunctionName() in self.replayUnsupported
     def GenerateCommentLine(self, fp):
         fp.write("// =====================================================================================================================\n")
     def GenerateConstructor(self, fp, name):
@@ -455,9 +690,9 @@ class ProcMgr:
         fp.write("        if (result == Result::Success)\n")
         fp.write("        {\n")
         fp.write("            m_initialized = true;\n")
-        fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+        self.GenerateProxyGuardBegin(fp)
         fp.write("            m_proxy.SetFuncCalls(&m_funcs);\n");
-        fp.write("#endif\n")
+        self.GenerateProxyGuardEnd(fp)
         fp.write("        }\n")
         fp.write("    }\n")
         fp.write("    return result;\n")
@@ -488,14 +723,18 @@ class ProcMgr:
     def GenerateFuncProxy(self, fp, name):
         self.GenerateCommentLine(fp)
         fp.write("// the class serves as a proxy layer to add more functionality to wrapped callbacks.\n")
-        fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+        self.GenerateProxyGuardBegin(fp)
         fp.write("class " + name + "FuncsProxy\n")
         fp.write("{\n")
         fp.write("public:\n")
         fp.write("    " + name + "FuncsProxy() { }\n")
         fp.write("    ~" + name + "FuncsProxy() { }\n\n")
         fp.write("    void SetFuncCalls(" + name + "Funcs* pFuncs) { m_pFuncs = pFuncs; }\n\n")
-        fp.write("    void Init(const char* pPath);\n\n")
+        if self.traceOutStructs is not None:
+            fp.write("    Result Init(Platform* pPlatform, const char* pPath);\n\n")
+            fp.write("    const DrmTracer& GetTracer() const { return m_tracer; }\n\n")
+        else:
+            fp.write("    void Init(const char* pPath);\n\n")
         for key in self.libraries.keys():
             for entry in self.libraries[key]:
                 fp.write( "    " + entry.GetFunctionRetType() + " pfn" + entry.GetFormattedName() + "(")
@@ -524,12 +763,16 @@ class ProcMgr:
                     fp.write("    }\n")
                     fp.write("\n")
         fp.write("private:\n")
-        fp.write("    Util::File  m_timeLogger;\n")
-        fp.write("    Util::File  m_paramLogger;\n")
+        if self.traceOutStructs is not None:
+            fp.write("    DrmTracer   m_tracer;\n")
+        else:
+            fp.write("    Util::File  m_timeLogger;\n")
+            fp.write("    Util::File  m_paramLogger;\n")
         fp.write("    " + name + "Funcs* m_pFuncs;\n\n")
         fp.write("    PAL_DISALLOW_COPY_AND_ASSIGN(" + name + "FuncsProxy);\n");
         fp.write("};\n")
-        fp.write("#endif\n\n")
+        self.GenerateProxyGuardEnd(fp)
+        fp.write("\n")
     def GenerateDestructor(self, fp, name):
         # initialize static variables
         self.GenerateCommentLine(fp);
@@ -538,6 +781,8 @@ class ProcMgr:
     def GenerateHeadFile(self, fp, name):
         self.GenerateFunctionDeclaration(fp, name)
         self.GenerateLibrariesEnum(fp, name)
+        if self.traceOutStructs is not None:
+            self.GenerateEntryPointsEnum(fp, name)
         self.GenerateFuncStruct(fp, name)
         self.GenerateFuncProxy(fp, name)
         self.GenerateClassDeclaration(fp, name)
@@ -545,10 +790,14 @@ class ProcMgr:
         fp.write("};\n\n")
 
     def GenerateCppFile(self, fp, name):
+        if self.traceOutStructs is not None:
+            self.GenerateEntryPointNames(fp, name)
         self.GenerateStubFunctions(fp, name)
         self.GenerateConstructor(fp, name)
         self.GenerateDestructor(fp, name)
         self.GenerateInitFunction(fp, name)
+        if self.traceOutStructs is not None:
+            self.GenerateReplayFunctions(fp, name)
 
     def printEntryList(self):
         for key in self.libraries.keys():
@@ -0,0 +1,635 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palBench.h"
+#include "palColorBlendState.h"
+#include "palDepthStencilState.h"
+#include "palFile.h"
+#include "palGpuEvent.h"
+#include "palGpuMemory.h"
+#include "palImage.h"
+#include "palMsaaState.h"
+#include "palPlatform.h"
+
+using namespace Pal;
+using namespace Util;
+
+namespace PalBench
+{
+
+// Reasonable constants for the per-thread command allocator.
+constexpr gpusize CmdAllocSize    = 2 * 1024 * 1024;
+constexpr gpusize CmdSubAllocSize = 64 * 1024;
+
+// =====================================================================================================================
+BenchDevice::BenchDevice(
+    const BenchConfig& config)
+    :
+    m_config(config),
+    m_pPlatformMem(nullptr),
+    m_pPlatform(nullptr),
+    m_pDevice(nullptr),
+    m_features(0),
+    m_pGraphicsElf(nullptr),
+    m_graphicsElfSize(0),
+    m_pComputeElf(nullptr),
+    m_computeElfSize(0),
+    m_pMsaaState(nullptr),
+    m_pColorBlendState(nullptr),
+    m_pDepthStencilState(nullptr)
+{
+    memset(&m_properties, 0, sizeof(m_properties));
+}
+
+// =====================================================================================================================
+BenchDevice::~BenchDevice()
+{
+    DestroyObject(m_pDepthStencilState);
+    DestroyObject(m_pColorBlendState);
+    DestroyObject(m_pMsaaState);
+
+    if (m_pDevice != nullptr)
+    {
+        m_pDevice->Cleanup();
+    }
+
+    if (m_pPlatform != nullptr)
+    {
+        m_pPlatform->Destroy();
+    }
+
+    PAL_SAFE_FREE(m_pPlatformMem, &m_allocator);
+    PAL_SAFE_FREE(m_pComputeElf, &m_allocator);
+    PAL_SAFE_FREE(m_pGraphicsElf, &m_allocator);
+}
+
+// =====================================================================================================================
+// Creates the null platform and device for the configured ASIC and loads any pipeline ELFs given on the command line.
+Result BenchDevice::Init()
+{
+    Result result = Result::Success;
+
+    if (m_config.pGraphicsElf != nullptr)
+    {
+        result = LoadElf(m_config.pGraphicsElf, &m_pGraphicsElf, &m_graphicsElfSize);
+    }
+
+    if ((result == Result::Success) && (m_config.pComputeElf != nullptr))
+    {
+        result = LoadElf(m_config.pComputeElf, &m_pComputeElf, &m_computeElfSize);
+    }
+
+    if (result == Result::Success)
+    {
+        m_pPlatformMem = PAL_MALLOC(GetPlatformSize(), &m_allocator, AllocInternal);
+        result         = (m_pPlatformMem != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        PlatformCreateInfo createInfo = {};
+        createInfo.pSettingsPath          = "/etc/amd";
+        createInfo.flags.createNullDevice = 1;
+        createInfo.nullGpuId              = m_config.nullGpuId;
+
+        result = CreatePlatform(createInfo, m_pPlatformMem, &m_pPlatform);
+    }
+
+    if (result == Result::Success)
+    {
+        uint32   deviceCount         = 0;
+        IDevice* devices[MaxDevices] = {};
+
+        result = m_pPlatform->EnumerateDevices(&deviceCount, devices);
+
+        if ((result == Result::Success) && (deviceCount == 0))
+        {
+            result = Result::ErrorInitializationFailed;
+        }
+
+        m_pDevice = devices[0];
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->GetProperties(&m_properties);
+    }
+
+    // The command building paths this benchmark tracks are the GFX9 and GFX10 ones.
+    if ((result == Result::Success) && (m_properties.gfxLevel < GfxIpLevel::GfxIp9))
+    {
+        result = Result::ErrorIncompatibleDevice;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CommitSettingsAndInit();
+    }
+
+    if (result == Result::Success)
+    {
+        // The null device exposes no engines, so there is nothing to request here.
+        DeviceFinalizeInfo finalizeInfo = {};
+        result = m_pDevice->Finalize(finalizeInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreateDefaultStates();
+    }
+
+    if (result == Result::Success)
+    {
+        // Some null devices refuse to create images because they only exist for offline shader compilation.
+        ImageCreateInfo imageInfo = {};
+        InitImageCreateInfo(&imageInfo);
+
+        Result imageResult = Result::Success;
+        m_pDevice->GetImageSize(imageInfo, &imageResult);
+
+        if (imageResult == Result::Success)
+        {
+            m_features |= RequireImages;
+        }
+
+#if PAL_AMDGPU_BUILD
+        m_features |= RequireAmdgpu;
+#endif
+
+        if (m_properties.gfxipProperties.flags.supportCmdBufferTemplates != 0)
+        {
+            m_features |= RequireTemplates;
+        }
+
+        if (m_pGraphicsElf != nullptr)
+        {
+            m_features |= RequireGraphicsElf;
+        }
+
+        if (m_pComputeElf != nullptr)
+        {
+            m_features |= RequireComputeElf;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Reads a pipeline ELF into system memory.
+Result BenchDevice::LoadElf(
+    const char* pFilePath,
+    void**      ppElf,
+    size_t*     pElfSize)
+{
+    Result       result   = Result::ErrorInvalidValue;
+    const size_t fileSize = File::GetFileSize(pFilePath);
+
+    if (fileSize > 0)
+    {
+        File file;
+        result = file.Open(pFilePath, FileAccessRead | FileAccessBinary);
+
+        if (result == Result::Success)
+        {
+            (*ppElf) = PAL_MALLOC(fileSize, &m_allocator, AllocInternal);
+            result   = ((*ppElf) != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            result = file.Read(*ppElf, fileSize, pElfSize);
+        }
+
+        if ((result == Result::Success) && ((*pElfSize) != fileSize))
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the MSAA, blend and depth-stencil states which must be bound before any draw can be validated.
+Result BenchDevice::CreateDefaultStates()
+{
+    MsaaStateCreateInfo msaaInfo = {};
+    msaaInfo.coverageSamples         = 1;
+    msaaInfo.exposedSamples          = 1;
+    msaaInfo.pixelShaderSamples      = 1;
+    msaaInfo.depthStencilSamples     = 1;
+    msaaInfo.shaderExportMaskSamples = 1;
+    msaaInfo.sampleClusters          = 1;
+    msaaInfo.alphaToCoverageSamples  = 1;
+    msaaInfo.occlusionQuerySamples   = 1;
+    msaaInfo.sampleMask              = 1;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetMsaaStateSize(msaaInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateMsaaState(msaaInfo, pMemory, &m_pMsaaState);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    ColorBlendStateCreateInfo blendInfo = {};
+
+    if (result == Result::Success)
+    {
+        pMemory = PAL_MALLOC(m_pDevice->GetColorBlendStateSize(blendInfo, &result), &m_allocator, AllocObject);
+
+        if ((result == Result::Success) && (pMemory == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pDevice->CreateColorBlendState(blendInfo, pMemory, &m_pColorBlendState);
+
+            if (result != Result::Success)
+            {
+                PAL_FREE(pMemory, &m_allocator);
+            }
+        }
+    }
+
+    DepthStencilStateCreateInfo depthInfo = {};
+    depthInfo.depthFunc = CompareFunc::Always;
+
+    if (result == Result::Success)
+    {
+        pMemory = PAL_MALLOC(m_pDevice->GetDepthStencilStateSize(depthInfo, &result), &m_allocator, AllocObject);
+
+        if ((result == Result::Success) && (pMemory == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pDevice->CreateDepthStencilState(depthInfo, pMemory, &m_pDepthStencilState);
+
+            if (result != Result::Success)
+            {
+                PAL_FREE(pMemory, &m_allocator);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a command allocator private to the calling thread and a universal or compute command buffer which uses it.
+// Nested command buffers can only be executed by another command buffer, for example as a template.
+Result BenchDevice::CreateCmdBuffer(
+    QueueType       queueType,
+    ICmdAllocator** ppCmdAllocator,
+    ICmdBuffer**    ppCmdBuffer,
+    bool            nested)
+{
+    CmdAllocatorCreateInfo allocatorInfo = {};
+    allocatorInfo.allocInfo[CommandDataAlloc].allocHeap      = GpuHeapGartCacheable;
+    allocatorInfo.allocInfo[CommandDataAlloc].allocSize      = CmdAllocSize;
+    allocatorInfo.allocInfo[CommandDataAlloc].suballocSize   = CmdSubAllocSize;
+    allocatorInfo.allocInfo[EmbeddedDataAlloc].allocHeap     = GpuHeapGartCacheable;
+    allocatorInfo.allocInfo[EmbeddedDataAlloc].allocSize     = CmdAllocSize;
+    allocatorInfo.allocInfo[EmbeddedDataAlloc].suballocSize  = CmdSubAllocSize;
+    allocatorInfo.allocInfo[GpuScratchMemAlloc].allocHeap    = GpuHeapInvisible;
+    allocatorInfo.allocInfo[GpuScratchMemAlloc].allocSize    = CmdAllocSize;
+    allocatorInfo.allocInfo[GpuScratchMemAlloc].suballocSize = CmdSubAllocSize;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetCmdAllocatorSize(allocatorInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateCmdAllocator(allocatorInfo, pMemory, ppCmdAllocator);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        CmdBufferCreateInfo cmdBufferInfo = {};
+        cmdBufferInfo.pCmdAllocator = *ppCmdAllocator;
+        cmdBufferInfo.queueType     = queueType;
+        cmdBufferInfo.engineType    = (queueType == QueueTypeUniversal) ? EngineTypeUniversal : EngineTypeCompute;
+        cmdBufferInfo.flags.nested  = nested;
+
+        pMemory = PAL_MALLOC(m_pDevice->GetCmdBufferSize(cmdBufferInfo, &result), &m_allocator, AllocObject);
+
+        if ((result == Result::Success) && (pMemory == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pDevice->CreateCmdBuffer(cmdBufferInfo, pMemory, ppCmdBuffer);
+
+            if (result != Result::Success)
+            {
+                PAL_FREE(pMemory, &m_allocator);
+            }
+        }
+
+        if (result != Result::Success)
+        {
+            DestroyObject(*ppCmdAllocator);
+            (*ppCmdAllocator) = nullptr;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a CPU-visible GPU memory allocation of the given size.
+Result BenchDevice::CreateGpuMemory(
+    gpusize      size,
+    IGpuMemory** ppGpuMemory)
+{
+    GpuMemoryCreateInfo createInfo = {};
+    createInfo.size      = size;
+    createInfo.alignment = 256;
+    createInfo.vaRange   = VaRange::Default;
+    createInfo.priority  = GpuMemPriority::Normal;
+    createInfo.heapCount = 1;
+    createInfo.heaps[0]  = GpuHeapGartCacheable;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetGpuMemorySize(createInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateGpuMemory(createInfo, pMemory, ppGpuMemory);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates an image.  If ppGpuMemory is non-null, a GPU memory allocation is also created and bound to the image.
+Result BenchDevice::CreateImage(
+    const ImageCreateInfo& createInfo,
+    IImage**               ppImage,
+    IGpuMemory**           ppGpuMemory)
+{
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetImageSize(createInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateImage(createInfo, pMemory, ppImage);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    if ((result == Result::Success) && (ppGpuMemory != nullptr))
+    {
+        GpuMemoryRequirements memReqs = {};
+        (*ppImage)->GetGpuMemoryRequirements(&memReqs);
+
+        result = CreateGpuMemory(memReqs.size, ppGpuMemory);
+
+        if (result == Result::Success)
+        {
+            result = (*ppImage)->BindGpuMemory(*ppGpuMemory, 0);
+        }
+
+        if (result != Result::Success)
+        {
+            DestroyObject(*ppImage);
+            (*ppImage) = nullptr;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a GPU-access-only event backed by its own GPU memory allocation.
+Result BenchDevice::CreateGpuEvent(
+    IGpuEvent**  ppGpuEvent,
+    IGpuMemory** ppGpuMemory)
+{
+    GpuEventCreateInfo createInfo = {};
+    createInfo.flags.gpuAccessOnly = 1;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetGpuEventSize(createInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateGpuEvent(createInfo, pMemory, ppGpuEvent);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        GpuMemoryRequirements memReqs = {};
+        (*ppGpuEvent)->GetGpuMemoryRequirements(&memReqs);
+
+        result = CreateGpuMemory(memReqs.size, ppGpuMemory);
+
+        if (result == Result::Success)
+        {
+            result = (*ppGpuEvent)->BindGpuMemory(*ppGpuMemory, 0);
+
+            if (result != Result::Success)
+            {
+                DestroyObject(*ppGpuMemory);
+                (*ppGpuMemory) = nullptr;
+            }
+        }
+
+        if (result != Result::Success)
+        {
+            DestroyObject(*ppGpuEvent);
+            (*ppGpuEvent) = nullptr;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a graphics pipeline from the ELF given on the command line.  The pipeline is assumed to export to a single
+// RGBA8 color target and to draw triangle lists.
+Result BenchDevice::CreateGraphicsPipeline(
+    IPipeline** ppPipeline)
+{
+    GraphicsPipelineCreateInfo createInfo = {};
+    createInfo.pPipelineBinary                    = m_pGraphicsElf;
+    createInfo.pipelineBinarySize                 = m_graphicsElfSize;
+    createInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Triangle;
+    createInfo.cbState.logicOp                    = LogicOp::Copy;
+    createInfo.cbState.target[0].swizzledFormat   =
+        { ChNumFormat::X8Y8Z8W8_Unorm,
+          { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W } };
+    createInfo.cbState.target[0].channelWriteMask = 0xF;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetGraphicsPipelineSize(createInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateGraphicsPipeline(createInfo, pMemory, ppPipeline);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a compute pipeline from the ELF given on the command line.
+Result BenchDevice::CreateComputePipeline(
+    IPipeline** ppPipeline)
+{
+    ComputePipelineCreateInfo createInfo = {};
+    createInfo.pPipelineBinary    = m_pComputeElf;
+    createInfo.pipelineBinarySize = m_computeElfSize;
+
+    Result result  = Result::Success;
+    void*  pMemory = PAL_MALLOC(m_pDevice->GetComputePipelineSize(createInfo, &result), &m_allocator, AllocObject);
+
+    if ((result == Result::Success) && (pMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateComputePipeline(createInfo, pMemory, ppPipeline);
+
+        if (result != Result::Success)
+        {
+            PAL_FREE(pMemory, &m_allocator);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Binds the state objects every draw needs.
+void BenchDevice::BindDefaultGraphicsState(
+    ICmdBuffer* pCmdBuffer
+    ) const
+{
+    pCmdBuffer->CmdBindMsaaState(m_pMsaaState);
+    pCmdBuffer->CmdBindColorBlendState(m_pColorBlendState);
+    pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilState);
+}
+
+// =====================================================================================================================
+// Destroys a PAL object created by this class and frees its system memory.
+void BenchDevice::DestroyObject(
+    IDestroyable* pObject)
+{
+    if (pObject != nullptr)
+    {
+        pObject->Destroy();
+        PAL_FREE(pObject, &m_allocator);
+    }
+}
+
+// =====================================================================================================================
+// Fills out the create info of the single-sampled 2D color image the image scenarios use.
+void BenchDevice::InitImageCreateInfo(
+    ImageCreateInfo* pCreateInfo)
+{
+    pCreateInfo->usageFlags.shaderRead  = 1;
+    pCreateInfo->usageFlags.colorTarget = 1;
+    pCreateInfo->imageType              = ImageType::Tex2d;
+    pCreateInfo->swizzledFormat         =
+        { ChNumFormat::X8Y8Z8W8_Unorm,
+          { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W } };
+    pCreateInfo->extent                 = { 256, 256, 1 };
+    pCreateInfo->mipLevels              = 1;
+    pCreateInfo->arraySize              = 1;
+    pCreateInfo->samples                = 1;
+    pCreateInfo->fragments              = 1;
+    pCreateInfo->tiling                 = ImageTiling::Optimal;
+}
+
+} // PalBench
@@ -0,0 +1,78 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palBench.h"
+
+using namespace Pal;
+using namespace Util;
+
+#if PAL_AMDGPU_BUILD
+namespace Pal
+{
+namespace Amdgpu
+{
+// The scenario drives PAL's internal amdgpu classes, so it is built into PAL itself when PAL_BUILD_BENCH is enabled.
+// See amdgpuFenceTrackerBench.cpp.
+extern Result RunFenceTrackerBench(
+    IPlatform* pPlatform,
+    uint32     iterations,
+    uint32     opsPerIteration,
+    int64*     pBeginTicks,
+    int64*     pEndTicks,
+    uint64*    pOperations);
+} // Amdgpu
+} // Pal
+#endif
+
+namespace PalBench
+{
+
+#if PAL_AMDGPU_BUILD
+// =====================================================================================================================
+// Drives an amdgpu FenceCompletionTracker through a mock libdrm; see Pal::Amdgpu::RunFenceTrackerBench. Each operation
+// submits one timestamp.
+Result RunFenceTracker(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+
+    return Amdgpu::RunFenceTrackerBench(pDevice->GetPlatform(),
+                                        config.iterations,
+                                        config.opsPerIteration,
+                                        &pContext->beginTicks,
+                                        &pContext->endTicks,
+                                        &pContext->operations);
+}
+#else
+// =====================================================================================================================
+Result RunFenceTracker(
+    ThreadContext* pContext)
+{
+    return Result::Unsupported;
+}
+#endif
+
+} // PalBench
@@ -0,0 +1,1219 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palBench.h"
+#include "palDescriptorHeap.h"
+#include "palDeveloperHooks.h"
+#include "palGpuEvent.h"
+#include "palGpuMemory.h"
+#include "palImage.h"
+#include "palInlineFuncs.h"
+#include "palPlatform.h"
+#include "palResidencyManager.h"
+
+using namespace Pal;
+using namespace Util;
+
+namespace PalBench
+{
+
+// Size of each GPU memory allocation the copy and fill scenarios operate on.
+constexpr gpusize CopyMemorySize = 1024 * 1024;
+
+// Regions per CmdCopyMemory call in the multi-region copy scenario; the first half form one contiguous run.
+constexpr uint32  CopyRegionCount = 32;
+constexpr gpusize CopyRegionSize  = 4096;
+
+// Number of user data entries rewritten by each state change in the draw and dispatch scenarios.
+constexpr uint32 ChurnUserDataCount = 4;
+
+// The template scenario instantiates a template which draws with the user's graphics pipeline.
+constexpr uint32 TemplateRequirements = RequireGraphicsElf | RequireTemplates;
+
+// The residency scenario submits a sliding window of its allocations against a budget which holds only part of them,
+// so that most submits evict the least recently used allocations to make room.
+constexpr uint32  ResidencyAllocCount    = 64;
+constexpr uint32  ResidencyRefsPerSubmit = 8;
+constexpr uint32  ResidencyBudgetAllocs  = 24;
+constexpr gpusize ResidencyAllocSize     = 64 * 1024;
+
+// The descriptor heap scenario spreads each iteration's slots over several small blocks.  Its overflow check uses a
+// heap of a single block of DescriptorOverflowSlots slots.
+constexpr uint32 DescriptorSlotsPerBlock = 64;
+constexpr uint32 DescriptorMaxBlocks     = GpuUtil::DescriptorHeap::MaxBlocks;
+constexpr uint32 DescriptorOverflowSlots = 4;
+
+// Number of BarrierBegin callbacks the barrier ordering scenario expects per command buffer, and how many it can log.
+constexpr uint32 BarrierOrderExpectedCount = 3;
+constexpr uint32 BarrierOrderMaxLogged     = 8;
+
+// Largest SRD size we expect on any supported GPU, in DWORDs.
+constexpr uint32 MaxSrdDwords = 16;
+
+constexpr SwizzledFormat Rgba8Format =
+{
+    ChNumFormat::X8Y8Z8W8_Unorm,
+    { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W }
+};
+
+// =====================================================================================================================
+// Returns true if the given operation should be preceded by a state change according to the configured churn ratio.
+static bool ShouldChurn(
+    const BenchConfig& config,
+    uint32             op)
+{
+    return ((op % 100) < config.churnPercent);
+}
+
+// =====================================================================================================================
+// Reclaims the thread's command memory and begins a new command buffer.
+static Result BeginCmdBuffer(
+    ThreadContext* pContext,
+    bool           deferBarriers = false)
+{
+    Result result = pContext->pCmdBuffer->Reset(pContext->pCmdAllocator, true);
+
+    if (result == Result::Success)
+    {
+        result = pContext->pCmdAllocator->Reset();
+    }
+
+    if (result == Result::Success)
+    {
+        CmdBufferBuildInfo buildInfo = {};
+        buildInfo.flags.optimizeOneTimeSubmit = 1;
+        buildInfo.flags.deferBarriers         = deferBarriers;
+
+        result = pContext->pCmdBuffer->Begin(buildInfo);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records draws with the user's graphics pipeline.  A configurable fraction of draws rewrite user data and viewports
+// first so that the validation and state-dirtying paths are exercised along with the draw packets themselves.
+static Result RunDraw(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice   = pContext->pDevice;
+    const BenchConfig& config    = pDevice->Config();
+    IPipeline*         pPipeline = nullptr;
+    Result             result    = pDevice->CreateGraphicsPipeline(&pPipeline);
+
+    PipelineBindParams bindParams = {};
+    bindParams.pipelineBindPoint = PipelineBindPoint::Graphics;
+    bindParams.pPipeline         = pPipeline;
+
+    ViewportParams viewports = {};
+    viewports.count                   = 1;
+    viewports.viewports[0].width      = 256.0f;
+    viewports.viewports[0].height     = 256.0f;
+    viewports.viewports[0].maxDepth   = 1.0f;
+    viewports.viewports[0].origin     = PointOrigin::UpperLeft;
+    viewports.horzDiscardRatio        = 1.0f;
+    viewports.vertDiscardRatio        = 1.0f;
+    viewports.horzClipRatio           = 1.0f;
+    viewports.vertClipRatio           = 1.0f;
+    viewports.depthRange              = DepthRange::ZeroToOne;
+
+    uint32 userData[ChurnUserDataCount] = {};
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            ICmdBuffer* pCmdBuffer = pContext->pCmdBuffer;
+
+            pCmdBuffer->CmdBindPipeline(bindParams);
+            pDevice->BindDefaultGraphicsState(pCmdBuffer);
+            pCmdBuffer->CmdSetViewports(viewports);
+
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                if (ShouldChurn(config, op))
+                {
+                    userData[0] = op;
+                    viewports.viewports[0].originX = static_cast<float>(op & 0xFF);
+
+                    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, 0, ChurnUserDataCount, userData);
+                    pCmdBuffer->CmdSetViewports(viewports);
+                }
+
+                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+            }
+
+            result = pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pPipeline);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records dispatches with the user's compute pipeline, churning user data at the configured ratio.
+static Result RunDispatch(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice   = pContext->pDevice;
+    const BenchConfig& config    = pDevice->Config();
+    IPipeline*         pPipeline = nullptr;
+    Result             result    = pDevice->CreateComputePipeline(&pPipeline);
+
+    PipelineBindParams bindParams = {};
+    bindParams.pipelineBindPoint = PipelineBindPoint::Compute;
+    bindParams.pPipeline         = pPipeline;
+
+    uint32 userData[ChurnUserDataCount] = {};
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            ICmdBuffer* pCmdBuffer = pContext->pCmdBuffer;
+
+            pCmdBuffer->CmdBindPipeline(bindParams);
+
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                if (ShouldChurn(config, op))
+                {
+                    userData[0] = op;
+                    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, ChurnUserDataCount, userData);
+                }
+
+                pCmdBuffer->CmdDispatch(1, 1, 1);
+            }
+
+            result = pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pPipeline);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Instantiates a one-draw template, patching its vertex and instance counts on every call.  Each instantiation must
+// copy the whole template into the caller, so the caller's command data has to grow by at least the template's size.
+static Result RunTemplate(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice            = pContext->pDevice;
+    const BenchConfig& config             = pDevice->Config();
+    IPipeline*         pPipeline          = nullptr;
+    ICmdAllocator*     pTemplateAllocator = nullptr;
+    ICmdBuffer*        pTemplate          = nullptr;
+    Result             result             = pDevice->CreateGraphicsPipeline(&pPipeline);
+
+    if (result == Result::Success)
+    {
+        result = pDevice->CreateCmdBuffer(QueueTypeUniversal, &pTemplateAllocator, &pTemplate, true);
+    }
+
+    if (result == Result::Success)
+    {
+        CmdBufferBuildInfo buildInfo = {};
+        result = pTemplate->Begin(buildInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        PipelineBindParams bindParams = {};
+        bindParams.pipelineBindPoint = PipelineBindPoint::Graphics;
+        bindParams.pPipeline         = pPipeline;
+
+        pTemplate->CmdBindPipeline(bindParams);
+        pDevice->BindDefaultGraphicsState(pTemplate);
+
+        CmdPatchSlotInfo slotInfo = {};
+        slotInfo.slotId = 0;
+        slotInfo.type   = CmdPatchSlotType::VertexCount;
+        pTemplate->CmdDeclarePatchSlot(slotInfo);
+
+        slotInfo.slotId = 1;
+        slotInfo.type   = CmdPatchSlotType::InstanceCount;
+        pTemplate->CmdDeclarePatchSlot(slotInfo);
+
+        pTemplate->CmdDraw(0, 3, 0, 1);
+
+        result = pTemplate->End();
+    }
+
+    const uint32 templateSize = (result == Result::Success) ? pTemplate->GetUsedSize(CommandDataAlloc) : 0;
+
+    CmdPatchValue patches[2] = {};
+    patches[0].slotId = 0;
+    patches[1].slotId = 1;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            ICmdBuffer*const pCmdBuffer = pContext->pCmdBuffer;
+
+            for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+            {
+                patches[0].u32 = 3 * (1 + (op % 4));
+                patches[1].u32 = 1 + (op % 8);
+
+                const uint32 sizeBefore = pCmdBuffer->GetUsedSize(CommandDataAlloc);
+
+                pCmdBuffer->CmdExecuteTemplate(pTemplate, 2, &patches[0]);
+
+                if ((pCmdBuffer->GetUsedSize(CommandDataAlloc) - sizeBefore) < templateSize)
+                {
+                    PAL_ALERT_ALWAYS_MSG("A template instance is smaller than the template.");
+                    result = Result::ErrorUnknown;
+                }
+            }
+
+            if (result == Result::Success)
+            {
+                result = pCmdBuffer->End();
+            }
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    pDevice->DestroyObject(pTemplate);
+    pDevice->DestroyObject(pTemplateAllocator);
+    pDevice->DestroyObject(pPipeline);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records global memory barriers which alternate between copy-to-shader and shader-to-copy hazards.
+static Result RunBarrier(
+    ThreadContext* pContext)
+{
+    const BenchConfig& config = pContext->pDevice->Config();
+    Result             result = Result::Success;
+
+    const HwPipePoint pipePoint = HwPipeBottom;
+
+    BarrierInfo barrier = {};
+    barrier.waitPoint          = HwPipeTop;
+    barrier.pipePointWaitCount = 1;
+    barrier.pPipePoints        = &pipePoint;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                const bool copyToShader = ((op & 1) == 0);
+
+                barrier.globalSrcCacheMask = copyToShader ? CoherCopy   : CoherShader;
+                barrier.globalDstCacheMask = copyToShader ? CoherShader : CoherCopy;
+
+                pContext->pCmdBuffer->CmdBarrier(barrier);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    return result;
+}
+
+// =====================================================================================================================
+// The BarrierBegin callbacks the barrier ordering scenario saw for its command buffer.
+struct BarrierOrderLog
+{
+    const ICmdBuffer* pCmdBuffer;
+    uint32            count;
+    uint32            reason[BarrierOrderMaxLogged];
+    uint32            numMergedCalls[BarrierOrderMaxLogged];
+};
+
+// =====================================================================================================================
+// Developer callback which logs each barrier the barrier ordering scenario's command buffer starts to execute.
+static void PAL_STDCALL BarrierOrderCb(
+    void*                   pPrivateData,
+    const uint32            deviceIndex,
+    Developer::CallbackType type,
+    void*                   pCbData)
+{
+    BarrierOrderLog*const pLog = static_cast<BarrierOrderLog*>(pPrivateData);
+
+    if ((pLog != nullptr) && (type == Developer::CallbackType::BarrierBegin))
+    {
+        const auto& data = *static_cast<const Developer::BarrierData*>(pCbData);
+
+        if ((data.pCmdBuffer == pLog->pCmdBuffer) && (pLog->count < BarrierOrderMaxLogged))
+        {
+            pLog->reason[pLog->count]         = data.reason;
+            pLog->numMergedCalls[pLog->count] = data.numMergedCalls;
+            pLog->count++;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Checks that deferred barriers keep their order relative to a barrier which can't be deferred: two deferrable
+// barriers, one which waits on a GPU event, then one more deferrable barrier.  The first two must execute merged and
+// before the event wait, and the last one must execute on its own when the command buffer ends.  Each command buffer
+// is one operation.  Only the first thread records since the developer callback is shared by the whole platform.
+static Result RunBarrierOrder(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IGpuEvent*         pEvent  = nullptr;
+    IGpuMemory*        pMemory = nullptr;
+    BarrierOrderLog    log     = {};
+
+    Result result = Result::Success;
+
+    if (pContext->threadIndex == 0)
+    {
+        result = pDevice->CreateGpuEvent(&pEvent, &pMemory);
+    }
+
+    if ((result == Result::Success) && (pEvent != nullptr))
+    {
+        log.pCmdBuffer = pContext->pCmdBuffer;
+        IPlatform::InstallDeveloperCb(pDevice->GetPlatform(), &BarrierOrderCb, &log);
+    }
+
+    const HwPipePoint pipePoint  = HwPipeBottom;
+    const IGpuEvent*  pWaitEvent = pEvent;
+
+    BarrierInfo barrier = {};
+    barrier.waitPoint          = HwPipeTop;
+    barrier.pipePointWaitCount = 1;
+    barrier.pPipePoints        = &pipePoint;
+    barrier.globalSrcCacheMask = CoherShader;
+    barrier.globalDstCacheMask = CoherCopy;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (pEvent != nullptr) && (iter < config.iterations); ++iter)
+    {
+        log.count = 0;
+
+        result = BeginCmdBuffer(pContext, true);
+
+        if (result == Result::Success)
+        {
+            barrier.reason = 1;
+            pContext->pCmdBuffer->CmdBarrier(barrier);
+
+            barrier.reason = 2;
+            pContext->pCmdBuffer->CmdBarrier(barrier);
+
+            barrier.reason            = 3;
+            barrier.gpuEventWaitCount = 1;
+            barrier.ppGpuEvents       = &pWaitEvent;
+            pContext->pCmdBuffer->CmdBarrier(barrier);
+
+            barrier.reason            = 4;
+            barrier.gpuEventWaitCount = 0;
+            barrier.ppGpuEvents       = nullptr;
+            pContext->pCmdBuffer->CmdBarrier(barrier);
+
+            result = pContext->pCmdBuffer->End();
+        }
+
+        if ((result == Result::Success) &&
+            ((log.count     != BarrierOrderExpectedCount)          ||
+             (log.reason[0] != 1) || (log.numMergedCalls[0] != 2) ||
+             (log.reason[1] != 3) || (log.numMergedCalls[1] != 1) ||
+             (log.reason[2] != 4) || (log.numMergedCalls[2] != 1)))
+        {
+            PAL_ALERT_ALWAYS_MSG("Deferred barriers executed out of order.");
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = (pEvent != nullptr) ? config.iterations : 0;
+
+    if (pEvent != nullptr)
+    {
+        IPlatform::InstallDeveloperCb(pDevice->GetPlatform(), &BarrierOrderCb, nullptr);
+    }
+
+    pDevice->DestroyObject(pEvent);
+    pDevice->DestroyObject(pMemory);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records RPM buffer copies of varying sizes between two allocations.
+static Result RunCopyMemory(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IGpuMemory*        pSrc    = nullptr;
+    IGpuMemory*        pDst    = nullptr;
+    Result             result  = pDevice->CreateGpuMemory(CopyMemorySize, &pSrc);
+
+    if (result == Result::Success)
+    {
+        result = pDevice->CreateGpuMemory(CopyMemorySize, &pDst);
+    }
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                // Cycle through 256 byte to 64KB copies so both the small and large copy paths are covered.
+                MemoryCopyRegion region = {};
+                region.copySize = gpusize(256) << (op % 9);
+
+                pContext->pCmdBuffer->CmdCopyMemory(*pSrc, *pDst, 1, &region);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pDst);
+    pDevice->DestroyObject(pSrc);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records RPM buffer copies with many regions per call.  Half of the regions continue exactly where the previous one
+// ended, like a streaming upload, and the rest are scattered, so both the merged and the per-section paths are covered.
+static Result RunCopyMemoryRegions(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IGpuMemory*        pSrc    = nullptr;
+    IGpuMemory*        pDst    = nullptr;
+    Result             result  = pDevice->CreateGpuMemory(CopyMemorySize, &pSrc);
+
+    if (result == Result::Success)
+    {
+        result = pDevice->CreateGpuMemory(CopyMemorySize, &pDst);
+    }
+
+    MemoryCopyRegion regions[CopyRegionCount] = {};
+
+    for (uint32 i = 0; i < CopyRegionCount; ++i)
+    {
+        // Scattered regions skip every other chunk so they never line up with their neighbors.
+        const gpusize chunk = (i < (CopyRegionCount / 2)) ? i : (i * 2);
+
+        regions[i].srcOffset = chunk * CopyRegionSize;
+        regions[i].dstOffset = chunk * CopyRegionSize;
+        regions[i].copySize  = CopyRegionSize;
+    }
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                pContext->pCmdBuffer->CmdCopyMemory(*pSrc, *pDst, CopyRegionCount, &regions[0]);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration * CopyRegionCount;
+    pDevice->DestroyObject(pDst);
+    pDevice->DestroyObject(pSrc);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records RPM buffer fills of varying sizes.
+static Result RunFillMemory(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IGpuMemory*        pDst    = nullptr;
+    Result             result  = pDevice->CreateGpuMemory(CopyMemorySize, &pDst);
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                pContext->pCmdBuffer->CmdFillMemory(*pDst, 0, gpusize(256) << (op % 9), op);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pDst);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records RPM image-to-image copies.
+static Result RunCopyImage(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice    = pContext->pDevice;
+    const BenchConfig& config     = pDevice->Config();
+    IImage*            pSrc       = nullptr;
+    IImage*            pDst       = nullptr;
+    IGpuMemory*        pSrcMemory = nullptr;
+    IGpuMemory*        pDstMemory = nullptr;
+
+    ImageCreateInfo createInfo = {};
+    BenchDevice::InitImageCreateInfo(&createInfo);
+
+    Result result = pDevice->CreateImage(createInfo, &pSrc, &pSrcMemory);
+
+    if (result == Result::Success)
+    {
+        result = pDevice->CreateImage(createInfo, &pDst, &pDstMemory);
+    }
+
+    ImageLayout srcLayout = {};
+    srcLayout.usages  = LayoutCopySrc;
+    srcLayout.engines = LayoutUniversalEngine;
+
+    ImageLayout dstLayout = {};
+    dstLayout.usages  = LayoutCopyDst;
+    dstLayout.engines = LayoutUniversalEngine;
+
+    ImageCopyRegion region = {};
+    region.extent    = createInfo.extent;
+    region.numSlices = 1;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                pContext->pCmdBuffer->CmdCopyImage(*pSrc, srcLayout, *pDst, dstLayout, 1, &region, nullptr, 0);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pDst);
+    pDevice->DestroyObject(pSrc);
+    pDevice->DestroyObject(pDstMemory);
+    pDevice->DestroyObject(pSrcMemory);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records RPM color image clears.
+static Result RunClearImage(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IImage*            pImage  = nullptr;
+    IGpuMemory*        pMemory = nullptr;
+
+    ImageCreateInfo createInfo = {};
+    BenchDevice::InitImageCreateInfo(&createInfo);
+
+    Result result = pDevice->CreateImage(createInfo, &pImage, &pMemory);
+
+    ImageLayout layout = {};
+    layout.usages  = LayoutCopyDst;
+    layout.engines = LayoutUniversalEngine;
+
+    SubresRange range = {};
+    range.startSubres.aspect = ImageAspect::Color;
+    range.numMips            = 1;
+    range.numSlices          = 1;
+
+    ClearColor color = {};
+    color.type = ClearColorType::Float;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        result = BeginCmdBuffer(pContext);
+
+        if (result == Result::Success)
+        {
+            for (uint32 op = 0; op < config.opsPerIteration; ++op)
+            {
+                color.f32Color[0] = static_cast<float>(op & 0xFF) / 255.0f;
+                pContext->pCmdBuffer->CmdClearColorImage(*pImage, layout, color, 1, &range, 0, nullptr, 0);
+            }
+
+            result = pContext->pCmdBuffer->End();
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+    pDevice->DestroyObject(pImage);
+    pDevice->DestroyObject(pMemory);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates and destroys graphics pipelines from the user's ELF.
+static Result RunPipeline(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    Result             result  = Result::Success;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            IPipeline* pPipeline = nullptr;
+            result = pDevice->CreateGraphicsPipeline(&pPipeline);
+
+            pDevice->DestroyObject(pPipeline);
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates and destroys graphics pipelines while another pipeline from the same ELF stays alive.  When the
+// EnablePipelineCodeDedup setting is on every new pipeline must reuse the shared code of the first one, which
+// QueryAllocationInfo reports after the pipeline's own allocation; otherwise each pipeline reports only its own.
+static Result RunPipelineDedup(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice    = pContext->pDevice;
+    const BenchConfig& config     = pDevice->Config();
+    IPipeline*         pReference = nullptr;
+
+    constexpr size_t   MaxAllocations = 8;
+    GpuMemSubAllocInfo refAllocs[MaxAllocations] = {};
+    size_t             numRefAllocs              = 0;
+
+    Result result = pDevice->CreateGraphicsPipeline(&pReference);
+
+    if (result == Result::Success)
+    {
+        result = pReference->QueryAllocationInfo(&numRefAllocs, nullptr);
+    }
+
+    if ((result == Result::Success) && (numRefAllocs <= MaxAllocations))
+    {
+        result = pReference->QueryAllocationInfo(&numRefAllocs, &refAllocs[0]);
+    }
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            IPipeline*         pPipeline = nullptr;
+            GpuMemSubAllocInfo allocs[MaxAllocations] = {};
+            size_t             numAllocs              = 0;
+
+            result = pDevice->CreateGraphicsPipeline(&pPipeline);
+
+            if (result == Result::Success)
+            {
+                result = pPipeline->QueryAllocationInfo(&numAllocs, nullptr);
+            }
+
+            if ((result == Result::Success) && (numAllocs == numRefAllocs))
+            {
+                result = pPipeline->QueryAllocationInfo(&numAllocs, &allocs[0]);
+            }
+            else if (result == Result::Success)
+            {
+                PAL_ALERT_ALWAYS_MSG("Identical pipelines report different numbers of allocations.");
+                result = Result::ErrorUnknown;
+            }
+
+            // Entry 0 is each pipeline's private allocation; the rest must be the very same shared code.
+            for (size_t i = 1; (result == Result::Success) && (i < numAllocs); ++i)
+            {
+                if ((allocs[i].pGpuMemory != refAllocs[i].pGpuMemory) || (allocs[i].offset != refAllocs[i].offset))
+                {
+                    PAL_ALERT_ALWAYS_MSG("Identical pipelines did not share their code.");
+                    result = Result::ErrorUnknown;
+                }
+            }
+
+            pDevice->DestroyObject(pPipeline);
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    pDevice->DestroyObject(pReference);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates and destroys 2D color images.  No memory is bound; this isolates the image setup and addressing work.
+static Result RunImage(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    Result             result  = Result::Success;
+
+    ImageCreateInfo createInfo = {};
+    BenchDevice::InitImageCreateInfo(&createInfo);
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            IImage* pImage = nullptr;
+            result = pDevice->CreateImage(createInfo, &pImage, nullptr);
+
+            pDevice->DestroyObject(pImage);
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Builds typed buffer, untyped buffer and sampler SRDs, plus image view SRDs when the device supports images.  Each
+// descriptor built counts as one operation.
+static Result RunSrd(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice      = pContext->pDevice;
+    const IDevice*     pPalDevice   = pDevice->GetDevice();
+    const BenchConfig& config       = pDevice->Config();
+    const bool         doImageViews = pDevice->Supports(RequireImages);
+    IGpuMemory*        pMemory      = nullptr;
+    IImage*            pImage       = nullptr;
+    IGpuMemory*        pImageMemory = nullptr;
+    Result             result       = pDevice->CreateGpuMemory(CopyMemorySize, &pMemory);
+
+    if ((result == Result::Success) && doImageViews)
+    {
+        ImageCreateInfo createInfo = {};
+        BenchDevice::InitImageCreateInfo(&createInfo);
+
+        result = pDevice->CreateImage(createInfo, &pImage, &pImageMemory);
+    }
+
+    uint32 srd[MaxSrdDwords] = {};
+
+    BufferViewInfo typedView = {};
+    typedView.swizzledFormat = Rgba8Format;
+    typedView.stride         = 4;
+
+    BufferViewInfo untypedView = {};
+    untypedView.swizzledFormat = UndefinedSwizzledFormat;
+    untypedView.stride         = 1;
+
+    SamplerInfo sampler = {};
+    sampler.filter.magnification = XyFilterLinear;
+    sampler.filter.minification  = XyFilterLinear;
+    sampler.filter.mipFilter     = MipFilterLinear;
+    sampler.addressU             = TexAddressMode::Wrap;
+    sampler.addressV             = TexAddressMode::Wrap;
+    sampler.addressW             = TexAddressMode::Wrap;
+    sampler.compareFunc          = CompareFunc::Never;
+    sampler.maxLod               = 16.0f;
+
+    ImageViewInfo imageView = {};
+    imageView.pImage                         = pImage;
+    imageView.viewType                       = ImageViewType::Tex2d;
+    imageView.swizzledFormat                 = Rgba8Format;
+    imageView.subresRange.startSubres.aspect = ImageAspect::Color;
+    imageView.subresRange.numMips            = 1;
+    imageView.subresRange.numSlices          = 1;
+    imageView.possibleLayouts.usages         = LayoutShaderRead;
+    imageView.possibleLayouts.engines        = LayoutUniversalEngine;
+
+    uint64 srdCount = 0;
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        for (uint32 op = 0; op < config.opsPerIteration; ++op)
+        {
+            const gpusize offset = gpusize(op % 256) * 256;
+
+            typedView.gpuAddr   = pMemory->Desc().gpuVirtAddr + offset;
+            typedView.range     = CopyMemorySize - offset;
+            untypedView.gpuAddr = typedView.gpuAddr;
+            untypedView.range   = typedView.range;
+            sampler.mipLodBias  = static_cast<float>(op & 0xF);
+
+            pPalDevice->CreateTypedBufferViewSrds(1, &typedView, srd);
+            pPalDevice->CreateUntypedBufferViewSrds(1, &untypedView, srd);
+            pPalDevice->CreateSamplerSrds(1, &sampler, srd);
+            srdCount += 3;
+
+            if (doImageViews)
+            {
+                pPalDevice->CreateImageViewSrds(1, &imageView, srd);
+                srdCount++;
+            }
+        }
+    }
+
+    EndTiming(pContext);
+
+    pContext->operations = srdCount;
+    pDevice->DestroyObject(pImage);
+    pDevice->DestroyObject(pImageMemory);
+    pDevice->DestroyObject(pMemory);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates a batch of slots from a GpuUtil::DescriptorHeap, writes a buffer SRD into each, then frees half of them
+// immediately and defers the other half until the next iteration, like a frame's worth of transient descriptors.  Each
+// slot allocated counts as one operation.  Afterwards it checks that every slot was recycled and that a full heap fails
+// cleanly.
+static Result RunDescriptorHeap(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice    = pContext->pDevice;
+    IDevice*           pPalDevice = pDevice->GetDevice();
+    const BenchConfig& config     = pDevice->Config();
+    const uint32       srdSize    = pDevice->Properties().gfxipProperties.srdSizes.bufferView;
+    IGpuMemory*        pMemory    = nullptr;
+    Result             result     = pDevice->CreateGpuMemory(CopyMemorySize, &pMemory);
+
+    GpuUtil::DescriptorHeap heap(pDevice->GetPlatform(), pPalDevice);
+
+    GpuUtil::DescriptorHeapCreateInfo createInfo = {};
+    createInfo.flags.addMemoryReferences = 1;
+    createInfo.slotSize                  = srdSize;
+    createInfo.slotsPerBlock             = Max(DescriptorSlotsPerBlock,
+                                               RoundUpQuotient(config.opsPerIteration, DescriptorMaxBlocks));
+    createInfo.maxBlocks                 = Max(1u, RoundUpQuotient(config.opsPerIteration, createInfo.slotsPerBlock));
+    createInfo.heap                      = GpuHeapGartCacheable;
+
+    if (result == Result::Success)
+    {
+        result = heap.Init(createInfo);
+    }
+
+    GpuUtil::DescriptorSlot* pSlots =
+        PAL_NEW_ARRAY(GpuUtil::DescriptorSlot, config.opsPerIteration, pDevice->Allocator(), AllocInternal);
+
+    if ((result == Result::Success) && (pSlots == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    BufferViewInfo view = {};
+    view.swizzledFormat = Rgba8Format;
+    view.stride         = 4;
+
+    uint32 srd[MaxSrdDwords] = {};
+
+    BeginTiming(pContext);
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        // The previous iteration's deferred slots are the only ones tagged with a value at most iter.
+        heap.RetireDeferredFrees(iter);
+
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            result = heap.Allocate(&pSlots[op]);
+
+            if (result == Result::Success)
+            {
+                view.gpuAddr = pMemory->Desc().gpuVirtAddr + (gpusize(op % 256) * 256);
+                view.range   = CopyMemorySize - (gpusize(op % 256) * 256);
+
+                heap.WriteTypedBufferViewSrds(pSlots[op], 0, 1, &view);
+            }
+        }
+
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            if ((op & 1) == 0)
+            {
+                heap.Free(pSlots[op]);
+            }
+            else
+            {
+                heap.FreeDeferred(pSlots[op], iter + 1);
+            }
+        }
+    }
+
+    EndTiming(pContext);
+
+    if (result == Result::Success)
+    {
+        // The last slot written must hold exactly the SRD the device builds for the same view.
+        pPalDevice->CreateTypedBufferViewSrds(1, &view, srd);
+
+        heap.RetireDeferredFrees(UINT64_MAX);
+
+        GpuUtil::DescriptorHeapStats stats = {};
+        heap.QueryStats(&stats);
+
+        if ((stats.numSlotsAllocated != 0) || (stats.numSlotsDeferred != 0))
+        {
+            PAL_ALERT_ALWAYS_MSG("The descriptor heap lost track of freed slots.");
+            result = Result::ErrorUnknown;
+        }
+        else if ((config.iterations > 0) && (stats.numSlotsCarved != config.opsPerIteration))
+        {
+            PAL_ALERT_ALWAYS_MSG("The descriptor heap did not recycle freed slots.");
+            result = Result::ErrorUnknown;
+        }
+        else if ((config.iterations > 0) && (config.opsPerIteration > 0) &&
+                 (memcmp(heap.CpuAddress(pSlots[config.opsPerIteration - 1]), srd, srdSize) != 0))
+        {
+            PAL_ALERT_ALWAYS_MSG("The descriptor heap slot does not hold the SRD written to it.");
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        GpuUtil::DescriptorHeap smallHeap(pDevice->GetPlatform(), pPalDevice);
+
+        createInfo.slotsPerBlock = DescriptorOverflowSlots;
+        createInfo.maxBlocks     = 1;
+
+        result = smallHeap.Init(createInfo);
+
+        GpuUtil::DescriptorSlot slots[DescriptorOverflowSlots + 1] = {};
+
+        for (uint32 idx = 0; (result == Result::Success) && (idx < DescriptorOverflowSlots); ++idx)
+        {
+            result = smallHeap.Allocate(&slots[idx]);
+        }
+
+        if ((result == Result::Success) &&
+            ((smallHeap.Allocate(&slots[DescriptorOverflowSlots]) != Result::ErrorOutOfMemory) ||
+             (slots[DescriptorOverflowSlots] != GpuUtil::InvalidDescriptorSlot)))
+        {
+            PAL_ALERT_ALWAYS_MSG("A full descriptor heap handed out a slot.");
+            result = Result::ErrorUnknown;
+        }
+
+        for (uint32 idx = 0; (result == Result::Success) && (idx < DescriptorOverflowSlots); ++idx)
+        {
+            smallHeap.Free(slots[idx]);
+        }
+    }
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    PAL_SAFE_DELETE_ARRAY(pSlots, pDevice->Allocator());
+    pDevice->DestroyObject(pMemory);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Runs submit memory reference lists through a GpuUtil::ResidencyManager whose budget is smaller than the allocation
+// pool, so each operation is one PrepareSubmit() which usually both evicts and makes allocations resident.
+static Result RunResidency(
+    ThreadContext* pContext)
+{
+    BenchDevice*       pDevice = pContext->pDevice;
+    const BenchConfig& config  = pDevice->Config();
+    IGpuMemory*        pMemory[ResidencyAllocCount] = {};
+
+    GpuUtil::ResidencyManager residency(pDevice->GetPlatform(), pDevice->GetDevice());
+
+    GpuUtil::ResidencyManagerCreateInfo createInfo = {};
+    createInfo.budget[GpuHeapGartCacheable] = ResidencyBudgetAllocs * ResidencyAllocSize;
+
+    Result result = residency.Init(createInfo);
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < ResidencyAllocCount); ++idx)
+    {
+        result = pDevice->CreateGpuMemory(ResidencyAllocSize, &pMemory[idx]);
+    }
+
+    BeginTiming(pContext);
+
+    uint32 first = 0;
+
+    for (uint32 iter = 0; (result == Result::Success) && (iter < config.iterations); ++iter)
+    {
+        for (uint32 op = 0; (result == Result::Success) && (op < config.opsPerIteration); ++op)
+        {
+            // Step the window by a prime so that consecutive submits partially overlap and revisit old allocations.
+            GpuMemoryRef refs[ResidencyRefsPerSubmit] = {};
+
+            for (uint32 ref = 0; ref < ResidencyRefsPerSubmit; ++ref)
+            {
+                refs[ref].pGpuMemory = pMemory[(first + ref) % ResidencyAllocCount];
+            }
+
+            result = residency.PrepareSubmit(ResidencyRefsPerSubmit, &refs[0]);
+            first  = (first + 5) % ResidencyAllocCount;
+        }
+    }
+
+    EndTiming(pContext);
+
+    if (result == Result::Success)
+    {
+        GpuUtil::ResidencyStats stats = {};
+        residency.QueryStats(&stats);
+
+        // The budget must have been respected, since no single submit's working set exceeds it.
+        PAL_ASSERT(stats.residentBytes[GpuHeapGartCacheable] <= stats.budgetBytes[GpuHeapGartCacheable]);
+        PAL_ASSERT(stats.numOverBudget == 0);
+    }
+
+    pContext->operations = static_cast<uint64>(config.iterations) * config.opsPerIteration;
+
+    for (uint32 idx = 0; idx < ResidencyAllocCount; ++idx)
+    {
+        if (pMemory[idx] != nullptr)
+        {
+            residency.ReleaseMemory(pMemory[idx]);
+            pDevice->DestroyObject(pMemory[idx]);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+const ScenarioInfo Scenarios[ScenarioCount] =
+{
+    { "draw",           "CmdDraw with state churn",                RequireGraphicsElf,   RunDraw              },
+    { "dispatch",       "CmdDispatch with user data churn",        RequireComputeElf,    RunDispatch          },
+    { "template",       "CmdExecuteTemplate with patched counts",  TemplateRequirements, RunTemplate          },
+    { "barrier",        "Global memory CmdBarrier",                0,                    RunBarrier           },
+    { "barrierOrder",   "Deferred CmdBarrier ordering check",      0,                    RunBarrierOrder      },
+    { "copyMemory",     "RPM CmdCopyMemory",                       0,                    RunCopyMemory        },
+    { "copyRegions",    "RPM CmdCopyMemory, 32 regions per call",  0,                    RunCopyMemoryRegions },
+    { "fillMemory",     "RPM CmdFillMemory",                       0,                    RunFillMemory        },
+    { "copyImage",      "RPM CmdCopyImage",                        RequireImages,        RunCopyImage         },
+    { "clearImage",     "RPM CmdClearColorImage",                  RequireImages,        RunClearImage        },
+    { "pipeline",       "CreateGraphicsPipeline from an ELF",      RequireGraphicsElf,   RunPipeline          },
+    { "pipelineDedup",  "CreateGraphicsPipeline with shared code", RequireGraphicsElf,   RunPipelineDedup     },
+    { "image",          "CreateImage",                             RequireImages,        RunImage             },
+    { "srd",            "Buffer, sampler and image view SRDs",     0,                    RunSrd               },
+    { "residency",      "ResidencyManager LRU PrepareSubmit",      0,                    RunResidency         },
+    { "descriptorHeap", "DescriptorHeap allocate, write and free", 0,                    RunDescriptorHeap    },
+    { "fenceTracker",   "amdgpu fence tracker on a mock libdrm",   RequireAmdgpu,        RunFenceTracker      },
+};
+
+} // PalBench
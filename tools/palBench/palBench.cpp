@@ -0,0 +1,498 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palBench.cpp
+ * @brief CPU benchmark for PAL command building and object creation, run against the null device.
+ *
+ * Usage: palBench [--gpu=<name>] [--threads=<n>] [--iterations=<n>] [--ops=<n>] [--churn=<percent>]
+ *                 [--graphics-elf=<path>] [--compute-elf=<path>] [--scenarios=<a,b,...>] [--output=<path>] [--list]
+ *
+ * Each scenario runs on every thread concurrently, each thread with its own command allocator and command buffer.  The
+ * report is a JSON document suitable for tracking CPU-side regressions between PAL versions in CI.
+ ***********************************************************************************************************************
+ */
+
+#include "palBench.h"
+#include "palJsonWriter.h"
+#include "palThread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+using namespace Pal;
+using namespace Util;
+using namespace PalBench;
+
+// Upper bound on the number of scenario threads.
+constexpr uint32 MaxThreads = 64;
+
+// =====================================================================================================================
+// JsonStream which writes to a stdio stream.
+class BenchJsonStream : public JsonStream
+{
+public:
+    explicit BenchJsonStream(FILE* pFile) : m_pFile(pFile) { }
+    virtual ~BenchJsonStream() { }
+
+    virtual void WriteString(const char* pString, uint32 length) override { fwrite(pString, 1, length, m_pFile); }
+    virtual void WriteCharacter(char character) override { fputc(character, m_pFile); }
+
+private:
+    FILE*const m_pFile;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BenchJsonStream);
+};
+
+// Outcome of one scenario across all threads.
+struct BenchResult
+{
+    const ScenarioInfo* pScenario;
+    const char*         pSkipReason;  // Non-null if the scenario did not run.
+    Result              result;
+    uint64              operations;   // Sum of the operations performed by every thread.
+    uint64              elapsedNs;    // Wall-clock time from the first thread starting to the last thread finishing.
+};
+
+// =====================================================================================================================
+static void PrintUsage()
+{
+    fprintf(stderr,
+            "usage: palBench [options]\n"
+            "  --gpu=<name>           Null device to emulate, e.g. NAVI10 or gfx900 (default NAVI10)\n"
+            "  --threads=<n>          Threads running each scenario concurrently (default 1)\n"
+            "  --iterations=<n>       Timed iterations per thread (default 100)\n"
+            "  --ops=<n>              Operations per iteration (default 1000)\n"
+            "  --churn=<percent>      Percentage of draws/dispatches preceded by a state change (default 10)\n"
+            "  --graphics-elf=<path>  Graphics pipeline ELF for the draw and pipeline scenarios\n"
+            "  --compute-elf=<path>   Compute pipeline ELF for the dispatch scenario\n"
+            "  --scenarios=<a,b,...>  Scenarios to run (default all)\n"
+            "  --output=<path>        JSON report path (default stdout)\n"
+            "  --list                 List the scenarios and null devices, then exit\n");
+}
+
+// =====================================================================================================================
+// Prints the available scenarios and null devices.
+static void PrintList()
+{
+    fprintf(stderr, "scenarios:\n");
+    for (uint32 i = 0; i < ScenarioCount; ++i)
+    {
+        fprintf(stderr, "  %-12s %s\n", Scenarios[i].pName, Scenarios[i].pDescription);
+    }
+
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      nullGpuCount = static_cast<uint32>(NullGpuId::Max);
+
+    if (EnumerateNullDevices(&nullGpuCount, nullGpus) == Result::Success)
+    {
+        fprintf(stderr, "null devices:\n");
+        for (uint32 i = 0; i < nullGpuCount; ++i)
+        {
+            fprintf(stderr, "  %s\n", nullGpus[i].pGpuName);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Looks up a null device by either half of its "NAME:gfxNNN" name, ignoring case.
+static bool FindNullGpu(
+    const char* pName,
+    NullGpuId*  pNullGpuId)
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      nullGpuCount = static_cast<uint32>(NullGpuId::Max);
+    bool        found        = false;
+
+    if (EnumerateNullDevices(&nullGpuCount, nullGpus) == Result::Success)
+    {
+        for (uint32 i = 0; (found == false) && (i < nullGpuCount); ++i)
+        {
+            const char*  pGpuName = nullGpus[i].pGpuName;
+            const char*  pGfxName = strchr(pGpuName, ':');
+            const size_t nameLen  = (pGfxName != nullptr) ? static_cast<size_t>(pGfxName - pGpuName) : strlen(pGpuName);
+
+            found = (((strlen(pName) == nameLen) && (strncasecmp(pName, pGpuName, nameLen) == 0)) ||
+                     ((pGfxName != nullptr) && (strcasecmp(pName, pGfxName + 1) == 0)));
+
+            if (found)
+            {
+                (*pNullGpuId) = nullGpus[i].nullGpuId;
+            }
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Parses a non-negative integer option value.  Returns false if the text is not a number.
+static bool ParseUint(
+    const char* pValue,
+    uint32*     pOut)
+{
+    char*               pEnd  = nullptr;
+    const unsigned long value = strtoul(pValue, &pEnd, 10);
+    const bool          valid = (pEnd != pValue) && (*pEnd == '\0') && (value <= UINT32_MAX);
+
+    if (valid)
+    {
+        (*pOut) = static_cast<uint32>(value);
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Parses "--key=value" arguments into the config.  Returns false on a malformed or unknown argument.
+static bool ParseArgs(
+    int          argc,
+    char**       argv,
+    BenchConfig* pConfig,
+    bool*        pListOnly)
+{
+    bool valid = true;
+
+    for (int i = 1; valid && (i < argc); ++i)
+    {
+        const char*  pArg   = argv[i];
+        const char*  pValue = strchr(pArg, '=');
+        const size_t keyLen = (pValue != nullptr) ? static_cast<size_t>(pValue - pArg) : strlen(pArg);
+
+        if (pValue != nullptr)
+        {
+            pValue++;
+        }
+
+        auto IsKey = [pArg, keyLen](const char* pKey) -> bool
+            { return (strlen(pKey) == keyLen) && (strncmp(pArg, pKey, keyLen) == 0); };
+
+        if (IsKey("--list"))
+        {
+            (*pListOnly) = true;
+        }
+        else if (pValue == nullptr)
+        {
+            valid = false;
+        }
+        else if (IsKey("--gpu"))
+        {
+            valid = FindNullGpu(pValue, &pConfig->nullGpuId);
+        }
+        else if (IsKey("--threads"))
+        {
+            valid = ParseUint(pValue, &pConfig->threadCount) &&
+                    (pConfig->threadCount > 0)               &&
+                    (pConfig->threadCount <= MaxThreads);
+        }
+        else if (IsKey("--iterations"))
+        {
+            valid = ParseUint(pValue, &pConfig->iterations);
+        }
+        else if (IsKey("--ops"))
+        {
+            valid = ParseUint(pValue, &pConfig->opsPerIteration);
+        }
+        else if (IsKey("--churn"))
+        {
+            valid = ParseUint(pValue, &pConfig->churnPercent) && (pConfig->churnPercent <= 100);
+        }
+        else if (IsKey("--graphics-elf"))
+        {
+            pConfig->pGraphicsElf = pValue;
+        }
+        else if (IsKey("--compute-elf"))
+        {
+            pConfig->pComputeElf = pValue;
+        }
+        else if (IsKey("--scenarios"))
+        {
+            pConfig->pScenarios = pValue;
+        }
+        else if (IsKey("--output"))
+        {
+            pConfig->pOutputPath = pValue;
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (valid == false)
+        {
+            fprintf(stderr, "palBench: invalid argument '%s'\n", pArg);
+        }
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Returns true if the named scenario appears in the comma-separated filter list, or if there is no filter.
+static bool IsScenarioSelected(
+    const char* pFilter,
+    const char* pName)
+{
+    bool selected = (pFilter == nullptr);
+
+    const size_t nameLen = strlen(pName);
+
+    while ((selected == false) && (pFilter != nullptr))
+    {
+        const char*  pComma = strchr(pFilter, ',');
+        const size_t length = (pComma != nullptr) ? static_cast<size_t>(pComma - pFilter) : strlen(pFilter);
+
+        selected = (length == nameLen) && (strncmp(pFilter, pName, length) == 0);
+        pFilter  = (pComma != nullptr) ? (pComma + 1) : nullptr;
+    }
+
+    return selected;
+}
+
+// =====================================================================================================================
+// Thread entry point; runs one scenario against the thread's context.
+static void ScenarioThreadFunc(
+    void* pParam)
+{
+    ThreadContext* pContext = static_cast<ThreadContext*>(pParam);
+
+    pContext->result = pContext->pScenario->pfnRun(pContext);
+}
+
+// =====================================================================================================================
+// Runs one scenario on every configured thread and gathers the combined result.
+static void RunScenario(
+    BenchDevice*        pDevice,
+    const ScenarioInfo& scenario,
+    BenchResult*        pResult)
+{
+    const uint32 threadCount = pDevice->Config().threadCount;
+
+    ThreadContext contexts[MaxThreads] = {};
+    Thread        threads[MaxThreads];
+
+    Result result = Result::Success;
+
+    // Command buffer setup is untimed and happens before any thread starts so it doesn't skew the measurement.
+    for (uint32 i = 0; (result == Result::Success) && (i < threadCount); ++i)
+    {
+        contexts[i].pDevice     = pDevice;
+        contexts[i].pScenario   = &scenario;
+        contexts[i].threadIndex = i;
+
+        result = pDevice->CreateCmdBuffer(QueueTypeUniversal, &contexts[i].pCmdAllocator, &contexts[i].pCmdBuffer);
+    }
+
+    for (uint32 i = 0; (result == Result::Success) && (i < threadCount); ++i)
+    {
+        result = threads[i].Begin(&ScenarioThreadFunc, &contexts[i]);
+    }
+
+    int64 firstBegin = INT64_MAX;
+    int64 lastEnd    = 0;
+
+    for (uint32 i = 0; i < threadCount; ++i)
+    {
+        if (threads[i].IsCreated())
+        {
+            threads[i].Join();
+
+            firstBegin = Min(firstBegin, contexts[i].beginTicks);
+            lastEnd    = Max(lastEnd, contexts[i].endTicks);
+
+            pResult->operations += contexts[i].operations;
+
+            if (result == Result::Success)
+            {
+                result = contexts[i].result;
+            }
+        }
+
+        pDevice->DestroyObject(contexts[i].pCmdBuffer);
+        pDevice->DestroyObject(contexts[i].pCmdAllocator);
+    }
+
+    pResult->result = result;
+
+    if (lastEnd > firstBegin)
+    {
+        const double ticks = static_cast<double>(lastEnd - firstBegin);
+        pResult->elapsedNs = static_cast<uint64>(ticks * 1000000000.0 / static_cast<double>(GetPerfFrequency()));
+    }
+}
+
+// =====================================================================================================================
+// Writes the JSON report.
+static void WriteReport(
+    const BenchDevice& device,
+    const BenchResult* pResults,
+    uint32             resultCount,
+    FILE*              pFile)
+{
+    const BenchConfig& config = device.Config();
+
+    BenchJsonStream stream(pFile);
+    JsonWriter      writer(&stream);
+
+    writer.BeginMap(false);
+    writer.KeyAndValue("gpu", device.Properties().gpuName);
+    writer.KeyAndValue("gfxLevel", static_cast<uint32>(device.Properties().gfxLevel));
+
+    writer.KeyAndBeginMap("config", false);
+    writer.KeyAndValue("threads", config.threadCount);
+    writer.KeyAndValue("iterations", config.iterations);
+    writer.KeyAndValue("opsPerIteration", config.opsPerIteration);
+    writer.KeyAndValue("churnPercent", config.churnPercent);
+    writer.EndMap();
+
+    writer.KeyAndBeginList("results", false);
+    for (uint32 i = 0; i < resultCount; ++i)
+    {
+        const BenchResult& result = pResults[i];
+
+        writer.BeginMap(false);
+        writer.KeyAndValue("name", result.pScenario->pName);
+        writer.KeyAndValue("skipped", (result.pSkipReason != nullptr));
+
+        if (result.pSkipReason != nullptr)
+        {
+            writer.KeyAndValue("reason", result.pSkipReason);
+        }
+        else
+        {
+            writer.KeyAndValue("result", static_cast<int32>(result.result));
+            writer.KeyAndValue("operations", result.operations);
+            writer.KeyAndValue("elapsedNs", result.elapsedNs);
+
+            const uint64 opsPerSecond = (result.elapsedNs > 0) ?
+                static_cast<uint64>(static_cast<double>(result.operations) * 1000000000.0 / result.elapsedNs) : 0;
+            const float  nsPerOp      = (result.operations > 0) ?
+                static_cast<float>(static_cast<double>(result.elapsedNs) / result.operations) : 0.0f;
+
+            writer.KeyAndValue("opsPerSecond", opsPerSecond);
+            writer.KeyAndValue("nsPerOp", nsPerOp);
+        }
+
+        writer.EndMap();
+    }
+    writer.EndList();
+
+    writer.EndMap();
+    fputc('\n', pFile);
+}
+
+// =====================================================================================================================
+int main(
+    int    argc,
+    char** argv)
+{
+    BenchConfig config     = {};
+    config.nullGpuId       = NullGpuId::Navi10;
+    config.threadCount     = 1;
+    config.iterations      = 100;
+    config.opsPerIteration = 1000;
+    config.churnPercent    = 10;
+
+    bool listOnly = false;
+    int  exitCode = 0;
+
+    if (ParseArgs(argc, argv, &config, &listOnly) == false)
+    {
+        PrintUsage();
+        exitCode = 1;
+    }
+    else if (listOnly)
+    {
+        PrintList();
+    }
+    else
+    {
+        BenchDevice device(config);
+        Result      result = device.Init();
+
+        if (result != Result::Success)
+        {
+            fprintf(stderr, "palBench: failed to initialize the null device (%d)\n", static_cast<int32>(result));
+            exitCode = 1;
+        }
+        else
+        {
+            BenchResult results[ScenarioCount] = {};
+            uint32      resultCount = 0;
+
+            for (uint32 i = 0; i < ScenarioCount; ++i)
+            {
+                const ScenarioInfo& scenario = Scenarios[i];
+
+                if (IsScenarioSelected(config.pScenarios, scenario.pName))
+                {
+                    BenchResult* pResult = &results[resultCount++];
+                    pResult->pScenario = &scenario;
+
+                    if (device.Supports(scenario.requirements))
+                    {
+                        RunScenario(&device, scenario, pResult);
+
+                        if (pResult->result != Result::Success)
+                        {
+                            exitCode = 1;
+                        }
+                    }
+                    else if (TestAnyFlagSet(scenario.requirements, RequireImages) &&
+                             (device.Supports(RequireImages) == false))
+                    {
+                        pResult->pSkipReason = "device does not support images";
+                    }
+                    else
+                    {
+                        pResult->pSkipReason = "no pipeline ELF was given";
+                    }
+                }
+            }
+
+            FILE* pFile = (config.pOutputPath != nullptr) ? fopen(config.pOutputPath, "w") : stdout;
+
+            if (pFile != nullptr)
+            {
+                WriteReport(device, results, resultCount, pFile);
+
+                if (pFile != stdout)
+                {
+                    fclose(pFile);
+                }
+            }
+            else
+            {
+                fprintf(stderr, "palBench: failed to open '%s'\n", config.pOutputPath);
+                exitCode = 1;
+            }
+        }
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,166 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palCmdAllocator.h"
+#include "palCmdBuffer.h"
+#include "palDevice.h"
+#include "palLib.h"
+#include "palPipeline.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+namespace PalBench
+{
+
+// Flags describing which optional inputs or device features a scenario needs before it can run.
+enum ScenarioRequirement : Pal::uint32
+{
+    RequireGraphicsElf = 0x1,  // A graphics pipeline ELF was supplied on the command line.
+    RequireComputeElf  = 0x2,  // A compute pipeline ELF was supplied on the command line.
+    RequireImages      = 0x4,  // The device can create IImage objects.
+    RequireTemplates   = 0x8,  // The device supports command buffer templates.
+    RequireAmdgpu      = 0x10, // PAL was built with its amdgpu backend.
+};
+
+// Benchmark configuration, filled in from the command line.
+struct BenchConfig
+{
+    Pal::NullGpuId nullGpuId;        // ASIC the null device emulates.
+    Pal::uint32    threadCount;      // Number of threads which run each scenario concurrently.
+    Pal::uint32    iterations;       // Number of timed iterations each thread runs per scenario.
+    Pal::uint32    opsPerIteration;  // Number of operations (draws, barriers, objects, ...) in each iteration.
+    Pal::uint32    churnPercent;     // Percentage of draws and dispatches which are preceded by a state change.
+    const char*    pGraphicsElf;     // Path to a graphics pipeline ELF, or null.
+    const char*    pComputeElf;      // Path to a compute pipeline ELF, or null.
+    const char*    pScenarios;       // Comma-separated list of scenarios to run, or null to run all of them.
+    const char*    pOutputPath;      // Path of the JSON report, or null to write it to stdout.
+};
+
+// =====================================================================================================================
+// Owns the null platform and device the benchmark runs on, along with the objects shared by every scenario thread.
+class BenchDevice
+{
+public:
+    explicit BenchDevice(const BenchConfig& config);
+    ~BenchDevice();
+
+    Pal::Result Init();
+
+    Pal::IPlatform*              GetPlatform() const { return m_pPlatform; }
+    Pal::IDevice*                GetDevice()   const { return m_pDevice; }
+    const Pal::DeviceProperties& Properties()  const { return m_properties; }
+    const BenchConfig&           Config()      const { return m_config; }
+    Util::GenericAllocator*      Allocator()         { return &m_allocator; }
+
+    bool Supports(Pal::uint32 requirements) const { return ((m_features & requirements) == requirements); }
+
+    Pal::Result CreateCmdBuffer(
+        Pal::QueueType       queueType,
+        Pal::ICmdAllocator** ppCmdAllocator,
+        Pal::ICmdBuffer**    ppCmdBuffer,
+        bool                 nested = false);
+    Pal::Result CreateGpuMemory(Pal::gpusize size, Pal::IGpuMemory** ppGpuMemory);
+    Pal::Result CreateImage(
+        const Pal::ImageCreateInfo& createInfo,
+        Pal::IImage**               ppImage,
+        Pal::IGpuMemory**           ppGpuMemory);
+    Pal::Result CreateGpuEvent(Pal::IGpuEvent** ppGpuEvent, Pal::IGpuMemory** ppGpuMemory);
+    Pal::Result CreateGraphicsPipeline(Pal::IPipeline** ppPipeline);
+    Pal::Result CreateComputePipeline(Pal::IPipeline** ppPipeline);
+
+    void BindDefaultGraphicsState(Pal::ICmdBuffer* pCmdBuffer) const;
+
+    void DestroyObject(Pal::IDestroyable* pObject);
+
+    static void InitImageCreateInfo(Pal::ImageCreateInfo* pCreateInfo);
+
+private:
+    Pal::Result LoadElf(const char* pFilePath, void** ppElf, size_t* pElfSize);
+    Pal::Result CreateDefaultStates();
+
+    const BenchConfig        m_config;
+    Util::GenericAllocator   m_allocator;
+
+    void*                    m_pPlatformMem;
+    Pal::IPlatform*          m_pPlatform;
+    Pal::IDevice*            m_pDevice;
+    Pal::DeviceProperties    m_properties;
+    Pal::uint32              m_features;     // Mask of ScenarioRequirement flags this device satisfies.
+
+    void*                    m_pGraphicsElf;
+    size_t                   m_graphicsElfSize;
+    void*                    m_pComputeElf;
+    size_t                   m_computeElfSize;
+
+    Pal::IMsaaState*         m_pMsaaState;
+    Pal::IColorBlendState*   m_pColorBlendState;
+    Pal::IDepthStencilState* m_pDepthStencilState;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BenchDevice);
+};
+
+struct ScenarioInfo;
+
+// =====================================================================================================================
+// Per-thread state handed to a scenario.  Scenarios do their untimed setup first, then bracket the measured work with
+// BeginTiming() and EndTiming() and report how many operations they performed.
+struct ThreadContext
+{
+    BenchDevice*        pDevice;
+    const ScenarioInfo* pScenario;      // Scenario this thread runs.
+    Pal::ICmdAllocator* pCmdAllocator;  // Private to this thread, so it need not be thread safe.
+    Pal::ICmdBuffer*    pCmdBuffer;     // Universal command buffer allocated from pCmdAllocator.
+    Pal::uint32         threadIndex;
+    Pal::int64          beginTicks;
+    Pal::int64          endTicks;
+    Pal::uint64         operations;
+    Pal::Result         result;
+};
+
+inline void BeginTiming(ThreadContext* pContext) { pContext->beginTicks = Util::GetPerfCpuTime(); }
+inline void EndTiming(ThreadContext* pContext)   { pContext->endTicks   = Util::GetPerfCpuTime(); }
+
+typedef Pal::Result (*ScenarioFunc)(ThreadContext* pContext);
+
+// Describes one benchmark scenario.
+struct ScenarioInfo
+{
+    const char*  pName;
+    const char*  pDescription;
+    Pal::uint32  requirements;  // Mask of ScenarioRequirement flags.
+    ScenarioFunc pfnRun;
+};
+
+constexpr Pal::uint32 ScenarioCount = 17;
+
+extern const ScenarioInfo Scenarios[ScenarioCount];
+
+// Scenarios which live outside of benchScenarios.cpp.
+extern Pal::Result RunFenceTracker(ThreadContext* pContext);
+
+} // PalBench
@@ -0,0 +1,378 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palBestFitAllocatorImpl.h"
+#include "palBuddyAllocatorImpl.h"
+#include "palLinearAllocator.h"
+#include "palMemTrackerImpl.h"
+#include "palSlabAllocator.h"
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+// Geometry of the suballocated heap, modeled on the GPU memory pools which use these allocators.
+constexpr Pal::gpusize SubAllocBaseSize = 256 * 1024 * 1024;
+constexpr Pal::gpusize SubAllocMinSize  = 4 * 1024;
+constexpr uint32       SubAllocMaxLog2  = 8;      // Largest request is SubAllocMinSize << SubAllocMaxLog2 (1MB).
+constexpr uint32       MaxLiveSlots     = 1024;   // Bounds the live set so the heap never runs dry.
+
+// Largest request of the system and linear allocator benchmarks.
+constexpr uint32 MaxSmallAllocSize = 512;
+
+// The benchmark loops fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_sink = 0;
+
+// One step of a precomputed allocation script: free the slot if it's occupied, otherwise allocate size into it.
+struct ChurnOp
+{
+    uint32       slot;
+    Pal::gpusize size;
+};
+
+// =====================================================================================================================
+// Builds a reproducible churn script.  Sizes are skewed toward the small end, the way real suballocation requests are.
+static ChurnOp* CreateChurnScript(
+    BenchContext* pContext,
+    uint32        opCount,
+    uint32        slotCount,
+    bool          powerOfTwoSizes)
+{
+    ChurnOp* pOps = static_cast<ChurnOp*>(PAL_MALLOC(sizeof(ChurnOp) * opCount, pContext->Allocator(), AllocInternal));
+
+    if (pOps != nullptr)
+    {
+        for (uint32 i = 0; i < opCount; ++i)
+        {
+            const uint64 random = pContext->NextRandom();
+            const uint32 log2   = static_cast<uint32>(((random >> 32) % (SubAllocMaxLog2 + 1)) *
+                                                      ((random >> 40) % (SubAllocMaxLog2 + 1))) / SubAllocMaxLog2;
+
+            pOps[i].slot = static_cast<uint32>(random % slotCount);
+            pOps[i].size = SubAllocMinSize << log2;
+
+            if (powerOfTwoSizes == false)
+            {
+                // Any multiple of the minimum size up to the next power of two.
+                pOps[i].size += SubAllocMinSize * ((random >> 48) % (1u << log2));
+            }
+        }
+    }
+
+    return pOps;
+}
+
+// =====================================================================================================================
+// Measures a GPU memory suballocator: allocation followed by LIFO release, then random churn against a live set.
+template <typename SubAllocator>
+static void RunSubAllocatorBench(
+    BenchContext* pContext,
+    bool          powerOfTwoSizes)
+{
+    const uint32 opCount   = pContext->Config().elementCount;
+    const uint32 slotCount = Min(opCount, MaxLiveSlots);
+
+    ChurnOp*      pOps     = CreateChurnScript(pContext, opCount, slotCount, powerOfTwoSizes);
+    Pal::gpusize* pOffsets = static_cast<Pal::gpusize*>(PAL_MALLOC(sizeof(Pal::gpusize) * slotCount,
+                                                                   pContext->Allocator(),
+                                                                   AllocInternal));
+    Pal::gpusize* pSizes   = static_cast<Pal::gpusize*>(PAL_CALLOC(sizeof(Pal::gpusize) * slotCount,
+                                                                   pContext->Allocator(),
+                                                                   AllocInternal));
+
+    if ((pOps != nullptr) && (pOffsets != nullptr) && (pSizes != nullptr))
+    {
+        SubAllocator* pSubAllocator = nullptr;
+
+        auto Create = [&]()
+        {
+            pSubAllocator = PAL_NEW(SubAllocator, pContext->Allocator(), AllocInternal)(pContext->Allocator(),
+                                                                                        SubAllocBaseSize,
+                                                                                        SubAllocMinSize);
+            PAL_ASSERT(pSubAllocator != nullptr);
+            const Result result = pSubAllocator->Init();
+            PAL_ASSERT(result == Result::Success);
+        };
+        auto Destroy = [&]()
+        {
+            for (uint32 slot = 0; slot < slotCount; ++slot)
+            {
+                if (pSizes[slot] != 0)
+                {
+                    pSubAllocator->Free(pOffsets[slot], pSizes[slot], SubAllocMinSize);
+                    pSizes[slot] = 0;
+                }
+            }
+            PAL_SAFE_DELETE(pSubAllocator, pContext->Allocator());
+        };
+
+        pContext->Measure("allocateFreeLifo", MeasureUnit::Ops, slotCount * 2, Create,
+                          [&]()
+                          {
+                              for (uint32 slot = 0; slot < slotCount; ++slot)
+                              {
+                                  const Pal::gpusize size = pOps[slot].size;
+                                  if (pSubAllocator->Allocate(size, SubAllocMinSize, &pOffsets[slot]) ==
+                                      Result::Success)
+                                  {
+                                      pSizes[slot] = size;
+                                  }
+                              }
+                              for (uint32 slot = slotCount; slot > 0; --slot)
+                              {
+                                  if (pSizes[slot - 1] != 0)
+                                  {
+                                      pSubAllocator->Free(pOffsets[slot - 1], pSizes[slot - 1], SubAllocMinSize);
+                                      pSizes[slot - 1] = 0;
+                                  }
+                              }
+                          },
+                          Destroy);
+
+        pContext->Measure("churn", MeasureUnit::Ops, opCount, Create,
+                          [&]()
+                          {
+                              for (uint32 i = 0; i < opCount; ++i)
+                              {
+                                  const uint32 slot = pOps[i].slot;
+
+                                  if (pSizes[slot] != 0)
+                                  {
+                                      pSubAllocator->Free(pOffsets[slot], pSizes[slot], SubAllocMinSize);
+                                      pSizes[slot] = 0;
+                                  }
+                                  else if (pSubAllocator->Allocate(pOps[i].size, SubAllocMinSize, &pOffsets[slot]) ==
+                                           Result::Success)
+                                  {
+                                      pSizes[slot] = pOps[i].size;
+                                  }
+                              }
+                          },
+                          Destroy);
+    }
+
+    PAL_SAFE_FREE(pOps, pContext->Allocator());
+    PAL_SAFE_FREE(pOffsets, pContext->Allocator());
+    PAL_SAFE_FREE(pSizes, pContext->Allocator());
+}
+
+// =====================================================================================================================
+void RunBuddyAllocatorBench(
+    BenchContext* pContext)
+{
+    // The buddy allocator rounds every request up to a power of two, so feed it only those.
+    RunSubAllocatorBench<BuddyAllocator<GenericAllocator>>(pContext, true);
+}
+
+// =====================================================================================================================
+void RunBestFitAllocatorBench(
+    BenchContext* pContext)
+{
+    RunSubAllocatorBench<BestFitAllocator<GenericAllocator>>(pContext, false);
+}
+
+// =====================================================================================================================
+// Fills an array with small allocation sizes, as seen by the CPU-side object allocators.
+static uint32* CreateSmallSizes(
+    BenchContext* pContext,
+    uint32        count)
+{
+    uint32* pSizes = static_cast<uint32*>(PAL_MALLOC(sizeof(uint32) * count, pContext->Allocator(), AllocInternal));
+
+    if (pSizes != nullptr)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            pSizes[i] = 8 + static_cast<uint32>(pContext->NextRandom() % (MaxSmallAllocSize - 8));
+        }
+    }
+
+    return pSizes;
+}
+
+// =====================================================================================================================
+void RunLinearAllocatorBench(
+    BenchContext* pContext)
+{
+    const uint32 count  = pContext->Config().elementCount;
+    uint32*      pSizes = CreateSmallSizes(pContext, count);
+
+    if (pSizes != nullptr)
+    {
+        // Sized to hold every allocation, including its alignment padding.
+        const size_t           maxBytes = static_cast<size_t>(count) * (MaxSmallAllocSize + PAL_DEFAULT_MEM_ALIGN);
+        VirtualLinearAllocator linearAllocator(maxBytes);
+
+        if (linearAllocator.Init() == Result::Success)
+        {
+            void*const pStart = linearAllocator.Current();
+
+            // The first repetition commits the pages and later ones reuse them, like a command allocator's linear
+            // allocator does after its first reset.
+            auto Alloc = [&]()
+            {
+                uint64 sum = 0;
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    void* pMemory = PAL_MALLOC(pSizes[i], &linearAllocator, AllocInternal);
+                    sum += reinterpret_cast<uintptr_t>(pMemory);
+                }
+                s_sink = s_sink + sum;
+            };
+
+            pContext->Measure("alloc", MeasureUnit::Ops, count, NoOp, Alloc,
+                              [&]() { linearAllocator.Rewind(pStart, false); });
+
+            pContext->Measure("allocRewindDecommit", MeasureUnit::Ops, count, NoOp,
+                              [&]()
+                              {
+                                  Alloc();
+                                  linearAllocator.Rewind(pStart, true);
+                              },
+                              NoOp);
+        }
+
+        PAL_SAFE_FREE(pSizes, pContext->Allocator());
+    }
+}
+
+// =====================================================================================================================
+// Times small allocations of the skewed sizes through allocFunc, then frees them in random order through freeFunc.
+template <typename AllocFunc, typename FreeFunc>
+static void RunSmallAllocBench(
+    BenchContext* pContext,
+    AllocFunc     allocFunc,
+    FreeFunc      freeFunc)
+{
+    GenericAllocator*const pAllocator = pContext->Allocator();
+
+    const uint32 count    = pContext->Config().elementCount;
+    uint32*      pSizes   = CreateSmallSizes(pContext, count);
+    void**       ppMemory = static_cast<void**>(PAL_CALLOC(sizeof(void*) * count, pAllocator, AllocInternal));
+    uint32*      pOrder   = static_cast<uint32*>(PAL_MALLOC(sizeof(uint32) * count, pAllocator, AllocInternal));
+
+    if ((pSizes != nullptr) && (ppMemory != nullptr) && (pOrder != nullptr))
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            pOrder[i] = i;
+        }
+        for (uint32 i = count - 1; i > 0; --i)
+        {
+            Swap(pOrder[i], pOrder[static_cast<uint32>(pContext->NextRandom() % (i + 1))]);
+        }
+
+        auto Alloc = [&]()
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                ppMemory[i] = allocFunc(pSizes[i]);
+            }
+        };
+        auto Free = [&]()
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                freeFunc(ppMemory[pOrder[i]]);
+                ppMemory[pOrder[i]] = nullptr;
+            }
+        };
+
+        pContext->Measure("alloc", MeasureUnit::Ops, count, NoOp, Alloc, Free);
+        pContext->Measure("freeRandom", MeasureUnit::Ops, count, Alloc, Free, NoOp);
+    }
+
+    PAL_SAFE_FREE(pSizes, pAllocator);
+    PAL_SAFE_FREE(ppMemory, pAllocator);
+    PAL_SAFE_FREE(pOrder, pAllocator);
+}
+
+// =====================================================================================================================
+// Baseline for the other allocators: the same small allocations through the system heap, freed in random order.
+void RunSystemAllocatorBench(
+    BenchContext* pContext)
+{
+    GenericAllocator*const pAllocator = pContext->Allocator();
+
+    RunSmallAllocBench(pContext,
+                       [=](uint32 size) { return PAL_MALLOC(size, pAllocator, AllocInternal); },
+                       [=](void* pMem) { PAL_FREE(pMem, pAllocator); });
+}
+
+#if PAL_MEMTRACK
+// =====================================================================================================================
+// The same small allocations through a MemTracker wrapping the system heap, to measure the tracking overhead.  Compare
+// with SystemAllocator; PAL_MEMTRACK_SENTINEL_SAMPLE_RATE controls how many allocations pay for the guard markers.
+void RunMemTrackerBench(
+    BenchContext* pContext)
+{
+    GenericAllocator             allocator;
+    MemTracker<GenericAllocator> tracker(&allocator);
+
+    if (tracker.Init() == Result::Success)
+    {
+        MemTracker<GenericAllocator>*const pTracker = &tracker;
+
+        RunSmallAllocBench(pContext,
+                           [=](uint32 size) { return PAL_MALLOC(size, pTracker, AllocInternal); },
+                           [=](void* pMem) { PAL_FREE(pMem, pTracker); });
+    }
+}
+#endif
+
+// =====================================================================================================================
+// The same small allocations through the slab allocator which PAL_BUILD_SLAB_ALLOCATOR installs as the default
+// allocation callbacks.  Also records the allocation rate the allocator itself reports over the whole group.
+void RunSlabAllocatorBench(
+    BenchContext* pContext)
+{
+    SlabAllocator::Stats stats = {};
+    SlabAllocator::QueryStats(AllocInternal, &stats);
+
+    const int64 begin = GetPerfCpuTime();
+
+    RunSmallAllocBench(pContext,
+                       [](uint32 size) { return SlabAllocator::Alloc(size, PAL_DEFAULT_MEM_ALIGN, AllocInternal); },
+                       [](void* pMem) { SlabAllocator::Free(pMem); });
+
+    const int64 elapsedNs = static_cast<int64>(BenchContext::TicksToNs(GetPerfCpuTime() - begin));
+
+    // Publish this thread's batched counters before reading them back.
+    SlabAllocator::FlushThreadCache();
+    SlabAllocator::QueryStats(AllocInternal, &stats);
+
+    // Reported as a pseudo-measurement so it ends up in the JSON next to the timings.
+    pContext->Record("reportedAllocRate",
+                     MeasureUnit::Ops,
+                     static_cast<uint64>(stats.allocsPerSecond * elapsedNs / 1000000000.0),
+                     elapsedNs,
+                     elapsedNs);
+
+    SlabAllocator::Trim();
+}
+
+} // UtilBench
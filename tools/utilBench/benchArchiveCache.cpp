@@ -0,0 +1,449 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palArchiveFile.h"
+#include "palArchiveFileFmt.h"
+#include "palCacheLayer.h"
+#include "palPlatformKey.h"
+#include "palThread.h"
+#include "palVectorImpl.h"
+
+#include <atomic>
+#include <stdio.h>
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+// Beyond this many threads the results mostly measure the OS scheduler.
+constexpr uint32 MaxArchiveThreads = 64;
+
+// The query threads fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_archiveSink = 0;
+
+// =====================================================================================================================
+// An IArchiveFile which keeps its entries in memory, so the benchmarks time the cache layer rather than file I/O.
+// Every entry holds one uint64.  Like the real archive file it has no locking of its own; the cache layer serializes
+// access to it.
+class MemoryArchive : public IArchiveFile
+{
+public:
+    explicit MemoryArchive(GenericAllocator* pAllocator) : m_headers(pAllocator), m_values(pAllocator) { }
+    virtual ~MemoryArchive() { }
+
+    virtual size_t GetEntryCount() const override { return m_headers.NumElements(); }
+
+    virtual Result Preload(size_t /*startLocation*/, size_t /*maxReadSize*/) override { return Result::Unsupported; }
+
+    virtual Result FillEntryHeaderTable(
+        ArchiveEntryHeader* pHeaders,
+        size_t              startEntry,
+        size_t              maxEntries,
+        size_t*             pEntriesFilled) override
+    {
+        size_t filled = 0;
+
+        for (size_t index = startEntry; (index < m_headers.NumElements()) && (filled < maxEntries); ++index)
+        {
+            pHeaders[filled++] = m_headers.At(static_cast<uint32>(index));
+        }
+
+        *pEntriesFilled = filled;
+
+        return Result::Success;
+    }
+
+    virtual Result GetEntryByIndex(size_t index, ArchiveEntryHeader* pHeader) override
+    {
+        Result result = Result::ErrorInvalidValue;
+
+        if (index < m_headers.NumElements())
+        {
+            *pHeader = m_headers.At(static_cast<uint32>(index));
+            result   = Result::Success;
+        }
+
+        return result;
+    }
+
+    virtual Result Read(const ArchiveEntryHeader* pHeader, void* pDataBuffer) override
+    {
+        memcpy(pDataBuffer, &m_values.At(pHeader->ordinalId), sizeof(uint64));
+
+        return Result::Success;
+    }
+
+    virtual Result Write(ArchiveEntryHeader* pHeader, const void* pData) override
+    {
+        Result result = Result::ErrorInvalidValue;
+
+        if (pHeader->dataSize == sizeof(uint64))
+        {
+            uint64 value = 0;
+            memcpy(&value, pData, sizeof(value));
+
+            pHeader->ordinalId = m_headers.NumElements();
+
+            result = m_headers.PushBack(*pHeader);
+
+            if (result == Result::Success)
+            {
+                result = m_values.PushBack(value);
+            }
+        }
+
+        return result;
+    }
+
+    virtual void Destroy() override { }
+
+    void Clear()
+    {
+        m_headers.Clear();
+        m_values.Clear();
+    }
+
+private:
+    Vector<ArchiveEntryHeader, 16, GenericAllocator> m_headers;
+    Vector<uint64, 16, GenericAllocator>             m_values;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(MemoryArchive);
+};
+
+// =====================================================================================================================
+// Builds the id the cache is queried with from one of the context's keys.
+static Hash128 KeyToId(
+    uint64 key)
+{
+    Hash128 id   = {};
+    id.qwords[0] = key;
+    id.qwords[1] = ~key;
+
+    return id;
+}
+
+// State shared by all of the query threads.
+struct ArchiveQueryShared
+{
+    ICacheLayer*        pLayer;
+    const uint64*       pLookupKeys;
+    uint32              keyCount;
+    std::atomic<uint32> readyThreads;
+    std::atomic<uint32> misses;
+    std::atomic<bool>   go;
+};
+
+// Per-thread state.
+struct ArchiveQueryThread
+{
+    Thread              thread;
+    ArchiveQueryShared* pShared;
+    uint32              threadIndex;
+    uint64              checksum;
+};
+
+// =====================================================================================================================
+// Queries every key once, starting at a different offset on each thread.
+static void ArchiveQueryThreadMain(
+    void* pParam)
+{
+    ArchiveQueryThread*const pState  = static_cast<ArchiveQueryThread*>(pParam);
+    ArchiveQueryShared*const pShared = pState->pShared;
+
+    pShared->readyThreads++;
+    while (pShared->go.load(std::memory_order_acquire) == false)
+    {
+        YieldThread();
+    }
+
+    const uint32 offset   = (pShared->keyCount / MaxArchiveThreads) * pState->threadIndex;
+    uint64       checksum = 0;
+    uint32       misses   = 0;
+
+    for (uint32 i = 0; i < pShared->keyCount; ++i)
+    {
+        const Hash128 id    = KeyToId(pShared->pLookupKeys[(offset + i) % pShared->keyCount]);
+        QueryResult   query = {};
+
+        if (pShared->pLayer->Query(&id, 0, 0, &query) == Result::Success)
+        {
+            checksum += query.context.entryId;
+        }
+        else
+        {
+            misses++;
+        }
+    }
+
+    pState->checksum = checksum;
+    pShared->misses += misses;
+}
+
+// =====================================================================================================================
+// Checks that every stored key loads back its value and that none of the miss keys are found.
+static void VerifyArchiveCache(
+    BenchContext* pContext,
+    ICacheLayer*  pLayer)
+{
+    const uint32 count  = pContext->Config().elementCount;
+    bool         passed = true;
+
+    for (uint32 i = 0; passed && (i < count); ++i)
+    {
+        const Hash128 id    = KeyToId(pContext->Keys()[i]);
+        QueryResult   query = {};
+        uint64        value = 0;
+
+        passed = (pLayer->Query(&id, 0, 0, &query) == Result::Success) &&
+                 (query.dataSize == sizeof(value))                     &&
+                 (pLayer->Load(&query, &value) == Result::Success)     &&
+                 (value == pContext->Keys()[i]);
+    }
+
+    if (passed == false)
+    {
+        pContext->ReportFailure("The archive cache lost or corrupted a stored entry.");
+    }
+
+    for (uint32 i = 0; passed && (i < count); ++i)
+    {
+        const Hash128 id    = KeyToId(pContext->MissKeys()[i]);
+        QueryResult   query = {};
+
+        passed = (pLayer->Query(&id, 0, 0, &query) == Result::NotFound);
+    }
+
+    if (passed == false)
+    {
+        pContext->ReportFailure("The archive cache found an entry which was never stored.");
+    }
+}
+
+// =====================================================================================================================
+// Measures storing entries in and querying them from a FileArchiveCacheLayer keyed by a platform key, backed by an
+// in-memory archive.  Each query derives an entry key, so the contended measurement shows how well key derivation and
+// the entry table scale across threads.
+void RunArchiveCacheBench(
+    BenchContext* pContext)
+{
+    GenericAllocator*const pAllocator  = pContext->Allocator();
+    const BenchConfig&     config      = pContext->Config();
+    const uint32           count       = config.elementCount;
+    const uint32           threadCount = Min(config.threadCount, MaxArchiveThreads);
+
+    MemoryArchive archive(pAllocator);
+    IPlatformKey* pPlatformKey = nullptr;
+    ICacheLayer*  pLayer       = nullptr;
+    void*         pLayerMem    = nullptr;
+
+    void*  pKeyMem = PAL_MALLOC(GetPlatformKeySize(HashAlgorithm::Sha1), pAllocator, AllocInternal);
+    Result result  = (pKeyMem != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+
+    if (result == Result::Success)
+    {
+        char keyData[] = "utilBench";
+
+        result = CreatePlatformKey(HashAlgorithm::Sha1, keyData, sizeof(keyData), pKeyMem, &pPlatformKey);
+    }
+
+    ArchiveFileCacheCreateInfo createInfo = {};
+    createInfo.pFile        = &archive;
+    createInfo.pPlatformKey = pPlatformKey;
+
+    if (result == Result::Success)
+    {
+        pLayerMem = PAL_MALLOC(GetArchiveFileCacheLayerSize(&createInfo), pAllocator, AllocInternal);
+        result    = (pLayerMem != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    ArchiveQueryThread* pThreads = nullptr;
+
+    if (result == Result::Success)
+    {
+        pThreads = PAL_NEW_ARRAY(ArchiveQueryThread, threadCount, pAllocator, AllocInternal);
+    }
+
+    if (pThreads != nullptr)
+    {
+        auto Create = [&]()
+        {
+            if (CreateArchiveFileCacheLayer(&createInfo, pLayerMem, &pLayer) != Result::Success)
+            {
+                pLayer = nullptr;
+            }
+        };
+        auto Destroy = [&]()
+        {
+            if (pLayer != nullptr)
+            {
+                pLayer->Destroy();
+                pLayer = nullptr;
+            }
+        };
+        auto StoreAll = [&]()
+        {
+            for (uint32 i = 0; (pLayer != nullptr) && (i < count); ++i)
+            {
+                const Hash128 id = KeyToId(pContext->Keys()[i]);
+
+                pLayer->Store(&id, &pContext->Keys()[i], sizeof(uint64));
+            }
+        };
+
+        pContext->Measure("store",
+                          MeasureUnit::Ops,
+                          count,
+                          [&]() { archive.Clear(); Create(); },
+                          StoreAll,
+                          [&]()
+                          {
+                              if (pLayer == nullptr)
+                              {
+                                  pContext->ReportFailure("Failed to create the archive cache layer.");
+                              }
+                              else
+                              {
+                                  VerifyArchiveCache(pContext, pLayer);
+                              }
+
+                              Destroy();
+                          });
+
+        // The query measurements start from a fresh layer over the filled archive, so the first query also indexes
+        // the archive's headers like it would after loading a cache file.
+        pContext->Measure("query",
+                          MeasureUnit::Ops,
+                          count,
+                          Create,
+                          [&]()
+                          {
+                              uint64 checksum = 0;
+
+                              for (uint32 i = 0; (pLayer != nullptr) && (i < count); ++i)
+                              {
+                                  const Hash128 id    = KeyToId(pContext->LookupKeys()[i]);
+                                  QueryResult   query = {};
+
+                                  pLayer->Query(&id, 0, 0, &query);
+                                  checksum += query.context.entryId;
+                              }
+
+                              s_archiveSink = s_archiveSink + checksum;
+                          },
+                          Destroy);
+
+        ArchiveQueryShared shared;
+        shared.pLayer      = nullptr;
+        shared.pLookupKeys = pContext->LookupKeys();
+        shared.keyCount    = count;
+        shared.misses      = 0;
+
+        bool started = true;
+
+        // Threads are created untimed and held at a start gate, so the measurement covers only the queries.
+        auto Start = [&]()
+        {
+            Create();
+
+            // Index the headers up front so every thread only takes the entry table's reader locks.
+            QueryResult   query = {};
+            const Hash128 id    = KeyToId(pContext->Keys()[0]);
+
+            if (pLayer != nullptr)
+            {
+                pLayer->Query(&id, 0, 0, &query);
+            }
+
+            shared.pLayer       = pLayer;
+            shared.readyThreads = 0;
+            shared.go           = false;
+
+            for (uint32 t = 0; (pLayer != nullptr) && (t < threadCount); ++t)
+            {
+                pThreads[t].pShared     = &shared;
+                pThreads[t].threadIndex = t;
+                pThreads[t].checksum    = 0;
+
+                if (pThreads[t].thread.Begin(&ArchiveQueryThreadMain, &pThreads[t]) != Result::Success)
+                {
+                    started = false;
+                }
+            }
+
+            while (started && (pLayer != nullptr) && (shared.readyThreads.load() < threadCount))
+            {
+                YieldThread();
+            }
+        };
+        auto Run = [&]()
+        {
+            shared.go.store(true, std::memory_order_release);
+
+            for (uint32 t = 0; t < threadCount; ++t)
+            {
+                if (pThreads[t].thread.IsCreated())
+                {
+                    pThreads[t].thread.Join();
+                }
+                s_archiveSink = s_archiveSink + pThreads[t].checksum;
+            }
+        };
+
+        pContext->Measure("queryContended",
+                          MeasureUnit::Ops,
+                          static_cast<uint64>(threadCount) * count,
+                          Start,
+                          Run,
+                          Destroy);
+
+        if (started == false)
+        {
+            fprintf(stderr, "utilBench: failed to start the archive cache query threads\n");
+        }
+        else if (shared.misses.load() != 0)
+        {
+            pContext->ReportFailure("Concurrent archive cache queries missed stored entries.");
+        }
+
+        PAL_DELETE_ARRAY(pThreads, pAllocator);
+    }
+    else
+    {
+        pContext->ReportFailure("Failed to set up the archive cache benchmark.");
+    }
+
+    PAL_SAFE_FREE(pLayerMem, pAllocator);
+
+    if (pPlatformKey != nullptr)
+    {
+        pPlatformKey->Destroy();
+    }
+
+    PAL_SAFE_FREE(pKeyMem, pAllocator);
+}
+
+} // UtilBench
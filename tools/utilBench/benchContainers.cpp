@@ -0,0 +1,558 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palDequeImpl.h"
+#include "palHashMapImpl.h"
+#include "palHashSetImpl.h"
+#include "palIntervalTreeImpl.h"
+#include "palIntrusiveListImpl.h"
+#include "palSparseVectorImpl.h"
+#include "palVectorImpl.h"
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+typedef HashMap<uint64, uint64, GenericAllocator> BenchHashMap;
+typedef HashSet<uint64, GenericAllocator>         BenchHashSet;
+
+// SparseVector needs its key range at compile time; this one covers a register-space sized range.
+constexpr uint32 SparseKeyRange = 4096;
+typedef SparseVector<uint32, uint16, 64, GenericAllocator, 0, SparseKeyRange - 1> BenchSparseVector;
+
+// The benchmark loops fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_sink = 0;
+
+// =====================================================================================================================
+void RunHashMapBench(
+    BenchContext* pContext)
+{
+    const uint32  count       = pContext->Config().elementCount;
+    const uint64* pKeys       = pContext->Keys();
+    const uint64* pLookupKeys = pContext->LookupKeys();
+    const uint64* pMissKeys   = pContext->MissKeys();
+
+    BenchHashMap* pMap = nullptr;
+
+    auto Create = [&]()
+    {
+        pMap = PAL_NEW(BenchHashMap, pContext->Allocator(), AllocInternal)(count, pContext->Allocator());
+        PAL_ASSERT(pMap != nullptr);
+        const Result result = pMap->Init();
+        PAL_ASSERT(result == Result::Success);
+    };
+    auto Fill = [&]()
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            pMap->Insert(pKeys[i], i);
+        }
+    };
+    auto CreateAndFill = [&]() { Create(); Fill(); };
+    auto Destroy       = [&]() { PAL_SAFE_DELETE(pMap, pContext->Allocator()); };
+
+    pContext->Measure("insert", MeasureUnit::Ops, count, Create, Fill, Destroy);
+
+    pContext->Measure("lookupHit", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              sum += *pMap->FindKey(pLookupKeys[i]);
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      Destroy);
+
+    pContext->Measure("lookupMiss", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          uint64 found = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              found += (pMap->FindKey(pMissKeys[i]) != nullptr) ? 1 : 0;
+                          }
+                          s_sink = s_sink + found;
+                      },
+                      Destroy);
+
+    pContext->Measure("findAllocate", MeasureUnit::Ops, count, Create,
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              bool    existed = false;
+                              uint64* pValue  = nullptr;
+                              if (pMap->FindAllocate(pLookupKeys[i], &existed, &pValue) == Result::Success)
+                              {
+                                  (*pValue) = existed ? ((*pValue) + 1) : 1;
+                              }
+                          }
+                      },
+                      Destroy);
+
+    pContext->Measure("iterate", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (auto iter = pMap->Begin(); iter.Get() != nullptr; iter.Next())
+                          {
+                              sum += iter.Get()->value;
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      Destroy);
+
+    pContext->Measure("erase", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              pMap->Erase(pKeys[i]);
+                          }
+                      },
+                      Destroy);
+}
+
+// =====================================================================================================================
+void RunHashSetBench(
+    BenchContext* pContext)
+{
+    const uint32  count       = pContext->Config().elementCount;
+    const uint64* pKeys       = pContext->Keys();
+    const uint64* pLookupKeys = pContext->LookupKeys();
+    const uint64* pMissKeys   = pContext->MissKeys();
+
+    BenchHashSet* pSet = nullptr;
+
+    auto Create = [&]()
+    {
+        pSet = PAL_NEW(BenchHashSet, pContext->Allocator(), AllocInternal)(count, pContext->Allocator());
+        PAL_ASSERT(pSet != nullptr);
+        const Result result = pSet->Init();
+        PAL_ASSERT(result == Result::Success);
+    };
+    auto Fill = [&]()
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            pSet->Insert(pKeys[i]);
+        }
+    };
+    auto CreateAndFill = [&]() { Create(); Fill(); };
+    auto Destroy       = [&]() { PAL_SAFE_DELETE(pSet, pContext->Allocator()); };
+
+    pContext->Measure("insert", MeasureUnit::Ops, count, Create, Fill, Destroy);
+
+    pContext->Measure("containsHit", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          uint64 found = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              found += pSet->Contains(pLookupKeys[i]) ? 1 : 0;
+                          }
+                          s_sink = s_sink + found;
+                      },
+                      Destroy);
+
+    pContext->Measure("containsMiss", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          uint64 found = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              found += pSet->Contains(pMissKeys[i]) ? 1 : 0;
+                          }
+                          s_sink = s_sink + found;
+                      },
+                      Destroy);
+
+    pContext->Measure("erase", MeasureUnit::Ops, count, CreateAndFill,
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              pSet->Erase(pKeys[i]);
+                          }
+                      },
+                      Destroy);
+}
+
+// =====================================================================================================================
+void RunVectorBench(
+    BenchContext* pContext)
+{
+    typedef Vector<uint64, 16, GenericAllocator> BenchVector;
+
+    const uint32  count = pContext->Config().elementCount;
+    const uint64* pKeys = pContext->Keys();
+
+    BenchVector vector(pContext->Allocator());
+
+    auto Fill = [&]()
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            vector.PushBack(pKeys[i]);
+        }
+    };
+    auto Clear = [&]() { vector.Clear(); };
+
+    // pushBackGrow starts from the default capacity every repetition, so it includes the reallocations;
+    // pushBackReserved appends into storage reserved up front.
+    pContext->Measure("pushBackGrow", MeasureUnit::Ops, count, NoOp,
+                      [&]()
+                      {
+                          BenchVector grow(pContext->Allocator());
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              grow.PushBack(pKeys[i]);
+                          }
+                          s_sink = s_sink + grow.NumElements();
+                      },
+                      NoOp);
+
+    pContext->Measure("pushBackReserved", MeasureUnit::Ops, count,
+                      [&]() { vector.Reserve(count); },
+                      Fill,
+                      Clear);
+
+    pContext->Measure("randomAccess", MeasureUnit::Ops, count, Fill,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              sum += vector.At(static_cast<uint32>(pKeys[i] % count));
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      Clear);
+
+    pContext->Measure("iterate", MeasureUnit::Ops, count, Fill,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (auto iter = vector.Begin(); iter.IsValid(); iter.Next())
+                          {
+                              sum += iter.Get();
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      Clear);
+
+    pContext->Measure("popBack", MeasureUnit::Ops, count, Fill,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              uint64 value = 0;
+                              vector.PopBack(&value);
+                              sum += value;
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      Clear);
+}
+
+// =====================================================================================================================
+void RunDequeBench(
+    BenchContext* pContext)
+{
+    typedef Deque<uint64, GenericAllocator> BenchDeque;
+
+    const uint32  count = pContext->Config().elementCount;
+    const uint64* pKeys = pContext->Keys();
+
+    BenchDeque deque(pContext->Allocator());
+
+    auto Fill = [&]()
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            deque.PushBack(pKeys[i]);
+        }
+    };
+    auto Drain = [&]()
+    {
+        uint64 sum = 0;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            uint64 value = 0;
+            deque.PopFront(&value);
+            sum += value;
+        }
+        s_sink = s_sink + sum;
+    };
+
+    pContext->Measure("pushBack", MeasureUnit::Ops, count, NoOp, Fill, Drain);
+    pContext->Measure("popFront", MeasureUnit::Ops, count, Fill, Drain, NoOp);
+
+    // Queue usage as seen in the present and submit paths: the deque never holds more than a handful of entries, so
+    // this exercises block recycling rather than growth.
+    pContext->Measure("fifoSteadyState", MeasureUnit::Ops, count, NoOp,
+                      [&]()
+                      {
+                          uint64 sum = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              uint64 value = 0;
+                              deque.PushBack(pKeys[i]);
+                              deque.PopFront(&value);
+                              sum += value;
+                          }
+                          s_sink = s_sink + sum;
+                      },
+                      NoOp);
+}
+
+// =====================================================================================================================
+void RunSparseVectorBench(
+    BenchContext* pContext)
+{
+    // Insertion is linear in the number of elements, so this one is capped to the compile-time key range.
+    const uint32 count = Min(pContext->Config().elementCount, SparseKeyRange);
+
+    uint32* pSparseKeys = static_cast<uint32*>(PAL_MALLOC(sizeof(uint32) * count,
+                                                          pContext->Allocator(),
+                                                          AllocInternal));
+
+    if (pSparseKeys != nullptr)
+    {
+        // A random subset of the key range, in random order.  The low bits of the shared keys keep this in step with
+        // the configured distribution.
+        for (uint32 i = 0; i < count; ++i)
+        {
+            pSparseKeys[i] = i;
+        }
+        if (pContext->Config().distribution != KeyDistribution::Sequential)
+        {
+            for (uint32 i = count - 1; i > 0; --i)
+            {
+                const uint32 j = static_cast<uint32>(pContext->NextRandom() % (i + 1));
+                Swap(pSparseKeys[i], pSparseKeys[j]);
+            }
+        }
+
+        BenchSparseVector sparse(pContext->Allocator());
+
+        auto Fill = [&]()
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                sparse.Insert(pSparseKeys[i], i);
+            }
+        };
+        auto Clear = [&]() { sparse.Clear(); };
+
+        pContext->Measure("insert", MeasureUnit::Ops, count, NoOp, Fill, Clear);
+
+        pContext->Measure("at", MeasureUnit::Ops, count, Fill,
+                          [&]()
+                          {
+                              uint64 sum = 0;
+                              for (uint32 i = 0; i < count; ++i)
+                              {
+                                  sum += sparse.At(pSparseKeys[i]);
+                              }
+                              s_sink = s_sink + sum;
+                          },
+                          Clear);
+
+        pContext->Measure("hasEntry", MeasureUnit::Ops, count, Fill,
+                          [&]()
+                          {
+                              uint64 found = 0;
+                              for (uint32 i = 0; i < count; ++i)
+                              {
+                                  found += sparse.HasEntry(pSparseKeys[i]) ? 1 : 0;
+                              }
+                              s_sink = s_sink + found;
+                          },
+                          Clear);
+
+        pContext->Measure("erase", MeasureUnit::Ops, count, Fill,
+                          [&]()
+                          {
+                              for (uint32 i = 0; i < count; ++i)
+                              {
+                                  sparse.Erase(pSparseKeys[i]);
+                              }
+                          },
+                          Clear);
+
+        PAL_SAFE_FREE(pSparseKeys, pContext->Allocator());
+    }
+}
+
+// =====================================================================================================================
+void RunIntervalTreeBench(
+    BenchContext* pContext)
+{
+    typedef Interval<uint64, uint32>                       BenchInterval;
+    typedef IntervalTree<uint64, uint32, GenericAllocator> BenchIntervalTree;
+
+    const uint32  count       = pContext->Config().elementCount;
+    const uint64* pKeys       = pContext->Keys();
+    const uint64* pLookupKeys = pContext->LookupKeys();
+
+    // Intervals are 16 bytes wide starting at each key.  Uniform and clustered keys are never closer than 16 apart, so
+    // the intervals don't overlap; sequential keys are stretched to match.
+    const uint64 stride = (pContext->Config().distribution == KeyDistribution::Sequential) ? 16 : 1;
+
+    auto MakeInterval = [stride](uint64 key, uint32 value) -> BenchInterval
+    {
+        BenchInterval interval = {};
+        interval.low   = key * stride;
+        interval.high  = (key * stride) + 15;
+        interval.value = value;
+        return interval;
+    };
+
+    BenchIntervalTree tree(pContext->Allocator());
+
+    auto Fill = [&]()
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            const BenchInterval interval = MakeInterval(pKeys[i], i);
+            tree.Insert(&interval);
+        }
+    };
+    auto Clear = [&]() { tree.Clear(); };
+
+    pContext->Measure("insert", MeasureUnit::Ops, count, NoOp, Fill, Clear);
+
+    pContext->Measure("findOverlapping", MeasureUnit::Ops, count, Fill,
+                      [&]()
+                      {
+                          uint64 found = 0;
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              // Probe a single point inside each interval.
+                              BenchInterval probe = MakeInterval(pLookupKeys[i], 0);
+                              probe.low  += 8;
+                              probe.high  = probe.low;
+                              found += (tree.FindOverlappingNode(&probe) != nullptr) ? 1 : 0;
+                          }
+                          s_sink = s_sink + found;
+                      },
+                      Clear);
+
+    pContext->Measure("delete", MeasureUnit::Ops, count, Fill,
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              const BenchInterval interval = MakeInterval(pKeys[i], i);
+                              tree.Delete(&interval);
+                          }
+                      },
+                      Clear);
+}
+
+// =====================================================================================================================
+void RunIntrusiveListBench(
+    BenchContext* pContext)
+{
+    struct ListEntry
+    {
+        uint64                       key;
+        IntrusiveListNode<ListEntry> node;
+    };
+    typedef IntrusiveList<ListEntry> BenchList;
+
+    const uint32  count = pContext->Config().elementCount;
+    const uint64* pKeys = pContext->Keys();
+
+    ListEntry* pEntries = static_cast<ListEntry*>(PAL_MALLOC(sizeof(ListEntry) * count,
+                                                             pContext->Allocator(),
+                                                             AllocInternal));
+    uint32*    pOrder   = static_cast<uint32*>(PAL_MALLOC(sizeof(uint32) * count,
+                                                          pContext->Allocator(),
+                                                          AllocInternal));
+
+    if ((pEntries != nullptr) && (pOrder != nullptr))
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            PAL_PLACEMENT_NEW(&pEntries[i].node) IntrusiveListNode<ListEntry>(&pEntries[i]);
+            pEntries[i].key = pKeys[i];
+
+            // Erase in a random order, like objects being destroyed out of creation order.
+            pOrder[i] = i;
+        }
+        for (uint32 i = count - 1; i > 0; --i)
+        {
+            const uint32 j = static_cast<uint32>(pContext->NextRandom() % (i + 1));
+            Swap(pOrder[i], pOrder[j]);
+        }
+
+        BenchList list;
+
+        auto Fill = [&]()
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                list.PushBack(&pEntries[i].node);
+            }
+        };
+        auto Clear = [&]() { list.EraseAll(); };
+
+        pContext->Measure("pushBack", MeasureUnit::Ops, count, NoOp, Fill, Clear);
+
+        pContext->Measure("iterate", MeasureUnit::Ops, count, Fill,
+                          [&]()
+                          {
+                              uint64 sum = 0;
+                              for (auto iter = list.Begin(); iter.IsValid(); iter.Next())
+                              {
+                                  sum += iter.Get()->key;
+                              }
+                              s_sink = s_sink + sum;
+                          },
+                          Clear);
+
+        pContext->Measure("eraseRandom", MeasureUnit::Ops, count, Fill,
+                          [&]()
+                          {
+                              for (uint32 i = 0; i < count; ++i)
+                              {
+                                  list.Erase(&pEntries[pOrder[i]].node);
+                              }
+                          },
+                          Clear);
+    }
+
+    PAL_SAFE_FREE(pEntries, pContext->Allocator());
+    PAL_SAFE_FREE(pOrder, pContext->Allocator());
+}
+
+} // UtilBench
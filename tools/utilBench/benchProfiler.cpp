@@ -0,0 +1,111 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palCpuProfiler.h"
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+// The benchmark loops fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_sink = 0;
+
+// =====================================================================================================================
+// Times one zone per iteration around a trivial body, so the measurements show what a zone adds to the code it marks.
+static void MeasureZones(
+    BenchContext* pContext,
+    const char*   pName,
+    uint32        count,
+    bool          prime)
+{
+    pContext->Measure(pName,
+                      MeasureUnit::Ops,
+                      count,
+                      [&]()
+                      {
+                          // Drop the zones of the previous repetition, then record one so the timed loop doesn't
+                          // pay for registering this thread's event buffer.
+                          CpuProfiler::Reset();
+
+                          if (prime)
+                          {
+                              CpuProfiler::Zone zone("Prime");
+                          }
+                      },
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              CpuProfiler::Zone zone("Bench");
+                              s_sink = s_sink + i;
+                          }
+                      },
+                      NoOp);
+}
+
+// =====================================================================================================================
+// Measures the cost of a PAL_CPU_ZONE marker while the profiler is disabled, recording, and dropping zones because the
+// thread's buffer is full.
+void RunCpuProfilerBench(
+    BenchContext* pContext)
+{
+    const uint32 count = pContext->Config().elementCount;
+
+    pContext->Measure("noZone",
+                      MeasureUnit::Ops,
+                      count,
+                      NoOp,
+                      [&]()
+                      {
+                          for (uint32 i = 0; i < count; ++i)
+                          {
+                              s_sink = s_sink + i;
+                          }
+                      },
+                      NoOp);
+
+    MeasureZones(pContext, "zoneDisabled", count, false);
+
+    if (CpuProfiler::Enable(count + 1) == Result::Success)
+    {
+        MeasureZones(pContext, "zoneRecorded", count, true);
+
+        CpuProfiler::Disable();
+        CpuProfiler::Shutdown();
+    }
+
+    // A single-entry buffer is filled by the priming zone, so every timed zone takes the dropped path.
+    if (CpuProfiler::Enable(1) == Result::Success)
+    {
+        MeasureZones(pContext, "zoneDropped", count, true);
+
+        CpuProfiler::Disable();
+        CpuProfiler::Shutdown();
+    }
+}
+
+} // UtilBench
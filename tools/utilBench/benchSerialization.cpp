@@ -0,0 +1,389 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palElfBuilderImpl.h"
+#include "palJsonWriter.h"
+#include "palMetroHash.h"
+#include "palMsgPackImpl.h"
+
+#include <string.h>
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+// Names attached to each serialized record, in the style of pipeline metadata keys.
+static const char* RecordNames[] =
+{
+    ".vgpr_count",
+    ".sgpr_count",
+    ".lds_size",
+    ".scratch_memory_size",
+    ".wavefront_size",
+    ".user_data_reg_map",
+};
+
+// The benchmark loops fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_sink = 0;
+
+// =====================================================================================================================
+void RunMetroHashBench(
+    BenchContext* pContext)
+{
+    // Sizes of a cache key, a shader and a pipeline binary respectively.
+    static const uint32 BufferSizes[] = { 64, 1024, 64 * 1024 };
+    static const char*  Names64[]     = { "hash64_64B",  "hash64_1KB",  "hash64_64KB"  };
+    static const char*  Names128[]    = { "hash128_64B", "hash128_1KB", "hash128_64KB" };
+
+    const uint32 maxSize = BufferSizes[ArrayLen(BufferSizes) - 1];
+    uint8*       pBuffer = static_cast<uint8*>(PAL_MALLOC(maxSize, pContext->Allocator(), AllocInternal));
+
+    if (pBuffer != nullptr)
+    {
+        for (uint32 i = 0; i < maxSize; ++i)
+        {
+            pBuffer[i] = static_cast<uint8>(pContext->NextRandom());
+        }
+
+        for (uint32 s = 0; s < ArrayLen(BufferSizes); ++s)
+        {
+            const uint32 size = BufferSizes[s];
+
+            // Hash enough copies that every size does roughly the same amount of work.
+            const uint32 iterations = Max((pContext->Config().elementCount * 64u) / size, 1u);
+
+            pContext->Measure(Names64[s], MeasureUnit::Bytes, static_cast<uint64>(size) * iterations, NoOp,
+                              [&]()
+                              {
+                                  uint64 hash = 0;
+                                  for (uint32 i = 0; i < iterations; ++i)
+                                  {
+                                      MetroHash64::Hash(pBuffer, size, reinterpret_cast<uint8*>(&hash), hash);
+                                  }
+                                  s_sink = s_sink + hash;
+                              },
+                              NoOp);
+
+            pContext->Measure(Names128[s], MeasureUnit::Bytes, static_cast<uint64>(size) * iterations, NoOp,
+                              [&]()
+                              {
+                                  MetroHash::Hash hash = {};
+                                  for (uint32 i = 0; i < iterations; ++i)
+                                  {
+                                      MetroHash128::Hash(pBuffer, size, &hash.bytes[0], hash.qwords[0]);
+                                  }
+                                  s_sink = s_sink + MetroHash::Compact64(&hash);
+                              },
+                              NoOp);
+        }
+
+        PAL_SAFE_FREE(pBuffer, pContext->Allocator());
+    }
+}
+
+// =====================================================================================================================
+void RunMsgPackBench(
+    BenchContext* pContext)
+{
+    const uint32  count = pContext->Config().elementCount;
+    const uint64* pKeys = pContext->Keys();
+
+    MsgPackWriter writer(pContext->Allocator());
+
+    // Each record is a [key, index, name] array.
+    auto Write = [&]()
+    {
+        writer.DeclareArray(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            const char*const pName = RecordNames[i % ArrayLen(RecordNames)];
+
+            writer.DeclareArray(3);
+            writer.Pack(pKeys[i]);
+            writer.Pack(i);
+            writer.PackString(pName, static_cast<uint32>(strlen(pName)));
+        }
+    };
+
+    // Encode once untimed to learn the document size, and to grow the writer's buffer.
+    Write();
+    PAL_ASSERT(writer.GetStatus() == Result::Success);
+
+    const uint32 size = writer.GetSize();
+
+    pContext->Measure("write", MeasureUnit::Bytes, size, [&]() { writer.Reset(); }, Write, NoOp);
+
+    pContext->Measure("read", MeasureUnit::Bytes, size, NoOp,
+                      [&]()
+                      {
+                          MsgPackReader reader;
+                          uint64        sum    = 0;
+                          Result        result = reader.InitFromBuffer(writer.GetBuffer(), size);
+
+                          for (uint32 i = 0; (result == Result::Success) && (i < count); ++i)
+                          {
+                              uint64 key      = 0;
+                              uint32 index    = 0;
+                              char   name[32] = {};
+
+                              result = reader.Next(CWP_ITEM_ARRAY);
+                              if (result == Result::Success)
+                              {
+                                  result = reader.UnpackNextPair(&key, &index);
+                              }
+                              if (result == Result::Success)
+                              {
+                                  result = reader.Next();
+                              }
+                              if (result == Result::Success)
+                              {
+                                  result = reader.Unpack(&name[0], sizeof(name));
+                              }
+
+                              sum += key + index + static_cast<uint8>(name[1]);
+                          }
+
+                          PAL_ASSERT(result == Result::Success);
+                          s_sink = s_sink + sum;
+                      },
+                      NoOp);
+}
+
+// =====================================================================================================================
+// JsonStream which discards its output, counting the bytes written so throughput can be reported.
+class CountingJsonStream : public JsonStream
+{
+public:
+    CountingJsonStream() : m_bytesWritten(0) { }
+    virtual ~CountingJsonStream() { }
+
+    virtual void WriteString(const char*, uint32 length) override { m_bytesWritten += length; }
+    virtual void WriteCharacter(char) override { m_bytesWritten++; }
+
+    uint64 BytesWritten() const { return m_bytesWritten; }
+    void   Reset() { m_bytesWritten = 0; }
+
+private:
+    uint64 m_bytesWritten;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(CountingJsonStream);
+};
+
+// =====================================================================================================================
+void RunJsonWriterBench(
+    BenchContext* pContext)
+{
+    const uint32  count = pContext->Config().elementCount;
+    const uint64* pKeys = pContext->Keys();
+
+    CountingJsonStream stream;
+
+    // The same records as the MsgPack benchmark, as the developer-mode JSON dumps would write them.
+    auto Write = [&]()
+    {
+        JsonWriter writer(&stream);
+
+        writer.BeginList(false);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            writer.BeginMap(true);
+            writer.KeyAndValue("key", pKeys[i]);
+            writer.KeyAndValue("index", i);
+            writer.KeyAndValue("name", RecordNames[i % ArrayLen(RecordNames)]);
+            writer.EndMap();
+        }
+        writer.EndList();
+    };
+
+    Write();
+    const uint64 size = stream.BytesWritten();
+
+    pContext->Measure("write", MeasureUnit::Bytes, size, [&]() { stream.Reset(); }, Write, NoOp);
+    s_sink = s_sink + stream.BytesWritten();
+}
+
+// =====================================================================================================================
+// Compares ElfProcessor with ElfBuilder on pipeline-shaped ELFs: code, data, disassembly, a symbol table and a metadata
+// note.  Both produce the same bytes, which is checked once before timing.
+void RunElfBuilderBench(
+    BenchContext* pContext)
+{
+    constexpr uint32 CodeSize     = 16 * 1024;
+    constexpr uint32 DataSize     = 1024;
+    constexpr uint32 DisasmSize   = 32 * 1024;
+    constexpr uint32 MetadataSize = 4 * 1024;
+    constexpr uint32 SymbolCount  = 8;
+    constexpr uint32 BlobSize     = CodeSize + DataSize + DisasmSize + MetadataSize;
+
+    // Each iteration builds and serializes one ELF; build enough that the timings aren't dominated by timer overhead.
+    const uint32 iterations = Max(pContext->Config().elementCount / 64u, 1u);
+
+    GenericAllocator*const pAllocator = pContext->Allocator();
+
+    uint8* pBlob = static_cast<uint8*>(PAL_MALLOC(BlobSize, pAllocator, AllocInternal));
+
+    if (pBlob != nullptr)
+    {
+        for (uint32 i = 0; i < BlobSize; ++i)
+        {
+            pBlob[i] = static_cast<uint8>(pContext->NextRandom());
+        }
+
+        const uint8*const pCode     = pBlob;
+        const uint8*const pData     = pCode + CodeSize;
+        const uint8*const pDisasm   = pData + DataSize;
+        const uint8*const pMetadata = pDisasm + DisasmSize;
+
+        Elf::SymbolTableEntry symbols[SymbolCount] = { };
+        uint32                strTabSize           = 1;
+
+        for (uint32 i = 0; i < SymbolCount; ++i)
+        {
+            symbols[i].st_name      = strTabSize;
+            symbols[i].st_info.type = static_cast<uint8>(Elf::SymbolTableEntryType::Func);
+            symbols[i].st_shndx     = 2;
+            symbols[i].st_value     = i * (CodeSize / SymbolCount);
+            symbols[i].st_size      = CodeSize / SymbolCount;
+
+            strTabSize += static_cast<uint32>(strlen(RecordNames[i % ArrayLen(RecordNames)])) + 1;
+        }
+
+        void*  pOutput    = nullptr;
+        size_t outputSize = 0;
+
+        auto BuildWithProcessor = [&]()
+        {
+            Elf::ElfProcessor<GenericAllocator> processor(pAllocator);
+            processor.Init();
+            processor.SetTargetMachine(Elf::MachineType::AmdGpu);
+
+            auto*const pSections = processor.GetSections();
+            pSections->Add(Elf::SectionType::Text)->SetData(pCode, CodeSize);
+            pSections->Add(Elf::SectionType::Data)->SetData(pData, DataSize);
+            pSections->Add(".AMDGPU.disasm")->SetData(pDisasm, DisasmSize);
+
+            auto*const pStrTab = pSections->Add(Elf::SectionType::StrTab);
+            auto*const pSymTab = pSections->Add(Elf::SectionType::SymTab);
+            pSymTab->SetLink(pStrTab);
+
+            pStrTab->AppendData("", 1);
+            for (uint32 i = 0; i < SymbolCount; ++i)
+            {
+                const char*const pName = RecordNames[i % ArrayLen(RecordNames)];
+                pStrTab->AppendData(pName, strlen(pName) + 1);
+            }
+            pSymTab->SetData(&symbols[0], sizeof(symbols));
+
+            Elf::NoteProcessor<GenericAllocator> notes(pSections->Add(Elf::SectionType::Note), pAllocator);
+            notes.Init();
+            notes.Add(32, "AMDGPU", pMetadata, MetadataSize);
+
+            outputSize = processor.GetRequiredBufferSizeBytes();
+            processor.SaveToBuffer(pOutput);
+        };
+
+        Elf::ElfBuilder<GenericAllocator> builder(pAllocator);
+
+        auto BuildWithBuilder = [&]()
+        {
+            builder.Reset();
+            builder.SetTargetMachine(Elf::MachineType::AmdGpu);
+
+            builder.AppendSectionData(builder.AddSection(Elf::SectionType::Text), pCode, CodeSize);
+            builder.AppendSectionData(builder.AddSection(Elf::SectionType::Data), pData, DataSize);
+            builder.AppendSectionData(builder.AddSection(".AMDGPU.disasm"), pDisasm, DisasmSize);
+
+            const uint32 strTab = builder.AddSection(Elf::SectionType::StrTab);
+            const uint32 symTab = builder.AddSection(Elf::SectionType::SymTab);
+            builder.SetLink(symTab, strTab);
+
+            builder.AppendSectionData(strTab, "", 1);
+            for (uint32 i = 0; i < SymbolCount; ++i)
+            {
+                const char*const pName = RecordNames[i % ArrayLen(RecordNames)];
+                builder.AppendSectionData(strTab, pName, strlen(pName) + 1);
+            }
+            builder.AppendSectionData(symTab, &symbols[0], sizeof(symbols));
+
+            builder.AddNote(builder.AddSection(Elf::SectionType::Note), 32, "AMDGPU", pMetadata, MetadataSize);
+
+            outputSize = builder.GetRequiredBufferSizeBytes();
+
+            if (pOutput != nullptr)
+            {
+                builder.SaveToBuffer(pOutput, outputSize);
+            }
+        };
+
+        // Learn the ELF size from the builder without saving, then check both paths agree on every byte.
+        BuildWithBuilder();
+
+        const size_t elfSize = outputSize;
+        pOutput = PAL_MALLOC(2 * elfSize, pAllocator, AllocInternal);
+
+        if (pOutput != nullptr)
+        {
+            void*const pReference = VoidPtrInc(pOutput, elfSize);
+
+            BuildWithProcessor();
+            memcpy(pReference, pOutput, elfSize);
+            BuildWithBuilder();
+
+            PAL_ASSERT((outputSize == elfSize) && (memcmp(pOutput, pReference, elfSize) == 0));
+
+            const uint64 bytes = static_cast<uint64>(elfSize) * iterations;
+
+            pContext->Measure("processor_build_save", MeasureUnit::Bytes, bytes, NoOp,
+                              [&]()
+                              {
+                                  for (uint32 i = 0; i < iterations; ++i)
+                                  {
+                                      BuildWithProcessor();
+                                  }
+                              },
+                              NoOp);
+
+            pContext->Measure("builder_build_save", MeasureUnit::Bytes, bytes, NoOp,
+                              [&]()
+                              {
+                                  for (uint32 i = 0; i < iterations; ++i)
+                                  {
+                                      BuildWithBuilder();
+                                  }
+                              },
+                              NoOp);
+
+            s_sink = s_sink + static_cast<const uint8*>(pOutput)[elfSize - 1];
+
+            PAL_SAFE_FREE(pOutput, pAllocator);
+        }
+
+        PAL_SAFE_FREE(pBlob, pAllocator);
+    }
+}
+
+} // UtilBench
@@ -0,0 +1,617 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "palDequeImpl.h"
+#include "palHashMapImpl.h"
+#include "palLockFreeQueueImpl.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+
+#include <atomic>
+#include <stdio.h>
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+typedef HashMap<uint64, uint64, GenericAllocator> SharedMap;
+
+// Beyond this many threads the stress results mostly measure the OS scheduler.
+constexpr uint32 MaxStressThreads = 64;
+
+// The stress threads fold their results into this so the compiler can't discard the work being timed.
+static volatile uint64 s_sink = 0;
+
+// Serializes access to the shared map with a single mutex, like most of PAL's object caches.
+class MutexPolicy
+{
+public:
+    Result Init() { return m_lock.Init(); }
+
+    void LockForRead()    { m_lock.Lock(); }
+    void UnlockForRead()  { m_lock.Unlock(); }
+    void LockForWrite()   { m_lock.Lock(); }
+    void UnlockForWrite() { m_lock.Unlock(); }
+
+private:
+    Mutex m_lock;
+};
+
+// Lets readers of the shared map proceed concurrently.
+class RWLockPolicy
+{
+public:
+    Result Init() { return m_lock.Init(); }
+
+    void LockForRead()    { m_lock.LockForRead(); }
+    void UnlockForRead()  { m_lock.UnlockForRead(); }
+    void LockForWrite()   { m_lock.LockForWrite(); }
+    void UnlockForWrite() { m_lock.UnlockForWrite(); }
+
+private:
+    RWLock m_lock;
+};
+
+// State shared by all of the threads of one stress run.
+template <typename LockPolicy>
+struct StressShared
+{
+    SharedMap*           pMap;
+    LockPolicy*          pLock;
+    const uint64*        pLookupKeys;
+    const uint64*        pMissKeys;
+    uint32               keyCount;
+    uint32               opsPerThread;
+    uint32               writePercent;
+    std::atomic<uint32>  readyThreads;
+    std::atomic<bool>    go;
+};
+
+// Per-thread state.
+template <typename LockPolicy>
+struct StressThread
+{
+    Thread                    thread;
+    StressShared<LockPolicy>* pShared;
+    uint32                    threadIndex;
+    uint32                    threadCount;
+    uint64                    rngState;
+    uint64                    checksum;
+};
+
+// =====================================================================================================================
+// Runs one thread's mix of lookups and writes.  Writes insert and later erase keys from the thread's own stripe of the
+// miss keys, so the map churns without its size drifting and without two threads fighting over the same key.
+template <typename LockPolicy>
+static void StressThreadMain(
+    void* pParam)
+{
+    StressThread<LockPolicy>*const       pState  = static_cast<StressThread<LockPolicy>*>(pParam);
+    const StressShared<LockPolicy>*const pShared = pState->pShared;
+
+    pState->pShared->readyThreads++;
+    while (pState->pShared->go.load(std::memory_order_acquire) == false)
+    {
+        YieldThread();
+    }
+
+    uint64 checksum   = 0;
+    uint32 writeIndex = pState->threadIndex;
+    bool   inserting  = true;
+
+    for (uint32 op = 0; op < pShared->opsPerThread; ++op)
+    {
+        // xorshift64; cheaper than the context's generator, which isn't thread-safe anyway.
+        uint64 random = pState->rngState;
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        pState->rngState = random;
+
+        if ((random % 100) < pShared->writePercent)
+        {
+            const uint64 key = pShared->pMissKeys[writeIndex];
+
+            pShared->pLock->LockForWrite();
+            if (inserting)
+            {
+                pShared->pMap->Insert(key, op);
+            }
+            else
+            {
+                pShared->pMap->Erase(key);
+            }
+            pShared->pLock->UnlockForWrite();
+
+            // Walk this thread's stripe of the miss keys, inserting on the way out and erasing on the way back.
+            writeIndex += pState->threadCount;
+            if (writeIndex >= pShared->keyCount)
+            {
+                writeIndex = pState->threadIndex;
+                inserting  = (inserting == false);
+            }
+        }
+        else
+        {
+            const uint64 key = pShared->pLookupKeys[(random >> 32) % pShared->keyCount];
+
+            pShared->pLock->LockForRead();
+            const uint64*const pValue = pShared->pMap->FindKey(key);
+            checksum += (pValue != nullptr) ? *pValue : 0;
+            pShared->pLock->UnlockForRead();
+        }
+    }
+
+    pState->checksum = checksum;
+}
+
+// =====================================================================================================================
+// Measures a map shared between threads behind the given lock type, first uncontended on one thread and then with the
+// configured number of threads starting together.
+template <typename LockPolicy>
+static void RunLockStressBench(
+    BenchContext* pContext)
+{
+    const BenchConfig& config      = pContext->Config();
+    const uint32       threadCount = Min(config.threadCount, MaxStressThreads);
+
+    LockPolicy lock;
+    SharedMap  map(config.elementCount, pContext->Allocator());
+
+    Result result = lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = map.Init();
+    }
+
+    for (uint32 i = 0; (result == Result::Success) && (i < config.elementCount); ++i)
+    {
+        result = map.Insert(pContext->Keys()[i], i);
+    }
+
+    StressThread<LockPolicy>* pThreads = nullptr;
+
+    if (result == Result::Success)
+    {
+        pThreads = PAL_NEW_ARRAY(StressThread<LockPolicy>, threadCount, pContext->Allocator(), AllocInternal);
+    }
+
+    if (pThreads != nullptr)
+    {
+        StressShared<LockPolicy> shared;
+        shared.pMap         = &map;
+        shared.pLock        = &lock;
+        shared.pLookupKeys  = pContext->LookupKeys();
+        shared.pMissKeys    = pContext->MissKeys();
+        shared.keyCount     = config.elementCount;
+        shared.opsPerThread = config.elementCount;
+        shared.writePercent = config.writePercent;
+
+        for (uint32 pass = 0; pass < 2; ++pass)
+        {
+            const uint32 passThreads = (pass == 0) ? 1 : threadCount;
+            bool         started     = true;
+
+            // Threads are created untimed and held at a start gate, so the measurement covers only the contended
+            // section.
+            auto Start = [&]()
+            {
+                shared.readyThreads = 0;
+                shared.go           = false;
+
+                for (uint32 t = 0; t < passThreads; ++t)
+                {
+                    pThreads[t].pShared     = &shared;
+                    pThreads[t].threadIndex = t;
+                    pThreads[t].threadCount = passThreads;
+                    pThreads[t].rngState    = (config.seed + 1) * (t + 1) * 0x9E3779B97F4A7C15ull;
+                    pThreads[t].checksum    = 0;
+
+                    if (pThreads[t].thread.Begin(&StressThreadMain<LockPolicy>, &pThreads[t]) != Result::Success)
+                    {
+                        started = false;
+                    }
+                }
+
+                while (started && (shared.readyThreads.load() < passThreads))
+                {
+                    YieldThread();
+                }
+            };
+            auto Run = [&]()
+            {
+                shared.go.store(true, std::memory_order_release);
+
+                for (uint32 t = 0; t < passThreads; ++t)
+                {
+                    if (pThreads[t].thread.IsCreated())
+                    {
+                        pThreads[t].thread.Join();
+                    }
+                    s_sink = s_sink + pThreads[t].checksum;
+                }
+            };
+
+            pContext->Measure((pass == 0) ? "uncontended" : "contended",
+                              MeasureUnit::Ops,
+                              static_cast<uint64>(passThreads) * shared.opsPerThread,
+                              Start,
+                              Run,
+                              NoOp);
+
+            if (started == false)
+            {
+                fprintf(stderr, "utilBench: failed to start the stress threads\n");
+                break;
+            }
+        }
+
+        PAL_DELETE_ARRAY(pThreads, pContext->Allocator());
+    }
+}
+
+// =====================================================================================================================
+void RunMutexStressBench(
+    BenchContext* pContext)
+{
+    RunLockStressBench<MutexPolicy>(pContext);
+}
+
+// =====================================================================================================================
+void RunRWLockStressBench(
+    BenchContext* pContext)
+{
+    RunLockStressBench<RWLockPolicy>(pContext);
+}
+
+// Largest number of values the hand-off benchmarks push or pop at once.
+constexpr uint32 MaxHandOffBatch = 16;
+
+// Hands values to the consumer through a Deque behind a Mutex, with a Semaphore to wake it, which is how PAL's
+// worker threads used to receive their jobs.
+class LockedDequeHandOff
+{
+public:
+    explicit LockedDequeHandOff(GenericAllocator* pAllocator) : m_deque(pAllocator) { }
+
+    Result Init(uint32 /*count*/)
+    {
+        Result result = m_lock.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_available.Init(Semaphore::MaximumCountLimit, 0);
+        }
+
+        return result;
+    }
+
+    void Push(const uint64* pValues, uint32 count)
+    {
+        m_lock.Lock();
+        for (uint32 i = 0; i < count; ++i)
+        {
+            m_deque.PushBack(pValues[i]);
+        }
+        m_lock.Unlock();
+
+        m_available.Post(count);
+    }
+
+    uint32 Pop(uint64* pValues, uint32 /*maxCount*/)
+    {
+        m_available.Wait(UINT32_MAX);
+
+        m_lock.Lock();
+        m_deque.PopFront(pValues);
+        m_lock.Unlock();
+
+        return 1;
+    }
+
+private:
+    Deque<uint64, GenericAllocator> m_deque;
+    Mutex                           m_lock;
+    Semaphore                       m_available;
+};
+
+// Hands values over through a bounded lock-free ring, SpscQueue or MpscQueue.
+template <typename QueueType>
+class RingHandOff
+{
+public:
+    explicit RingHandOff(GenericAllocator* pAllocator) : m_queue(1024, pAllocator) { }
+
+    Result Init(uint32 /*count*/) { return m_queue.Init(); }
+
+    void Push(const uint64* pValues, uint32 count)
+    {
+        uint32 numPushed = 0;
+
+        while (numPushed < count)
+        {
+            const uint32 batchPushed = m_queue.PushBatch(pValues + numPushed, count - numPushed);
+
+            if (batchPushed == 0)
+            {
+                m_queue.Push(pValues[numPushed], UINT32_MAX);
+                numPushed++;
+            }
+
+            numPushed += batchPushed;
+        }
+    }
+
+    uint32 Pop(uint64* pValues, uint32 maxCount)
+    {
+        uint32 numPopped = m_queue.PopBatch(pValues, maxCount);
+
+        if (numPopped == 0)
+        {
+            m_queue.Pop(pValues, UINT32_MAX);
+            numPopped = 1;
+        }
+
+        return numPopped;
+    }
+
+private:
+    QueueType m_queue;
+};
+
+// An element of the IntrusiveMpscQueue hand-off.
+struct HandOffItem
+{
+    HandOffItem() : node(this), value(0) { }
+
+    MpscQueueNode<HandOffItem> node;
+    uint64                     value;
+};
+
+// Hands values over through an IntrusiveMpscQueue, with one preallocated node per value.
+class IntrusiveHandOff
+{
+public:
+    explicit IntrusiveHandOff(GenericAllocator* pAllocator) : m_pAllocator(pAllocator), m_pItems(nullptr) { }
+    ~IntrusiveHandOff() { PAL_SAFE_DELETE_ARRAY(m_pItems, m_pAllocator); }
+
+    Result Init(uint32 count)
+    {
+        m_pItems = PAL_NEW_ARRAY(HandOffItem, count, m_pAllocator, AllocInternal);
+        return (m_pItems != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    void Push(const uint64* pValues, uint32 count)
+    {
+        MpscQueueNode<HandOffItem>* pNodes[MaxHandOffBatch];
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            m_pItems[pValues[i]].value = pValues[i];
+            pNodes[i]                  = &m_pItems[pValues[i]].node;
+        }
+
+        m_queue.PushBatch(pNodes, count);
+    }
+
+    uint32 Pop(uint64* pValues, uint32 maxCount)
+    {
+        HandOffItem* pItems[MaxHandOffBatch];
+        uint32       numPopped = m_queue.PopBatch(pItems, Min(maxCount, MaxHandOffBatch));
+
+        if (numPopped == 0)
+        {
+            m_queue.Pop(pItems, UINT32_MAX);
+            numPopped = 1;
+        }
+
+        for (uint32 i = 0; i < numPopped; ++i)
+        {
+            pValues[i] = pItems[i]->value;
+        }
+
+        return numPopped;
+    }
+
+private:
+    GenericAllocator*               m_pAllocator;
+    HandOffItem*                    m_pItems;
+    IntrusiveMpscQueue<HandOffItem> m_queue;
+};
+
+// State shared by the producer threads of one hand-off run.
+template <typename HandOff>
+struct HandOffShared
+{
+    HandOff*            pHandOff;
+    uint32              valueCount;
+    uint32              producerCount;
+    uint32              batchSize;
+    std::atomic<uint32> readyThreads;
+    std::atomic<bool>   go;
+};
+
+// Per-producer state.
+template <typename HandOff>
+struct HandOffProducer
+{
+    Thread                  thread;
+    HandOffShared<HandOff>* pShared;
+    uint32                  threadIndex;
+};
+
+// =====================================================================================================================
+// Pushes this producer's stripe of the values, batchSize at a time.
+template <typename HandOff>
+static void HandOffProducerMain(
+    void* pParam)
+{
+    HandOffProducer<HandOff>*const     pState  = static_cast<HandOffProducer<HandOff>*>(pParam);
+    const HandOffShared<HandOff>*const pShared = pState->pShared;
+
+    pState->pShared->readyThreads++;
+    while (pState->pShared->go.load(std::memory_order_acquire) == false)
+    {
+        YieldThread();
+    }
+
+    uint64 batch[MaxHandOffBatch];
+    uint32 batchCount = 0;
+
+    for (uint32 value = pState->threadIndex; value < pShared->valueCount; value += pShared->producerCount)
+    {
+        batch[batchCount++] = value;
+
+        if (batchCount == pShared->batchSize)
+        {
+            pShared->pHandOff->Push(batch, batchCount);
+            batchCount = 0;
+        }
+    }
+
+    if (batchCount > 0)
+    {
+        pShared->pHandOff->Push(batch, batchCount);
+    }
+}
+
+// =====================================================================================================================
+// Measures handing elementCount values from producerCount threads to the calling thread, which pops them all.
+template <typename HandOff>
+static void MeasureHandOff(
+    BenchContext* pContext,
+    const char*   pName,
+    uint32        producerCount,
+    uint32        batchSize)
+{
+    const uint32 valueCount = pContext->Config().elementCount;
+
+    HandOff                   handOff(pContext->Allocator());
+    HandOffProducer<HandOff>* pProducers = nullptr;
+
+    if (handOff.Init(valueCount) == Result::Success)
+    {
+        pProducers = PAL_NEW_ARRAY(HandOffProducer<HandOff>, producerCount, pContext->Allocator(), AllocInternal);
+    }
+
+    if (pProducers != nullptr)
+    {
+        HandOffShared<HandOff> shared;
+        shared.pHandOff      = &handOff;
+        shared.valueCount    = valueCount;
+        shared.producerCount = producerCount;
+        shared.batchSize     = batchSize;
+
+        bool started = true;
+
+        auto Start = [&]()
+        {
+            shared.readyThreads = 0;
+            shared.go           = false;
+
+            for (uint32 t = 0; t < producerCount; ++t)
+            {
+                pProducers[t].pShared     = &shared;
+                pProducers[t].threadIndex = t;
+
+                if (pProducers[t].thread.Begin(&HandOffProducerMain<HandOff>, &pProducers[t]) != Result::Success)
+                {
+                    started = false;
+                }
+            }
+
+            while (started && (shared.readyThreads.load() < producerCount))
+            {
+                YieldThread();
+            }
+        };
+        auto Run = [&]()
+        {
+            shared.go.store(true, std::memory_order_release);
+
+            uint64 values[MaxHandOffBatch];
+            uint64 sum       = 0;
+            uint32 numPopped = 0;
+
+            while (started && (numPopped < valueCount))
+            {
+                const uint32 batchPopped = handOff.Pop(values, MaxHandOffBatch);
+
+                for (uint32 i = 0; i < batchPopped; ++i)
+                {
+                    sum += values[i];
+                }
+
+                numPopped += batchPopped;
+            }
+
+            for (uint32 t = 0; t < producerCount; ++t)
+            {
+                if (pProducers[t].thread.IsCreated())
+                {
+                    pProducers[t].thread.Join();
+                }
+            }
+
+            s_sink = s_sink + sum;
+        };
+
+        pContext->Measure(pName, MeasureUnit::Ops, valueCount, Start, Run, NoOp);
+
+        if (started == false)
+        {
+            fprintf(stderr, "utilBench: failed to start the hand-off threads\n");
+        }
+
+        PAL_DELETE_ARRAY(pProducers, pContext->Allocator());
+    }
+}
+
+// =====================================================================================================================
+// Compares handing values from producer threads to one consumer thread through a locked Deque and through the
+// lock-free queues, with one producer and then with the configured number of producers.
+void RunQueueHandOffBench(
+    BenchContext* pContext)
+{
+    typedef RingHandOff<SpscQueue<uint64, GenericAllocator>> SpscHandOff;
+    typedef RingHandOff<MpscQueue<uint64, GenericAllocator>> MpscHandOff;
+
+    const uint32 producerCount = Max(Min(pContext->Config().threadCount, MaxStressThreads) - 1, 1u);
+
+    MeasureHandOff<LockedDequeHandOff>(pContext, "mutexDeque",         1,             1);
+    MeasureHandOff<SpscHandOff>(pContext,        "spsc",               1,             1);
+    MeasureHandOff<SpscHandOff>(pContext,        "spscBatch",          1,             MaxHandOffBatch);
+    MeasureHandOff<LockedDequeHandOff>(pContext, "mutexDequeMulti",    producerCount, 1);
+    MeasureHandOff<MpscHandOff>(pContext,        "mpsc",               producerCount, 1);
+    MeasureHandOff<MpscHandOff>(pContext,        "mpscBatch",          producerCount, MaxHandOffBatch);
+    MeasureHandOff<IntrusiveHandOff>(pContext,   "intrusiveMpsc",      producerCount, 1);
+    MeasureHandOff<IntrusiveHandOff>(pContext,   "intrusiveMpscBatch", producerCount, MaxHandOffBatch);
+}
+
+} // UtilBench
@@ -0,0 +1,344 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "utilBench.h"
+#include "vaminterface.h"
+#include <stdlib.h>
+
+using namespace Util;
+
+namespace UtilBench
+{
+
+// The VAM benchmarks manage a 1TB range above the first 4GB, like a GPU's default virtual address partition.
+constexpr uint64 VamRangeStart = 0x100000000ull;
+constexpr uint64 VamRangeSize  = 1ull << 40;
+constexpr uint64 VamPageSize   = 4096;
+
+// Requests are 1 to VamMaxPages pages in size and aligned to 1 to 2^(VamAlignShifts - 1) pages, the shape of the
+// small IGpuMemory objects which fragment the range.  The fragmented benchmark's requests are larger than any hole.
+constexpr uint32 VamMaxPages     = 16;
+constexpr uint32 VamAlignShifts  = 5;
+constexpr uint64 VamLargeRequest = 2 * VamMaxPages * VamPageSize;
+
+// One VA allocation, or a request for one if va is zero.
+struct VamAllocation
+{
+    uint64 va;
+    uint64 size;
+    uint32 alignment;
+};
+
+// =====================================================================================================================
+static void* VAM_API VamAllocSysMem(
+    VAM_CLIENT_HANDLE hClient,
+    UINT              sizeInBytes)
+{
+    return PAL_MALLOC(sizeInBytes, static_cast<GenericAllocator*>(hClient), AllocInternal);
+}
+
+// =====================================================================================================================
+static VAM_RETURNCODE VAM_API VamFreeSysMem(
+    VAM_CLIENT_HANDLE hClient,
+    void*             pAddress)
+{
+    PAL_FREE(pAddress, static_cast<GenericAllocator*>(hClient));
+    return VAM_OK;
+}
+
+// =====================================================================================================================
+// There are no page tables or rafts to back, so VAM is told it doesn't need PTBs and the GPU memory callbacks fail.
+static VAM_RETURNCODE VAM_API VamNeedPtb()
+{
+    return VAM_ERROR;
+}
+
+// =====================================================================================================================
+static VAM_PTB_HANDLE VAM_API VamAllocPtb(
+    VAM_CLIENT_HANDLE    hClient,
+    VAM_VIRTUAL_ADDRESS  ptbBaseVirtAddr,
+    VAM_RETURNCODE*const pResult)
+{
+    *pResult = VAM_ERROR;
+    return nullptr;
+}
+
+// =====================================================================================================================
+static VAM_RETURNCODE VAM_API VamFreePtb(
+    VAM_CLIENT_HANDLE hClient,
+    VAM_PTB_HANDLE    hPtbAlloc)
+{
+    return VAM_ERROR;
+}
+
+// =====================================================================================================================
+static VAM_VIDMEM_HANDLE VAM_API VamAllocVidMem(
+    VAM_CLIENT_HANDLE      hClient,
+    VAM_ALLOCVIDMEM_INPUT* pAllocVidMemIn)
+{
+    return nullptr;
+}
+
+// =====================================================================================================================
+static VAM_RETURNCODE VAM_API VamVidMemOp(
+    VAM_CLIENT_HANDLE hClient,
+    VAM_VIDMEM_HANDLE hVidMem)
+{
+    return VAM_ERROR;
+}
+
+// =====================================================================================================================
+static VAM_HANDLE CreateVam(
+    GenericAllocator* pAllocator)
+{
+    VAM_CREATE_INPUT createIn = {};
+    createIn.size                    = sizeof(createIn);
+    createIn.version.major           = VAM_VERSION_MAJOR;
+    createIn.version.minor           = VAM_VERSION_MINOR;
+    createIn.callbacks.allocSysMem   = VamAllocSysMem;
+    createIn.callbacks.freeSysMem    = VamFreeSysMem;
+    createIn.callbacks.allocPTB      = VamAllocPtb;
+    createIn.callbacks.freePTB       = VamFreePtb;
+    createIn.callbacks.allocVidMem   = VamAllocVidMem;
+    createIn.callbacks.freeVidMem    = VamVidMemOp;
+    createIn.callbacks.offerVidMem   = VamVidMemOp;
+    createIn.callbacks.reclaimVidMem = VamVidMemOp;
+    createIn.callbacks.needPTB       = VamNeedPtb;
+    createIn.VARangeStart            = VamRangeStart;
+    createIn.VARangeEnd              = VamRangeStart + VamRangeSize - 1;
+    createIn.bigKSize                = 64 * 1024;
+    createIn.PTBSize                 = 64 * 1024;  // Required, even though VamNeedPtb() means no PTB is ever made.
+
+    return VAMCreate(pAllocator, &createIn);
+}
+
+// =====================================================================================================================
+static bool VamAlloc(
+    VAM_HANDLE     hVam,
+    VamAllocation* pAllocation)
+{
+    VAM_ALLOC_INPUT  allocIn  = {};
+    VAM_ALLOC_OUTPUT allocOut = {};
+    allocIn.sizeInBytes = pAllocation->size;
+    allocIn.alignment   = pAllocation->alignment;
+
+    const bool success = (VAMAlloc(hVam, &allocIn, &allocOut) == VAM_OK);
+
+    pAllocation->va = success ? allocOut.virtualAddress : 0;
+
+    return success;
+}
+
+// =====================================================================================================================
+static void VamFree(
+    VAM_HANDLE     hVam,
+    VamAllocation* pAllocation)
+{
+    if (pAllocation->va != 0)
+    {
+        VAM_FREE_INPUT freeIn = {};
+        freeIn.virtualAddress = pAllocation->va;
+        freeIn.actualSize     = pAllocation->size;
+
+        const VAM_RETURNCODE ret = VAMFree(hVam, &freeIn);
+        PAL_ASSERT(ret == VAM_OK);
+
+        pAllocation->va = 0;
+    }
+}
+
+// =====================================================================================================================
+// Fills in a random small request.
+static void RandomRequest(
+    BenchContext*  pContext,
+    VamAllocation* pAllocation)
+{
+    const uint64 random = pContext->NextRandom();
+
+    pAllocation->va        = 0;
+    pAllocation->size      = ((random % VamMaxPages) + 1) * VamPageSize;
+    pAllocation->alignment = static_cast<uint32>(VamPageSize << ((random >> 32) % VamAlignShifts));
+}
+
+// =====================================================================================================================
+static int CompareVa(
+    const void* pLhs,
+    const void* pRhs)
+{
+    const uint64 lhs = static_cast<const VamAllocation*>(pLhs)->va;
+    const uint64 rhs = static_cast<const VamAllocation*>(pRhs)->va;
+
+    return (lhs < rhs) ? -1 : ((lhs > rhs) ? 1 : 0);
+}
+
+// =====================================================================================================================
+// Checks that every allocation is aligned, inside the range and disjoint from the others and that VAM accounts for
+// exactly their sizes, then frees them all and checks that the free space coalesces back into the whole range.  This
+// reorders the allocations.
+static void VerifyAndDestroyVam(
+    BenchContext*  pContext,
+    VAM_HANDLE     hVam,
+    VamAllocation* pAllocations,
+    uint32         count)
+{
+    bool   success  = true;
+    uint64 usedSize = 0;
+
+    qsort(pAllocations, count, sizeof(VamAllocation), CompareVa);
+
+    for (uint32 idx = 0; idx < count; ++idx)
+    {
+        const VamAllocation& allocation = pAllocations[idx];
+
+        if (allocation.va != 0)
+        {
+            const uint64 prevEnd = (idx > 0) ? (pAllocations[idx - 1].va + pAllocations[idx - 1].size) : 0;
+
+            success  &= ((allocation.va % allocation.alignment) == 0) &&
+                        (allocation.va >= Max(VamRangeStart, prevEnd)) &&
+                        ((allocation.va + allocation.size) <= (VamRangeStart + VamRangeSize));
+            usedSize += allocation.size;
+        }
+    }
+
+    VAM_GLOBALALLOCSTATUS_OUTPUT status = {};
+
+    if (success == false)
+    {
+        pContext->ReportFailure("VAM returned a misaligned or overlapping allocation.");
+    }
+    else if ((VAMQueryGlobalAllocStatus(hVam, &status) != VAM_OK) || (status.usedSizeInBytes != usedSize))
+    {
+        pContext->ReportFailure("VAM's used size doesn't match its allocations.");
+    }
+
+    for (uint32 idx = 0; idx < count; ++idx)
+    {
+        VamFree(hVam, &pAllocations[idx]);
+    }
+
+    // Once everything is free, the whole range must be available as one chunk again.
+    VamAllocation whole = { 0, VamRangeSize, static_cast<uint32>(VamPageSize) };
+
+    if ((VAMQueryGlobalAllocStatus(hVam, &status) != VAM_OK) || (status.usedSizeInBytes != 0))
+    {
+        pContext->ReportFailure("VAM leaked free space.");
+    }
+    else if ((VamAlloc(hVam, &whole) == false) || (whole.va != VamRangeStart))
+    {
+        pContext->ReportFailure("VAM didn't coalesce adjacent free chunks.");
+    }
+
+    VamFree(hVam, &whole);
+    VAMDestroy(hVam);
+}
+
+// =====================================================================================================================
+// Measures VA allocation from a range which is empty, fragmented by many small holes, and under steady churn.  Each
+// measurement also verifies VAM's bookkeeping afterwards.
+void RunVamBench(
+    BenchContext* pContext)
+{
+    GenericAllocator*const pAllocator = pContext->Allocator();
+    const uint32           count      = pContext->Config().elementCount;
+
+    VamAllocation* pAllocations = PAL_NEW_ARRAY(VamAllocation, count, pAllocator, AllocInternal);
+    VAM_HANDLE     hVam         = nullptr;
+
+    if (pAllocations != nullptr)
+    {
+        for (uint32 idx = 0; idx < count; ++idx)
+        {
+            RandomRequest(pContext, &pAllocations[idx]);
+        }
+
+        auto Create  = [&]() { hVam = CreateVam(pAllocator); };
+        auto Verify  = [&]() { VerifyAndDestroyVam(pContext, hVam, pAllocations, count); };
+        auto FillAll = [&]()
+        {
+            for (uint32 idx = 0; idx < count; ++idx)
+            {
+                VamAlloc(hVam, &pAllocations[idx]);
+            }
+        };
+
+        pContext->Measure("alloc", MeasureUnit::Ops, count, Create, FillAll, Verify);
+
+        // Free every other allocation, leaving count / 2 holes which are all too small for the timed requests.  Before
+        // VAM indexed its free chunks by size, each of these allocations walked every hole.
+        pContext->Measure("allocFragmented",
+                          MeasureUnit::Ops,
+                          count / 2,
+                          [&]()
+                          {
+                              Create();
+                              FillAll();
+
+                              for (uint32 idx = 0; idx < count; idx += 2)
+                              {
+                                  VamFree(hVam, &pAllocations[idx]);
+                                  pAllocations[idx].size = VamLargeRequest;
+                              }
+                          },
+                          [&]()
+                          {
+                              for (uint32 idx = 0; idx < count; idx += 2)
+                              {
+                                  VamAlloc(hVam, &pAllocations[idx]);
+                              }
+                          },
+                          [&]()
+                          {
+                              Verify();
+
+                              for (uint32 idx = 0; idx < count; ++idx)
+                              {
+                                  RandomRequest(pContext, &pAllocations[idx]);
+                              }
+                          });
+
+        // Replace a random live allocation with a new random request, count times.
+        pContext->Measure("churn",
+                          MeasureUnit::Ops,
+                          count,
+                          [&]() { Create(); FillAll(); },
+                          [&]()
+                          {
+                              for (uint32 op = 0; op < count; ++op)
+                              {
+                                  VamAllocation*const pVictim = &pAllocations[pContext->NextRandom() % count];
+
+                                  VamFree(hVam, pVictim);
+                                  RandomRequest(pContext, pVictim);
+                                  VamAlloc(hVam, pVictim);
+                              }
+                          },
+                          Verify);
+    }
+
+    PAL_SAFE_DELETE_ARRAY(pAllocations, pAllocator);
+}
+
+} // UtilBench
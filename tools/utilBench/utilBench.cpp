@@ -0,0 +1,534 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  utilBench.cpp
+ * @brief Microbenchmark and stress harness for the PAL utility collection's containers, allocators and serializers.
+ *
+ * Usage: utilBench [--elements=<n>] [--repetitions=<n>] [--threads=<n>] [--writes=<percent>]
+ *                  [--keys=sequential|uniform|clustered] [--seed=<n>] [--groups=<a,b,...>] [--output=<path>] [--list]
+ *
+ * Every measurement is repeated and the fastest repetition is reported alongside the mean, as a JSON document suitable
+ * for tracking regressions in CI.
+ ***********************************************************************************************************************
+ */
+
+#include "utilBench.h"
+#include "palJsonWriter.h"
+#include "palVectorImpl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace Util;
+using namespace UtilBench;
+
+// Fraction of lookups which hit the hottest tenth of the keys.
+constexpr uint32 HotLookupPercent = 90;
+
+static const char* KeyDistributionNames[] =
+{
+    "sequential",
+    "uniform",
+    "clustered",
+};
+
+static_assert(ArrayLen(KeyDistributionNames) == static_cast<uint32>(KeyDistribution::Count),
+              "KeyDistributionNames needs to be updated.");
+
+static const char* MeasureUnitNames[] =
+{
+    "ops",
+    "bytes",
+};
+
+static const BenchGroup Groups[] =
+{
+    { "HashMap",          RunHashMapBench          },
+    { "HashSet",          RunHashSetBench          },
+    { "Vector",           RunVectorBench           },
+    { "Deque",            RunDequeBench            },
+    { "SparseVector",     RunSparseVectorBench     },
+    { "IntervalTree",     RunIntervalTreeBench     },
+    { "IntrusiveList",    RunIntrusiveListBench    },
+    { "LinearAllocator",  RunLinearAllocatorBench  },
+    { "BuddyAllocator",   RunBuddyAllocatorBench   },
+    { "BestFitAllocator", RunBestFitAllocatorBench },
+    { "SystemAllocator",  RunSystemAllocatorBench  },
+    { "SlabAllocator",    RunSlabAllocatorBench    },
+#if PAL_MEMTRACK
+    { "MemTracker",       RunMemTrackerBench       },
+#endif
+    { "StreamingMem",     RunStreamingMemBench     },
+    { "CpuProfiler",      RunCpuProfilerBench      },
+    { "MetroHash",        RunMetroHashBench        },
+    { "MsgPack",          RunMsgPackBench          },
+    { "JsonWriter",       RunJsonWriterBench       },
+    { "ElfBuilder",       RunElfBuilderBench       },
+    { "MutexStress",      RunMutexStressBench      },
+    { "RWLockStress",     RunRWLockStressBench     },
+    { "QueueHandOff",     RunQueueHandOffBench     },
+    { "Vam",              RunVamBench              },
+    { "ArchiveCache",     RunArchiveCacheBench     },
+};
+
+namespace UtilBench
+{
+
+// =====================================================================================================================
+BenchContext::BenchContext(
+    const BenchConfig& config,
+    GenericAllocator*  pAllocator)
+    :
+    m_config(config),
+    m_pAllocator(pAllocator),
+    m_rngState(config.seed),
+    m_pGroup(nullptr),
+    m_failed(false),
+    m_pKeys(nullptr),
+    m_pLookupKeys(nullptr),
+    m_pMissKeys(nullptr),
+    m_measurements(pAllocator)
+{
+}
+
+// =====================================================================================================================
+BenchContext::~BenchContext()
+{
+    PAL_SAFE_FREE(m_pKeys, m_pAllocator);
+}
+
+// =====================================================================================================================
+// Generates the key sets every container benchmark shares.
+Result BenchContext::Init()
+{
+    const uint32 count = m_config.elementCount;
+
+    // One allocation holds the insertion keys, the lookup keys and the miss keys back to back.
+    m_pKeys = static_cast<uint64*>(PAL_MALLOC(sizeof(uint64) * count * 3, m_pAllocator, AllocInternal));
+
+    Result result = (m_pKeys != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+
+    if (result == Result::Success)
+    {
+        m_pLookupKeys = m_pKeys + count;
+        m_pMissKeys   = m_pLookupKeys + count;
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            GenerateKey(i, &m_pKeys[i]);
+
+            // Present keys never have the top bit set, so setting it yields a key which is guaranteed to miss.
+            m_pMissKeys[i] = m_pKeys[i] | (1ull << 63);
+        }
+
+        const uint32 hotCount = Max(count / 10, 1u);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            const bool hot = ((NextRandom() % 100) < HotLookupPercent);
+            m_pLookupKeys[i] = m_pKeys[NextRandom() % (hot ? hotCount : count)];
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// SplitMix64; fast and good enough to drive key distributions and access patterns.
+uint64 BenchContext::NextRandom()
+{
+    uint64 z = (m_rngState += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+    return z ^ (z >> 31);
+}
+
+// =====================================================================================================================
+// Produces the index'th unique key of the configured distribution.  Keys never have their top bit set.
+void BenchContext::GenerateKey(
+    uint32  index,
+    uint64* pKey)
+{
+    switch (m_config.distribution)
+    {
+    case KeyDistribution::Sequential:
+        (*pKey) = index;
+        break;
+    case KeyDistribution::Uniform:
+        // Bits [4:36) carry the index so that keys stay unique and at least 16 apart; the rest are random.
+        (*pKey) = ((NextRandom() << 36) | (static_cast<uint64>(index) << 4)) & ~(1ull << 63);
+        break;
+    case KeyDistribution::Clustered:
+        // Eight 1TB-aligned ranges of 4KB pages, interleaved.
+        (*pKey) = (static_cast<uint64>((index % 8) + 1) << 40) | (static_cast<uint64>(index / 8) << 12);
+        break;
+    default:
+        PAL_NEVER_CALLED();
+        break;
+    }
+}
+
+// =====================================================================================================================
+void BenchContext::Record(
+    const char* pName,
+    MeasureUnit unit,
+    uint64      count,
+    uint64      minNs,
+    uint64      meanNs)
+{
+    Measurement measurement = {};
+    measurement.pGroup = m_pGroup;
+    measurement.pName  = pName;
+    measurement.unit   = unit;
+    measurement.count  = count;
+    measurement.minNs  = minNs;
+    measurement.meanNs = meanNs;
+
+    const Result result = m_measurements.PushBack(measurement);
+    PAL_ASSERT(result == Result::Success);
+}
+
+// =====================================================================================================================
+void BenchContext::ReportFailure(
+    const char* pMessage)
+{
+    fprintf(stderr, "utilBench: %s: %s\n", m_pGroup, pMessage);
+    m_failed = true;
+}
+
+// =====================================================================================================================
+uint64 BenchContext::TicksToNs(
+    int64 ticks)
+{
+    return static_cast<uint64>(static_cast<double>(ticks) * 1000000000.0 / static_cast<double>(GetPerfFrequency()));
+}
+
+} // UtilBench
+
+// =====================================================================================================================
+// JsonStream which writes to a stdio stream.
+class BenchJsonStream : public JsonStream
+{
+public:
+    explicit BenchJsonStream(FILE* pFile) : m_pFile(pFile) { }
+    virtual ~BenchJsonStream() { }
+
+    virtual void WriteString(const char* pString, uint32 length) override { fwrite(pString, 1, length, m_pFile); }
+    virtual void WriteCharacter(char character) override { fputc(character, m_pFile); }
+
+private:
+    FILE*const m_pFile;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BenchJsonStream);
+};
+
+// =====================================================================================================================
+static void PrintUsage()
+{
+    fprintf(stderr,
+            "usage: utilBench [options]\n"
+            "  --elements=<n>         Elements per container benchmark (default 65536)\n"
+            "  --repetitions=<n>      Timed repetitions per measurement (default 10)\n"
+            "  --threads=<n>          Threads for the stress benchmarks (default 4)\n"
+            "  --writes=<percent>     Percentage of stress operations which modify the container (default 10)\n"
+            "  --keys=<distribution>  sequential, uniform or clustered (default uniform)\n"
+            "  --seed=<n>             Key generator seed (default 1)\n"
+            "  --groups=<a,b,...>     Benchmark groups to run (default all)\n"
+            "  --output=<path>        JSON report path (default stdout)\n"
+            "  --list                 List the benchmark groups, then exit\n");
+}
+
+// =====================================================================================================================
+// Parses a non-negative integer option value.  Returns false if the text is not a number.
+static bool ParseUint(
+    const char* pValue,
+    uint64      maxValue,
+    uint64*     pOut)
+{
+    char*                    pEnd  = nullptr;
+    const unsigned long long value = strtoull(pValue, &pEnd, 10);
+    const bool               valid = (pEnd != pValue) && (*pEnd == '\0') && (value <= maxValue);
+
+    if (valid)
+    {
+        (*pOut) = value;
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+static bool ParseUint(
+    const char* pValue,
+    uint32*     pOut)
+{
+    uint64     value = 0;
+    const bool valid = ParseUint(pValue, UINT32_MAX, &value);
+
+    if (valid)
+    {
+        (*pOut) = static_cast<uint32>(value);
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Parses "--key=value" arguments into the config.  Returns false on a malformed or unknown argument.
+static bool ParseArgs(
+    int          argc,
+    char**       argv,
+    BenchConfig* pConfig,
+    bool*        pListOnly)
+{
+    bool valid = true;
+
+    for (int i = 1; valid && (i < argc); ++i)
+    {
+        const char*  pArg   = argv[i];
+        const char*  pValue = strchr(pArg, '=');
+        const size_t keyLen = (pValue != nullptr) ? static_cast<size_t>(pValue - pArg) : strlen(pArg);
+
+        if (pValue != nullptr)
+        {
+            pValue++;
+        }
+
+        auto IsKey = [pArg, keyLen](const char* pKey) -> bool
+            { return (strlen(pKey) == keyLen) && (strncmp(pArg, pKey, keyLen) == 0); };
+
+        if (IsKey("--list"))
+        {
+            (*pListOnly) = true;
+        }
+        else if (pValue == nullptr)
+        {
+            valid = false;
+        }
+        else if (IsKey("--elements"))
+        {
+            valid = ParseUint(pValue, &pConfig->elementCount) && (pConfig->elementCount > 0);
+        }
+        else if (IsKey("--repetitions"))
+        {
+            valid = ParseUint(pValue, &pConfig->repetitions) && (pConfig->repetitions > 0);
+        }
+        else if (IsKey("--threads"))
+        {
+            valid = ParseUint(pValue, &pConfig->threadCount) && (pConfig->threadCount > 0);
+        }
+        else if (IsKey("--writes"))
+        {
+            valid = ParseUint(pValue, &pConfig->writePercent) && (pConfig->writePercent <= 100);
+        }
+        else if (IsKey("--keys"))
+        {
+            valid = false;
+            for (uint32 d = 0; d < static_cast<uint32>(KeyDistribution::Count); ++d)
+            {
+                if (strcmp(pValue, KeyDistributionNames[d]) == 0)
+                {
+                    pConfig->distribution = static_cast<KeyDistribution>(d);
+                    valid                 = true;
+                }
+            }
+        }
+        else if (IsKey("--seed"))
+        {
+            valid = ParseUint(pValue, UINT64_MAX, &pConfig->seed);
+        }
+        else if (IsKey("--groups"))
+        {
+            pConfig->pGroups = pValue;
+        }
+        else if (IsKey("--output"))
+        {
+            pConfig->pOutputPath = pValue;
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (valid == false)
+        {
+            fprintf(stderr, "utilBench: invalid argument '%s'\n", pArg);
+        }
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Returns true if the named group appears in the comma-separated filter list, or if there is no filter.
+static bool IsGroupSelected(
+    const char* pFilter,
+    const char* pName)
+{
+    bool selected = (pFilter == nullptr);
+
+    const size_t nameLen = strlen(pName);
+
+    while ((selected == false) && (pFilter != nullptr))
+    {
+        const char*  pComma = strchr(pFilter, ',');
+        const size_t length = (pComma != nullptr) ? static_cast<size_t>(pComma - pFilter) : strlen(pFilter);
+
+        selected = (length == nameLen) && (strncmp(pFilter, pName, length) == 0);
+        pFilter  = (pComma != nullptr) ? (pComma + 1) : nullptr;
+    }
+
+    return selected;
+}
+
+// =====================================================================================================================
+// Writes the JSON report.
+static void WriteReport(
+    const BenchContext& context,
+    FILE*               pFile)
+{
+    const BenchConfig& config = context.Config();
+
+    BenchJsonStream stream(pFile);
+    JsonWriter      writer(&stream);
+
+    writer.BeginMap(false);
+
+    writer.KeyAndBeginMap("config", false);
+    writer.KeyAndValue("elements", config.elementCount);
+    writer.KeyAndValue("repetitions", config.repetitions);
+    writer.KeyAndValue("threads", config.threadCount);
+    writer.KeyAndValue("writePercent", config.writePercent);
+    writer.KeyAndValue("keys", KeyDistributionNames[static_cast<uint32>(config.distribution)]);
+    writer.KeyAndValue("seed", config.seed);
+    writer.EndMap();
+
+    writer.KeyAndBeginList("results", false);
+    for (auto iter = context.Measurements().Begin(); iter.IsValid(); iter.Next())
+    {
+        const Measurement& measurement = iter.Get();
+
+        const uint64 perSecond = (measurement.minNs > 0) ?
+            static_cast<uint64>(static_cast<double>(measurement.count) * 1000000000.0 / measurement.minNs) : 0;
+        const float  nsPerUnit = (measurement.count > 0) ?
+            static_cast<float>(static_cast<double>(measurement.minNs) / measurement.count) : 0.0f;
+
+        writer.BeginMap(true);
+        writer.KeyAndValue("group", measurement.pGroup);
+        writer.KeyAndValue("name", measurement.pName);
+        writer.KeyAndValue("unit", MeasureUnitNames[static_cast<uint32>(measurement.unit)]);
+        writer.KeyAndValue("count", measurement.count);
+        writer.KeyAndValue("minNs", measurement.minNs);
+        writer.KeyAndValue("meanNs", measurement.meanNs);
+        writer.KeyAndValue("perSecond", perSecond);
+        writer.KeyAndValue("nsPerUnit", nsPerUnit);
+        writer.EndMap();
+    }
+    writer.EndList();
+
+    writer.EndMap();
+    fputc('\n', pFile);
+}
+
+// =====================================================================================================================
+int main(
+    int    argc,
+    char** argv)
+{
+    BenchConfig config  = {};
+    config.elementCount = 65536;
+    config.repetitions  = 10;
+    config.threadCount  = 4;
+    config.writePercent = 10;
+    config.distribution = KeyDistribution::Uniform;
+    config.seed         = 1;
+
+    bool listOnly = false;
+    int  exitCode = 0;
+
+    if (ParseArgs(argc, argv, &config, &listOnly) == false)
+    {
+        PrintUsage();
+        exitCode = 1;
+    }
+    else if (listOnly)
+    {
+        for (uint32 i = 0; i < ArrayLen(Groups); ++i)
+        {
+            fprintf(stderr, "%s\n", Groups[i].pName);
+        }
+    }
+    else
+    {
+        GenericAllocator allocator;
+        BenchContext     context(config, &allocator);
+
+        if (context.Init() != Result::Success)
+        {
+            fprintf(stderr, "utilBench: failed to generate keys\n");
+            exitCode = 1;
+        }
+        else
+        {
+            for (uint32 i = 0; i < ArrayLen(Groups); ++i)
+            {
+                if (IsGroupSelected(config.pGroups, Groups[i].pName))
+                {
+                    context.SetGroup(Groups[i].pName);
+                    Groups[i].pfnRun(&context);
+                }
+            }
+
+            if (context.Failed())
+            {
+                exitCode = 1;
+            }
+
+            FILE* pFile = (config.pOutputPath != nullptr) ? fopen(config.pOutputPath, "w") : stdout;
+
+            if (pFile != nullptr)
+            {
+                WriteReport(context, pFile);
+
+                if (pFile != stdout)
+                {
+                    fclose(pFile);
+                }
+            }
+            else
+            {
+                fprintf(stderr, "utilBench: failed to open '%s'\n", config.pOutputPath);
+                exitCode = 1;
+            }
+        }
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,215 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+#include "palVector.h"
+
+namespace UtilBench
+{
+
+// Shape of the keys the container benchmarks insert and look up.
+enum class KeyDistribution : Util::uint32
+{
+    Sequential = 0,  // Dense, increasing keys, like object IDs or array indices.
+    Uniform,         // Uniformly random 64-bit keys, like hashes.
+    Clustered,       // Page-aligned addresses grouped in a few ranges, like GPU virtual addresses.
+    Count
+};
+
+// Benchmark configuration, filled in from the command line.
+struct BenchConfig
+{
+    Util::uint32    elementCount;  // Number of elements each container benchmark operates on.
+    Util::uint32    repetitions;   // Number of timed repetitions of each measurement; the fastest one is reported.
+    Util::uint32    threadCount;   // Number of threads used by the stress benchmarks.
+    Util::uint32    writePercent;  // Percentage of stress benchmark operations which modify the container.
+    KeyDistribution distribution;
+    Util::uint64    seed;          // Seed for the key generator, so runs are reproducible.
+    const char*     pGroups;       // Comma-separated list of benchmark groups to run, or null to run all of them.
+    const char*     pOutputPath;   // Path of the JSON report, or null to write it to stdout.
+};
+
+// Unit of the operation count of a measurement.
+enum class MeasureUnit : Util::uint32
+{
+    Ops = 0,  // Container or allocator operations.
+    Bytes,    // Bytes hashed or serialized.
+};
+
+// One timed measurement.
+struct Measurement
+{
+    const char*  pGroup;
+    const char*  pName;
+    MeasureUnit  unit;
+    Util::uint64 count;   // Operations or bytes processed by one repetition.
+    Util::uint64 minNs;   // Fastest repetition.
+    Util::uint64 meanNs;  // Average over all repetitions.
+};
+
+// =====================================================================================================================
+// Generates keys and drives the timed repetitions of a benchmark group, collecting the measurements.
+class BenchContext
+{
+public:
+    BenchContext(const BenchConfig& config, Util::GenericAllocator* pAllocator);
+    ~BenchContext();
+
+    Util::Result Init();
+
+    const BenchConfig&      Config()    const { return m_config; }
+    Util::GenericAllocator* Allocator() const { return m_pAllocator; }
+
+    // Keys following the configured distribution; elementCount unique entries, in insertion order.
+    const Util::uint64* Keys() const { return m_pKeys; }
+
+    // The same keys in a different order, with a 90/10 hot/cold skew, for lookup benchmarks.
+    const Util::uint64* LookupKeys() const { return m_pLookupKeys; }
+
+    // Keys guaranteed not to be present in Keys().
+    const Util::uint64* MissKeys() const { return m_pMissKeys; }
+
+    Util::uint64 NextRandom();
+
+    void SetGroup(const char* pGroup) { m_pGroup = pGroup; }
+
+    // Times body() over the configured repetitions, calling setup() untimed before and teardown() untimed after each
+    // one.  count is the number of operations (or bytes) a single call to body() performs.
+    template <typename SetupFunc, typename BodyFunc, typename TeardownFunc>
+    void Measure(
+        const char*  pName,
+        MeasureUnit  unit,
+        Util::uint64 count,
+        SetupFunc    setup,
+        BodyFunc     body,
+        TeardownFunc teardown);
+
+    // Records an externally timed measurement, used by the multithreaded stress benchmarks.
+    void Record(const char* pName, MeasureUnit unit, Util::uint64 count, Util::uint64 minNs, Util::uint64 meanNs);
+
+    // Reports that a group's correctness check failed, which makes utilBench exit with an error.
+    void ReportFailure(const char* pMessage);
+
+    bool Failed() const { return m_failed; }
+
+    const Util::Vector<Measurement, 64, Util::GenericAllocator>& Measurements() const { return m_measurements; }
+
+    static Util::uint64 TicksToNs(Util::int64 ticks);
+
+private:
+    void GenerateKey(Util::uint32 index, Util::uint64* pKey);
+
+    const BenchConfig       m_config;
+    Util::GenericAllocator* m_pAllocator;
+    Util::uint64            m_rngState;
+    const char*             m_pGroup;
+    bool                    m_failed;
+
+    Util::uint64*           m_pKeys;
+    Util::uint64*           m_pLookupKeys;
+    Util::uint64*           m_pMissKeys;
+
+    Util::Vector<Measurement, 64, Util::GenericAllocator> m_measurements;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BenchContext);
+};
+
+// =====================================================================================================================
+template <typename SetupFunc, typename BodyFunc, typename TeardownFunc>
+void BenchContext::Measure(
+    const char*  pName,
+    MeasureUnit  unit,
+    Util::uint64 count,
+    SetupFunc    setup,
+    BodyFunc     body,
+    TeardownFunc teardown)
+{
+    Util::int64 minTicks   = INT64_MAX;
+    Util::int64 totalTicks = 0;
+
+    for (Util::uint32 rep = 0; rep < m_config.repetitions; ++rep)
+    {
+        setup();
+
+        const Util::int64 begin = Util::GetPerfCpuTime();
+        body();
+        const Util::int64 ticks = Util::GetPerfCpuTime() - begin;
+
+        teardown();
+
+        minTicks    = Util::Min(minTicks, ticks);
+        totalTicks += ticks;
+    }
+
+    Record(pName, unit, count, TicksToNs(minTicks), TicksToNs(totalTicks / m_config.repetitions));
+}
+
+// A setup or teardown step which does nothing.
+inline void NoOp() { }
+
+typedef void (*BenchGroupFunc)(BenchContext* pContext);
+
+// Describes one group of related measurements.
+struct BenchGroup
+{
+    const char*    pName;
+    BenchGroupFunc pfnRun;
+};
+
+extern void RunHashMapBench(BenchContext* pContext);
+extern void RunHashSetBench(BenchContext* pContext);
+extern void RunVectorBench(BenchContext* pContext);
+extern void RunDequeBench(BenchContext* pContext);
+extern void RunSparseVectorBench(BenchContext* pContext);
+extern void RunIntervalTreeBench(BenchContext* pContext);
+extern void RunIntrusiveListBench(BenchContext* pContext);
+
+extern void RunLinearAllocatorBench(BenchContext* pContext);
+extern void RunBuddyAllocatorBench(BenchContext* pContext);
+extern void RunBestFitAllocatorBench(BenchContext* pContext);
+extern void RunSystemAllocatorBench(BenchContext* pContext);
+extern void RunSlabAllocatorBench(BenchContext* pContext);
+#if PAL_MEMTRACK
+extern void RunMemTrackerBench(BenchContext* pContext);
+#endif
+extern void RunStreamingMemBench(BenchContext* pContext);
+extern void RunCpuProfilerBench(BenchContext* pContext);
+
+extern void RunMetroHashBench(BenchContext* pContext);
+extern void RunMsgPackBench(BenchContext* pContext);
+extern void RunJsonWriterBench(BenchContext* pContext);
+extern void RunElfBuilderBench(BenchContext* pContext);
+
+extern void RunMutexStressBench(BenchContext* pContext);
+extern void RunRWLockStressBench(BenchContext* pContext);
+extern void RunQueueHandOffBench(BenchContext* pContext);
+
+extern void RunVamBench(BenchContext* pContext);
+extern void RunArchiveCacheBench(BenchContext* pContext);
+
+} // UtilBench